@@ -179,12 +179,12 @@ void BlenderSession::reset_session(BL::BlendData &b_data, BL::Depsgraph &b_depsg
     height = render_resolution_y(b_render);
   }
 
-  bool is_new_session = (session == NULL);
-  if (is_new_session) {
-    /* Initialize session and remember it was just created so not to
-     * re-create it below.
-     */
+  if (session == NULL) {
+    /* Initialize session. This already creates the sync object for the current scene, syncs the
+     * camera and resets the session for this frame, so the re-used session logic below is to be
+     * bypassed. */
     create_session();
+    return;
   }
 
   if (b_v3d) {
@@ -203,10 +203,8 @@ void BlenderSession::reset_session(BL::BlendData &b_data, BL::Depsgraph &b_depsg
     /* if scene or session parameters changed, it's easier to simply re-create
      * them rather than trying to distinguish which settings need to be updated
      */
-    if (!is_new_session) {
-      free_session();
-      create_session();
-    }
+    free_session();
+    create_session();
     return;
   }
 
@@ -217,16 +215,8 @@ void BlenderSession::reset_session(BL::BlendData &b_data, BL::Depsgraph &b_depsg
    */
   session->stats.mem_peak = session->stats.mem_used;
 
-  if (is_new_session) {
-    /* Sync object should be re-created for new scene. */
-    delete sync;
-    sync = new BlenderSync(
-        b_engine, b_data, b_scene, scene, !background, use_developer_ui, session->progress);
-  }
-  else {
-    /* Sync recalculations to do just the required updates. */
-    sync->sync_recalc(b_depsgraph, b_v3d);
-  }
+  /* Sync recalculations to do just the required updates. */
+  sync->sync_recalc(b_depsgraph, b_v3d);
 
   BL::Object b_camera_override(b_engine.camera_override());
   sync->sync_camera(b_render, b_camera_override, width, height, "");
@@ -603,6 +593,11 @@ void BlenderSession::bake(BL::Depsgraph &b_depsgraph_,
   /* Initialize bake manager, before we load the baking kernels. */
   scene->bake_manager->set(scene, b_object.name());
 
+  /* Delete the pass from any previous bake call, the session is re-used across calls
+   * when persistent data is enabled. */
+  set<Pass *> clear_passes(scene->passes.begin(), scene->passes.end());
+  scene->delete_nodes(clear_passes);
+
   /* Add render pass that we want to bake, and name it Combined so that it is
    * used as that on the Blender side. */
   Pass *pass = scene->create_node<Pass>();
@@ -620,9 +615,10 @@ void BlenderSession::bake(BL::Depsgraph &b_depsgraph_,
     sync->sync_data(
         b_render, b_depsgraph, b_v3d, b_camera_override, width, height, &python_thread_state);
 
-    /* Filtering settings for combined pass. */
+    /* Filtering settings for combined pass. For other passes restore the defaults,
+     * a previous combined bake may have modified them when the session is re-used. */
+    Integrator *integrator = scene->integrator;
     if (pass->get_type() == PASS_COMBINED) {
-      Integrator *integrator = scene->integrator;
       integrator->set_use_direct_light((bake_filter & BL::BakeSettings::pass_filter_DIRECT) != 0);
       integrator->set_use_indirect_light((bake_filter & BL::BakeSettings::pass_filter_INDIRECT) !=
                                          0);
@@ -632,6 +628,14 @@ void BlenderSession::bake(BL::Depsgraph &b_depsgraph_,
           (bake_filter & BL::BakeSettings::pass_filter_TRANSMISSION) != 0);
       integrator->set_use_emission((bake_filter & BL::BakeSettings::pass_filter_EMIT) != 0);
     }
+    else {
+      integrator->set_use_direct_light(true);
+      integrator->set_use_indirect_light(true);
+      integrator->set_use_diffuse(true);
+      integrator->set_use_glossy(true);
+      integrator->set_use_transmission(true);
+      integrator->set_use_emission(true);
+    }
 
     /* Always use transparent background for baking. */
     scene->background->set_transparent(true);
@@ -171,8 +171,12 @@ void BlenderSync::sync_recalc(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d
             object_map.set_recalc(b_ob);
           }
 
+          /* Adaptive subdivision meshes are also re-exported on transform changes, since the
+           * dicing is done in world space with edge lengths projected into the dicing camera.
+           * Shading-only updates do not affect the tessellation. */
           if (updated_geometry ||
-              (object_subdivision_type(b_ob, preview, experimental) != Mesh::SUBDIVISION_NONE)) {
+              (b_update.is_updated_transform() &&
+               object_subdivision_type(b_ob, preview, experimental) != Mesh::SUBDIVISION_NONE)) {
             BL::ID key = BKE_object_is_modified(b_ob) ? b_ob : b_ob.data();
             geometry_map.set_recalc(key);
 
@@ -11,6 +11,7 @@
 
 #  include "device/cuda/device_impl.h"
 
+#  include "util/algorithm.h"
 #  include "util/debug.h"
 #  include "util/foreach.h"
 #  include "util/log.h"
@@ -547,12 +548,11 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
   /* Signal to reallocate textures in host memory only. */
   move_texture_to_host = true;
 
-  while (size > 0) {
-    /* Find suitable memory allocation to move. */
-    device_memory *max_mem = NULL;
-    size_t max_size = 0;
-    bool max_is_image = false;
+  /* Find suitable memory allocations to move, in a single pass over the memory map instead of
+   * one pass per moved allocation, which gets slow on scenes with many textures. */
+  vector<pair<device_memory *, size_t>> candidates;
 
+  {
     thread_scoped_lock lock(cuda_mem_map_mutex);
     foreach (CUDAMemMap::value_type &pair, cuda_mem_map) {
       device_memory &mem = *pair.first;
@@ -578,41 +578,53 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
         continue;
       }
 
-      /* Try to move largest allocation, prefer moving images. */
-      if (is_image > max_is_image || (is_image == max_is_image && mem.device_size > max_size)) {
-        max_is_image = is_image;
-        max_size = mem.device_size;
-        max_mem = &mem;
-      }
+      candidates.push_back(std::make_pair(&mem, mem.device_size));
+    }
+  }
+
+  /* Demote image textures before 1D data textures, so that BVH and geometry data stays device
+   * resident as long as possible, and within each group the largest allocations first so the
+   * fewest textures take the host memory round trip. */
+  sort(candidates.begin(),
+       candidates.end(),
+       [](const pair<device_memory *, size_t> &a, const pair<device_memory *, size_t> &b) {
+         const bool a_is_image = (a.first->data_height > 1);
+         const bool b_is_image = (b.first->data_height > 1);
+         if (a_is_image != b_is_image) {
+           return a_is_image;
+         }
+         return a.second > b.second;
+       });
+
+  for (const pair<device_memory *, size_t> &candidate : candidates) {
+    if (size == 0) {
+      break;
     }
-    lock.unlock();
+
+    device_memory *max_mem = candidate.first;
+    const size_t max_size = candidate.second;
 
     /* Move to host memory. This part is mutex protected since
      * multiple CUDA devices could be moving the memory. The
      * first one will do it, and the rest will adopt the pointer. */
-    if (max_mem) {
-      VLOG(1) << "Move memory from device to host: " << max_mem->name;
+    VLOG(1) << "Move memory from device to host: " << max_mem->name;
 
-      static thread_mutex move_mutex;
-      thread_scoped_lock lock(move_mutex);
+    static thread_mutex move_mutex;
+    thread_scoped_lock lock(move_mutex);
 
-      any_device_moving_textures_to_host = true;
+    any_device_moving_textures_to_host = true;
 
-      /* Potentially need to call back into multi device, so pointer mapping
-       * and peer devices are updated. This is also necessary since the device
-       * pointer may just be a key here, so cannot be accessed and freed directly.
-       * Unfortunately it does mean that memory is reallocated on all other
-       * devices as well, which is potentially dangerous when still in use (since
-       * a thread rendering on another devices would only be caught in this mutex
-       * if it so happens to do an allocation at the same time as well. */
-      max_mem->device_copy_to();
-      size = (max_size >= size) ? 0 : size - max_size;
+    /* Potentially need to call back into multi device, so pointer mapping
+     * and peer devices are updated. This is also necessary since the device
+     * pointer may just be a key here, so cannot be accessed and freed directly.
+     * Unfortunately it does mean that memory is reallocated on all other
+     * devices as well, which is potentially dangerous when still in use (since
+     * a thread rendering on another devices would only be caught in this mutex
+     * if it so happens to do an allocation at the same time as well. */
+    max_mem->device_copy_to();
+    size = (max_size >= size) ? 0 : size - max_size;
 
-      any_device_moving_textures_to_host = false;
-    }
-    else {
-      break;
-    }
+    any_device_moving_textures_to_host = false;
   }
 
   /* Unset flag before texture info is reloaded, since it should stay in device memory. */
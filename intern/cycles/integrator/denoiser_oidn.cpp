@@ -150,9 +150,7 @@ class OIDNDenoiseContext {
 
     OIDNPass oidn_color_access_pass = read_input_pass(oidn_color_pass, oidn_output_pass);
 
-    oidn::DeviceRef oidn_device = oidn::newDevice();
-    oidn_device.set("setAffinity", false);
-    oidn_device.commit();
+    oidn::DeviceRef &oidn_device = ensure_oidn_device();
 
     /* Create a filter for denoising a beauty (color) image using prefiltered auxiliary images too.
      */
@@ -186,6 +184,18 @@ class OIDNDenoiseContext {
   }
 
  protected:
+  /* Creation of the OIDN device is rather expensive as it involves CPU detection and thread pool
+   * setup. Share a single device across all passes denoised within this context. */
+  oidn::DeviceRef &ensure_oidn_device()
+  {
+    if (!oidn_device_) {
+      oidn_device_ = oidn::newDevice();
+      oidn_device_.set("setAffinity", false);
+      oidn_device_.commit();
+    }
+    return oidn_device_;
+  }
+
   void filter_guiding_pass_if_needed(oidn::DeviceRef &oidn_device, OIDNPass &oidn_pass)
   {
     if (denoise_params_.prefilter != DENOISER_PREFILTER_ACCURATE || !oidn_pass ||
@@ -513,6 +523,9 @@ class OIDNDenoiseContext {
 
   OIDNDenoiser *denoiser_ = nullptr;
 
+  /* Device descriptor shared by all filters created within this context. */
+  oidn::DeviceRef oidn_device_;
+
   const DenoiseParams &denoise_params_;
   const BufferParams &buffer_params_;
   RenderBuffers *render_buffers_ = nullptr;
@@ -576,14 +589,14 @@ bool OIDNDenoiser::denoise_buffer(const BufferParams &buffer_params,
 #ifdef WITH_OPENIMAGEDENOISE
   thread_scoped_lock lock(mutex_);
 
-  /* Make sure the host-side data is available for denoising. */
-  unique_ptr<DeviceQueue> queue = create_device_queue(render_buffers);
-  copy_render_buffers_from_device(queue, render_buffers);
-
   OIDNDenoiseContext context(
       this, params_, buffer_params, render_buffers, num_samples, allow_inplace_modification);
 
   if (context.need_denoising()) {
+    /* Make sure the host-side data is available for denoising. */
+    unique_ptr<DeviceQueue> queue = create_device_queue(render_buffers);
+    copy_render_buffers_from_device(queue, render_buffers);
+
     context.read_guiding_passes();
 
     const std::array<PassType, 3> passes = {
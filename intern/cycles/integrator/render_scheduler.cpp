@@ -161,11 +161,26 @@ void RenderScheduler::reset(const BufferParams &buffer_params, int num_samples,
   first_render_time_.denoise_time = 0.0;
   first_render_time_.display_update_time = 0.0;
 
-  path_trace_time_.reset();
-  denoise_time_.reset();
-  adaptive_filter_time_.reset();
-  display_update_time_.reset();
-  rebalance_time_.reset();
+  if (background_ || headless_) {
+    /* Batch renders reset between tiles and animation frames, which have near-identical cost.
+     * Keep the measured average times so that the next iteration starts with properly sized
+     * sample batches instead of re-learning the timing from a single sample. The wall times are
+     * still per-iteration, so only those are cleared. */
+    path_trace_time_.reset_wall();
+    denoise_time_.reset_wall();
+    adaptive_filter_time_.reset_wall();
+    display_update_time_.reset_wall();
+    rebalance_time_.reset_wall();
+  }
+  else {
+    /* Interactive sessions reset on scene edits, which can change the cost arbitrarily, so the
+     * timing is measured from scratch. */
+    path_trace_time_.reset();
+    denoise_time_.reset();
+    adaptive_filter_time_.reset();
+    display_update_time_.reset();
+    rebalance_time_.reset();
+  }
 }
 
 void RenderScheduler::reset_for_next_tile()
@@ -797,8 +812,12 @@ int RenderScheduler::get_num_samples_to_path_trace() const
 
   /* Always start full resolution render  with a single sample. Gives more instant feedback to
    * artists, and allows to gather information for a subsequent path tracing works. Do it in the
-   * headless mode as well, to give some estimate of how long samples are taking. */
-  if (state_.num_rendered_samples == 0) {
+   * headless mode as well, to give some estimate of how long samples are taking.
+   *
+   * Note that in batch renders the average path tracing time is carried over from the previous
+   * tile or animation frame. When such warmed up statistics exists skip the single sample probe
+   * and size the first batch from it right away. */
+  if (state_.num_rendered_samples == 0 && path_trace_time_.get_average() == 0.0) {
     return 1;
   }
 
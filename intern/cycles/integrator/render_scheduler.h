@@ -292,6 +292,11 @@ class RenderScheduler {
       num_average_times_ = 0;
     }
 
+    inline void reset_wall()
+    {
+      total_wall_time_ = 0.0;
+    }
+
     inline void add_wall(double time)
     {
       total_wall_time_ += time;
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "util/hash.h"
+
 CCL_NAMESPACE_BEGIN
 
 /* Element of ID pass stored in the render buffers.
@@ -23,10 +25,17 @@ ccl_device_inline void kernel_write_id_slots(ccl_global float *buffer,
     return;
   }
 
-  for (int slot = 0; slot < num_slots; slot++) {
-    ccl_global IDPassBufferElement *id_buffer = (ccl_global IDPassBufferElement *)buffer;
+  /* Slots are indexed by a hash of the ID, so that in the common case a sample lands directly
+   * on the slot which already holds its ID instead of scanning all the preceding slots. On a
+   * hash collision linear probing continues from the hashed slot, wrapping around. The slots
+   * are compacted again by `kernel_sort_id_slots` before the pass is read. */
+  const int start_slot = (int)(hash_uint(__float_as_uint(id)) % (uint)num_slots);
+
+  ccl_global IDPassBufferElement *id_buffer = (ccl_global IDPassBufferElement *)buffer;
+  for (int i = 0; i < num_slots; i++) {
+    const int slot = (start_slot + i) % num_slots;
 #ifdef __ATOMIC_PASS_WRITE__
-    /* If the loop reaches an empty slot, the ID isn't in any slot yet - so add it! */
+    /* If probing reaches an empty slot, the ID isn't in any slot yet - so add it! */
     if (id_buffer[slot].x == ID_NONE) {
       /* Use an atomic to claim this slot.
        * If a different thread got here first, try again from this slot on. */
@@ -38,21 +47,21 @@ ccl_device_inline void kernel_write_id_slots(ccl_global float *buffer,
       break;
     }
     /* If there already is a slot for that ID, add the weight.
-     * If no slot was found, add it to the last. */
-    else if (id_buffer[slot].x == id || slot == num_slots - 1) {
+     * If no slot was found, add it to the last probed one. */
+    else if (id_buffer[slot].x == id || i == num_slots - 1) {
       atomic_add_and_fetch_float(buffer + slot * 2 + 1, weight);
       break;
     }
 #else  /* __ATOMIC_PASS_WRITE__ */
-    /* If the loop reaches an empty slot, the ID isn't in any slot yet - so add it! */
+    /* If probing reaches an empty slot, the ID isn't in any slot yet - so add it! */
     if (id_buffer[slot].x == ID_NONE) {
       id_buffer[slot].x = id;
       id_buffer[slot].y = weight;
       break;
     }
     /* If there already is a slot for that ID, add the weight.
-     * If no slot was found, add it to the last. */
-    else if (id_buffer[slot].x == id || slot == num_slots - 1) {
+     * If no slot was found, add it to the last probed one. */
+    else if (id_buffer[slot].x == id || i == num_slots - 1) {
       id_buffer[slot].y += weight;
       break;
     }
@@ -64,9 +73,9 @@ ccl_device_inline void kernel_sort_id_slots(ccl_global float *buffer, int num_sl
 {
   ccl_global IDPassBufferElement *id_buffer = (ccl_global IDPassBufferElement *)buffer;
   for (int slot = 1; slot < num_slots; ++slot) {
-    if (id_buffer[slot].x == ID_NONE) {
-      return;
-    }
+    /* Since the slots are hash-indexed, empty slots may precede claimed ones. Empty slots have
+     * zero weight while claimed ones are strictly positive, so sorting by weight also compacts
+     * the claimed IDs to the front of the buffer. */
     /* Since we're dealing with a tiny number of elements, insertion sort should be fine. */
     int i = slot;
     while (i > 0 && id_buffer[i].y > id_buffer[i - 1].y) {
@@ -1219,9 +1219,18 @@ void GeometryManager::device_update_mesh(Device *,
     float4 *points = dscene->points.alloc(point_size);
     uint *points_shader = dscene->points_shader.alloc(point_size);
 
+    const bool copy_all_data = dscene->points.need_realloc() ||
+                               dscene->points_shader.need_realloc();
+
     foreach (Geometry *geom, scene->geometry) {
       if (geom->is_pointcloud()) {
         PointCloud *pointcloud = static_cast<PointCloud *>(geom);
+
+        if (!pointcloud->points_is_modified() && !pointcloud->radius_is_modified() &&
+            !pointcloud->shader_is_modified() && !copy_all_data) {
+          continue;
+        }
+
         pointcloud->pack(
             scene, &points[pointcloud->prim_offset], &points_shader[pointcloud->prim_offset]);
         if (progress.get_cancel())
@@ -1229,8 +1238,8 @@ void GeometryManager::device_update_mesh(Device *,
       }
     }
 
-    dscene->points.copy_to_device();
-    dscene->points_shader.copy_to_device();
+    dscene->points.copy_to_device_if_modified();
+    dscene->points_shader.copy_to_device_if_modified();
   }
 
   if (patch_size != 0 && dscene->patches.need_realloc()) {
@@ -2026,11 +2035,30 @@ void GeometryManager::device_update(Device *device,
       }
     }
 
+    /* While the pool builds the object BVHs, pack and upload the geometry arrays on this
+     * thread. The BVH builders only read the host side geometry arrays and never the packed
+     * device arrays, so both stages are independent (the displacement path above already
+     * uploads the arrays before any BVH is built). This hides the packing and transfer time
+     * behind the BVH builds on scene load. */
+    {
+      scoped_callback_timer timer([scene](double time) {
+        if (scene->update_stats) {
+          scene->update_stats->geometry.times.add_entry(
+              {"device_update (copy meshes to device)", time});
+        }
+      });
+      device_update_mesh(device, dscene, scene, progress);
+    }
+
     TaskPool::Summary summary;
     pool.wait_work(&summary);
     VLOG(2) << "Objects BVH build pool statistics:\n" << summary.full_report();
   }
 
+  if (progress.get_cancel()) {
+    return;
+  }
+
   foreach (Shader *shader, scene->shaders) {
     shader->need_update_uvs = false;
     shader->need_update_attribute = false;
@@ -2047,9 +2075,16 @@ void GeometryManager::device_update(Device *device,
         scene->update_stats->geometry.times.add_entry({"device_update (compute bounds)", time});
       }
     });
-    foreach (Object *object, scene->objects) {
-      object->compute_bounds(motion_blur);
-    }
+    /* Bounds with motion blur sample the interpolated motion path at many points and become a
+     * bottleneck on large instance counts, so spread objects over threads. Grain size matches
+     * the object transform update. */
+    static const int OBJECTS_PER_TASK = 32;
+    parallel_for(blocked_range<size_t>(0, scene->objects.size(), OBJECTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     scene->objects[i]->compute_bounds(motion_blur);
+                   }
+                 });
   }
 
   if (progress.get_cancel()) {
@@ -2073,19 +2108,6 @@ void GeometryManager::device_update(Device *device,
   dscene->data.bvh.bvh_layout = BVHParams::best_bvh_layout(scene->params.bvh_layout,
                                                            device->get_bvh_layout_mask());
 
-  {
-    scoped_callback_timer timer([scene](double time) {
-      if (scene->update_stats) {
-        scene->update_stats->geometry.times.add_entry(
-            {"device_update (copy meshes to device)", time});
-      }
-    });
-    device_update_mesh(device, dscene, scene, progress);
-    if (progress.get_cancel()) {
-      return;
-    }
-  }
-
   if (true_displacement_used) {
     /* Re-tag flags for update, so they're re-evaluated
      * for meshes with correct bounding boxes.
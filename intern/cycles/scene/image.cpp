@@ -500,9 +500,16 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
     return false;
   }
 
+  /* The kernel can handle 1 and 4 channel images. Anything that is not a single
+   * channel image is converted to RGBA format. */
+  bool is_rgba = (img->metadata.type == IMAGE_DATA_TYPE_FLOAT4 ||
+                  img->metadata.type == IMAGE_DATA_TYPE_HALF4 ||
+                  img->metadata.type == IMAGE_DATA_TYPE_BYTE4 ||
+                  img->metadata.type == IMAGE_DATA_TYPE_USHORT4);
+
   /* Allocate memory as needed, may be smaller to resize down. */
   if (texture_limit > 0 && max_size > texture_limit) {
-    pixels_storage.resize(((size_t)width) * height * depth * 4);
+    pixels_storage.resize(((size_t)width) * height * depth * (is_rgba ? 4 : 1));
     pixels = &pixels_storage[0];
   }
   else {
@@ -519,13 +526,6 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
   img->loader->load_pixels(
       img->metadata, pixels, num_pixels * components, image_associate_alpha(img));
 
-  /* The kernel can handle 1 and 4 channel images. Anything that is not a single
-   * channel image is converted to RGBA format. */
-  bool is_rgba = (img->metadata.type == IMAGE_DATA_TYPE_FLOAT4 ||
-                  img->metadata.type == IMAGE_DATA_TYPE_HALF4 ||
-                  img->metadata.type == IMAGE_DATA_TYPE_BYTE4 ||
-                  img->metadata.type == IMAGE_DATA_TYPE_USHORT4);
-
   if (is_rgba) {
     const StorageType one = util_image_cast_from_float<StorageType>(1.0f);
 
@@ -620,6 +620,10 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
                              &scaled_height,
                              &scaled_depth);
 
+    /* Release the full resolution pixels before allocating the texture, to limit the peak
+     * memory usage while loading many large images. */
+    pixels_storage.free_memory();
+
     StorageType *texture_pixels;
 
     {
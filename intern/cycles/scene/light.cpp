@@ -258,6 +258,26 @@ bool LightManager::object_usable_as_light(Object *object)
   return false;
 }
 
+/* Compute for every shader slot of a mesh whether its triangles are sampled as lights, so the
+ * per-triangle loops of the distribution build only need an array lookup per triangle instead
+ * of resolving the shader. Out of range shader indices map to the last entry, matching the
+ * default surface shader fallback. */
+static vector<bool> mesh_light_shader_slots(Mesh *mesh, Scene *scene)
+{
+  const size_t num_shaders = mesh->get_used_shaders().size();
+  vector<bool> slots(num_shaders + 1);
+
+  for (size_t i = 0; i < num_shaders; i++) {
+    Shader *shader = static_cast<Shader *>(mesh->get_used_shaders()[i]);
+    slots[i] = shader->get_use_mis() && shader->has_surface_emission;
+  }
+
+  Shader *default_shader = scene->default_surface;
+  slots[num_shaders] = default_shader->get_use_mis() && default_shader->has_surface_emission;
+
+  return slots;
+}
+
 void LightManager::device_update_distribution(Device *,
                                               DeviceScene *dscene,
                                               Scene *scene,
@@ -292,14 +312,13 @@ void LightManager::device_update_distribution(Device *,
 
     /* Count triangles. */
     Mesh *mesh = static_cast<Mesh *>(object->get_geometry());
+    const vector<bool> shader_emits = mesh_light_shader_slots(mesh, scene);
+    const size_t num_shaders = mesh->get_used_shaders().size();
     size_t mesh_num_triangles = mesh->num_triangles();
     for (size_t i = 0; i < mesh_num_triangles; i++) {
-      int shader_index = mesh->get_shader()[i];
-      Shader *shader = (shader_index < mesh->get_used_shaders().size()) ?
-                           static_cast<Shader *>(mesh->get_used_shaders()[shader_index]) :
-                           scene->default_surface;
+      const size_t shader_index = mesh->get_shader()[i];
 
-      if (shader->get_use_mis() && shader->has_surface_emission) {
+      if (shader_emits[(shader_index < num_shaders) ? shader_index : num_shaders]) {
         num_triangles++;
       }
     }
@@ -350,14 +369,13 @@ void LightManager::device_update_distribution(Device *,
       shader_flag |= SHADER_EXCLUDE_SHADOW_CATCHER;
     }
 
+    const vector<bool> shader_emits = mesh_light_shader_slots(mesh, scene);
+    const size_t num_shaders = mesh->get_used_shaders().size();
     size_t mesh_num_triangles = mesh->num_triangles();
     for (size_t i = 0; i < mesh_num_triangles; i++) {
-      int shader_index = mesh->get_shader()[i];
-      Shader *shader = (shader_index < mesh->get_used_shaders().size()) ?
-                           static_cast<Shader *>(mesh->get_used_shaders()[shader_index]) :
-                           scene->default_surface;
+      const size_t shader_index = mesh->get_shader()[i];
 
-      if (shader->get_use_mis() && shader->has_surface_emission) {
+      if (shader_emits[(shader_index < num_shaders) ? shader_index : num_shaders]) {
         distribution[offset].totarea = totarea;
         distribution[offset].prim = i + mesh->prim_offset;
         distribution[offset].mesh_light.shader_flag = shader_flag;
@@ -103,6 +103,11 @@ void OSLShaderManager::device_update_specific(Device *device,
   OSLGlobals *og = (OSLGlobals *)device->get_cpu_osl_memory();
   Shader *background_shader = scene->background->get_shader(scene);
 
+  og->surface_state.reserve(scene->shaders.size());
+  og->volume_state.reserve(scene->shaders.size());
+  og->displacement_state.reserve(scene->shaders.size());
+  og->bump_state.reserve(scene->shaders.size());
+
   foreach (Shader *shader, scene->shaders) {
     assert(shader->graph);
 
@@ -205,6 +205,8 @@ Shader::Shader() : Node(get_node_type())
 
   displacement_method = DISPLACE_BUMP;
 
+  svm_compiled_background = false;
+
   id = -1;
 
   need_update_uvs = true;
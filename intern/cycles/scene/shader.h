@@ -15,6 +15,7 @@
 
 #include "graph/node.h"
 
+#include "util/array.h"
 #include "util/map.h"
 #include "util/param.h"
 #include "util/string.h"
@@ -128,6 +129,11 @@ class Shader : public Node {
   OSL::ShaderGroupRef osl_displacement_ref;
 #endif
 
+  /* SVM nodes from the previous compilation, re-used when the shader did not change. The
+   * background flag is part of the state since it affects the generated code. */
+  array<int4> svm_compiled_nodes;
+  bool svm_compiled_background;
+
   Shader();
   ~Shader();
 
@@ -44,13 +44,29 @@ void SVMShaderManager::device_update_shader(Scene *scene,
   }
   assert(shader->graph);
 
+  const bool background = (shader == scene->background->get_shader(scene));
+
+  /* Re-use the nodes from the previous compilation when the shader did not change. Shaders with
+   * an integrator dependency are always recompiled, since integrator changes tag the manager but
+   * not the individual shaders. */
+  if (!shader->is_modified() && !shader->has_integrator_dependency &&
+      shader->svm_compiled_background == background && shader->svm_compiled_nodes.size() != 0) {
+    *svm_nodes = shader->svm_compiled_nodes;
+
+    VLOG(3) << "Reusing compiled shader: " << shader->name;
+    return;
+  }
+
   svm_nodes->push_back_slow(make_int4(NODE_SHADER_JUMP, 0, 0, 0));
 
   SVMCompiler::Summary summary;
   SVMCompiler compiler(scene);
-  compiler.background = (shader == scene->background->get_shader(scene));
+  compiler.background = background;
   compiler.compile(shader, *svm_nodes, 0, &summary);
 
+  shader->svm_compiled_nodes = *svm_nodes;
+  shader->svm_compiled_background = background;
+
   VLOG(3) << "Compilation summary:\n"
           << "Shader name: " << shader->name << "\n"
           << summary.full_report();
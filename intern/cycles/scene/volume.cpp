@@ -486,6 +486,32 @@ static openvdb::GridBase::ConstPtr openvdb_grid_from_device_texture(device_textu
 
 /* ************************************************************************** */
 
+static void volume_mesh_from_data(Volume *volume,
+                                  Shader *volume_shader,
+                                  const vector<float3> &vertices,
+                                  const vector<int> &indices,
+                                  const vector<float3> &face_normals)
+{
+  volume->reserve_mesh(vertices.size(), indices.size() / 3);
+  volume->used_shaders.clear();
+  volume->used_shaders.push_back_slow(volume_shader);
+
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    volume->add_vertex(vertices[i]);
+  }
+
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    volume->add_triangle(indices[i], indices[i + 1], indices[i + 2], 0, false);
+  }
+
+  Attribute *attr_fN = volume->attributes.add(ATTR_STD_FACE_NORMAL);
+  float3 *fN = attr_fN->data_float3();
+
+  for (size_t i = 0; i < face_normals.size(); ++i) {
+    fN[i] = face_normals[i];
+  }
+}
+
 void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
 {
   string msg = string_printf("Computing Volume Mesh %s", volume->name.c_str());
@@ -579,6 +605,26 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
 
   builder.add_padding(pad_size);
 
+#ifdef WITH_OPENVDB
+  /* Voxelize active tiles already here, so that the topology comparison below sees the same
+   * tree as the mesh generation, which only handles leaf nodes. */
+  builder.topology_grid->tree().voxelizeActiveTiles();
+
+  /* Re-use the mesh from the previous update when the leaf topology and transform of the
+   * grids did not change, and skip the mesh extraction entirely. */
+  if (volume->cached_mesh_topology &&
+      volume->cached_mesh_topology->transform() == builder.topology_grid->transform() &&
+      volume->cached_mesh_topology->tree().hasSameTopology(builder.topology_grid->tree())) {
+    VLOG(1) << volume->name << " volume leaf topology unchanged, re-using bounds mesh.";
+    volume_mesh_from_data(volume,
+                          volume_shader,
+                          volume->cached_mesh_vertices,
+                          volume->cached_mesh_indices,
+                          volume->cached_mesh_face_normals);
+    return;
+  }
+#endif
+
   /* Slightly offset vertex coordinates to avoid overlapping faces with other
    * volumes or meshes. The proper solution would be to improve intersection in
    * the kernel to support robust handling of multiple overlapping faces or use
@@ -592,24 +638,7 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
   vector<float3> face_normals;
   builder.create_mesh(vertices, indices, face_normals, face_overlap_avoidance);
 
-  volume->reserve_mesh(vertices.size(), indices.size() / 3);
-  volume->used_shaders.clear();
-  volume->used_shaders.push_back_slow(volume_shader);
-
-  for (size_t i = 0; i < vertices.size(); ++i) {
-    volume->add_vertex(vertices[i]);
-  }
-
-  for (size_t i = 0; i < indices.size(); i += 3) {
-    volume->add_triangle(indices[i], indices[i + 1], indices[i + 2], 0, false);
-  }
-
-  Attribute *attr_fN = volume->attributes.add(ATTR_STD_FACE_NORMAL);
-  float3 *fN = attr_fN->data_float3();
-
-  for (size_t i = 0; i < face_normals.size(); ++i) {
-    fN[i] = face_normals[i];
-  }
+  volume_mesh_from_data(volume, volume_shader, vertices, indices, face_normals);
 
   /* Print stats. */
   VLOG(1) << "Memory usage volume mesh: "
@@ -617,6 +646,15 @@ void GeometryManager::create_volume_mesh(Volume *volume, Progress &progress)
               indices.size() * sizeof(int)) /
                  (1024.0 * 1024.0)
           << "Mb.";
+
+#ifdef WITH_OPENVDB
+  /* Cache the topology and mesh for re-use by the next update. The mask grid stores a single
+   * bit per voxel so the memory overhead is small compared to the grids themselves. */
+  volume->cached_mesh_topology = builder.topology_grid;
+  volume->cached_mesh_vertices = std::move(vertices);
+  volume->cached_mesh_indices = std::move(indices);
+  volume->cached_mesh_face_normals = std::move(face_normals);
+#endif
 }
 
 CCL_NAMESPACE_END
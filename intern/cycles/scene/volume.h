@@ -3,6 +3,10 @@
 
 #pragma once
 
+#ifdef WITH_OPENVDB
+#  include <openvdb/openvdb.h>
+#endif
+
 #include "graph/node.h"
 
 #include "scene/mesh.h"
@@ -20,6 +24,18 @@ class Volume : public Mesh {
   NODE_SOCKET_API(bool, object_space)
 
   virtual void clear(bool preserve_shaders = false) override;
+
+#ifdef WITH_OPENVDB
+  /* Topology of the voxel grids the bounds mesh was last generated from, together with the
+   * generated mesh data. When a later update has matching leaf topology the mesh is re-used
+   * instead of being extracted from the grids again, which is the common case during
+   * simulation playback where voxel values change every frame but the set of active leaf
+   * nodes stays stable. Deliberately survives clear(). */
+  openvdb::MaskGrid::Ptr cached_mesh_topology;
+  vector<float3> cached_mesh_vertices;
+  vector<int> cached_mesh_indices;
+  vector<float3> cached_mesh_face_normals;
+#endif
 };
 
 CCL_NAMESPACE_END
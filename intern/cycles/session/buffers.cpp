@@ -137,6 +137,7 @@ void BufferParams::update_passes()
 void BufferParams::update_passes(const vector<Pass *> &scene_passes)
 {
   passes.clear();
+  passes.reserve(scene_passes.size());
 
   pass_stride = 0;
   for (const Pass *scene_pass : scene_passes) {
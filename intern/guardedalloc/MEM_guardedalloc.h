@@ -172,6 +172,28 @@ extern void (*MEM_reset_peak_memory)(void);
 /** Get the peak memory usage in bytes, including mmap allocations. */
 extern size_t (*MEM_get_peak_memory)(void) ATTR_WARN_UNUSED_RESULT;
 
+/**
+ * Attribute all following allocations on this thread to the named scope, until the matching
+ * #MEM_scope_pop. Scopes may nest, allocations count towards the innermost scope only. The name
+ * must be static, because only a pointer to it is stored!
+ *
+ * Use this to answer "what is eating the memory" in production files: wrap a subsystem
+ * ("sculpt-undo", image cache, ...) and query the totals with #MEM_scope_usage_foreach, without
+ * the overhead of the fully guarded allocator or heap dumps.
+ */
+void MEM_scope_push(const char *name);
+void MEM_scope_pop(void);
+
+/**
+ * Call \a callback for every scope that has been pushed since startup, with the number of bytes
+ * currently allocated from within the scope and the peak of that counter.
+ */
+void MEM_scope_usage_foreach(void (*callback)(const char *name,
+                                              size_t mem_in_use,
+                                              size_t mem_peak,
+                                              void *user_data),
+                             void *user_data);
+
 #ifdef __GNUC__
 #  define MEM_SAFE_FREE(v) \
     do { \
@@ -229,6 +251,17 @@ void MEM_enable_fail_on_memleak(void);
  * NOTE: The switch between allocator types can only happen before any allocation did happen. */
 void MEM_use_lockfree_allocator(void);
 
+/* Switch allocator to the arena mode.
+ *
+ * Same as the lock-free allocator, but additionally caches small freed blocks in per-thread
+ * free-lists and serves small allocations from them, bypassing the system allocator. Use to cut
+ * allocator lock contention in heavily threaded workloads with lots of small allocations
+ * (mesh evaluation in particular). The cost is a small bounded amount of cached memory per
+ * thread that is only returned to the system on overflow.
+ *
+ * NOTE: The switch between allocator types can only happen before any allocation did happen. */
+void MEM_use_arena_allocator(void);
+
 /* Switch allocator to slow fully guarded mode.
  *
  * Use for debug purposes. This allocator contains lock section around every allocator call, which
@@ -131,6 +131,24 @@ void MEM_use_lockfree_allocator(void)
 #endif
 }
 
+void MEM_use_arena_allocator(void)
+{
+  assert_for_allocator_change();
+
+  /* Start from the lock-free configuration: the arena allocator shares its MemHead layout and
+   * statistics, only the allocating functions are overridden below. */
+  MEM_use_lockfree_allocator();
+
+  MEM_freeN = MEM_arena_freeN;
+  MEM_dupallocN = MEM_arena_dupallocN;
+  MEM_reallocN_id = MEM_arena_reallocN_id;
+  MEM_recallocN_id = MEM_arena_recallocN_id;
+  MEM_callocN = MEM_arena_callocN;
+  MEM_calloc_arrayN = MEM_arena_calloc_arrayN;
+  MEM_mallocN = MEM_arena_mallocN;
+  MEM_malloc_arrayN = MEM_arena_malloc_arrayN;
+}
+
 void MEM_use_guarded_allocator(void)
 {
   assert_for_allocator_change();
@@ -81,7 +81,8 @@ typedef struct MemHead {
   const char *name;
   const char *nextname;
   int tag2;
-  short pad1;
+  /* Index of the #MEM_scope_push scope active at allocation time, 0 for none. */
+  short scope;
   /* if non-zero aligned allocation was used and alignment is stored here. */
   short alignment;
 #ifdef DEBUG_MEMCOUNTER
@@ -398,11 +399,13 @@ static void make_memhead_header(MemHead *memh, size_t len, const char *str)
 {
   MemTail *memt;
 
+  const unsigned int scope = memory_scope_current();
+
   memh->tag1 = MEMTAG1;
   memh->name = str;
   memh->nextname = NULL;
   memh->len = len;
-  memh->pad1 = 0;
+  memh->scope = (short)scope;
   memh->alignment = 0;
   memh->tag2 = MEMTAG2;
 
@@ -419,6 +422,7 @@ static void make_memhead_header(MemHead *memh, size_t len, const char *str)
 
   atomic_add_and_fetch_u(&totblock, 1);
   atomic_add_and_fetch_z(&mem_in_use, len);
+  memory_scope_usage_add(scope, len);
 
   mem_lock_thread();
   addtail(membase, &memh->next);
@@ -684,6 +688,7 @@ void MEM_guarded_printmemlist_stats(void)
   printf("\ntotal memory len: %.3f MB\n", (double)mem_in_use / (double)(1024 * 1024));
   printf("peak memory len: %.3f MB\n", (double)peak_mem / (double)(1024 * 1024));
   printf("slop memory len: %.3f MB\n", (double)mem_in_use_slop / (double)(1024 * 1024));
+  memory_scope_usage_print();
   printf(" ITEMS TOTAL-MiB AVERAGE-KiB TYPE\n");
   for (a = 0, pb = printblock; a < totpb; a++, pb++) {
     printf("%6d (%8.3f  %8.3f) %s\n",
@@ -990,6 +995,7 @@ static void rem_memblock(MemHead *memh)
 
   atomic_sub_and_fetch_u(&totblock, 1);
   atomic_sub_and_fetch_z(&mem_in_use, memh->len);
+  memory_scope_usage_sub((unsigned int)memh->scope, memh->len);
 
 #ifdef DEBUG_MEMDUPLINAME
   if (memh->need_free_name)
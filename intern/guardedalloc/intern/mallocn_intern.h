@@ -69,6 +69,12 @@ size_t malloc_usable_size(void *ptr);
 
 #define IS_POW2(a) (((a) & ((a)-1)) == 0)
 
+#ifdef _MSC_VER
+#  define MEM_THREAD_LOCAL __declspec(thread)
+#else
+#  define MEM_THREAD_LOCAL __thread
+#endif
+
 /* Extra padding which needs to be applied on MemHead to make it aligned. */
 #define MEMHEAD_ALIGN_PADDING(alignment) \
   ((size_t)alignment - (sizeof(MemHeadAligned) % (size_t)alignment))
@@ -90,6 +96,19 @@ void aligned_free(void *ptr);
 extern bool leak_detector_has_run;
 extern char free_after_leak_detection_message[];
 
+/* Named allocation scopes (mallocn_scope.c), shared between the allocator implementations.
+ * Scope index 0 means "no scope active" and keeps no counters; the lock-free allocator packs the
+ * index into spare high bits of `MemHead.len`, so the registry has to stay small. */
+#define MEM_SCOPES_BITS 6
+#define MEM_SCOPES_MAX (1 << MEM_SCOPES_BITS)
+
+/** Registry index of this thread's innermost scope, 0 when no scope is active. */
+unsigned int memory_scope_current(void);
+void memory_scope_usage_add(unsigned int scope_index, size_t len);
+void memory_scope_usage_sub(unsigned int scope_index, size_t len);
+/** Print per-scope totals, for the `*_printmemlist_stats` implementations. */
+void memory_scope_usage_print(void);
+
 /* Prototypes for counted allocator functions */
 size_t MEM_lockfree_allocN_len(const void *vmemh) ATTR_WARN_UNUSED_RESULT;
 void MEM_lockfree_freeN(void *vmemh);
@@ -133,6 +152,28 @@ size_t MEM_lockfree_get_peak_memory(void) ATTR_WARN_UNUSED_RESULT;
 const char *MEM_lockfree_name_ptr(void *vmemh);
 #endif
 
+/* Prototypes for the arena allocator functions. This allocator is a variant of the lock-free one
+ * (same MemHead and statistics) with per-thread caching of small blocks, so only the allocating
+ * functions differ, the queries and statistics are shared with MEM_lockfree_*. */
+void MEM_arena_freeN(void *vmemh);
+void *MEM_arena_dupallocN(const void *vmemh) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
+void *MEM_arena_reallocN_id(void *vmemh, size_t len, const char *str) ATTR_MALLOC
+    ATTR_WARN_UNUSED_RESULT ATTR_ALLOC_SIZE(2);
+void *MEM_arena_recallocN_id(void *vmemh, size_t len, const char *str) ATTR_MALLOC
+    ATTR_WARN_UNUSED_RESULT ATTR_ALLOC_SIZE(2);
+void *MEM_arena_callocN(size_t len, const char *str) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
+    ATTR_ALLOC_SIZE(1) ATTR_NONNULL(2);
+void *MEM_arena_calloc_arrayN(size_t len,
+                              size_t size,
+                              const char *str) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
+    ATTR_ALLOC_SIZE(1, 2) ATTR_NONNULL(3);
+void *MEM_arena_mallocN(size_t len, const char *str) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
+    ATTR_ALLOC_SIZE(1) ATTR_NONNULL(2);
+void *MEM_arena_malloc_arrayN(size_t len,
+                              size_t size,
+                              const char *str) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
+    ATTR_ALLOC_SIZE(1, 2) ATTR_NONNULL(3);
+
 /* Prototypes for fully guarded allocator functions */
 size_t MEM_guarded_allocN_len(const void *vmemh) ATTR_WARN_UNUSED_RESULT;
 void MEM_guarded_freeN(void *vmemh);
@@ -45,6 +45,22 @@ enum {
 #define MEMHEAD_ALIGNED_FROM_PTR(ptr) (((MemHeadAligned *)ptr) - 1)
 #define MEMHEAD_IS_ALIGNED(memhead) ((memhead)->len & (size_t)MEMHEAD_ALIGN_FLAG)
 
+/* The index of the active #MEM_scope_push scope is packed into spare high bits of `len`, so the
+ * matching free can be subtracted from the right scope without growing MemHead. Blocks too large
+ * for the remaining bits are left unattributed (scope 0). */
+#define MEMHEAD_SCOPE_SHIFT (sizeof(size_t) * 8 - MEM_SCOPES_BITS)
+#define MEMHEAD_SCOPE_MASK ((size_t)(MEM_SCOPES_MAX - 1) << MEMHEAD_SCOPE_SHIFT)
+#define MEMHEAD_SCOPE(memhead) ((unsigned int)((memhead)->len >> MEMHEAD_SCOPE_SHIFT))
+#define MEMHEAD_LEN_MASK (~(MEMHEAD_SCOPE_MASK | (size_t)MEMHEAD_ALIGN_FLAG))
+
+MEM_INLINE unsigned int memhead_scope_for_len(size_t len)
+{
+  if (UNLIKELY(len >= ((size_t)1 << MEMHEAD_SCOPE_SHIFT))) {
+    return 0;
+  }
+  return memory_scope_current();
+}
+
 /* Uncomment this to have proper peak counter. */
 #define USE_ATOMIC_MAX
 
@@ -79,7 +95,7 @@ print_error(const char *str, ...)
 size_t MEM_lockfree_allocN_len(const void *vmemh)
 {
   if (vmemh) {
-    return MEMHEAD_FROM_PTR(vmemh)->len & ~((size_t)(MEMHEAD_ALIGN_FLAG));
+    return MEMHEAD_FROM_PTR(vmemh)->len & MEMHEAD_LEN_MASK;
   }
 
   return 0;
@@ -104,6 +120,7 @@ void MEM_lockfree_freeN(void *vmemh)
 
   atomic_sub_and_fetch_u(&totblock, 1);
   atomic_sub_and_fetch_z(&mem_in_use, len);
+  memory_scope_usage_sub(MEMHEAD_SCOPE(memh), len);
 
   if (UNLIKELY(malloc_debug_memset && len)) {
     memset(memh + 1, 255, len);
@@ -222,10 +239,12 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
   memh = (MemHead *)calloc(1, len + sizeof(MemHead));
 
   if (LIKELY(memh)) {
-    memh->len = len;
+    const unsigned int scope = memhead_scope_for_len(len);
+    memh->len = len | ((size_t)scope << MEMHEAD_SCOPE_SHIFT);
     atomic_add_and_fetch_u(&totblock, 1);
     atomic_add_and_fetch_z(&mem_in_use, len);
     update_maximum(&peak_mem, mem_in_use);
+    memory_scope_usage_add(scope, len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -267,10 +286,12 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
       memset(memh + 1, 255, len);
     }
 
-    memh->len = len;
+    const unsigned int scope = memhead_scope_for_len(len);
+    memh->len = len | ((size_t)scope << MEMHEAD_SCOPE_SHIFT);
     atomic_add_and_fetch_u(&totblock, 1);
     atomic_add_and_fetch_z(&mem_in_use, len);
     update_maximum(&peak_mem, mem_in_use);
+    memory_scope_usage_add(scope, len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -337,11 +358,13 @@ void *MEM_lockfree_mallocN_aligned(size_t len, size_t alignment, const char *str
       memset(memh + 1, 255, len);
     }
 
-    memh->len = len | (size_t)MEMHEAD_ALIGN_FLAG;
+    const unsigned int scope = memhead_scope_for_len(len);
+    memh->len = len | (size_t)MEMHEAD_ALIGN_FLAG | ((size_t)scope << MEMHEAD_SCOPE_SHIFT);
     memh->alignment = (short)alignment;
     atomic_add_and_fetch_u(&totblock, 1);
     atomic_add_and_fetch_z(&mem_in_use, len);
     update_maximum(&peak_mem, mem_in_use);
+    memory_scope_usage_add(scope, len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
@@ -352,6 +375,299 @@ void *MEM_lockfree_mallocN_aligned(size_t len, size_t alignment, const char *str
   return NULL;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Arena Allocator
+ *
+ * Variant of the lock-free allocator which caches small freed blocks in per-thread "magazines"
+ * (one free-list per power-of-two size class). Small allocations are rounded up to their size
+ * class and served from the current thread's magazine when possible, which avoids both the
+ * system allocator's locking and cache-line ping-pong on its internal state under heavy
+ * multi-threaded churn (CustomData layers, GHash entries, ...).
+ *
+ * Blocks may be freed on a different thread than the one which allocated them, the block then
+ * simply ends up in the freeing thread's magazine. Magazines are bounded (at most
+ * #ARENA_MAGAZINE_CAPACITY blocks per size class per thread, less than 100KB), overflow is
+ * returned to the system allocator. Cached blocks are not accounted in the memory-in-use
+ * counters and are invisible to the leak detector, same as memory cached inside the system
+ * allocator itself.
+ *
+ * Aligned and large allocations are not cached and behave exactly as in the lock-free allocator.
+ * \{ */
+
+/* Size classes are powers of two covering the whole block (requested size plus #MemHead),
+ * 32 bytes up to 512 bytes. */
+#define ARENA_CLASS_SIZE_MIN ((size_t)32)
+#define ARENA_CLASS_SIZE_MAX ((size_t)512)
+#define ARENA_CLASS_COUNT 5
+/* Maximum number of cached blocks per size class per thread. */
+#define ARENA_MAGAZINE_CAPACITY 64
+
+typedef struct ArenaFreeBlock {
+  struct ArenaFreeBlock *next;
+} ArenaFreeBlock;
+
+typedef struct ArenaMagazine {
+  ArenaFreeBlock *blocks[ARENA_CLASS_COUNT];
+  int count[ARENA_CLASS_COUNT];
+} ArenaMagazine;
+
+/* Zero-initialized, never flushed: worker threads are pooled and long-lived. */
+static MEM_THREAD_LOCAL ArenaMagazine arena_magazine;
+
+MEM_INLINE int arena_class_index(size_t total_size)
+{
+  size_t class_size = ARENA_CLASS_SIZE_MIN;
+  int class_index = 0;
+  while (class_size < total_size) {
+    class_size <<= 1;
+    class_index++;
+  }
+  return class_index;
+}
+
+MEM_INLINE size_t arena_class_size(int class_index)
+{
+  return ARENA_CLASS_SIZE_MIN << class_index;
+}
+
+void *MEM_arena_mallocN(size_t len, const char *str)
+{
+  MemHead *memh;
+
+  len = SIZET_ALIGN_4(len);
+
+  const size_t total_size = len + sizeof(MemHead);
+  if (total_size > ARENA_CLASS_SIZE_MAX) {
+    return MEM_lockfree_mallocN(len, str);
+  }
+
+  const int class_index = arena_class_index(total_size);
+  ArenaMagazine *magazine = &arena_magazine;
+  if (magazine->blocks[class_index] != NULL) {
+    memh = (MemHead *)magazine->blocks[class_index];
+    magazine->blocks[class_index] = magazine->blocks[class_index]->next;
+    magazine->count[class_index]--;
+  }
+  else {
+    memh = (MemHead *)malloc(arena_class_size(class_index));
+  }
+
+  if (LIKELY(memh)) {
+    if (UNLIKELY(malloc_debug_memset && len)) {
+      memset(memh + 1, 255, len);
+    }
+
+    const unsigned int scope = memhead_scope_for_len(len);
+    memh->len = len | ((size_t)scope << MEMHEAD_SCOPE_SHIFT);
+    atomic_add_and_fetch_u(&totblock, 1);
+    atomic_add_and_fetch_z(&mem_in_use, len);
+    update_maximum(&peak_mem, mem_in_use);
+    memory_scope_usage_add(scope, len);
+
+    return PTR_FROM_MEMHEAD(memh);
+  }
+  print_error("Malloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
+              SIZET_ARG(len),
+              str,
+              (unsigned int)mem_in_use);
+  return NULL;
+}
+
+void *MEM_arena_callocN(size_t len, const char *str)
+{
+  /* Cached blocks contain stale data, so unlike the lock-free allocator there is no benefit in
+   * the zeroed pages `calloc()` can return, always clear explicitly. */
+  void *ptr = MEM_arena_mallocN(len, str);
+  if (LIKELY(ptr)) {
+    memset(ptr, 0, MEM_lockfree_allocN_len(ptr));
+  }
+  return ptr;
+}
+
+void MEM_arena_freeN(void *vmemh)
+{
+  if (leak_detector_has_run) {
+    print_error("%s\n", free_after_leak_detection_message);
+  }
+
+  if (vmemh == NULL) {
+    print_error("Attempt to free NULL pointer\n");
+#ifdef WITH_ASSERT_ABORT
+    abort();
+#endif
+    return;
+  }
+
+  MemHead *memh = MEMHEAD_FROM_PTR(vmemh);
+  size_t len = MEM_lockfree_allocN_len(vmemh);
+
+  atomic_sub_and_fetch_u(&totblock, 1);
+  atomic_sub_and_fetch_z(&mem_in_use, len);
+  memory_scope_usage_sub(MEMHEAD_SCOPE(memh), len);
+
+  if (UNLIKELY(malloc_debug_memset && len)) {
+    memset(memh + 1, 255, len);
+  }
+  if (UNLIKELY(MEMHEAD_IS_ALIGNED(memh))) {
+    MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+    aligned_free(MEMHEAD_REAL_PTR(memh_aligned));
+    return;
+  }
+
+  /* `len` was aligned on allocation, so this recovers the allocation's size class. */
+  const size_t total_size = len + sizeof(MemHead);
+  if (total_size > ARENA_CLASS_SIZE_MAX) {
+    free(memh);
+    return;
+  }
+
+  const int class_index = arena_class_index(total_size);
+  ArenaMagazine *magazine = &arena_magazine;
+  if (magazine->count[class_index] == ARENA_MAGAZINE_CAPACITY) {
+    free(memh);
+    return;
+  }
+
+  ArenaFreeBlock *block = (ArenaFreeBlock *)memh;
+  block->next = magazine->blocks[class_index];
+  magazine->blocks[class_index] = block;
+  magazine->count[class_index]++;
+}
+
+void *MEM_arena_dupallocN(const void *vmemh)
+{
+  void *newp = NULL;
+  if (vmemh) {
+    MemHead *memh = MEMHEAD_FROM_PTR(vmemh);
+    const size_t prev_size = MEM_lockfree_allocN_len(vmemh);
+    if (UNLIKELY(MEMHEAD_IS_ALIGNED(memh))) {
+      MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+      newp = MEM_lockfree_mallocN_aligned(
+          prev_size, (size_t)memh_aligned->alignment, "dupli_malloc");
+    }
+    else {
+      newp = MEM_arena_mallocN(prev_size, "dupli_malloc");
+    }
+    memcpy(newp, vmemh, prev_size);
+  }
+  return newp;
+}
+
+void *MEM_arena_reallocN_id(void *vmemh, size_t len, const char *str)
+{
+  void *newp = NULL;
+
+  if (vmemh) {
+    MemHead *memh = MEMHEAD_FROM_PTR(vmemh);
+    size_t old_len = MEM_lockfree_allocN_len(vmemh);
+
+    if (LIKELY(!MEMHEAD_IS_ALIGNED(memh))) {
+      newp = MEM_arena_mallocN(len, "realloc");
+    }
+    else {
+      MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+      newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "realloc");
+    }
+
+    if (newp) {
+      if (len < old_len) {
+        /* shrink */
+        memcpy(newp, vmemh, len);
+      }
+      else {
+        /* grow (or remain same size) */
+        memcpy(newp, vmemh, old_len);
+      }
+    }
+
+    MEM_arena_freeN(vmemh);
+  }
+  else {
+    newp = MEM_arena_mallocN(len, str);
+  }
+
+  return newp;
+}
+
+void *MEM_arena_recallocN_id(void *vmemh, size_t len, const char *str)
+{
+  void *newp = NULL;
+
+  if (vmemh) {
+    MemHead *memh = MEMHEAD_FROM_PTR(vmemh);
+    size_t old_len = MEM_lockfree_allocN_len(vmemh);
+
+    if (LIKELY(!MEMHEAD_IS_ALIGNED(memh))) {
+      newp = MEM_arena_mallocN(len, "recalloc");
+    }
+    else {
+      MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
+      newp = MEM_lockfree_mallocN_aligned(len, (size_t)memh_aligned->alignment, "recalloc");
+    }
+
+    if (newp) {
+      if (len < old_len) {
+        /* shrink */
+        memcpy(newp, vmemh, len);
+      }
+      else {
+        memcpy(newp, vmemh, old_len);
+
+        if (len > old_len) {
+          /* grow */
+          /* zero new bytes */
+          memset(((char *)newp) + old_len, 0, len - old_len);
+        }
+      }
+    }
+
+    MEM_arena_freeN(vmemh);
+  }
+  else {
+    newp = MEM_arena_callocN(len, str);
+  }
+
+  return newp;
+}
+
+void *MEM_arena_malloc_arrayN(size_t len, size_t size, const char *str)
+{
+  size_t total_size;
+  if (UNLIKELY(!MEM_size_safe_multiply(len, size, &total_size))) {
+    print_error(
+        "Malloc array aborted due to integer overflow: "
+        "len=" SIZET_FORMAT "x" SIZET_FORMAT " in %s, total %u\n",
+        SIZET_ARG(len),
+        SIZET_ARG(size),
+        str,
+        (unsigned int)mem_in_use);
+    abort();
+    return NULL;
+  }
+
+  return MEM_arena_mallocN(total_size, str);
+}
+
+void *MEM_arena_calloc_arrayN(size_t len, size_t size, const char *str)
+{
+  size_t total_size;
+  if (UNLIKELY(!MEM_size_safe_multiply(len, size, &total_size))) {
+    print_error(
+        "Calloc array aborted due to integer overflow: "
+        "len=" SIZET_FORMAT "x" SIZET_FORMAT " in %s, total %u\n",
+        SIZET_ARG(len),
+        SIZET_ARG(size),
+        str,
+        (unsigned int)mem_in_use);
+    abort();
+    return NULL;
+  }
+
+  return MEM_arena_callocN(total_size, str);
+}
+
+/** \} */
+
 void MEM_lockfree_printmemlist_pydict(void)
 {
 }
@@ -370,6 +686,7 @@ void MEM_lockfree_printmemlist_stats(void)
 {
   printf("\ntotal memory len: %.3f MB\n", (double)mem_in_use / (double)(1024 * 1024));
   printf("peak memory len: %.3f MB\n", (double)peak_mem / (double)(1024 * 1024));
+  memory_scope_usage_print();
   printf(
       "\nFor more detailed per-block statistics run Blender with memory debugging command line "
       "argument.\n");
@@ -0,0 +1,150 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup intern_mem
+ *
+ * Attribution of allocations to named scopes, see #MEM_scope_push.
+ *
+ * Scopes live in a small fixed-size registry shared by all allocator implementations. On
+ * allocation the allocator stores the index of the thread's innermost scope in its MemHead, so
+ * the matching free (which may happen on another thread, long after the scope was popped) is
+ * subtracted from the right counter. The scope stack itself is thread-local: worker threads
+ * doing unrelated allocations do not pollute a scope pushed on the main thread.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "MEM_guardedalloc.h"
+
+#include "atomic_ops.h"
+#include "mallocn_intern.h"
+
+typedef struct MemScope {
+  /** Static string passed to #MEM_scope_push, compared by pointer first then by content. */
+  const char *name;
+  size_t mem_in_use;
+  size_t mem_peak;
+} MemScope;
+
+/* Slot 0 is reserved for "no scope active" and keeps no counters. */
+static MemScope scopes[MEM_SCOPES_MAX];
+/* Number of used slots, only ever grows. Updated with the registration lock held, slots below
+ * the published count are immutable so lock-free lookup is safe. */
+static unsigned int totscope = 1;
+/* Spin-lock guarding registration of new scopes (registration is rare, lookup is lock-free). */
+static unsigned int scope_register_lock = 0;
+
+/* Nesting deeper than this is attributed to the scope at the stack limit, which is plenty for
+ * the intended "one scope per subsystem" use. */
+#define MEM_SCOPE_STACK_MAX 16
+
+static MEM_THREAD_LOCAL unsigned int scope_stack[MEM_SCOPE_STACK_MAX];
+static MEM_THREAD_LOCAL int scope_stack_num = 0;
+
+static unsigned int scope_index_find(const char *name, const unsigned int num)
+{
+  for (unsigned int i = 1; i < num; i++) {
+    if (scopes[i].name == name || strcmp(scopes[i].name, name) == 0) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+static unsigned int scope_index_ensure(const char *name)
+{
+  unsigned int index = scope_index_find(name, atomic_add_and_fetch_u(&totscope, 0));
+  if (index != 0) {
+    return index;
+  }
+
+  while (atomic_cas_u(&scope_register_lock, 0, 1) != 0) {
+    /* Spin, registration only ever happens on the first push of a name. */
+  }
+
+  /* Re-scan, the scope may have been registered while waiting for the lock. */
+  const unsigned int num = totscope;
+  index = scope_index_find(name, num);
+  if (index == 0 && num < MEM_SCOPES_MAX) {
+    index = num;
+    scopes[index].name = name;
+    /* CAS so the name written above is published before the new count becomes visible. */
+    atomic_cas_u(&totscope, num, num + 1);
+  }
+
+  atomic_cas_u(&scope_register_lock, 1, 0);
+
+  /* Registry full: allocations are left unattributed rather than failing. */
+  return index;
+}
+
+void MEM_scope_push(const char *name)
+{
+  if (scope_stack_num < MEM_SCOPE_STACK_MAX) {
+    scope_stack[scope_stack_num] = scope_index_ensure(name);
+  }
+  scope_stack_num++;
+}
+
+void MEM_scope_pop(void)
+{
+  assert(scope_stack_num > 0);
+  if (scope_stack_num > 0) {
+    scope_stack_num--;
+  }
+}
+
+unsigned int memory_scope_current(void)
+{
+  if (scope_stack_num == 0) {
+    return 0;
+  }
+  const int top = (scope_stack_num < MEM_SCOPE_STACK_MAX ? scope_stack_num :
+                                                           MEM_SCOPE_STACK_MAX) -
+                  1;
+  return scope_stack[top];
+}
+
+void memory_scope_usage_add(unsigned int scope_index, size_t len)
+{
+  if (scope_index != 0) {
+    const size_t mem_in_use = atomic_add_and_fetch_z(&scopes[scope_index].mem_in_use, len);
+    atomic_fetch_and_update_max_z(&scopes[scope_index].mem_peak, mem_in_use);
+  }
+}
+
+void memory_scope_usage_sub(unsigned int scope_index, size_t len)
+{
+  if (scope_index != 0) {
+    atomic_sub_and_fetch_z(&scopes[scope_index].mem_in_use, len);
+  }
+}
+
+void memory_scope_usage_print(void)
+{
+  const unsigned int num = atomic_add_and_fetch_u(&totscope, 0);
+  if (num <= 1) {
+    return;
+  }
+  printf("\nNamed scopes (in use / peak):\n");
+  for (unsigned int i = 1; i < num; i++) {
+    printf("  %-24s %.3f MB / %.3f MB\n",
+           scopes[i].name,
+           (double)scopes[i].mem_in_use / (double)(1024 * 1024),
+           (double)scopes[i].mem_peak / (double)(1024 * 1024));
+  }
+}
+
+void MEM_scope_usage_foreach(void (*callback)(const char *name,
+                                              size_t mem_in_use,
+                                              size_t mem_peak,
+                                              void *user_data),
+                             void *user_data)
+{
+  const unsigned int num = atomic_add_and_fetch_u(&totscope, 0);
+  for (unsigned int i = 1; i < num; i++) {
+    callback(scopes[i].name, scopes[i].mem_in_use, scopes[i].mem_peak, user_data);
+  }
+}
@@ -201,6 +201,32 @@ Marker libmv_projectMarker(const EuclideanPoint& point,
   return reprojected_marker;
 }
 
+/* Inverse of the conversion done by libmv_reprojectionCameraForImage(). */
+void libmv_cameraFromReprojectionMatrix(const double* mat /* 4x4, row-major */,
+                                        EuclideanCamera* camera) {
+  for (int j = 0; j < 3; ++j) {
+    for (int k = 0; k < 3; ++k) {
+      int l = k;
+
+      if (k == 1) {
+        l = 2;
+      } else if (k == 2) {
+        l = 1;
+      }
+
+      if (j == 2) {
+        camera->R(j, k) = -mat[4 * j + l];
+      } else {
+        camera->R(j, k) = mat[4 * j + l];
+      }
+    }
+  }
+
+  const libmv::Vec3 optical_center(mat[4 * 3 + 0], mat[4 * 3 + 2],
+                                   mat[4 * 3 + 1]);
+  camera->t = -camera->R * optical_center;
+}
+
 void libmv_getNormalizedTracks(const Tracks& tracks,
                                const CameraIntrinsics& camera_intrinsics,
                                Tracks* normalized_tracks) {
@@ -312,6 +338,90 @@ libmv_Reconstruction* libmv_solveReconstruction(
   return (libmv_Reconstruction*)libmv_reconstruction;
 }
 
+libmv_Reconstruction* libmv_solveReconstructionIncremental(
+    const libmv_Tracks* libmv_tracks,
+    const libmv_CameraIntrinsicsOptions* libmv_camera_intrinsics_options,
+    libmv_ReconstructionOptions* libmv_reconstruction_options,
+    const libmv_InitialReconstruction* libmv_initial_reconstruction,
+    reconstruct_progress_update_cb progress_update_callback,
+    void* callback_customdata) {
+  libmv_Reconstruction* libmv_reconstruction =
+      LIBMV_OBJECT_NEW(libmv_Reconstruction);
+
+  Tracks& tracks = *((Tracks*)libmv_tracks);
+  EuclideanReconstruction& reconstruction =
+      libmv_reconstruction->reconstruction;
+
+  ReconstructUpdateCallback update_callback =
+      ReconstructUpdateCallback(progress_update_callback, callback_customdata);
+
+  /* Retrieve reconstruction options from C-API to libmv API. */
+  CameraIntrinsics* camera_intrinsics;
+  camera_intrinsics = libmv_reconstruction->intrinsics =
+      libmv_cameraIntrinsicsCreateFromOptions(libmv_camera_intrinsics_options);
+
+  /* Invert the camera intrinsics. */
+  Tracks normalized_tracks;
+  libmv_getNormalizedTracks(tracks, *camera_intrinsics, &normalized_tracks);
+
+  /* Seed the reconstruction from the previous solution. Bundle adjustment
+   * refines from the parameter values which are currently in the
+   * reconstruction, so this acts as a warm start: only cameras and points
+   * which did not exist in the previous solve are initialized from scratch
+   * by the resection/intersection loop below. */
+  update_callback.invoke(0, "Initial reconstruction");
+
+  for (int i = 0; i < libmv_initial_reconstruction->num_cameras; i++) {
+    EuclideanCamera camera;
+    libmv_cameraFromReprojectionMatrix(
+        libmv_initial_reconstruction->camera_mats + 16 * i, &camera);
+    reconstruction.InsertCamera(
+        libmv_initial_reconstruction->camera_images[i], camera.R, camera.t);
+  }
+
+  for (int i = 0; i < libmv_initial_reconstruction->num_points; i++) {
+    const double* pos = libmv_initial_reconstruction->point_positions + 3 * i;
+    /* Inverse of the axis swap in libmv_reprojectionPointForTrack(). */
+    const libmv::Vec3 X(pos[0], pos[2], pos[1]);
+    reconstruction.InsertPoint(libmv_initial_reconstruction->point_tracks[i],
+                               X);
+  }
+
+  if (reconstruction.AllCameras().size() < 2) {
+    LG << "Not enough initial cameras for incremental solve";
+    libmv_reconstruction->is_valid = false;
+    return libmv_reconstruction;
+  }
+
+  EuclideanBundle(normalized_tracks, &reconstruction);
+  EuclideanCompleteReconstruction(
+      normalized_tracks, &reconstruction, &update_callback);
+
+  /* Refinement. */
+  if (libmv_reconstruction_options->refine_intrinsics) {
+    libmv_solveRefineIntrinsics(tracks,
+                                libmv_reconstruction_options->refine_intrinsics,
+                                libmv::BUNDLE_NO_CONSTRAINTS,
+                                progress_update_callback,
+                                callback_customdata,
+                                &reconstruction,
+                                camera_intrinsics);
+  }
+
+  /* Set reconstruction scale to unity. */
+  EuclideanScaleToUnity(&reconstruction);
+
+  /* Finish reconstruction. */
+  finishReconstruction(tracks,
+                       *camera_intrinsics,
+                       libmv_reconstruction,
+                       progress_update_callback,
+                       callback_customdata);
+
+  libmv_reconstruction->is_valid = true;
+  return (libmv_Reconstruction*)libmv_reconstruction;
+}
+
 libmv_Reconstruction* libmv_solveModal(
     const libmv_Tracks* libmv_tracks,
     const libmv_CameraIntrinsicsOptions* libmv_camera_intrinsics_options,
@@ -42,6 +42,26 @@ typedef void (*reconstruct_progress_update_cb)(void* customdata,
                                                double progress,
                                                const char* message);
 
+/* Previous solution used to warm-start an incremental re-solve.
+ *
+ * Cameras and points are expected in the same convention as they are returned
+ * by libmv_reprojectionCameraForImage() and libmv_reprojectionPointForTrack().
+ * Bundle adjustment is invariant to the gauge, so a similarity-transformed
+ * copy of a previous solution is a valid initial guess. */
+typedef struct libmv_InitialReconstruction {
+  int num_cameras;
+  /* Frame number of every initial camera. */
+  const int* camera_images;
+  /* num_cameras row-major 4x4 matrices. */
+  const double* camera_mats;
+
+  int num_points;
+  /* Track index of every initial point. */
+  const int* point_tracks;
+  /* num_points 3D positions. */
+  const double* point_positions;
+} libmv_InitialReconstruction;
+
 libmv_Reconstruction* libmv_solveReconstruction(
     const struct libmv_Tracks* libmv_tracks,
     const struct libmv_CameraIntrinsicsOptions* libmv_camera_intrinsics_options,
@@ -49,6 +69,18 @@ libmv_Reconstruction* libmv_solveReconstruction(
     reconstruct_progress_update_cb progress_update_callback,
     void* callback_customdata);
 
+/* Same as libmv_solveReconstruction(), but seeds the reconstruction from a
+ * previous solution instead of initializing from the two keyframes. Only
+ * cameras and points which did not exist before are reconstructed from
+ * scratch, the rest is refined in place by bundle adjustment. */
+libmv_Reconstruction* libmv_solveReconstructionIncremental(
+    const struct libmv_Tracks* libmv_tracks,
+    const struct libmv_CameraIntrinsicsOptions* libmv_camera_intrinsics_options,
+    libmv_ReconstructionOptions* libmv_reconstruction_options,
+    const libmv_InitialReconstruction* libmv_initial_reconstruction,
+    reconstruct_progress_update_cb progress_update_callback,
+    void* callback_customdata);
+
 libmv_Reconstruction* libmv_solveModal(
     const struct libmv_Tracks* libmv_tracks,
     const struct libmv_CameraIntrinsicsOptions* libmv_camera_intrinsics_options,
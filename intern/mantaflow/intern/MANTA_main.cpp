@@ -164,6 +164,15 @@ MANTA::MANTA(int *res, FluidModifierData *fmd)
   mMeshFromFile = false;
   mParticlesFromFile = false;
 
+  /* No cache frame in memory yet. */
+  mDataFrame = -1;
+  mNoiseFrame = -1;
+  mMeshFrame = -1;
+  mParticlesFrame = -1;
+  mDataResumableLoad = false;
+  mNoiseResumableLoad = false;
+  mParticlesResumableLoad = false;
+
   /* Setup Mantaflow in Python. */
   initializeMantaflow();
 
@@ -331,6 +340,8 @@ bool MANTA::initHeat(FluidModifierData *fmd)
     pythonCommands.push_back(finalString);
 
     mUsingHeat = true;
+    /* The new grid needs filling from the cache, re-enable reads of the current frame. */
+    mDataFrame = -1;
     return runPythonString(pythonCommands);
   }
   return false;
@@ -345,6 +356,7 @@ bool MANTA::initFire(FluidModifierData *fmd)
     pythonCommands.push_back(finalString);
 
     mUsingFire = true;
+    mDataFrame = -1;
     return runPythonString(pythonCommands);
   }
   return false;
@@ -373,6 +385,7 @@ bool MANTA::initColors(FluidModifierData *fmd)
     pythonCommands.push_back(finalString);
 
     mUsingColors = true;
+    mDataFrame = -1;
     return runPythonString(pythonCommands);
   }
   return false;
@@ -458,6 +471,7 @@ bool MANTA::initObstacle(FluidModifierData *fmd)
     string finalString = parseScript(tmpString, fmd);
     pythonCommands.push_back(finalString);
 
+    mDataFrame = -1;
     return (mUsingObstacle = runPythonString(pythonCommands));
   }
   return false;
@@ -495,6 +509,7 @@ bool MANTA::initInVelocity(FluidModifierData *fmd)
     string finalString = parseScript(tmpString, fmd);
     pythonCommands.push_back(finalString);
 
+    mDataFrame = -1;
     return (mUsingInvel = runPythonString(pythonCommands));
   }
   return false;
@@ -508,6 +523,7 @@ bool MANTA::initOutflow(FluidModifierData *fmd)
     string finalString = parseScript(tmpString, fmd);
     pythonCommands.push_back(finalString);
 
+    mDataFrame = -1;
     return (mUsingOutflow = runPythonString(pythonCommands));
   }
   return false;
@@ -1253,12 +1269,23 @@ bool MANTA::readData(FluidModifierData *fmd, int framenr, bool resumable)
   if (!hasData(fmd, framenr))
     return false;
 
+  /* Skip the file read if this frame is already in memory. A resumable load is a superset of a
+   * non-resumable one, so it satisfies both kinds of requests. */
+  if (mDataFrame == framenr && (mDataResumableLoad || !resumable)) {
+    if (mUsingSmoke)
+      return (mSmokeFromFile = true);
+    if (mUsingLiquid)
+      return (mFlipFromFile = true);
+  }
+
   if (mUsingSmoke) {
     ss.str("");
     ss << "smoke_load_data_" << mCurrentID << "('" << escapePath(directory) << "', " << framenr
        << ", '" << volume_format << "', " << resumable_cache << ")";
     pythonCommands.push_back(ss.str());
     result &= runPythonString(pythonCommands);
+    mDataFrame = (result) ? framenr : -1;
+    mDataResumableLoad = resumable;
     return (mSmokeFromFile = result);
   }
   if (mUsingLiquid) {
@@ -1267,6 +1294,8 @@ bool MANTA::readData(FluidModifierData *fmd, int framenr, bool resumable)
        << ", '" << volume_format << "', " << resumable_cache << ")";
     pythonCommands.push_back(ss.str());
     result &= runPythonString(pythonCommands);
+    mDataFrame = (result) ? framenr : -1;
+    mDataResumableLoad = resumable;
     return (mFlipFromFile = result);
   }
   return result;
@@ -1296,12 +1325,19 @@ bool MANTA::readNoise(FluidModifierData *fmd, int framenr, bool resumable)
   if (!hasNoise(fmd, framenr))
     return false;
 
+  /* Skip the file read if this frame is already in memory. */
+  if (mNoiseFrame == framenr && (mNoiseResumableLoad || !resumable))
+    return (mNoiseFromFile = true);
+
   ss.str("");
   ss << "smoke_load_noise_" << mCurrentID << "('" << escapePath(directory) << "', " << framenr
      << ", '" << volume_format << "', " << resumable_cache << ")";
   pythonCommands.push_back(ss.str());
 
-  return (mNoiseFromFile = runPythonString(pythonCommands));
+  bool result = runPythonString(pythonCommands);
+  mNoiseFrame = (result) ? framenr : -1;
+  mNoiseResumableLoad = resumable;
+  return (mNoiseFromFile = result);
 }
 
 bool MANTA::readMesh(FluidModifierData *fmd, int framenr)
@@ -1324,6 +1360,10 @@ bool MANTA::readMesh(FluidModifierData *fmd, int framenr)
   if (!hasMesh(fmd, framenr))
     return false;
 
+  /* Skip the file read if this frame is already in memory. */
+  if (mMeshFrame == framenr)
+    return (mMeshFromFile = true);
+
   ss.str("");
   ss << "liquid_load_mesh_" << mCurrentID << "('" << escapePath(directory) << "', " << framenr
      << ", '" << mesh_format << "')";
@@ -1336,7 +1376,9 @@ bool MANTA::readMesh(FluidModifierData *fmd, int framenr)
     pythonCommands.push_back(ss.str());
   }
 
-  return (mMeshFromFile = runPythonString(pythonCommands));
+  bool result = runPythonString(pythonCommands);
+  mMeshFrame = (result) ? framenr : -1;
+  return (mMeshFromFile = result);
 }
 
 bool MANTA::readParticles(FluidModifierData *fmd, int framenr, bool resumable)
@@ -1365,12 +1407,19 @@ bool MANTA::readParticles(FluidModifierData *fmd, int framenr, bool resumable)
   if (!hasParticles(fmd, framenr))
     return false;
 
+  /* Skip the file read if this frame is already in memory. */
+  if (mParticlesFrame == framenr && (mParticlesResumableLoad || !resumable))
+    return (mParticlesFromFile = true);
+
   ss.str("");
   ss << "liquid_load_particles_" << mCurrentID << "('" << escapePath(directory) << "', " << framenr
      << ", '" << volume_format << "', " << resumable_cache << ")";
   pythonCommands.push_back(ss.str());
 
-  return (mParticlesFromFile = runPythonString(pythonCommands));
+  bool result = runPythonString(pythonCommands);
+  mParticlesFrame = (result) ? framenr : -1;
+  mParticlesResumableLoad = resumable;
+  return (mParticlesFromFile = result);
 }
 
 bool MANTA::readGuiding(FluidModifierData *fmd, int framenr, bool sourceDomain)
@@ -1415,6 +1464,9 @@ bool MANTA::bakeData(FluidModifierData *fmd, int framenr)
   if (with_debug)
     cout << "MANTA::bakeData()" << endl;
 
+  /* Baking steps the solver, invalidating whatever frame the grids held. */
+  mDataFrame = -1;
+
   string tmpString, finalString;
   ostringstream ss;
   vector<string> pythonCommands;
@@ -1449,6 +1501,8 @@ bool MANTA::bakeNoise(FluidModifierData *fmd, int framenr)
   if (with_debug)
     cout << "MANTA::bakeNoise()" << endl;
 
+  mNoiseFrame = -1;
+
   ostringstream ss;
   vector<string> pythonCommands;
   FluidDomainSettings *fds = fmd->domain;
@@ -1475,6 +1529,8 @@ bool MANTA::bakeMesh(FluidModifierData *fmd, int framenr)
   if (with_debug)
     cout << "MANTA::bakeMesh()" << endl;
 
+  mMeshFrame = -1;
+
   ostringstream ss;
   vector<string> pythonCommands;
   FluidDomainSettings *fds = fmd->domain;
@@ -1502,6 +1558,8 @@ bool MANTA::bakeParticles(FluidModifierData *fmd, int framenr)
   if (with_debug)
     cout << "MANTA::bakeParticles()" << endl;
 
+  mParticlesFrame = -1;
+
   ostringstream ss;
   vector<string> pythonCommands;
   FluidDomainSettings *fds = fmd->domain;
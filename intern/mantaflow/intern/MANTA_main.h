@@ -757,6 +757,17 @@ struct MANTA {
   bool mSmokeFromFile;
   bool mNoiseFromFile;
 
+  /* Frame whose content each cache type currently holds in memory, or -1 when unknown.
+   * The depsgraph re-evaluates the domain whenever anything in the scene changes, so the
+   * same frame is read over and over - these let such reads skip the file decode. */
+  int mDataFrame;
+  int mNoiseFrame;
+  int mMeshFrame;
+  int mParticlesFrame;
+  bool mDataResumableLoad;
+  bool mNoiseResumableLoad;
+  bool mParticlesResumableLoad;
+
   int mResX;
   int mResY;
   int mResZ;
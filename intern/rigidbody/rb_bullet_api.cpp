@@ -44,12 +44,15 @@
 #include "LinearMath/btConvexHullComputer.h"
 #include "LinearMath/btMatrix3x3.h"
 #include "LinearMath/btScalar.h"
+#include "LinearMath/btThreads.h"
 #include "LinearMath/btTransform.h"
 #include "LinearMath/btVector3.h"
 
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
 #include "BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h"
 #include "BulletCollision/Gimpact/btGImpactCollisionAlgorithm.h"
 #include "BulletCollision/Gimpact/btGImpactShape.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
 
 struct rbDynamicsWorld {
   btDiscreteDynamicsWorld *dynamicsWorld;
@@ -120,6 +123,22 @@ static inline void copy_quat_btquat(float quat[4], const btQuaternion &btquat)
 
 /* Setup ---------------------------- */
 
+#if BT_THREADSAFE
+/* Install bullet's internal task scheduler once for the whole process, it is what the
+ * multi-threaded world and dispatcher hand their work batches to. */
+static void rb_ensure_task_scheduler(void)
+{
+  if (btGetTaskScheduler() != NULL) {
+    return;
+  }
+  btITaskScheduler *scheduler = btCreateDefaultTaskScheduler();
+  if (scheduler == NULL) {
+    scheduler = btGetSequentialTaskScheduler();
+  }
+  btSetTaskScheduler(scheduler);
+}
+#endif
+
 rbDynamicsWorld *RB_dworld_new(const float gravity[3])
 {
   rbDynamicsWorld *world = new rbDynamicsWorld;
@@ -127,7 +146,12 @@ rbDynamicsWorld *RB_dworld_new(const float gravity[3])
   /* collision detection/handling */
   world->collisionConfiguration = new btDefaultCollisionConfiguration();
 
+#if BT_THREADSAFE
+  rb_ensure_task_scheduler();
+  world->dispatcher = new btCollisionDispatcherMt(world->collisionConfiguration);
+#else
   world->dispatcher = new btCollisionDispatcher(world->collisionConfiguration);
+#endif
   btGImpactCollisionAlgorithm::registerAlgorithm((btCollisionDispatcher *)world->dispatcher);
 
   world->pairCache = new btDbvtBroadphase();
@@ -135,12 +159,24 @@ rbDynamicsWorld *RB_dworld_new(const float gravity[3])
   world->filterCallback = new rbFilterCallback();
   world->pairCache->getOverlappingPairCache()->setOverlapFilterCallback(world->filterCallback);
 
+#if BT_THREADSAFE
+  /* Step independent simulation islands in parallel. Each island is still solved whole by one
+   * sequential solver from the pool (no per-island solver is passed), so the result does not
+   * depend on the number of threads. */
+  btConstraintSolverPoolMt *solverPool = new btConstraintSolverPoolMt(
+      btGetTaskScheduler()->getNumThreads());
+  world->constraintSolver = solverPool;
+
+  world->dynamicsWorld = new btDiscreteDynamicsWorldMt(
+      world->dispatcher, world->pairCache, solverPool, NULL, world->collisionConfiguration);
+#else
   /* constraint solving */
   world->constraintSolver = new btSequentialImpulseConstraintSolver();
 
   /* world */
   world->dynamicsWorld = new btDiscreteDynamicsWorld(
       world->dispatcher, world->pairCache, world->constraintSolver, world->collisionConfiguration);
+#endif
 
   RB_dworld_set_gravity(world, gravity);
 
@@ -28,6 +28,7 @@ __all__ = (
     "register_tool",
     "make_rna_paths",
     "manual_map",
+    "memory_usage",
     "previews",
     "resource_path",
     "script_path_user",
@@ -47,6 +48,7 @@ from _bpy import (
     blend_paths,
     escape_identifier,
     flip_name,
+    memory_usage,
     unescape_identifier,
     register_class,
     resource_path,
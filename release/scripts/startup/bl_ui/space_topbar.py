@@ -455,6 +455,8 @@ class TOPBAR_MT_file_import(Menu):
             self.layout.operator(
                 "wm.usd_import", text="Universal Scene Description (.usd, .usdc, .usda)")
 
+        self.layout.operator("wm.obj_import", text="Wavefront OBJ (.obj)")
+
         self.layout.operator("wm.gpencil_import_svg", text="SVG as Grease Pencil")
 
 
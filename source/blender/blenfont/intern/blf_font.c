@@ -48,6 +48,7 @@
 /* Batching buffer for drawing. */
 
 BatchBLF g_batch;
+GlyphAtlasBLF g_atlas;
 
 /* freetype2 handle ONLY for this file! */
 static FT_Library ft_lib;
@@ -130,6 +131,15 @@ static void blf_batch_draw_init(void)
 static void blf_batch_draw_exit(void)
 {
   GPU_BATCH_DISCARD_SAFE(g_batch.batch);
+
+  if (g_atlas.texture) {
+    GPU_texture_free(g_atlas.texture);
+    g_atlas.texture = NULL;
+  }
+  MEM_SAFE_FREE(g_atlas.bitmap_result);
+  g_atlas.bitmap_len = 0;
+  g_atlas.bitmap_len_landed = 0;
+  g_atlas.bitmap_len_alloc = 0;
 }
 
 void blf_batch_draw_begin(FontBLF *font)
@@ -194,15 +204,15 @@ void blf_batch_draw_begin(FontBLF *font)
 
 static GPUTexture *blf_batch_cache_texture_load(void)
 {
-  GlyphCacheBLF *gc = g_batch.glyph_cache;
-  BLI_assert(gc);
-  BLI_assert(gc->bitmap_len > 0);
+  GlyphAtlasBLF *atlas = &g_atlas;
+  BLI_assert(atlas->texture);
+  BLI_assert(atlas->bitmap_len > 0);
 
-  if (gc->bitmap_len > gc->bitmap_len_landed) {
-    const int tex_width = GPU_texture_width(gc->texture);
+  if (atlas->bitmap_len > atlas->bitmap_len_landed) {
+    const int tex_width = GPU_texture_width(atlas->texture);
 
-    int bitmap_len_landed = gc->bitmap_len_landed;
-    int remain = gc->bitmap_len - bitmap_len_landed;
+    int bitmap_len_landed = atlas->bitmap_len_landed;
+    int remain = atlas->bitmap_len - bitmap_len_landed;
     int offset_x = bitmap_len_landed % tex_width;
     int offset_y = bitmap_len_landed / tex_width;
 
@@ -210,9 +220,9 @@ static GPUTexture *blf_batch_cache_texture_load(void)
     while (remain) {
       int remain_row = tex_width - offset_x;
       int width = remain > remain_row ? remain_row : remain;
-      GPU_texture_update_sub(gc->texture,
+      GPU_texture_update_sub(atlas->texture,
                              GPU_DATA_UBYTE,
-                             &gc->bitmap_result[bitmap_len_landed],
+                             &atlas->bitmap_result[bitmap_len_landed],
                              offset_x,
                              offset_y,
                              0,
@@ -226,10 +236,10 @@ static GPUTexture *blf_batch_cache_texture_load(void)
       offset_y += 1;
     }
 
-    gc->bitmap_len_landed = bitmap_len_landed;
+    atlas->bitmap_len_landed = bitmap_len_landed;
   }
 
-  return gc->texture;
+  return atlas->texture;
 }
 
 void blf_batch_draw(void)
@@ -1141,6 +1151,7 @@ char *blf_display_name(FontBLF *font)
 int blf_font_init(void)
 {
   memset(&g_batch, 0, sizeof(g_batch));
+  memset(&g_atlas, 0, sizeof(g_atlas));
   BLI_spin_init(&ft_lib_mutex);
   BLI_spin_init(&blf_glyph_cache_mutex);
   return FT_Init_FreeType(&ft_lib);
@@ -102,6 +102,7 @@ static GlyphCacheBLF *blf_glyph_cache_new(FontBLF *font)
   }
 
   BLI_addhead(&font->cache, gc);
+  g_atlas.cache_count++;
   return gc;
 }
 
@@ -131,13 +132,16 @@ static void blf_glyph_cache_free(GlyphCacheBLF *gc)
       blf_glyph_free(g);
     }
   }
-  if (gc->texture) {
-    GPU_texture_free(gc->texture);
-  }
-  if (gc->bitmap_result) {
-    MEM_freeN(gc->bitmap_result);
-  }
   MEM_freeN(gc);
+
+  /* The atlas is shared by all glyph caches, its storage can only be
+   * reclaimed once no cache holds offsets into it anymore. */
+  g_atlas.cache_count--;
+  BLI_assert(g_atlas.cache_count >= 0);
+  if (g_atlas.cache_count == 0) {
+    g_atlas.bitmap_len = 0;
+    g_atlas.bitmap_len_landed = 0;
+  }
 }
 
 void blf_glyph_cache_clear(FontBLF *font)
@@ -587,29 +591,29 @@ void blf_glyph_draw(FontBLF *font, GlyphCacheBLF *gc, GlyphBLF *g, float x, floa
       font->tex_size_max = GPU_max_texture_size();
     }
 
-    g->offset = gc->bitmap_len;
+    g->offset = g_atlas.bitmap_len;
 
     int buff_size = g->dims[0] * g->dims[1];
-    int bitmap_len = gc->bitmap_len + buff_size;
+    int bitmap_len = g_atlas.bitmap_len + buff_size;
 
-    if (bitmap_len > gc->bitmap_len_alloc) {
+    if (bitmap_len > g_atlas.bitmap_len_alloc) {
       int w = font->tex_size_max;
       int h = bitmap_len / w + 1;
 
-      gc->bitmap_len_alloc = w * h;
-      gc->bitmap_result = MEM_reallocN(gc->bitmap_result, (size_t)gc->bitmap_len_alloc);
+      g_atlas.bitmap_len_alloc = w * h;
+      g_atlas.bitmap_result = MEM_reallocN(g_atlas.bitmap_result, (size_t)g_atlas.bitmap_len_alloc);
 
       /* Keep in sync with the texture. */
-      if (gc->texture) {
-        GPU_texture_free(gc->texture);
+      if (g_atlas.texture) {
+        GPU_texture_free(g_atlas.texture);
       }
-      gc->texture = GPU_texture_create_2d(__func__, w, h, 1, GPU_R8, NULL);
+      g_atlas.texture = GPU_texture_create_2d(__func__, w, h, 1, GPU_R8, NULL);
 
-      gc->bitmap_len_landed = 0;
+      g_atlas.bitmap_len_landed = 0;
     }
 
-    memcpy(&gc->bitmap_result[gc->bitmap_len], g->bitmap, (size_t)buff_size);
-    gc->bitmap_len = bitmap_len;
+    memcpy(&g_atlas.bitmap_result[g->offset], g->bitmap, (size_t)buff_size);
+    g_atlas.bitmap_len = bitmap_len;
 
     g->glyph_cache = gc;
   }
@@ -624,11 +628,6 @@ void blf_glyph_draw(FontBLF *font, GlyphCacheBLF *gc, GlyphBLF *g, float x, floa
     }
   }
 
-  if (g_batch.glyph_cache != g->glyph_cache) {
-    blf_batch_draw();
-    g_batch.glyph_cache = g->glyph_cache;
-  }
-
   if (font->flags & BLF_SHADOW) {
     rctf rect_ofs;
     blf_glyph_calc_rect_shadow(&rect_ofs, g, x, y, font);
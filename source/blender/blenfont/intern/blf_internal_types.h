@@ -31,11 +31,27 @@ typedef struct BatchBLF {
   float ofs[2];    /* copy of font->pos */
   float mat[4][4]; /* previous call modelmatrix. */
   bool enabled, active, simple_shader;
-  struct GlyphCacheBLF *glyph_cache;
 } BatchBLF;
 
 extern BatchBLF g_batch;
 
+typedef struct GlyphAtlasBLF {
+  /* Bitmaps of all cached glyphs (every font and size) packed into a single
+   * texture, so batching does not have to flush when the style changes.
+   * Glyphs are stored as a simple byte stream, see #GlyphBLF.offset. */
+  GPUTexture *texture;
+  char *bitmap_result;
+  int bitmap_len;
+  int bitmap_len_landed;
+  int bitmap_len_alloc;
+
+  /* Number of live glyph caches, the storage can only be reclaimed once all
+   * caches holding offsets into it are freed (see #BLF_cache_clear). */
+  int cache_count;
+} GlyphAtlasBLF;
+
+extern GlyphAtlasBLF g_atlas;
+
 typedef struct KerningCacheBLF {
   /**
    * Cache a ascii glyph pairs. Only store the x offset we are interested in,
@@ -66,13 +82,6 @@ typedef struct GlyphCacheBLF {
   /* fast ascii lookup */
   struct GlyphBLF *glyph_ascii_table[GLYPH_ASCII_TABLE_SIZE];
 
-  /* texture array, to draw the glyphs. */
-  GPUTexture *texture;
-  char *bitmap_result;
-  int bitmap_len;
-  int bitmap_len_landed;
-  int bitmap_len_alloc;
-
 } GlyphCacheBLF;
 
 typedef struct GlyphBLF {
@@ -304,6 +304,13 @@ void free_bvhtree_from_pointcloud(struct BVHTreeFromPointCloud *data);
 
 bool bvhcache_has_tree(const struct BVHCache *bvh_cache, const BVHTree *tree);
 struct BVHCache *bvhcache_init(void);
+/**
+ * Tag all cached trees for a refit: vertex positions changed while the topology is unchanged.
+ * On the next lookup through #BKE_bvhtree_from_mesh_get, the bounding volumes of a tagged tree
+ * are updated in place (#BLI_bvhtree_update_tree), which is much cheaper than rebuilding the
+ * tree from scratch. Trees that cannot be refitted are rebuilt instead.
+ */
+void bvhcache_tag_positions_changed(struct BVHCache *bvh_cache);
 /**
  * Frees a BVH-cache.
  */
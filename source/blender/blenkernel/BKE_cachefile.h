@@ -44,6 +44,16 @@ void BKE_cachefile_reader_open(struct CacheFile *cache_file,
                                const char *object_path);
 void BKE_cachefile_reader_free(struct CacheFile *cache_file, struct CacheReader **reader);
 
+/**
+ * Decode the next few frames for this reader into memory on a background task pool, so the next
+ * evaluations do not block on archive I/O during playback. \a ctime is the scene time the
+ * current evaluation happens at. Has no effect for file sequences and non-Alembic cache files.
+ */
+void BKE_cachefile_prefetch(struct CacheFile *cache_file,
+                            struct CacheReader *reader,
+                            float ctime,
+                            float fps);
+
 /**
  * Determine whether the #CacheFile should use a render engine procedural. If so, data is not read
  * from the file and bounding boxes are used to represent the objects in the Scene.
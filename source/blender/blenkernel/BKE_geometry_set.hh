@@ -880,6 +880,12 @@ class InstancesComponent : public GeometryComponent {
    * is preferred.
    */
   void add_instance(int instance_handle, const blender::float4x4 &transform);
+  /**
+   * Append all instances from another component, remapping their reference handles into this
+   * component. This is much cheaper than adding the instances one by one, because the instance
+   * arrays only have to grow once and are filled in parallel.
+   */
+  void add_instances_from(const InstancesComponent &src_component);
 
   blender::Span<InstanceReference> references() const;
   void remove_unused_references();
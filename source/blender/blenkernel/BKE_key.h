@@ -95,6 +95,12 @@ struct KeyBlock *BKE_keyblock_find_name(struct Key *key, const char name[]);
  * \brief copy shape-key attributes, but not key data or name/UID.
  */
 void BKE_keyblock_copy_settings(struct KeyBlock *kb_dst, const struct KeyBlock *kb_src);
+/**
+ * Copy settings of the key and all its key blocks, but not the key data itself. Used to update
+ * the evaluated datablock in place on parameter changes, without a full copy of the key data.
+ * Both keys are expected to have a matching number of key blocks.
+ */
+void BKE_key_copy_parameters(struct Key *key_dst, const struct Key *key_src);
 /**
  * Get RNA-Path for 'value' setting of the given shape-key.
  * \note the user needs to free the returned string once they're finished with it.
@@ -69,8 +69,12 @@ typedef struct MainIDRelationsEntry {
   /* Session uuid of the ID matching that entry. */
   uint session_uuid;
 
-  /* Runtime tags, users should ensure those are reset after usage. */
+  /* Runtime tags, users should ensure those are reset after usage. Only valid when
+   * `tags_clear_gen` matches #MainIDRelations.tags_clear_gen, access through
+   * #BKE_main_relations_entry_tag_test and #BKE_main_relations_entry_tag_add. */
   uint tags;
+  /* Clearing generation of `tags`, see #MainIDRelations.tags_clear_gen. */
+  uint tags_clear_gen;
 } MainIDRelationsEntry;
 
 /* MainIDRelationsEntry.tags */
@@ -89,6 +93,11 @@ typedef struct MainIDRelations {
 
   short flag;
 
+  /* Current generation of valid entry tags. Entries with an older `tags_clear_gen` are considered
+   * as having no tags set. Clearing the tags of all entries then amounts to bumping this value,
+   * instead of iterating over all entries, see #BKE_main_relations_tag_set. */
+  uint tags_clear_gen;
+
   /* Private... */
   struct BLI_mempool *entry_items_pool;
 } MainIDRelations;
@@ -202,8 +211,36 @@ void BKE_main_unlock(struct Main *bmain);
 /** Generate the mappings between used IDs and their users, and vice-versa. */
 void BKE_main_relations_create(struct Main *bmain, short flag);
 void BKE_main_relations_free(struct Main *bmain);
-/** Set or clear given `tag` in all relation entries of given `bmain`. */
+/**
+ * Add a single usage relation (\a id_user uses the ID currently stored in \a id_pointer) to the
+ * existing cached relations of given \a bmain, if any.
+ *
+ * Allows code modifying ID usages (like remapping) to keep the cached relations usable. Note that
+ * existing relation entries are never removed by such updates, so users of the cached relations
+ * must be able to cope with 'stale' usages (an ID listed as user of another one while it no longer
+ * actually uses it), which amounts to some harmless extra processing. Missing usages on the other
+ * hand would make lookups miss actual users, so those have to be added as they are created.
+ */
+void BKE_main_relations_id_usage_add(struct Main *bmain,
+                                     struct ID *id_user,
+                                     struct ID **id_pointer,
+                                     int usage_flag);
+/**
+ * Set or clear given `tag` in all relation entries of given `bmain`.
+ *
+ * \note Clearing is a cheap, constant-time operation (see #MainIDRelations.tags_clear_gen). It
+ * does reset all runtime tags of all entries though, not only the given one, which is currently
+ * not an issue since a single tag is ever used at a time.
+ */
 void BKE_main_relations_tag_set(struct Main *bmain, eMainIDRelationsEntryTags tag, bool value);
+/** Check whether given `tag` is set on given relations `entry` of given `bmain`. */
+bool BKE_main_relations_entry_tag_test(struct Main *bmain,
+                                       struct MainIDRelationsEntry *entry,
+                                       eMainIDRelationsEntryTags tag);
+/** Add given `tag` to given relations `entry` of given `bmain`. */
+void BKE_main_relations_entry_tag_add(struct Main *bmain,
+                                      struct MainIDRelationsEntry *entry,
+                                      eMainIDRelationsEntryTags tag);
 
 /**
  * Create a #GSet storing all IDs present in given \a bmain, by their pointers.
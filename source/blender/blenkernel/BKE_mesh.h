@@ -312,6 +312,13 @@ void BKE_mesh_count_selected_items(const struct Mesh *mesh, int r_count[3]);
 
 float (*BKE_mesh_vert_coords_alloc(const struct Mesh *mesh, int *r_vert_len))[3];
 void BKE_mesh_vert_coords_get(const struct Mesh *mesh, float (*vert_coords)[3]);
+/**
+ * Return a lazily computed contiguous (SoA) copy of the vertex coordinates, cached on the mesh
+ * runtime so repeated position-only passes (normal calculation, deform-only modifier stacks)
+ * don't pay for the interleaved #MVert layout. The cache is invalidated together with normals
+ * (any position change must tag those dirty already) and remains owned by the mesh.
+ */
+const float (*BKE_mesh_vert_coords_ensure(const struct Mesh *mesh))[3];
 
 void BKE_mesh_vert_coords_apply_with_mat4(struct Mesh *mesh,
                                           const float (*vert_coords)[3],
@@ -366,6 +373,18 @@ void BKE_mesh_recalc_looptri_with_normals(const struct MLoop *mloop,
                                           int totpoly,
                                           struct MLoopTri *mlooptri,
                                           const float (*poly_normals)[3]);
+/**
+ * Re-tessellate only the given polygons, writing into their (topology determined) slots
+ * in \a mlooptri, leaving the triangles of all other polygons untouched.
+ * Useful to refresh the tessellation after coordinates changed for a small part of the mesh,
+ * since the triangulation of concave quads and ngons depends on the vertex positions.
+ */
+void BKE_mesh_recalc_looptri_polys(const struct MLoop *mloop,
+                                   const struct MPoly *mpoly,
+                                   const struct MVert *mvert,
+                                   const int *poly_indices,
+                                   int polys_num,
+                                   struct MLoopTri *mlooptri);
 
 /* *** mesh_normals.cc *** */
 
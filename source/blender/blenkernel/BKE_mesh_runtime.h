@@ -49,6 +49,19 @@ void BKE_mesh_runtime_looptri_recalc(struct Mesh *mesh);
  * \note This is a ported copy of dm_getLoopTriArray(dm).
  */
 const struct MLoopTri *BKE_mesh_runtime_looptri_ensure(const struct Mesh *mesh);
+/**
+ * Ensure the mesh has a session-unique topology version assigned, and return it.
+ * The version identifies the mesh's connectivity only (not vertex positions): code that creates a
+ * copy of a mesh and guarantees to never change its topology may stamp the copy with the source's
+ * version, so topology-derived caches can be shared instead of being rebuilt.
+ */
+int BKE_mesh_runtime_topology_version_ensure(struct Mesh *mesh);
+/**
+ * Fill `mesh_dst`'s looptri cache from `mesh_src`'s (computing the latter if needed), instead of
+ * re-tessellating. Only valid when both meshes carry the same (non-zero) topology version, i.e.
+ * when `mesh_dst` is a deform-only copy of `mesh_src`.
+ */
+void BKE_mesh_runtime_looptri_cache_reuse(const struct Mesh *mesh_src, struct Mesh *mesh_dst);
 bool BKE_mesh_runtime_ensure_edit_data(struct Mesh *mesh);
 bool BKE_mesh_runtime_clear_edit_data(struct Mesh *mesh);
 bool BKE_mesh_runtime_reset_edit_data(struct Mesh *mesh);
@@ -374,6 +374,17 @@ typedef struct ModifierTypeInfo {
    * not been written (e.g. runtime data) can be reset.
    */
   void (*blendRead)(struct BlendDataReader *reader, struct ModifierData *md);
+
+  /**
+   * Is called to check whether two instances of this modifier type are configured identically.
+   *
+   * Implementing this callback is a declaration that the modifier's output depends on nothing
+   * besides the input geometry and the compared settings: not on the owning object, on other
+   * IDs, or on the current time. This allows the modifier stack evaluation to share its result
+   * between objects which use the same mesh with equal stacks. Leave NULL for modifier types
+   * that cannot give this guarantee (this only disables sharing, it is always correct).
+   */
+  bool (*equalsSettings)(const struct ModifierData *md, const struct ModifierData *other_md);
 } ModifierTypeInfo;
 
 /* Used to find a modifier's panel type. */
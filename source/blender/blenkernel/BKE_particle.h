@@ -85,6 +85,9 @@ typedef struct SPHData {
   ParticleData *pa;
   float mass;
   struct EdgeHash *eh;
+  /* Frozen neighbor lookup grids, one per (target) particle system. Owned by the struct
+   * that #psys_sph_init filled in; thread-local copies share them read-only. */
+  struct SPHNeighborGrid *grids[10];
   float *gravity;
   float hfac;
   /* Average distance to neighbors (other particles in the support domain),
@@ -321,6 +321,11 @@ int BKE_ptcache_mem_index_find(struct PTCacheMem *pm, unsigned int index);
 
 /* Memory cache read/write helpers. */
 
+/**
+ * Decompress any compressed data arrays of the frame back into #PTCacheMem.data.
+ * Needed before accessing the arrays directly, the helpers below call it themselves.
+ */
+void BKE_ptcache_mem_ensure_raw(struct PTCacheMem *pm);
 void BKE_ptcache_mem_pointers_init(struct PTCacheMem *pm, void *cur[BPHYS_TOT_DATA]);
 void BKE_ptcache_mem_pointers_incr(void *cur[BPHYS_TOT_DATA]);
 int BKE_ptcache_mem_pointers_seek(int point_index,
@@ -94,7 +94,8 @@ class Spline {
   }
 
   /**
-   * Return a new spline with the same data, settings, and attributes.
+   * Return a new spline with the same data, settings, and attributes. Evaluation caches that are
+   * up to date on this spline are copied as well, so the copy can avoid recomputing them.
    */
   SplinePtr copy() const;
   /**
@@ -243,6 +244,12 @@ class Spline {
   virtual void correct_end_tangents() const = 0;
   virtual void copy_settings(Spline &dst) const = 0;
   virtual void copy_data(Spline &dst) const = 0;
+  /**
+   * Copy the values of the evaluation caches that are valid on this spline to \a dst, which must
+   * contain identical data. Outdated caches are skipped and stay dirty on \a dst.
+   */
+  virtual void copy_cached_data(Spline &dst) const = 0;
+  static void copy_base_cached_data(const Spline &src, Spline &dst);
   virtual void reverse_impl() = 0;
 };
 
@@ -452,6 +459,7 @@ class BezierSpline final : public Spline {
   void correct_end_tangents() const final;
   void copy_settings(Spline &dst) const final;
   void copy_data(Spline &dst) const final;
+  void copy_cached_data(Spline &dst) const final;
 
  protected:
   void reverse_impl() override;
@@ -566,6 +574,7 @@ class NURBSpline final : public Spline {
   void correct_end_tangents() const final;
   void copy_settings(Spline &dst) const final;
   void copy_data(Spline &dst) const final;
+  void copy_cached_data(Spline &dst) const final;
   void reverse_impl() override;
 
   void calculate_knots() const;
@@ -624,6 +633,7 @@ class PolySpline final : public Spline {
   void correct_end_tangents() const final;
   void copy_settings(Spline &dst) const final;
   void copy_data(Spline &dst) const final;
+  void copy_cached_data(Spline &dst) const final;
   void reverse_impl() override;
 };
 
@@ -183,6 +183,15 @@ typedef struct Subdiv {
      * In total this array has a size of `num base faces + 1`.
      */
     int *face_ptex_offset;
+
+    /* Mapping from coarse vertex index to the evaluator vertex index, -1 for
+     * vertices which are not used by any face (the evaluator does not know
+     * about loose geometry). Allows to avoid re-calculating the mapping on
+     * every coarse positions update. */
+    int *coarse_vertex_map;
+    /* Number of vertices known to the evaluator (the number of non-negative
+     * elements of the mapping above). */
+    int num_evaluator_vertices;
   } cache_;
 } Subdiv;
 
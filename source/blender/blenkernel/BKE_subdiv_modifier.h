@@ -19,6 +19,7 @@ struct Scene;
 struct Subdiv;
 struct SubdivSettings;
 struct SubsurfModifierData;
+struct SubsurfRuntimeData;
 
 void BKE_subsurf_modifier_subdiv_settings_init(struct SubdivSettings *settings,
                                                const struct SubsurfModifierData *smd,
@@ -40,6 +41,11 @@ bool BKE_subsurf_modifier_can_do_gpu_subdiv(const struct Scene *scene,
 
 extern void (*BKE_subsurf_modifier_free_gpu_cache_cb)(struct Subdiv *subdiv);
 
+/**
+ * Free all subdivision descriptors cached for settings other than the active ones.
+ */
+void BKE_subsurf_modifier_subdiv_cache_clear(struct SubsurfRuntimeData *runtime_data);
+
 /**
  * Main goal of this function is to give usable subdivision surface descriptor
  * which matches settings and topology.
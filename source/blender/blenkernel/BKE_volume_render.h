@@ -20,18 +20,26 @@ struct VolumeGrid;
 
 /* Dense Voxels */
 
-typedef struct DenseFloatVolumeGrid {
-  VolumeGridType type;
-  int resolution[3];
-  float texture_to_object[4][4];
-  int channels;
-  float *voxels;
-} DenseFloatVolumeGrid;
-
-bool BKE_volume_grid_dense_floats(const struct Volume *volume,
+/**
+ * Resolution and placement of the dense voxel array that covers the active voxels of the
+ * grid, without extracting the voxels themselves. Returns false for empty grids.
+ */
+bool BKE_volume_grid_dense_resolution(const struct Volume *volume,
+                                      const struct VolumeGrid *volume_grid,
+                                      int r_resolution[3],
+                                      float r_texture_to_object[4][4]);
+
+/**
+ * Extract a range of Z-slices of the dense voxel array into \a r_voxels, which must have
+ * room for `resolution[0] * resolution[1] * slices_num` elements of the grid's channel
+ * count, with the resolution from #BKE_volume_grid_dense_resolution. Extracting the array
+ * in slabs keeps the peak memory use bounded for large grids.
+ */
+void BKE_volume_grid_dense_voxels(const struct Volume *volume,
                                   const struct VolumeGrid *volume_grid,
-                                  DenseFloatVolumeGrid *r_dense_grid);
-void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
+                                  int slice_z,
+                                  int slices_num,
+                                  float *r_voxels);
 
 /* Wireframe */
 
@@ -27,6 +27,7 @@
 #include "BLI_math_vec_types.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
+#include "BLI_trace.h"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -682,6 +683,8 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
                                                    Mesh *input_mesh,
                                                    GeometrySet &geometry_set)
 {
+  BLI_TRACE_ZONE(md->name);
+
   Mesh *mesh_output = nullptr;
   const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
   if (mti->modifyGeometrySet == nullptr) {
@@ -722,6 +725,89 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
   return mesh_output;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Shared Modifier Stack Evaluation
+ *
+ * Objects which use the same mesh with equal modifier stacks produce equal evaluated meshes, so
+ * the result of the first evaluation can be shared by all of them (think linked duplicates used
+ * for set dressing). This is only possible when every enabled modifier guarantees that its
+ * output depends on nothing besides the input geometry and its own settings, which modifier
+ * types declare by implementing the `equalsSettings` callback.
+ *
+ * The shared result is stored in the input mesh runtime next to the existing `mesh_eval` (which
+ * covers the no-effective-modifiers case), together with a copy of the modifier stack that
+ * produced it so candidate stacks can be compared exactly. The slot is filled once and freed
+ * together with the rest of the runtime caches; when an object's stack stops matching (e.g.
+ * because of animated settings) it simply falls back to evaluating its own result.
+ * \{ */
+
+static bool modifier_stack_supports_shared_eval(const Scene *scene,
+                                                const Object *ob,
+                                                ModifierData *firstmd,
+                                                const int required_mode)
+{
+  /* Virtual modifiers (shape keys, armature parent deform) always depend on the object. */
+  if (firstmd != ob->modifiers.first) {
+    return false;
+  }
+  int modifiers_num = 0;
+  for (ModifierData *md = firstmd; md; md = md->next) {
+    if (!BKE_modifier_is_enabled(scene, md, required_mode)) {
+      continue;
+    }
+    const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
+    if (mti->equalsSettings == nullptr) {
+      return false;
+    }
+    /* Deform modifiers would additionally have to be evaluated for the per-object deform-only
+     * mesh, so sharing is limited to fully constructive stacks. */
+    if (mti->type == eModifierTypeType_OnlyDeform) {
+      return false;
+    }
+    modifiers_num++;
+  }
+  /* The empty stack is already shared through `runtime.mesh_eval`. */
+  return modifiers_num > 0;
+}
+
+static bool modifier_stack_equals_shared_eval(const Scene *scene,
+                                              ModifierData *firstmd,
+                                              const int required_mode,
+                                              const ListBase *shared_stack)
+{
+  const ModifierData *md_shared = (const ModifierData *)shared_stack->first;
+  for (ModifierData *md = firstmd; md; md = md->next) {
+    if (!BKE_modifier_is_enabled(scene, md, required_mode)) {
+      continue;
+    }
+    if (md_shared == nullptr || md_shared->type != md->type) {
+      return false;
+    }
+    const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
+    if (!mti->equalsSettings(md, md_shared)) {
+      return false;
+    }
+    md_shared = md_shared->next;
+  }
+  return md_shared == nullptr;
+}
+
+static void modifier_stack_copy_for_shared_eval(const Scene *scene,
+                                                ModifierData *firstmd,
+                                                const int required_mode,
+                                                ListBase *r_shared_stack)
+{
+  BLI_listbase_clear(r_shared_stack);
+  for (ModifierData *md = firstmd; md; md = md->next) {
+    if (!BKE_modifier_is_enabled(scene, md, required_mode)) {
+      continue;
+    }
+    BLI_addtail(r_shared_stack, BKE_modifier_copy_ex(md, LIB_ID_CREATE_NO_USER_REFCOUNT));
+  }
+}
+
+/** \} */
+
 static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
                                 const Scene *scene,
                                 Object *ob,
@@ -814,6 +900,39 @@ static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
   /* Clear errors before evaluation. */
   BKE_modifiers_clear_errors(ob);
 
+  /* Objects which use the same mesh with equal modifier stacks can share one evaluated result.
+   * Check for a result evaluated for another object user first; when there is none yet, this
+   * evaluation publishes its own result at the end. */
+  const bool use_shared_stack_eval = allow_shared_mesh && use_deform && !need_mapping &&
+                                     (index == -1) && !sculpt_mode &&
+                                     modifier_stack_supports_shared_eval(
+                                         scene, ob, firstmd, required_mode);
+  if (use_shared_stack_eval) {
+    Mesh_Runtime *runtime = &mesh_input->runtime;
+    Mesh *mesh_shared = nullptr;
+    BLI_mutex_lock((ThreadMutex *)runtime->eval_mutex);
+    if (runtime->shared_stack_eval != nullptr &&
+        CustomData_MeshMasks_are_matching(&runtime->shared_stack_eval_mask, &final_datamask) &&
+        modifier_stack_equals_shared_eval(
+            scene, firstmd, required_mode, &runtime->shared_stack_eval_modifiers)) {
+      mesh_shared = runtime->shared_stack_eval;
+    }
+    BLI_mutex_unlock((ThreadMutex *)runtime->eval_mutex);
+    if (mesh_shared != nullptr) {
+      BLI_linklist_free((LinkNode *)datamasks, nullptr);
+      if (r_deform) {
+        /* Shared stacks contain no deform modifiers, so the deform-only mesh is just a copy of
+         * the input, see #modifier_stack_supports_shared_eval. */
+        *r_deform = BKE_mesh_copy_for_eval(mesh_input, true);
+      }
+      *r_final = mesh_shared;
+      if (r_geometry_set) {
+        *r_geometry_set = new GeometrySet(std::move(geometry_set_final));
+      }
+      return;
+    }
+  }
+
   /* Apply all leading deform modifiers. */
   if (use_deform) {
     for (; md; md = md->next, md_datamask = md_datamask->next) {
@@ -1211,6 +1330,30 @@ static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
 
   if (is_own_mesh) {
     mesh_calc_finalize(mesh_input, mesh_final);
+
+    if (mesh_final->runtime.deformed_only) {
+      /* A deform-only result has the exact same topology as the input mesh. Stamp both meshes
+       * with a common topology version and share the input's (persistent) looptri cache, so
+       * repeated re-evaluations (e.g. every frame of playback of a rigged character) skip the
+       * re-tessellation and only refresh positions and normals. */
+      mesh_final->runtime.topology_version = BKE_mesh_runtime_topology_version_ensure(mesh_input);
+      BKE_mesh_runtime_looptri_cache_reuse(mesh_input, mesh_final);
+    }
+  }
+
+  if (use_shared_stack_eval && is_own_mesh) {
+    Mesh_Runtime *runtime = &mesh_input->runtime;
+    BLI_mutex_lock((ThreadMutex *)runtime->eval_mutex);
+    if (runtime->shared_stack_eval == nullptr) {
+      /* First evaluation of this stack: publish the result so other object users of the mesh
+       * with an equal stack pick it up instead of re-evaluating. Ownership moves to the input
+       * mesh, see the ownership handling in #mesh_build_data. */
+      modifier_stack_copy_for_shared_eval(
+          scene, firstmd, required_mode, &runtime->shared_stack_eval_modifiers);
+      runtime->shared_stack_eval = mesh_final;
+      runtime->shared_stack_eval_mask = final_datamask;
+    }
+    BLI_mutex_unlock((ThreadMutex *)runtime->eval_mutex);
   }
 
   /* Return final mesh */
@@ -1639,7 +1782,8 @@ static void mesh_build_data(struct Depsgraph *depsgraph,
    * object's runtime: this could cause access freed data on depsgraph destruction (mesh who owns
    * the final result might be freed prior to object). */
   Mesh *mesh = (Mesh *)ob->data;
-  const bool is_mesh_eval_owned = (mesh_eval != mesh->runtime.mesh_eval);
+  const bool is_mesh_eval_owned = !ELEM(
+      mesh_eval, mesh->runtime.mesh_eval, mesh->runtime.shared_stack_eval);
   BKE_object_eval_assign_data(ob, &mesh_eval->id, is_mesh_eval_owned);
 
   /* Add the final mesh as a non-owning component to the geometry set. */
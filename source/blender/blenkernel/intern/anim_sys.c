@@ -19,7 +19,9 @@
 #include "BLI_listbase.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_memarena.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -578,6 +580,70 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/**
+ * Resolve the RNA path of \a fcu on \a ptr, caching the result on the F-Curve so that
+ * steady-state playback does no string parsing at all.
+ *
+ * \warning \a fcu must be owned by the ID of \a ptr (as is the case for drivers, which are
+ * embedded in the AnimData of the animated ID). Then the cache on an evaluated copy is freed
+ * together with the copy whenever the copy-on-write data is re-created, so it can never outlive
+ * the data it points into. This does not hold for action F-Curves, which are owned by a separate
+ * Action ID with its own copy-on-write life cycle.
+ *
+ * Original data is edited by the user without a comparable point of invalidation, so lookups on
+ * it keep resolving the path from scratch.
+ */
+static bool animsys_rna_path_resolve_cached(PointerRNA *ptr, FCurve *fcu, PathResolvedRNA *r_rna)
+{
+  if (ptr->owner_id == NULL || (ptr->owner_id->tag & LIB_TAG_COPIED_ON_WRITE) == 0) {
+    return BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, r_rna);
+  }
+
+  if (fcu->rna_path_resolved != NULL) {
+    *r_rna = *(PathResolvedRNA *)fcu->rna_path_resolved;
+    return true;
+  }
+
+  if (!BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, r_rna)) {
+    /* Failed resolutions are not cached, so fixing the underlying problem (e.g. adding a missing
+     * bone) takes effect without having to touch the curve. */
+    return false;
+  }
+
+  PathResolvedRNA *resolved = MEM_mallocN(sizeof(PathResolvedRNA), __func__);
+  *resolved = *r_rna;
+  fcu->rna_path_resolved = resolved;
+  return true;
+}
+
+/* Evaluation result of a single F-Curve, for parallel evaluation of an F-Curve list. */
+typedef struct FCurveEvalChannel {
+  FCurve *fcu;
+  PathResolvedRNA anim_rna;
+  float value;
+  bool resolved;
+} FCurveEvalChannel;
+
+typedef struct FCurvesEvalData {
+  PointerRNA *ptr;
+  const AnimationEvalContext *anim_eval_context;
+  FCurveEvalChannel *channels;
+} FCurvesEvalData;
+
+static void animsys_evaluate_fcurve_channel_cb(void *__restrict userdata,
+                                               const int index,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  FCurvesEvalData *data = userdata;
+  FCurveEvalChannel *channel = &data->channels[index];
+
+  channel->resolved = BKE_animsys_rna_path_resolve(
+      data->ptr, channel->fcu->rna_path, channel->fcu->array_index, &channel->anim_rna);
+  if (channel->resolved) {
+    channel->value = calculate_fcurve(&channel->anim_rna, channel->fcu, data->anim_eval_context);
+  }
+}
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -588,22 +654,71 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
-  /* Calculate then execute each curve. */
+  int totchannel = 0;
   LISTBASE_FOREACH (FCurve *, fcu, list) {
-
-    if (!is_fcurve_evaluatable(fcu)) {
-      continue;
+    if (is_fcurve_evaluatable(fcu)) {
+      totchannel++;
     }
+  }
 
-    PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
-      const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
-      BKE_animsys_write_to_rna_path(&anim_rna, curval);
-      if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+  /* For short lists the threading overhead outweighs the win of evaluating the curves in
+   * parallel, so calculate then execute each curve as before. */
+  if (totchannel < 256) {
+    LISTBASE_FOREACH (FCurve *, fcu, list) {
+
+      if (!is_fcurve_evaluatable(fcu)) {
+        continue;
+      }
+
+      PathResolvedRNA anim_rna;
+      if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+        const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
+        BKE_animsys_write_to_rna_path(&anim_rna, curval);
+        if (flush_to_original) {
+          animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+        }
       }
     }
+    return;
   }
+
+  FCurveEvalChannel *channels = MEM_malloc_arrayN(
+      totchannel, sizeof(FCurveEvalChannel), __func__);
+  int index = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, list) {
+    if (is_fcurve_evaluatable(fcu)) {
+      channels[index++].fcu = fcu;
+    }
+  }
+
+  /* Resolving the RNA paths and calculating the curves only reads shared data, so it can run in
+   * parallel over the channels. */
+  FCurvesEvalData eval_data = {
+      .ptr = ptr,
+      .anim_eval_context = anim_eval_context,
+      .channels = channels,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, totchannel, &eval_data, animsys_evaluate_fcurve_channel_cb, &settings);
+
+  /* Writing the results has to stay serial: setting an index of an RNA array property
+   * reads-modifies-writes the entire array, so writes to different indices of the same property
+   * (e.g. the three location channels of an object) would race with each other. */
+  for (index = 0; index < totchannel; index++) {
+    FCurveEvalChannel *channel = &channels[index];
+    if (!channel->resolved) {
+      continue;
+    }
+    BKE_animsys_write_to_rna_path(&channel->anim_rna, channel->value);
+    if (flush_to_original) {
+      animsys_write_orig_anim_rna(
+          ptr, channel->fcu->rna_path, channel->fcu->array_index, channel->value);
+    }
+  }
+
+  MEM_freeN(channels);
 }
 
 /* This function assumes that the quaternion is fully keyed, and is stored in array index order. */
@@ -1090,25 +1205,17 @@ static NlaEvalStrip *nlastrips_ctime_get_strip_single(
 
 /* ---------------------- */
 
-/* Initialize a valid mask, allocating memory if necessary. */
-static void nlavalidmask_init(NlaValidMask *mask, int bits)
+/* Initialize a valid mask, allocating from the evaluation arena if necessary. */
+static void nlavalidmask_init(struct MemArena *arena, NlaValidMask *mask, int bits)
 {
   if (BLI_BITMAP_SIZE(bits) > sizeof(mask->buffer)) {
-    mask->ptr = BLI_BITMAP_NEW(bits, "NlaValidMask");
+    mask->ptr = BLI_memarena_calloc(arena, BLI_BITMAP_SIZE(bits));
   }
   else {
     mask->ptr = mask->buffer;
   }
 }
 
-/* Free allocated memory for the mask. */
-static void nlavalidmask_free(NlaValidMask *mask)
-{
-  if (mask->ptr != mask->buffer) {
-    MEM_freeN(mask->ptr);
-  }
-}
-
 /* ---------------------- */
 
 /* Hashing functions for NlaEvalChannelKey. */
@@ -1129,32 +1236,23 @@ static bool nlaevalchan_keycmp(const void *a, const void *b)
 
 /* ---------------------- */
 
-/* Allocate a new blending value snapshot for the channel. */
+/* Allocate a new blending value snapshot for the channel, from the evaluation arena. */
 static NlaEvalChannelSnapshot *nlaevalchan_snapshot_new(NlaEvalChannel *nec)
 {
+  struct MemArena *arena = nec->owner->arena;
   int length = nec->base_snapshot.length;
 
   size_t byte_size = sizeof(NlaEvalChannelSnapshot) + sizeof(float) * length;
-  NlaEvalChannelSnapshot *nec_snapshot = MEM_callocN(byte_size, "NlaEvalChannelSnapshot");
+  NlaEvalChannelSnapshot *nec_snapshot = BLI_memarena_calloc(arena, byte_size);
 
   nec_snapshot->channel = nec;
   nec_snapshot->length = length;
-  nlavalidmask_init(&nec_snapshot->blend_domain, length);
-  nlavalidmask_init(&nec_snapshot->remap_domain, length);
+  nlavalidmask_init(arena, &nec_snapshot->blend_domain, length);
+  nlavalidmask_init(arena, &nec_snapshot->remap_domain, length);
 
   return nec_snapshot;
 }
 
-/* Free a channel's blending value snapshot. */
-static void nlaevalchan_snapshot_free(NlaEvalChannelSnapshot *nec_snapshot)
-{
-  BLI_assert(!nec_snapshot->is_base);
-
-  nlavalidmask_free(&nec_snapshot->blend_domain);
-  nlavalidmask_free(&nec_snapshot->remap_domain);
-  MEM_freeN(nec_snapshot);
-}
-
 /* Copy all data in the snapshot. */
 static void nlaevalchan_snapshot_copy(NlaEvalChannelSnapshot *dst,
                                       const NlaEvalChannelSnapshot *src)
@@ -1241,38 +1339,24 @@ static NlaEvalChannelSnapshot *nlaeval_snapshot_ensure_channel(NlaEvalSnapshot *
   return *slot;
 }
 
-/* Free all memory owned by this blending snapshot structure. */
+/* Free the slot array of this blending snapshot structure.
+ * The channel snapshots themselves live in the arena of the NlaEvalData. */
 static void nlaeval_snapshot_free_data(NlaEvalSnapshot *snapshot)
 {
-  if (snapshot->channels != NULL) {
-    for (int i = 0; i < snapshot->size; i++) {
-      NlaEvalChannelSnapshot *nec_snapshot = snapshot->channels[i];
-      if (nec_snapshot != NULL) {
-        nlaevalchan_snapshot_free(nec_snapshot);
-      }
-    }
-
-    MEM_freeN(snapshot->channels);
-  }
+  MEM_SAFE_FREE(snapshot->channels);
 
   snapshot->base = NULL;
   snapshot->size = 0;
-  snapshot->channels = NULL;
 }
 
 /* ---------------------- */
 
-/* Free memory owned by this evaluation channel. */
-static void nlaevalchan_free_data(NlaEvalChannel *nec)
-{
-  nlavalidmask_free(&nec->domain);
-}
-
 /* Initialize a full NLA evaluation state structure. */
 static void nlaeval_init(NlaEvalData *nlaeval)
 {
   memset(nlaeval, 0, sizeof(*nlaeval));
 
+  nlaeval->arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "NlaEvalData::arena");
   nlaeval->path_hash = BLI_ghash_str_new("NlaEvalData::path_hash");
   nlaeval->key_hash = BLI_ghash_new(
       nlaevalchan_keyhash, nlaevalchan_keycmp, "NlaEvalData::key_hash");
@@ -1286,14 +1370,11 @@ static void nlaeval_free(NlaEvalData *nlaeval)
   /* Delete result snapshot. */
   nlaeval_snapshot_free_data(&nlaeval->eval_snapshot);
 
-  /* Delete channels. */
-  LISTBASE_FOREACH (NlaEvalChannel *, nec, &nlaeval->channels) {
-    nlaevalchan_free_data(nec);
-  }
-
-  BLI_freelistN(&nlaeval->channels);
+  /* The channels with their masks and snapshots all live in the arena. */
+  BLI_listbase_clear(&nlaeval->channels);
   BLI_ghash_free(nlaeval->path_hash, NULL, NULL);
   BLI_ghash_free(nlaeval->key_hash, NULL, NULL);
+  BLI_memarena_free(nlaeval->arena);
 }
 
 /* ---------------------- */
@@ -1449,8 +1530,8 @@ static NlaEvalChannel *nlaevalchan_verify_key(NlaEvalData *nlaeval,
   bool is_array = RNA_property_array_check(key->prop);
   int length = is_array ? RNA_property_array_length(&key->ptr, key->prop) : 1;
 
-  NlaEvalChannel *nec = MEM_callocN(sizeof(NlaEvalChannel) + sizeof(float) * length,
-                                    "NlaEvalChannel");
+  NlaEvalChannel *nec = BLI_memarena_calloc(nlaeval->arena,
+                                            sizeof(NlaEvalChannel) + sizeof(float) * length);
 
   /* Initialize the channel. */
   nec->rna_path = path;
@@ -1462,7 +1543,7 @@ static NlaEvalChannel *nlaevalchan_verify_key(NlaEvalData *nlaeval,
 
   nec->mix_mode = nlaevalchan_detect_mix_mode(key, length);
 
-  nlavalidmask_init(&nec->domain, length);
+  nlavalidmask_init(nlaeval->arena, &nec->domain, length);
 
   nec->base_snapshot.channel = nec;
   nec->base_snapshot.length = length;
@@ -3480,7 +3561,7 @@ void BKE_animsys_eval_driver(Depsgraph *depsgraph, ID *id, int driver_index, FCu
       // printf("\told val = %f\n", fcu->curval);
 
       PathResolvedRNA anim_rna;
-      if (BKE_animsys_rna_path_resolve(&id_ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+      if (animsys_rna_path_resolve_cached(&id_ptr, fcu, &anim_rna)) {
         /* Evaluate driver, and write results to COW-domain destination */
         const float ctime = DEG_get_ctime(depsgraph);
         const AnimationEvalContext anim_eval_context = BKE_animsys_eval_context_construct(
@@ -188,7 +188,20 @@ static float dist_bone_deform(
   return contrib;
 }
 
-static void pchan_bone_deform(bPoseChannel *pchan,
+/**
+ * Per vertex-group deform plan, resolved once per evaluation so the per-vertex weight loop
+ * does not have to chase the pose-channel and bone pointers again for every weight.
+ */
+typedef struct BoneDefgroupInfo {
+  /** NULL for vertex groups which are not controlled by a deforming bone. */
+  bPoseChannel *pchan;
+  /** Use B-Bone segment deformation, see #b_bone_deform. */
+  bool use_bbone;
+  /** Multiply the vertex-group weight with the bone's envelope influence. */
+  bool use_mult_vg_env;
+} BoneDefgroupInfo;
+
+static void pchan_bone_deform(const BoneDefgroupInfo *dg_info,
                               float weight,
                               float vec[3],
                               DualQuat *dq,
@@ -196,18 +209,21 @@ static void pchan_bone_deform(bPoseChannel *pchan,
                               const float co[3],
                               float *contrib)
 {
-  Bone *bone = pchan->bone;
-
   if (!weight) {
     return;
   }
 
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
-    b_bone_deform(pchan, co, weight, vec, dq, mat);
+  if (dg_info->use_bbone) {
+    b_bone_deform(dg_info->pchan, co, weight, vec, dq, mat);
   }
   else {
-    pchan_deform_accumulate(
-        &pchan->runtime.deform_dual_quat, pchan->chan_mat, co, weight, vec, dq, mat);
+    pchan_deform_accumulate(&dg_info->pchan->runtime.deform_dual_quat,
+                            dg_info->pchan->chan_mat,
+                            co,
+                            weight,
+                            vec,
+                            dq,
+                            mat);
   }
 
   (*contrib) += weight;
@@ -239,7 +255,7 @@ typedef struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const BoneDefgroupInfo *defgroup_info;
   int defbase_len;
 
   float premat[4][4];
@@ -317,18 +333,19 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     unsigned int j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
+      const BoneDefgroupInfo *dg_info;
+      if (index < data->defbase_len && (dg_info = &data->defgroup_info[index])->pchan != NULL) {
         float weight = dw->weight;
-        Bone *bone = pchan->bone;
 
         deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
+        if (dg_info->use_mult_vg_env) {
+          const Bone *bone = dg_info->pchan->bone;
           weight *= distfactor_to_bone(
               co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
         }
 
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, &contrib);
+        pchan_bone_deform(dg_info, weight, vec, dq, smat, co, &contrib);
       }
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
@@ -404,22 +421,10 @@ static void armature_vert_task(void *__restrict userdata,
 {
   const ArmatureUserdata *data = userdata;
   const MDeformVert *dvert;
-  if (data->use_dverts || data->armature_def_nr != -1) {
-    if (data->me_target) {
-      BLI_assert(i < data->me_target->totvert);
-      if (data->me_target->dvert != NULL) {
-        dvert = data->me_target->dvert + i;
-      }
-      else {
-        dvert = NULL;
-      }
-    }
-    else if (data->dverts && i < data->dverts_len) {
-      dvert = data->dverts + i;
-    }
-    else {
-      dvert = NULL;
-    }
+  /* The deform-vertex source is resolved once at setup, see #armature_deform_coords_impl. */
+  if ((data->use_dverts || data->armature_def_nr != -1) && data->dverts &&
+      i < data->dverts_len) {
+    dvert = data->dverts + i;
   }
   else {
     dvert = NULL;
@@ -460,7 +465,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         bGPDstroke *gps_target)
 {
   bArmature *arm = ob_arm->data;
-  bPoseChannel **pchan_from_defbase = NULL;
+  BoneDefgroupInfo *defgroup_info = NULL;
   const MDeformVert *dverts = NULL;
   bDeformGroup *dg;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
@@ -490,7 +495,14 @@ static void armature_deform_coords_impl(const Object *ob_arm,
 
     defbase_len = BKE_object_defgroup_count(ob_target);
 
-    if (ob_target->type == OB_MESH) {
+    if (me_target != NULL) {
+      /* Use the deform-verts of the evaluated mesh, not of the original object data. */
+      dverts = me_target->dvert;
+      if (dverts) {
+        dverts_len = me_target->totvert;
+      }
+    }
+    else if (ob_target->type == OB_MESH) {
       if (em_target == NULL) {
         Mesh *me = ob_target->data;
         dverts = me->dvert;
@@ -528,19 +540,24 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone");
+        defgroup_info = MEM_callocN(sizeof(*defgroup_info) * defbase_len, "defnrToBone");
         /* TODO(sergey): Some considerations here:
          *
          * - Check whether keeping this consistent across frames gives speedup.
          */
         const ListBase *defbase = BKE_object_defgroup_list(ob_target);
         for (i = 0, dg = defbase->first; dg; i++, dg = dg->next) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = NULL;
-            }
+          if (pchan && (pchan->bone->flag & BONE_NO_DEFORM)) {
+            pchan = NULL;
+          }
+          defgroup_info[i].pchan = pchan;
+          if (pchan) {
+            const Bone *bone = pchan->bone;
+            defgroup_info[i].use_bbone = (bone->segments > 1 &&
+                                          pchan->runtime.bbone_segments == bone->segments);
+            defgroup_info[i].use_mult_vg_env = (bone->flag & BONE_MULT_VG_ENV) != 0;
           }
         }
       }
@@ -561,7 +578,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       .armature_def_nr = armature_def_nr,
       .dverts = dverts,
       .dverts_len = dverts_len,
-      .pchan_from_defbase = pchan_from_defbase,
+      .defgroup_info = defgroup_info,
       .defbase_len = defbase_len,
       .bmesh =
           {
@@ -599,8 +616,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
   }
 
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
+  if (defgroup_info) {
+    MEM_freeN(defgroup_info);
   }
 }
 
@@ -1502,6 +1502,13 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
   /* Note that in reload case, we also want to replace indirect usages. */
   const short remap_flags = ID_REMAP_SKIP_NEVER_NULL_USAGE |
                             (do_reload ? 0 : ID_REMAP_SKIP_INDIRECT_USAGE);
+
+  /* With cached relations available, each remap call below only processes the actual users of the
+   * remapped ID, instead of walking the whole Main database every time. The remapping code itself
+   * keeps the `from_ids` side of the cached relations usable across the whole loop (see
+   * #BKE_main_relations_id_usage_add); the `to_ids` side is not relied upon here. */
+  BKE_main_relations_create(bmain, 0);
+
   for (item_idx = 0, itemlink = lapp_context->items.list; itemlink;
        item_idx++, itemlink = itemlink->next) {
     BlendfileLinkAppendContextItem *item = itemlink->link;
@@ -1529,6 +1536,9 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
     }
   }
 
+  /* Must be freed before any ID deletion below, relations hold ID pointers. */
+  BKE_main_relations_free(bmain);
+
   BKE_main_unlock(bmain);
 
   for (item_idx = 0, itemlink = lapp_context->items.list; itemlink;
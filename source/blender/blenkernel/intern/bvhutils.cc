@@ -32,6 +32,8 @@
 
 struct BVHCacheItem {
   bool is_filled;
+  /* Vertex positions changed since the tree was built, refit (or rebuild) before use. */
+  bool is_dirty;
   BVHTree *tree;
 };
 
@@ -131,6 +133,135 @@ static void bvhcache_insert(BVHCache *bvh_cache, BVHTree *tree, BVHCacheType typ
   item->is_filled = true;
 }
 
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache)
+{
+  BLI_mutex_lock(&bvh_cache->mutex);
+  for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
+    BVHCacheItem *item = &bvh_cache->items[index];
+    if (item->is_filled && item->tree != nullptr) {
+      item->is_dirty = true;
+    }
+  }
+  BLI_mutex_unlock(&bvh_cache->mutex);
+}
+
+/**
+ * Refit the bounding volumes of a cached tree to the current vertex positions of \a mesh,
+ * instead of rebuilding it from scratch. Only possible for tree types whose leaves map 1:1
+ * to mesh elements (no element masks), and only when the element count still matches.
+ */
+static bool bvhtree_mesh_refit(BVHTree *tree, const BVHCacheType bvh_cache_type, const Mesh *mesh)
+{
+  const MVert *vert = mesh->mvert;
+  if (vert == nullptr) {
+    return false;
+  }
+
+  switch (bvh_cache_type) {
+    case BVHTREE_FROM_VERTS: {
+      if (BLI_bvhtree_get_len(tree) != mesh->totvert) {
+        return false;
+      }
+      for (int i = 0; i < mesh->totvert; i++) {
+        BLI_bvhtree_update_node(tree, i, vert[i].co, nullptr, 1);
+      }
+      break;
+    }
+    case BVHTREE_FROM_EDGES: {
+      const MEdge *edge = mesh->medge;
+      if (edge == nullptr || BLI_bvhtree_get_len(tree) != mesh->totedge) {
+        return false;
+      }
+      for (int i = 0; i < mesh->totedge; i++) {
+        float co[2][3];
+        copy_v3_v3(co[0], vert[edge[i].v1].co);
+        copy_v3_v3(co[1], vert[edge[i].v2].co);
+        BLI_bvhtree_update_node(tree, i, co[0], nullptr, 2);
+      }
+      break;
+    }
+    case BVHTREE_FROM_FACES: {
+      const MFace *face = mesh->mface;
+      if (face == nullptr || BLI_bvhtree_get_len(tree) != mesh->totface) {
+        return false;
+      }
+      for (int i = 0; i < mesh->totface; i++) {
+        float co[4][3];
+        copy_v3_v3(co[0], vert[face[i].v1].co);
+        copy_v3_v3(co[1], vert[face[i].v2].co);
+        copy_v3_v3(co[2], vert[face[i].v3].co);
+        if (face[i].v4) {
+          copy_v3_v3(co[3], vert[face[i].v4].co);
+        }
+        BLI_bvhtree_update_node(tree, i, co[0], nullptr, face[i].v4 ? 4 : 3);
+      }
+      break;
+    }
+    case BVHTREE_FROM_LOOPTRI: {
+      const MLoop *mloop = mesh->mloop;
+      const MLoopTri *looptri = BKE_mesh_runtime_looptri_ensure(mesh);
+      if (mloop == nullptr || looptri == nullptr ||
+          BLI_bvhtree_get_len(tree) != BKE_mesh_runtime_looptri_len(mesh)) {
+        return false;
+      }
+      for (int i = 0; i < BKE_mesh_runtime_looptri_len(mesh); i++) {
+        float co[3][3];
+        copy_v3_v3(co[0], vert[mloop[looptri[i].tri[0]].v].co);
+        copy_v3_v3(co[1], vert[mloop[looptri[i].tri[1]].v].co);
+        copy_v3_v3(co[2], vert[mloop[looptri[i].tri[2]].v].co);
+        BLI_bvhtree_update_node(tree, i, co[0], nullptr, 3);
+      }
+      break;
+    }
+    default:
+      /* Trees built with an element mask don't map leaf indices 1:1 to mesh elements,
+       * those have to be rebuilt. */
+      return false;
+  }
+
+  BLI_bvhtree_update_tree(tree);
+  return true;
+}
+
+/**
+ * Refit the cached tree of the given type when it was tagged dirty by
+ * #bvhcache_tag_positions_changed. Returns false when the tree could not be refitted,
+ * in which case the caller has to drop it from the cache and rebuild.
+ */
+static bool bvhcache_refit_if_dirty(BVHCache *bvh_cache,
+                                    const BVHCacheType bvh_cache_type,
+                                    const Mesh *mesh)
+{
+  BVHCacheItem *item = &bvh_cache->items[bvh_cache_type];
+  bool success = true;
+
+  BLI_mutex_lock(&bvh_cache->mutex);
+  if (item->is_dirty) {
+    success = bvhtree_mesh_refit(item->tree, bvh_cache_type, mesh);
+    if (success) {
+      item->is_dirty = false;
+    }
+  }
+  BLI_mutex_unlock(&bvh_cache->mutex);
+
+  return success;
+}
+
+/**
+ * Drops a stale tree from the cache so the regular code path rebuilds it.
+ */
+static void bvhcache_discard(BVHCache *bvh_cache, const BVHCacheType bvh_cache_type)
+{
+  BVHCacheItem *item = &bvh_cache->items[bvh_cache_type];
+
+  BLI_mutex_lock(&bvh_cache->mutex);
+  BLI_bvhtree_free(item->tree);
+  item->tree = nullptr;
+  item->is_filled = false;
+  item->is_dirty = false;
+  BLI_mutex_unlock(&bvh_cache->mutex);
+}
+
 void bvhcache_free(BVHCache *bvh_cache)
 {
   for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
@@ -1414,13 +1545,20 @@ BVHTree *BKE_bvhtree_from_mesh_get(struct BVHTreeFromMesh *data,
   BVHCache **bvh_cache_p = (BVHCache **)&mesh->runtime.bvh_cache;
   ThreadMutex *mesh_eval_mutex = (ThreadMutex *)mesh->runtime.eval_mutex;
 
-  const bool is_cached = bvhcache_find(bvh_cache_p, bvh_cache_type, &tree, nullptr, nullptr);
+  bool is_cached = bvhcache_find(bvh_cache_p, bvh_cache_type, &tree, nullptr, nullptr);
 
   if (is_cached && tree == nullptr) {
     memset(data, 0, sizeof(*data));
     return tree;
   }
 
+  if (is_cached && !bvhcache_refit_if_dirty(*bvh_cache_p, bvh_cache_type, mesh)) {
+    /* Vertex positions changed but the tree cannot be refitted, rebuild it. */
+    bvhcache_discard(*bvh_cache_p, bvh_cache_type);
+    tree = nullptr;
+    is_cached = false;
+  }
+
   switch (bvh_cache_type) {
     case BVHTREE_FROM_VERTS:
     case BVHTREE_FROM_LOOSEVERTS:
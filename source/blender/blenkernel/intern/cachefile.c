@@ -18,6 +18,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -161,6 +162,43 @@ IDTypeInfo IDType_ID_CF = {
 /* TODO: make this per cache file to avoid global locks. */
 static SpinLock spin;
 
+/* Number of frames decoded ahead of the current one by #BKE_cachefile_prefetch. Bounds the
+ * memory used for prefetched samples; must not exceed the sample window kept by the readers. */
+#define CACHEFILE_PREFETCH_FRAMES 4
+
+/* Low priority background pool shared by all cache files, created on first use. */
+static TaskPool *prefetch_pool = NULL;
+
+#ifdef WITH_ALEMBIC
+typedef struct CacheFilePrefetchTask {
+  struct CacheReader *reader;
+  float time;
+} CacheFilePrefetchTask;
+
+static void cachefile_prefetch_task_run(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  CacheFilePrefetchTask *task = taskdata;
+  ABC_CacheReader_prefetch_sample(task->reader, task->time);
+}
+
+static void cachefile_prefetch_task_free(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  /* Also runs for tasks that are canceled before they ran, so the reference is always
+   * released exactly once. */
+  CacheFilePrefetchTask *task = taskdata;
+  ABC_CacheReader_free(task->reader);
+  MEM_freeN(task);
+}
+#endif
+
+/* Wait for background prefetch tasks, so readers and archives can be freed safely. */
+static void cachefile_prefetch_cancel(void)
+{
+  if (prefetch_pool != NULL) {
+    BLI_task_pool_cancel(prefetch_pool);
+  }
+}
+
 void BKE_cachefiles_init(void)
 {
   BLI_spin_init(&spin);
@@ -168,9 +206,49 @@ void BKE_cachefiles_init(void)
 
 void BKE_cachefiles_exit(void)
 {
+  cachefile_prefetch_cancel();
+
+  if (prefetch_pool != NULL) {
+    BLI_task_pool_free(prefetch_pool);
+    prefetch_pool = NULL;
+  }
+
   BLI_spin_end(&spin);
 }
 
+void BKE_cachefile_prefetch(CacheFile *cache_file,
+                            struct CacheReader *reader,
+                            const float ctime,
+                            const float fps)
+{
+#ifdef WITH_ALEMBIC
+  /* Only the Alembic readers keep a window of prefetched samples. For file sequences every
+   * frame comes from a different archive, so there is nothing to read ahead from. */
+  if (reader == NULL || cache_file->type != CACHEFILE_TYPE_ALEMBIC || cache_file->is_sequence) {
+    return;
+  }
+
+  BLI_spin_lock(&spin);
+  if (prefetch_pool == NULL) {
+    prefetch_pool = BLI_task_pool_create_background(NULL, TASK_PRIORITY_LOW);
+  }
+  BLI_spin_unlock(&spin);
+
+  for (int i = 1; i <= CACHEFILE_PREFETCH_FRAMES; i++) {
+    CacheFilePrefetchTask *task = MEM_mallocN(sizeof(*task), __func__);
+    /* The task holds its own reference, so the reader stays valid even when the modifier
+     * frees its reader while the task is still queued. */
+    ABC_CacheReader_incref(reader);
+    task->reader = reader;
+    task->time = BKE_cachefile_time_offset(cache_file, ctime + i, fps);
+    BLI_task_pool_push(
+        prefetch_pool, cachefile_prefetch_task_run, task, true, cachefile_prefetch_task_free);
+  }
+#else
+  UNUSED_VARS(cache_file, reader, ctime, fps);
+#endif
+}
+
 void BKE_cachefile_reader_open(CacheFile *cache_file,
                                struct CacheReader **reader,
                                Object *object,
@@ -262,6 +340,9 @@ static void cachefile_handle_free(CacheFile *cache_file)
 {
 #if defined(WITH_ALEMBIC) || defined(WITH_USD)
 
+  /* Background prefetch tasks read through the archive that is about to be freed. */
+  cachefile_prefetch_cancel();
+
   /* Free readers in all modifiers and constraints that use the handle, before
    * we free the handle itself. */
   BLI_spin_lock(&spin);
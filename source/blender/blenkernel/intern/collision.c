@@ -1415,6 +1415,29 @@ static bool cloth_bvh_selfcollisions_nearcheck(ClothModifierData *clmd,
   return data.collided;
 }
 
+typedef struct ImpulseApplyData {
+  ClothVertex *verts;
+  bool changed;
+} ImpulseApplyData;
+
+static void cloth_collision_impulse_apply(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ImpulseApplyData *data = userdata;
+  ClothVertex *vert = &data->verts[i];
+
+  /* Calculate "velocities" (just xnew = xold + v; no dt in v). */
+  if (vert->impulse_count) {
+    add_v3_v3(vert->tv, vert->impulse);
+    add_v3_v3(vert->dcvel, vert->impulse);
+    zero_v3(vert->impulse);
+    vert->impulse_count = 0;
+
+    data->changed = true;
+  }
+}
+
 static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
                                            Object **collobjs,
                                            CollPair **collisions,
@@ -1449,16 +1472,18 @@ static int cloth_bvh_objcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        // calculate "velocities" (just xnew = xold + v; no dt in v)
-        if (verts[i].impulse_count) {
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
+      ImpulseApplyData apply_data = {
+          .verts = verts,
+          .changed = false,
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = true;
+      BLI_task_parallel_range(0, mvert_num, &apply_data, cloth_collision_impulse_apply, &settings);
+
+      if (apply_data.changed) {
+        ret = 1;
       }
     }
     else {
@@ -1474,7 +1499,7 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
                                             const float dt)
 {
   Cloth *cloth = clmd->clothObject;
-  int i = 0, j = 0, mvert_num = 0;
+  int j = 0, mvert_num = 0;
   ClothVertex *verts = NULL;
   int ret = 0;
   int result = 0;
@@ -1489,16 +1514,18 @@ static int cloth_bvh_selfcollisions_resolve(ClothModifierData *clmd,
 
     /* Apply impulses in parallel. */
     if (result) {
-      for (i = 0; i < mvert_num; i++) {
-        if (verts[i].impulse_count) {
-          // VECADDMUL ( verts[i].tv, verts[i].impulse, 1.0f / verts[i].impulse_count );
-          add_v3_v3(verts[i].tv, verts[i].impulse);
-          add_v3_v3(verts[i].dcvel, verts[i].impulse);
-          zero_v3(verts[i].impulse);
-          verts[i].impulse_count = 0;
-
-          ret++;
-        }
+      ImpulseApplyData apply_data = {
+          .verts = verts,
+          .changed = false,
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = true;
+      BLI_task_parallel_range(0, mvert_num, &apply_data, cloth_collision_impulse_apply, &settings);
+
+      if (apply_data.changed) {
+        ret = 1;
       }
     }
 
@@ -1538,6 +1565,42 @@ static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b,
   return false;
 }
 
+typedef struct ColliderOverlapData {
+  ClothModifierData *clmd;
+  BVHTree *cloth_bvh;
+  Object **collobjs;
+  float step;
+  float dt;
+  bool is_hair;
+  BVHTreeOverlap **overlap;
+  uint *coll_counts;
+} ColliderOverlapData;
+
+/* Colliders are independent of each other: refit each collider tree and run its broadphase
+ * against the (read-only) cloth tree in parallel. */
+static void cloth_bvh_obj_overlap_task_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ColliderOverlapData *data = userdata;
+  Object *collob = data->collobjs[i];
+  CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
+      collob, eModifierType_Collision);
+
+  if (!collmd->bvhtree) {
+    return;
+  }
+
+  /* Move object to position (step) in time. */
+  collision_move_object(collmd, data->step + data->dt, data->step, false);
+
+  data->overlap[i] = BLI_bvhtree_overlap(data->cloth_bvh,
+                                         collmd->bvhtree,
+                                         &data->coll_counts[i],
+                                         data->is_hair ? NULL : cloth_bvh_obj_overlap_cb,
+                                         data->clmd);
+}
+
 int cloth_bvh_collision(
     Depsgraph *depsgraph, Object *ob, ClothModifierData *clmd, float step, float dt)
 {
@@ -1577,24 +1640,21 @@ int cloth_bvh_collision(
       coll_counts_obj = MEM_callocN(sizeof(uint) * numcollobj, "CollCounts");
       overlap_obj = MEM_callocN(sizeof(*overlap_obj) * numcollobj, "BVHOverlap");
 
-      for (i = 0; i < numcollobj; i++) {
-        Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
-
-        if (!collmd->bvhtree) {
-          continue;
-        }
-
-        /* Move object to position (step) in time. */
-        collision_move_object(collmd, step + dt, step, false);
-
-        overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
-                                             collmd->bvhtree,
-                                             &coll_counts_obj[i],
-                                             is_hair ? NULL : cloth_bvh_obj_overlap_cb,
-                                             clmd);
-      }
+      ColliderOverlapData data = {
+          .clmd = clmd,
+          .cloth_bvh = cloth_bvh,
+          .collobjs = collobjs,
+          .step = step,
+          .dt = dt,
+          .is_hair = is_hair,
+          .overlap = overlap_obj,
+          .coll_counts = coll_counts_obj,
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (numcollobj > 1);
+      BLI_task_parallel_range(0, numcollobj, &data, cloth_bvh_obj_overlap_task_cb, &settings);
     }
   }
 
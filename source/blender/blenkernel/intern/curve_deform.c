@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include "BLI_math.h"
+#include "BLI_math_vector_batch.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_curve_types.h"
@@ -347,10 +348,8 @@ static void curve_deform_coords_impl(const Object *ob_curve,
       }
     }
     else {
-      for (a = 0; a < vert_coords_len; a++) {
-        mul_m4_v3(cd.curvespace, vert_coords[a]);
-        minmax_v3v3_v3(cd.dmin, cd.dmax, vert_coords[a]);
-      }
+      mul_m4_v3_array(cd.curvespace, vert_coords, vert_coords_len);
+      minmax_v3v3_v3_array(cd.dmin, cd.dmax, vert_coords, vert_coords_len);
 
       for (a = 0; a < vert_coords_len; a++) {
         /* Already in 'cd.curvespace', previous for loop. */
@@ -88,6 +88,18 @@ void CurveEval::transform(const float4x4 &matrix)
 
 bool CurveEval::bounds_min_max(float3 &min, float3 &max, const bool use_evaluated) const
 {
+  if (use_evaluated) {
+    /* Evaluating a single spline is single threaded, but the lazy evaluated position caches of
+     * multiple splines can be filled at the same time. */
+    blender::threading::parallel_for(splines_.index_range(), 128, [&](IndexRange range) {
+      for (const int i : range) {
+        if (splines_[i]->size()) {
+          splines_[i]->evaluated_positions();
+        }
+      }
+    });
+  }
+
   bool have_minmax = false;
   for (const SplinePtr &spline : this->splines()) {
     if (spline->size()) {
@@ -101,6 +113,13 @@ bool CurveEval::bounds_min_max(float3 &min, float3 &max, const bool use_evaluate
 
 float CurveEval::total_length() const
 {
+  /* Fill the length caches of all splines in parallel before the serial sum below. */
+  blender::threading::parallel_for(splines_.index_range(), 128, [&](IndexRange range) {
+    for (const int i : range) {
+      splines_[i]->length();
+    }
+  });
+
   float length = 0.0f;
   for (const SplinePtr &spline : this->splines()) {
     length += spline->length();
@@ -131,6 +150,14 @@ blender::Array<int> CurveEval::control_point_offsets() const
 
 blender::Array<int> CurveEval::evaluated_point_offsets() const
 {
+  /* The number of evaluated points is stored in a cache that is computed lazily (at least for
+   * Bézier splines). Fill those caches in parallel before the serial accumulation below. */
+  blender::threading::parallel_for(splines_.index_range(), 128, [&](IndexRange range) {
+    for (const int i : range) {
+      splines_[i]->evaluated_points_size();
+    }
+  });
+
   Array<int> offsets(splines_.size() + 1);
   int offset = 0;
   for (const int i : splines_.index_range()) {
@@ -143,6 +170,13 @@ blender::Array<int> CurveEval::evaluated_point_offsets() const
 
 blender::Array<float> CurveEval::accumulated_spline_lengths() const
 {
+  /* Fill the length caches of all splines in parallel; the accumulation afterwards is trivial. */
+  blender::threading::parallel_for(splines_.index_range(), 128, [&](IndexRange range) {
+    for (const int i : range) {
+      splines_[i]->length();
+    }
+  });
+
   Array<float> spline_lengths(splines_.size() + 1);
   float spline_length = 0.0f;
   for (const int i : splines_.index_range()) {
@@ -49,6 +49,8 @@
 
 #include "CLG_log.h"
 
+#include "atomic_ops.h"
+
 /* only for customdata_data_transfer_interp_normal_normals */
 #include "data_transfer_intern.h"
 
@@ -2046,6 +2048,93 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
                                                        int totelem,
                                                        const char *name);
 
+/* -------------------------------------------------------------------- */
+/** \name Layer Data Sharing
+ *
+ * Layers copied with #CD_REFERENCE share their data array. Historically that relied on
+ * #CD_FLAG_NOFREE and the rule that the source outlives every referencing copy, and the first
+ * write always paid for a full duplicate. The reference count below makes sharing symmetrical:
+ * the data is freed together with its last user (in whichever order the users are freed), and a
+ * sole remaining user can take exclusive ownership without copying.
+ * \{ */
+
+struct LayerSharingInfo {
+  /** Number of layers referencing the shared data, modified atomically since evaluated copies
+   * are created and freed from multiple threads. */
+  int32_t users;
+};
+
+/**
+ * Get the sharing info of \a layer, creating it when the layer exclusively owns its data.
+ * Returns null for legacy #CD_FLAG_NOFREE references, which don't own the data and therefore
+ * cannot safely hand out counted references to it.
+ */
+static LayerSharingInfo *customdata_sharing_info_ensure(CustomDataLayer *layer)
+{
+  if (layer->sharing_info == nullptr) {
+    if (layer->flag & CD_FLAG_NOFREE) {
+      return nullptr;
+    }
+    LayerSharingInfo *info = MEM_cnew<LayerSharingInfo>(__func__);
+    info->users = 1;
+    layer->sharing_info = info;
+  }
+  return static_cast<LayerSharingInfo *>(layer->sharing_info);
+}
+
+static void customdata_sharing_info_user_add(LayerSharingInfo *info)
+{
+  atomic_add_and_fetch_int32(&info->users, 1);
+}
+
+/**
+ * Drop one user. Returns true when this was the last user, in which case the caller is
+ * responsible for freeing the data and \a info.
+ */
+static bool customdata_sharing_info_user_remove(LayerSharingInfo *info)
+{
+  return atomic_sub_and_fetch_int32(&info->users, 1) == 0;
+}
+
+/**
+ * Make \a layer the exclusive owner of its data, copying it only when other users remain.
+ * Only call for layers that hold a counted reference (`sharing_info` set).
+ */
+static void customdata_unshare_layer_data(CustomDataLayer *layer, const int totelem)
+{
+  LayerSharingInfo *info = static_cast<LayerSharingInfo *>(layer->sharing_info);
+
+  /* No new user can appear concurrently: they are only created by copying from this layer. */
+  if (info->users == 1) {
+    /* Sole user, take exclusive ownership without touching the data. */
+    MEM_freeN(info);
+  }
+  else {
+    const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+    void *dst_data = MEM_malloc_arrayN((size_t)totelem, typeInfo->size, "CD unshare layer");
+    if (typeInfo->copy) {
+      typeInfo->copy(layer->data, dst_data, totelem);
+    }
+    else {
+      memcpy(dst_data, layer->data, (size_t)totelem * typeInfo->size);
+    }
+    if (customdata_sharing_info_user_remove(info)) {
+      /* All other users were freed in the meantime, the copy was for nothing. */
+      const LayerTypeInfo *typeInfo_free = layerType_getInfo(layer->type);
+      if (typeInfo_free->free) {
+        typeInfo_free->free(layer->data, totelem, typeInfo_free->size);
+      }
+      MEM_freeN(layer->data);
+      MEM_freeN(info);
+    }
+    layer->data = dst_data;
+  }
+  layer->sharing_info = nullptr;
+  layer->flag &= ~CD_FLAG_NOFREE;
+}
+
+/** \} */
+
 void CustomData_update_typemap(CustomData *data)
 {
   int lasttype = -1;
@@ -2152,6 +2241,25 @@ bool CustomData_merge(const struct CustomData *source,
         BKE_anonymous_attribute_id_increment_weak(layer->anonymous_id);
         newlayer->anonymous_id = layer->anonymous_id;
       }
+
+      if (data != nullptr) {
+        /* Only run-time sharing state of the source layer is mutated here. */
+        CustomDataLayer *src_layer = const_cast<CustomDataLayer *>(layer);
+        if (alloctype == CD_REFERENCE || ((alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE))) {
+          LayerSharingInfo *sharing = customdata_sharing_info_ensure(src_layer);
+          if (sharing) {
+            customdata_sharing_info_user_add(sharing);
+            newlayer->sharing_info = sharing;
+          }
+          /* Otherwise the source itself only references the data (legacy #CD_FLAG_NOFREE),
+           * and the old lifetime rules apply to the new layer as well. */
+        }
+        else if (alloctype == CD_ASSIGN) {
+          /* Ownership of the data moves to the destination, any share moves along. */
+          newlayer->sharing_info = src_layer->sharing_info;
+          src_layer->sharing_info = nullptr;
+        }
+      }
     }
   }
 
@@ -2167,6 +2275,13 @@ void CustomData_realloc(CustomData *data, int totelem)
     if (layer->flag & CD_FLAG_NOFREE) {
       continue;
     }
+    if (layer->sharing_info != nullptr) {
+      /* Never reallocate in place while other layers still reference the data. The old element
+       * count isn't passed in here, but shared layers are always allocated to their exact size. */
+      typeInfo = layerType_getInfo(layer->type);
+      customdata_unshare_layer_data(layer,
+                                    (int)(MEM_allocN_len(layer->data) / typeInfo->size));
+    }
     typeInfo = layerType_getInfo(layer->type);
     /* Use calloc to avoid the need to manually initialize new data in layers.
      * Useful for types like #MDeformVert which contain a pointer. */
@@ -2197,16 +2312,27 @@ static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
     BKE_anonymous_attribute_id_decrement_weak(layer->anonymous_id);
     layer->anonymous_id = nullptr;
   }
-  if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
+  if (layer->sharing_info != nullptr) {
+    /* Shared data is freed together with its last user, regardless of which layer that is. */
+    LayerSharingInfo *info = static_cast<LayerSharingInfo *>(layer->sharing_info);
+    layer->sharing_info = nullptr;
+    if (!customdata_sharing_info_user_remove(info)) {
+      return;
+    }
+    MEM_freeN(info);
+    /* Fall through and free the data like an exclusive owner would. */
+  }
+  else if (layer->flag & CD_FLAG_NOFREE) {
+    return;
+  }
+  if (layer->data) {
     typeInfo = layerType_getInfo(layer->type);
 
     if (typeInfo->free) {
       typeInfo->free(layer->data, totelem, typeInfo->size);
     }
 
-    if (layer->data) {
-      MEM_freeN(layer->data);
-    }
+    MEM_freeN(layer->data);
   }
 }
 
@@ -2798,6 +2924,13 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
+  if (layer->sharing_info != nullptr) {
+    /* Counted reference: copies only when other users remain, a sole user just takes
+     * exclusive ownership of the data. */
+    customdata_unshare_layer_data(layer, totelem);
+    return layer->data;
+  }
+
   if (layer->flag & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
@@ -2816,6 +2949,7 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+    layer->sharing_info = nullptr;
   }
 
   return layer->data;
@@ -4244,7 +4378,10 @@ void CustomData_blend_write_prepare(CustomData *data,
         }
         write_layers_size += chunk_size;
       }
-      write_layers[j++] = *layer;
+      CustomDataLayer *write_layer = &write_layers[j++];
+      *write_layer = *layer;
+      /* Runtime data, don't let the raw pointer value end up in the file. */
+      write_layer->sharing_info = nullptr;
     }
   }
   BLI_assert(j == data->totlayer);
@@ -5164,6 +5301,10 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, int count)
 
     layer->flag &= ~CD_FLAG_NOFREE;
 
+    /* Runtime data, the value read from the file (or restored by memfile undo)
+     * is a stale pointer. */
+    layer->sharing_info = nullptr;
+
     if (CustomData_verify_versions(data, i)) {
       BLO_read_data_address(reader, &layer->data);
       if (layer->data == nullptr && count > 0 && layer->type == CD_PROP_BOOL) {
@@ -10,6 +10,7 @@
 #include <stdio.h>
 
 #include "BLI_blenlib.h"
+#include "BLI_ghash.h"
 #include "BLI_kdtree.h"
 #include "BLI_math.h"
 #include "BLI_string_utils.h"
@@ -199,6 +200,9 @@ typedef struct PaintBakeData {
   /** special temp data for post-p velocity based brushes like smudge
    * 3 float dir vec + 1 float str */
   float *brush_velocity;
+  /** world-space brush mesh copies with their cached BVH trees, keyed by brush object.
+   * kept between frames so an unchanged topology only needs a tree refit. */
+  struct GHash *brush_mesh_cache;
   /** copy of previous frame vertices. used to observe surface movement. */
   MVert *prev_verts;
   /** Previous frame object matrix. */
@@ -877,6 +881,11 @@ static void dynamicPaint_freeAdjData(PaintSurfaceData *data)
   }
 }
 
+static void brush_mesh_cache_value_free(void *val)
+{
+  BKE_id_free(NULL, (Mesh *)val);
+}
+
 static void free_bakeData(PaintSurfaceData *data)
 {
   PaintBakeData *bData = data->bData;
@@ -899,6 +908,9 @@ static void free_bakeData(PaintSurfaceData *data)
     if (bData->grid) {
       freeGrid(data);
     }
+    if (bData->brush_mesh_cache) {
+      BLI_ghash_free(bData->brush_mesh_cache, NULL, brush_mesh_cache_value_free);
+    }
     if (bData->prev_verts) {
       MEM_freeN(bData->prev_verts);
     }
@@ -4232,6 +4244,46 @@ static void dynamic_paint_paint_mesh_cell_point_cb_ex(
   }
 }
 
+/**
+ * Get a mutable copy of the evaluated brush mesh for world-space sampling, cached in
+ * \a bData between frames. While the brush topology is unchanged only the vertex
+ * coordinates are refreshed, so the BVH tree of a deforming brush can be refitted on the
+ * next lookup instead of being rebuilt from scratch every frame.
+ */
+static Mesh *dynamicPaint_brush_mesh_world_get(PaintBakeData *bData,
+                                               Object *brushOb,
+                                               Mesh *brush_mesh)
+{
+  if (bData->brush_mesh_cache == NULL) {
+    bData->brush_mesh_cache = BLI_ghash_ptr_new("dynamicPaint brush mesh cache");
+  }
+
+  Mesh *mesh = BLI_ghash_lookup(bData->brush_mesh_cache, brushOb);
+  if (mesh &&
+      (mesh->totvert != brush_mesh->totvert || mesh->totloop != brush_mesh->totloop ||
+       mesh->totpoly != brush_mesh->totpoly)) {
+    BLI_ghash_remove(bData->brush_mesh_cache, brushOb, NULL, brush_mesh_cache_value_free);
+    mesh = NULL;
+  }
+
+  if (mesh == NULL) {
+    mesh = BKE_mesh_copy_for_eval(brush_mesh, false);
+    BLI_ghash_insert(bData->brush_mesh_cache, brushOb, mesh);
+  }
+  else {
+    /* Refresh the object space coordinates, the caller transforms them to world space. */
+    for (int i = 0; i < mesh->totvert; i++) {
+      copy_v3_v3(mesh->mvert[i].co, brush_mesh->mvert[i].co);
+    }
+    BKE_mesh_normals_tag_dirty(mesh);
+    if (mesh->runtime.bvh_cache) {
+      bvhcache_tag_positions_changed(mesh->runtime.bvh_cache);
+    }
+  }
+
+  return mesh;
+}
+
 static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
                                    DynamicPaintSurface *surface,
                                    DynamicPaintBrushSettings *brush,
@@ -4266,7 +4318,7 @@ static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
     Bounds3D mesh_bb = {{0}};
     VolumeGrid *grid = bData->grid;
 
-    mesh = BKE_mesh_copy_for_eval(brush_mesh, false);
+    mesh = dynamicPaint_brush_mesh_world_get(bData, brushOb, brush_mesh);
     mvert = mesh->mvert;
     const float(*vert_normals)[3] = BKE_mesh_vertex_normals_ensure(mesh);
     mlooptri = BKE_mesh_runtime_looptri_ensure(mesh);
@@ -4342,9 +4394,8 @@ static bool dynamicPaint_paintMesh(Depsgraph *depsgraph,
         }
       }
     }
-    /* free bvh tree */
+    /* The tree is owned by the cached mesh and kept for the next frame. */
     free_bvhtree_from_mesh(&treeData);
-    BKE_id_free(NULL, mesh);
   }
 
   /* free brush velocity data */
@@ -73,6 +73,7 @@ void BKE_fcurve_free(FCurve *fcu)
 
   /* Free RNA-path, as this were allocated when getting the path string. */
   MEM_SAFE_FREE(fcu->rna_path);
+  MEM_SAFE_FREE(fcu->rna_path_resolved);
 
   /* Free extra data - i.e. modifiers, and driver. */
   fcurve_free_driver(fcu);
@@ -129,8 +130,10 @@ FCurve *BKE_fcurve_copy(const FCurve *fcu)
   fcu_d->bezt = MEM_dupallocN(fcu_d->bezt);
   fcu_d->fpt = MEM_dupallocN(fcu_d->fpt);
 
-  /* Copy rna-path. */
+  /* Copy rna-path. The cached resolution is only meaningful for the data the original curve
+   * belongs to, so the copy starts out without one. */
   fcu_d->rna_path = MEM_dupallocN(fcu_d->rna_path);
+  fcu_d->rna_path_resolved = NULL;
 
   /* Copy driver. */
   fcu_d->driver = fcurve_copy_driver(fcu_d->driver);
@@ -1709,18 +1712,53 @@ static float fcurve_eval_keyframes_extrapolate(
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
+/**
+ * Try to find the keyframe segment for \a evaltime using the index cached from the previous
+ * evaluation. Sequential playback almost always stays in the same segment (or moves on to the
+ * next one), which makes the lookup constant time instead of a binary search over all keyframes.
+ *
+ * \return the index of the keyframe that \a evaltime occurs before, matching the semantics of
+ * #BKE_fcurve_bezt_binarysearch_index_ex, or -1 when the cached index gives no answer.
+ */
+static int fcurve_eval_keyframes_index_seeded(const FCurve *fcu,
+                                              const BezTriple *bezts,
+                                              const float evaltime,
+                                              const float threshold,
+                                              bool *r_exact)
+{
+  /* The caller already handled evaluation times outside of the keyframe range, so only the
+   * interior segments need to be considered here. */
+  for (int offset = 0; offset <= 1; offset++) {
+    const int a = fcu->last_eval_index + offset;
+    if ((a < 1) || (a >= (int)fcu->totvert)) {
+      continue;
+    }
+    if (IS_EQT(evaltime, bezts[a].vec[1][0], threshold)) {
+      *r_exact = true;
+      return a;
+    }
+    if (IS_EQT(evaltime, bezts[a - 1].vec[1][0], threshold)) {
+      *r_exact = true;
+      return a - 1;
+    }
+    if ((bezts[a - 1].vec[1][0] < evaltime) && (evaltime < bezts[a].vec[1][0])) {
+      *r_exact = false;
+      return a;
+    }
+  }
+  return -1;
+}
+
 static float fcurve_eval_keyframes_interpolate(FCurve *fcu, BezTriple *bezts, float evaltime)
 {
   const float eps = 1.e-8f;
   BezTriple *bezt, *prevbezt;
-  unsigned int a;
+  int a;
 
   /* Evaltime occurs somewhere in the middle of the curve. */
   bool exact = false;
 
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
+  /* The keyframe search threshold has the following constraints:
    * - 0.001 is too coarse:
    *   We get artifacts with 2cm driver movements at 1BU = 1m (see T40332).
    *
@@ -1728,7 +1766,12 @@ static float fcurve_eval_keyframes_interpolate(FCurve *fcu, BezTriple *bezts, fl
    *   Weird errors, like selecting the wrong keyframe range (see T39207), occur.
    *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
    */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  a = fcurve_eval_keyframes_index_seeded(fcu, bezts, evaltime, 0.0001, &exact);
+  if (a < 0) {
+    /* The cached index did not match, use binary search to find appropriate keyframes. */
+    a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  }
+  fcu->last_eval_index = a;
   bezt = bezts + a;
 
   if (exact) {
@@ -2323,8 +2366,9 @@ void BKE_fcurve_blend_read_data(BlendDataReader *reader, ListBase *fcurves)
     BLO_read_data_address(reader, &fcu->bezt);
     BLO_read_data_address(reader, &fcu->fpt);
 
-    /* rna path */
+    /* rna path (the runtime cache of its resolution is never valid on file read) */
     BLO_read_data_address(reader, &fcu->rna_path);
+    fcu->rna_path_resolved = NULL;
 
     /* group */
     BLO_read_data_address(reader, &fcu->grp);
@@ -82,6 +82,31 @@ void InstancesComponent::add_instance(const int instance_handle, const float4x4
   attributes_.reallocate(this->instances_amount());
 }
 
+void InstancesComponent::add_instances_from(const InstancesComponent &src_component)
+{
+  using namespace blender;
+
+  const Span<InstanceReference> src_references = src_component.references();
+  Array<int> handle_map(src_references.size());
+  for (const int src_handle : src_references.index_range()) {
+    handle_map[src_handle] = this->add_reference(src_references[src_handle]);
+  }
+
+  const Span<int> src_handles = src_component.instance_reference_handles();
+  const Span<float4x4> src_transforms = src_component.instance_transforms();
+  const int start = this->instances_amount();
+  this->resize(start + src_transforms.size());
+
+  MutableSpan<int> all_handles = this->instance_reference_handles();
+  MutableSpan<float4x4> all_transforms = this->instance_transforms();
+  threading::parallel_for(src_transforms.index_range(), 2048, [&](IndexRange range) {
+    for (const int i : range) {
+      all_handles[start + i] = handle_map[src_handles[i]];
+      all_transforms[start + i] = src_transforms[i];
+    }
+  });
+}
+
 blender::Span<int> InstancesComponent::instance_reference_handles() const
 {
   return instance_reference_handles_;
@@ -198,12 +198,16 @@ static void adapt_mesh_domain_corner_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int loop_index : IndexRange(mesh.totloop)) {
-    const T value = old_values[loop_index];
-    const MLoop &loop = mesh.mloop[loop_index];
-    const int point_index = loop.v;
-    mixer.mix_in(point_index, value);
-  }
+  /* Devirtualize the input, so the gather loop works on a contiguous span in the common case
+   * (attribute layers), where it can be vectorized by the compiler. */
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int loop_index : IndexRange(mesh.totloop)) {
+      const T value = old_values[loop_index];
+      const MLoop &loop = mesh.mloop[loop_index];
+      const int point_index = loop.v;
+      mixer.mix_in(point_index, value);
+    }
+  });
   mixer.finalize();
 }
 
@@ -217,15 +221,17 @@ void adapt_mesh_domain_corner_to_point_impl(const Mesh &mesh,
   Array<bool> loose_verts(mesh.totvert, true);
 
   r_values.fill(true);
-  for (const int loop_index : IndexRange(mesh.totloop)) {
-    const MLoop &loop = mesh.mloop[loop_index];
-    const int point_index = loop.v;
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int loop_index : IndexRange(mesh.totloop)) {
+      const MLoop &loop = mesh.mloop[loop_index];
+      const int point_index = loop.v;
 
-    loose_verts[point_index] = false;
-    if (!old_values[loop_index]) {
-      r_values[point_index] = false;
+      loose_verts[point_index] = false;
+      if (!old_values[loop_index]) {
+        r_values[point_index] = false;
+      }
     }
-  }
+  });
 
   /* Deselect loose vertices without corners that are still selected from the 'true' default. */
   for (const int vert_index : IndexRange(mesh.totvert)) {
@@ -314,18 +320,20 @@ static void adapt_mesh_domain_corner_to_edge_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totedge);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
 
-    /* For every edge, mix values from the two adjacent corners (the current and next corner). */
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const int loop_index_next = (loop_index + 1) % poly.totloop;
-      const MLoop &loop = mesh.mloop[loop_index];
-      const int edge_index = loop.e;
-      mixer.mix_in(edge_index, old_values[loop_index]);
-      mixer.mix_in(edge_index, old_values[loop_index_next]);
+      /* For every edge, mix values from the two adjacent corners (the current and next corner). */
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const int loop_index_next = (loop_index + 1) % poly.totloop;
+        const MLoop &loop = mesh.mloop[loop_index];
+        const int edge_index = loop.e;
+        mixer.mix_in(edge_index, old_values[loop_index]);
+        mixer.mix_in(edge_index, old_values[loop_index_next]);
+      }
     }
-  }
+  });
 
   mixer.finalize();
 }
@@ -342,20 +350,23 @@ void adapt_mesh_domain_corner_to_edge_impl(const Mesh &mesh,
   Array<bool> loose_edges(mesh.totedge, true);
 
   r_values.fill(true);
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
 
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const int loop_index_next = (loop_index == poly.totloop) ? poly.loopstart : (loop_index + 1);
-      const MLoop &loop = mesh.mloop[loop_index];
-      const int edge_index = loop.e;
-      loose_edges[edge_index] = false;
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const int loop_index_next = (loop_index == poly.totloop) ? poly.loopstart :
+                                                                   (loop_index + 1);
+        const MLoop &loop = mesh.mloop[loop_index];
+        const int edge_index = loop.e;
+        loose_edges[edge_index] = false;
 
-      if (!old_values[loop_index] || !old_values[loop_index_next]) {
-        r_values[edge_index] = false;
+        if (!old_values[loop_index] || !old_values[loop_index_next]) {
+          r_values[edge_index] = false;
+        }
       }
     }
-  }
+  });
 
   /* Deselect loose edges without corners that are still selected from the 'true' default. */
   threading::parallel_for(IndexRange(mesh.totedge), 2048, [&](const IndexRange range) {
@@ -389,15 +400,17 @@ void adapt_mesh_domain_face_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
-    const T value = old_values[poly_index];
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const MLoop &loop = mesh.mloop[loop_index];
-      const int point_index = loop.v;
-      mixer.mix_in(point_index, value);
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
+      const T value = old_values[poly_index];
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const MLoop &loop = mesh.mloop[loop_index];
+        const int point_index = loop.v;
+        mixer.mix_in(point_index, value);
+      }
     }
-  }
+  });
 
   mixer.finalize();
 }
@@ -411,16 +424,18 @@ void adapt_mesh_domain_face_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
 
   r_values.fill(false);
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
-    if (old_values[poly_index]) {
-      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-        const MLoop &loop = mesh.mloop[loop_index];
-        const int vert_index = loop.v;
-        r_values[vert_index] = true;
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
+      if (old_values[poly_index]) {
+        for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+          const MLoop &loop = mesh.mloop[loop_index];
+          const int vert_index = loop.v;
+          r_values[vert_index] = true;
+        }
       }
     }
-  }
+  });
 }
 
 static GVArray adapt_mesh_domain_face_to_point(const Mesh &mesh, const GVArray &varray)
@@ -445,12 +460,14 @@ void adapt_mesh_domain_face_to_corner_impl(const Mesh &mesh,
 {
   BLI_assert(r_values.size() == mesh.totloop);
 
-  threading::parallel_for(IndexRange(mesh.totpoly), 1024, [&](const IndexRange range) {
-    for (const int poly_index : range) {
-      const MPoly &poly = mesh.mpoly[poly_index];
-      MutableSpan<T> poly_corner_values = r_values.slice(poly.loopstart, poly.totloop);
-      poly_corner_values.fill(old_values[poly_index]);
-    }
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    threading::parallel_for(IndexRange(mesh.totpoly), 1024, [&](const IndexRange range) {
+      for (const int poly_index : range) {
+        const MPoly &poly = mesh.mpoly[poly_index];
+        MutableSpan<T> poly_corner_values = r_values.slice(poly.loopstart, poly.totloop);
+        poly_corner_values.fill(old_values[poly_index]);
+      }
+    });
   });
 }
 
@@ -476,14 +493,16 @@ void adapt_mesh_domain_face_to_edge_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totedge);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
-    const T value = old_values[poly_index];
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const MLoop &loop = mesh.mloop[loop_index];
-      mixer.mix_in(loop.e, value);
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
+      const T value = old_values[poly_index];
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const MLoop &loop = mesh.mloop[loop_index];
+        mixer.mix_in(loop.e, value);
+      }
     }
-  }
+  });
   mixer.finalize();
 }
 
@@ -496,16 +515,18 @@ void adapt_mesh_domain_face_to_edge_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totedge);
 
   r_values.fill(false);
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
-    if (old_values[poly_index]) {
-      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-        const MLoop &loop = mesh.mloop[loop_index];
-        const int edge_index = loop.e;
-        r_values[edge_index] = true;
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
+      if (old_values[poly_index]) {
+        for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+          const MLoop &loop = mesh.mloop[loop_index];
+          const int edge_index = loop.e;
+          r_values[edge_index] = true;
+        }
       }
     }
-  }
+  });
 }
 
 static GVArray adapt_mesh_domain_face_to_edge(const Mesh &mesh, const GVArray &varray)
@@ -601,18 +622,20 @@ void adapt_mesh_domain_edge_to_corner_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totloop);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
 
-    /* For every corner, mix the values from the adjacent edges on the face. */
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const int loop_index_prev = loop_index - 1 + (loop_index == poly.loopstart) * poly.totloop;
-      const MLoop &loop = mesh.mloop[loop_index];
-      const MLoop &loop_prev = mesh.mloop[loop_index_prev];
-      mixer.mix_in(loop_index, old_values[loop.e]);
-      mixer.mix_in(loop_index, old_values[loop_prev.e]);
+      /* For every corner, mix the values from the adjacent edges on the face. */
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const int loop_index_prev = loop_index - 1 + (loop_index == poly.loopstart) * poly.totloop;
+        const MLoop &loop = mesh.mloop[loop_index];
+        const MLoop &loop_prev = mesh.mloop[loop_index_prev];
+        mixer.mix_in(loop_index, old_values[loop.e]);
+        mixer.mix_in(loop_index, old_values[loop_prev.e]);
+      }
     }
-  }
+  });
 
   mixer.finalize();
 }
@@ -627,17 +650,19 @@ void adapt_mesh_domain_edge_to_corner_impl(const Mesh &mesh,
 
   r_values.fill(false);
 
-  for (const int poly_index : IndexRange(mesh.totpoly)) {
-    const MPoly &poly = mesh.mpoly[poly_index];
-    for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const int loop_index_prev = loop_index - 1 + (loop_index == poly.loopstart) * poly.totloop;
-      const MLoop &loop = mesh.mloop[loop_index];
-      const MLoop &loop_prev = mesh.mloop[loop_index_prev];
-      if (old_values[loop.e] && old_values[loop_prev.e]) {
-        r_values[loop_index] = true;
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int poly_index : IndexRange(mesh.totpoly)) {
+      const MPoly &poly = mesh.mpoly[poly_index];
+      for (const int loop_index : IndexRange(poly.loopstart, poly.totloop)) {
+        const int loop_index_prev = loop_index - 1 + (loop_index == poly.loopstart) * poly.totloop;
+        const MLoop &loop = mesh.mloop[loop_index];
+        const MLoop &loop_prev = mesh.mloop[loop_index_prev];
+        if (old_values[loop.e] && old_values[loop_prev.e]) {
+          r_values[loop_index] = true;
+        }
       }
     }
-  }
+  });
 }
 
 static GVArray adapt_mesh_domain_edge_to_corner(const Mesh &mesh, const GVArray &varray)
@@ -662,12 +687,14 @@ static void adapt_mesh_domain_edge_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
-  for (const int edge_index : IndexRange(mesh.totedge)) {
-    const MEdge &edge = mesh.medge[edge_index];
-    const T value = old_values[edge_index];
-    mixer.mix_in(edge.v1, value);
-    mixer.mix_in(edge.v2, value);
-  }
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int edge_index : IndexRange(mesh.totedge)) {
+      const MEdge &edge = mesh.medge[edge_index];
+      const T value = old_values[edge_index];
+      mixer.mix_in(edge.v1, value);
+      mixer.mix_in(edge.v2, value);
+    }
+  });
 
   mixer.finalize();
 }
@@ -681,13 +708,15 @@ void adapt_mesh_domain_edge_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
 
   r_values.fill(false);
-  for (const int edge_index : IndexRange(mesh.totedge)) {
-    const MEdge &edge = mesh.medge[edge_index];
-    if (old_values[edge_index]) {
-      r_values[edge.v1] = true;
-      r_values[edge.v2] = true;
+  devirtualize_varray(old_values, [&](const auto old_values) {
+    for (const int edge_index : IndexRange(mesh.totedge)) {
+      const MEdge &edge = mesh.medge[edge_index];
+      if (old_values[edge_index]) {
+        r_values[edge.v1] = true;
+        r_values[edge.v2] = true;
+      }
     }
-  }
+  });
 }
 
 static GVArray adapt_mesh_domain_edge_to_point(const Mesh &mesh, const GVArray &varray)
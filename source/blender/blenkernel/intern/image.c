@@ -121,10 +121,20 @@ static void image_runtime_reset_on_copy(struct Image *image)
 
   image->runtime.partial_update_register = NULL;
   image->runtime.partial_update_user = NULL;
+
+  image->runtime.prefetch_pool = NULL;
+  image->runtime.prefetch_last_frame = 0;
 }
 
 static void image_runtime_free_data(struct Image *image)
 {
+  /* Cancel before ending the cache mutex, prefetch tasks lock it. */
+  if (image->runtime.prefetch_pool != NULL) {
+    BLI_task_pool_cancel(image->runtime.prefetch_pool);
+    BLI_task_pool_free(image->runtime.prefetch_pool);
+    image->runtime.prefetch_pool = NULL;
+  }
+
   BLI_mutex_end(image->runtime.cache_mutex);
   MEM_freeN(image->runtime.cache_mutex);
   image->runtime.cache_mutex = NULL;
@@ -4541,6 +4551,108 @@ static int image_num_files(Image *ima)
   return BLI_listbase_count(&ima->views);
 }
 
+/* ********************* Sequence frame prefetching ************************* */
+
+/** Number of upcoming frames decoded ahead of the current one during playback. */
+#define IMA_SEQUENCE_PREFETCH_COUNT 4
+
+static void image_sequence_prefetch_task(TaskPool *__restrict pool, void *taskdata)
+{
+  Image *ima = BLI_task_pool_user_data(pool);
+  const int framenr = POINTER_AS_INT(taskdata);
+  const int index = IMA_MAKE_INDEX(framenr, 0);
+  bool is_cached_empty = false;
+
+  /* The frame may have been loaded by the main thread in the meantime. */
+  BLI_mutex_lock(ima->runtime.cache_mutex);
+  ImBuf *ibuf = imagecache_get(ima, index, &is_cached_empty);
+  BLI_mutex_unlock(ima->runtime.cache_mutex);
+
+  if (ibuf != NULL || is_cached_empty) {
+    IMB_freeImBuf(ibuf);
+    return;
+  }
+
+  /* Decode without holding the cache mutex, this is where the time goes.
+   * Matches the flags of #load_sequence_single, without IB_multilayer since
+   * multi-layer images are kept out of prefetching entirely. */
+  ImageUser iuser = {0};
+  iuser.framenr = framenr;
+
+  char filepath[FILE_MAX];
+  BKE_image_user_file_path(&iuser, ima, filepath);
+
+  /* Don't pass the image's own name buffer, loaders write the effective
+   * colorspace back into it. */
+  char colorspace[IM_MAX_SPACE];
+  BLI_strncpy(colorspace, ima->colorspace_settings.name, sizeof(colorspace));
+
+  ibuf = IMB_loadiffname(
+      filepath, IB_rect | IB_metadata | imbuf_alpha_flags_for_image(ima), colorspace);
+  if (ibuf == NULL) {
+    return;
+  }
+
+  BLI_mutex_lock(ima->runtime.cache_mutex);
+  ImBuf *existing = imagecache_get(ima, index, &is_cached_empty);
+  if (existing == NULL && !is_cached_empty) {
+    imagecache_put(ima, index, ibuf);
+  }
+  BLI_mutex_unlock(ima->runtime.cache_mutex);
+
+  IMB_freeImBuf(existing);
+  IMB_freeImBuf(ibuf);
+}
+
+/**
+ * Schedule background decode of the frames following \a cfra into the image cache, so
+ * playback doesn't stall on sequential decode of every frame. The #MovieCache behind
+ * the image provides the eviction policy, effectively turning it into a ring buffer
+ * limited by the cache memory limit.
+ */
+static void image_sequence_prefetch(Image *ima, const ImageUser *iuser, int cfra)
+{
+  /* Multi-layer and multi-view loading mutates image state, keep those on the main thread. */
+  if (ima->type != IMA_TYPE_IMAGE || BKE_image_is_multiview(ima)) {
+    return;
+  }
+
+  BLI_mutex_lock(ima->runtime.cache_mutex);
+
+  /* Multiple users of the image may evaluate for the same frame, only schedule once. */
+  if (ima->runtime.prefetch_last_frame == iuser->framenr) {
+    BLI_mutex_unlock(ima->runtime.cache_mutex);
+    return;
+  }
+  ima->runtime.prefetch_last_frame = iuser->framenr;
+
+  for (int i = 1; i <= IMA_SEQUENCE_PREFETCH_COUNT; i++) {
+    bool is_in_range;
+    const int framenr = BKE_image_user_frame_get(iuser, cfra + i, &is_in_range);
+    if (!is_in_range || framenr == iuser->framenr) {
+      continue;
+    }
+
+    bool is_cached_empty = false;
+    ImBuf *ibuf = imagecache_get(ima, IMA_MAKE_INDEX(framenr, 0), &is_cached_empty);
+    if (ibuf != NULL || is_cached_empty) {
+      IMB_freeImBuf(ibuf);
+      continue;
+    }
+
+    if (ima->runtime.prefetch_pool == NULL) {
+      ima->runtime.prefetch_pool = BLI_task_pool_create_background(ima, TASK_PRIORITY_LOW);
+    }
+    BLI_task_pool_push(ima->runtime.prefetch_pool,
+                       image_sequence_prefetch_task,
+                       POINTER_FROM_INT(framenr),
+                       false,
+                       NULL);
+  }
+
+  BLI_mutex_unlock(ima->runtime.cache_mutex);
+}
+
 static ImBuf *load_sequence_single(
     Image *ima, ImageUser *iuser, int frame, const int view_id, bool *r_cache_ibuf)
 {
@@ -5791,6 +5903,13 @@ static void image_user_id_eval_animation(Image *ima,
       float cfra = DEG_get_ctime(depsgraph);
 
       BKE_image_user_frame_calc(ima, iuser, cfra);
+
+      /* Warm the cache with upcoming frames so viewport playback doesn't stall
+       * on decoding every frame on demand. Renders evaluate one frame at a time
+       * and manage memory more carefully, leave them alone. */
+      if (ima->source == IMA_SRC_SEQUENCE && DEG_get_mode(depsgraph) != DAG_EVAL_RENDER) {
+        image_sequence_prefetch(ima, iuser, (int)cfra);
+      }
     }
   }
 }
@@ -1910,6 +1910,26 @@ void BKE_keyblock_copy_settings(KeyBlock *kb_dst, const KeyBlock *kb_src)
   kb_dst->slidermax = kb_src->slidermax;
 }
 
+void BKE_key_copy_parameters(Key *key_dst, const Key *key_src)
+{
+  key_dst->type = key_src->type;
+  key_dst->flag = key_src->flag;
+  key_dst->ctime = key_src->ctime;
+
+  /* Changes to the key block list itself go through a full copy of the datablock, so both lists
+   * are expected to match here. */
+  KeyBlock *kb_dst = key_dst->block.first;
+  const KeyBlock *kb_src = key_src->block.first;
+  while (kb_dst != NULL && kb_src != NULL) {
+    BKE_keyblock_copy_settings(kb_dst, kb_src);
+    kb_dst->flag = kb_src->flag;
+    BLI_strncpy(kb_dst->name, kb_src->name, sizeof(kb_dst->name));
+    kb_dst = kb_dst->next;
+    kb_src = kb_src->next;
+  }
+  BLI_assert(kb_dst == NULL && kb_src == NULL);
+}
+
 char *BKE_keyblock_curval_rnapath_get(Key *key, KeyBlock *kb)
 {
   PointerRNA ptr;
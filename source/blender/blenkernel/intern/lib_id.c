@@ -1039,7 +1039,11 @@ void *BKE_libblock_alloc_notest(short type)
   const char *name;
   size_t size = BKE_libblock_get_alloc_info(type, &name);
   if (size != 0) {
-    return MEM_callocN(size, name);
+    /* Attribute the allocation to the ID type, see #MEM_scope_usage_foreach. */
+    MEM_scope_push(name);
+    ID *id = MEM_callocN(size, name);
+    MEM_scope_pop();
+    return id;
   }
   BLI_assert_msg(0, "Request to allocate unknown data type");
   return NULL;
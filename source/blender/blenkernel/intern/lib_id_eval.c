@@ -8,10 +8,12 @@
  */
 
 #include "DNA_ID.h"
+#include "DNA_key_types.h"
 #include "DNA_mesh_types.h"
 
 #include "BLI_utildefines.h"
 
+#include "BKE_key.h"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
 
@@ -23,6 +25,9 @@ void BKE_id_eval_properties_copy(ID *id_cow, ID *id)
   if (id_type == ID_ME) {
     BKE_mesh_copy_parameters((Mesh *)id_cow, (const Mesh *)id);
   }
+  else if (id_type == ID_KE) {
+    BKE_key_copy_parameters((Key *)id_cow, (const Key *)id);
+  }
   else {
     BLI_assert_unreachable();
   }
@@ -545,13 +545,13 @@ static bool lib_override_hierarchy_dependencies_recursive_tag(LibOverrideGroupTa
   MainIDRelationsEntry *entry = BLI_ghash_lookup(bmain->relations->relations_from_pointers, id);
   BLI_assert(entry != NULL);
 
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     /* This ID has already been processed. */
     return (*(uint *)&id->tag & data->tag) != 0;
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != NULL;
        to_id_entry = to_id_entry->next) {
@@ -591,13 +591,13 @@ static void lib_override_linked_group_tag_recursive(LibOverrideGroupTagData *dat
                                                  id_owner);
   BLI_assert(entry != NULL);
 
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     /* This ID has already been processed. */
     return;
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != NULL;
        to_id_entry = to_id_entry->next) {
@@ -810,13 +810,13 @@ static void lib_override_overrides_group_tag_recursive(LibOverrideGroupTagData *
                                                  id_owner);
   BLI_assert(entry != NULL);
 
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     /* This ID has already been processed. */
     return;
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != NULL;
        to_id_entry = to_id_entry->next) {
@@ -1109,7 +1109,7 @@ static ID *lib_override_root_find(Main *bmain, ID *id, const int curr_level, int
   MainIDRelationsEntry *entry = BLI_ghash_lookup(bmain->relations->relations_from_pointers, id);
   BLI_assert(entry != NULL);
 
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     if (ID_IS_OVERRIDE_LIBRARY_REAL(id)) {
       /* This ID has already been processed. */
       *r_best_level = curr_level;
@@ -1124,7 +1124,7 @@ static ID *lib_override_root_find(Main *bmain, ID *id, const int curr_level, int
   }
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   int best_level_candidate = curr_level;
   ID *best_root_id_candidate = id;
@@ -1847,14 +1847,14 @@ static bool lib_override_resync_tagging_finalize_recurse(
   MainIDRelationsEntry *entry = BLI_ghash_lookup(bmain->relations->relations_from_pointers, id);
   BLI_assert(entry != NULL);
 
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     /* This ID has already been processed. */
     return (ID_IS_OVERRIDE_LIBRARY(id) && (id->tag & LIB_TAG_LIB_OVERRIDE_NEED_RESYNC) != 0);
   }
 
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   /* There can be dependency loops in relationships, e.g.:
    *   - Rig object uses armature ID.
@@ -3044,7 +3044,7 @@ static void lib_override_library_id_hierarchy_recursive_reset(Main *bmain, ID *i
   }
 
   MainIDRelationsEntry *entry = *entry_vp;
-  if (entry->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) {
+  if (BKE_main_relations_entry_tag_test(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     /* This ID has already been processed. */
     return;
   }
@@ -3053,7 +3053,7 @@ static void lib_override_library_id_hierarchy_recursive_reset(Main *bmain, ID *i
 
   /* This way we won't process again that ID, should we encounter it again through another
    * relationship hierarchy. */
-  entry->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, entry, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   for (MainIDRelationsEntryItem *to_id_entry = entry->to_ids; to_id_entry != NULL;
        to_id_entry = to_id_entry->next) {
@@ -662,10 +662,11 @@ static void lib_query_unused_ids_tag_recurse(Main *bmain,
 
   MainIDRelationsEntry *id_relations = BLI_ghash_lookup(bmain->relations->relations_from_pointers,
                                                         id);
-  if ((id_relations->tags & MAINIDRELATIONS_ENTRY_TAGS_PROCESSED) != 0) {
+  if (BKE_main_relations_entry_tag_test(
+          bmain, id_relations, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED)) {
     return;
   }
-  id_relations->tags |= MAINIDRELATIONS_ENTRY_TAGS_PROCESSED;
+  BKE_main_relations_entry_tag_add(bmain, id_relations, MAINIDRELATIONS_ENTRY_TAGS_PROCESSED);
 
   if ((id->tag & tag) != 0) {
     return;
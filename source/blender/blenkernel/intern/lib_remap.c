@@ -8,6 +8,7 @@
 
 #include "CLG_log.h"
 
+#include "BLI_ghash.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_collection_types.h"
@@ -16,6 +17,7 @@
 #include "BKE_armature.h"
 #include "BKE_collection.h"
 #include "BKE_curve.h"
+#include "BKE_idtype.h"
 #include "BKE_layer.h"
 #include "BKE_lib_id.h"
 #include "BKE_lib_query.h"
@@ -119,6 +121,13 @@ static void foreach_libblock_remap_callback_apply(ID *id_owner,
    * pointer otherwise the incorrect users are decreased and increased on the same instance. */
   ID *new_id = violates_never_null ? NULL : *id_ptr;
 
+  /* Keep the cached Main relations usable across several remap calls: the new target gains a
+   * user here. Usages of the old ID merely become stale, which lookups can afford, a missing
+   * usage of the new ID would not be (see #BKE_main_relations_id_usage_add). */
+  if (new_id != NULL && id_remap_data->bmain->relations != NULL) {
+    BKE_main_relations_id_usage_add(id_remap_data->bmain, id_self, id_ptr, cb_flag);
+  }
+
   if (cb_flag & IDWALK_CB_USER) {
     /* NOTE: by default we don't user-count IDs which are not in the main database.
      * This is because in certain conditions we can have data-blocks in
@@ -421,6 +430,35 @@ static void libblock_remap_data_update_tags(ID *old_id, ID *new_id, void *user_d
   }
 }
 
+typedef struct LibblockRemapGatherUsersData {
+  Main *bmain;
+  /** Set of IDs (actual users of any remapped source ID) that need to be processed. */
+  GSet *remapped_users;
+} LibblockRemapGatherUsersData;
+
+static void libblock_remap_data_gather_users_cb(ID *old_id, ID *UNUSED(new_id), void *user_data)
+{
+  LibblockRemapGatherUsersData *data = user_data;
+  MainIDRelationsEntry *entry = BLI_ghash_lookup(data->bmain->relations->relations_from_pointers,
+                                                 old_id);
+  if (entry == NULL) {
+    return;
+  }
+
+  for (MainIDRelationsEntryItem *from_item = entry->from_ids; from_item != NULL;
+       from_item = from_item->next) {
+    ID *id_user = from_item->id_pointer.from;
+    if ((id_user->flag & LIB_EMBEDDED_DATA) != 0) {
+      /* Directly 'by-pass' to the actual real ID owner, embedded IDs are processed as part of
+       * their owner by the foreach code. */
+      const IDTypeInfo *type_info_user = BKE_idtype_get_info_from_id(id_user);
+      BLI_assert(type_info_user->owner_get != NULL);
+      id_user = type_info_user->owner_get(data->bmain, id_user);
+    }
+    BLI_gset_add(data->remapped_users, id_user);
+  }
+}
+
 static void libblock_remap_reset_remapping_status_callback(ID *old_id,
                                                            ID *UNUSED(new_id),
                                                            void *UNUSED(user_data))
@@ -479,6 +517,31 @@ static void libblock_remap_data(Main *bmain,
     BKE_library_foreach_ID_link(
         NULL, id, foreach_libblock_remap_callback, &id_remap_data, foreach_id_flags);
   }
+  else if (bmain->relations != NULL &&
+           (remap_flags & ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS) == 0) {
+    /* When the caller maintains cached relations on Main, only process the actual users of the
+     * remapped IDs instead of walking the whole database. This turns batches of remap calls
+     * (relocating a whole library e.g.) from 'O(all IDs)' each into 'O(actual users)' each.
+     * Internal runtime pointers are not part of those relations, so that case still requires the
+     * full walk below. */
+    LibblockRemapGatherUsersData users_data;
+    users_data.bmain = bmain;
+    users_data.remapped_users = BLI_gset_ptr_new(__func__);
+
+    BKE_id_remapper_iter(id_remapper, libblock_remap_data_gather_users_cb, &users_data);
+
+    GSetIterator gset_iter;
+    GSET_ITER (gset_iter, users_data.remapped_users) {
+      ID *id_curr = BLI_gsetIterator_getKey(&gset_iter);
+
+      id_remap_data.id_owner = id_curr;
+      libblock_remap_data_preprocess(id_remap_data.id_owner, remap_type, id_remapper);
+      BKE_library_foreach_ID_link(
+          NULL, id_curr, foreach_libblock_remap_callback, &id_remap_data, foreach_id_flags);
+    }
+
+    BLI_gset_free(users_data.remapped_users, NULL);
+  }
   else {
     /* Note that this is a very 'brute force' approach,
      * maybe we could use some depsgraph to only process objects actually using given old_id...
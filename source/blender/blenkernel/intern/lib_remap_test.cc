@@ -351,4 +351,38 @@ TEST(lib_remap, never_null_usage_flag_requested_on_remap)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Cached Main Relations
+ * \{ */
+
+TEST(lib_remap, users_only_walked_when_relations_cached)
+{
+  Context<MeshObjectTestData> context;
+  Mesh *other_mesh = BKE_mesh_add(context.test_data.bmain, nullptr);
+
+  EXPECT_NE(context.test_data.object, nullptr);
+  EXPECT_EQ(context.test_data.object->data, context.test_data.mesh);
+
+  BKE_main_relations_create(context.test_data.bmain, 0);
+
+  BKE_libblock_remap(
+      context.test_data.bmain, context.test_data.mesh, other_mesh, ID_REMAP_SKIP_NEVER_NULL_USAGE);
+  EXPECT_EQ(context.test_data.object->data, other_mesh);
+  EXPECT_EQ(other_mesh->id.us, 1);
+
+  /* The relations must have been kept usable by the remapping: remapping the new target again
+   * must still find its (just relinked) user. */
+  BKE_libblock_remap(context.test_data.bmain,
+                     other_mesh,
+                     context.test_data.mesh,
+                     ID_REMAP_SKIP_NEVER_NULL_USAGE);
+  EXPECT_EQ(context.test_data.object->data, context.test_data.mesh);
+  EXPECT_EQ(context.test_data.mesh->id.us, 1);
+  EXPECT_EQ(other_mesh->id.us, 0);
+
+  BKE_main_relations_free(context.test_data.bmain);
+}
+
+/** \} */
+
 }  // namespace blender::bke::tests
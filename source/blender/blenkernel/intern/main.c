@@ -209,6 +209,51 @@ void BKE_main_unlock(struct Main *bmain)
   BLI_spin_unlock((SpinLock *)bmain->lock);
 }
 
+static void main_relations_usage_add(MainIDRelations *bmain_relations,
+                                     ID *id_self,
+                                     ID **id_pointer,
+                                     const int cb_flag)
+{
+  MainIDRelationsEntry **entry_p;
+
+  /* Add `id_pointer` as child of `id_self`. */
+  {
+    if (!BLI_ghash_ensure_p(bmain_relations->relations_from_pointers, id_self, (void ***)&entry_p)) {
+      *entry_p = MEM_callocN(sizeof(**entry_p), __func__);
+      (*entry_p)->session_uuid = id_self->session_uuid;
+    }
+    else {
+      BLI_assert((*entry_p)->session_uuid == id_self->session_uuid);
+    }
+    MainIDRelationsEntryItem *to_id_entry = BLI_mempool_alloc(bmain_relations->entry_items_pool);
+    to_id_entry->next = (*entry_p)->to_ids;
+    to_id_entry->id_pointer.to = id_pointer;
+    to_id_entry->session_uuid = (*id_pointer != NULL) ? (*id_pointer)->session_uuid :
+                                                        MAIN_ID_SESSION_UUID_UNSET;
+    to_id_entry->usage_flag = cb_flag;
+    (*entry_p)->to_ids = to_id_entry;
+  }
+
+  /* Add `id_self` as parent of `id_pointer`. */
+  if (*id_pointer != NULL) {
+    if (!BLI_ghash_ensure_p(
+            bmain_relations->relations_from_pointers, *id_pointer, (void ***)&entry_p)) {
+      *entry_p = MEM_callocN(sizeof(**entry_p), __func__);
+      (*entry_p)->session_uuid = (*id_pointer)->session_uuid;
+    }
+    else {
+      BLI_assert((*entry_p)->session_uuid == (*id_pointer)->session_uuid);
+    }
+    MainIDRelationsEntryItem *from_id_entry = BLI_mempool_alloc(
+        bmain_relations->entry_items_pool);
+    from_id_entry->next = (*entry_p)->from_ids;
+    from_id_entry->id_pointer.from = id_self;
+    from_id_entry->session_uuid = id_self->session_uuid;
+    from_id_entry->usage_flag = cb_flag;
+    (*entry_p)->from_ids = from_id_entry;
+  }
+}
+
 static int main_relations_create_idlink_cb(LibraryIDLinkCallbackData *cb_data)
 {
   MainIDRelations *bmain_relations = cb_data->user_data;
@@ -217,45 +262,7 @@ static int main_relations_create_idlink_cb(LibraryIDLinkCallbackData *cb_data)
   const int cb_flag = cb_data->cb_flag;
 
   if (*id_pointer) {
-    MainIDRelationsEntry **entry_p;
-
-    /* Add `id_pointer` as child of `id_self`. */
-    {
-      if (!BLI_ghash_ensure_p(
-              bmain_relations->relations_from_pointers, id_self, (void ***)&entry_p)) {
-        *entry_p = MEM_callocN(sizeof(**entry_p), __func__);
-        (*entry_p)->session_uuid = id_self->session_uuid;
-      }
-      else {
-        BLI_assert((*entry_p)->session_uuid == id_self->session_uuid);
-      }
-      MainIDRelationsEntryItem *to_id_entry = BLI_mempool_alloc(bmain_relations->entry_items_pool);
-      to_id_entry->next = (*entry_p)->to_ids;
-      to_id_entry->id_pointer.to = id_pointer;
-      to_id_entry->session_uuid = (*id_pointer != NULL) ? (*id_pointer)->session_uuid :
-                                                          MAIN_ID_SESSION_UUID_UNSET;
-      to_id_entry->usage_flag = cb_flag;
-      (*entry_p)->to_ids = to_id_entry;
-    }
-
-    /* Add `id_self` as parent of `id_pointer`. */
-    if (*id_pointer != NULL) {
-      if (!BLI_ghash_ensure_p(
-              bmain_relations->relations_from_pointers, *id_pointer, (void ***)&entry_p)) {
-        *entry_p = MEM_callocN(sizeof(**entry_p), __func__);
-        (*entry_p)->session_uuid = (*id_pointer)->session_uuid;
-      }
-      else {
-        BLI_assert((*entry_p)->session_uuid == (*id_pointer)->session_uuid);
-      }
-      MainIDRelationsEntryItem *from_id_entry = BLI_mempool_alloc(
-          bmain_relations->entry_items_pool);
-      from_id_entry->next = (*entry_p)->from_ids;
-      from_id_entry->id_pointer.from = id_self;
-      from_id_entry->session_uuid = id_self->session_uuid;
-      from_id_entry->usage_flag = cb_flag;
-      (*entry_p)->from_ids = from_id_entry;
-    }
+    main_relations_usage_add(bmain_relations, id_self, id_pointer, cb_flag);
   }
 
   return IDWALK_RET_NOP;
@@ -274,6 +281,7 @@ void BKE_main_relations_create(Main *bmain, const short flag)
       sizeof(MainIDRelationsEntryItem), 128, 128, BLI_MEMPOOL_NOP);
 
   bmain->relations->flag = flag;
+  bmain->relations->tags_clear_gen = 0;
 
   ID *id;
   FOREACH_MAIN_ID_BEGIN (bmain, id) {
@@ -308,6 +316,17 @@ void BKE_main_relations_free(Main *bmain)
   }
 }
 
+void BKE_main_relations_id_usage_add(Main *bmain, ID *id_user, ID **id_pointer, int usage_flag)
+{
+  if (bmain->relations == NULL) {
+    return;
+  }
+  if (*id_pointer == NULL) {
+    return;
+  }
+  main_relations_usage_add(bmain->relations, id_user, id_pointer, usage_flag);
+}
+
 void BKE_main_relations_tag_set(struct Main *bmain,
                                 const eMainIDRelationsEntryTags tag,
                                 const bool value)
@@ -316,21 +335,46 @@ void BKE_main_relations_tag_set(struct Main *bmain,
     return;
   }
 
+  if (!value) {
+    /* Lazy clearing, bumping the generation invalidates the tags of all entries at once. This
+     * happens once per processed ID in some hierarchy-walking code (liboverride resync e.g.), so
+     * iterating over all entries here would make such code quadratic over the amount of IDs. */
+    bmain->relations->tags_clear_gen++;
+    return;
+  }
+
   GHashIterator *gh_iter;
   for (gh_iter = BLI_ghashIterator_new(bmain->relations->relations_from_pointers);
        !BLI_ghashIterator_done(gh_iter);
        BLI_ghashIterator_step(gh_iter)) {
     MainIDRelationsEntry *entry = BLI_ghashIterator_getValue(gh_iter);
-    if (value) {
-      entry->tags |= tag;
-    }
-    else {
-      entry->tags &= ~tag;
-    }
+    BKE_main_relations_entry_tag_add(bmain, entry, tag);
   }
   BLI_ghashIterator_free(gh_iter);
 }
 
+bool BKE_main_relations_entry_tag_test(Main *bmain,
+                                       MainIDRelationsEntry *entry,
+                                       const eMainIDRelationsEntryTags tag)
+{
+  if (entry->tags_clear_gen != bmain->relations->tags_clear_gen) {
+    /* Tags of this entry have been lazily cleared since they were last modified. */
+    return false;
+  }
+  return (entry->tags & tag) != 0;
+}
+
+void BKE_main_relations_entry_tag_add(Main *bmain,
+                                      MainIDRelationsEntry *entry,
+                                      const eMainIDRelationsEntryTags tag)
+{
+  if (entry->tags_clear_gen != bmain->relations->tags_clear_gen) {
+    entry->tags = 0;
+    entry->tags_clear_gen = bmain->relations->tags_clear_gen;
+  }
+  entry->tags |= tag;
+}
+
 GSet *BKE_main_gset_create(Main *bmain, GSet *gset)
 {
   if (gset == NULL) {
@@ -36,6 +36,7 @@
 
 #include "BKE_anim_data.h"
 #include "BKE_bpath.h"
+#include "BKE_bvhutils.h"
 #include "BKE_deform.h"
 #include "BKE_editmesh.h"
 #include "BKE_global.h"
@@ -1888,8 +1889,57 @@ void BKE_mesh_count_selected_items(const Mesh *mesh, int r_count[3])
   /* We could support faces in paint modes. */
 }
 
+/**
+ * Return the runtime coordinate cache when it exists and matches the current vertex positions,
+ * without building it. NULL otherwise.
+ */
+static const float (*mesh_vert_coords_cached_get(const Mesh *mesh))[3]
+{
+  if (mesh->runtime.vert_coords_cache && !mesh->runtime.vert_coords_cache_dirty) {
+    return (const float(*)[3])mesh->runtime.vert_coords_cache;
+  }
+  return nullptr;
+}
+
+const float (*BKE_mesh_vert_coords_ensure(const Mesh *mesh))[3]
+{
+  const float(*coords)[3] = mesh_vert_coords_cached_get(mesh);
+  if (coords) {
+    return coords;
+  }
+  if (mesh->totvert == 0) {
+    return nullptr;
+  }
+
+  ThreadMutex *coords_mutex = (ThreadMutex *)mesh->runtime.vert_coords_mutex;
+  BLI_mutex_lock(coords_mutex);
+  coords = mesh_vert_coords_cached_get(mesh);
+  if (coords == nullptr) {
+    Mesh &mesh_mutable = *const_cast<Mesh *>(mesh);
+    /* Reuse the allocation when only coordinates changed (the common case for deformations). */
+    float(*cache)[3] = (float(*)[3])MEM_reallocN(mesh_mutable.runtime.vert_coords_cache,
+                                                 sizeof(float[3]) * mesh->totvert);
+    const MVert *mv = mesh->mvert;
+    for (int i = 0; i < mesh->totvert; i++, mv++) {
+      copy_v3_v3(cache[i], mv->co);
+    }
+    mesh_mutable.runtime.vert_coords_cache = cache;
+    mesh_mutable.runtime.vert_coords_cache_dirty = false;
+    coords = cache;
+  }
+  BLI_mutex_unlock(coords_mutex);
+  return coords;
+}
+
 void BKE_mesh_vert_coords_get(const Mesh *mesh, float (*vert_coords)[3])
 {
+  /* A valid runtime cache is already contiguous, copying it is cheaper than the
+   * strided gather from #MVert. */
+  const float(*cached)[3] = mesh_vert_coords_cached_get(mesh);
+  if (cached) {
+    memcpy(vert_coords, cached, sizeof(float[3]) * mesh->totvert);
+    return;
+  }
   const MVert *mv = mesh->mvert;
   for (int i = 0; i < mesh->totvert; i++, mv++) {
     copy_v3_v3(vert_coords[i], mv->co);
@@ -1916,6 +1966,9 @@ void BKE_mesh_vert_coords_apply(Mesh *mesh, const float (*vert_coords)[3])
     copy_v3_v3(mv->co, vert_coords[i]);
   }
   BKE_mesh_normals_tag_dirty(mesh);
+  if (mesh->runtime.bvh_cache) {
+    bvhcache_tag_positions_changed(mesh->runtime.bvh_cache);
+  }
 }
 
 void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
@@ -1930,6 +1983,9 @@ void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
     mul_v3_m4v3(mv->co, mat, vert_coords[i]);
   }
   BKE_mesh_normals_tag_dirty(mesh);
+  if (mesh->runtime.bvh_cache) {
+    bvhcache_tag_positions_changed(mesh->runtime.bvh_cache);
+  }
 }
 
 void BKE_mesh_anonymous_attributes_remove(Mesh *mesh)
@@ -6,6 +6,7 @@
  */
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -114,6 +115,93 @@ void BKE_mesh_mirror_apply_mirror_on_axis(struct Main *bmain,
   BM_mesh_free(bm);
 }
 
+typedef struct MirrorVertexUserdata {
+  float mtx[4][4];
+  /* Original and mirrored halves of the result vertex array, both `maxVerts` long. */
+  MVert *mvert_orig;
+  MVert *mvert_mirror;
+  int maxVerts;
+  float tolerance_sq;
+  bool do_vtargetmap;
+  bool use_correct_order_on_merge;
+  int *vtmap_a;
+  int *vtmap_b;
+} MirrorVertexUserdata;
+
+/**
+ * Mirror the coordinates of one copied vertex and detect if it merges with its original.
+ * Each vertex only ever pairs with its own copy and writes its own target-map slot,
+ * so the vertices are processed in parallel and the output is independent of scheduling.
+ */
+static void mirror_vertex_fn(void *__restrict userdata,
+                             const int i,
+                             const TaskParallelTLS *__restrict tls)
+{
+  MirrorVertexUserdata *data = userdata;
+  int *tot_vtargetmap = tls->userdata_chunk;
+  MVert *mv_prev = &data->mvert_orig[i];
+  MVert *mv = &data->mvert_mirror[i];
+
+  mul_m4_v3(data->mtx, mv->co);
+
+  if (!data->do_vtargetmap) {
+    return;
+  }
+
+  /* Compare location of the original and mirrored vertex,
+   * to see if they should be mapped for merging.
+   *
+   * Always merge from the copied into the original vertices so it's possible to
+   * generate a 1:1 mapping by scanning vertices from the beginning of the array
+   * as is done in #BKE_editmesh_vert_coords_when_deformed. Without this,
+   * the coordinates returned will sometimes point to the copied vertex locations, see:
+   * T91444.
+   *
+   * However, such a change also affects non-versionable things like some modifiers binding, so
+   * we cannot enforce that behavior on existing modifiers, in which case we keep using the
+   * old, incorrect behavior of merging the source vertex into its copy.
+   */
+  if (data->use_correct_order_on_merge) {
+    if (UNLIKELY(len_squared_v3v3(mv_prev->co, mv->co) < data->tolerance_sq)) {
+      data->vtmap_b[i] = i;
+      (*tot_vtargetmap)++;
+
+      /* average location */
+      mid_v3_v3v3(mv->co, mv_prev->co, mv->co);
+      copy_v3_v3(mv_prev->co, mv->co);
+    }
+    else {
+      data->vtmap_b[i] = -1;
+    }
+
+    /* Fill here to avoid 2x loops. */
+    data->vtmap_a[i] = -1;
+  }
+  else {
+    if (UNLIKELY(len_squared_v3v3(mv_prev->co, mv->co) < data->tolerance_sq)) {
+      data->vtmap_a[i] = data->maxVerts + i;
+      (*tot_vtargetmap)++;
+
+      /* average location */
+      mid_v3_v3v3(mv->co, mv_prev->co, mv->co);
+      copy_v3_v3(mv_prev->co, mv->co);
+    }
+    else {
+      data->vtmap_a[i] = -1;
+    }
+
+    /* Fill here to avoid 2x loops. */
+    data->vtmap_b[i] = -1;
+  }
+}
+
+static void mirror_vertex_reduce(const void *__restrict UNUSED(userdata),
+                                 void *__restrict chunk_join,
+                                 void *__restrict chunk)
+{
+  *(int *)chunk_join += *(int *)chunk;
+}
+
 Mesh *BKE_mesh_mirror_apply_mirror_on_axis_for_modifier(MirrorModifierData *mmd,
                                                         Object *ob,
                                                         const Mesh *mesh,
@@ -129,7 +217,6 @@ Mesh *BKE_mesh_mirror_apply_mirror_on_axis_for_modifier(MirrorModifierData *mmd,
                           (axis == 2 && mmd->flag & MOD_MIR_BISECT_AXIS_Z));
 
   Mesh *result;
-  MVert *mv, *mv_prev;
   MEdge *me;
   MLoop *ml;
   MPoly *mp;
@@ -235,61 +322,26 @@ Mesh *BKE_mesh_mirror_apply_mirror_on_axis_for_modifier(MirrorModifierData *mmd,
   }
 
   /* mirror vertex coordinates */
-  mv_prev = result->mvert;
-  mv = mv_prev + maxVerts;
-  for (i = 0; i < maxVerts; i++, mv++, mv_prev++) {
-    mul_m4_v3(mtx, mv->co);
-
-    if (do_vtargetmap) {
-      /* Compare location of the original and mirrored vertex,
-       * to see if they should be mapped for merging.
-       *
-       * Always merge from the copied into the original vertices so it's possible to
-       * generate a 1:1 mapping by scanning vertices from the beginning of the array
-       * as is done in #BKE_editmesh_vert_coords_when_deformed. Without this,
-       * the coordinates returned will sometimes point to the copied vertex locations, see:
-       * T91444.
-       *
-       * However, such a change also affects non-versionable things like some modifiers binding, so
-       * we cannot enforce that behavior on existing modifiers, in which case we keep using the
-       * old, incorrect behavior of merging the source vertex into its copy.
-       */
-      if (use_correct_order_on_merge) {
-        if (UNLIKELY(len_squared_v3v3(mv_prev->co, mv->co) < tolerance_sq)) {
-          *vtmap_b = i;
-          tot_vtargetmap++;
-
-          /* average location */
-          mid_v3_v3v3(mv->co, mv_prev->co, mv->co);
-          copy_v3_v3(mv_prev->co, mv->co);
-        }
-        else {
-          *vtmap_b = -1;
-        }
-
-        /* Fill here to avoid 2x loops. */
-        *vtmap_a = -1;
-      }
-      else {
-        if (UNLIKELY(len_squared_v3v3(mv_prev->co, mv->co) < tolerance_sq)) {
-          *vtmap_a = maxVerts + i;
-          tot_vtargetmap++;
-
-          /* average location */
-          mid_v3_v3v3(mv->co, mv_prev->co, mv->co);
-          copy_v3_v3(mv_prev->co, mv->co);
-        }
-        else {
-          *vtmap_a = -1;
-        }
-
-        /* Fill here to avoid 2x loops. */
-        *vtmap_b = -1;
-      }
-
-      vtmap_a++;
-      vtmap_b++;
-    }
+  {
+    MirrorVertexUserdata data = {
+        .mvert_orig = result->mvert,
+        .mvert_mirror = result->mvert + maxVerts,
+        .maxVerts = maxVerts,
+        .tolerance_sq = tolerance_sq,
+        .do_vtargetmap = do_vtargetmap,
+        .use_correct_order_on_merge = use_correct_order_on_merge,
+        .vtmap_a = vtmap_a,
+        .vtmap_b = vtmap_b,
+    };
+    copy_m4_m4(data.mtx, mtx);
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (maxVerts > 1000);
+    settings.userdata_chunk = &tot_vtargetmap;
+    settings.userdata_chunk_size = sizeof(tot_vtargetmap);
+    settings.func_reduce = mirror_vertex_reduce;
+    BLI_task_parallel_range(0, maxVerts, &data, mirror_vertex_fn, &settings);
   }
 
   /* handle shape keys */
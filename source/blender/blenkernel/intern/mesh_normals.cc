@@ -18,17 +18,19 @@
 
 #include "BLI_alloca.h"
 #include "BLI_bitmap.h"
-
+#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_linklist.h"
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
 #include "BLI_math_vec_types.hh"
+#include "BLI_math_vector_batch.h"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_editmesh_cache.h"
@@ -37,7 +39,9 @@
 
 #include "atomic_ops.h"
 
+using blender::IndexRange;
 using blender::Span;
+using blender::Vector;
 
 // #define DEBUG_TIME
 
@@ -96,6 +100,9 @@ void BKE_mesh_normals_tag_dirty(Mesh *mesh)
 {
   mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
   mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  /* Position changes must tag normals dirty, so this also keeps the contiguous
+   * runtime copy of the vertex coordinates in sync (see #BKE_mesh_vert_coords_ensure). */
+  mesh->runtime.vert_coords_cache_dirty = true;
 }
 
 float (*BKE_mesh_vertex_normals_for_write(Mesh *mesh))[3]
@@ -191,6 +198,50 @@ void BKE_mesh_calc_normals_poly(const MVert *mvert,
   BLI_task_parallel_range(0, mpoly_len, &data, mesh_calc_normals_poly_fn, &settings);
 }
 
+struct MeshCalcNormalsData_PolyCoords {
+  const float (*positions)[3];
+  const MLoop *mloop;
+  const MPoly *mpoly;
+
+  /** Polygon normal output. */
+  float (*pnors)[3];
+};
+
+static void mesh_calc_normals_poly_coords_fn(void *__restrict userdata,
+                                             const int pidx,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const MeshCalcNormalsData_PolyCoords *data = (MeshCalcNormalsData_PolyCoords *)userdata;
+  const MPoly *mp = &data->mpoly[pidx];
+  BKE_mesh_calc_poly_normal_coords(
+      mp, data->mloop + mp->loopstart, data->positions, data->pnors[pidx]);
+}
+
+/**
+ * A version of #BKE_mesh_calc_normals_poly reading from the contiguous coordinate array,
+ * which touches 40% less memory than the interleaved #MVert layout.
+ */
+static void mesh_calc_normals_poly_coords(const float (*positions)[3],
+                                          const MLoop *mloop,
+                                          const MPoly *mpoly,
+                                          int mpoly_len,
+                                          float (*r_poly_normals)[3])
+{
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+
+  BLI_assert((r_poly_normals != nullptr) || (mpoly_len == 0));
+
+  MeshCalcNormalsData_PolyCoords data = {};
+  data.mpoly = mpoly;
+  data.mloop = mloop;
+  data.positions = positions;
+  data.pnors = r_poly_normals;
+
+  BLI_task_parallel_range(0, mpoly_len, &data, mesh_calc_normals_poly_coords_fn, &settings);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -201,8 +252,7 @@ void BKE_mesh_calc_normals_poly(const MVert *mvert,
  * \{ */
 
 struct MeshCalcNormalsData_PolyAndVertex {
-  /** Write into vertex normals #MVert.no. */
-  MVert *mvert;
+  const float (*positions)[3];
   const MLoop *mloop;
   const MPoly *mpoly;
 
@@ -218,7 +268,7 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
   const MeshCalcNormalsData_PolyAndVertex *data = (MeshCalcNormalsData_PolyAndVertex *)userdata;
   const MPoly *mp = &data->mpoly[pidx];
   const MLoop *ml = &data->mloop[mp->loopstart];
-  const MVert *mverts = data->mvert;
+  const float(*positions)[3] = data->positions;
   float(*vnors)[3] = data->vnors;
 
   float pnor_temp[3];
@@ -231,9 +281,9 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
   {
     zero_v3(pnor);
     /* Newell's Method */
-    const float *v_curr = mverts[ml[i_end].v].co;
+    const float *v_curr = positions[ml[i_end].v];
     for (int i_next = 0; i_next <= i_end; i_next++) {
-      const float *v_next = mverts[ml[i_next].v].co;
+      const float *v_next = positions[ml[i_next].v];
       add_newell_cross_v3_v3v3(pnor, v_curr, v_next);
       v_curr = v_next;
     }
@@ -246,13 +296,13 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
   /* Inline version of #accumulate_vertex_normals_poly_v3. */
   {
     float edvec_prev[3], edvec_next[3], edvec_end[3];
-    const float *v_curr = mverts[ml[i_end].v].co;
-    sub_v3_v3v3(edvec_prev, mverts[ml[i_end - 1].v].co, v_curr);
+    const float *v_curr = positions[ml[i_end].v];
+    sub_v3_v3v3(edvec_prev, positions[ml[i_end - 1].v], v_curr);
     normalize_v3(edvec_prev);
     copy_v3_v3(edvec_end, edvec_prev);
 
     for (int i_next = 0, i_curr = i_end; i_next <= i_end; i_curr = i_next++) {
-      const float *v_next = mverts[ml[i_next].v].co;
+      const float *v_next = positions[ml[i_next].v];
 
       /* Skip an extra normalization by reusing the first calculated edge. */
       if (i_next != i_end) {
@@ -279,16 +329,15 @@ static void mesh_calc_normals_poly_and_vertex_finalize_fn(
 {
   MeshCalcNormalsData_PolyAndVertex *data = (MeshCalcNormalsData_PolyAndVertex *)userdata;
 
-  MVert *mv = &data->mvert[vidx];
   float *no = data->vnors[vidx];
 
   if (UNLIKELY(normalize_v3(no) == 0.0f)) {
     /* Following Mesh convention; we use vertex coordinate itself for normal in this case. */
-    normalize_v3_v3(no, mv->co);
+    normalize_v3_v3(no, data->positions[vidx]);
   }
 }
 
-static void mesh_calc_normals_poly_and_vertex(MVert *mvert,
+static void mesh_calc_normals_poly_and_vertex(const float (*positions)[3],
                                               const int mvert_len,
                                               const MLoop *mloop,
                                               const int UNUSED(mloop_len),
@@ -316,7 +365,7 @@ static void mesh_calc_normals_poly_and_vertex(MVert *mvert,
   MeshCalcNormalsData_PolyAndVertex data = {};
   data.mpoly = mpoly;
   data.mloop = mloop;
-  data.mvert = mvert;
+  data.positions = positions;
   data.pnors = r_poly_normals;
   data.vnors = vnors;
 
@@ -368,7 +417,9 @@ const float (*BKE_mesh_vertex_normals_ensure(const Mesh *mesh))[3]
     vert_normals = BKE_mesh_vertex_normals_for_write(&mesh_mutable);
     poly_normals = BKE_mesh_poly_normals_for_write(&mesh_mutable);
 
-    mesh_calc_normals_poly_and_vertex(mesh_mutable.mvert,
+    /* Contiguous positions cut the memory read per accumulated corner by 40%
+     * compared to iterating the interleaved #MVert directly. */
+    mesh_calc_normals_poly_and_vertex(BKE_mesh_vert_coords_ensure(mesh),
                                       mesh_mutable.totvert,
                                       mesh_mutable.mloop,
                                       mesh_mutable.totloop,
@@ -412,13 +463,11 @@ const float (*BKE_mesh_poly_normals_ensure(const Mesh *mesh))[3]
 
     poly_normals = BKE_mesh_poly_normals_for_write(&mesh_mutable);
 
-    BKE_mesh_calc_normals_poly(mesh_mutable.mvert,
-                               mesh_mutable.totvert,
-                               mesh_mutable.mloop,
-                               mesh_mutable.totloop,
-                               mesh_mutable.mpoly,
-                               mesh_mutable.totpoly,
-                               poly_normals);
+    mesh_calc_normals_poly_coords(BKE_mesh_vert_coords_ensure(mesh),
+                                  mesh_mutable.mloop,
+                                  mesh_mutable.mpoly,
+                                  mesh_mutable.totpoly,
+                                  poly_normals);
 
     BKE_mesh_poly_normals_clear_dirty(&mesh_mutable);
   });
@@ -494,13 +543,14 @@ void BKE_mesh_calc_normals_looptri(MVert *mverts,
                                      mverts[vtri[2]].co);
   }
 
+  normalize_v3_array(tnorms, numVerts);
+
   /* Following Mesh convention; we use vertex coordinate itself for normal in this case. */
   for (int i = 0; i < numVerts; i++) {
-    MVert *mv = &mverts[i];
     float *no = tnorms[i];
 
-    if (UNLIKELY(normalize_v3(no) == 0.0f)) {
-      normalize_v3_v3(no, mv->co);
+    if (UNLIKELY(is_zero_v3(no))) {
+      normalize_v3_v3(no, mverts[i].co);
     }
   }
 
@@ -780,8 +830,6 @@ void BKE_lnor_space_custom_normal_to_data(MLoopNorSpace *lnor_space,
 struct LoopSplitTaskData {
   /* Specific to each instance (each task). */
 
-  /** We have to create those outside of tasks, since #MemArena is not thread-safe. */
-  MLoopNorSpace *lnor_space;
   float (*lnor)[3];
   const MLoop *ml_curr;
   const MLoop *ml_prev;
@@ -790,19 +838,12 @@ struct LoopSplitTaskData {
   /** Also used a flag to switch between single or fan process! */
   const int *e2l_prev;
   int mp_index;
-
-  /** This one is special, it's owned and managed by worker tasks,
-   * avoid to have to create it for each fan! */
-  BLI_Stack *edge_vectors;
-
-  char pad_c;
 };
 
 struct LoopSplitTaskDataCommon {
   /* Read/write.
    * Note we do not need to protect it, though, since two different tasks will *always* affect
    * different elements in the arrays. */
-  MLoopNorSpaceArray *lnors_spacearr;
   float (*loopnors)[3];
   short (*clnors_data)[2];
 
@@ -852,6 +893,23 @@ static void mesh_edges_sharp_tag(LoopSplitTaskDataCommon *data,
 
   const float split_angle_cos = check_angle ? cosf(split_angle) : -1.0f;
 
+  /* Fill the loop -> poly map, and pre-populate all loop normals as if their verts were
+   * all-smooth, this way we don't have to compute those later!
+   * Filling the whole map first also means the sharpness detection below can rely on
+   * #loop_to_poly being valid for any loop, whatever the processing order of the polys. */
+  blender::threading::parallel_for(IndexRange(numPolys), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const MPoly *poly = &mpolys[i];
+      const int ml_index_end = poly->loopstart + poly->totloop;
+      for (int ml_index = poly->loopstart; ml_index < ml_index_end; ml_index++) {
+        loop_to_poly[ml_index] = i;
+        if (loopnors) {
+          copy_v3_v3(loopnors[ml_index], data->vert_normals[mloops[ml_index].v]);
+        }
+      }
+    }
+  });
+
   for (mp = mpolys, mp_index = 0; mp_index < numPolys; mp++, mp_index++) {
     const MLoop *ml_curr;
     int *e2l;
@@ -863,15 +921,6 @@ static void mesh_edges_sharp_tag(LoopSplitTaskDataCommon *data,
     for (; ml_curr_index <= ml_last_index; ml_curr++, ml_curr_index++) {
       e2l = edge_to_loops[ml_curr->e];
 
-      loop_to_poly[ml_curr_index] = mp_index;
-
-      /* Pre-populate all loop normals as if their verts were all-smooth,
-       * this way we don't have to compute those later!
-       */
-      if (loopnors) {
-        copy_v3_v3(loopnors[ml_curr_index], data->vert_normals[ml_curr->v]);
-      }
-
       /* Check whether current edge might be smooth or sharp */
       if ((e2l[0] | e2l[1]) == 0) {
         /* 'Empty' edge until now, set e2l[0] (and e2l[1] to INDEX_UNSET to tag it as unset). */
@@ -1019,16 +1068,16 @@ void BKE_mesh_loop_manifold_fan_around_vert_next(const MLoop *mloops,
   /* And now we are back in sync, mlfan_curr_index is the index of `mlfan_curr`! Pff! */
 }
 
-static void split_loop_nor_single_do(LoopSplitTaskDataCommon *common_data, LoopSplitTaskData *data)
+static void split_loop_nor_single_do(LoopSplitTaskDataCommon *common_data,
+                                     LoopSplitTaskData *data,
+                                     MLoopNorSpaceArray *lnors_spacearr)
 {
-  MLoopNorSpaceArray *lnors_spacearr = common_data->lnors_spacearr;
   const short(*clnors_data)[2] = common_data->clnors_data;
 
   const MVert *mverts = common_data->mverts;
   const MEdge *medges = common_data->medges;
   const float(*polynors)[3] = common_data->polynors;
 
-  MLoopNorSpace *lnor_space = data->lnor_space;
   float(*lnor)[3] = data->lnor;
   const MLoop *ml_curr = data->ml_curr;
   const MLoop *ml_prev = data->ml_prev;
@@ -1054,6 +1103,7 @@ static void split_loop_nor_single_do(LoopSplitTaskDataCommon *common_data, LoopS
 
   /* If needed, generate this (simple!) lnor space. */
   if (lnors_spacearr) {
+    MLoopNorSpace *lnor_space = BKE_lnor_space_create(lnors_spacearr);
     float vec_curr[3], vec_prev[3];
 
     const uint mv_pivot_index = ml_curr->v; /* The vertex we are "fanning" around! */
@@ -1080,9 +1130,11 @@ static void split_loop_nor_single_do(LoopSplitTaskDataCommon *common_data, LoopS
   }
 }
 
-static void split_loop_nor_fan_do(LoopSplitTaskDataCommon *common_data, LoopSplitTaskData *data)
+static void split_loop_nor_fan_do(LoopSplitTaskDataCommon *common_data,
+                                  LoopSplitTaskData *data,
+                                  MLoopNorSpaceArray *lnors_spacearr,
+                                  BLI_Stack *edge_vectors)
 {
-  MLoopNorSpaceArray *lnors_spacearr = common_data->lnors_spacearr;
   float(*loopnors)[3] = common_data->loopnors;
   short(*clnors_data)[2] = common_data->clnors_data;
 
@@ -1094,7 +1146,7 @@ static void split_loop_nor_fan_do(LoopSplitTaskDataCommon *common_data, LoopSpli
   const int *loop_to_poly = common_data->loop_to_poly;
   const float(*polynors)[3] = common_data->polynors;
 
-  MLoopNorSpace *lnor_space = data->lnor_space;
+  MLoopNorSpace *lnor_space = lnors_spacearr ? BKE_lnor_space_create(lnors_spacearr) : nullptr;
 #if 0 /* Not needed for 'fan' loops. */
   float(*lnor)[3] = data->lnor;
 #endif
@@ -1105,8 +1157,6 @@ static void split_loop_nor_fan_do(LoopSplitTaskDataCommon *common_data, LoopSpli
   const int mp_index = data->mp_index;
   const int *e2l_prev = data->e2l_prev;
 
-  BLI_Stack *edge_vectors = data->edge_vectors;
-
   /* Sigh! we have to fan around current vertex, until we find the other non-smooth edge,
    * and accumulate face normals into the vertex!
    * Note in case this vertex has only one sharp edges, this is a waste because the normal is the
@@ -1294,50 +1344,18 @@ static void split_loop_nor_fan_do(LoopSplitTaskDataCommon *common_data, LoopSpli
 
 static void loop_split_worker_do(LoopSplitTaskDataCommon *common_data,
                                  LoopSplitTaskData *data,
+                                 MLoopNorSpaceArray *lnors_spacearr,
                                  BLI_Stack *edge_vectors)
 {
   BLI_assert(data->ml_curr);
   if (data->e2l_prev) {
     BLI_assert((edge_vectors == nullptr) || BLI_stack_is_empty(edge_vectors));
-    data->edge_vectors = edge_vectors;
-    split_loop_nor_fan_do(common_data, data);
+    split_loop_nor_fan_do(common_data, data, lnors_spacearr, edge_vectors);
   }
   else {
     /* No need for edge_vectors for 'single' case! */
-    split_loop_nor_single_do(common_data, data);
-  }
-}
-
-static void loop_split_worker(TaskPool *__restrict pool, void *taskdata)
-{
-  LoopSplitTaskDataCommon *common_data = (LoopSplitTaskDataCommon *)BLI_task_pool_user_data(pool);
-  LoopSplitTaskData *data = (LoopSplitTaskData *)taskdata;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr. */
-  BLI_Stack *edge_vectors = common_data->lnors_spacearr ?
-                                BLI_stack_new(sizeof(float[3]), __func__) :
-                                nullptr;
-
-#ifdef DEBUG_TIME
-  TIMEIT_START_AVERAGED(loop_split_worker);
-#endif
-
-  for (int i = 0; i < LOOP_SPLIT_TASK_BLOCK_SIZE; i++, data++) {
-    /* A nullptr ml_curr is used to tag ended data! */
-    if (data->ml_curr == nullptr) {
-      break;
-    }
-
-    loop_split_worker_do(common_data, data, edge_vectors);
+    split_loop_nor_single_do(common_data, data, lnors_spacearr);
   }
-
-  if (edge_vectors) {
-    BLI_stack_free(edge_vectors);
-  }
-
-#ifdef DEBUG_TIME
-  TIMEIT_END_AVERAGED(loop_split_worker);
-#endif
 }
 
 /**
@@ -1416,9 +1434,14 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const MLoop *mloops,
   }
 }
 
-static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common_data)
+/**
+ * Detect the loops and smooth fans that need processing, without doing any of the actual normal
+ * computation. Each resulting task is fully independent of the others (it touches disjoint loops),
+ * so the whole list can then be processed in parallel.
+ */
+static void loop_split_generator(LoopSplitTaskDataCommon *common_data,
+                                 Vector<LoopSplitTaskData> &r_tasks)
 {
-  MLoopNorSpaceArray *lnors_spacearr = common_data->lnors_spacearr;
   float(*loopnors)[3] = common_data->loopnors;
 
   const MLoop *mloops = common_data->mloops;
@@ -1438,23 +1461,10 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
 
   BLI_bitmap *skip_loops = BLI_BITMAP_NEW(numLoops, __func__);
 
-  LoopSplitTaskData *data_buff = nullptr;
-  int data_idx = 0;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr
-   * (and we are not multi-threading). */
-  BLI_Stack *edge_vectors = nullptr;
-
 #ifdef DEBUG_TIME
   TIMEIT_START_AVERAGED(loop_split_generator);
 #endif
 
-  if (!pool) {
-    if (lnors_spacearr) {
-      edge_vectors = BLI_stack_new(sizeof(float[3]), __func__);
-    }
-  }
-
   /* We now know edges that can be smoothed (with their vector, and their two loops),
    * and edges that will be hard! Now, time to generate the normals.
    */
@@ -1506,35 +1516,20 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
         // printf("SKIPPING!\n");
       }
       else {
-        LoopSplitTaskData *data, data_local;
+        LoopSplitTaskData data = {};
 
         // printf("PROCESSING!\n");
 
-        if (pool) {
-          if (data_idx == 0) {
-            data_buff = (LoopSplitTaskData *)MEM_calloc_arrayN(
-                LOOP_SPLIT_TASK_BLOCK_SIZE, sizeof(*data_buff), __func__);
-          }
-          data = &data_buff[data_idx];
-        }
-        else {
-          data = &data_local;
-          memset(data, 0, sizeof(*data));
-        }
-
         if (IS_EDGE_SHARP(e2l_curr) && IS_EDGE_SHARP(e2l_prev)) {
-          data->lnor = lnors;
-          data->ml_curr = ml_curr;
-          data->ml_prev = ml_prev;
-          data->ml_curr_index = ml_curr_index;
+          data.lnor = lnors;
+          data.ml_curr = ml_curr;
+          data.ml_prev = ml_prev;
+          data.ml_curr_index = ml_curr_index;
 #if 0 /* Not needed for 'single' loop. */
-          data->ml_prev_index = ml_prev_index;
-          data->e2l_prev = nullptr; /* Tag as 'single' task. */
+          data.ml_prev_index = ml_prev_index;
+          data.e2l_prev = nullptr; /* Tag as 'single' task. */
 #endif
-          data->mp_index = mp_index;
-          if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
-          }
+          data.mp_index = mp_index;
         }
         /* We *do not need* to check/tag loops as already computed!
          * Due to the fact a loop only links to one of its two edges,
@@ -1547,29 +1542,17 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
          */
         else {
 #if 0 /* Not needed for 'fan' loops. */
-          data->lnor = lnors;
+          data.lnor = lnors;
 #endif
-          data->ml_curr = ml_curr;
-          data->ml_prev = ml_prev;
-          data->ml_curr_index = ml_curr_index;
-          data->ml_prev_index = ml_prev_index;
-          data->e2l_prev = e2l_prev; /* Also tag as 'fan' task. */
-          data->mp_index = mp_index;
-          if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
-          }
+          data.ml_curr = ml_curr;
+          data.ml_prev = ml_prev;
+          data.ml_curr_index = ml_curr_index;
+          data.ml_prev_index = ml_prev_index;
+          data.e2l_prev = e2l_prev; /* Also tag as 'fan' task. */
+          data.mp_index = mp_index;
         }
 
-        if (pool) {
-          data_idx++;
-          if (data_idx == LOOP_SPLIT_TASK_BLOCK_SIZE) {
-            BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-            data_idx = 0;
-          }
-        }
-        else {
-          loop_split_worker_do(common_data, data, edge_vectors);
-        }
+        r_tasks.append(data);
       }
 
       ml_prev = ml_curr;
@@ -1577,15 +1560,6 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
     }
   }
 
-  /* Last block of data. Since it is calloc'ed and we use first nullptr item as stopper,
-   * everything is fine. */
-  if (pool && data_idx) {
-    BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-  }
-
-  if (edge_vectors) {
-    BLI_stack_free(edge_vectors);
-  }
   MEM_freeN(skip_loops);
 
 #ifdef DEBUG_TIME
@@ -1685,7 +1659,6 @@ void BKE_mesh_normals_loop_split(const MVert *mverts,
 
   /* Init data common to all tasks. */
   LoopSplitTaskDataCommon common_data;
-  common_data.lnors_spacearr = r_lnors_spacearr;
   common_data.loopnors = r_loopnors;
   common_data.clnors_data = clnors_data;
   common_data.mverts = mverts;
@@ -1703,18 +1676,56 @@ void BKE_mesh_normals_loop_split(const MVert *mverts,
   /* This first loop check which edges are actually smooth, and compute edge vectors. */
   mesh_edges_sharp_tag(&common_data, check_angle, split_angle, false);
 
-  if (numLoops < LOOP_SPLIT_TASK_BLOCK_SIZE * 8) {
-    /* Not enough loops to be worth the whole threading overhead. */
-    loop_split_generator(nullptr, &common_data);
+  /* First phase: walk the polys to find all single loops and smooth fan starting points.
+   * This is cheap (no actual normal computation), but has to be serial because of the
+   * `skip_loops` tagging of cyclic smooth fans. */
+  Vector<LoopSplitTaskData> tasks;
+  loop_split_generator(&common_data, tasks);
+
+  /* Second phase: compute the loop normals (and lnor spaces) of each detected task.
+   * All tasks affect disjoint sets of loops, so they can run in any order and in parallel.
+   * The only shared mutable state is the #MemArena backing `r_lnors_spacearr`, which is not
+   * thread-safe, so each thread allocates its spaces from its own thread-local array whose
+   * arena is merged back into the main one once all tasks are done. */
+  if (tasks.size() < LOOP_SPLIT_TASK_BLOCK_SIZE * 4) {
+    /* Not enough tasks to be worth the whole threading overhead. */
+    BLI_Stack *edge_vectors = r_lnors_spacearr ? BLI_stack_new(sizeof(float[3]), __func__) :
+                                                 nullptr;
+    for (LoopSplitTaskData &data : tasks) {
+      loop_split_worker_do(&common_data, &data, r_lnors_spacearr, edge_vectors);
+    }
+    if (edge_vectors) {
+      BLI_stack_free(edge_vectors);
+    }
   }
   else {
-    TaskPool *task_pool = BLI_task_pool_create(&common_data, TASK_PRIORITY_HIGH);
-
-    loop_split_generator(task_pool, &common_data);
-
-    BLI_task_pool_work_and_wait(task_pool);
+    struct LoopSplitTLSData {
+      MLoopNorSpaceArray lnors_spacearr = {nullptr};
+      BLI_Stack *edge_vectors = nullptr;
+    };
+    blender::threading::EnumerableThreadSpecific<LoopSplitTLSData> tls_data;
+
+    blender::threading::parallel_for(
+        tasks.index_range(), LOOP_SPLIT_TASK_BLOCK_SIZE, [&](const IndexRange range) {
+          LoopSplitTLSData &tls = tls_data.local();
+          if (r_lnors_spacearr && tls.lnors_spacearr.mem == nullptr) {
+            BKE_lnor_spacearr_tls_init(r_lnors_spacearr, &tls.lnors_spacearr);
+            tls.edge_vectors = BLI_stack_new(sizeof(float[3]), __func__);
+          }
+          MLoopNorSpaceArray *lnors_spacearr = r_lnors_spacearr ? &tls.lnors_spacearr : nullptr;
+          for (const int i : range) {
+            loop_split_worker_do(&common_data, &tasks[i], lnors_spacearr, tls.edge_vectors);
+          }
+        });
 
-    BLI_task_pool_free(task_pool);
+    for (LoopSplitTLSData &tls : tls_data) {
+      if (tls.lnors_spacearr.mem != nullptr) {
+        BKE_lnor_spacearr_tls_join(r_lnors_spacearr, &tls.lnors_spacearr);
+      }
+      if (tls.edge_vectors != nullptr) {
+        BLI_stack_free(tls.edge_vectors);
+      }
+    }
   }
 
   MEM_freeN(edge_to_loops);
@@ -11,8 +11,10 @@
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
+#include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
 
+#include "BLI_listbase.h"
 #include "BLI_math_geom.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
@@ -21,6 +23,7 @@
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
 #include "BKE_mesh_runtime.h"
+#include "BKE_modifier.h"
 #include "BKE_shrinkwrap.h"
 #include "BKE_subdiv_ccg.h"
 
@@ -41,6 +44,9 @@ static void mesh_runtime_init_mutexes(Mesh *mesh)
   BLI_mutex_init(mesh->runtime.normals_mutex);
   mesh->runtime.render_mutex = MEM_mallocN(sizeof(ThreadMutex), "mesh runtime render_mutex");
   BLI_mutex_init(mesh->runtime.render_mutex);
+  mesh->runtime.vert_coords_mutex = MEM_mallocN(sizeof(ThreadMutex),
+                                                "mesh runtime vert_coords_mutex");
+  BLI_mutex_init(mesh->runtime.vert_coords_mutex);
 }
 
 /**
@@ -63,6 +69,11 @@ static void mesh_runtime_free_mutexes(Mesh *mesh)
     MEM_freeN(mesh->runtime.render_mutex);
     mesh->runtime.render_mutex = NULL;
   }
+  if (mesh->runtime.vert_coords_mutex != NULL) {
+    BLI_mutex_end(mesh->runtime.vert_coords_mutex);
+    MEM_freeN(mesh->runtime.vert_coords_mutex);
+    mesh->runtime.vert_coords_mutex = NULL;
+  }
 }
 
 void BKE_mesh_runtime_init_data(Mesh *mesh)
@@ -81,12 +92,21 @@ void BKE_mesh_runtime_reset_on_copy(Mesh *mesh, const int UNUSED(flag))
   Mesh_Runtime *runtime = &mesh->runtime;
 
   runtime->mesh_eval = NULL;
+  runtime->shared_stack_eval = NULL;
+  BLI_listbase_clear(&runtime->shared_stack_eval_modifiers);
+  memset(&runtime->shared_stack_eval_mask, 0, sizeof(runtime->shared_stack_eval_mask));
   runtime->edit_data = NULL;
   runtime->batch_cache = NULL;
   runtime->subdiv_ccg = NULL;
   memset(&runtime->looptris, 0, sizeof(runtime->looptris));
   runtime->bvh_cache = NULL;
   runtime->shrinkwrap_data = NULL;
+  runtime->vert_coords_cache = NULL;
+  runtime->vert_coords_cache_dirty = false;
+  /* While the copy still shares the source's topology at this point, there is no guarantee it
+   * stays that way, so only explicit stamping by code that controls both meshes may share a
+   * version (see #BKE_mesh_runtime_topology_version_ensure). */
+  runtime->topology_version = 0;
 
   mesh_runtime_init_mutexes(mesh);
 }
@@ -98,6 +118,15 @@ void BKE_mesh_runtime_clear_cache(Mesh *mesh)
     BKE_id_free(NULL, mesh->runtime.mesh_eval);
     mesh->runtime.mesh_eval = NULL;
   }
+  if (mesh->runtime.shared_stack_eval != NULL) {
+    mesh->runtime.shared_stack_eval->edit_mesh = NULL;
+    BKE_id_free(NULL, mesh->runtime.shared_stack_eval);
+    mesh->runtime.shared_stack_eval = NULL;
+  }
+  LISTBASE_FOREACH_MUTABLE (ModifierData *, md, &mesh->runtime.shared_stack_eval_modifiers) {
+    BKE_modifier_free_ex(md, LIB_ID_CREATE_NO_USER_REFCOUNT);
+  }
+  BLI_listbase_clear(&mesh->runtime.shared_stack_eval_modifiers);
   BKE_mesh_runtime_clear_geometry(mesh);
   BKE_mesh_batch_cache_free(mesh);
   BKE_mesh_runtime_clear_edit_data(mesh);
@@ -191,6 +220,56 @@ const MLoopTri *BKE_mesh_runtime_looptri_ensure(const Mesh *mesh)
   return looptri;
 }
 
+int BKE_mesh_runtime_topology_version_ensure(Mesh *mesh)
+{
+  /* Session-wide source of unique topology versions, never resets so a version can not get
+   * re-assigned to an unrelated topology within a session. */
+  static int32_t topology_version_counter = 0;
+
+  int version = mesh->runtime.topology_version;
+  if (version == 0) {
+    /* NOTE: Not strictly thread-safe, two threads may assign two different versions to the same
+     * mesh here. That is harmless though: versions are only ever compared for equality, so a lost
+     * assignment can only cause a cache miss, never a false match. */
+    version = atomic_add_and_fetch_int32(&topology_version_counter, 1);
+    mesh->runtime.topology_version = version;
+  }
+  return version;
+}
+
+void BKE_mesh_runtime_looptri_cache_reuse(const Mesh *mesh_src, Mesh *mesh_dst)
+{
+  BLI_assert(mesh_src->runtime.topology_version != 0 &&
+             mesh_src->runtime.topology_version == mesh_dst->runtime.topology_version);
+  BLI_assert(mesh_src->totloop == mesh_dst->totloop && mesh_src->totpoly == mesh_dst->totpoly);
+
+  if (mesh_dst->runtime.looptris.array != NULL) {
+    return;
+  }
+
+  /* NOTE: This re-uses the triangulation of the un-deformed source mesh. Triangle loop indices
+   * are a valid tessellation for any deformation of the same topology, although strongly
+   * deformed concave quads/ngons may get a different (and more stable across frames)
+   * triangulation than a full recompute from the deformed coordinates would give. */
+  const MLoopTri *looptri_src = BKE_mesh_runtime_looptri_ensure(mesh_src);
+  if (looptri_src == NULL) {
+    return;
+  }
+
+  mesh_ensure_looptri_data(mesh_dst);
+  BLI_assert(mesh_dst->totpoly == 0 || mesh_dst->runtime.looptris.array_wip != NULL);
+
+  memcpy(mesh_dst->runtime.looptris.array_wip,
+         looptri_src,
+         sizeof(*looptri_src) * (size_t)mesh_dst->runtime.looptris.len);
+
+  BLI_assert(mesh_dst->runtime.looptris.array == NULL);
+  atomic_cas_ptr((void **)&mesh_dst->runtime.looptris.array,
+                 mesh_dst->runtime.looptris.array,
+                 mesh_dst->runtime.looptris.array_wip);
+  mesh_dst->runtime.looptris.array_wip = NULL;
+}
+
 void BKE_mesh_runtime_verttri_from_looptri(MVertTri *r_verttri,
                                            const MLoop *mloop,
                                            const MLoopTri *looptri,
@@ -248,6 +327,8 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
     mesh->runtime.bvh_cache = NULL;
   }
   MEM_SAFE_FREE(mesh->runtime.looptris.array);
+  MEM_SAFE_FREE(mesh->runtime.vert_coords_cache);
+  mesh->runtime.topology_version = 0;
   /* TODO(sergey): Does this really belong here? */
   if (mesh->runtime.subdiv_ccg != NULL) {
     BKE_subdiv_ccg_destroy(mesh->runtime.subdiv_ccg);
@@ -669,6 +669,81 @@ static void mesh_recalc_looptri__multi_threaded(const MLoop *mloop,
                           &settings);
 }
 
+struct PartialTessellationUserData {
+  const MLoop *mloop;
+  const MPoly *mpoly;
+  const MVert *mvert;
+
+  /** The polygons to re-tessellate. */
+  const int *poly_indices;
+
+  /** Output array. */
+  MLoopTri *mlooptri;
+};
+
+static void mesh_calc_tessellation_for_poly_index_fn(void *__restrict userdata,
+                                                     const int index,
+                                                     const TaskParallelTLS *__restrict tls)
+{
+  const struct PartialTessellationUserData *data = userdata;
+  struct TessellationUserTLS *tls_data = tls->userdata_chunk;
+  const int poly_index = data->poly_indices[index];
+  const int tri_index = poly_to_tri_count(poly_index, data->mpoly[poly_index].loopstart);
+  mesh_calc_tessellation_for_face_impl(data->mloop,
+                                       data->mpoly,
+                                       data->mvert,
+                                       (uint)poly_index,
+                                       &data->mlooptri[tri_index],
+                                       &tls_data->pf_arena,
+                                       false,
+                                       NULL);
+}
+
+void BKE_mesh_recalc_looptri_polys(const MLoop *mloop,
+                                   const MPoly *mpoly,
+                                   const MVert *mvert,
+                                   const int *poly_indices,
+                                   int polys_num,
+                                   MLoopTri *mlooptri)
+{
+  /* A polygon's slots in the looptri array only depend on the topology (`loopstart` and the
+   * number of triangles of the preceding polygons), so any subset of polygons can be
+   * re-tessellated in place without touching the others. */
+  if (polys_num < MESH_FACE_TESSELLATE_THREADED_LIMIT) {
+    MemArena *pf_arena = NULL;
+    for (int i = 0; i < polys_num; i++) {
+      const int poly_index = poly_indices[i];
+      const int tri_index = poly_to_tri_count(poly_index, mpoly[poly_index].loopstart);
+      mesh_calc_tessellation_for_face(
+          mloop, mpoly, mvert, (uint)poly_index, &mlooptri[tri_index], &pf_arena);
+    }
+    if (pf_arena) {
+      BLI_memarena_free(pf_arena);
+    }
+    return;
+  }
+
+  struct TessellationUserTLS tls_data_dummy = {NULL};
+
+  struct PartialTessellationUserData data = {
+      .mloop = mloop,
+      .mpoly = mpoly,
+      .mvert = mvert,
+      .poly_indices = poly_indices,
+      .mlooptri = mlooptri,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+
+  settings.userdata_chunk = &tls_data_dummy;
+  settings.userdata_chunk_size = sizeof(tls_data_dummy);
+
+  settings.func_free = mesh_calc_tessellation_for_face_free_fn;
+
+  BLI_task_parallel_range(0, polys_num, &data, mesh_calc_tessellation_for_poly_index_fn, &settings);
+}
+
 void BKE_mesh_recalc_looptri(const MLoop *mloop,
                              const MPoly *mpoly,
                              const MVert *mvert,
@@ -2091,8 +2091,10 @@ GPUTexture *BKE_movieclip_get_gpu_texture(MovieClip *clip, MovieClipUser *cuser)
   *tex = IMB_create_gpu_texture(
       clip->id.name + 2, ibuf, high_bitdepth, store_premultiplied, false);
 
-  /* Do not generate mips for movieclips... too slow. */
-  GPU_texture_mipmap_mode(*tex, false, true);
+  if (*tex) {
+    /* Do not generate mips for movieclips... too slow. */
+    GPU_texture_mipmap_mode(*tex, false, true);
+  }
 
   IMB_freeImBuf(ibuf);
 
@@ -244,6 +244,20 @@ static void linear_grid_element_interpolate(LinearGridElement *result,
 /** \name Surface
  * \{ */
 
+typedef struct BaseSurfaceGridsAllocateData {
+  SurfaceGrid *surface_grid;
+  int grid_area;
+} BaseSurfaceGridsAllocateData;
+
+static void base_surface_grids_allocate_task(void *__restrict userdata_v,
+                                             const int grid_index,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BaseSurfaceGridsAllocateData *data = userdata_v;
+  data->surface_grid[grid_index].points = MEM_calloc_arrayN(
+      data->grid_area, sizeof(SurfacePoint), "delta grid displacement");
+}
+
 static void base_surface_grids_allocate(MultiresReshapeSmoothContext *reshape_smooth_context)
 {
   const MultiresReshapeContext *reshape_context = reshape_smooth_context->reshape_context;
@@ -254,10 +268,16 @@ static void base_surface_grids_allocate(MultiresReshapeSmoothContext *reshape_sm
 
   SurfaceGrid *surface_grid = MEM_malloc_arrayN(num_grids, sizeof(SurfaceGrid), "delta grids");
 
-  for (int grid_index = 0; grid_index < num_grids; ++grid_index) {
-    surface_grid[grid_index].points = MEM_calloc_arrayN(
-        grid_area, sizeof(SurfacePoint), "delta grid displacement");
-  }
+  /* The zeroing of the (top-level sized) point grids is what's costly here, spread it over all
+   * threads. */
+  BaseSurfaceGridsAllocateData data = {
+      .surface_grid = surface_grid,
+      .grid_area = grid_area,
+  };
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  BLI_task_parallel_range(
+      0, num_grids, &data, base_surface_grids_allocate_task, &parallel_range_settings);
 
   reshape_smooth_context->base_surface_grids = surface_grid;
 }
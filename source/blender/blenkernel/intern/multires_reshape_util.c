@@ -535,13 +535,52 @@ static void ensure_displacement_grid(MDisps *displacement_grid, const int level)
   allocate_displacement_grid(displacement_grid, level);
 }
 
+typedef struct EnsureGridsTaskData {
+  MDisps *mdisps;
+  GridPaintMask *grid_paint_masks;
+  int level;
+} EnsureGridsTaskData;
+
+static void ensure_displacement_grid_task(void *__restrict userdata_v,
+                                          const int grid_index,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EnsureGridsTaskData *data = userdata_v;
+  ensure_displacement_grid(&data->mdisps[grid_index], data->level);
+}
+
 static void ensure_displacement_grids(Mesh *mesh, const int grid_level)
 {
   const int num_grids = mesh->totloop;
-  MDisps *mdisps = CustomData_get_layer(&mesh->ldata, CD_MDISPS);
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    ensure_displacement_grid(&mdisps[grid_index], grid_level);
+
+  EnsureGridsTaskData data = {
+      .mdisps = CustomData_get_layer(&mesh->ldata, CD_MDISPS),
+      .level = grid_level,
+  };
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  BLI_task_parallel_range(
+      0, num_grids, &data, ensure_displacement_grid_task, &parallel_range_settings);
+}
+
+static void ensure_mask_grid_task(void *__restrict userdata_v,
+                                  const int grid_index,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EnsureGridsTaskData *data = userdata_v;
+  GridPaintMask *grid_paint_mask = &data->grid_paint_masks[grid_index];
+  if (grid_paint_mask->level >= data->level) {
+    return;
   }
+  const int grid_size = BKE_subdiv_grid_size_from_level(data->level);
+  const int grid_area = grid_size * grid_size;
+  grid_paint_mask->level = data->level;
+  if (grid_paint_mask->data) {
+    MEM_freeN(grid_paint_mask->data);
+  }
+  /* TODO(sergey): Preserve data on the old level. */
+  grid_paint_mask->data = MEM_calloc_arrayN(grid_area, sizeof(float), "gpm.data");
 }
 
 static void ensure_mask_grids(Mesh *mesh, const int level)
@@ -551,20 +590,15 @@ static void ensure_mask_grids(Mesh *mesh, const int level)
     return;
   }
   const int num_grids = mesh->totloop;
-  const int grid_size = BKE_subdiv_grid_size_from_level(level);
-  const int grid_area = grid_size * grid_size;
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    GridPaintMask *grid_paint_mask = &grid_paint_masks[grid_index];
-    if (grid_paint_mask->level >= level) {
-      continue;
-    }
-    grid_paint_mask->level = level;
-    if (grid_paint_mask->data) {
-      MEM_freeN(grid_paint_mask->data);
-    }
-    /* TODO(sergey): Preserve data on the old level. */
-    grid_paint_mask->data = MEM_calloc_arrayN(grid_area, sizeof(float), "gpm.data");
-  }
+
+  EnsureGridsTaskData data = {
+      .grid_paint_masks = grid_paint_masks,
+      .level = level,
+  };
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  BLI_task_parallel_range(0, num_grids, &data, ensure_mask_grid_task, &parallel_range_settings);
 }
 
 void multires_reshape_ensure_grids(Mesh *mesh, const int level)
@@ -579,6 +613,32 @@ void multires_reshape_ensure_grids(Mesh *mesh, const int level)
 /** \name Displacement, space conversion
  * \{ */
 
+typedef struct StoreOriginalGridsTaskData {
+  MDisps *orig_mdisps;
+  GridPaintMask *orig_grid_paint_masks;
+} StoreOriginalGridsTaskData;
+
+static void store_original_grids_task(void *__restrict userdata_v,
+                                      const int grid_index,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  StoreOriginalGridsTaskData *data = userdata_v;
+  MDisps *orig_grid = &data->orig_mdisps[grid_index];
+  /* Ignore possibly invalid/non-allocated original grids. They will be replaced with 0 original
+   * data when accessed during reshape process.
+   * Reshape process will ensure all grids are on top level, but that happens on separate set of
+   * grids which eventually replaces original one. */
+  if (orig_grid->disps != NULL) {
+    orig_grid->disps = MEM_dupallocN(orig_grid->disps);
+  }
+  if (data->orig_grid_paint_masks != NULL) {
+    GridPaintMask *orig_paint_mask_grid = &data->orig_grid_paint_masks[grid_index];
+    if (orig_paint_mask_grid->data != NULL) {
+      orig_paint_mask_grid->data = MEM_dupallocN(orig_paint_mask_grid->data);
+    }
+  }
+}
+
 void multires_reshape_store_original_grids(MultiresReshapeContext *reshape_context)
 {
   const MDisps *mdisps = reshape_context->mdisps;
@@ -591,22 +651,17 @@ void multires_reshape_store_original_grids(MultiresReshapeContext *reshape_conte
   }
 
   const int num_grids = reshape_context->num_grids;
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    MDisps *orig_grid = &orig_mdisps[grid_index];
-    /* Ignore possibly invalid/non-allocated original grids. They will be replaced with 0 original
-     * data when accessed during reshape process.
-     * Reshape process will ensure all grids are on top level, but that happens on separate set of
-     * grids which eventually replaces original one. */
-    if (orig_grid->disps != NULL) {
-      orig_grid->disps = MEM_dupallocN(orig_grid->disps);
-    }
-    if (orig_grid_paint_masks != NULL) {
-      GridPaintMask *orig_paint_mask_grid = &orig_grid_paint_masks[grid_index];
-      if (orig_paint_mask_grid->data != NULL) {
-        orig_paint_mask_grid->data = MEM_dupallocN(orig_paint_mask_grid->data);
-      }
-    }
-  }
+
+  StoreOriginalGridsTaskData data = {
+      .orig_mdisps = orig_mdisps,
+      .orig_grid_paint_masks = orig_grid_paint_masks,
+  };
+
+  /* Duplicating the grids is a big memcpy which threads well on high-resolution meshes. */
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  BLI_task_parallel_range(
+      0, num_grids, &data, store_original_grids_task, &parallel_range_settings);
 
   reshape_context->orig.mdisps = orig_mdisps;
   reshape_context->orig.grid_paint_masks = orig_grid_paint_masks;
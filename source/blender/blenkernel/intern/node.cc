@@ -68,6 +68,7 @@
 #include "NOD_composite.h"
 #include "NOD_function.h"
 #include "NOD_geometry.h"
+#include "NOD_geometry_nodes_eval_cache.hh"
 #include "NOD_node_declaration.hh"
 #include "NOD_node_tree_ref.hh"
 #include "NOD_shader.h"
@@ -206,6 +207,9 @@ static void ntree_copy_data(Main *UNUSED(bmain), ID *id_dst, const ID *id_src, c
         *ntree_src->field_inferencing_interface);
   }
 
+  /* The evaluation cache references the source tree, so it cannot be shared with the copy. */
+  ntree_dst->geometry_nodes_eval_cache = nullptr;
+
   if (flag & LIB_ID_COPY_NO_PREVIEW) {
     ntree_dst->preview = nullptr;
   }
@@ -257,6 +261,7 @@ static void ntree_free_data(ID *id)
   }
 
   delete ntree->field_inferencing_interface;
+  delete ntree->geometry_nodes_eval_cache;
 
   /* free preview hash */
   if (ntree->previews) {
@@ -668,6 +673,7 @@ void ntreeBlendReadData(BlendDataReader *reader, bNodeTree *ntree)
   ntree->execdata = nullptr;
 
   ntree->field_inferencing_interface = nullptr;
+  ntree->geometry_nodes_eval_cache = nullptr;
   BKE_ntree_update_tag_missing_runtime_data(ntree);
 
   BLO_read_data_address(reader, &ntree->adt);
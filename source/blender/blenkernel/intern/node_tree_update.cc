@@ -18,10 +18,12 @@
 
 #include "MOD_nodes.h"
 
+#include "NOD_geometry_nodes_eval_cache.hh"
 #include "NOD_node_declaration.hh"
 #include "NOD_node_tree_ref.hh"
 #include "NOD_texture.h"
 
+#include "DEG_depsgraph_build.h"
 #include "DEG_depsgraph_query.h"
 
 using namespace blender::nodes;
@@ -971,6 +973,10 @@ class NodeTreeMainUpdater {
   {
     TreeUpdateResult result;
 
+    /* The cached evaluation state is derived from the tree, so any change invalidates it. */
+    delete ntree.geometry_nodes_eval_cache;
+    ntree.geometry_nodes_eval_cache = nullptr;
+
     /* Use a #NodeTreeRef to speedup certain queries. It is rebuilt whenever the node tree topology
      * changes, which typically happens zero or one times during the entire update of the node
      * tree. */
@@ -1290,6 +1296,13 @@ class NodeTreeMainUpdater {
         tree, tree_output_sockets);
     btree.output_topology_hash = new_topology_hash;
 
+    if (old_topology_hash != new_topology_hash) {
+      /* The relations in the dependency graph between node groups and the trees using them only
+       * cover group nodes which are connected to the output, so they have to be rebuilt when the
+       * topology towards the output changes. */
+      DEG_relations_tag_update(bmain_);
+    }
+
     if (const AnimData *adt = BKE_animdata_from_id(&btree.id)) {
       /* Drivers may copy values in the node tree around arbitrarily and may cause the output to
        * change even if it wouldn't without drivers. Only some special drivers like `frame/5` can
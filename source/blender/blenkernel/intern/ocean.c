@@ -420,8 +420,8 @@ static void ocean_compute_htilda(void *__restrict userdata,
     fftw_complex exp_param2;
     fftw_complex conj_param;
 
-    init_complex(exp_param1, 0.0, omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
-    init_complex(exp_param2, 0.0, -omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
+    init_complex(exp_param1, 0.0, o->_omega[i * (1 + o->_N / 2) + j] * t);
+    init_complex(exp_param2, 0.0, -o->_omega[i * (1 + o->_N / 2) + j] * t);
     exp_complex(exp_param1, exp_param1);
     exp_complex(exp_param2, exp_param2);
     conj_complex(conj_param, o->_h0_minus[i * o->_N + j]);
@@ -434,6 +434,127 @@ static void ocean_compute_htilda(void *__restrict userdata,
   }
 }
 
+/**
+ * Compute the FFT input spectra of all enabled stages for one row of the grid. These only
+ * depend on the new `htilda` of the same row, so this is a second embarrassingly parallel
+ * pass; the task pool afterwards then mostly runs the FFTW plans themselves.
+ */
+static void ocean_compute_spectra(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  OceanSimulateData *osd = userdata;
+  const Ocean *o = osd->o;
+  const float scale = osd->scale;
+  const float chop_amount = osd->chop_amount;
+  int j;
+
+  for (j = 0; j <= o->_N / 2; j++) {
+    if (o->_do_chop) {
+      {
+        fftw_complex mul_param;
+        fftw_complex minus_i;
+
+        init_complex(minus_i, 0.0, -1.0);
+        init_complex(mul_param, -scale, 0);
+        mul_complex_f(mul_param, mul_param, chop_amount);
+        mul_complex_c(mul_param, mul_param, minus_i);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param,
+                      mul_param,
+                      ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                           0.0f :
+                           o->_kx[i] / o->_k[i * (1 + o->_N / 2) + j]));
+        init_complex(o->_fft_in_x[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+      {
+        fftw_complex mul_param;
+        fftw_complex minus_i;
+
+        init_complex(minus_i, 0.0, -1.0);
+        init_complex(mul_param, -scale, 0);
+        mul_complex_f(mul_param, mul_param, chop_amount);
+        mul_complex_c(mul_param, mul_param, minus_i);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param,
+                      mul_param,
+                      ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                           0.0f :
+                           o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
+        init_complex(o->_fft_in_z[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+    }
+    if (o->_do_jacobian) {
+      {
+        fftw_complex mul_param;
+
+        // init_complex(mul_param, -scale, 0);
+        init_complex(mul_param, -1, 0);
+
+        mul_complex_f(mul_param, mul_param, chop_amount);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param,
+                      mul_param,
+                      ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                           0.0f :
+                           o->_kx[i] * o->_kx[i] / o->_k[i * (1 + o->_N / 2) + j]));
+        init_complex(
+            o->_fft_in_jxx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+      {
+        fftw_complex mul_param;
+
+        // init_complex(mul_param, -scale, 0);
+        init_complex(mul_param, -1, 0);
+
+        mul_complex_f(mul_param, mul_param, chop_amount);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param,
+                      mul_param,
+                      ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                           0.0f :
+                           o->_kz[j] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
+        init_complex(
+            o->_fft_in_jzz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+      {
+        fftw_complex mul_param;
+
+        // init_complex(mul_param, -scale, 0);
+        init_complex(mul_param, -1, 0);
+
+        mul_complex_f(mul_param, mul_param, chop_amount);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param,
+                      mul_param,
+                      ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                           0.0f :
+                           o->_kx[i] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
+        init_complex(
+            o->_fft_in_jxz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+    }
+    if (o->_do_normals) {
+      {
+        fftw_complex mul_param;
+
+        init_complex(mul_param, 0.0, -1.0);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param, mul_param, o->_kx[i]);
+        init_complex(o->_fft_in_nx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+      {
+        fftw_complex mul_param;
+
+        init_complex(mul_param, 0.0, -1.0);
+        mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+        mul_complex_f(mul_param, mul_param, o->_kz[i]);
+        init_complex(o->_fft_in_nz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      }
+    }
+  }
+}
+
 static void ocean_compute_displacement_y(TaskPool *__restrict pool, void *UNUSED(taskdata))
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
@@ -446,28 +567,7 @@ static void ocean_compute_displacement_x(TaskPool *__restrict pool, void *UNUSED
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  const float scale = osd->scale;
-  const float chop_amount = osd->chop_amount;
-  int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-      fftw_complex minus_i;
-
-      init_complex(minus_i, 0.0, -1.0);
-      init_complex(mul_param, -scale, 0);
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, minus_i);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kx[i] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_x[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_disp_x_plan);
 }
 
@@ -475,28 +575,7 @@ static void ocean_compute_displacement_z(TaskPool *__restrict pool, void *UNUSED
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  const float scale = osd->scale;
-  const float chop_amount = osd->chop_amount;
-  int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-      fftw_complex minus_i;
-
-      init_complex(minus_i, 0.0, -1.0);
-      init_complex(mul_param, -scale, 0);
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, minus_i);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_z[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_disp_z_plan);
 }
 
@@ -504,26 +583,8 @@ static void ocean_compute_jacobian_jxx(TaskPool *__restrict pool, void *UNUSED(t
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  const float chop_amount = osd->chop_amount;
   int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      // init_complex(mul_param, -scale, 0);
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kx[i] * o->_kx[i] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jxx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_Jxx_plan);
 
   for (i = 0; i < o->_M; i++) {
@@ -537,26 +598,8 @@ static void ocean_compute_jacobian_jzz(TaskPool *__restrict pool, void *UNUSED(t
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  const float chop_amount = osd->chop_amount;
   int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      // init_complex(mul_param, -scale, 0);
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kz[j] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jzz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_Jzz_plan);
 
   for (i = 0; i < o->_M; i++) {
@@ -570,26 +613,7 @@ static void ocean_compute_jacobian_jxz(TaskPool *__restrict pool, void *UNUSED(t
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  const float chop_amount = osd->chop_amount;
-  int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      // init_complex(mul_param, -scale, 0);
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kx[i] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jxz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_Jxz_plan);
 }
 
@@ -597,18 +621,7 @@ static void ocean_compute_normal_x(TaskPool *__restrict pool, void *UNUSED(taskd
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  int i, j;
 
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      init_complex(mul_param, 0.0, -1.0);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param, mul_param, o->_kx[i]);
-      init_complex(o->_fft_in_nx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_N_x_plan);
 }
 
@@ -616,18 +629,7 @@ static void ocean_compute_normal_z(TaskPool *__restrict pool, void *UNUSED(taskd
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
-  int i, j;
-
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
 
-      init_complex(mul_param, 0.0, -1.0);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param, mul_param, o->_kz[i]);
-      init_complex(o->_fft_in_nz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
-    }
-  }
   fftw_execute(o->_N_z_plan);
 }
 
@@ -666,6 +668,12 @@ void BKE_ocean_simulate(struct Ocean *o, float t, float scale, float chop_amount
   settings.use_threading = (o->_M > 16);
   BLI_task_parallel_range(0, o->_M, &osd, ocean_compute_htilda, &settings);
 
+  /* Compute the input spectra of all other stages in a second parallel pass,
+   * they all depend on htilda only. The tasks below then run the FFT's. */
+  if (o->_do_chop || o->_do_jacobian || o->_do_normals) {
+    BLI_task_parallel_range(0, o->_M, &osd, ocean_compute_spectra, &settings);
+  }
+
   if (o->_do_disp_y) {
     BLI_task_pool_push(pool, ocean_compute_displacement_y, NULL, false, NULL);
   }
@@ -847,6 +855,7 @@ bool BKE_ocean_init(struct Ocean *o,
    * In this case however a large resolution can easily perform large allocations that fail,
    * support early exiting in this case. */
   if ((o->_k = (float *)MEM_mallocN(sizeof(float) * (size_t)M * (1 + N / 2), "ocean_k")) &&
+      (o->_omega = (float *)MEM_mallocN(sizeof(float) * (size_t)M * (1 + N / 2), "ocean_omega")) &&
       (o->_h0 = (fftw_complex *)MEM_mallocN(sizeof(fftw_complex) * (size_t)M * N, "ocean_h0")) &&
       (o->_h0_minus = (fftw_complex *)MEM_mallocN(sizeof(fftw_complex) * (size_t)M * N,
                                                   "ocean_h0_minus")) &&
@@ -856,6 +865,7 @@ bool BKE_ocean_init(struct Ocean *o,
   }
   else {
     MEM_SAFE_FREE(o->_k);
+    MEM_SAFE_FREE(o->_omega);
     MEM_SAFE_FREE(o->_h0);
     MEM_SAFE_FREE(o->_h0_minus);
     MEM_SAFE_FREE(o->_kx);
@@ -907,6 +917,15 @@ bool BKE_ocean_init(struct Ocean *o,
     }
   }
 
+  /* Pre-calculate the dispersion relation, it only depends on the wave vector and the depth,
+   * so there is no need to evaluate it again for every simulated frame. */
+  for (i = 0; i < o->_M; i++) {
+    for (j = 0; j <= o->_N / 2; j++) {
+      o->_omega[(size_t)i * (1 + o->_N / 2) + j] = omega(o->_k[(size_t)i * (1 + o->_N / 2) + j],
+                                                         o->_depth);
+    }
+  }
+
   RNG *rng = BLI_rng_new(seed);
 
   for (i = 0; i < o->_M; i++) {
@@ -1090,6 +1109,7 @@ void BKE_ocean_free_data(struct Ocean *oc)
   if (oc->_htilda) {
     MEM_freeN(oc->_htilda);
     MEM_freeN(oc->_k);
+    MEM_freeN(oc->_omega);
     MEM_freeN(oc->_h0);
     MEM_freeN(oc->_h0_minus);
     MEM_freeN(oc->_kx);
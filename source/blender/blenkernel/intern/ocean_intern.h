@@ -107,6 +107,10 @@ typedef struct Ocean {
 
   /* two dimensional float array */
   float *_k; /* init w   sim r */
+
+  /* two dimensional float array */
+  /* Dispersion relation (omega) per wave vector, only depends on `_k` and `_depth`. */
+  float *_omega; /* init w   sim r */
 } Ocean;
 #else
 /* stub */
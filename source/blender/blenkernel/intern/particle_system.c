@@ -1297,60 +1297,10 @@ void psys_get_pointcache_start_end(Scene *scene, ParticleSystem *psys, int *sfra
   *efra = min_ii((int)(part->end + part->lifetime + 1.0f), max_ii(scene->r.pefra, scene->r.efra));
 }
 
-/* BVH tree balancing inside a mutex lock must be run in isolation. Balancing
- * is multithreaded, and we do not want the current thread to start another task
- * that may involve acquiring the same mutex lock that it is waiting for. */
-static void bvhtree_balance_isolated(void *userdata)
-{
-  BLI_bvhtree_balance((BVHTree *)userdata);
-}
-
 /************************************************/
 /*          Effectors                           */
 /************************************************/
 
-static void psys_update_particle_bvhtree(ParticleSystem *psys, float cfra)
-{
-  if (psys) {
-    PARTICLE_P;
-    int totpart = 0;
-    bool need_rebuild;
-
-    BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
-    need_rebuild = !psys->bvhtree || psys->bvhtree_frame != cfra;
-    BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
-
-    if (need_rebuild) {
-      LOOP_SHOWN_PARTICLES
-      {
-        totpart++;
-      }
-
-      BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_WRITE);
-
-      BLI_bvhtree_free(psys->bvhtree);
-      psys->bvhtree = BLI_bvhtree_new(totpart, 0.0, 4, 6);
-
-      LOOP_SHOWN_PARTICLES
-      {
-        if (pa->alive == PARS_ALIVE) {
-          if (pa->state.time == cfra) {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->prev_state.co, 1);
-          }
-          else {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->state.co, 1);
-          }
-        }
-      }
-
-      BLI_task_isolate(bvhtree_balance_isolated, psys->bvhtree);
-
-      psys->bvhtree_frame = cfra;
-
-      BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
-    }
-  }
-}
 void psys_update_particle_tree(ParticleSystem *psys, float cfra)
 {
   if (psys) {
@@ -1659,6 +1609,154 @@ static EdgeHash *sph_springhash_build(ParticleSystem *psys)
   return springhash;
 }
 
+/* Hashed uniform grid for SPH neighbor queries. Particles are binned into cells of roughly
+ * the interaction radius, so a range query only visits the cells around the query point
+ * instead of descending a tree. Rebinning is linear in the particle count, much cheaper
+ * than rebuilding and balancing a BVH tree every step. Positions are frozen at bin time,
+ * like they were in the BVH tree, since particle state is updated concurrently while
+ * neighbors are evaluated. */
+typedef struct SPHNeighborGrid {
+  float cell_size_inv;
+  /* Power of two hash table size. Distinct cells may share a bucket; the query filters
+   * candidates by their exact cell, so collisions cost time, never correctness. */
+  uint nbuckets;
+  /** Offset of each bucket in #indices, nbuckets + 1 entries. */
+  uint *bucket_start;
+  /** Binned particle indices, grouped by bucket. */
+  int *indices;
+  /** Position each particle was binned with, indexed by particle. */
+  float (*co)[3];
+} SPHNeighborGrid;
+
+BLI_INLINE void sph_neighbor_grid_cell(const SPHNeighborGrid *grid, const float co[3], int cell[3])
+{
+  cell[0] = (int)floorf(co[0] * grid->cell_size_inv);
+  cell[1] = (int)floorf(co[1] * grid->cell_size_inv);
+  cell[2] = (int)floorf(co[2] * grid->cell_size_inv);
+}
+
+BLI_INLINE uint sph_neighbor_grid_bucket(const SPHNeighborGrid *grid, const int cell[3])
+{
+  /* Standard spatial hash with large primes. */
+  return ((uint)cell[0] * 73856093u ^ (uint)cell[1] * 19349663u ^ (uint)cell[2] * 83492791u) &
+         (grid->nbuckets - 1);
+}
+
+static SPHNeighborGrid *sph_neighbor_grid_build(ParticleSystem *psys, float cell_size)
+{
+  SPHNeighborGrid *grid = MEM_callocN(sizeof(SPHNeighborGrid), "SPHNeighborGrid");
+  uint *cursor;
+  uint i;
+  int cell[3];
+  int totbinned = 0;
+  PARTICLE_P;
+
+  grid->cell_size_inv = 1.0f / max_ff(cell_size, FLT_EPSILON);
+
+  grid->nbuckets = 1;
+  while (grid->nbuckets < (uint)psys->totpart) {
+    grid->nbuckets <<= 1;
+  }
+
+  grid->bucket_start = MEM_callocN(sizeof(uint) * (grid->nbuckets + 1), "SPHNeighborGrid buckets");
+
+  if (psys->totpart == 0) {
+    return grid;
+  }
+
+  grid->co = MEM_mallocN(sizeof(float[3]) * psys->totpart, "SPHNeighborGrid co");
+
+  /* Count particles per bucket. Like the BVH tree this replaces, only living particles
+   * take part in the interactions. */
+  LOOP_SHOWN_PARTICLES
+  {
+    if (pa->alive == PARS_ALIVE) {
+      copy_v3_v3(grid->co[p], pa->state.co);
+      sph_neighbor_grid_cell(grid, grid->co[p], cell);
+      grid->bucket_start[sph_neighbor_grid_bucket(grid, cell) + 1]++;
+      totbinned++;
+    }
+  }
+
+  for (i = 1; i <= grid->nbuckets; i++) {
+    grid->bucket_start[i] += grid->bucket_start[i - 1];
+  }
+
+  if (totbinned == 0) {
+    return grid;
+  }
+
+  grid->indices = MEM_mallocN(sizeof(int) * totbinned, "SPHNeighborGrid indices");
+
+  cursor = MEM_mallocN(sizeof(uint) * grid->nbuckets, "SPHNeighborGrid cursor");
+  memcpy(cursor, grid->bucket_start, sizeof(uint) * grid->nbuckets);
+
+  LOOP_SHOWN_PARTICLES
+  {
+    if (pa->alive == PARS_ALIVE) {
+      sph_neighbor_grid_cell(grid, grid->co[p], cell);
+      grid->indices[cursor[sph_neighbor_grid_bucket(grid, cell)]++] = p;
+    }
+  }
+
+  MEM_freeN(cursor);
+
+  return grid;
+}
+
+static void sph_neighbor_grid_free(SPHNeighborGrid *grid)
+{
+  if (grid == NULL) {
+    return;
+  }
+  MEM_freeN(grid->bucket_start);
+  MEM_SAFE_FREE(grid->indices);
+  MEM_SAFE_FREE(grid->co);
+  MEM_freeN(grid);
+}
+
+static void sph_neighbor_grid_query(const SPHNeighborGrid *grid,
+                                    const float co[3],
+                                    float radius,
+                                    BVHTree_RangeQuery callback,
+                                    void *userdata)
+{
+  const float radius_sq = radius * radius;
+  int cell_min[3], cell_max[3], cell[3], candidate_cell[3];
+  float corner[3];
+  uint i;
+
+  sub_v3_v3v3(corner, co, (float[3]){radius, radius, radius});
+  sph_neighbor_grid_cell(grid, corner, cell_min);
+  add_v3_v3v3(corner, co, (float[3]){radius, radius, radius});
+  sph_neighbor_grid_cell(grid, corner, cell_max);
+
+  for (cell[2] = cell_min[2]; cell[2] <= cell_max[2]; cell[2]++) {
+    for (cell[1] = cell_min[1]; cell[1] <= cell_max[1]; cell[1]++) {
+      for (cell[0] = cell_min[0]; cell[0] <= cell_max[0]; cell[0]++) {
+        const uint bucket = sph_neighbor_grid_bucket(grid, cell);
+
+        for (i = grid->bucket_start[bucket]; i < grid->bucket_start[bucket + 1]; i++) {
+          const int index = grid->indices[i];
+
+          /* Filter out hash collisions from other cells. This also guarantees every
+           * particle is visited exactly once when two cells share a bucket. */
+          sph_neighbor_grid_cell(grid, grid->co[index], candidate_cell);
+          if (candidate_cell[0] != cell[0] || candidate_cell[1] != cell[1] ||
+              candidate_cell[2] != cell[2]) {
+            continue;
+          }
+
+          const float dist_sq = len_squared_v3v3(grid->co[index], co);
+          if (dist_sq <= radius_sq) {
+            callback(userdata, index, co, dist_sq);
+          }
+        }
+      }
+    }
+  }
+}
+
 #define SPH_NEIGHBORS 512
 typedef struct SPHNeighbor {
   ParticleSystem *psys;
@@ -1681,12 +1779,13 @@ typedef struct SPHRangeData {
 } SPHRangeData;
 
 static void sph_evaluate_func(BVHTree *tree,
-                              ParticleSystem **psys,
+                              SPHData *sphdata,
                               const float co[3],
                               SPHRangeData *pfr,
                               float interaction_radius,
                               BVHTree_RangeQuery callback)
 {
+  ParticleSystem **psys = sphdata->psys;
   int i;
 
   pfr->tot_neighbors = 0;
@@ -1701,9 +1800,17 @@ static void sph_evaluate_func(BVHTree *tree,
       break;
     }
 
+    if (sphdata->grids[i]) {
+      /* The grid is immutable for the duration of the solve, no locking needed. */
+      sph_neighbor_grid_query(sphdata->grids[i], co, interaction_radius, callback, pfr);
+      continue;
+    }
+
     BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
 
-    BLI_bvhtree_range_query(psys[i]->bvhtree, co, interaction_radius, callback, pfr);
+    if (psys[i]->bvhtree) {
+      BLI_bvhtree_range_query(psys[i]->bvhtree, co, interaction_radius, callback, pfr);
+    }
 
     BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
   }
@@ -1825,7 +1932,7 @@ static void sph_force_cb(void *sphdata_v, ParticleKey *state, float *force, floa
   pfr.pa = pa;
   pfr.mass = sphdata->mass;
 
-  sph_evaluate_func(NULL, psys, state->co, &pfr, interaction_radius, sph_density_accum_cb);
+  sph_evaluate_func(NULL, sphdata, state->co, &pfr, interaction_radius, sph_density_accum_cb);
 
   density = data[0];
   near_density = data[1];
@@ -2018,7 +2125,7 @@ static void sphclassical_force_cb(void *sphdata_v,
   pfr.pa = pa;
 
   sph_evaluate_func(
-      NULL, psys, state->co, &pfr, interaction_radius, sphclassical_neighbor_accum_cb);
+      NULL, sphdata, state->co, &pfr, interaction_radius, sphclassical_neighbor_accum_cb);
   pressure = stiffness * (pow7f(pa->sphdensity / rest_density) - 1.0f);
 
   /* multiply by mass so that we return a force, not accel */
@@ -2102,7 +2209,7 @@ static void sphclassical_calc_dens(ParticleData *pa, float UNUSED(dfra), SPHData
   pfr.mass = sphdata->mass;
 
   sph_evaluate_func(
-      NULL, psys, pa->state.co, &pfr, interaction_radius, sphclassical_density_accum_cb);
+      NULL, sphdata, pa->state.co, &pfr, interaction_radius, sphclassical_density_accum_cb);
   pa->sphdensity = min_ff(max_ff(data[0], fluid->rest_density * 0.9f), fluid->rest_density * 1.1f);
 }
 
@@ -2127,6 +2234,23 @@ void psys_sph_init(ParticleSimulationData *sim, SPHData *sphdata)
   }
   sphdata->eh = sph_springhash_build(sim->psys);
 
+  /* Neighbor grids replace the per-step BVH tree rebuild for neighbor lookups. The cell
+   * size follows the typical interaction radius; per-particle radii only change how many
+   * cells a query visits, not its result. */
+  {
+    SPHFluidSettings *fluid = sim->psys->part->fluid;
+    const float interaction_radius = fluid->radius *
+                                     ((fluid->flag & SPH_FAC_RADIUS) ?
+                                          4.0f * sim->psys->part->size :
+                                          1.0f);
+
+    for (i = 0; i < 10; i++) {
+      sphdata->grids[i] = sphdata->psys[i] ?
+                              sph_neighbor_grid_build(sphdata->psys[i], interaction_radius) :
+                              NULL;
+    }
+  }
+
   /* These per-particle values should be overridden later, but just for
    * completeness we give them default values now. */
   sphdata->pa = NULL;
@@ -2163,6 +2287,11 @@ void psys_sph_finalize(SPHData *sphdata)
     BLI_edgehash_free(sphdata->eh, NULL);
     sphdata->eh = NULL;
   }
+
+  for (int i = 0; i < 10; i++) {
+    sph_neighbor_grid_free(sphdata->grids[i]);
+    sphdata->grids[i] = NULL;
+  }
 }
 
 void psys_sph_density(BVHTree *tree, SPHData *sphdata, float co[3], float vars[2])
@@ -2180,7 +2309,7 @@ void psys_sph_density(BVHTree *tree, SPHData *sphdata, float co[3], float vars[2
   pfr.h = interaction_radius * sphdata->hfac;
   pfr.mass = sphdata->mass;
 
-  sph_evaluate_func(tree, psys, co, &pfr, interaction_radius, sphdata->density_cb);
+  sph_evaluate_func(tree, sphdata, co, &pfr, interaction_radius, sphdata->density_cb);
 
   vars[0] = pfr.data[0];
   vars[1] = pfr.data[1];
@@ -3871,18 +4000,10 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
       }
       break;
     }
-    case PART_PHYS_FLUID: {
-      ParticleTarget *pt = psys->targets.first;
-      psys_update_particle_bvhtree(psys, cfra);
-
-      for (; pt;
-           pt = pt->next) { /* Updating others systems particle tree for fluid-fluid interaction */
-        if (pt->ob) {
-          psys_update_particle_bvhtree(BLI_findlink(&pt->ob->particlesystem, pt->psys - 1), cfra);
-        }
-      }
+    case PART_PHYS_FLUID:
+      /* SPH neighbor grids are built in psys_sph_init() below, after the particle
+       * states have been initialized. */
       break;
-    }
   }
   /* initialize all particles for dynamics */
   LOOP_SHOWN_PARTICLES
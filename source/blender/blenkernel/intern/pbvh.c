@@ -2792,6 +2792,71 @@ float (*BKE_pbvh_vert_coords_alloc(PBVH *pbvh))[3]
   return vertCos;
 }
 
+/**
+ * Propagate moved vertices (tagged in #PBVH.vert_bitmap) to the tessellation and the nodes,
+ * so that only the affected part of the mesh is updated:
+ *
+ * - Re-tessellate the polygons using a moved vertex in place (a polygon's slots in the looptri
+ *   array only depend on the topology), since the triangulation of concave quads and ngons
+ *   depends on the vertex positions.
+ * - Mark only the nodes containing an affected triangle for updates. This satisfies the
+ *   requirements of #pbvh_faces_update_normals: every node with a face adjacent to a moved
+ *   vertex is marked, so the deferred incremental normal update stays complete.
+ */
+static void pbvh_faces_update_moved_verts(PBVH *pbvh)
+{
+  BLI_assert(pbvh->type == PBVH_FACES);
+
+  const int totpoly = pbvh->mesh->totpoly;
+  BLI_bitmap *moved_polys = BLI_BITMAP_NEW(totpoly, __func__);
+  int moved_polys_num = 0;
+
+  for (int i = 0; i < totpoly; i++) {
+    const MPoly *mp = &pbvh->mpoly[i];
+    const MLoop *ml = &pbvh->mloop[mp->loopstart];
+    for (int j = 0; j < mp->totloop; j++, ml++) {
+      if (BLI_BITMAP_TEST(pbvh->vert_bitmap, ml->v)) {
+        BLI_BITMAP_ENABLE(moved_polys, i);
+        moved_polys_num++;
+        break;
+      }
+    }
+  }
+
+  if (moved_polys_num != 0) {
+    int *poly_indices = MEM_malloc_arrayN((size_t)moved_polys_num, sizeof(int), __func__);
+    int poly_indices_num = 0;
+    for (int i = 0; i < totpoly; i++) {
+      if (BLI_BITMAP_TEST(moved_polys, i)) {
+        poly_indices[poly_indices_num++] = i;
+      }
+    }
+    /* The looptri array is owned by the PBVH (see #BKE_pbvh_free), in-place update is fine. */
+    BKE_mesh_recalc_looptri_polys(pbvh->mloop,
+                                  pbvh->mpoly,
+                                  pbvh->verts,
+                                  poly_indices,
+                                  moved_polys_num,
+                                  (MLoopTri *)pbvh->looptri);
+    MEM_freeN(poly_indices);
+  }
+
+  for (int n = 0; n < pbvh->totnode; n++) {
+    PBVHNode *node = &pbvh->nodes[n];
+    if (!(node->flag & PBVH_Leaf)) {
+      continue;
+    }
+    for (int i = 0; i < node->totprim; i++) {
+      if (BLI_BITMAP_TEST(moved_polys, pbvh->looptri[node->prim_indices[i]].poly)) {
+        BKE_pbvh_node_mark_update(node);
+        break;
+      }
+    }
+  }
+
+  MEM_freeN(moved_polys);
+}
+
 void BKE_pbvh_vert_coords_apply(PBVH *pbvh, const float (*vertCos)[3], const int totvert)
 {
   if (totvert != pbvh->totvert) {
@@ -2815,24 +2880,24 @@ void BKE_pbvh_vert_coords_apply(PBVH *pbvh, const float (*vertCos)[3], const int
 
   if (pbvh->verts) {
     MVert *mvert = pbvh->verts;
+    bool changed = false;
     /* copy new verts coords */
     for (int a = 0; a < pbvh->totvert; a++, mvert++) {
       /* no need for float comparison here (memory is exactly equal or not) */
       if (memcmp(mvert->co, vertCos[a], sizeof(float[3])) != 0) {
         copy_v3_v3(mvert->co, vertCos[a]);
         BKE_pbvh_vert_mark_update(pbvh, a);
+        changed = true;
       }
     }
 
-    /* coordinates are new -- normals should also be updated */
-    BKE_mesh_calc_normals_looptri(
-        pbvh->verts, pbvh->totvert, pbvh->mloop, pbvh->looptri, pbvh->totprim, NULL);
+    if (changed) {
+      /* Re-tessellate the affected polygons and mark only the affected nodes, the incremental
+       * normal update (see #BKE_pbvh_update_normals) takes care of the rest before drawing. */
+      pbvh_faces_update_moved_verts(pbvh);
 
-    for (int a = 0; a < pbvh->totnode; a++) {
-      BKE_pbvh_node_mark_update(&pbvh->nodes[a]);
+      BKE_pbvh_update_bounds(pbvh, PBVH_UpdateBB | PBVH_UpdateOriginalBB);
     }
-
-    BKE_pbvh_update_bounds(pbvh, PBVH_UpdateBB | PBVH_UpdateOriginalBB);
   }
 }
 
@@ -11,6 +11,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.h"
@@ -1642,21 +1643,59 @@ bool pbvh_bmesh_node_nearest_to_ray(PBVHNode *node,
   return hit;
 }
 
+static void pbvh_bmesh_face_normals_update_task_cb(void *__restrict userdata,
+                                                   const int n,
+                                                   const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHNode **nodes = userdata;
+  PBVHNode *node = nodes[n];
+
+  if (node->flag & PBVH_UpdateNormals) {
+    GSetIterator gs_iter;
+
+    GSET_ITER (gs_iter, node->bm_faces) {
+      BM_face_normal_update(BLI_gsetIterator_getKey(&gs_iter));
+    }
+  }
+}
+
+static void pbvh_bmesh_vert_normals_update_task_cb(void *__restrict userdata,
+                                                   const int n,
+                                                   const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHNode **nodes = userdata;
+  PBVHNode *node = nodes[n];
+
+  if (node->flag & PBVH_UpdateNormals) {
+    GSetIterator gs_iter;
+
+    /* Only the unique vertices here: they are owned by exactly one node, so there
+     * are no concurrent writes, and all adjacent face normals are valid after the
+     * face pass above (faces of unflagged nodes were not modified). */
+    GSET_ITER (gs_iter, node->bm_unique_verts) {
+      BM_vert_normal_update(BLI_gsetIterator_getKey(&gs_iter));
+    }
+  }
+}
+
 void pbvh_bmesh_normals_update(PBVHNode **nodes, int totnode)
 {
+  TaskParallelSettings settings;
+  BKE_pbvh_parallel_range_settings(&settings, true, totnode);
+
+  /* Split in two passes so that vertex normals only read fully updated
+   * face normals, matching the structure of #pbvh_faces_update_normals. */
+  BLI_task_parallel_range(0, totnode, nodes, pbvh_bmesh_face_normals_update_task_cb, &settings);
+  BLI_task_parallel_range(0, totnode, nodes, pbvh_bmesh_vert_normals_update_task_cb, &settings);
+
   for (int n = 0; n < totnode; n++) {
     PBVHNode *node = nodes[n];
 
     if (node->flag & PBVH_UpdateNormals) {
       GSetIterator gs_iter;
 
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BM_face_normal_update(BLI_gsetIterator_getKey(&gs_iter));
-      }
-      GSET_ITER (gs_iter, node->bm_unique_verts) {
-        BM_vert_normal_update(BLI_gsetIterator_getKey(&gs_iter));
-      }
-      /* This should be unneeded normally */
+      /* This should be unneeded normally. Kept serial: these vertices are owned
+       * by other nodes and the same vertex may be in several nodes' lists. */
       GSET_ITER (gs_iter, node->bm_other_verts) {
         BM_vert_normal_update(BLI_gsetIterator_getKey(&gs_iter));
       }
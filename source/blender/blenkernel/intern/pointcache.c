@@ -1713,8 +1713,114 @@ static void ptcache_file_pointers_init(PTCacheFile *pf)
   pf->cur[BPHYS_DATA_BOIDS] = (data_types & (1 << BPHYS_DATA_BOIDS)) ? &pf->data.boids : NULL;
 }
 
+/* Transparent compression of in-memory cache frames. Frames that are not being read or
+ * written are stored LZO compressed, which brings long point simulations down to a
+ * fraction of their raw size. Only the per-point arrays are compressed, extra data
+ * (springs and the like) is left alone. */
+
+#ifdef WITH_LZO
+/* Byte-wise delta between consecutive points, applied before compression: the arrays
+ * change slowly over the elements, which turns most bytes into near-zero values that
+ * compress far better. Works on bytes so overflow simply wraps. */
+static void ptcache_mem_delta_encode(unsigned char *data, int stride, int totpoint)
+{
+  for (int i = totpoint * stride - 1; i >= stride; i--) {
+    data[i] -= data[i - stride];
+  }
+}
+static void ptcache_mem_delta_decode(unsigned char *data, int stride, int totpoint)
+{
+  const int len = totpoint * stride;
+  for (int i = stride; i < len; i++) {
+    data[i] += data[i - stride];
+  }
+}
+#endif
+
+static void ptcache_mem_compress(PTCacheMem *pm)
+{
+#ifdef WITH_LZO
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (pm->data[i] == NULL || pm->data_compressed[i] != NULL) {
+      continue;
+    }
+    const unsigned int in_len = pm->totpoint * ptcache_data_size[i];
+    if (in_len == 0) {
+      continue;
+    }
+
+    unsigned char *out = MEM_mallocN(LZO_OUT_LEN(in_len), "PTCache compressed data");
+    lzo_uint out_len = 0;
+    LZO_HEAP_ALLOC(wrkmem, LZO1X_MEM_COMPRESS);
+
+    ptcache_mem_delta_encode(pm->data[i], ptcache_data_size[i], pm->totpoint);
+    const int r = lzo1x_1_compress(pm->data[i], (lzo_uint)in_len, out, &out_len, wrkmem);
+
+    if (r != LZO_E_OK || out_len >= in_len) {
+      /* Incompressible, keep the raw array. */
+      ptcache_mem_delta_decode(pm->data[i], ptcache_data_size[i], pm->totpoint);
+      MEM_freeN(out);
+      continue;
+    }
+
+    pm->data_compressed[i] = MEM_reallocN(out, out_len);
+    pm->data_compressed_size[i] = (unsigned int)out_len;
+    MEM_freeN(pm->data[i]);
+    pm->data[i] = NULL;
+  }
+#else
+  (void)pm;
+#endif
+}
+
+void BKE_ptcache_mem_ensure_raw(PTCacheMem *pm)
+{
+#ifdef WITH_LZO
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (pm->data_compressed[i] == NULL) {
+      continue;
+    }
+    const unsigned int raw_len = pm->totpoint * ptcache_data_size[i];
+    lzo_uint out_len = raw_len;
+    void *raw = MEM_mallocN(raw_len, "PTCache Data");
+
+    int r = lzo1x_decompress_safe(
+        pm->data_compressed[i], (lzo_uint)pm->data_compressed_size[i], raw, &out_len, NULL);
+    BLI_assert(r == LZO_E_OK && out_len == raw_len);
+    UNUSED_VARS_NDEBUG(r);
+
+    ptcache_mem_delta_decode(raw, ptcache_data_size[i], pm->totpoint);
+    pm->data[i] = raw;
+
+    MEM_freeN(pm->data_compressed[i]);
+    pm->data_compressed[i] = NULL;
+    pm->data_compressed_size[i] = 0;
+  }
+#else
+  (void)pm;
+#endif
+}
+
+/* Compress every frame of the cache except the ones just visited, those are likely to be
+ * read again right away. */
+static void ptcache_mem_compress_unused(PointCache *cache, PTCacheMem *keep1, PTCacheMem *keep2)
+{
+  /* The cache edit keys store pointers into the arrays of edited frames, those frames
+   * have to stay raw. */
+  if (cache->edit != NULL) {
+    return;
+  }
+  LISTBASE_FOREACH (PTCacheMem *, pm, &cache->mem_cache) {
+    if (!ELEM(pm, keep1, keep2)) {
+      ptcache_mem_compress(pm);
+    }
+  }
+}
+
 int BKE_ptcache_mem_index_find(PTCacheMem *pm, unsigned int index)
 {
+  BKE_ptcache_mem_ensure_raw(pm);
+
   if (pm->totpoint > 0 && pm->data[BPHYS_DATA_INDEX]) {
     unsigned int *data = pm->data[BPHYS_DATA_INDEX];
     unsigned int mid, low = 0, high = pm->totpoint - 1;
@@ -1753,6 +1859,8 @@ void BKE_ptcache_mem_pointers_init(PTCacheMem *pm, void *cur[BPHYS_TOT_DATA])
   int data_types = pm->data_types;
   int i;
 
+  BKE_ptcache_mem_ensure_raw(pm);
+
   for (i = 0; i < BPHYS_TOT_DATA; i++) {
     cur[i] = ((data_types & (1 << i)) ? pm->data[i] : NULL);
   }
@@ -1809,6 +1917,11 @@ static void ptcache_data_free(PTCacheMem *pm)
     if (data[i]) {
       MEM_freeN(data[i]);
     }
+    if (pm->data_compressed[i]) {
+      MEM_freeN(pm->data_compressed[i]);
+      pm->data_compressed[i] = NULL;
+      pm->data_compressed_size[i] = 0;
+    }
   }
 }
 static void ptcache_data_copy(void *from[], void *to[])
@@ -2205,6 +2318,9 @@ static int ptcache_read(PTCacheID *pid, int cfra)
       ptcache_mem_clear(pm);
       MEM_freeN(pm);
     }
+    else {
+      ptcache_mem_compress_unused(pid->cache, pm, pm->prev);
+    }
   }
 
   return 1;
@@ -2261,6 +2377,11 @@ static int ptcache_interpolate(PTCacheID *pid, float cfra, int cfra1, int cfra2)
       ptcache_mem_clear(pm);
       MEM_freeN(pm);
     }
+    else {
+      /* The previous frame usually holds cfra1, which the next step interpolates from
+       * again, so keep it raw as well. */
+      ptcache_mem_compress_unused(pid->cache, pm, pm->prev);
+    }
   }
 
   return 1;
@@ -2468,6 +2589,9 @@ static int ptcache_write(PTCacheID *pid, int cfra, int overwrite)
   }
   else {
     BLI_addtail(&cache->mem_cache, pm);
+    /* The frame before the new one may still be needed raw for the overwrite path above,
+     * everything older is only read back on scrubbing. */
+    ptcache_mem_compress_unused(cache, pm, pm->prev);
   }
 
   return error;
@@ -3065,6 +3189,9 @@ static PointCache *ptcache_copy(PointCache *cache, const bool copy_data)
         if (pmn->data[i]) {
           pmn->data[i] = MEM_dupallocN(pm->data[i]);
         }
+        if (pmn->data_compressed[i]) {
+          pmn->data_compressed[i] = MEM_dupallocN(pm->data_compressed[i]);
+        }
       }
 
       BLI_addtail(&ncache->mem_cache, pmn);
@@ -3778,6 +3905,13 @@ void BKE_ptcache_blend_write(BlendWriter *writer, ListBase *ptcaches)
 
     if ((cache->flag & PTCACHE_DISK_CACHE) == 0) {
       LISTBASE_FOREACH (PTCacheMem *, pm, &cache->mem_cache) {
+        /* Frames are written raw, the blend file has its own compression. */
+        bool was_compressed = false;
+        for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+          was_compressed |= (pm->data_compressed[i] != NULL);
+        }
+        BKE_ptcache_mem_ensure_raw(pm);
+
         BLO_write_struct(writer, PTCacheMem, pm);
 
         for (int i = 0; i < BPHYS_TOT_DATA; i++) {
@@ -3800,6 +3934,10 @@ void BKE_ptcache_blend_write(BlendWriter *writer, ListBase *ptcaches)
           BLO_write_struct_array_by_name(
               writer, ptcache_extra_struct[extra->type], extra->totdata, extra->data);
         }
+
+        if (was_compressed) {
+          ptcache_mem_compress(pm);
+        }
       }
     }
   }
@@ -3811,6 +3949,10 @@ static void direct_link_pointcache_cb(BlendDataReader *reader, void *data)
   for (int i = 0; i < BPHYS_TOT_DATA; i++) {
     BLO_read_data_address(reader, &pm->data[i]);
 
+    /* Runtime only, frames in the blend file are always raw. */
+    pm->data_compressed[i] = NULL;
+    pm->data_compressed_size[i] = 0;
+
     /* the cache saves non-struct data without DNA */
     if (pm->data[i] && ptcache_data_struct[i][0] == '\0' &&
         BLO_read_requires_endian_switch(reader)) {
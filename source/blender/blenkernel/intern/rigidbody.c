@@ -17,8 +17,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #ifdef WITH_BULLET
 #  include "RBI_api.h"
@@ -1661,16 +1663,26 @@ static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
   rigidbody_update_ob_array(rbw);
 }
 
-static void rigidbody_update_sim_ob(
-    Depsgraph *depsgraph, Scene *scene, RigidBodyWorld *rbw, Object *ob, RigidBodyOb *rbo)
+typedef struct RigidBodyUpdateSimObData {
+  ViewLayer *view_layer;
+  Object **objects;
+  bool transform_moving;
+} RigidBodyUpdateSimObData;
+
+static void rigidbody_update_sim_ob_task_cb(void *__restrict userdata,
+                                            const int index,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
 {
+  RigidBodyUpdateSimObData *data = userdata;
+  Object *ob = data->objects[index];
+  RigidBodyOb *rbo = ob->rigidbody_object;
+
   /* only update if rigid body exists */
   if (rbo->shared->physics_object == NULL) {
     return;
   }
 
-  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
-  Base *base = BKE_view_layer_base_find(view_layer, ob);
+  Base *base = BKE_view_layer_base_find(data->view_layer, ob);
   const bool is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
 
   if (rbo->shape == RB_SHAPE_TRIMESH && rbo->flag & RBO_FLAG_USE_DEFORM) {
@@ -1708,15 +1720,36 @@ static void rigidbody_update_sim_ob(
 
   /* Make transformed objects temporarily kinmatic
    * so that they can be moved by the user during simulation. */
-  if (is_selected && (G.moving & G_TRANSFORM_OBJ)) {
+  if (is_selected && data->transform_moving) {
     RB_body_set_kinematic_state(rbo->shared->physics_object, true);
     RB_body_set_mass(rbo->shared->physics_object, 0.0f);
   }
+}
+
+/* Applying effector forces needs the depsgraph and scene, keep it out of the threaded
+ * per-body update above. */
+static void rigidbody_update_sim_ob_effectors(
+    Depsgraph *depsgraph, Scene *scene, RigidBodyWorld *rbw, ViewLayer *view_layer, Object *ob)
+{
+  RigidBodyOb *rbo = ob->rigidbody_object;
+
+  /* only update if rigid body exists */
+  if (rbo->shared->physics_object == NULL) {
+    return;
+  }
+
+  Base *base = BKE_view_layer_base_find(view_layer, ob);
+  const bool is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
+
+  /* Transformed objects have been made temporarily kinematic instead. */
+  if (is_selected && (G.moving & G_TRANSFORM_OBJ)) {
+    return;
+  }
 
   /* update influence of effectors - but don't do it on an effector */
   /* only dynamic bodies need effector update */
-  else if (rbo->type == RBO_TYPE_ACTIVE &&
-           ((ob->pd == NULL) || (ob->pd->forcefield == PFIELD_NULL))) {
+  if (rbo->type == RBO_TYPE_ACTIVE &&
+      ((ob->pd == NULL) || (ob->pd->forcefield == PFIELD_NULL))) {
     EffectorWeights *effector_weights = rbw->effector_weights;
     EffectedPoint epoint;
     ListBase *effectors;
@@ -1806,6 +1839,9 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
   }
 
   /* update objects */
+  Object **sim_objects = NULL;
+  BLI_array_declare(sim_objects);
+
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
       /* validate that we've got valid object set up here... */
@@ -1854,12 +1890,38 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
       }
       rbo->flag &= ~(RBO_FLAG_NEEDS_VALIDATE | RBO_FLAG_NEEDS_RESHAPE);
 
-      /* update simulation object... */
-      rigidbody_update_sim_ob(depsgraph, scene, rbw, ob, rbo);
+      /* collect for the simulation object update below */
+      BLI_array_append(sim_objects, ob);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
+  /* Update the simulation objects. Each task only touches its own object and rigid body, so the
+   * transform/scale/shape sync can run in parallel; effector forces need the depsgraph and are
+   * applied serially afterwards. */
+  if (BLI_array_len(sim_objects) != 0) {
+    ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
+
+    /* Prime the lazily built object bases hash, worker thread lookups are then read-only. */
+    BKE_view_layer_base_find(view_layer, sim_objects[0]);
+
+    RigidBodyUpdateSimObData data = {
+        .view_layer = view_layer,
+        .objects = sim_objects,
+        .transform_moving = (G.moving & G_TRANSFORM_OBJ) != 0,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 256;
+    BLI_task_parallel_range(
+        0, BLI_array_len(sim_objects), &data, rigidbody_update_sim_ob_task_cb, &settings);
+
+    for (int i = 0; i < BLI_array_len(sim_objects); i++) {
+      rigidbody_update_sim_ob_effectors(depsgraph, scene, rbw, view_layer, sim_objects[i]);
+    }
+  }
+  BLI_array_free(sim_objects);
+
   /* update constraints */
   if (rbw->constraints == NULL) { /* no constraints, move on */
     return;
@@ -1909,10 +1971,12 @@ typedef struct KinematicSubstepData {
   float new_scale[3];
 } KinematicSubstepData;
 
-static ListBase rigidbody_create_substep_data(RigidBodyWorld *rbw)
+static KinematicSubstepData *rigidbody_create_substep_data(RigidBodyWorld *rbw,
+                                                           int *r_targets_num)
 {
   /* Objects that we want to update substep location/rotation for. */
-  ListBase substep_targets = {NULL, NULL};
+  KinematicSubstepData *substep_targets = NULL;
+  BLI_array_declare(substep_targets);
 
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     RigidBodyOb *rbo = ob->rigidbody_object;
@@ -1924,77 +1988,88 @@ static ListBase rigidbody_create_substep_data(RigidBodyWorld *rbw)
     if (rbo->flag & RBO_FLAG_KINEMATIC) {
       float loc[3], rot[4], scale[3];
 
-      KinematicSubstepData *data = MEM_callocN(sizeof(KinematicSubstepData),
-                                               "RigidBody Substep data");
+      KinematicSubstepData data = {NULL};
 
-      data->rbo = rbo;
+      data.rbo = rbo;
 
       RB_body_get_position(rbo->shared->physics_object, loc);
       RB_body_get_orientation(rbo->shared->physics_object, rot);
       RB_body_get_scale(rbo->shared->physics_object, scale);
 
-      copy_v3_v3(data->old_pos, loc);
-      copy_v4_v4(data->old_rot, rot);
-      copy_v3_v3(data->old_scale, scale);
+      copy_v3_v3(data.old_pos, loc);
+      copy_v4_v4(data.old_rot, rot);
+      copy_v3_v3(data.old_scale, scale);
 
       mat4_decompose(loc, rot, scale, ob->obmat);
 
-      copy_v3_v3(data->new_pos, loc);
-      copy_v4_v4(data->new_rot, rot);
-      copy_v3_v3(data->new_scale, scale);
+      copy_v3_v3(data.new_pos, loc);
+      copy_v4_v4(data.new_rot, rot);
+      copy_v3_v3(data.new_scale, scale);
 
-      data->scale_changed = !compare_size_v3v3(data->old_scale, data->new_scale, 0.001f);
+      data.scale_changed = !compare_size_v3v3(data.old_scale, data.new_scale, 0.001f);
 
-      LinkData *ob_link = BLI_genericNodeN(data);
-      BLI_addtail(&substep_targets, ob_link);
+      BLI_array_append(substep_targets, data);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
+  *r_targets_num = BLI_array_len(substep_targets);
   return substep_targets;
 }
 
-static void rigidbody_update_kinematic_obj_substep(ListBase *substep_targets, float interp_fac)
+typedef struct KinematicSubstepApplyData {
+  KinematicSubstepData *targets;
+  float interp_fac;
+} KinematicSubstepApplyData;
+
+static void rigidbody_update_kinematic_obj_substep_task_cb(
+    void *__restrict userdata, const int index, const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  LISTBASE_FOREACH (LinkData *, link, substep_targets) {
-    KinematicSubstepData *data = link->data;
-    RigidBodyOb *rbo = data->rbo;
+  KinematicSubstepApplyData *apply_data = userdata;
+  KinematicSubstepData *data = &apply_data->targets[index];
+  const float interp_fac = apply_data->interp_fac;
+  RigidBodyOb *rbo = data->rbo;
 
-    float loc[3], rot[4];
+  float loc[3], rot[4];
 
-    interp_v3_v3v3(loc, data->old_pos, data->new_pos, interp_fac);
-    interp_qt_qtqt(rot, data->old_rot, data->new_rot, interp_fac);
+  interp_v3_v3v3(loc, data->old_pos, data->new_pos, interp_fac);
+  interp_qt_qtqt(rot, data->old_rot, data->new_rot, interp_fac);
 
-    RB_body_activate(rbo->shared->physics_object);
-    RB_body_set_loc_rot(rbo->shared->physics_object, loc, rot);
+  RB_body_activate(rbo->shared->physics_object);
+  RB_body_set_loc_rot(rbo->shared->physics_object, loc, rot);
 
-    if (!data->scale_changed) {
-      /* Avoid having to rebuild the collision shape AABBs if scale didn't change. */
-      continue;
-    }
+  if (!data->scale_changed) {
+    /* Avoid having to rebuild the collision shape AABBs if scale didn't change. */
+    return;
+  }
 
-    float scale[3];
+  float scale[3];
 
-    interp_v3_v3v3(scale, data->old_scale, data->new_scale, interp_fac);
+  interp_v3_v3v3(scale, data->old_scale, data->new_scale, interp_fac);
 
-    RB_body_set_scale(rbo->shared->physics_object, scale);
+  RB_body_set_scale(rbo->shared->physics_object, scale);
 
-    /* compensate for embedded convex hull collision margin */
-    if (!(rbo->flag & RBO_FLAG_USE_MARGIN) && rbo->shape == RB_SHAPE_CONVEXH) {
-      RB_shape_set_margin(rbo->shared->physics_shape,
-                          RBO_GET_MARGIN(rbo) * MIN3(scale[0], scale[1], scale[2]));
-    }
+  /* compensate for embedded convex hull collision margin */
+  if (!(rbo->flag & RBO_FLAG_USE_MARGIN) && rbo->shape == RB_SHAPE_CONVEXH) {
+    RB_shape_set_margin(rbo->shared->physics_shape,
+                        RBO_GET_MARGIN(rbo) * MIN3(scale[0], scale[1], scale[2]));
   }
 }
 
-static void rigidbody_free_substep_data(ListBase *substep_targets)
+static void rigidbody_update_kinematic_obj_substep(KinematicSubstepData *targets,
+                                                   int targets_num,
+                                                   float interp_fac)
 {
-  LISTBASE_FOREACH (LinkData *, link, substep_targets) {
-    KinematicSubstepData *data = link->data;
-    MEM_freeN(data);
-  }
-
-  BLI_freelistN(substep_targets);
+  /* Only per rigid body state is written, so the targets can be pushed in parallel. */
+  KinematicSubstepApplyData apply_data = {
+      .targets = targets,
+      .interp_fac = interp_fac,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+  BLI_task_parallel_range(
+      0, targets_num, &apply_data, rigidbody_update_kinematic_obj_substep_task_cb, &settings);
 }
 static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBodyWorld *rbw)
 {
@@ -2230,17 +2305,19 @@ void BKE_rigidbody_do_simulation(Depsgraph *depsgraph, Scene *scene, float ctime
 
     const float substep = timestep / rbw->substeps_per_frame;
 
-    ListBase substep_targets = rigidbody_create_substep_data(rbw);
+    int substep_targets_num;
+    KinematicSubstepData *substep_targets = rigidbody_create_substep_data(rbw,
+                                                                          &substep_targets_num);
 
     const float interp_step = 1.0f / rbw->substeps_per_frame;
     float cur_interp_val = interp_step;
 
     for (int i = 0; i < rbw->substeps_per_frame; i++) {
-      rigidbody_update_kinematic_obj_substep(&substep_targets, cur_interp_val);
+      rigidbody_update_kinematic_obj_substep(substep_targets, substep_targets_num, cur_interp_val);
       RB_dworld_step_simulation(rbw->shared->physics_world, substep, 0, substep);
       cur_interp_val += interp_step;
     }
-    rigidbody_free_substep_data(&substep_targets);
+    MEM_SAFE_FREE(substep_targets);
 
     rigidbody_update_simulation_post_step(depsgraph, rbw);
 
@@ -43,7 +43,7 @@
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
-#include "BLI_threads.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_collection.h"
@@ -108,21 +108,6 @@ typedef struct SBScratch {
   ReferenceState Ref;
 } SBScratch;
 
-typedef struct SB_thread_context {
-  Scene *scene;
-  Object *ob;
-  float forcetime;
-  float timenow;
-  int ifirst;
-  int ilast;
-  ListBase *effectors;
-  int do_deflector;
-  float fieldfactor;
-  float windfactor;
-  int nr;
-  int tot;
-} SB_thread_context;
-
 #define MID_PRESERVE 1
 
 #define SOFTGOALSNAP 0.999f
@@ -1495,12 +1480,20 @@ static void _scan_for_ext_spring_forces(
   }
 }
 
-static void *exec_scan_for_ext_spring_forces(void *data)
+typedef struct ScanForExtSpringForcesData {
+  Scene *scene;
+  Object *ob;
+  float timenow;
+  ListBase *effectors;
+} ScanForExtSpringForcesData;
+
+static void scan_for_ext_spring_forces_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  SB_thread_context *pctx = (SB_thread_context *)data;
-  _scan_for_ext_spring_forces(
-      pctx->scene, pctx->ob, pctx->timenow, pctx->ifirst, pctx->ilast, pctx->effectors);
-  return NULL;
+  ScanForExtSpringForcesData *data = userdata;
+  /* Every spring only writes to itself, so they can all be scanned in parallel. */
+  _scan_for_ext_spring_forces(data->scene, data->ob, data->timenow, i, i + 1, data->effectors);
 }
 
 static void sb_sfesf_threads_run(struct Depsgraph *depsgraph,
@@ -1510,62 +1503,19 @@ static void sb_sfesf_threads_run(struct Depsgraph *depsgraph,
                                  int totsprings,
                                  int *UNUSED(ptr_to_break_func(void)))
 {
-  ListBase threads;
-  SB_thread_context *sb_threads;
-  int i, totthread, left, dec;
-
-  /* wild guess .. may increase with better thread management 'above'
-   * or even be UI option sb->spawn_cf_threads_nopts */
-  int lowsprings = 100;
-
   ListBase *effectors = BKE_effectors_create(
       depsgraph, ob, NULL, ob->soft->effector_weights, false);
 
-  /* figure the number of threads while preventing pretty pointless threading overhead */
-  totthread = BKE_scene_num_threads(scene);
-  /* What if we got zillions of CPUs running but less to spread. */
-  while ((totsprings / totthread < lowsprings) && (totthread > 1)) {
-    totthread--;
-  }
-
-  sb_threads = MEM_callocN(sizeof(SB_thread_context) * totthread, "SBSpringsThread");
-  memset(sb_threads, 0, sizeof(SB_thread_context) * totthread);
-  left = totsprings;
-  dec = totsprings / totthread + 1;
-  for (i = 0; i < totthread; i++) {
-    sb_threads[i].scene = scene;
-    sb_threads[i].ob = ob;
-    sb_threads[i].forcetime = 0.0; /* not used here */
-    sb_threads[i].timenow = timenow;
-    sb_threads[i].ilast = left;
-    left = left - dec;
-    if (left > 0) {
-      sb_threads[i].ifirst = left;
-    }
-    else {
-      sb_threads[i].ifirst = 0;
-    }
-    sb_threads[i].effectors = effectors;
-    sb_threads[i].do_deflector = false; /* not used here */
-    sb_threads[i].fieldfactor = 0.0f;   /* not used here */
-    sb_threads[i].windfactor = 0.0f;    /* not used here */
-    sb_threads[i].nr = i;
-    sb_threads[i].tot = totthread;
-  }
-  if (totthread > 1) {
-    BLI_threadpool_init(&threads, exec_scan_for_ext_spring_forces, totthread);
-
-    for (i = 0; i < totthread; i++) {
-      BLI_threadpool_insert(&threads, &sb_threads[i]);
-    }
-
-    BLI_threadpool_end(&threads);
-  }
-  else {
-    exec_scan_for_ext_spring_forces(&sb_threads[0]);
-  }
-  /* clean up */
-  MEM_freeN(sb_threads);
+  ScanForExtSpringForcesData data = {
+      .scene = scene,
+      .ob = ob,
+      .timenow = timenow,
+      .effectors = effectors,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 100;
+  BLI_task_parallel_range(0, totsprings, &data, scan_for_ext_spring_forces_cb, &settings);
 
   BKE_effectors_free(effectors);
 }
@@ -2162,21 +2112,35 @@ static int _softbody_calc_forces_slice_in_a_thread(Scene *scene,
   return 0; /* Done fine. */
 }
 
-static void *exec_softbody_calc_forces(void *data)
-{
-  SB_thread_context *pctx = (SB_thread_context *)data;
-  _softbody_calc_forces_slice_in_a_thread(pctx->scene,
-                                          pctx->ob,
-                                          pctx->forcetime,
-                                          pctx->timenow,
-                                          pctx->ifirst,
-                                          pctx->ilast,
+typedef struct SoftbodyCalcForcesData {
+  Scene *scene;
+  Object *ob;
+  float forcetime;
+  float timenow;
+  ListBase *effectors;
+  int do_deflector;
+  float fieldfactor;
+  float windfactor;
+} SoftbodyCalcForcesData;
+
+static void softbody_calc_forces_point_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SoftbodyCalcForcesData *data = userdata;
+  /* Every point only accumulates into its own force vector, reading the other points and
+   * springs without altering them, so the points can be processed in parallel. */
+  _softbody_calc_forces_slice_in_a_thread(data->scene,
+                                          data->ob,
+                                          data->forcetime,
+                                          data->timenow,
+                                          i,
+                                          i + 1,
                                           NULL,
-                                          pctx->effectors,
-                                          pctx->do_deflector,
-                                          pctx->fieldfactor,
-                                          pctx->windfactor);
-  return NULL;
+                                          data->effectors,
+                                          data->do_deflector,
+                                          data->fieldfactor,
+                                          data->windfactor);
 }
 
 static void sb_cf_threads_run(Scene *scene,
@@ -2190,62 +2154,20 @@ static void sb_cf_threads_run(Scene *scene,
                               float fieldfactor,
                               float windfactor)
 {
-  ListBase threads;
-  SB_thread_context *sb_threads;
-  int i, totthread, left, dec;
-
-  /* wild guess .. may increase with better thread management 'above'
-   * or even be UI option sb->spawn_cf_threads_nopts. */
-  int lowpoints = 100;
-
-  /* figure the number of threads while preventing pretty pointless threading overhead */
-  totthread = BKE_scene_num_threads(scene);
-  /* What if we got zillions of CPUs running but less to spread. */
-  while ((totpoint / totthread < lowpoints) && (totthread > 1)) {
-    totthread--;
-  }
-
-  // printf("sb_cf_threads_run spawning %d threads\n", totthread);
-
-  sb_threads = MEM_callocN(sizeof(SB_thread_context) * totthread, "SBThread");
-  memset(sb_threads, 0, sizeof(SB_thread_context) * totthread);
-  left = totpoint;
-  dec = totpoint / totthread + 1;
-  for (i = 0; i < totthread; i++) {
-    sb_threads[i].scene = scene;
-    sb_threads[i].ob = ob;
-    sb_threads[i].forcetime = forcetime;
-    sb_threads[i].timenow = timenow;
-    sb_threads[i].ilast = left;
-    left = left - dec;
-    if (left > 0) {
-      sb_threads[i].ifirst = left;
-    }
-    else {
-      sb_threads[i].ifirst = 0;
-    }
-    sb_threads[i].effectors = effectors;
-    sb_threads[i].do_deflector = do_deflector;
-    sb_threads[i].fieldfactor = fieldfactor;
-    sb_threads[i].windfactor = windfactor;
-    sb_threads[i].nr = i;
-    sb_threads[i].tot = totthread;
-  }
-
-  if (totthread > 1) {
-    BLI_threadpool_init(&threads, exec_softbody_calc_forces, totthread);
-
-    for (i = 0; i < totthread; i++) {
-      BLI_threadpool_insert(&threads, &sb_threads[i]);
-    }
-
-    BLI_threadpool_end(&threads);
-  }
-  else {
-    exec_softbody_calc_forces(&sb_threads[0]);
-  }
-  /* clean up */
-  MEM_freeN(sb_threads);
+  SoftbodyCalcForcesData data = {
+      .scene = scene,
+      .ob = ob,
+      .forcetime = forcetime,
+      .timenow = timenow,
+      .effectors = effectors,
+      .do_deflector = do_deflector,
+      .fieldfactor = fieldfactor,
+      .windfactor = windfactor,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 100;
+  BLI_task_parallel_range(0, totpoint, &data, softbody_calc_forces_point_cb, &settings);
 }
 
 static void softbody_calc_forces(
@@ -67,12 +67,43 @@ SplinePtr Spline::copy_without_attributes() const
 {
   SplinePtr dst = this->copy_only_settings();
   this->copy_data(*dst);
+  copy_base_cached_data(*this, *dst);
+  this->copy_cached_data(*dst);
 
   /* Though the attributes storage is empty, it still needs to know the correct size. */
   dst->attributes.reallocate(dst->size());
   return dst;
 }
 
+void Spline::copy_base_cached_data(const Spline &src, Spline &dst)
+{
+  /* Since the copy contains identical data, valid caches stay valid on the copy. This way nodes
+   * that only read evaluated data don't have to recompute it after the curve was copied by an
+   * earlier node. The source mutexes are locked because another thread may be filling the caches
+   * at the same time; outdated caches are simply skipped and stay dirty on the copy. */
+  {
+    std::lock_guard lock{src.tangent_cache_mutex_};
+    if (!src.tangent_cache_dirty_) {
+      dst.evaluated_tangents_cache_ = src.evaluated_tangents_cache_;
+      dst.tangent_cache_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{src.normal_cache_mutex_};
+    if (!src.normal_cache_dirty_) {
+      dst.evaluated_normals_cache_ = src.evaluated_normals_cache_;
+      dst.normal_cache_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{src.length_cache_mutex_};
+    if (!src.length_cache_dirty_) {
+      dst.evaluated_lengths_cache_ = src.evaluated_lengths_cache_;
+      dst.length_cache_dirty_ = false;
+    }
+  }
+}
+
 void Spline::translate(const blender::float3 &translation)
 {
   for (float3 &position : this->positions()) {
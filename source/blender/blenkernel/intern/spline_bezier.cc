@@ -32,6 +32,39 @@ void BezierSpline::copy_data(Spline &dst) const
   bezier.tilts_ = tilts_;
 }
 
+void BezierSpline::copy_cached_data(Spline &dst) const
+{
+  BezierSpline &bezier = static_cast<BezierSpline &>(dst);
+  {
+    std::lock_guard lock{auto_handle_mutex_};
+    if (!auto_handles_dirty_) {
+      /* The handle positions themselves are copied by #copy_data. */
+      bezier.auto_handles_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{offset_cache_mutex_};
+    if (!offset_cache_dirty_) {
+      bezier.offset_cache_ = offset_cache_;
+      bezier.offset_cache_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{position_cache_mutex_};
+    if (!position_cache_dirty_) {
+      bezier.evaluated_position_cache_ = evaluated_position_cache_;
+      bezier.position_cache_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{mapping_cache_mutex_};
+    if (!mapping_cache_dirty_) {
+      bezier.evaluated_mapping_cache_ = evaluated_mapping_cache_;
+      bezier.mapping_cache_dirty_ = false;
+    }
+  }
+}
+
 int BezierSpline::size() const
 {
   const int size = positions_.size();
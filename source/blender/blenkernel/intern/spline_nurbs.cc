@@ -34,6 +34,26 @@ void NURBSpline::copy_data(Spline &dst) const
   nurbs.tilts_ = tilts_;
 }
 
+void NURBSpline::copy_cached_data(Spline &dst) const
+{
+  NURBSpline &nurbs = static_cast<NURBSpline &>(dst);
+  /* The knots cache is copied by #copy_data already. */
+  {
+    std::lock_guard lock{basis_cache_mutex_};
+    if (!basis_cache_dirty_) {
+      nurbs.basis_cache_ = basis_cache_;
+      nurbs.basis_cache_dirty_ = false;
+    }
+  }
+  {
+    std::lock_guard lock{position_cache_mutex_};
+    if (!position_cache_dirty_) {
+      nurbs.evaluated_position_cache_ = evaluated_position_cache_;
+      nurbs.position_cache_dirty_ = false;
+    }
+  }
+}
+
 int NURBSpline::size() const
 {
   const int size = positions_.size();
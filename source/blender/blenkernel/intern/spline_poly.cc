@@ -23,6 +23,11 @@ void PolySpline::copy_data(Spline &dst) const
   poly.tilts_ = tilts_;
 }
 
+void PolySpline::copy_cached_data(Spline &UNUSED(dst)) const
+{
+  /* Poly splines have no caches besides those handled by the base class. */
+}
+
 int PolySpline::size() const
 {
   const int size = positions_.size();
@@ -191,6 +191,9 @@ void BKE_subdiv_free(Subdiv *subdiv)
   if (subdiv->cache_.face_ptex_offset != NULL) {
     MEM_freeN(subdiv->cache_.face_ptex_offset);
   }
+  if (subdiv->cache_.coarse_vertex_map != NULL) {
+    MEM_freeN(subdiv->cache_.coarse_vertex_map);
+  }
   MEM_freeN(subdiv);
 }
 
@@ -70,17 +70,18 @@ bool BKE_subdiv_eval_begin(Subdiv *subdiv,
   return true;
 }
 
-static void set_coarse_positions(Subdiv *subdiv,
-                                 const Mesh *mesh,
-                                 const float (*coarse_vertex_cos)[3])
+/* Mapping from coarse vertices to evaluator ones: loose vertices are not
+ * known to the evaluator, so the remaining vertices are tightly packed.
+ * The mapping only depends on the topology, which is immutable for the
+ * lifetime of the topology refiner, so it is calculated once and cached. */
+static const int *coarse_vertex_map_ensure(Subdiv *subdiv, const Mesh *mesh)
 {
-  const MVert *mvert = mesh->mvert;
+  if (subdiv->cache_.coarse_vertex_map != NULL) {
+    return subdiv->cache_.coarse_vertex_map;
+  }
   const MLoop *mloop = mesh->mloop;
   const MPoly *mpoly = mesh->mpoly;
-  /* Mark vertices which needs new coordinates. */
-  /* TODO(sergey): This is annoying to calculate this on every update,
-   * maybe it's better to cache this mapping. Or make it possible to have
-   * OpenSubdiv's vertices match mesh ones? */
+  /* Mark vertices which are used by faces. */
   BLI_bitmap *vertex_used_map = BLI_BITMAP_NEW(mesh->totvert, "vert used map");
   for (int poly_index = 0; poly_index < mesh->totpoly; poly_index++) {
     const MPoly *poly = &mpoly[poly_index];
@@ -89,29 +90,74 @@ static void set_coarse_positions(Subdiv *subdiv,
       BLI_BITMAP_ENABLE(vertex_used_map, loop->v);
     }
   }
-  /* Use a temporary buffer so we do not upload vertices one at a time to the GPU. */
-  float(*buffer)[3] = MEM_mallocN(sizeof(float[3]) * mesh->totvert, "subdiv tmp coarse positions");
-  int manifold_vertex_count = 0;
-  for (int vertex_index = 0, manifold_vertex_index = 0; vertex_index < mesh->totvert;
-       vertex_index++) {
-    if (!BLI_BITMAP_TEST_BOOL(vertex_used_map, vertex_index)) {
-      continue;
-    }
-    const float *vertex_co;
-    if (coarse_vertex_cos != NULL) {
-      vertex_co = coarse_vertex_cos[vertex_index];
+  int *vertex_map = MEM_malloc_arrayN(mesh->totvert, sizeof(int), "subdiv coarse vertex map");
+  int evaluator_vertex_index = 0;
+  for (int vertex_index = 0; vertex_index < mesh->totvert; vertex_index++) {
+    if (BLI_BITMAP_TEST_BOOL(vertex_used_map, vertex_index)) {
+      vertex_map[vertex_index] = evaluator_vertex_index++;
     }
     else {
-      const MVert *vertex = &mvert[vertex_index];
-      vertex_co = vertex->co;
+      vertex_map[vertex_index] = -1;
     }
-    copy_v3_v3(&buffer[manifold_vertex_index][0], vertex_co);
-    manifold_vertex_index++;
-    manifold_vertex_count++;
   }
-  subdiv->evaluator->setCoarsePositions(
-      subdiv->evaluator, &buffer[0][0], 0, manifold_vertex_count);
   MEM_freeN(vertex_used_map);
+  subdiv->cache_.coarse_vertex_map = vertex_map;
+  subdiv->cache_.num_evaluator_vertices = evaluator_vertex_index;
+  return vertex_map;
+}
+
+/* Context which is used to gather coarse vertex coordinates in parallel. */
+typedef struct CoarsePositionsContext {
+  const MVert *mvert;
+  const float (*coarse_vertex_cos)[3];
+  const int *vertex_map;
+  float (*buffer)[3];
+} CoarsePositionsContext;
+
+static void set_coarse_positions_task(void *__restrict userdata,
+                                      const int vertex_index,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  CoarsePositionsContext *ctx = userdata;
+  const int evaluator_vertex_index = ctx->vertex_map[vertex_index];
+  if (evaluator_vertex_index == -1) {
+    return;
+  }
+  const float *vertex_co;
+  if (ctx->coarse_vertex_cos != NULL) {
+    vertex_co = ctx->coarse_vertex_cos[vertex_index];
+  }
+  else {
+    vertex_co = ctx->mvert[vertex_index].co;
+  }
+  copy_v3_v3(ctx->buffer[evaluator_vertex_index], vertex_co);
+}
+
+static void set_coarse_positions(Subdiv *subdiv,
+                                 const Mesh *mesh,
+                                 const float (*coarse_vertex_cos)[3])
+{
+  const int *vertex_map = coarse_vertex_map_ensure(subdiv, mesh);
+  const int num_evaluator_vertices = subdiv->cache_.num_evaluator_vertices;
+  /* Use a temporary buffer so we do not upload vertices one at a time to the GPU. */
+  float(*buffer)[3] = MEM_mallocN(sizeof(float[3]) * num_evaluator_vertices,
+                                  "subdiv tmp coarse positions");
+
+  CoarsePositionsContext ctx;
+  ctx.mvert = mesh->mvert;
+  ctx.coarse_vertex_cos = coarse_vertex_cos;
+  ctx.vertex_map = vertex_map;
+  ctx.buffer = buffer;
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.min_iter_per_thread = 4096;
+
+  BLI_task_parallel_range(
+      0, mesh->totvert, &ctx, set_coarse_positions_task, &parallel_range_settings);
+
+  subdiv->evaluator->setCoarsePositions(
+      subdiv->evaluator, &buffer[0][0], 0, num_evaluator_vertices);
   MEM_freeN(buffer);
 }
 
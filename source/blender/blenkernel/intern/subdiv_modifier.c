@@ -3,6 +3,8 @@
 
 #include "BKE_subdiv_modifier.h"
 
+#include "BLI_utildefines.h"
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_mesh_types.h"
@@ -108,16 +110,71 @@ bool BKE_subsurf_modifier_can_do_gpu_subdiv(const Scene *scene,
 
 void (*BKE_subsurf_modifier_free_gpu_cache_cb)(Subdiv *subdiv) = NULL;
 
+void BKE_subsurf_modifier_subdiv_cache_clear(SubsurfRuntimeData *runtime_data)
+{
+  for (int i = 0; i < ARRAY_SIZE(runtime_data->subdiv_cache); i++) {
+    if (runtime_data->subdiv_cache[i] != NULL) {
+      BKE_subdiv_free(runtime_data->subdiv_cache[i]);
+      runtime_data->subdiv_cache[i] = NULL;
+    }
+    runtime_data->subdiv_cache_age[i] = 0;
+  }
+  runtime_data->subdiv_cache_counter = 0;
+}
+
 Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(const SubsurfModifierData *smd,
                                                       const SubdivSettings *subdiv_settings,
                                                       const Mesh *mesh,
                                                       const bool for_draw_code)
 {
   SubsurfRuntimeData *runtime_data = (SubsurfRuntimeData *)smd->modifier.runtime;
-  if (runtime_data->subdiv && runtime_data->set_by_draw_code != for_draw_code) {
-    BKE_subdiv_free(runtime_data->subdiv);
-    runtime_data->subdiv = NULL;
+  if (runtime_data->set_by_draw_code != for_draw_code) {
+    if (runtime_data->subdiv) {
+      BKE_subdiv_free(runtime_data->subdiv);
+      runtime_data->subdiv = NULL;
+    }
+    BKE_subsurf_modifier_subdiv_cache_clear(runtime_data);
   }
+
+  /* When the settings changed, try to take over a descriptor cached for the new settings instead
+   * of rebuilding its topology refiner, and keep the current one cached for switching back.
+   * This makes toggling between viewport levels or viewport and render levels cheap on meshes
+   * where the refiner construction dominates. */
+  if (runtime_data->subdiv != NULL &&
+      !BKE_subdiv_settings_equal(&runtime_data->subdiv->settings, subdiv_settings)) {
+    Subdiv **cache = runtime_data->subdiv_cache;
+    int *cache_age = runtime_data->subdiv_cache_age;
+    int matching_slot = -1;
+    int demote_slot = -1;
+    for (int i = 0; i < ARRAY_SIZE(runtime_data->subdiv_cache); i++) {
+      if (cache[i] == NULL) {
+        if (demote_slot == -1 || cache[demote_slot] != NULL) {
+          demote_slot = i;
+        }
+        continue;
+      }
+      if (BKE_subdiv_settings_equal(&cache[i]->settings, subdiv_settings)) {
+        matching_slot = i;
+        break;
+      }
+      if (demote_slot == -1 ||
+          (cache[demote_slot] != NULL && cache_age[i] < cache_age[demote_slot])) {
+        demote_slot = i;
+      }
+    }
+
+    const int slot = (matching_slot != -1) ? matching_slot : demote_slot;
+    Subdiv *cached_subdiv = cache[slot];
+    if (matching_slot == -1 && cached_subdiv != NULL) {
+      /* Evict the least recently used descriptor. */
+      BKE_subdiv_free(cached_subdiv);
+      cached_subdiv = NULL;
+    }
+    cache[slot] = runtime_data->subdiv;
+    cache_age[slot] = ++runtime_data->subdiv_cache_counter;
+    runtime_data->subdiv = cached_subdiv;
+  }
+
   Subdiv *subdiv = BKE_subdiv_update_from_mesh(runtime_data->subdiv, subdiv_settings, mesh);
   runtime_data->subdiv = subdiv;
   runtime_data->set_by_draw_code = for_draw_code;
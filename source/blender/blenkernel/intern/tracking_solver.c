@@ -50,6 +50,16 @@ typedef struct MovieReconstructContext {
 
   int sfra, efra;
 
+  /* Previous solution gathered from the reconstruction data, used to
+   * warm-start the solver instead of re-initializing from the keyframes.
+   * Arrays are NULL when there is no usable previous solution. */
+  int num_initial_cameras;
+  int *initial_camera_images;
+  double *initial_camera_mats;
+  int num_initial_points;
+  int *initial_point_tracks;
+  double *initial_point_positions;
+
   /* Details about reconstruction error, reported by Libmv. */
   char error_message[1024];
 } MovieReconstructContext;
@@ -104,6 +114,69 @@ static struct libmv_Tracks *libmv_tracks_new(MovieClip *clip,
   return tracks;
 }
 
+/* Gather the previous solution from the reconstruction data so it can be
+ * used as an initial guess for the solver. Since bundle adjustment does not
+ * depend on the gauge, the origin-shifted cameras and bundles stored on the
+ * blender side are a valid starting point as-is.
+ *
+ * Track indices here follow the same listbase traversal order as
+ * #libmv_tracks_new, so they match the track numbers the solver will use. */
+static void reconstruct_gather_previous_solution(MovieReconstructContext *context,
+                                                 MovieTracking *tracking,
+                                                 MovieTrackingObject *object,
+                                                 ListBase *tracksbase)
+{
+  MovieTrackingReconstruction *reconstruction;
+
+  if (object->flag & TRACKING_OBJECT_CAMERA) {
+    reconstruction = &tracking->reconstruction;
+  }
+  else {
+    reconstruction = &object->reconstruction;
+  }
+
+  if ((reconstruction->flag & TRACKING_RECONSTRUCTED) == 0 || reconstruction->camnr < 2) {
+    return;
+  }
+
+  context->num_initial_cameras = reconstruction->camnr;
+  context->initial_camera_images = MEM_mallocN(sizeof(int) * reconstruction->camnr,
+                                               "warm start camera images");
+  context->initial_camera_mats = MEM_mallocN(sizeof(double[4][4]) * reconstruction->camnr,
+                                             "warm start camera matrices");
+
+  for (int a = 0; a < reconstruction->camnr; a++) {
+    const MovieReconstructedCamera *camera = &reconstruction->cameras[a];
+    double *mat = context->initial_camera_mats + a * 16;
+
+    context->initial_camera_images[a] = camera->framenr;
+
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        mat[i * 4 + j] = camera->mat[i][j];
+      }
+    }
+  }
+
+  context->num_initial_points = 0;
+  context->initial_point_tracks = MEM_mallocN(sizeof(int) * context->tracks_map->num_tracks,
+                                              "warm start point tracks");
+  context->initial_point_positions = MEM_mallocN(
+      sizeof(double[3]) * context->tracks_map->num_tracks, "warm start point positions");
+
+  int tracknr = 0;
+  LISTBASE_FOREACH (MovieTrackingTrack *, track, tracksbase) {
+    if (track->flag & TRACK_HAS_BUNDLE) {
+      double *pos = context->initial_point_positions + context->num_initial_points * 3;
+
+      context->initial_point_tracks[context->num_initial_points] = tracknr;
+      copy_v3db_v3fl(pos, track->bundle_pos);
+      context->num_initial_points++;
+    }
+    tracknr++;
+  }
+}
+
 /* Retrieve refined camera intrinsics from libmv to blender. */
 static void reconstruct_retrieve_libmv_intrinsics(MovieReconstructContext *context,
                                                   MovieTracking *tracking)
@@ -399,6 +472,8 @@ MovieReconstructContext *BKE_tracking_reconstruction_context_new(MovieClip *clip
   context->sfra = sfra;
   context->efra = efra;
 
+  reconstruct_gather_previous_solution(context, tracking, object, tracksbase);
+
   context->tracks = libmv_tracks_new(clip, tracksbase, width, height * aspy);
   context->keyframe1 = keyframe1;
   context->keyframe2 = keyframe2;
@@ -434,6 +509,11 @@ void BKE_tracking_reconstruction_context_free(MovieReconstructContext *context)
 
   tracks_map_free(context->tracks_map, NULL);
 
+  MEM_SAFE_FREE(context->initial_camera_images);
+  MEM_SAFE_FREE(context->initial_camera_mats);
+  MEM_SAFE_FREE(context->initial_point_tracks);
+  MEM_SAFE_FREE(context->initial_point_positions);
+
   MEM_freeN(context);
 }
 
@@ -492,11 +572,42 @@ void BKE_tracking_reconstruction_solve(MovieReconstructContext *context,
                                                &progressdata);
   }
   else {
-    context->reconstruction = libmv_solveReconstruction(context->tracks,
-                                                        &context->camera_intrinsics_options,
-                                                        &reconstruction_options,
-                                                        reconstruct_update_solve_cb,
-                                                        &progressdata);
+    /* When a previous solution exists, use it as an initial guess: only
+     * newly trackable cameras and points are reconstructed from scratch,
+     * the rest is refined in place by bundle adjustment. */
+    if (context->num_initial_cameras >= 2) {
+      libmv_InitialReconstruction initial_reconstruction;
+
+      initial_reconstruction.num_cameras = context->num_initial_cameras;
+      initial_reconstruction.camera_images = context->initial_camera_images;
+      initial_reconstruction.camera_mats = context->initial_camera_mats;
+      initial_reconstruction.num_points = context->num_initial_points;
+      initial_reconstruction.point_tracks = context->initial_point_tracks;
+      initial_reconstruction.point_positions = context->initial_point_positions;
+
+      context->reconstruction = libmv_solveReconstructionIncremental(
+          context->tracks,
+          &context->camera_intrinsics_options,
+          &reconstruction_options,
+          &initial_reconstruction,
+          reconstruct_update_solve_cb,
+          &progressdata);
+
+      /* Fall back to a full solve when seeding the reconstruction failed. */
+      if (context->reconstruction != NULL &&
+          !libmv_reconstructionIsValid(context->reconstruction)) {
+        libmv_reconstructionDestroy(context->reconstruction);
+        context->reconstruction = NULL;
+      }
+    }
+
+    if (context->reconstruction == NULL) {
+      context->reconstruction = libmv_solveReconstruction(context->tracks,
+                                                          &context->camera_intrinsics_options,
+                                                          &reconstruction_options,
+                                                          reconstruct_update_solve_cb,
+                                                          &progressdata);
+    }
 
     if (context->select_keyframes) {
       /* store actual keyframes used for reconstruction to update them in the interface later */
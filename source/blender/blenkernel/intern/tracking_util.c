@@ -596,6 +596,51 @@ MovieTrackingMarker *tracking_get_keyframed_marker(MovieTrackingTrack *track,
 /** \name Frame Accessor
  * \{ */
 
+/* Cache of whole frames with the expensive conversion (float, grayscale) already applied, shared
+ * by all markers which are tracked on the frame. Individual search regions are cropped from the
+ * cached frame, so tracking many markers pays the conversion cost only once per frame.
+ *
+ * Size of the cache is controlled by the global movie cache memory limit, eviction of old frames
+ * happens automatically. */
+
+typedef struct AccessCacheKey {
+  int clip_index;
+  int frame;
+} AccessCacheKey;
+
+static unsigned int accesscache_hashhash(const void *key_v)
+{
+  const AccessCacheKey *key = key_v;
+  return key->frame << 8 | key->clip_index;
+}
+
+static bool accesscache_hashcmp(const void *a_v, const void *b_v)
+{
+  const AccessCacheKey *a = a_v;
+  const AccessCacheKey *b = b_v;
+  return (a->clip_index != b->clip_index) || (a->frame != b->frame);
+}
+
+static ImBuf *accessor_cache_get(TrackingImageAccessor *accessor, int clip_index, int frame)
+{
+  const AccessCacheKey key = {.clip_index = clip_index, .frame = frame};
+  BLI_spin_lock(&accessor->cache_lock);
+  ImBuf *ibuf = IMB_moviecache_get(accessor->cache, (void *)&key, NULL);
+  BLI_spin_unlock(&accessor->cache_lock);
+  return ibuf;
+}
+
+static void accessor_cache_put(TrackingImageAccessor *accessor,
+                               int clip_index,
+                               int frame,
+                               ImBuf *ibuf)
+{
+  const AccessCacheKey key = {.clip_index = clip_index, .frame = frame};
+  BLI_spin_lock(&accessor->cache_lock);
+  IMB_moviecache_put(accessor->cache, (void *)&key, ibuf);
+  BLI_spin_unlock(&accessor->cache_lock);
+}
+
 static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
                                              int clip_index,
                                              int frame)
@@ -644,6 +689,41 @@ static ImBuf *make_grayscale_ibuf_copy(ImBuf *ibuf)
   return grayscale;
 }
 
+/* Convert the whole frame to a single channel float image.
+ *
+ * NOTE: Byte buffers are converted without colorspace transform, to match the per-region
+ * conversion in accessor_get_ibuf() which keeps sRGB space for compatibility. */
+static ImBuf *make_mono_ibuf_copy(ImBuf *ibuf)
+{
+  ImBuf *mono = IMB_allocImBuf(ibuf->x, ibuf->y, 32, 0);
+  const size_t num_pixels = (size_t)mono->x * (size_t)mono->y;
+
+  mono->channels = 1;
+  if ((mono->rect_float = MEM_callocN(num_pixels * sizeof(float), "tracking mono image")) ==
+      NULL) {
+    return mono;
+  }
+  mono->mall |= IB_rectfloat;
+  mono->flags |= IB_rectfloat;
+
+  if (ibuf->rect_float != NULL) {
+    BLI_assert(ELEM(ibuf->channels, 3, 4));
+    for (size_t i = 0; i < num_pixels; i++) {
+      const float *pixel = ibuf->rect_float + ibuf->channels * i;
+      mono->rect_float[i] = 0.2126f * pixel[0] + 0.7152f * pixel[1] + 0.0722f * pixel[2];
+    }
+  }
+  else {
+    for (size_t i = 0; i < num_pixels; i++) {
+      float pixel[4];
+      rgba_uchar_to_float(pixel, (const unsigned char *)ibuf->rect + 4 * i);
+      mono->rect_float[i] = 0.2126f * pixel[0] + 0.7152f * pixel[1] + 0.0722f * pixel[2];
+    }
+  }
+
+  return mono;
+}
+
 static void ibuf_to_float_image(const ImBuf *ibuf, libmv_FloatImage *float_image)
 {
   BLI_assert(ibuf->rect_float != NULL);
@@ -667,6 +747,81 @@ static ImBuf *float_image_to_ibuf(libmv_FloatImage *float_image)
   return ibuf;
 }
 
+/* Get single channel float image of the whole frame, shared between all markers tracked on it.
+ *
+ * NOTE: Threads which miss the cache simultaneously will both do the conversion, the cache simply
+ * ends up with the result of whichever finished last. This only wastes some work on the first
+ * access to a frame and requires no synchronization of the conversion itself. */
+static ImBuf *accessor_get_mono_frame_ibuf(TrackingImageAccessor *accessor,
+                                           int clip_index,
+                                           int frame)
+{
+  ImBuf *mono_ibuf = accessor_cache_get(accessor, clip_index, frame);
+  if (mono_ibuf != NULL) {
+    CACHE_PRINTF("Used cached mono buffer for frame %d\n", frame);
+    return mono_ibuf;
+  }
+  CACHE_PRINTF("Calculate new mono buffer for frame %d\n", frame);
+
+  ImBuf *orig_ibuf = accessor_get_preprocessed_ibuf(accessor, clip_index, frame);
+  if (orig_ibuf == NULL) {
+    return NULL;
+  }
+
+  mono_ibuf = make_mono_ibuf_copy(orig_ibuf);
+  IMB_freeImBuf(orig_ibuf);
+
+  accessor_cache_put(accessor, clip_index, frame, mono_ibuf);
+
+  return mono_ibuf;
+}
+
+/* Fast path for the single channel search regions the trackers use: crop the region from the
+ * shared per-frame mono image. */
+static ImBuf *accessor_get_mono_region_ibuf(TrackingImageAccessor *accessor,
+                                            int clip_index,
+                                            int frame,
+                                            const libmv_Region *region)
+{
+  ImBuf *mono_ibuf = accessor_get_mono_frame_ibuf(accessor, clip_index, frame);
+  if (mono_ibuf == NULL) {
+    return NULL;
+  }
+
+  const int width = region->max[0] - region->min[0],
+            height = region->max[1] - region->min[1];
+
+  /* Clamp the region to the frame bounds, the same way the generic region path does. */
+  const int clamped_origin_x = max_ii((int)region->min[0], 0),
+            clamped_origin_y = max_ii((int)region->min[1], 0);
+  const int dst_offset_x = clamped_origin_x - (int)region->min[0],
+            dst_offset_y = clamped_origin_y - (int)region->min[1];
+  int clamped_width = width - dst_offset_x, clamped_height = height - dst_offset_y;
+  clamped_width = min_ii(clamped_width, mono_ibuf->x - clamped_origin_x);
+  clamped_height = min_ii(clamped_height, mono_ibuf->y - clamped_origin_y);
+
+  ImBuf *final_ibuf = IMB_allocImBuf(width, height, 32, 0);
+  final_ibuf->channels = 1;
+  if ((final_ibuf->rect_float = MEM_callocN((size_t)width * (size_t)height * sizeof(float),
+                                            "tracking mono region")) != NULL) {
+    final_ibuf->mall |= IB_rectfloat;
+    final_ibuf->flags |= IB_rectfloat;
+
+    if (clamped_width > 0 && clamped_height > 0) {
+      for (int y = 0; y < clamped_height; y++) {
+        const float *src = mono_ibuf->rect_float +
+                           (size_t)(y + clamped_origin_y) * mono_ibuf->x + clamped_origin_x;
+        float *dst = final_ibuf->rect_float + (size_t)(y + dst_offset_y) * width + dst_offset_x;
+        memcpy(dst, src, sizeof(float) * clamped_width);
+      }
+    }
+  }
+
+  IMB_freeImBuf(mono_ibuf);
+
+  return final_ibuf;
+}
+
 static ImBuf *accessor_get_ibuf(TrackingImageAccessor *accessor,
                                 int clip_index,
                                 int frame,
@@ -675,6 +830,13 @@ static ImBuf *accessor_get_ibuf(TrackingImageAccessor *accessor,
                                 const libmv_Region *region,
                                 const libmv_FrameTransform *transform)
 {
+  /* All markers requesting single channel regions without channel masking or downscale share the
+   * cached per-frame conversion, with only the crop done per marker. */
+  if (region != NULL && transform == NULL && downscale == 0 &&
+      input_mode == LIBMV_IMAGE_MODE_MONO) {
+    return accessor_get_mono_region_ibuf(accessor, clip_index, frame, region);
+  }
+
   /* First try to get fully processed image from the cache. */
   CACHE_PRINTF("Calculate new buffer for frame %d\n", frame);
   /* And now we do postprocessing of the original frame. */
@@ -899,6 +1061,11 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
   memcpy(accessor->tracks, tracks, num_tracks * sizeof(MovieTrackingTrack *));
   accessor->num_tracks = num_tracks;
 
+  accessor->cache = IMB_moviecache_create("tracking accessor cache",
+                                          sizeof(AccessCacheKey),
+                                          accesscache_hashhash,
+                                          accesscache_hashcmp);
+
   accessor->libmv_accessor = libmv_FrameAccessorNew((libmv_FrameAccessorUserData *)accessor,
                                                     accessor_get_image_callback,
                                                     accessor_release_image_callback,
@@ -913,6 +1080,7 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor)
 {
   libmv_FrameAccessorDestroy(accessor->libmv_accessor);
+  IMB_moviecache_free(accessor->cache);
   BLI_spin_end(&accessor->cache_lock);
   MEM_freeN(accessor->tracks);
   MEM_freeN(accessor);
@@ -545,7 +545,12 @@ eUndoPushReturn BKE_undosys_step_push_with_type(UndoStack *ustack,
 
     CLOG_INFO(&LOG, 1, "addr=%p, name='%s', type='%s'", us, us->name, us->type->name);
 
-    if (!undosys_step_encode(C, G_MAIN, ustack, us)) {
+    /* Attribute step encoding (the bulk of undo memory) to a scope TDs can query,
+     * see #MEM_scope_usage_foreach. */
+    MEM_scope_push("undo");
+    const bool encode_ok = undosys_step_encode(C, G_MAIN, ustack, us);
+    MEM_scope_pop();
+    if (!encode_ok) {
       MEM_freeN(us);
       undosys_stack_validate(ustack, true);
       return retval;
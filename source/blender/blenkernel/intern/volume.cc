@@ -85,8 +85,9 @@ using blender::StringRef;
  *
  * When the number of users drops to zero, the grid data is immediately deleted.
  *
- * TODO: also add a cache for OpenVDB files rather than individual grids,
- * so getting the list of grids is also cached.
+ * Besides individual grids, the grid lists of entire files are cached as well, so
+ * getting the list of grids only parses the file once, see #file_metadata.
+ *
  * TODO: Further, we could cache openvdb::io::File so that loading a grid
  * does not re-open it every time. But then we have to take care not to run
  * out of file descriptors or prevent other applications from writing to it.
@@ -238,6 +239,61 @@ static struct VolumeFileCache {
     update_for_remove_user(entry);
   }
 
+  /* Cached grid list of an entire file, so that a file referenced by several datablocks
+   * (an original plus the copy-on-write copies made by the depsgraph, or frames of a
+   * sequence revisited while scrubbing) is only opened and parsed once. The grids in
+   * the list carry metadata only, voxel trees stay delay-loaded. */
+  struct FileMetadata {
+    openvdb::GridPtrVec grids;
+    openvdb::MetaMap::Ptr metadata;
+    std::string error_msg;
+    /* Stamp of the file when it was parsed, to detect changes on disk. */
+    int64_t mtime = 0;
+    int64_t size = 0;
+  };
+
+  FileMetadata file_metadata(const std::string &filepath)
+  {
+    BLI_stat_t st;
+    int64_t mtime = 0;
+    int64_t size = 0;
+    if (BLI_stat(filepath.c_str(), &st) != -1) {
+      mtime = int64_t(st.st_mtime);
+      size = int64_t(st.st_size);
+    }
+
+    std::lock_guard<std::mutex> lock(file_mutex);
+
+    FileMetadata *cached = file_cache.lookup_ptr(filepath);
+    if (cached && cached->mtime == mtime && cached->size == size) {
+      return *cached;
+    }
+
+    FileMetadata result;
+    result.mtime = mtime;
+    result.size = size;
+
+    try {
+      openvdb::io::File file(filepath);
+      file.setCopyMaxBytes(0);
+      file.open();
+      result.grids = *(file.readAllGridMetadata());
+      result.metadata = file.getMetadata();
+    }
+    catch (const openvdb::IoError &e) {
+      result.error_msg = e.what();
+    }
+
+    /* Refilling on demand is cheap, so simply start over instead of tracking usage
+     * when the cache grows large (long sequences of per-frame files). */
+    if (file_cache.size() >= 1024) {
+      file_cache.clear();
+    }
+    file_cache.add_overwrite(filepath, result);
+
+    return result;
+  }
+
  protected:
   void update_for_remove_user(Entry &entry)
   {
@@ -262,6 +318,9 @@ static struct VolumeFileCache {
   EntrySet cache;
   /* Mutex for multithreaded access. */
   std::mutex mutex;
+  /* Cached grid lists per file, see #file_metadata. */
+  blender::Map<std::string, FileMetadata> file_cache;
+  std::mutex file_mutex;
 } GLOBAL_CACHE;
 
 /* VolumeGrid
@@ -835,25 +894,23 @@ bool BKE_volume_load(const Volume *volume, const Main *bmain)
     return false;
   }
 
-  /* Open OpenVDB file. */
-  openvdb::io::File file(filepath);
-  openvdb::GridPtrVec vdb_grids;
+  /* Get the grid list, from the cache when the file was parsed before. */
+  VolumeFileCache::FileMetadata file_metadata = GLOBAL_CACHE.file_metadata(filepath);
 
-  try {
-    file.setCopyMaxBytes(0);
-    file.open();
-    vdb_grids = *(file.readAllGridMetadata());
-    grids.metadata = file.getMetadata();
-  }
-  catch (const openvdb::IoError &e) {
-    grids.error_msg = e.what();
+  if (!file_metadata.error_msg.empty()) {
+    grids.error_msg = file_metadata.error_msg;
     CLOG_INFO(&LOG, 1, "Volume %s: %s", volume_name, grids.error_msg.c_str());
   }
+  if (file_metadata.metadata) {
+    grids.metadata = file_metadata.metadata;
+  }
 
   /* Add grids read from file to own vector, filtering out any NULL pointers. */
-  for (const openvdb::GridBase::Ptr &vdb_grid : vdb_grids) {
+  for (const openvdb::GridBase::Ptr &vdb_grid : file_metadata.grids) {
     if (vdb_grid) {
-      VolumeFileCache::Entry template_entry(filepath, vdb_grid);
+      /* Copy so that the cached grid list never aliases the entry's grid, which gets
+       * its tree set once voxel data is loaded. */
+      VolumeFileCache::Entry template_entry(filepath, vdb_grid->copyGridWithNewTree());
       grids.emplace_back(template_entry, volume->runtime.default_simplify_level);
     }
   }
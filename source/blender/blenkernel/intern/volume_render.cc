@@ -88,12 +88,12 @@ static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform
 
 #endif
 
-bool BKE_volume_grid_dense_floats(const Volume *volume,
-                                  const VolumeGrid *volume_grid,
-                                  DenseFloatVolumeGrid *r_dense_grid)
+bool BKE_volume_grid_dense_resolution(const Volume *volume,
+                                      const VolumeGrid *volume_grid,
+                                      int r_resolution[3],
+                                      float r_texture_to_object[4][4])
 {
 #ifdef WITH_OPENVDB
-  const VolumeGridType grid_type = BKE_volume_grid_type(volume_grid);
   openvdb::GridBase::ConstPtr grid = BKE_volume_grid_openvdb_for_read(volume, volume_grid);
 
   const openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
@@ -102,35 +102,35 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   }
 
   const openvdb::Vec3i resolution = bbox.dim().asVec3i();
-  const int64_t num_voxels = static_cast<int64_t>(resolution[0]) *
-                             static_cast<int64_t>(resolution[1]) *
-                             static_cast<int64_t>(resolution[2]);
-  const int channels = BKE_volume_grid_channels(volume_grid);
-  const int elem_size = sizeof(float) * channels;
-  float *voxels = static_cast<float *>(MEM_malloc_arrayN(num_voxels, elem_size, __func__));
-  if (voxels == nullptr) {
-    return false;
-  }
-
-  extract_dense_float_voxels(grid_type, *grid, bbox, voxels);
-  create_texture_to_object_matrix(grid->transform().baseMap()->getAffineMap()->getMat4(),
-                                  bbox,
-                                  r_dense_grid->texture_to_object);
-
-  r_dense_grid->voxels = voxels;
-  r_dense_grid->channels = channels;
-  copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
+  copy_v3_v3_int(r_resolution, resolution.asV());
+  create_texture_to_object_matrix(
+      grid->transform().baseMap()->getAffineMap()->getMat4(), bbox, r_texture_to_object);
   return true;
 #endif
-  UNUSED_VARS(volume, volume_grid, r_dense_grid);
+  UNUSED_VARS(volume, volume_grid, r_resolution, r_texture_to_object);
   return false;
 }
 
-void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid)
+void BKE_volume_grid_dense_voxels(const Volume *volume,
+                                  const VolumeGrid *volume_grid,
+                                  const int slice_z,
+                                  const int slices_num,
+                                  float *r_voxels)
 {
-  if (dense_grid->voxels != nullptr) {
-    MEM_freeN(dense_grid->voxels);
-  }
+#ifdef WITH_OPENVDB
+  const VolumeGridType grid_type = BKE_volume_grid_type(volume_grid);
+  openvdb::GridBase::ConstPtr grid = BKE_volume_grid_openvdb_for_read(volume, volume_grid);
+
+  openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
+  BLI_assert(!bbox.empty());
+  BLI_assert(slice_z >= 0 && slice_z + slices_num <= bbox.dim().z());
+
+  bbox.min().z() += slice_z;
+  bbox.max().z() = bbox.min().z() + slices_num - 1;
+
+  extract_dense_float_voxels(grid_type, *grid, bbox, r_voxels);
+#endif
+  UNUSED_VARS(volume, volume_grid, slice_z, slices_num, r_voxels);
 }
 
 /* Wireframe */
@@ -120,6 +120,10 @@ typedef struct NlaEvalSnapshot {
 typedef struct NlaEvalData {
   ListBase channels;
 
+  /* Arena that channels, their snapshots and masks are allocated from, so that the many small
+   * allocations of an evaluation can be thrown away in one step. */
+  struct MemArena *arena;
+
   /* Mapping of paths and NlaEvalChannelKeys to channels. */
   GHash *path_hash;
   GHash *key_hash;
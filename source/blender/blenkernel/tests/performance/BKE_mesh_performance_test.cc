@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+/** \file
+ * \ingroup bke
+ *
+ * Benchmarks for heavy mesh operations on generated grid meshes, from 100 thousand up to
+ * 20 million vertices. Not part of the regular test run (see #BLENDER_TEST_PERFORMANCE),
+ * run the `BKE_mesh_performance_test` binary manually. Besides the human readable timing,
+ * every benchmark prints a single JSON line so results are easy to collect and trend
+ * across builds.
+ */
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "CLG_log.h"
+
+#include "BLI_fileops.h"
+#include "BLI_path_util.h"
+#include "BLI_threads.h"
+
+#include "DNA_genfile.h"
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+
+#include "BKE_appdir.h"
+#include "BKE_blender.h"
+#include "BKE_customdata.h"
+#include "BKE_idtype.h"
+#include "BKE_lib_id.h"
+#include "BKE_main.h"
+#include "BKE_mesh.h"
+
+#include "BLO_writefile.h"
+
+#include "bmesh.h"
+
+#include "PIL_time.h"
+
+namespace blender::bke::tests {
+
+/** Grid side lengths (in vertices) for roughly 100k, 1M, 4M and 20M vertex meshes. */
+static const int grid_sizes[] = {317, 1000, 2000, 4472};
+
+static void print_result(const char *op, const int verts_num, const double time)
+{
+  printf("{\"op\": \"%s\", \"verts\": %d, \"time\": %f}\n", op, verts_num, time);
+}
+
+/**
+ * Build a `verts_side` x `verts_side` grid of quads. The surface is given a zigzag profile
+ * so normal calculation doesn't run on trivially equal face normals.
+ */
+static Mesh *create_grid_mesh(const int verts_side)
+{
+  const int polys_side = verts_side - 1;
+  const int verts_num = verts_side * verts_side;
+  const int polys_num = polys_side * polys_side;
+  Mesh *mesh = BKE_mesh_new_nomain(verts_num, 0, 0, polys_num * 4, polys_num);
+
+  for (int y = 0; y < verts_side; y++) {
+    for (int x = 0; x < verts_side; x++) {
+      MVert &vert = mesh->mvert[y * verts_side + x];
+      vert.co[0] = float(x);
+      vert.co[1] = float(y);
+      vert.co[2] = (x & 1) ? 0.1f : 0.0f;
+    }
+  }
+
+  int loop_index = 0;
+  for (int y = 0; y < polys_side; y++) {
+    for (int x = 0; x < polys_side; x++) {
+      MPoly &poly = mesh->mpoly[y * polys_side + x];
+      poly.loopstart = loop_index;
+      poly.totloop = 4;
+      mesh->mloop[loop_index++].v = y * verts_side + x;
+      mesh->mloop[loop_index++].v = y * verts_side + x + 1;
+      mesh->mloop[loop_index++].v = (y + 1) * verts_side + x + 1;
+      mesh->mloop[loop_index++].v = (y + 1) * verts_side + x;
+    }
+  }
+
+  return mesh;
+}
+
+class MeshPerformanceTest : public testing::Test {
+ public:
+  static void SetUpTestCase()
+  {
+    /* Minimal subset of `main()` in `creator.c` needed to build meshes in a #Main and
+     * write blend-files. */
+    CLG_init();
+    BLI_threadapi_init();
+    DNA_sdna_current_init();
+    BKE_blender_globals_init();
+    BKE_idtype_init();
+    BKE_appdir_init();
+  }
+
+  static void TearDownTestCase()
+  {
+    BKE_blender_atexit();
+    BKE_appdir_exit();
+    DNA_sdna_current_free();
+    BLI_threadapi_exit();
+    CLG_exit();
+  }
+};
+
+static void benchmark_calc_normals(const int verts_side)
+{
+  Mesh *mesh = create_grid_mesh(verts_side);
+
+  BKE_mesh_normals_tag_dirty(mesh);
+  const double start_time = PIL_check_seconds_timer();
+  BKE_mesh_calc_normals(mesh);
+  print_result("mesh_calc_normals", mesh->totvert, PIL_check_seconds_timer() - start_time);
+
+  BKE_id_free(nullptr, mesh);
+}
+
+static void benchmark_bm_to_me(const int verts_side)
+{
+  Mesh *mesh = create_grid_mesh(verts_side);
+
+  const BMeshCreateParams create_params = {false};
+  const BMAllocTemplate allocsize = BMALLOC_TEMPLATE_FROM_ME(mesh);
+  BMesh *bm = BM_mesh_create(&allocsize, &create_params);
+
+  BMeshFromMeshParams from_me_params{};
+  BM_mesh_bm_from_me(bm, mesh, &from_me_params);
+
+  Mesh *mesh_dst = BKE_mesh_new_nomain(0, 0, 0, 0, 0);
+  BMeshToMeshParams to_me_params{};
+  const double start_time = PIL_check_seconds_timer();
+  BM_mesh_bm_to_me(nullptr, bm, mesh_dst, &to_me_params);
+  print_result("BM_mesh_bm_to_me", mesh_dst->totvert, PIL_check_seconds_timer() - start_time);
+
+  BM_mesh_free(bm);
+  BKE_id_free(nullptr, mesh_dst);
+  BKE_id_free(nullptr, mesh);
+}
+
+static void benchmark_write_file(const int verts_side)
+{
+  Main *bmain = BKE_main_new();
+  Mesh *mesh_in_main = BKE_mesh_add(bmain, "PerfMesh");
+  Mesh *mesh = create_grid_mesh(verts_side);
+  const int verts_num = mesh->totvert;
+  BKE_mesh_nomain_to_mesh(mesh, mesh_in_main, nullptr, &CD_MASK_MESH, true);
+
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_base(), "mesh_perf.blend", nullptr);
+
+  const BlendFileWriteParams write_params{};
+  const double start_time = PIL_check_seconds_timer();
+  const bool success = BLO_write_file(bmain, filepath, 0, &write_params, nullptr);
+  print_result("BLO_write_file", verts_num, PIL_check_seconds_timer() - start_time);
+  EXPECT_TRUE(success);
+
+  BLI_delete(filepath, false, false);
+  BKE_main_free(bmain);
+}
+
+TEST_F(MeshPerformanceTest, calc_normals)
+{
+  for (const int verts_side : grid_sizes) {
+    benchmark_calc_normals(verts_side);
+  }
+}
+
+TEST_F(MeshPerformanceTest, bm_to_me)
+{
+  for (const int verts_side : grid_sizes) {
+    benchmark_bm_to_me(verts_side);
+  }
+}
+
+TEST_F(MeshPerformanceTest, write_file)
+{
+  for (const int verts_side : grid_sizes) {
+    benchmark_write_file(verts_side);
+  }
+}
+
+}  // namespace blender::bke::tests
@@ -142,6 +142,7 @@ float *tracking_track_get_mask_for_region(int frame_width,
 
 /*********************** Frame Accessor *************************/
 
+struct MovieCache;
 struct libmv_FrameAccessor;
 
 #define MAX_ACCESSOR_CLIP 64
@@ -156,6 +157,10 @@ typedef struct TrackingImageAccessor {
   int num_tracks;
 
   struct libmv_FrameAccessor *libmv_accessor;
+
+  /* Cache of per-frame images with all the tracker-side conversion applied,
+   * shared by all markers tracked on the frame. */
+  struct MovieCache *cache;
   SpinLock cache_lock;
 } TrackingImageAccessor;
 
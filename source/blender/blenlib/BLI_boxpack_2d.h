@@ -44,6 +44,17 @@ typedef struct BoxPack {
  */
 void BLI_box_pack_2d(BoxPack *boxarray, unsigned int len, float *r_tot_x, float *r_tot_y);
 
+/**
+ * Skyline bottom-left variant of #BLI_box_pack_2d, same contract but near linear in the number
+ * of boxes where the vertex based packer above goes quadratic. Packing quality is slightly worse,
+ * use it when the box count is too large for the default packer (it handles hundreds of
+ * thousands of boxes in milliseconds). The #BoxPack.v verts are not used or touched.
+ */
+void BLI_box_pack_2d_skyline(BoxPack *boxarray,
+                             unsigned int len,
+                             float *r_tot_x,
+                             float *r_tot_y);
+
 typedef struct FixedSizeBoxPack {
   struct FixedSizeBoxPack *next, *prev;
   int x, y;
@@ -30,12 +30,20 @@ struct FileReader;
 typedef ssize_t (*FileReaderReadFn)(struct FileReader *reader, void *buffer, size_t size);
 typedef off64_t (*FileReaderSeekFn)(struct FileReader *reader, off64_t offset, int whence);
 typedef void (*FileReaderCloseFn)(struct FileReader *reader);
+typedef const void *(*FileReaderDataFn)(struct FileReader *reader, size_t offset, size_t size);
 
 /** General structure for all #FileReaders, implementations add custom fields at the end. */
 typedef struct FileReader {
   FileReaderReadFn read;
   FileReaderSeekFn seek;
   FileReaderCloseFn close;
+  /**
+   * Optional (NULL for most readers): direct access to the underlying storage without
+   * copying, for memory-backed and memory-mapped readers. Returns NULL when the requested
+   * range is not available. The pointer stays valid until the reader is closed and must
+   * not be written to.
+   */
+  FileReaderDataFn data;
 
   off64_t offset;
 } FileReader;
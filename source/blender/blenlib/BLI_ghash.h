@@ -59,6 +59,9 @@ enum {
   /* Internal usage only */
   /* Whether the GHash is actually used as GSet (no value storage). */
   GHASH_FLAG_IS_GSET = (1 << 16),
+  /* Whether the GHash uses the flat (open-addressing) backing store,
+   * see #BLI_ghash_flat_new. */
+  GHASH_FLAG_IS_FLAT = (1 << 17),
 #endif
 };
 
@@ -90,6 +93,27 @@ GHash *BLI_ghash_new_ex(GHashHashFP hashfp,
 GHash *BLI_ghash_new(GHashHashFP hashfp,
                      GHashCmpFP cmpfp,
                      const char *info) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
+/**
+ * Creates a new, empty GHash backed by a flat open-addressing (robin-hood) table instead of
+ * chained buckets with one allocation per entry. Supports the full GHash API, so call sites can
+ * switch by only changing the constructor. Prefer it for lookup-heavy tables: probing stays
+ * within one contiguous array which is considerably more cache friendly.
+ *
+ * Differences from #BLI_ghash_new_ex:
+ * - Pointers into the table (#BLI_ghash_ensure_p, #BLI_ghash_lookup_p, iterators) are
+ *   invalidated by any insertion or removal, not only by resizes.
+ * - #GHASH_FLAG_ALLOW_DUPES and #GHASH_FLAG_ALLOW_SHRINK are not supported.
+ */
+GHash *BLI_ghash_flat_new_ex(GHashHashFP hashfp,
+                             GHashCmpFP cmpfp,
+                             const char *info,
+                             unsigned int nentries_reserve) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
+/**
+ * Wraps #BLI_ghash_flat_new_ex with zero entries reserved.
+ */
+GHash *BLI_ghash_flat_new(GHashHashFP hashfp,
+                          GHashCmpFP cmpfp,
+                          const char *info) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
 /**
  * Copy given GHash. Keys and values are also copied if relevant callback is provided,
  * else pointers remain the same.
@@ -252,6 +252,27 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
 
+/**
+ * Cast many independent rays in one call.
+ *
+ * Rays are internally sorted by direction octant and entry depth so consecutive rays tend to
+ * visit the same part of the tree, and per-direction pre-calculation is shared between rays with
+ * equal directions. When SIMD is available and \a radius is zero, the bounding volumes of child
+ * nodes are tested four at a time. Results are written back in the original ray order.
+ *
+ * \param hits: An array of \a rays_num hits, each initialized the way a single
+ * #BLI_bvhtree_ray_cast hit would be (`index` -1, `dist` the maximum cast distance).
+ */
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*ray_origins)[3],
+                                const float (*ray_directions)[3],
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                int rays_num,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag);
+
 /**
  * Calls the callback for every ray intersection
  *
@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Batched variants of the single vector math functions, operating on contiguous arrays of
+ * 3D vectors. Prefer these over open-coded loops when transforming whole coordinate arrays:
+ * the implementations are written so the compiler can vectorize them, with explicit SIMD
+ * paths (see BLI_simd.h) where the access pattern prevents auto-vectorization.
+ *
+ * Unlike the flat `*_vn` functions in BLI_math_vector.h these keep the `float (*)[3]`
+ * signature used by vertex coordinate arrays throughout the code-base.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Add each vector in \a array_src to the matching vector in \a array_tar.
+ */
+void add_v3_array(float (*array_tar)[3], const float (*array_src)[3], int size);
+
+/**
+ * Multiply-add: `array_tar[i] += array_src[i] * f`.
+ */
+void madd_v3_array_fl(float (*array_tar)[3], const float (*array_src)[3], float f, int size);
+
+/**
+ * Store the dot product of each vector pair in \a r_array: `r_array[i] = dot(a[i], b[i])`.
+ */
+void dot_v3_array(float *r_array, const float (*array_a)[3], const float (*array_b)[3], int size);
+
+/**
+ * Per element linear interpolation: `array_tar[i] = lerp(a[i], b[i], t)`.
+ */
+void interp_v3_array(
+    float (*array_tar)[3], const float (*array_a)[3], const float (*array_b)[3], float t, int size);
+
+/**
+ * Normalize every vector in place. Zero length vectors are left zeroed,
+ * callers that need a fallback (as some normal calculation does) can check
+ * with #is_zero_v3 afterwards.
+ */
+void normalize_v3_array(float (*array_tar)[3], int size);
+
+/**
+ * Transform every vector in place by \a mat (location included), see #mul_m4_v3.
+ */
+void mul_m4_v3_array(const float mat[4][4], float (*array_tar)[3], int size);
+
+/**
+ * Transform every vector in place by \a mat, see #mul_m3_v3.
+ */
+void mul_m3_v3_array(const float mat[3][3], float (*array_tar)[3], int size);
+
+#ifdef __cplusplus
+}
+#endif
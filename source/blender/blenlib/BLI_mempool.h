@@ -50,6 +50,11 @@ void BLI_mempool_clear(BLI_mempool *pool) ATTR_NONNULL(1);
  */
 void BLI_mempool_destroy(BLI_mempool *pool) ATTR_NONNULL(1);
 int BLI_mempool_len(const BLI_mempool *pool) ATTR_NONNULL(1);
+/**
+ * The number of chunks backing \a pool (parallel iteration hands out whole chunks,
+ * so this bounds how many threads can get work).
+ */
+int BLI_mempool_chunk_count(const BLI_mempool *pool) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
 void *BLI_mempool_findelem(BLI_mempool *pool, unsigned int index) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1);
 
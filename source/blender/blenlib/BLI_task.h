@@ -35,6 +35,32 @@ void BLI_task_scheduler_init(void);
 void BLI_task_scheduler_exit(void);
 int BLI_task_scheduler_num_threads(void);
 
+/**
+ * Number of NUMA nodes tasks can be pinned to with #BLI_task_execute_on_numa_node.
+ * Returns 1 when the scheduler has no NUMA support (single socket machines, or TBB built
+ * without it).
+ */
+int BLI_task_scheduler_numa_node_count(void);
+
+/**
+ * Execute \a func inside a scheduler arena whose worker threads are pinned to the given NUMA
+ * node. Tasks spawned by \a func (task pools, parallel ranges) stay within the arena, and with
+ * the usual first-touch policy their scratch allocations end up on the node's local memory.
+ *
+ * \a numa_node must be in `[0, BLI_task_scheduler_numa_node_count())`; when the scheduler has no
+ * NUMA support \a func simply runs in the caller's arena.
+ */
+void BLI_task_execute_on_numa_node(int numa_node, void (*func)(void *userdata), void *userdata);
+
+/**
+ * Execute \a func inside a high-priority scheduler arena: its tasks are preferred by the worker
+ * threads over the normal-priority bulk work that is already queued. Use for short,
+ * latency-critical evaluations (e.g. triggered from the UI) that should not have to wait for
+ * large background computations. Falls back to running \a func directly when the scheduler has
+ * no priority support.
+ */
+void BLI_task_execute_high_priority(void (*func)(void *userdata), void *userdata);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Lightweight always-compiled tracing of nestable named zones, for profiling production
+ * scenes on artist machines without rebuilding with an external profiler.
+ *
+ * Zones are recorded into per-thread ring buffers so hot paths never contend on a lock,
+ * and only when tracing has been enabled at runtime (see `--debug-trace`); a disabled
+ * zone is a single atomic load. Recorded zones can be exported as Chrome tracing JSON,
+ * which loads into `about://tracing` or https://ui.perfetto.dev.
+ *
+ * Unlike #BLI_timeit this does not print anything on its own and is usable from C.
+ */
+
+#include "BLI_sys_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Enable or disable recording of zones. Safe to toggle at any time, zones that are
+ * open while tracing is toggled simply end up unpaired in the export.
+ */
+void BLI_trace_set_enabled(bool enabled);
+bool BLI_trace_is_enabled(void);
+
+/**
+ * Record the begin/end of a named zone on the current thread. Zones may nest freely.
+ * \a name is copied, so transient names (e.g. a modifier name) are fine.
+ */
+void BLI_trace_zone_begin(const char *name);
+void BLI_trace_zone_end(void);
+
+/**
+ * Write all recorded zones in Chrome tracing JSON format.
+ * Export while tracing is disabled to get a consistent snapshot.
+ */
+bool BLI_trace_export_json(const char *filepath);
+
+/**
+ * Discard all recorded zones (the per-thread buffers themselves are kept).
+ */
+void BLI_trace_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+
+namespace blender::trace {
+
+class ScopedZone {
+ public:
+  ScopedZone(const char *name)
+  {
+    BLI_trace_zone_begin(name);
+  }
+
+  ~ScopedZone()
+  {
+    BLI_trace_zone_end();
+  }
+};
+
+}  // namespace blender::trace
+
+#  define BLI_TRACE_ZONE(name) blender::trace::ScopedZone trace_zone_scope(name)
+
+#endif
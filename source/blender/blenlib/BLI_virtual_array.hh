@@ -1158,4 +1158,40 @@ inline void devirtualize_varray2(const VArray<T1> &varray1,
   func(varray1, varray2);
 }
 
+/**
+ * Same as `devirtualize_varray`, but devirtualizes three virtual arrays at the same time.
+ * Note that this instantiates nine versions of the given function, so it should only be used for
+ * small functions where the virtual call overhead dominates.
+ */
+template<typename T1, typename T2, typename T3, typename Func>
+inline void devirtualize_varray3(const VArray<T1> &varray1,
+                                 const VArray<T2> &varray2,
+                                 const VArray<T3> &varray3,
+                                 const Func &func,
+                                 bool enable = true)
+{
+  /* Support disabling the devirtualization to simplify benchmarking. */
+  if (enable) {
+    const bool is_span1 = varray1.is_span();
+    const bool is_span2 = varray2.is_span();
+    const bool is_span3 = varray3.is_span();
+    const bool is_single1 = varray1.is_single();
+    const bool is_single2 = varray2.is_single();
+    const bool is_single3 = varray3.is_single();
+    if ((is_span1 || is_single1) && (is_span2 || is_single2) && (is_span3 || is_single3)) {
+      devirtualize_varray2(varray1, varray2, [&](const auto &in1, const auto &in2) {
+        if (is_span3) {
+          func(in1, in2, varray3.get_internal_span());
+        }
+        else {
+          func(in1, in2, SingleAsSpan(varray3));
+        }
+      });
+      return;
+    }
+  }
+  /* Same reasoning as in #devirtualize_varray2: don't optimize individual inputs. */
+  func(varray1, varray2, varray3);
+}
+
 }  // namespace blender
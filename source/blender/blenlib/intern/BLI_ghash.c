@@ -94,6 +94,12 @@ struct GHash {
   uint bucket_mask, bucket_bit, bucket_bit_min;
 #endif
 
+  /* Flat (open-addressing) backing store, used instead of `buckets`/`entrypool` when
+   * #GHASH_FLAG_IS_FLAT is set (see #BLI_ghash_flat_new). `nbuckets` doubles as the slot count
+   * (always a power of two in that case). */
+  GHashEntry *slots;
+  uint slot_mask; /* `nbuckets - 1`. */
+
   uint nentries;
   uint flag;
 };
@@ -104,6 +110,8 @@ struct GHash {
 /** \name Internal Utility API
  * \{ */
 
+static GHashEntry *ghash_flat_lookup_slot(const GHash *gh, const void *key, uint *r_index);
+
 BLI_INLINE void ghash_entry_copy(GHash *gh_dst,
                                  Entry *dst,
                                  const GHash *gh_src,
@@ -408,6 +416,9 @@ BLI_INLINE Entry *ghash_lookup_entry_prev_ex(GHash *gh,
  */
 BLI_INLINE Entry *ghash_lookup_entry(const GHash *gh, const void *key)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    return (Entry *)ghash_flat_lookup_slot(gh, key, NULL);
+  }
   const uint hash = ghash_keyhash(gh, key);
   const uint bucket_index = ghash_bucket_index(gh, hash);
   return ghash_lookup_entry_ex(gh, key, bucket_index);
@@ -425,6 +436,7 @@ static GHash *ghash_new(GHashHashFP hashfp,
   gh->cmpfp = cmpfp;
 
   gh->buckets = NULL;
+  gh->slots = NULL;
   gh->flag = flag;
 
   ghash_buckets_reset(gh, nentries_reserve);
@@ -674,6 +686,253 @@ static GHash *ghash_copy(const GHash *gh, GHashKeyCopyFP keycopyfp, GHashValCopy
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Flat Backing Store (Open Addressing)
+ *
+ * Robin-hood open addressing used when #GHASH_FLAG_IS_FLAT is set. Entries are stored in one
+ * contiguous slot array instead of one mempool allocation per entry, which keeps probing
+ * cache-friendly. Slots reuse the #GHashEntry layout so the inline iterator accessors in
+ * `BLI_ghash.h` keep working unchanged: the `next` pointer of a slot is repurposed to store the
+ * key's hash shifted up by one bit with the lowest bit set (so it is never NULL for a used slot),
+ * NULL marks an empty slot.
+ *
+ * Limitations compared to the chained storage: pointers into the table (#BLI_ghash_ensure_p,
+ * #BLI_ghash_lookup_p) are only valid until the next insertion, #GHASH_FLAG_ALLOW_DUPES and
+ * #GHASH_FLAG_ALLOW_SHRINK are not supported, and #GSet cannot use it.
+ * \{ */
+
+#define GHASH_FLAT_NSLOTS_MIN 8
+
+BLI_INLINE uintptr_t ghash_flat_stored_hash(const uint hash)
+{
+  return ((uintptr_t)hash << 1) | (uintptr_t)1;
+}
+
+BLI_INLINE bool ghash_flat_slot_is_used(const GHashEntry *slot)
+{
+  return slot->e.next != NULL;
+}
+
+/** Index the key stored in \a slot hashes to, before probing. */
+BLI_INLINE uint ghash_flat_slot_home(const GHash *gh, const GHashEntry *slot)
+{
+  return (uint)((uintptr_t)slot->e.next >> 1) & gh->slot_mask;
+}
+
+/** Distance between a slot's position \a i and its home index (the probe length). */
+BLI_INLINE uint ghash_flat_slot_dist(const GHash *gh, const GHashEntry *slot, const uint i)
+{
+  return (i - ghash_flat_slot_home(gh, slot)) & gh->slot_mask;
+}
+
+/**
+ * Allocate a zeroed (all-empty) slot array sized for at least \a nentries_reserve entries
+ * at the configured maximum load.
+ */
+static void ghash_flat_slots_reset(GHash *gh, const uint nentries_reserve)
+{
+  uint nslots = GHASH_FLAT_NSLOTS_MIN;
+  while (GHASH_LIMIT_GROW(nslots) < nentries_reserve) {
+    nslots <<= 1;
+  }
+
+  MEM_SAFE_FREE(gh->slots);
+  gh->slots = MEM_callocN(sizeof(*gh->slots) * (size_t)nslots, __func__);
+  gh->nbuckets = nslots;
+  gh->slot_mask = nslots - 1;
+  gh->limit_grow = GHASH_LIMIT_GROW(nslots);
+  gh->limit_shrink = 0; /* Flat storage never shrinks. */
+  gh->nentries = 0;
+}
+
+/**
+ * Robin-hood insertion core: place the entry, displacing richer entries as needed.
+ * The caller must have ensured the key is not in the table yet and that there is room.
+ */
+static void ghash_flat_insert_no_lookup(GHash *gh, uintptr_t hash_stored, void *key, void *val)
+{
+  const uint mask = gh->slot_mask;
+  uint i = (uint)(hash_stored >> 1) & mask;
+  uint dist = 0;
+
+  for (;;) {
+    GHashEntry *slot = &gh->slots[i];
+    if (!ghash_flat_slot_is_used(slot)) {
+      slot->e.next = (Entry *)hash_stored;
+      slot->e.key = key;
+      slot->val = val;
+      return;
+    }
+    const uint slot_dist = ghash_flat_slot_dist(gh, slot, i);
+    if (slot_dist < dist) {
+      /* The resident entry is closer to its home than ours, swap to keep probe lengths even. */
+      const uintptr_t hash_stored_tmp = (uintptr_t)slot->e.next;
+      slot->e.next = (Entry *)hash_stored;
+      hash_stored = hash_stored_tmp;
+      SWAP(void *, key, slot->e.key);
+      SWAP(void *, val, slot->val);
+      dist = slot_dist;
+    }
+    i = (i + 1) & mask;
+    dist++;
+  }
+}
+
+static void ghash_flat_resize(GHash *gh, const uint nslots_new)
+{
+  GHashEntry *slots_old = gh->slots;
+  const uint nslots_old = gh->nbuckets;
+
+  gh->slots = MEM_callocN(sizeof(*gh->slots) * (size_t)nslots_new, __func__);
+  gh->nbuckets = nslots_new;
+  gh->slot_mask = nslots_new - 1;
+  gh->limit_grow = GHASH_LIMIT_GROW(nslots_new);
+
+  for (uint i = 0; i < nslots_old; i++) {
+    GHashEntry *slot = &slots_old[i];
+    if (ghash_flat_slot_is_used(slot)) {
+      /* The full hash is stored in the slot, no need to re-hash the keys. */
+      ghash_flat_insert_no_lookup(gh, (uintptr_t)slot->e.next, slot->e.key, slot->val);
+    }
+  }
+
+  MEM_freeN(slots_old);
+}
+
+BLI_INLINE void ghash_flat_expand(GHash *gh)
+{
+  if (UNLIKELY(gh->nentries >= gh->limit_grow)) {
+    ghash_flat_resize(gh, gh->nbuckets << 1);
+  }
+}
+
+/** Find the slot containing \a key, or NULL. Optionally returns the slot index. */
+static GHashEntry *ghash_flat_lookup_slot(const GHash *gh, const void *key, uint *r_index)
+{
+  const uintptr_t hash_stored = ghash_flat_stored_hash(ghash_keyhash(gh, key));
+  const uint mask = gh->slot_mask;
+  uint i = (uint)(hash_stored >> 1) & mask;
+  uint dist = 0;
+
+  for (;;) {
+    GHashEntry *slot = (GHashEntry *)&gh->slots[i];
+    if (!ghash_flat_slot_is_used(slot)) {
+      return NULL;
+    }
+    if ((uintptr_t)slot->e.next == hash_stored && gh->cmpfp(key, slot->e.key) == false) {
+      if (r_index) {
+        *r_index = i;
+      }
+      return slot;
+    }
+    if (ghash_flat_slot_dist(gh, slot, i) < dist) {
+      /* Our entry would have displaced this richer one, so it cannot be further along. */
+      return NULL;
+    }
+    i = (i + 1) & mask;
+    dist++;
+  }
+}
+
+BLI_INLINE void ghash_flat_insert(GHash *gh, void *key, void *val)
+{
+  BLI_assert(ghash_flat_lookup_slot(gh, key, NULL) == NULL);
+  ghash_flat_expand(gh);
+  ghash_flat_insert_no_lookup(gh, ghash_flat_stored_hash(ghash_keyhash(gh, key)), key, val);
+  gh->nentries++;
+}
+
+/** Remove the entry at slot \a i using backward-shift deletion. */
+static void ghash_flat_remove_slot(GHash *gh, uint i)
+{
+  const uint mask = gh->slot_mask;
+
+  for (;;) {
+    const uint i_next = (i + 1) & mask;
+    GHashEntry *slot_next = &gh->slots[i_next];
+    if (!ghash_flat_slot_is_used(slot_next) || ghash_flat_slot_dist(gh, slot_next, i_next) == 0) {
+      break;
+    }
+    gh->slots[i] = *slot_next;
+    i = i_next;
+  }
+
+  gh->slots[i].e.next = NULL;
+  gh->nentries--;
+}
+
+/** Index of the next used slot starting from \a curr (wrapping), \a gh assumed non-empty. */
+static uint ghash_flat_find_next_used_slot(const GHash *gh, uint curr)
+{
+  BLI_assert(gh->nentries != 0);
+  for (;;) {
+    if (curr >= gh->nbuckets) {
+      curr = 0;
+    }
+    if (ghash_flat_slot_is_used(&gh->slots[curr])) {
+      return curr;
+    }
+    curr++;
+  }
+}
+
+static void ghash_flat_free_cb(GHash *gh, GHashKeyFreeFP keyfreefp, GHashValFreeFP valfreefp)
+{
+  BLI_assert(keyfreefp || valfreefp);
+
+  for (uint i = 0; i < gh->nbuckets; i++) {
+    GHashEntry *slot = &gh->slots[i];
+    if (ghash_flat_slot_is_used(slot)) {
+      if (keyfreefp) {
+        keyfreefp(slot->e.key);
+      }
+      if (valfreefp) {
+        valfreefp(slot->val);
+      }
+    }
+  }
+}
+
+static GHash *ghash_flat_new(GHashHashFP hashfp,
+                             GHashCmpFP cmpfp,
+                             const char *info,
+                             const uint nentries_reserve,
+                             const uint flag)
+{
+  GHash *gh = MEM_mallocN(sizeof(*gh), info);
+
+  gh->hashfp = hashfp;
+  gh->cmpfp = cmpfp;
+
+  gh->buckets = NULL;
+  gh->entrypool = NULL;
+  gh->slots = NULL;
+  gh->flag = flag | GHASH_FLAG_IS_FLAT;
+
+  ghash_flat_slots_reset(gh, nentries_reserve);
+
+  return gh;
+}
+
+static GHash *ghash_flat_copy(const GHash *gh, GHashKeyCopyFP keycopyfp, GHashValCopyFP valcopyfp)
+{
+  GHash *gh_new = ghash_flat_new(gh->hashfp, gh->cmpfp, __func__, gh->nentries, gh->flag);
+
+  for (uint i = 0; i < gh->nbuckets; i++) {
+    const GHashEntry *slot = &gh->slots[i];
+    if (ghash_flat_slot_is_used(slot)) {
+      void *key = keycopyfp ? keycopyfp(slot->e.key) : slot->e.key;
+      void *val = valcopyfp ? valcopyfp(slot->val) : slot->val;
+      ghash_flat_insert_no_lookup(gh_new, (uintptr_t)slot->e.next, key, val);
+      gh_new->nentries++;
+    }
+  }
+
+  return gh_new;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name GHash Public API
  * \{ */
@@ -691,13 +950,39 @@ GHash *BLI_ghash_new(GHashHashFP hashfp, GHashCmpFP cmpfp, const char *info)
   return BLI_ghash_new_ex(hashfp, cmpfp, info, 0);
 }
 
+GHash *BLI_ghash_flat_new_ex(GHashHashFP hashfp,
+                             GHashCmpFP cmpfp,
+                             const char *info,
+                             const uint nentries_reserve)
+{
+  return ghash_flat_new(hashfp, cmpfp, info, nentries_reserve, 0);
+}
+
+GHash *BLI_ghash_flat_new(GHashHashFP hashfp, GHashCmpFP cmpfp, const char *info)
+{
+  return BLI_ghash_flat_new_ex(hashfp, cmpfp, info, 0);
+}
+
 GHash *BLI_ghash_copy(const GHash *gh, GHashKeyCopyFP keycopyfp, GHashValCopyFP valcopyfp)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    return ghash_flat_copy(gh, keycopyfp, valcopyfp);
+  }
   return ghash_copy(gh, keycopyfp, valcopyfp);
 }
 
 void BLI_ghash_reserve(GHash *gh, const uint nentries_reserve)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    uint nslots = gh->nbuckets;
+    while (GHASH_LIMIT_GROW(nslots) < nentries_reserve) {
+      nslots <<= 1;
+    }
+    if (nslots != gh->nbuckets) {
+      ghash_flat_resize(gh, nslots);
+    }
+    return;
+  }
   ghash_buckets_expand(gh, nentries_reserve, true);
   ghash_buckets_contract(gh, nentries_reserve, true, false);
 }
@@ -709,20 +994,46 @@ uint BLI_ghash_len(const GHash *gh)
 
 void BLI_ghash_insert(GHash *gh, void *key, void *val)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    ghash_flat_insert(gh, key, val);
+    return;
+  }
   ghash_insert(gh, key, val);
 }
 
 bool BLI_ghash_reinsert(
     GHash *gh, void *key, void *val, GHashKeyFreeFP keyfreefp, GHashValFreeFP valfreefp)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    GHashEntry *e = ghash_flat_lookup_slot(gh, key, NULL);
+    if (e) {
+      if (keyfreefp) {
+        keyfreefp(e->e.key);
+      }
+      if (valfreefp) {
+        valfreefp(e->val);
+      }
+      e->e.key = key;
+      e->val = val;
+      return false;
+    }
+    ghash_flat_insert(gh, key, val);
+    return true;
+  }
   return ghash_insert_safe(gh, key, val, true, keyfreefp, valfreefp);
 }
 
 void *BLI_ghash_replace_key(GHash *gh, void *key)
 {
-  const uint hash = ghash_keyhash(gh, key);
-  const uint bucket_index = ghash_bucket_index(gh, hash);
-  GHashEntry *e = (GHashEntry *)ghash_lookup_entry_ex(gh, key, bucket_index);
+  GHashEntry *e;
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    e = ghash_flat_lookup_slot(gh, key, NULL);
+  }
+  else {
+    const uint hash = ghash_keyhash(gh, key);
+    const uint bucket_index = ghash_bucket_index(gh, hash);
+    e = (GHashEntry *)ghash_lookup_entry_ex(gh, key, bucket_index);
+  }
   if (e != NULL) {
     void *key_prev = e->e.key;
     e->e.key = key;
@@ -754,6 +1065,18 @@ void **BLI_ghash_lookup_p(GHash *gh, const void *key)
 
 bool BLI_ghash_ensure_p(GHash *gh, void *key, void ***r_val)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    GHashEntry *e = ghash_flat_lookup_slot(gh, key, NULL);
+    const bool haskey = (e != NULL);
+    if (!haskey) {
+      /* Robin-hood insertion may displace the new entry, look it up again for its slot. */
+      ghash_flat_insert(gh, key, NULL);
+      e = ghash_flat_lookup_slot(gh, key, NULL);
+    }
+    *r_val = &e->val;
+    return haskey;
+  }
+
   const uint hash = ghash_keyhash(gh, key);
   const uint bucket_index = ghash_bucket_index(gh, hash);
   GHashEntry *e = (GHashEntry *)ghash_lookup_entry_ex(gh, key, bucket_index);
@@ -770,6 +1093,19 @@ bool BLI_ghash_ensure_p(GHash *gh, void *key, void ***r_val)
 
 bool BLI_ghash_ensure_p_ex(GHash *gh, const void *key, void ***r_key, void ***r_val)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    GHashEntry *e = ghash_flat_lookup_slot(gh, key, NULL);
+    const bool haskey = (e != NULL);
+    if (!haskey) {
+      ghash_flat_insert(gh, (void *)key, NULL);
+      e = ghash_flat_lookup_slot(gh, key, NULL);
+      e->e.key = NULL; /* caller must re-assign */
+    }
+    *r_key = &e->e.key;
+    *r_val = &e->val;
+    return haskey;
+  }
+
   const uint hash = ghash_keyhash(gh, key);
   const uint bucket_index = ghash_bucket_index(gh, hash);
   GHashEntry *e = (GHashEntry *)ghash_lookup_entry_ex(gh, key, bucket_index);
@@ -792,6 +1128,22 @@ bool BLI_ghash_remove(GHash *gh,
                       GHashKeyFreeFP keyfreefp,
                       GHashValFreeFP valfreefp)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    uint i;
+    GHashEntry *e = ghash_flat_lookup_slot(gh, key, &i);
+    if (e == NULL) {
+      return false;
+    }
+    if (keyfreefp) {
+      keyfreefp(e->e.key);
+    }
+    if (valfreefp) {
+      valfreefp(e->val);
+    }
+    ghash_flat_remove_slot(gh, i);
+    return true;
+  }
+
   const uint hash = ghash_keyhash(gh, key);
   const uint bucket_index = ghash_bucket_index(gh, hash);
   Entry *e = ghash_remove_ex(gh, key, keyfreefp, valfreefp, bucket_index);
@@ -807,6 +1159,20 @@ void *BLI_ghash_popkey(GHash *gh, const void *key, GHashKeyFreeFP keyfreefp)
   /* Same as above but return the value,
    * no free value argument since it will be returned. */
 
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    uint i;
+    GHashEntry *e = ghash_flat_lookup_slot(gh, key, &i);
+    if (e == NULL) {
+      return NULL;
+    }
+    if (keyfreefp) {
+      keyfreefp(e->e.key);
+    }
+    void *val = e->val;
+    ghash_flat_remove_slot(gh, i);
+    return val;
+  }
+
   const uint hash = ghash_keyhash(gh, key);
   const uint bucket_index = ghash_bucket_index(gh, hash);
   GHashEntry *e = (GHashEntry *)ghash_remove_ex(gh, key, keyfreefp, NULL, bucket_index);
@@ -826,10 +1192,24 @@ bool BLI_ghash_haskey(const GHash *gh, const void *key)
 
 bool BLI_ghash_pop(GHash *gh, GHashIterState *state, void **r_key, void **r_val)
 {
-  GHashEntry *e = (GHashEntry *)ghash_pop(gh, state);
-
   BLI_assert(!(gh->flag & GHASH_FLAG_IS_GSET));
 
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    if (gh->nentries == 0) {
+      *r_key = *r_val = NULL;
+      return false;
+    }
+    const uint i = ghash_flat_find_next_used_slot(gh, state->curr_bucket);
+    GHashEntry *slot = &gh->slots[i];
+    *r_key = slot->e.key;
+    *r_val = slot->val;
+    ghash_flat_remove_slot(gh, i);
+    state->curr_bucket = i;
+    return true;
+  }
+
+  GHashEntry *e = (GHashEntry *)ghash_pop(gh, state);
+
   if (e) {
     *r_key = e->e.key;
     *r_val = e->val;
@@ -847,6 +1227,14 @@ void BLI_ghash_clear_ex(GHash *gh,
                         GHashValFreeFP valfreefp,
                         const uint nentries_reserve)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    if (keyfreefp || valfreefp) {
+      ghash_flat_free_cb(gh, keyfreefp, valfreefp);
+    }
+    ghash_flat_slots_reset(gh, nentries_reserve);
+    return;
+  }
+
   if (keyfreefp || valfreefp) {
     ghash_free_cb(gh, keyfreefp, valfreefp);
   }
@@ -862,6 +1250,15 @@ void BLI_ghash_clear(GHash *gh, GHashKeyFreeFP keyfreefp, GHashValFreeFP valfree
 
 void BLI_ghash_free(GHash *gh, GHashKeyFreeFP keyfreefp, GHashValFreeFP valfreefp)
 {
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    if (keyfreefp || valfreefp) {
+      ghash_flat_free_cb(gh, keyfreefp, valfreefp);
+    }
+    MEM_freeN(gh->slots);
+    MEM_freeN(gh);
+    return;
+  }
+
   BLI_assert((int)gh->nentries == BLI_mempool_len(gh->entrypool));
   if (keyfreefp || valfreefp) {
     ghash_free_cb(gh, keyfreefp, valfreefp);
@@ -900,6 +1297,18 @@ void BLI_ghashIterator_init(GHashIterator *ghi, GHash *gh)
   ghi->gh = gh;
   ghi->curEntry = NULL;
   ghi->curBucket = UINT_MAX; /* wraps to zero */
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    /* Slots share the entry layout, so the inline accessors can point straight into the array. */
+    if (gh->nentries) {
+      while (++ghi->curBucket < gh->nbuckets) {
+        if (ghash_flat_slot_is_used(&gh->slots[ghi->curBucket])) {
+          ghi->curEntry = (Entry *)&gh->slots[ghi->curBucket];
+          break;
+        }
+      }
+    }
+    return;
+  }
   if (gh->nentries) {
     do {
       ghi->curBucket++;
@@ -913,6 +1322,17 @@ void BLI_ghashIterator_init(GHashIterator *ghi, GHash *gh)
 
 void BLI_ghashIterator_step(GHashIterator *ghi)
 {
+  if (ghi->gh->flag & GHASH_FLAG_IS_FLAT) {
+    GHash *gh = ghi->gh;
+    ghi->curEntry = NULL;
+    while (++ghi->curBucket < gh->nbuckets) {
+      if (ghash_flat_slot_is_used(&gh->slots[ghi->curBucket])) {
+        ghi->curEntry = (Entry *)&gh->slots[ghi->curBucket];
+        break;
+      }
+    }
+    return;
+  }
   if (ghi->curEntry) {
     ghi->curEntry = ghi->curEntry->next;
     while (!ghi->curEntry) {
@@ -1104,6 +1524,26 @@ double BLI_ghash_calc_quality_ex(GHash *gh,
   double mean;
   uint i;
 
+  if (gh->flag & GHASH_FLAG_IS_FLAT) {
+    /* Open addressing: every used slot holds exactly one entry. */
+    if (r_load) {
+      *r_load = (double)gh->nentries / (double)gh->nbuckets;
+    }
+    if (r_variance) {
+      *r_variance = 0.0;
+    }
+    if (r_prop_empty_buckets) {
+      *r_prop_empty_buckets = 1.0 - ((double)gh->nentries / (double)gh->nbuckets);
+    }
+    if (r_prop_overloaded_buckets) {
+      *r_prop_overloaded_buckets = 0.0;
+    }
+    if (r_biggest_bucket) {
+      *r_biggest_bucket = gh->nentries ? 1 : 0;
+    }
+    return gh->nentries ? 1.0 : 0.0;
+  }
+
   if (gh->nentries == 0) {
     if (r_load) {
       *r_load = 0.0;
@@ -22,12 +22,15 @@
  *   #BLI_bvhtree_range_query
  */
 
+#include <stdlib.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
 #include "BLI_heap_simple.h"
 #include "BLI_kdopbvh.h"
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "BLI_stack.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
@@ -2026,6 +2029,206 @@ void BLI_bvhtree_ray_cast_all(BVHTree *tree,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name BLI_bvhtree_ray_cast_batch
+ *
+ * Casts many independent rays with one call. Rays are sorted so consecutive rays traverse
+ * similar parts of the tree (keeping upper nodes in cache), and child bounding volumes are
+ * tested four at a time with SSE/NEON where available.
+ *
+ * \{ */
+
+#ifdef BLI_HAVE_SSE2
+
+/**
+ * A 4-wide version of #fast_ray_nearest_hit: tests the bounding volumes of up to 4 sibling
+ * nodes against the ray at once. Writes the hit distance per node into \a r_dist, or
+ * #FLT_MAX for nodes the ray misses. Matches the scalar test bit for bit, including the
+ * behavior for axis aligned rays (where `idot_axis` is #FLT_MAX).
+ */
+static void fast_ray_nearest_hit_4(const BVHRayCastData *data,
+                                   BVHNode *const *children,
+                                   const int count,
+                                   float r_dist[4])
+{
+  /* Duplicate the first node into unused lanes, their results are simply ignored. */
+  const BVHNode *c0 = children[0];
+  const BVHNode *c1 = children[count > 1 ? 1 : 0];
+  const BVHNode *c2 = children[count > 2 ? 2 : 0];
+  const BVHNode *c3 = children[count > 3 ? 3 : 0];
+
+  __m128 tmin = _mm_set1_ps(-FLT_MAX);
+  __m128 tmax = _mm_set1_ps(FLT_MAX);
+
+  for (int axis = 0; axis < 3; axis++) {
+    const int i_near = data->index[2 * axis];
+    const int i_far = data->index[2 * axis + 1];
+    const __m128 origin = _mm_set1_ps(data->ray.origin[axis]);
+    const __m128 idot = _mm_set1_ps(data->idot_axis[axis]);
+    const __m128 bv_near = _mm_set_ps(c3->bv[i_near], c2->bv[i_near], c1->bv[i_near], c0->bv[i_near]);
+    const __m128 bv_far = _mm_set_ps(c3->bv[i_far], c2->bv[i_far], c1->bv[i_far], c0->bv[i_far]);
+
+    tmin = _mm_max_ps(tmin, _mm_mul_ps(_mm_sub_ps(bv_near, origin), idot));
+    tmax = _mm_min_ps(tmax, _mm_mul_ps(_mm_sub_ps(bv_far, origin), idot));
+  }
+
+  const __m128 miss = _mm_or_ps(
+      _mm_or_ps(_mm_cmpgt_ps(tmin, tmax), _mm_cmplt_ps(tmax, _mm_setzero_ps())),
+      _mm_cmpgt_ps(tmin, _mm_set1_ps(data->hit.dist)));
+  const __m128 dist = _mm_or_ps(_mm_and_ps(miss, _mm_set1_ps(FLT_MAX)),
+                                _mm_andnot_ps(miss, tmin));
+
+  float dist_unpack[4];
+  _mm_storeu_ps(dist_unpack, dist);
+  for (int i = 0; i < count; i++) {
+    r_dist[i] = dist_unpack[i];
+  }
+}
+
+/**
+ * A version of #dfs_raycast that tests child bounding volumes in groups of 4.
+ * The caller has already tested \a node against the ray, \a dist being the result.
+ */
+static void dfs_raycast_batch(BVHRayCastData *data, BVHNode *node, float dist)
+{
+  if (node->totnode == 0) {
+    if (data->callback) {
+      data->callback(data->userdata, node->index, &data->ray, &data->hit);
+    }
+    else {
+      data->hit.index = node->index;
+      data->hit.dist = dist;
+      madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, dist);
+    }
+    return;
+  }
+
+  const int totnode = node->totnode;
+  float child_dist[MAX_TREETYPE];
+
+  for (int i = 0; i < totnode; i += 4) {
+    fast_ray_nearest_hit_4(data, node->children + i, MIN2(totnode - i, 4), child_dist + i);
+  }
+
+  /* pick loop direction to dive into the tree (based on ray direction and split axis) */
+  if (data->ray_dot_axis[node->main_axis] > 0.0f) {
+    for (int i = 0; i != totnode; i++) {
+      /* Re-check against the hit distance, it may have shrunk since the test above. */
+      if (child_dist[i] < data->hit.dist) {
+        dfs_raycast_batch(data, node->children[i], child_dist[i]);
+      }
+    }
+  }
+  else {
+    for (int i = totnode - 1; i >= 0; i--) {
+      if (child_dist[i] < data->hit.dist) {
+        dfs_raycast_batch(data, node->children[i], child_dist[i]);
+      }
+    }
+  }
+}
+
+#endif /* BLI_HAVE_SSE2 */
+
+typedef struct BVHRayCastBatchKey {
+  /* Sign bits of the ray direction, the primary sort key. */
+  uint32_t octant;
+  /* Position of the ray origin along its direction, for front-to-back coherence. */
+  float depth;
+  int index;
+} BVHRayCastBatchKey;
+
+static int ray_cast_batch_key_cmp(const void *a_v, const void *b_v)
+{
+  const BVHRayCastBatchKey *a = a_v;
+  const BVHRayCastBatchKey *b = b_v;
+  if (a->octant != b->octant) {
+    return a->octant < b->octant ? -1 : 1;
+  }
+  if (a->depth != b->depth) {
+    return a->depth < b->depth ? -1 : 1;
+  }
+  /* Keep the sort stable so results do not depend on qsort implementation details. */
+  return a->index - b->index;
+}
+
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*ray_origins)[3],
+                                const float (*ray_directions)[3],
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                int rays_num,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag)
+{
+  BVHRayCastData data;
+  BVHNode *root = tree->nodes[tree->totleaf];
+  BVHRayCastBatchKey *order;
+
+  if (rays_num <= 0) {
+    return;
+  }
+
+  /* Sort rays by direction octant, then by depth along the direction. Rays of a bundle then
+   * enter the tree from the same side and walk it in a similar order, which keeps the upper
+   * levels of the tree in cache across queries. */
+  order = MEM_mallocN(sizeof(*order) * (size_t)rays_num, __func__);
+  for (int i = 0; i < rays_num; i++) {
+    const float *dir = ray_directions[i];
+    order[i].octant = (uint32_t)((dir[0] < 0.0f) | ((dir[1] < 0.0f) << 1) |
+                                 ((dir[2] < 0.0f) << 2));
+    order[i].depth = dot_v3v3(ray_origins[i], dir);
+    order[i].index = i;
+  }
+  qsort(order, (size_t)rays_num, sizeof(*order), ray_cast_batch_key_cmp);
+
+  data.tree = tree;
+  data.callback = callback;
+  data.userdata = userdata;
+  data.ray.radius = radius;
+
+  for (int i = 0; i < rays_num; i++) {
+    const int ray_index = order[i].index;
+    BVHTreeRayHit *hit = &hits[ray_index];
+
+    BLI_ASSERT_UNIT_V3(ray_directions[ray_index]);
+
+    copy_v3_v3(data.ray.origin, ray_origins[ray_index]);
+
+    /* The pre-calculated data only depends on the direction, share it between the
+     * (now adjacent) rays of a bundle with equal directions. */
+    if (i == 0 || !equals_v3v3(data.ray.direction, ray_directions[ray_index])) {
+      copy_v3_v3(data.ray.direction, ray_directions[ray_index]);
+      bvhtree_ray_cast_data_precalc(&data, flag);
+    }
+
+    memcpy(&data.hit, hit, sizeof(*hit));
+
+    if (root) {
+#ifdef BLI_HAVE_SSE2
+      /* The SIMD test mirrors #fast_ray_nearest_hit, which doesn't support a radius. */
+      if (data.ray.radius == 0.0f) {
+        const float dist = fast_ray_nearest_hit(&data, root);
+        if (dist < data.hit.dist) {
+          dfs_raycast_batch(&data, root, dist);
+        }
+      }
+      else
+#endif
+      {
+        dfs_raycast(&data, root);
+      }
+    }
+
+    memcpy(hit, &data.hit, sizeof(*hit));
+  }
+
+  MEM_freeN(order);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name BLI_bvhtree_range_query
  *
@@ -436,6 +436,15 @@ int BLI_mempool_len(const BLI_mempool *pool)
   return (int)pool->totused;
 }
 
+int BLI_mempool_chunk_count(const BLI_mempool *pool)
+{
+  int tot = 0;
+  for (BLI_mempool_chunk *chunk = pool->chunks; chunk; chunk = chunk->next) {
+    tot++;
+  }
+  return tot;
+}
+
 void *BLI_mempool_findelem(BLI_mempool *pool, uint index)
 {
   BLI_assert(pool->flag & BLI_MEMPOOL_ALLOW_ITER);
@@ -4,8 +4,10 @@
  * \ingroup bli
  */
 
+#include <float.h>  /* for FLT_MAX */
 #include <math.h>   /* for fabsf */
 #include <stdlib.h> /* for qsort */
+#include <string.h> /* for memmove */
 
 #include "MEM_guardedalloc.h"
 
@@ -653,6 +655,155 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
   MEM_freeN(vs_ctx.vertarray);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Skyline Packer
+ * \{ */
+
+/**
+ * A horizontal span of the skyline, the contour over the tops of all placed boxes.
+ * Segments tile the target width, ordered by increasing \a x.
+ */
+typedef struct SkylineSeg {
+  float x, y, w;
+} SkylineSeg;
+
+/** Tallest (then widest) first, packing rows of similar height wastes the least space. */
+static int box_heightsort(const void *p1, const void *p2)
+{
+  const BoxPack *b1 = p1, *b2 = p2;
+
+  if (b1->h < b2->h) {
+    return 1;
+  }
+  if (b1->h > b2->h) {
+    return -1;
+  }
+  if (b1->w < b2->w) {
+    return 1;
+  }
+  if (b1->w > b2->w) {
+    return -1;
+  }
+  /* Keep the sort stable for boxes of equal size. */
+  if (b1->index < b2->index) {
+    return -1;
+  }
+  if (b1->index > b2->index) {
+    return 1;
+  }
+  return 0;
+}
+
+void BLI_box_pack_2d_skyline(BoxPack *boxarray, const uint len, float *r_tot_x, float *r_tot_y)
+{
+  if (len == 0) {
+    *r_tot_x = *r_tot_y = 0.0f;
+    return;
+  }
+
+  /* Pack into a square-ish area sized from the total box area
+   * (with some slack, boxes never tile perfectly). */
+  float area = 0.0f;
+  float width_max = 0.0f;
+  for (uint i = 0; i < len; i++) {
+    area += boxarray[i].w * boxarray[i].h;
+    width_max = MAX2(width_max, boxarray[i].w);
+  }
+  const float width_target = MAX2(sqrtf(area) * 1.1f, width_max);
+
+  qsort(boxarray, (size_t)len, sizeof(BoxPack), box_heightsort);
+
+  /* Each placed box removes the segments it covers and adds at most one,
+   * so the skyline never has more segments than boxes. */
+  SkylineSeg *segs = MEM_mallocN(sizeof(*segs) * ((size_t)len + 1), __func__);
+  uint segs_len = 1;
+  segs[0].x = 0.0f;
+  segs[0].y = 0.0f;
+  segs[0].w = width_target;
+
+  float tot_x = 0.0f;
+  float tot_y = 0.0f;
+
+  for (uint i = 0; i < len; i++) {
+    BoxPack *box = &boxarray[i];
+
+    /* Find the lowest (then left-most) placement along the skyline.
+     * Boxes are only ever placed with their bottom-left corner at a segment start. */
+    uint best_seg = 0;
+    float best_y = FLT_MAX;
+    for (uint s = 0; s < segs_len; s++) {
+      if (segs[s].x + box->w > width_target + EPSILON) {
+        /* Segments are ordered by `x`, no placement further right fits either. */
+        break;
+      }
+      /* The box rests on the tallest segment it spans. */
+      float y = segs[s].y;
+      for (uint s_span = s + 1; s_span < segs_len; s_span++) {
+        if (segs[s_span].x >= segs[s].x + box->w) {
+          break;
+        }
+        y = MAX2(y, segs[s_span].y);
+      }
+      if (y < best_y) {
+        best_y = y;
+        best_seg = s;
+      }
+    }
+
+    const float x0 = segs[best_seg].x;
+    const float x1 = x0 + box->w;
+    const float y_top = best_y + box->h;
+
+    box->x = x0;
+    box->y = best_y;
+    tot_x = MAX2(tot_x, x1);
+    tot_y = MAX2(tot_y, y_top);
+
+    /* Replace the covered part of the skyline with a single segment on top of the box.
+     * Segments fully inside `[x0, x1)` are removed, a partly covered one is trimmed. */
+    uint s_end = best_seg;
+    while (s_end < segs_len && segs[s_end].x + segs[s_end].w <= x1 + EPSILON) {
+      s_end++;
+    }
+    if (s_end < segs_len && segs[s_end].x < x1) {
+      segs[s_end].w = (segs[s_end].x + segs[s_end].w) - x1;
+      segs[s_end].x = x1;
+    }
+    if (s_end != best_seg + 1) {
+      memmove(&segs[best_seg + 1], &segs[s_end], sizeof(*segs) * (size_t)(segs_len - s_end));
+      segs_len = (segs_len - (s_end - best_seg)) + 1;
+    }
+    segs[best_seg].x = x0;
+    segs[best_seg].y = y_top;
+    segs[best_seg].w = box->w;
+
+    /* Merge neighbors of (nearly) the same height to keep the skyline small. */
+    if (best_seg + 1 < segs_len && fabsf(segs[best_seg + 1].y - y_top) < EPSILON_MERGE) {
+      segs[best_seg].y = MAX2(y_top, segs[best_seg + 1].y);
+      segs[best_seg].w += segs[best_seg + 1].w;
+      memmove(&segs[best_seg + 1],
+              &segs[best_seg + 2],
+              sizeof(*segs) * (size_t)(segs_len - (best_seg + 2)));
+      segs_len--;
+    }
+    if (best_seg > 0 && fabsf(segs[best_seg - 1].y - segs[best_seg].y) < EPSILON_MERGE) {
+      segs[best_seg - 1].y = MAX2(segs[best_seg - 1].y, segs[best_seg].y);
+      segs[best_seg - 1].w += segs[best_seg].w;
+      memmove(&segs[best_seg],
+              &segs[best_seg + 1],
+              sizeof(*segs) * (size_t)(segs_len - (best_seg + 1)));
+      segs_len--;
+    }
+  }
+
+  MEM_freeN(segs);
+
+  *r_tot_x = tot_x;
+  *r_tot_y = tot_y;
+}
+
+/** \} */
+
 void BLI_box_pack_2d_fixedarea(ListBase *boxes, int width, int height, ListBase *packed)
 {
   ListBase spaces = {NULL};
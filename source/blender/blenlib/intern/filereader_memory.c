@@ -61,6 +61,17 @@ static off64_t memory_seek(FileReader *reader, off64_t offset, int whence)
   return mem->reader.offset;
 }
 
+static const void *memory_data_raw(FileReader *reader, size_t offset, size_t size)
+{
+  MemoryReader *mem = (MemoryReader *)reader;
+
+  if (offset + size > mem->length) {
+    return NULL;
+  }
+
+  return mem->data + offset;
+}
+
 static void memory_close_raw(FileReader *reader)
 {
   MEM_freeN(reader);
@@ -75,6 +86,7 @@ FileReader *BLI_filereader_new_memory(const void *data, size_t len)
 
   mem->reader.read = memory_read_raw;
   mem->reader.seek = memory_seek;
+  mem->reader.data = memory_data_raw;
   mem->reader.close = memory_close_raw;
 
   return (FileReader *)mem;
@@ -102,6 +114,20 @@ static ssize_t memory_read_mmap(FileReader *reader, void *buffer, size_t size)
   return readsize;
 }
 
+static const void *memory_data_mmap(FileReader *reader, size_t offset, size_t size)
+{
+  MemoryReader *mem = (MemoryReader *)reader;
+
+  if (offset + size > mem->length) {
+    return NULL;
+  }
+
+  /* Accessing the returned pointer reads straight from the mapped file. IO errors turn
+   * into SIGBUS, which `BLI_mmap` handles by zero-filling the region, same as when
+   * reading through #BLI_mmap_read. */
+  return (const char *)BLI_mmap_get_pointer(mem->mmap) + offset;
+}
+
 static void memory_close_mmap(FileReader *reader)
 {
   MemoryReader *mem = (MemoryReader *)reader;
@@ -123,6 +149,7 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   mem->reader.read = memory_read_mmap;
   mem->reader.seek = memory_seek;
+  mem->reader.data = memory_data_mmap;
   mem->reader.close = memory_close_mmap;
 
   return (FileReader *)mem;
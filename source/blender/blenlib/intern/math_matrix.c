@@ -728,22 +728,33 @@ void mul_m3_v2(const float m[3][3], float r[2])
 
 void mul_m4_v3(const float M[4][4], float r[3])
 {
-  const float x = r[0];
-  const float y = r[1];
-
-  r[0] = x * M[0][0] + y * M[1][0] + M[2][0] * r[2] + M[3][0];
-  r[1] = x * M[0][1] + y * M[1][1] + M[2][1] * r[2] + M[3][1];
-  r[2] = x * M[0][2] + y * M[1][2] + M[2][2] * r[2] + M[3][2];
+  mul_v3_m4v3(r, M, r);
 }
 
 void mul_v3_m4v3(float r[3], const float mat[4][4], const float vec[3])
 {
+  /* Product: `r = mat[0] . x + mat[1] . y + mat[2] . z + mat[3]`. */
+#ifdef BLI_HAVE_SSE2
+  /* The sum is computed on all four lanes, but only x/y/z are stored so that callers can keep
+   * passing plain float[3] vectors (which may alias `r`, so load before storing). */
+  __m128 x = _mm_set1_ps(vec[0]);
+  __m128 y = _mm_set1_ps(vec[1]);
+  __m128 z = _mm_set1_ps(vec[2]);
+
+  __m128 sum = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(x, _mm_loadu_ps(mat[0])), _mm_mul_ps(y, _mm_loadu_ps(mat[1]))),
+      _mm_add_ps(_mm_mul_ps(z, _mm_loadu_ps(mat[2])), _mm_loadu_ps(mat[3])));
+
+  _mm_storel_pi((__m64 *)r, sum);
+  _mm_store_ss(&r[2], _mm_movehl_ps(sum, sum));
+#else
   const float x = vec[0];
   const float y = vec[1];
 
   r[0] = x * mat[0][0] + y * mat[1][0] + mat[2][0] * vec[2] + mat[3][0];
   r[1] = x * mat[0][1] + y * mat[1][1] + mat[2][1] * vec[2] + mat[3][1];
   r[2] = x * mat[0][2] + y * mat[1][2] + mat[2][2] * vec[2] + mat[3][2];
+#endif
 }
 
 void mul_v3_m4v3_db(double r[3], const double mat[4][4], const double vec[3])
@@ -799,12 +810,27 @@ void mul_mat3_m4_v3(const float M[4][4], float r[3])
 
 void mul_v3_mat3_m4v3(float r[3], const float mat[4][4], const float vec[3])
 {
+  /* Product: `r = mat[0] . x + mat[1] . y + mat[2] . z`. */
+#ifdef BLI_HAVE_SSE2
+  /* See #mul_v3_m4v3 for the lane handling. */
+  __m128 x = _mm_set1_ps(vec[0]);
+  __m128 y = _mm_set1_ps(vec[1]);
+  __m128 z = _mm_set1_ps(vec[2]);
+
+  __m128 sum = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(x, _mm_loadu_ps(mat[0])), _mm_mul_ps(y, _mm_loadu_ps(mat[1]))),
+      _mm_mul_ps(z, _mm_loadu_ps(mat[2])));
+
+  _mm_storel_pi((__m64 *)r, sum);
+  _mm_store_ss(&r[2], _mm_movehl_ps(sum, sum));
+#else
   const float x = vec[0];
   const float y = vec[1];
 
   r[0] = x * mat[0][0] + y * mat[1][0] + mat[2][0] * vec[2];
   r[1] = x * mat[0][1] + y * mat[1][1] + mat[2][1] * vec[2];
   r[2] = x * mat[0][2] + y * mat[1][2] + mat[2][2] * vec[2];
+#endif
 }
 
 void mul_v3_mat3_m4v3_db(double r[3], const double mat[4][4], const double vec[3])
@@ -0,0 +1,132 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include "BLI_math.h"
+#include "BLI_math_vector_batch.h"
+#include "BLI_simd.h"
+
+#include "BLI_strict_flags.h"
+
+void add_v3_array(float (*array_tar)[3], const float (*array_src)[3], int size)
+{
+  float *__restrict tar = (float *)array_tar;
+  const float *__restrict src = (const float *)array_src;
+
+  for (int i = 0; i < size * 3; i++) {
+    tar[i] += src[i];
+  }
+}
+
+void madd_v3_array_fl(float (*array_tar)[3], const float (*array_src)[3], float f, int size)
+{
+  float *__restrict tar = (float *)array_tar;
+  const float *__restrict src = (const float *)array_src;
+
+  for (int i = 0; i < size * 3; i++) {
+    tar[i] += src[i] * f;
+  }
+}
+
+void dot_v3_array(float *r_array, const float (*array_a)[3], const float (*array_b)[3], int size)
+{
+  float *__restrict res = r_array;
+
+  for (int i = 0; i < size; i++) {
+    res[i] = dot_v3v3(array_a[i], array_b[i]);
+  }
+}
+
+void interp_v3_array(
+    float (*array_tar)[3], const float (*array_a)[3], const float (*array_b)[3], float t, int size)
+{
+  float *__restrict tar = (float *)array_tar;
+  const float *__restrict a = (const float *)array_a;
+  const float *__restrict b = (const float *)array_b;
+  const float s = 1.0f - t;
+
+  for (int i = 0; i < size * 3; i++) {
+    tar[i] = s * a[i] + t * b[i];
+  }
+}
+
+void normalize_v3_array(float (*array_tar)[3], int size)
+{
+  for (int i = 0; i < size; i++) {
+    float *no = array_tar[i];
+    const float d = len_squared_v3(no);
+
+    if (d > 1.0e-35f) {
+      mul_v3_fl(no, 1.0f / sqrtf(d));
+    }
+    else {
+      /* Zero length vectors stay zeroed, see header doc-string. */
+      zero_v3(no);
+    }
+  }
+}
+
+void mul_m4_v3_array(const float mat[4][4], float (*array_tar)[3], int size)
+{
+  int i = 0;
+
+#ifdef BLI_HAVE_SSE2
+  /* Rows of a Blender matrix are the columns of the conventional notation,
+   * so the transform is a linear combination of the row vectors. */
+  const __m128 c0 = _mm_loadu_ps(mat[0]);
+  const __m128 c1 = _mm_loadu_ps(mat[1]);
+  const __m128 c2 = _mm_loadu_ps(mat[2]);
+  const __m128 c3 = _mm_loadu_ps(mat[3]);
+
+  /* Process all but the last vector with 4-wide loads & stores, these read/write
+   * one float past the current vector so the final element needs the scalar path. */
+  for (; i + 1 < size; i++) {
+    float *co = array_tar[i];
+    const __m128 v = _mm_loadu_ps(co);
+    const __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)),
+                                _mm_add_ps(_mm_mul_ps(c2, z), c3));
+    /* The store clobbers the X component of the next vector, restore it. */
+    const float co_next_x = co[3];
+    _mm_storeu_ps(co, r);
+    co[3] = co_next_x;
+  }
+#endif
+
+  for (; i < size; i++) {
+    mul_m4_v3(mat, array_tar[i]);
+  }
+}
+
+void mul_m3_v3_array(const float mat[3][3], float (*array_tar)[3], int size)
+{
+  int i = 0;
+
+#ifdef BLI_HAVE_SSE2
+  const __m128 c0 = _mm_set_ps(0.0f, mat[0][2], mat[0][1], mat[0][0]);
+  const __m128 c1 = _mm_set_ps(0.0f, mat[1][2], mat[1][1], mat[1][0]);
+  const __m128 c2 = _mm_set_ps(0.0f, mat[2][2], mat[2][1], mat[2][0]);
+
+  for (; i + 1 < size; i++) {
+    float *co = array_tar[i];
+    const __m128 v = _mm_loadu_ps(co);
+    const __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, x), _mm_mul_ps(c1, y)),
+                                _mm_mul_ps(c2, z));
+    const float co_next_x = co[3];
+    _mm_storeu_ps(co, r);
+    co[3] = co_next_x;
+  }
+#endif
+
+  for (; i < size; i++) {
+    mul_m3_v3(mat, array_tar[i]);
+  }
+}
@@ -2268,15 +2268,25 @@ IMesh triangulate_polymesh(IMesh &imesh, IMeshArena *arena)
       }
     }
   });
-  for (Face *f : imesh.faces()) {
-    /* Tessellate face f, following plan similar to #BM_face_calc_tessellation. */
-    int flen = f->size();
-    if (flen == 3) {
+  /* Tessellate the faces in parallel, following a plan similar to #BM_face_calc_tessellation.
+   * The triangulations are independent and #IMeshArena allocation is mutex-protected, so only
+   * the assembly of the output (which fixes the face order) stays serial. */
+  Array<Array<Face *>> face_tris_per_face(imesh.face_size());
+  threading::parallel_for(imesh.face_index_range(), 512, [&](IndexRange range) {
+    for (int i : range) {
+      Face *f = imesh.face(i);
+      if (f->size() > 3) {
+        face_tris_per_face[i] = triangulate_poly(f, arena);
+      }
+    }
+  });
+  for (int i : imesh.face_index_range()) {
+    Face *f = imesh.face(i);
+    if (f->size() == 3) {
       face_tris.append(f);
     }
     else {
-      Array<Face *> tris = triangulate_poly(f, arena);
-      for (Face *tri : tris) {
+      for (Face *tri : face_tris_per_face[i]) {
         face_tris.append(tri);
       }
     }
@@ -3036,9 +3046,15 @@ IMesh trimesh_nary_intersect(const IMesh &tm_in,
             << "\n";
 #  endif
   Array<CDT_data> cluster_subdivided(clinfo.tot_cluster());
-  for (int c : clinfo.index_range()) {
-    cluster_subdivided[c] = calc_cluster_subdivided(clinfo, c, *tm_clean, tri_ov, itt_map, arena);
-  }
+  /* The per-cluster CDT solves only read shared data and do not allocate from the arena, so
+   * they are independent tasks. The arena faces are extracted from the results afterwards in
+   * #calc_cluster_tris, serially, keeping the output repeatable regardless of parallelism. */
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (int c : range) {
+      cluster_subdivided[c] = calc_cluster_subdivided(
+          clinfo, c, *tm_clean, tri_ov, itt_map, arena);
+    }
+  });
 #  ifdef PERFDEBUG
   double cluster_subdivide_time = PIL_check_seconds_timer();
   std::cout << "subdivided clusters found, time = "
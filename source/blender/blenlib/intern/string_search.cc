@@ -9,6 +9,7 @@
 #include "BLI_string_search.h"
 #include "BLI_string_utf8.h"
 #include "BLI_timeit.hh"
+#include "BLI_vector_set.hh"
 
 /* Right arrow, keep in sync with #UI_MENU_ARROW_SEP in `UI_interface.h`. */
 #define UI_MENU_ARROW_SEP "\xe2\x96\xb6"
@@ -223,9 +224,26 @@ static bool match_word_initials(StringRef query,
   return true;
 }
 
+/**
+ * Memoized match results between one query word and the vocabulary of unique result words.
+ * The same words appear in many results ("add", "mesh", "node", ...), so with thousands of
+ * search items each unique word only has to be matched once per query word per keystroke
+ * instead of once per occurrence.
+ */
+struct WordMatchCache {
+  /* -1: not yet computed, otherwise 0 or 1. */
+  MutableSpan<int8_t> startswith;
+  /* #FUZZY_UNKNOWN: not yet computed, otherwise the result of #get_fuzzy_match_errors. */
+  MutableSpan<int> fuzzy_errors;
+
+  static constexpr int FUZZY_UNKNOWN = INT32_MIN;
+};
+
 static int get_shortest_word_index_that_startswith(StringRef query,
                                                    Span<StringRef> words,
-                                                   Span<bool> word_is_usable)
+                                                   Span<int> word_ids,
+                                                   Span<bool> word_is_usable,
+                                                   WordMatchCache &cache)
 {
   int best_word_size = INT32_MAX;
   int best_word_index = -1;
@@ -234,7 +252,11 @@ static int get_shortest_word_index_that_startswith(StringRef query,
       continue;
     }
     StringRef word = words[i];
-    if (word.startswith(query)) {
+    int8_t &cached = cache.startswith[word_ids[i]];
+    if (cached == -1) {
+      cached = word.startswith(query);
+    }
+    if (cached) {
       if (word.size() < best_word_size) {
         best_word_index = i;
         best_word_size = word.size();
@@ -246,7 +268,9 @@ static int get_shortest_word_index_that_startswith(StringRef query,
 
 static int get_word_index_that_fuzzy_matches(StringRef query,
                                              Span<StringRef> words,
+                                             Span<int> word_ids,
                                              Span<bool> word_is_usable,
+                                             WordMatchCache &cache,
                                              int *r_error_count)
 {
   for (const int i : words.index_range()) {
@@ -254,7 +278,10 @@ static int get_word_index_that_fuzzy_matches(StringRef query,
       continue;
     }
     StringRef word = words[i];
-    const int error_count = get_fuzzy_match_errors(query, word);
+    int &error_count = cache.fuzzy_errors[word_ids[i]];
+    if (error_count == WordMatchCache::FUZZY_UNKNOWN) {
+      error_count = get_fuzzy_match_errors(query, word);
+    }
     if (error_count >= 0) {
       *r_error_count = error_count;
       return i;
@@ -267,7 +294,10 @@ static int get_word_index_that_fuzzy_matches(StringRef query,
  * Checks how well the query matches a result. If it does not match, -1 is returned. A positive
  * return value indicates how good the match is. The higher the value, the better the match.
  */
-static int score_query_against_words(Span<StringRef> query_words, Span<StringRef> result_words)
+static int score_query_against_words(Span<StringRef> query_words,
+                                     Span<StringRef> result_words,
+                                     Span<int> result_word_ids,
+                                     MutableSpan<WordMatchCache> query_word_caches)
 {
   /* Remember which words have been matched, so that they are not matched again. */
   Array<bool, 64> word_is_usable(result_words.size(), true);
@@ -275,11 +305,13 @@ static int score_query_against_words(Span<StringRef> query_words, Span<StringRef
   /* Start with some high score, because otherwise the final score might become negative. */
   int total_match_score = 1000;
 
-  for (StringRef query_word : query_words) {
+  for (const int query_word_index : query_words.index_range()) {
+    const StringRef query_word = query_words[query_word_index];
+    WordMatchCache &cache = query_word_caches[query_word_index];
     {
       /* Check if any result word begins with the query word. */
       const int word_index = get_shortest_word_index_that_startswith(
-          query_word, result_words, word_is_usable);
+          query_word, result_words, result_word_ids, word_is_usable, cache);
       if (word_index >= 0) {
         total_match_score += 10;
         word_is_usable[word_index] = false;
@@ -305,7 +337,7 @@ static int score_query_against_words(Span<StringRef> query_words, Span<StringRef
       /* Fuzzy match against words. */
       int error_count = 0;
       const int word_index = get_word_index_that_fuzzy_matches(
-          query_word, result_words, word_is_usable, &error_count);
+          query_word, result_words, result_word_ids, word_is_usable, cache, &error_count);
       if (word_index >= 0) {
         total_match_score += 3 - error_count;
         word_is_usable[word_index] = false;
@@ -373,6 +405,9 @@ void extract_normalized_words(StringRef str,
 
 struct SearchItem {
   blender::Span<blender::StringRef> normalized_words;
+  /* Index of every word in #StringSearch.unique_words, used to share match results between
+   * items that contain the same words. */
+  blender::Span<int> word_ids;
   int length;
   void *user_data;
   int weight;
@@ -381,6 +416,8 @@ struct SearchItem {
 struct StringSearch {
   blender::LinearAllocator<> allocator;
   blender::Vector<SearchItem> items;
+  /* Deduplicated words of all items, the id of a word is its index in here. */
+  blender::VectorSet<blender::StringRef> unique_words;
 };
 
 StringSearch *BLI_string_search_new()
@@ -397,7 +434,12 @@ void BLI_string_search_add(StringSearch *search,
   Vector<StringRef, 64> words;
   StringRef str_ref{str};
   string_search::extract_normalized_words(str_ref, search->allocator, words);
+  Vector<int, 64> word_ids;
+  for (const StringRef word : words) {
+    word_ids.append((int)search->unique_words.index_of_or_add(word));
+  }
   search->items.append({search->allocator.construct_array_copy(words.as_span()),
+                        search->allocator.construct_array_copy(word_ids.as_span()),
                         (int)str_ref.size(),
                         user_data,
                         weight});
@@ -413,11 +455,25 @@ int BLI_string_search_query(StringSearch *search, const char *query, void ***r_d
   Vector<StringRef, 64> query_words;
   string_search::extract_normalized_words(query_str, allocator, query_words);
 
+  /* Match results between each query word and each unique word, computed on first use. */
+  const int64_t unique_words_num = search->unique_words.size();
+  Array<int8_t> startswith_cache(query_words.size() * unique_words_num, -1);
+  Array<int> fuzzy_cache(query_words.size() * unique_words_num,
+                         string_search::WordMatchCache::FUZZY_UNKNOWN);
+  Array<string_search::WordMatchCache> query_word_caches(query_words.size());
+  for (const int i : query_words.index_range()) {
+    query_word_caches[i].startswith = startswith_cache.as_mutable_span().slice(
+        i * unique_words_num, unique_words_num);
+    query_word_caches[i].fuzzy_errors = fuzzy_cache.as_mutable_span().slice(i * unique_words_num,
+                                                                            unique_words_num);
+  }
+
   /* Compute score of every result. */
   MultiValueMap<int, int> result_indices_by_score;
   for (const int result_index : search->items.index_range()) {
+    const SearchItem &item = search->items[result_index];
     const int score = string_search::score_query_against_words(
-        query_words, search->items[result_index].normalized_words);
+        query_words, item.normalized_words, item.word_ids, query_word_caches);
     if (score >= 0) {
       result_indices_by_score.add(score, result_index);
     }
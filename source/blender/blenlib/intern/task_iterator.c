@@ -362,7 +362,11 @@ void BLI_task_parallel_mempool(BLI_mempool *mempool,
   void *userdata_chunk_array = NULL;
   const bool use_userdata_chunk = (userdata_chunk_size != 0) && (userdata_chunk != NULL);
 
-  if (!settings->use_threading) {
+  /* Chunks are handed out to tasks whole, so a single-chunk pool cannot be
+   * distributed and is better off without the task pool overhead. */
+  const int chunk_count = BLI_mempool_chunk_count(mempool);
+
+  if (!settings->use_threading || chunk_count == 1) {
     TaskParallelTLS tls = {NULL};
     if (use_userdata_chunk) {
       if (settings->func_init != NULL) {
@@ -396,8 +400,10 @@ void BLI_task_parallel_mempool(BLI_mempool *mempool,
   /* The idea here is to prevent creating task for each of the loop iterations
    * and instead have tasks which are evenly distributed across CPU cores and
    * pull next item to be crunched using the threaded-aware BLI_mempool_iter.
-   */
-  const int num_tasks = num_threads + 2;
+   *
+   * Tasks beyond the chunk count would never receive a chunk to iterate,
+   * so don't create (and reduce/free) them at all. */
+  const int num_tasks = MIN2(num_threads + 2, chunk_count);
 
   state.userdata = userdata;
   state.func = func;
@@ -19,6 +19,12 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+/* oneTBB: task_arena constraints (NUMA pinning) and arena priorities are available. */
+#    include <tbb/info.h>
+#    include <vector>
+#    define WITH_TBB_ARENA_CONSTRAINTS
+#  endif
 #endif
 
 /* Task Scheduler */
@@ -27,6 +33,13 @@ static int task_scheduler_num_threads = 1;
 #ifdef WITH_TBB_GLOBAL_CONTROL
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+/* One arena per NUMA node, worker threads pinned to the node. Created on scheduler
+ * initialization, only populated when the machine actually has multiple nodes. */
+static std::vector<tbb::task_arena> *task_scheduler_numa_arenas = nullptr;
+/* Arena whose tasks worker threads prefer over queued normal-priority work. */
+static tbb::task_arena *task_scheduler_high_priority_arena = nullptr;
+#endif
 
 void BLI_task_scheduler_init()
 {
@@ -50,10 +63,28 @@ void BLI_task_scheduler_init()
 #else
   task_scheduler_num_threads = BLI_system_thread_count();
 #endif
+
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+  const std::vector<tbb::numa_node_id> numa_nodes = tbb::info::numa_nodes();
+  if (numa_nodes.size() > 1) {
+    task_scheduler_numa_arenas = MEM_new<std::vector<tbb::task_arena>>(__func__);
+    for (const tbb::numa_node_id node : numa_nodes) {
+      task_scheduler_numa_arenas->emplace_back(tbb::task_arena::constraints(node));
+    }
+  }
+  task_scheduler_high_priority_arena = MEM_new<tbb::task_arena>(
+      __func__, tbb::task_arena::automatic, 1, tbb::task_arena::priority::high);
+#endif
 }
 
 void BLI_task_scheduler_exit()
 {
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+  MEM_delete(task_scheduler_high_priority_arena);
+  task_scheduler_high_priority_arena = nullptr;
+  MEM_delete(task_scheduler_numa_arenas);
+  task_scheduler_numa_arenas = nullptr;
+#endif
 #ifdef WITH_TBB_GLOBAL_CONTROL
   MEM_delete(task_scheduler_global_control);
 #endif
@@ -64,6 +95,41 @@ int BLI_task_scheduler_num_threads()
   return task_scheduler_num_threads;
 }
 
+int BLI_task_scheduler_numa_node_count()
+{
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+  if (task_scheduler_numa_arenas != nullptr) {
+    return int(task_scheduler_numa_arenas->size());
+  }
+#endif
+  return 1;
+}
+
+void BLI_task_execute_on_numa_node(int numa_node, void (*func)(void *userdata), void *userdata)
+{
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+  if (task_scheduler_numa_arenas != nullptr && numa_node >= 0 &&
+      numa_node < int(task_scheduler_numa_arenas->size())) {
+    (*task_scheduler_numa_arenas)[numa_node].execute([&] { func(userdata); });
+    return;
+  }
+#else
+  UNUSED_VARS(numa_node);
+#endif
+  func(userdata);
+}
+
+void BLI_task_execute_high_priority(void (*func)(void *userdata), void *userdata)
+{
+#ifdef WITH_TBB_ARENA_CONSTRAINTS
+  if (task_scheduler_high_priority_arena != nullptr) {
+    task_scheduler_high_priority_arena->execute([&] { func(userdata); });
+    return;
+  }
+#endif
+  func(userdata);
+}
+
 void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
 {
 #ifdef WITH_TBB
@@ -603,21 +603,167 @@ void BLI_condition_end(ThreadCondition *cond)
 
 /* ************************************************ */
 
+/* Number of work pointers the lock-free ring buffer holds per queue. Pushes past this
+ * spill into a mutex protected overflow queue, so the capacity only bounds the fast
+ * path, not the queue itself. */
+#define THREAD_QUEUE_RING_SIZE 1024
+
+typedef struct ThreadQueueCell {
+  size_t sequence;
+  void *work;
+} ThreadQueueCell;
+
 struct ThreadQueue {
-  GSQueue *queue;
+  /* Bounded lock-free MPMC ring buffer (Dmitry Vyukov's algorithm), the fast path for
+   * both push and pop. The `sequence` of each cell encodes whether the cell holds work
+   * and for which lap around the ring, see thread_queue_ring_push/pop.
+   *
+   * `push_pos` and `pop_pos` are kept on either side of the ring so producers and
+   * consumers do not false-share a cache line. */
+  size_t push_pos;
+  ThreadQueueCell ring[THREAD_QUEUE_RING_SIZE];
+  size_t pop_pos;
+
+  /* Unbounded spill-over, only touched with the mutex held. While `overflow_len` is
+   * non-zero new work keeps being appended here instead of to the (drained) ring, so
+   * FIFO order is preserved across the spill. */
+  GSQueue *overflow;
+  uint32_t overflow_len;
+
+  /* Total number of queued items (ring + overflow), maintained atomically. */
+  uint32_t len;
+
+  /* Number of threads blocked in pop, respectively in wait_finish. Producers and
+   * consumers only take the mutex to signal when these are non-zero. */
+  uint32_t waiting;
+  uint32_t finish_waiting;
+
   pthread_mutex_t mutex;
   pthread_cond_t push_cond;
   pthread_cond_t finish_cond;
   volatile int nowait;
-  volatile int canceled;
 };
 
+/**
+ * Try to push onto the lock-free ring buffer, returns false when the ring is full.
+ *
+ * A cell is free for lap `n` when `sequence == pos` of that lap, and holds work when
+ * `sequence == pos + 1`. Claiming a position and publishing the work pointer both use
+ * CAS, whose full barrier makes the `work` write visible before the new sequence.
+ */
+static bool thread_queue_ring_push(ThreadQueue *queue, void *work)
+{
+  size_t pos = queue->push_pos;
+
+  for (;;) {
+    ThreadQueueCell *cell = &queue->ring[pos & (THREAD_QUEUE_RING_SIZE - 1)];
+    const intptr_t dif = (intptr_t)cell->sequence - (intptr_t)pos;
+
+    if (dif == 0) {
+      if (atomic_cas_z(&queue->push_pos, pos, pos + 1) == pos) {
+        cell->work = work;
+        /* Publish; guaranteed to succeed since only we may write this sequence. */
+        atomic_cas_z(&cell->sequence, pos, pos + 1);
+        return true;
+      }
+      pos = queue->push_pos;
+    }
+    else if (dif < 0) {
+      /* Ring buffer is full. */
+      return false;
+    }
+    else {
+      /* Another producer claimed this position, reload. */
+      pos = queue->push_pos;
+    }
+  }
+}
+
+/**
+ * Try to pop from the lock-free ring buffer, returns false when the ring is empty.
+ */
+static bool thread_queue_ring_pop(ThreadQueue *queue, void **r_work)
+{
+  size_t pos = queue->pop_pos;
+
+  for (;;) {
+    ThreadQueueCell *cell = &queue->ring[pos & (THREAD_QUEUE_RING_SIZE - 1)];
+    const intptr_t dif = (intptr_t)cell->sequence - (intptr_t)(pos + 1);
+
+    if (dif == 0) {
+      if (atomic_cas_z(&queue->pop_pos, pos, pos + 1) == pos) {
+        *r_work = cell->work;
+        /* Mark the cell free for the next lap, guaranteed to succeed. */
+        atomic_cas_z(&cell->sequence, pos + 1, pos + THREAD_QUEUE_RING_SIZE);
+        return true;
+      }
+      pos = queue->pop_pos;
+    }
+    else if (dif < 0) {
+      /* Ring buffer is empty. */
+      return false;
+    }
+    else {
+      /* Another consumer claimed this position, reload. */
+      pos = queue->pop_pos;
+    }
+  }
+}
+
+/**
+ * Non-blocking pop from ring or overflow, must be called without the mutex held.
+ */
+static bool thread_queue_pop_fast(ThreadQueue *queue, void **r_work)
+{
+  /* Ring items always predate overflow items, try them first. */
+  if (thread_queue_ring_pop(queue, r_work)) {
+    return true;
+  }
+
+  if (queue->overflow_len != 0) {
+    bool found = false;
+
+    pthread_mutex_lock(&queue->mutex);
+    if (!BLI_gsqueue_is_empty(queue->overflow)) {
+      BLI_gsqueue_pop(queue->overflow, r_work);
+      atomic_sub_and_fetch_uint32(&queue->overflow_len, 1);
+      found = true;
+    }
+    pthread_mutex_unlock(&queue->mutex);
+
+    if (found) {
+      return true;
+    }
+    /* The overflow drained under our feet, by now the ring may have refilled. */
+    return thread_queue_ring_pop(queue, r_work);
+  }
+
+  return false;
+}
+
+/**
+ * Account for a successful pop: adjust the queue length and wake up threads waiting
+ * for the queue to finish when we removed the last item.
+ */
+static void thread_queue_pop_commit(ThreadQueue *queue)
+{
+  if (atomic_sub_and_fetch_uint32(&queue->len, 1) == 0 && queue->finish_waiting != 0) {
+    pthread_mutex_lock(&queue->mutex);
+    pthread_cond_broadcast(&queue->finish_cond);
+    pthread_mutex_unlock(&queue->mutex);
+  }
+}
+
 ThreadQueue *BLI_thread_queue_init()
 {
   ThreadQueue *queue;
 
   queue = static_cast<ThreadQueue *>(MEM_callocN(sizeof(ThreadQueue), "ThreadQueue"));
-  queue->queue = BLI_gsqueue_new(sizeof(void *));
+  queue->overflow = BLI_gsqueue_new(sizeof(void *));
+
+  for (int i = 0; i < THREAD_QUEUE_RING_SIZE; i++) {
+    queue->ring[i].sequence = (size_t)i;
+  }
 
   pthread_mutex_init(&queue->mutex, nullptr);
   pthread_cond_init(&queue->push_cond, nullptr);
@@ -633,42 +779,77 @@ void BLI_thread_queue_free(ThreadQueue *queue)
   pthread_cond_destroy(&queue->push_cond);
   pthread_mutex_destroy(&queue->mutex);
 
-  BLI_gsqueue_free(queue->queue);
+  BLI_gsqueue_free(queue->overflow);
 
   MEM_freeN(queue);
 }
 
 void BLI_thread_queue_push(ThreadQueue *queue, void *work)
 {
-  pthread_mutex_lock(&queue->mutex);
+  atomic_add_and_fetch_uint32(&queue->len, 1);
 
-  BLI_gsqueue_push(queue->queue, &work);
+  /* While older work sits in the overflow queue, new work has to go behind it rather
+   * than into the drained ring, otherwise FIFO order would break. */
+  if (queue->overflow_len != 0 || !thread_queue_ring_push(queue, work)) {
+    pthread_mutex_lock(&queue->mutex);
 
-  /* signal threads waiting to pop */
-  pthread_cond_signal(&queue->push_cond);
-  pthread_mutex_unlock(&queue->mutex);
+    BLI_gsqueue_push(queue->overflow, &work);
+    atomic_add_and_fetch_uint32(&queue->overflow_len, 1);
+
+    /* signal threads waiting to pop */
+    pthread_cond_signal(&queue->push_cond);
+    pthread_mutex_unlock(&queue->mutex);
+    return;
+  }
+
+  /* Signal threads waiting to pop. The barrier from the ring CAS above orders the push
+   * before this read, so either we see the sleeper, or the sleeper (which registers
+   * `waiting` with a barrier before re-checking the ring) sees our work. */
+  if (queue->waiting != 0) {
+    pthread_mutex_lock(&queue->mutex);
+    pthread_cond_signal(&queue->push_cond);
+    pthread_mutex_unlock(&queue->mutex);
+  }
 }
 
 void *BLI_thread_queue_pop(ThreadQueue *queue)
 {
   void *work = nullptr;
 
-  /* wait until there is work */
-  pthread_mutex_lock(&queue->mutex);
-  while (BLI_gsqueue_is_empty(queue->queue) && !queue->nowait) {
-    pthread_cond_wait(&queue->push_cond, &queue->mutex);
-  }
+  if (!thread_queue_pop_fast(queue, &work)) {
+    bool found = false;
+
+    /* wait until there is work */
+    pthread_mutex_lock(&queue->mutex);
+    atomic_add_and_fetch_uint32(&queue->waiting, 1);
+
+    for (;;) {
+      /* Re-check now that `waiting` is registered, so pushes cannot be missed. */
+      if (thread_queue_ring_pop(queue, &work)) {
+        found = true;
+        break;
+      }
+      if (!BLI_gsqueue_is_empty(queue->overflow)) {
+        BLI_gsqueue_pop(queue->overflow, &work);
+        atomic_sub_and_fetch_uint32(&queue->overflow_len, 1);
+        found = true;
+        break;
+      }
+      if (queue->nowait) {
+        break;
+      }
+      pthread_cond_wait(&queue->push_cond, &queue->mutex);
+    }
 
-  /* if we have something, pop it */
-  if (!BLI_gsqueue_is_empty(queue->queue)) {
-    BLI_gsqueue_pop(queue->queue, &work);
+    atomic_sub_and_fetch_uint32(&queue->waiting, 1);
+    pthread_mutex_unlock(&queue->mutex);
 
-    if (BLI_gsqueue_is_empty(queue->queue)) {
-      pthread_cond_broadcast(&queue->finish_cond);
+    if (!found) {
+      return nullptr;
     }
   }
 
-  pthread_mutex_unlock(&queue->mutex);
+  thread_queue_pop_commit(queue);
 
   return work;
 }
@@ -713,55 +894,63 @@ void *BLI_thread_queue_pop_timeout(ThreadQueue *queue, int ms)
   double t;
   void *work = nullptr;
   struct timespec timeout;
+  bool found = false, timed_out = false;
+
+  if (thread_queue_pop_fast(queue, &work)) {
+    thread_queue_pop_commit(queue);
+    return work;
+  }
 
   t = PIL_check_seconds_timer();
   wait_timeout(&timeout, ms);
 
   /* wait until there is work */
   pthread_mutex_lock(&queue->mutex);
-  while (BLI_gsqueue_is_empty(queue->queue) && !queue->nowait) {
-    if (pthread_cond_timedwait(&queue->push_cond, &queue->mutex, &timeout) == ETIMEDOUT) {
+  atomic_add_and_fetch_uint32(&queue->waiting, 1);
+
+  for (;;) {
+    /* Re-check now that `waiting` is registered, so pushes cannot be missed. */
+    if (thread_queue_ring_pop(queue, &work)) {
+      found = true;
       break;
     }
-    if (PIL_check_seconds_timer() - t >= ms * 0.001) {
+    if (!BLI_gsqueue_is_empty(queue->overflow)) {
+      BLI_gsqueue_pop(queue->overflow, &work);
+      atomic_sub_and_fetch_uint32(&queue->overflow_len, 1);
+      found = true;
       break;
     }
+    if (queue->nowait || timed_out) {
+      break;
+    }
+    if (pthread_cond_timedwait(&queue->push_cond, &queue->mutex, &timeout) == ETIMEDOUT) {
+      timed_out = true;
+    }
+    else if (PIL_check_seconds_timer() - t >= ms * 0.001) {
+      timed_out = true;
+    }
   }
 
-  /* if we have something, pop it */
-  if (!BLI_gsqueue_is_empty(queue->queue)) {
-    BLI_gsqueue_pop(queue->queue, &work);
+  atomic_sub_and_fetch_uint32(&queue->waiting, 1);
+  pthread_mutex_unlock(&queue->mutex);
 
-    if (BLI_gsqueue_is_empty(queue->queue)) {
-      pthread_cond_broadcast(&queue->finish_cond);
-    }
+  if (!found) {
+    return nullptr;
   }
 
-  pthread_mutex_unlock(&queue->mutex);
+  thread_queue_pop_commit(queue);
 
   return work;
 }
 
 int BLI_thread_queue_len(ThreadQueue *queue)
 {
-  int size;
-
-  pthread_mutex_lock(&queue->mutex);
-  size = BLI_gsqueue_len(queue->queue);
-  pthread_mutex_unlock(&queue->mutex);
-
-  return size;
+  return (int)queue->len;
 }
 
 bool BLI_thread_queue_is_empty(ThreadQueue *queue)
 {
-  bool is_empty;
-
-  pthread_mutex_lock(&queue->mutex);
-  is_empty = BLI_gsqueue_is_empty(queue->queue);
-  pthread_mutex_unlock(&queue->mutex);
-
-  return is_empty;
+  return queue->len == 0;
 }
 
 void BLI_thread_queue_nowait(ThreadQueue *queue)
@@ -779,10 +968,12 @@ void BLI_thread_queue_wait_finish(ThreadQueue *queue)
 {
   /* wait for finish condition */
   pthread_mutex_lock(&queue->mutex);
+  atomic_add_and_fetch_uint32(&queue->finish_waiting, 1);
 
-  while (!BLI_gsqueue_is_empty(queue->queue)) {
+  while (queue->len != 0) {
     pthread_cond_wait(&queue->finish_cond, &queue->mutex);
   }
 
+  atomic_sub_and_fetch_uint32(&queue->finish_waiting, 1);
   pthread_mutex_unlock(&queue->mutex);
 }
@@ -0,0 +1,167 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "BLI_string.h"
+#include "BLI_trace.h"
+#include "BLI_utildefines.h"
+
+namespace {
+
+struct TraceEvent {
+  /** Copied at record time, callers may pass transient names. */
+  char name[55];
+  bool begin;
+  uint64_t time_ns;
+};
+
+/**
+ * Events recorded per thread, oldest events are overwritten once the buffer is full.
+ * Sized so a buffer stays around 1MB, enough for a couple of minutes of typical
+ * depsgraph/sequencer zones per thread.
+ */
+constexpr int64_t events_capacity = 16384;
+
+struct ThreadBuffer {
+  int tid;
+  /** Total number of events ever pushed, the ring index is derived from it. */
+  std::atomic<int64_t> num_events{0};
+  TraceEvent events[events_capacity];
+};
+
+std::atomic<bool> trace_enabled{false};
+
+/** All buffers ever created; they outlive their threads so late exports stay valid. */
+std::mutex registry_mutex;
+std::vector<ThreadBuffer *> &registry()
+{
+  static std::vector<ThreadBuffer *> buffers;
+  return buffers;
+}
+
+thread_local ThreadBuffer *thread_buffer = nullptr;
+
+ThreadBuffer *ensure_thread_buffer()
+{
+  if (thread_buffer == nullptr) {
+    ThreadBuffer *buffer = new ThreadBuffer();
+    std::lock_guard lock(registry_mutex);
+    buffer->tid = int(registry().size());
+    registry().push_back(buffer);
+    thread_buffer = buffer;
+  }
+  return thread_buffer;
+}
+
+uint64_t now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void push_event(const char *name, const bool begin)
+{
+  ThreadBuffer *buffer = ensure_thread_buffer();
+  const int64_t index = buffer->num_events.load(std::memory_order_relaxed);
+  TraceEvent &event = buffer->events[index % events_capacity];
+  event.time_ns = now_ns();
+  event.begin = begin;
+  if (name != nullptr) {
+    BLI_strncpy(event.name, name, sizeof(event.name));
+  }
+  else {
+    event.name[0] = '\0';
+  }
+  buffer->num_events.store(index + 1, std::memory_order_release);
+}
+
+void write_escaped(FILE *f, const char *str)
+{
+  for (const char *p = str; *p; p++) {
+    if (ELEM(*p, '"', '\\')) {
+      fputc('\\', f);
+    }
+    fputc(*p, f);
+  }
+}
+
+}  // namespace
+
+void BLI_trace_set_enabled(const bool enabled)
+{
+  trace_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool BLI_trace_is_enabled(void)
+{
+  return trace_enabled.load(std::memory_order_relaxed);
+}
+
+void BLI_trace_zone_begin(const char *name)
+{
+  if (!BLI_trace_is_enabled()) {
+    return;
+  }
+  push_event(name, true);
+}
+
+void BLI_trace_zone_end(void)
+{
+  if (!BLI_trace_is_enabled()) {
+    return;
+  }
+  push_event(nullptr, false);
+}
+
+bool BLI_trace_export_json(const char *filepath)
+{
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    return false;
+  }
+
+  fprintf(f, "{\"traceEvents\":[\n");
+
+  std::lock_guard lock(registry_mutex);
+  bool is_first = true;
+  for (const ThreadBuffer *buffer : registry()) {
+    const int64_t num_events = buffer->num_events.load(std::memory_order_acquire);
+    const int64_t num_stored = std::min(num_events, events_capacity);
+    for (int64_t i = num_events - num_stored; i < num_events; i++) {
+      const TraceEvent &event = buffer->events[i % events_capacity];
+      fprintf(f,
+              "%s{\"ph\":\"%c\",\"ts\":%.3f,\"pid\":0,\"tid\":%d,\"name\":\"",
+              is_first ? "" : ",\n",
+              event.begin ? 'B' : 'E',
+              double(event.time_ns) / 1000.0,
+              buffer->tid);
+      write_escaped(f, event.name);
+      fprintf(f, "\"}");
+      is_first = false;
+    }
+  }
+
+  fprintf(f, "\n]}\n");
+  fclose(f);
+
+  return true;
+}
+
+void BLI_trace_clear(void)
+{
+  std::lock_guard lock(registry_mutex);
+  for (ThreadBuffer *buffer : registry()) {
+    buffer->num_events.store(0, std::memory_order_release);
+  }
+}
@@ -207,3 +207,103 @@ TEST(ghash, Pop)
 
   BLI_ghash_free(ghash, nullptr, nullptr);
 }
+
+/* Same as InsertLookup, for the flat (open-addressing) backing store. */
+TEST(ghash, FlatInsertLookup)
+{
+  GHash *ghash = BLI_ghash_flat_new(BLI_ghashutil_inthash_p, BLI_ghashutil_intcmp, __func__);
+  unsigned int keys[TESTCASE_SIZE], *k;
+  int i;
+
+  init_keys(keys, 40);
+
+  for (i = TESTCASE_SIZE, k = keys; i--; k++) {
+    BLI_ghash_insert(ghash, POINTER_FROM_UINT(*k), POINTER_FROM_UINT(*k));
+  }
+
+  EXPECT_EQ(BLI_ghash_len(ghash), TESTCASE_SIZE);
+
+  for (i = TESTCASE_SIZE, k = keys; i--; k++) {
+    void *v = BLI_ghash_lookup(ghash, POINTER_FROM_UINT(*k));
+    EXPECT_EQ(POINTER_AS_UINT(v), *k);
+  }
+
+  BLI_ghash_free(ghash, nullptr, nullptr);
+}
+
+/* Removal in a flat ghash backward-shifts the entries that follow the removed one, so here
+ * we remove every other key and check that all the remaining ones can still be found (and
+ * the removed ones cannot), before emptying the ghash completely. */
+TEST(ghash, FlatInsertRemove)
+{
+  GHash *ghash = BLI_ghash_flat_new(BLI_ghashutil_inthash_p, BLI_ghashutil_intcmp, __func__);
+  unsigned int keys[TESTCASE_SIZE], *k;
+  int i;
+
+  init_keys(keys, 50);
+
+  for (i = TESTCASE_SIZE, k = keys; i--; k++) {
+    BLI_ghash_insert(ghash, POINTER_FROM_UINT(*k), POINTER_FROM_UINT(*k));
+  }
+
+  EXPECT_EQ(BLI_ghash_len(ghash), TESTCASE_SIZE);
+
+  for (i = 0; i < TESTCASE_SIZE; i += 2) {
+    EXPECT_TRUE(BLI_ghash_remove(ghash, POINTER_FROM_UINT(keys[i]), nullptr, nullptr));
+  }
+
+  EXPECT_EQ(BLI_ghash_len(ghash), TESTCASE_SIZE / 2);
+
+  for (i = 0; i < TESTCASE_SIZE; i++) {
+    void *v = BLI_ghash_lookup(ghash, POINTER_FROM_UINT(keys[i]));
+    if (i % 2) {
+      EXPECT_EQ(POINTER_AS_UINT(v), keys[i]);
+    }
+    else {
+      EXPECT_EQ(v, nullptr);
+    }
+  }
+
+  for (i = 1; i < TESTCASE_SIZE; i += 2) {
+    void *v = BLI_ghash_popkey(ghash, POINTER_FROM_UINT(keys[i]), nullptr);
+    EXPECT_EQ(POINTER_AS_UINT(v), keys[i]);
+  }
+
+  EXPECT_EQ(BLI_ghash_len(ghash), 0);
+
+  BLI_ghash_free(ghash, nullptr, nullptr);
+}
+
+/* Interleave removals and re-insertions, so backward-shifted slots get reused and the table
+ * keeps growing through the churn. */
+TEST(ghash, FlatRemoveReinsert)
+{
+  GHash *ghash = BLI_ghash_flat_new(BLI_ghashutil_inthash_p, BLI_ghashutil_intcmp, __func__);
+  unsigned int keys[TESTCASE_SIZE], *k;
+  int i;
+
+  init_keys(keys, 60);
+
+  for (i = TESTCASE_SIZE, k = keys; i--; k++) {
+    BLI_ghash_insert(ghash, POINTER_FROM_UINT(*k), POINTER_FROM_UINT(*k));
+  }
+
+  for (i = 0; i < TESTCASE_SIZE; i += 2) {
+    EXPECT_TRUE(BLI_ghash_remove(ghash, POINTER_FROM_UINT(keys[i]), nullptr, nullptr));
+    /* Overwriting a live key must not add an entry... */
+    EXPECT_FALSE(BLI_ghash_reinsert(
+        ghash, POINTER_FROM_UINT(keys[i + 1]), POINTER_FROM_UINT(keys[i + 1]), nullptr, nullptr));
+    /* ...while re-inserting the just-removed one must. */
+    EXPECT_TRUE(BLI_ghash_reinsert(
+        ghash, POINTER_FROM_UINT(keys[i]), POINTER_FROM_UINT(keys[i]), nullptr, nullptr));
+  }
+
+  EXPECT_EQ(BLI_ghash_len(ghash), TESTCASE_SIZE);
+
+  for (i = TESTCASE_SIZE, k = keys; i--; k++) {
+    void *v = BLI_ghash_lookup(ghash, POINTER_FROM_UINT(*k));
+    EXPECT_EQ(POINTER_AS_UINT(v), *k);
+  }
+
+  BLI_ghash_free(ghash, nullptr, nullptr);
+}
@@ -132,3 +132,77 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+/**
+ * The batched ray-cast reorders the rays internally, results must still land in the input order
+ * and match what the single-ray version finds for each ray.
+ */
+static void ray_cast_batch_test(int points_len, int rays_len, int random_seed)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
+
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*ray_origins)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  float(*ray_directions)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  BVHTreeRayHit *hits = (BVHTreeRayHit *)MEM_mallocN(sizeof(BVHTreeRayHit) * rays_len, __func__);
+
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  /* Aim every ray at some point of the tree so most of them hit,
+   * keeping some fully random misses. */
+  for (int i = 0; i < rays_len; i++) {
+    rng_v3_round(ray_origins[i], 3, rng, 1000, 10.0f);
+    if (i % 8) {
+      sub_v3_v3v3(ray_directions[i], points[BLI_rng_get_int(rng) % points_len], ray_origins[i]);
+    }
+    else {
+      rng_v3_round(ray_directions[i], 3, rng, 1000, 1.0f);
+    }
+    normalize_v3(ray_directions[i]);
+
+    hits[i].index = -1;
+    hits[i].dist = BVH_RAYCAST_DIST_MAX;
+  }
+
+  BLI_bvhtree_ray_cast_batch(tree,
+                             ray_origins,
+                             ray_directions,
+                             0.0f,
+                             hits,
+                             rays_len,
+                             nullptr,
+                             nullptr,
+                             BVH_RAYCAST_DEFAULT);
+
+  for (int i = 0; i < rays_len; i++) {
+    BVHTreeRayHit hit_single;
+    hit_single.index = -1;
+    hit_single.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(
+        tree, ray_origins[i], ray_directions[i], 0.0f, &hit_single, nullptr, nullptr);
+
+    EXPECT_EQ(hits[i].index, hit_single.index);
+    EXPECT_EQ(hits[i].dist, hit_single.dist);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(ray_origins);
+  MEM_freeN(ray_directions);
+  MEM_freeN(hits);
+}
+
+TEST(kdopbvh, RayCastBatch_1)
+{
+  ray_cast_batch_test(100, 1, 1234);
+}
+TEST(kdopbvh, RayCastBatch_500)
+{
+  ray_cast_batch_test(500, 500, 123);
+}
@@ -14,6 +14,7 @@
 #include "BLI_mempool.h"
 #include "BLI_task.h"
 #include "BLI_task.hh"
+#include "BLI_threads.h"
 
 #define NUM_ITEMS 10000
 
@@ -283,6 +284,101 @@ TEST(task, ListBaseIter)
   BLI_threadapi_exit();
 }
 
+/* *** Multi-producer/multi-consumer usage of the work queue. *** */
+
+/* Enough items to overflow the queue's internal ring buffer several times over. */
+#define QUEUE_NUM_PRODUCERS 4
+#define QUEUE_NUM_CONSUMERS 4
+#define QUEUE_ITEMS_PER_PRODUCER 2500
+
+struct QueueProducerData {
+  ThreadQueue *queue;
+  int id;
+};
+
+struct QueueConsumerData {
+  ThreadQueue *queue;
+  uint32_t *delivered;
+  /* Highest sequence number this consumer popped from each producer so far. */
+  int last_seen[QUEUE_NUM_PRODUCERS];
+};
+
+static void *queue_producer_func(void *userdata)
+{
+  QueueProducerData *data = (QueueProducerData *)userdata;
+
+  /* Sequence numbers start at 1 so no pushed pointer is ever NULL. */
+  for (int seq = 1; seq <= QUEUE_ITEMS_PER_PRODUCER; seq++) {
+    BLI_thread_queue_push(data->queue, POINTER_FROM_UINT((uint)(data->id << 16) | (uint)seq));
+  }
+  return nullptr;
+}
+
+static void *queue_consumer_func(void *userdata)
+{
+  QueueConsumerData *data = (QueueConsumerData *)userdata;
+  void *work;
+
+  while ((work = BLI_thread_queue_pop(data->queue))) {
+    const int id = (int)(POINTER_AS_UINT(work) >> 16);
+    const int seq = (int)(POINTER_AS_UINT(work) & 0xffff);
+
+    /* Pops are a sub-sequence of the global FIFO order, so each consumer must see
+     * every producer's items in increasing order. */
+    EXPECT_LT(data->last_seen[id], seq);
+    data->last_seen[id] = seq;
+
+    atomic_add_and_fetch_uint32(&data->delivered[id * QUEUE_ITEMS_PER_PRODUCER + (seq - 1)], 1);
+  }
+  return nullptr;
+}
+
+TEST(task, ThreadQueueMPMC)
+{
+  uint32_t *delivered = (uint32_t *)MEM_calloc_arrayN(
+      QUEUE_NUM_PRODUCERS * QUEUE_ITEMS_PER_PRODUCER, sizeof(*delivered), __func__);
+  QueueProducerData producers[QUEUE_NUM_PRODUCERS];
+  QueueConsumerData consumers[QUEUE_NUM_CONSUMERS] = {{nullptr}};
+  ListBase producer_threads = {nullptr, nullptr};
+  ListBase consumer_threads = {nullptr, nullptr};
+  int i;
+
+  BLI_threadapi_init();
+
+  ThreadQueue *queue = BLI_thread_queue_init();
+
+  BLI_threadpool_init(&consumer_threads, queue_consumer_func, QUEUE_NUM_CONSUMERS);
+  for (i = 0; i < QUEUE_NUM_CONSUMERS; i++) {
+    consumers[i].queue = queue;
+    consumers[i].delivered = delivered;
+    BLI_threadpool_insert(&consumer_threads, &consumers[i]);
+  }
+
+  BLI_threadpool_init(&producer_threads, queue_producer_func, QUEUE_NUM_PRODUCERS);
+  for (i = 0; i < QUEUE_NUM_PRODUCERS; i++) {
+    producers[i].queue = queue;
+    producers[i].id = i;
+    BLI_threadpool_insert(&producer_threads, &producers[i]);
+  }
+
+  BLI_threadpool_end(&producer_threads);
+
+  /* All work is pushed, let the consumers drain the queue and return. */
+  BLI_thread_queue_nowait(queue);
+  BLI_threadpool_end(&consumer_threads);
+
+  EXPECT_TRUE(BLI_thread_queue_is_empty(queue));
+
+  /* Every item must have been delivered to exactly one consumer. */
+  for (i = 0; i < QUEUE_NUM_PRODUCERS * QUEUE_ITEMS_PER_PRODUCER; i++) {
+    EXPECT_EQ(delivered[i], 1);
+  }
+
+  BLI_thread_queue_free(queue);
+  MEM_freeN(delivered);
+  BLI_threadapi_exit();
+}
+
 TEST(task, ParallelInvoke)
 {
   std::atomic<int> counter = 0;
@@ -57,3 +57,24 @@ enum {
 };
 
 #define BLEN_THUMB_MEMSIZE_FILE(_x, _y) (sizeof(int) * (2 + (size_t)(_x) * (size_t)(_y)))
+
+/**
+ * Optional ID offset index, appended after the #ENDB block by regular file saves
+ * (readers that scan #BHead's stop at #ENDB, so older Blender versions simply ignore it).
+ *
+ * The index maps full ID names (including the two character type prefix) to the offset of
+ * the ID's #BHead in the logical (uncompressed) byte stream, allowing readers to list the
+ * data-blocks of a library file without scanning - and for zstd compressed files, without
+ * decompressing - the whole file.
+ *
+ * Layout, all values in the endianness of the rest of the file:
+ * - Per entry: `uint64_t` offset, followed by the padded ID name.
+ * - Footer: `uint32_t` entry count, `uint32_t` entry size, 8 byte magic.
+ *
+ * The entry size is stored so the entry layout can be extended without breaking readers.
+ */
+#define BLEND_ID_INDEX_MAGIC "BlendIdx"
+#define BLEND_ID_INDEX_MAGIC_SIZE 8
+#define BLEND_ID_INDEX_NAME_SIZE 66 /* #MAX_ID_NAME */
+#define BLEND_ID_INDEX_ENTRY_SIZE (sizeof(uint64_t) + BLEND_ID_INDEX_NAME_SIZE)
+#define BLEND_ID_INDEX_FOOTER_SIZE (2 * sizeof(uint32_t) + BLEND_ID_INDEX_MAGIC_SIZE)
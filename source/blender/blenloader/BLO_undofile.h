@@ -18,7 +18,9 @@ typedef struct {
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** When true, this chunk is identical to the matching chunk of the previous undo step
+   * (used for change detection). Chunk buffers are reference counted and may also be shared
+   * with other steps in the undo stack without this flag being set, see `undofile.c`. */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
@@ -90,6 +92,17 @@ extern void BLO_memfile_clear_future(MemFile *memfile);
 
 /* Utilities. */
 
+/**
+ * Create a snapshot of \a memfile that stays valid while the original keeps changing
+ * (e.g. from new undo pushes), by referencing the underlying chunk buffers.
+ *
+ * Cheap (no buffer memory is copied), intended for writing the current undo state from a
+ * background thread. Both creating the snapshot and freeing it again (#BLO_memfile_free
+ * plus freeing the returned struct) must happen on the main thread, only reading it
+ * (e.g. #BLO_memfile_write_file) may run concurrently.
+ */
+extern struct MemFile *BLO_memfile_snapshot(struct MemFile *memfile);
+
 extern struct Main *BLO_memfile_main_get(struct MemFile *memfile,
                                          struct Main *bmain,
                                          struct Scene **r_scene);
@@ -110,6 +110,22 @@ LinkNode *BLO_blendhandle_get_datablock_names(BlendHandle *bh,
   BHead *bhead;
   int tot = 0;
 
+  /* When the file has an ID offset index, names can be listed from it directly,
+   * without scanning (and for compressed files, decompressing) any #BHead's.
+   * The index has no asset meta-data though, listing assets still needs the scan. */
+  if (!use_assets_only && blo_read_id_offset_index(fd)) {
+    for (int i = 0; i < fd->id_offset_index_len; i++) {
+      const BlendIdIndexEntry *entry = &fd->id_offset_index[i];
+      if (GS(entry->name) == ofblocktype) {
+        BLI_linklist_prepend(&names, BLI_strdup(entry->name + 2));
+        tot++;
+      }
+    }
+
+    *r_tot_names = tot;
+    return names;
+  }
+
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == ofblocktype) {
       const char *idname = blo_bhead_id_name(fd, bhead);
@@ -322,6 +338,23 @@ LinkNode *BLO_blendhandle_get_linkable_groups(BlendHandle *bh)
   LinkNode *names = NULL;
   BHead *bhead;
 
+  if (blo_read_id_offset_index(fd)) {
+    /* See #BLO_blendhandle_get_datablock_names, same logic using the ID offset index. */
+    for (int i = 0; i < fd->id_offset_index_len; i++) {
+      const short idcode = GS(fd->id_offset_index[i].name);
+      if (BKE_idtype_idcode_is_valid(idcode) && BKE_idtype_idcode_is_linkable(idcode)) {
+        const char *str = BKE_idtype_idcode_to_name(idcode);
+
+        if (BLI_gset_add(gathered, (void *)str)) {
+          BLI_linklist_prepend(&names, BLI_strdup(str));
+        }
+      }
+    }
+
+    BLI_gset_free(gathered, NULL);
+    return names;
+  }
+
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == ENDB) {
       break;
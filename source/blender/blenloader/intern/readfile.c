@@ -185,14 +185,23 @@ typedef struct BHeadN {
 #ifdef USE_BHEAD_READ_ON_DEMAND
   /** Use to read the data from the file directly into memory as needed. */
   off64_t file_offset;
-  /** When set, the remainder of this allocation is the data, otherwise it needs to be read. */
+  /** When set, #BHeadN.data is valid, otherwise the data needs to be read. */
   bool has_data;
 #endif
   bool is_memchunk_identical;
+  /**
+   * The block content (the `bh.len` bytes following the #BHead in the file).
+   * Either the remainder of this allocation, or - for memory backed and memory-mapped
+   * #FileReader's - a pointer directly into the reader's storage (the zero-copy case,
+   * where no per-block copy of the data is made).
+   */
+  const void *data;
   struct BHead bhead;
 } BHeadN;
 
 #define BHEADN_FROM_BHEAD(bh) ((BHeadN *)POINTER_OFFSET(bh, -(int)offsetof(BHeadN, bhead)))
+/** Access a #BHead's block content (the `len` bytes following the header in the file). */
+#define BHEAD_DATA(bh) (BHEADN_FROM_BHEAD(bh)->data)
 
 /* We could change this in the future, for now it's simplest if only data is delayed
  * because ID names are used in lookup tables. */
@@ -751,6 +760,7 @@ static BHeadN *get_bhead(FileData *fd)
       BHead8 bhead8 = {0};
       BHead4 bhead4 = {0};
       BHead bhead = {0};
+      const void *mapped_data = NULL;
 
       /* First read the bhead structure.
        * Depending on the platform the file was written on this can
@@ -826,6 +836,7 @@ static BHeadN *get_bhead(FileData *fd)
           new_bhead->file_offset = fd->file->offset;
           new_bhead->has_data = false;
           new_bhead->is_memchunk_identical = false;
+          new_bhead->data = NULL;
           new_bhead->bhead = bhead;
           off64_t seek_new = fd->file->seek(fd->file, bhead.len, SEEK_CUR);
           if (seek_new == -1) {
@@ -840,6 +851,31 @@ static BHeadN *get_bhead(FileData *fd)
         }
       }
 #endif
+      else if ((fd->flags & FD_FLAGS_SWITCH_ENDIAN) == 0 && fd->file->data != NULL &&
+               (mapped_data = fd->file->data(fd->file, fd->file->offset, (size_t)bhead.len))) {
+        /* Zero-copy: reference the block content in the reader's memory directly instead of
+         * copying it. Requires matching endianness, since endian switching is done in-place. */
+        new_bhead = MEM_mallocN(sizeof(BHeadN), "new_bhead");
+        if (new_bhead) {
+          new_bhead->next = new_bhead->prev = NULL;
+#ifdef USE_BHEAD_READ_ON_DEMAND
+          new_bhead->file_offset = 0; /* don't seek. */
+          new_bhead->has_data = true;
+#endif
+          new_bhead->is_memchunk_identical = false;
+          new_bhead->data = mapped_data;
+          new_bhead->bhead = bhead;
+
+          if (fd->file->seek(fd->file, bhead.len, SEEK_CUR) == -1) {
+            fd->is_eof = true;
+            MEM_freeN(new_bhead);
+            new_bhead = NULL;
+          }
+        }
+        else {
+          fd->is_eof = true;
+        }
+      }
       else {
         new_bhead = MEM_mallocN(sizeof(BHeadN) + (size_t)bhead.len, "new_bhead");
         if (new_bhead) {
@@ -849,6 +885,7 @@ static BHeadN *get_bhead(FileData *fd)
           new_bhead->has_data = true;
 #endif
           new_bhead->is_memchunk_identical = false;
+          new_bhead->data = new_bhead + 1;
           new_bhead->bhead = bhead;
 
           readsize = fd->file->read(fd->file, new_bhead + 1, (size_t)bhead.len);
@@ -966,6 +1003,7 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
   new_bhead_data->file_offset = new_bhead->file_offset;
   new_bhead_data->has_data = true;
   new_bhead_data->is_memchunk_identical = false;
+  new_bhead_data->data = new_bhead_data + 1;
   if (!blo_bhead_read_data(fd, thisblock, new_bhead_data + 1)) {
     MEM_freeN(new_bhead_data);
     return NULL;
@@ -976,17 +1014,74 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 
 const char *blo_bhead_id_name(const FileData *fd, const BHead *bhead)
 {
-  return (const char *)POINTER_OFFSET(bhead, sizeof(*bhead) + fd->id_name_offset);
+  return (const char *)POINTER_OFFSET(BHEAD_DATA(bhead), fd->id_name_offset);
 }
 
 AssetMetaData *blo_bhead_id_asset_data_address(const FileData *fd, const BHead *bhead)
 {
   BLI_assert(blo_bhead_is_id_valid_type(bhead));
   return (fd->id_asset_data_offset >= 0) ?
-             *(AssetMetaData **)POINTER_OFFSET(bhead, sizeof(*bhead) + fd->id_asset_data_offset) :
+             *(AssetMetaData **)POINTER_OFFSET(BHEAD_DATA(bhead), fd->id_asset_data_offset) :
              NULL;
 }
 
+bool blo_read_id_offset_index(FileData *fd)
+{
+  if (fd->id_offset_index_checked) {
+    return fd->id_offset_index != NULL;
+  }
+  fd->id_offset_index_checked = true;
+
+  FileReader *file = fd->file;
+  if (file == NULL || file->seek == NULL) {
+    return false;
+  }
+
+  const off64_t offset_restore = file->offset;
+  bool success = false;
+
+  uchar footer[BLEND_ID_INDEX_FOOTER_SIZE];
+  if (file->seek(file, -(off64_t)sizeof(footer), SEEK_END) >= 0 &&
+      file->read(file, footer, sizeof(footer)) == sizeof(footer) &&
+      memcmp(footer + 2 * sizeof(uint32_t), BLEND_ID_INDEX_MAGIC, BLEND_ID_INDEX_MAGIC_SIZE) ==
+          0) {
+    uint32_t count, entry_size;
+    memcpy(&count, footer, sizeof(uint32_t));
+    memcpy(&entry_size, footer + sizeof(uint32_t), sizeof(uint32_t));
+    if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+      BLI_endian_switch_uint32(&count);
+      BLI_endian_switch_uint32(&entry_size);
+    }
+
+    /* A larger entry size would mean a newer index version extended the entries,
+     * reading only the fields known here is still valid then. */
+    if (entry_size >= BLEND_ID_INDEX_ENTRY_SIZE && count > 0) {
+      const size_t data_len = (size_t)count * entry_size;
+      uchar *data = MEM_mallocN(data_len, __func__);
+      if (file->seek(file, -(off64_t)(data_len + sizeof(footer)), SEEK_END) >= 0 &&
+          file->read(file, data, data_len) == data_len) {
+        fd->id_offset_index = MEM_malloc_arrayN(count, sizeof(BlendIdIndexEntry), "id_offset_index");
+        fd->id_offset_index_len = count;
+        for (uint32_t i = 0; i < count; i++) {
+          BlendIdIndexEntry *entry = &fd->id_offset_index[i];
+          const uchar *entry_data = data + (size_t)i * entry_size;
+          memcpy(&entry->offset, entry_data, sizeof(uint64_t));
+          if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+            BLI_endian_switch_uint64(&entry->offset);
+          }
+          memcpy(entry->name, entry_data + sizeof(uint64_t), sizeof(entry->name));
+          entry->name[sizeof(entry->name) - 1] = '\0';
+        }
+        success = true;
+      }
+      MEM_freeN(data);
+    }
+  }
+
+  file->seek(file, offset_restore, SEEK_SET);
+  return success;
+}
+
 static void decode_blender_header(FileData *fd)
 {
   char header[SIZEOFBLENDERHEADER], num[4];
@@ -1044,7 +1139,7 @@ static bool read_file_dna(FileData *fd, const char **r_error_message)
       }
       /* We can't use read_global because this needs 'DNA1' to be decoded,
        * however the first 4 chars are _always_ the subversion. */
-      FileGlobal *fg = (void *)&bhead[1];
+      FileGlobal *fg = (FileGlobal *)BHEAD_DATA(bhead);
       BLI_STATIC_ASSERT(offsetof(FileGlobal, subvstr) == 0, "Must be first: subvstr")
       char num[5];
       memcpy(num, fg->subvstr, 4);
@@ -1055,7 +1150,7 @@ static bool read_file_dna(FileData *fd, const char **r_error_message)
       const bool do_endian_swap = (fd->flags & FD_FLAGS_SWITCH_ENDIAN) != 0;
 
       fd->filesdna = DNA_sdna_from_data(
-          &bhead[1], bhead->len, do_endian_swap, true, r_error_message);
+          BHEAD_DATA(bhead), bhead->len, do_endian_swap, true, r_error_message);
       if (fd->filesdna) {
         blo_do_versions_dna(fd->filesdna, fd->fileversion, subversion);
         fd->compflags = DNA_struct_get_compareflags(fd->filesdna, fd->memsdna);
@@ -1089,7 +1184,7 @@ static int *read_file_thumbnail(FileData *fd)
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == TEST) {
       const bool do_endian_swap = (fd->flags & FD_FLAGS_SWITCH_ENDIAN) != 0;
-      int *data = (int *)(bhead + 1);
+      int *data = (int *)BHEAD_DATA(bhead);
 
       if (bhead->len < (sizeof(int[2]))) {
         break;
@@ -1378,6 +1473,10 @@ void blo_filedata_free(FileData *fd)
     }
 #endif
 
+    if (fd->id_offset_index) {
+      MEM_freeN(fd->id_offset_index);
+    }
+
     MEM_freeN(fd);
   }
 }
@@ -1825,7 +1924,7 @@ static void switch_endian_structs(const struct SDNA *filesdna, BHead *bhead)
   int blocksize, nblocks;
   char *data;
 
-  data = (char *)(bhead + 1);
+  data = (char *)BHEAD_DATA(bhead);
   blocksize = filesdna->types_size[filesdna->structs[bhead->SDNAnr]->type];
 
   nblocks = bhead->nr;
@@ -1870,14 +1969,14 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, BHEAD_DATA(bh));
       }
       else {
         /* SDNA_CMP_EQUAL */
         temp = MEM_mallocN(bh->len, blockname);
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data) {
-          memcpy(temp, (bh + 1), bh->len);
+          memcpy(temp, BHEAD_DATA(bh), bh->len);
         }
         else {
           /* Instead of allocating the bhead, then copying it,
@@ -1889,7 +1988,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
           }
         }
 #else
-        memcpy(temp, (bh + 1), bh->len);
+        memcpy(temp, BHEAD_DATA(bh), bh->len);
 #endif
       }
     }
@@ -1910,7 +2009,7 @@ static const void *peek_struct_undo(FileData *fd, BHead *bhead)
 {
   BLI_assert(fd->flags & FD_FLAGS_IS_MEMFILE);
   UNUSED_VARS_NDEBUG(fd);
-  return (bhead->len) ? (const void *)(bhead + 1) : NULL;
+  return (bhead->len) ? BHEAD_DATA(bhead) : NULL;
 }
 
 static void link_glob_list(FileData *fd, ListBase *lb) /* for glob data */
@@ -3400,8 +3499,12 @@ static BHead *read_libblock(FileData *fd,
   /* Read datablock contents.
    * Use convenient malloc name for debugging and better memory link prints. */
   const char *allocname = dataname(idcode);
+  /* Scoped per ID type, so memory read from production files can be attributed without a heap
+   * dump, see #MEM_scope_usage_foreach. */
+  MEM_scope_push(BKE_idtype_idcode_to_name(idcode));
   bhead = read_data_into_datamap(fd, bhead, allocname);
   const bool success = direct_link_id(fd, main, id_tag, id, id_old);
+  MEM_scope_pop();
   oldnewmap_clear(fd->datamap);
 
   if (!success) {
@@ -29,6 +29,14 @@ struct UserDef;
 
 typedef struct IDNameLib_Map IDNameLib_Map;
 
+/** In-memory entry of the optional ID offset index, see #BLEND_ID_INDEX_MAGIC. */
+typedef struct BlendIdIndexEntry {
+  /** Offset of the ID's #BHead in the logical (uncompressed) byte stream. */
+  uint64_t offset;
+  /** Full ID name, including the two character type prefix. */
+  char name[66]; /* #MAX_ID_NAME */
+} BlendIdIndexEntry;
+
 enum eFileDataFlag {
   FD_FLAGS_SWITCH_ENDIAN = 1 << 0,
   FD_FLAGS_FILE_POINTSIZE_IS_4 = 1 << 1,
@@ -98,6 +106,12 @@ typedef struct FileData {
   /** See: #USE_GHASH_BHEAD. */
   struct GHash *bhead_idname_hash;
 
+  /** Optional ID offset index read from the end of the file (NULL when absent). */
+  struct BlendIdIndexEntry *id_offset_index;
+  int id_offset_index_len;
+  /** True once reading the index has been attempted (it may legitimately be absent). */
+  bool id_offset_index_checked;
+
   ListBase *mainlist;
   /** Used for undo. */
   ListBase *old_mainlist;
@@ -156,6 +170,16 @@ BHead *blo_bhead_first(FileData *fd);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock);
 
+/**
+ * Read the optional ID offset index from the end of the file (see #BLEND_ID_INDEX_MAGIC),
+ * making it available in #FileData.id_offset_index.
+ *
+ * \return True when the index is available. The index may legitimately be absent
+ * (older files, undo memfiles, non-seekable sources), callers must fall back to
+ * scanning #BHead's in that case.
+ */
+bool blo_read_id_offset_index(FileData *fd);
+
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
  */
@@ -25,6 +25,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_hash_mm2a.h"
 
 #include "BLO_readfile.h"
 #include "BLO_undofile.h"
@@ -38,51 +39,114 @@
 
 /* **************** support for memory-write, for undo buffers *************** */
 
-void BLO_memfile_free(MemFile *memfile)
+/* -------------------------------------------------------------------- */
+/** \name Shared Chunk Buffers
+ *
+ * Chunk buffers are reference counted and shared across the whole undo stack.
+ * Identical content is detected in two ways:
+ * - By comparing against the matching chunk of the reference (previous) step,
+ *   which also feeds the 'unchanged ID' detection (see #MemFileChunk.is_identical).
+ * - By content hash against all buffers currently alive in the undo stack, which catches
+ *   data that matches an older step or moved to another position in the stream
+ *   (e.g. after ID re-ordering), without duplicating its memory.
+ *
+ * The reference count and hash are stored in a small header in front of the buffer data.
+ * \{ */
+
+typedef struct MemFileChunkBufHead {
+  int users;
+  uint32_t content_hash;
+  size_t size;
+} MemFileChunkBufHead;
+
+#define CHUNK_BUF_HEAD(buf) \
+  ((MemFileChunkBufHead *)POINTER_OFFSET((buf), -(int)sizeof(MemFileChunkBufHead)))
+
+#define CHUNK_HASH_SEED 0
+
+/**
+ * Maps content hash to one alive buffer with that hash (first registered wins).
+ * Only accessed from the main thread, as all undo push/free operations are.
+ */
+static GHash *memfile_buf_hash_map = NULL;
+
+static const char *memfile_buf_new(const char *data, size_t size, uint32_t hash)
 {
-  MemFileChunk *chunk;
+  MemFileChunkBufHead *head = MEM_mallocN(sizeof(*head) + size, "Chunk buffer");
+  char *buf = (char *)POINTER_OFFSET((void *)head, sizeof(*head));
 
-  while ((chunk = BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
-      MEM_freeN((void *)chunk->buf);
-    }
-    MEM_freeN(chunk);
+  head->users = 1;
+  head->content_hash = hash;
+  head->size = size;
+  memcpy(buf, data, size);
+
+  if (memfile_buf_hash_map == NULL) {
+    memfile_buf_hash_map = BLI_ghash_new(
+        BLI_ghashutil_inthash_p_simple, BLI_ghashutil_intcmp, __func__);
   }
-  memfile->size = 0;
+  void **entry;
+  if (!BLI_ghash_ensure_p(memfile_buf_hash_map, POINTER_FROM_UINT(hash), &entry)) {
+    *entry = buf;
+  }
+
+  return buf;
 }
 
-void BLO_memfile_merge(MemFile *first, MemFile *second)
+static const char *memfile_buf_ref(const char *buf)
+{
+  CHUNK_BUF_HEAD(buf)->users++;
+  return buf;
+}
+
+static void memfile_buf_unref(const char *buf)
 {
-  /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
-   * by it (i.e. shared with some previous memory steps). */
-  GHash *buffer_to_second_memchunk = BLI_ghash_new(
-      BLI_ghashutil_ptrhash, BLI_ghashutil_ptrcmp, __func__);
-
-  /* First, detect all memchunks in second memfile that are not owned by it. */
-  for (MemFileChunk *sc = second->chunks.first; sc != NULL; sc = sc->next) {
-    if (sc->is_identical) {
-      BLI_ghash_insert(buffer_to_second_memchunk, (void *)sc->buf, sc);
+  MemFileChunkBufHead *head = CHUNK_BUF_HEAD(buf);
+  BLI_assert(head->users > 0);
+  if (--head->users == 0) {
+    if (memfile_buf_hash_map != NULL &&
+        BLI_ghash_lookup(memfile_buf_hash_map, POINTER_FROM_UINT(head->content_hash)) == buf) {
+      BLI_ghash_remove(memfile_buf_hash_map, POINTER_FROM_UINT(head->content_hash), NULL, NULL);
     }
+    MEM_freeN(head);
   }
+}
 
-  /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
-   * it is also used by the second memfile, transfer the ownership. */
-  for (MemFileChunk *fc = first->chunks.first; fc != NULL; fc = fc->next) {
-    if (!fc->is_identical) {
-      MemFileChunk *sc = BLI_ghash_lookup(buffer_to_second_memchunk, fc->buf);
-      if (sc != NULL) {
-        BLI_assert(sc->is_identical);
-        sc->is_identical = false;
-        fc->is_identical = true;
-      }
-      /* Note that if the second memfile does not use that chunk, we assume that the first one
-       * fully owns it without sharing it with any other memfile, and hence it should be freed with
-       * it. */
-    }
+/**
+ * Find an alive buffer with the same content, `r_hash` is always set
+ * (so a following #memfile_buf_new doesn't have to hash again).
+ */
+static const char *memfile_buf_find_shared(const char *data, size_t size, uint32_t *r_hash)
+{
+  *r_hash = BLI_hash_mm2((const uchar *)data, size, CHUNK_HASH_SEED);
+
+  if (memfile_buf_hash_map == NULL) {
+    return NULL;
+  }
+  const char *buf = BLI_ghash_lookup(memfile_buf_hash_map, POINTER_FROM_UINT(*r_hash));
+  if (buf == NULL || CHUNK_BUF_HEAD(buf)->size != size || memcmp(buf, data, size) != 0) {
+    return NULL;
   }
+  return buf;
+}
+
+/** \} */
+
+void BLO_memfile_free(MemFile *memfile)
+{
+  MemFileChunk *chunk;
 
-  BLI_ghash_free(buffer_to_second_memchunk, NULL, NULL);
+  while ((chunk = BLI_pophead(&memfile->chunks))) {
+    memfile_buf_unref(chunk->buf);
+    MEM_freeN(chunk);
+  }
+  memfile->size = 0;
+}
 
+void BLO_memfile_merge(MemFile *first, MemFile *second)
+{
+  /* Buffers are reference counted, chunks of `second` (and any later step) that share
+   * memory with `first` simply keep it alive, so no ownership juggling is needed. */
+  UNUSED_VARS(second);
   BLO_memfile_free(first);
 }
 
@@ -155,7 +219,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     MemFileChunk *compchunk = *compchunk_step;
     if (compchunk->size == curchunk->size) {
       if (memcmp(compchunk->buf, buf, size) == 0) {
-        curchunk->buf = compchunk->buf;
+        curchunk->buf = memfile_buf_ref(compchunk->buf);
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
       }
@@ -163,15 +227,37 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     *compchunk_step = compchunk->next;
   }
 
-  /* not equal... */
+  /* Not equal to the reference chunk, but possibly equal to some other buffer in the undo
+   * stack (an older step, or another position after ID re-ordering): share that memory.
+   * Note that such a chunk is deliberately not flagged `is_identical`, that flag strictly
+   * means 'identical to the matching chunk of the previous step' for change detection. */
   if (curchunk->buf == NULL) {
-    char *buf_new = MEM_mallocN(size, "Chunk buffer");
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+    uint32_t hash;
+    const char *shared_buf = memfile_buf_find_shared(buf, size, &hash);
+    if (shared_buf != NULL) {
+      curchunk->buf = memfile_buf_ref(shared_buf);
+    }
+    else {
+      curchunk->buf = memfile_buf_new(buf, size, hash);
+      memfile->size += size;
+    }
   }
 }
 
+MemFile *BLO_memfile_snapshot(MemFile *memfile)
+{
+  MemFile *snapshot = MEM_callocN(sizeof(*snapshot), __func__);
+
+  snapshot->size = memfile->size;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    MemFileChunk *chunk_copy = MEM_dupallocN(chunk);
+    chunk_copy->buf = memfile_buf_ref(chunk->buf);
+    BLI_addtail(&snapshot->chunks, chunk_copy);
+  }
+
+  return snapshot;
+}
+
 struct Main *BLO_memfile_main_get(struct MemFile *memfile,
                                   struct Main *bmain,
                                   struct Scene **r_scene)
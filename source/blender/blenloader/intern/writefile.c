@@ -89,6 +89,7 @@
 #include "BLI_linklist.h"
 #include "BLI_math_base.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -410,9 +411,26 @@ typedef struct {
   size_t write_len;
 #endif
 
+  /** Current offset in the logical (uncompressed) byte stream, used for the ID offset index. */
+  size_t stream_len;
+  /** #IDOffsetIndexEntry list, built while writing IDs of a regular (disk) file save. */
+  ListBase id_offset_index;
+
   /** Set on unlikely case of an error (ignores further file writing). */
   bool error;
 
+  /**
+   * When true, all writes are appended to #WriteData.capture instead of going through `ww`.
+   * Used by the parallel ID writing path, where worker threads serialize each ID into a
+   * private in-memory buffer that the main thread later writes out in the original order.
+   */
+  bool use_capture;
+  struct {
+    uchar *buf;
+    size_t len;
+    size_t alloc;
+  } capture;
+
   /** #MemFile writing (used for undo). */
   MemFileWriteData mem;
   /** When true, write to #WriteData.current, could also call 'is_undo'. */
@@ -453,6 +471,24 @@ static WriteData *writedata_new(WriteWrap *ww)
   return wd;
 }
 
+/**
+ * A #WriteData that appends everything into a growing in-memory buffer.
+ * The buffer contents can later be replayed through another #WriteData with #mywrite.
+ */
+static WriteData *writedata_new_capture(void)
+{
+  WriteData *wd = MEM_callocN(sizeof(*wd), "writedata capture");
+
+  wd->sdna = DNA_sdna_current_get();
+  wd->use_capture = true;
+
+  wd->buffer.max_size = MEM_BUFFER_SIZE;
+  wd->buffer.chunk_size = MEM_CHUNK_SIZE;
+  wd->buffer.buf = MEM_mallocN(wd->buffer.max_size, "wd->buffer.buf");
+
+  return wd;
+}
+
 static void writedata_do_write(WriteData *wd, const void *mem, size_t memlen)
 {
   if ((wd == NULL) || wd->error || (mem == NULL) || memlen < 1) {
@@ -472,6 +508,14 @@ static void writedata_do_write(WriteData *wd, const void *mem, size_t memlen)
   if (wd->use_memfile) {
     BLO_memfile_chunk_add(&wd->mem, mem, memlen);
   }
+  else if (wd->use_capture) {
+    if (wd->capture.len + memlen > wd->capture.alloc) {
+      wd->capture.alloc = MAX2(wd->capture.alloc * 2, wd->capture.len + memlen);
+      wd->capture.buf = MEM_reallocN_id(wd->capture.buf, wd->capture.alloc, "wd->capture.buf");
+    }
+    memcpy(wd->capture.buf + wd->capture.len, mem, memlen);
+    wd->capture.len += memlen;
+  }
   else {
     if (wd->ww->write(wd->ww, mem, memlen) != memlen) {
       wd->error = true;
@@ -484,6 +528,9 @@ static void writedata_free(WriteData *wd)
   if (wd->buffer.buf) {
     MEM_freeN(wd->buffer.buf);
   }
+  if (wd->capture.buf) {
+    MEM_freeN(wd->capture.buf);
+  }
   MEM_freeN(wd);
 }
 
@@ -524,6 +571,7 @@ static void mywrite(WriteData *wd, const void *adr, size_t len)
 #ifdef USE_WRITE_DATA_LEN
   wd->write_len += len;
 #endif
+  wd->stream_len += len;
 
   if (wd->buffer.buf == NULL) {
     writedata_do_write(wd, adr, len);
@@ -1070,6 +1118,128 @@ static void write_thumb(WriteData *wd, const BlendThumbnail *thumb)
 /** \name File Writing (Private)
  * \{ */
 
+#define ID_BUFFER_STATIC_SIZE 8192
+
+/**
+ * Prepare the shallow copy of an ID that gets serialized in place of the original:
+ * clear runtime data, both to avoid writing meaningless values and to reduce false
+ * detection of changed data in undo/redo context.
+ */
+static void write_id_buffer_prepare(void *id_buffer, const ID *id, const size_t struct_size)
+{
+  memcpy(id_buffer, id, struct_size);
+
+  ((ID *)id_buffer)->tag = 0;
+  ((ID *)id_buffer)->us = 0;
+  ((ID *)id_buffer)->icon_id = 0;
+  /* Those listbase data change every time we add/remove an ID, and also often when
+   * renaming one (due to re-sorting). This avoids generating a lot of false 'is changed'
+   * detections between undo steps. */
+  ((ID *)id_buffer)->prev = NULL;
+  ((ID *)id_buffer)->next = NULL;
+  /* Those runtime pointers should never be set during writing stage, but just in case clear
+   * them too. */
+  ((ID *)id_buffer)->orig_id = NULL;
+  ((ID *)id_buffer)->newid = NULL;
+  /* Even though in theory we could be able to preserve this python instance across undo even
+   * when we need to re-read the ID into its original address, this is currently cleared in
+   * #direct_link_id_common in `readfile.c` anyway, */
+  ((ID *)id_buffer)->py_instance = NULL;
+}
+
+/**
+ * Parallel writing of IDs for regular (disk) file saving.
+ *
+ * Each ID is serialized by a worker thread into a private capture #WriteData
+ * (DNA flattening is the main single-threaded cost of saving, compression is
+ * already threaded by the zstd #WriteWrap). The main thread then replays the
+ * capture buffers in the original ID order, so the resulting byte stream is
+ * identical to a sequential write.
+ *
+ * Undo (memfile) writing stays sequential, since it depends on stateful
+ * per-chunk deduplication against the previous undo step.
+ */
+typedef struct IDWriteTask {
+  struct IDWriteTask *next, *prev;
+
+  ID *id;
+  /** Shallow copy of the ID with runtime data cleared, prepared on the main thread. */
+  void *id_buffer;
+  /** Capture buffer receiving the serialized result. */
+  WriteData *wd;
+} IDWriteTask;
+
+static void write_id_task_run(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  IDWriteTask *task = taskdata;
+  WriteData *wd = task->wd;
+  BlendWriter writer = {wd};
+
+  const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(task->id);
+  if (id_type->blend_write != NULL) {
+    id_type->blend_write(&writer, (ID *)task->id_buffer, task->id);
+  }
+
+  mywrite_flush(wd);
+}
+
+/** In-memory entry of the ID offset index, see #BLEND_ID_INDEX_MAGIC. */
+typedef struct IDOffsetIndexEntry {
+  struct IDOffsetIndexEntry *next, *prev;
+
+  uint64_t offset;
+  char name[MAX_ID_NAME];
+} IDOffsetIndexEntry;
+
+static void id_offset_index_entry_add(WriteData *wd, const char *name)
+{
+  IDOffsetIndexEntry *entry = MEM_callocN(sizeof(*entry), "IDOffsetIndexEntry");
+  entry->offset = wd->stream_len;
+  BLI_strncpy(entry->name, name, sizeof(entry->name));
+  BLI_addtail(&wd->id_offset_index, entry);
+}
+
+/**
+ * Append the ID offset index and its footer after the #ENDB block,
+ * see #BLEND_ID_INDEX_MAGIC for the format description.
+ */
+static void write_id_offset_index(WriteData *wd)
+{
+  BLI_STATIC_ASSERT(sizeof(((IDOffsetIndexEntry *)NULL)->name) == BLEND_ID_INDEX_NAME_SIZE,
+                    "ID offset index entry size mismatch")
+
+  uint32_t count = 0;
+  LISTBASE_FOREACH (IDOffsetIndexEntry *, entry, &wd->id_offset_index) {
+    mywrite(wd, &entry->offset, sizeof(entry->offset));
+    mywrite(wd, entry->name, sizeof(entry->name));
+    count++;
+  }
+
+  const uint32_t entry_size = BLEND_ID_INDEX_ENTRY_SIZE;
+  mywrite(wd, &count, sizeof(count));
+  mywrite(wd, &entry_size, sizeof(entry_size));
+  mywrite(wd, BLEND_ID_INDEX_MAGIC, BLEND_ID_INDEX_MAGIC_SIZE);
+
+  BLI_freelistN(&wd->id_offset_index);
+}
+
+static void write_id_tasks_finish(WriteData *wd, ListBase *tasks)
+{
+  LISTBASE_FOREACH_MUTABLE (IDWriteTask *, task, tasks) {
+    if (task->wd->error) {
+      wd->error = true;
+    }
+    else if (task->wd->capture.len != 0) {
+      id_offset_index_entry_add(wd, task->id->name);
+      mywrite(wd, task->wd->capture.buf, task->wd->capture.len);
+    }
+    writedata_free(task->wd);
+    MEM_freeN(task->id_buffer);
+    MEM_freeN(task);
+  }
+  BLI_listbase_clear(tasks);
+}
+
 /* if MemFile * there's filesave to memory */
 static bool write_file_handle(Main *mainvar,
                               WriteWrap *ww,
@@ -1109,7 +1279,14 @@ static bool write_file_handle(Main *mainvar,
                                                  NULL :
                                                  BKE_lib_override_library_operations_store_init();
 
-#define ID_BUFFER_STATIC_SIZE 8192
+  /* Serialize IDs on worker threads when writing to disk, see #IDWriteTask.
+   * Undo writing requires sequential, stateful deduplication and is excluded. */
+  const bool use_parallel_id_write = (ww != NULL) && !wd->use_memfile;
+  TaskPool *id_write_pool = use_parallel_id_write ?
+                                BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH) :
+                                NULL;
+  ListBase id_write_tasks = {NULL, NULL};
+
   /* This outer loop allows to save first data-blocks from real mainvar,
    * then the temp ones from override process,
    * if needed, without duplicating whole code. */
@@ -1149,6 +1326,28 @@ static bool write_file_handle(Main *mainvar,
         const bool do_override = !ELEM(override_storage, NULL, bmain) &&
                                  ID_IS_OVERRIDE_LIBRARY_REAL(id);
 
+        if (use_parallel_id_write) {
+          IDWriteTask *task = MEM_callocN(sizeof(*task), __func__);
+          task->id = id;
+          task->id_buffer = MEM_mallocN(idtype_struct_size, __func__);
+          task->wd = writedata_new_capture();
+          BLI_addtail(&id_write_tasks, task);
+
+          if (do_override) {
+            /* Override operations mutate the ID around its write, keep those on the main
+             * thread and serialize the ID immediately. */
+            BKE_lib_override_library_operations_store_start(bmain, override_storage, id);
+            write_id_buffer_prepare(task->id_buffer, id, idtype_struct_size);
+            write_id_task_run(NULL, task);
+            BKE_lib_override_library_operations_store_end(override_storage, id);
+          }
+          else {
+            write_id_buffer_prepare(task->id_buffer, id, idtype_struct_size);
+            BLI_task_pool_push(id_write_pool, write_id_task_run, task, false, NULL);
+          }
+          continue;
+        }
+
         if (do_override) {
           BKE_lib_override_library_operations_store_start(bmain, override_storage, id);
         }
@@ -1177,25 +1376,7 @@ static bool write_file_handle(Main *mainvar,
 
         mywrite_id_begin(wd, id);
 
-        memcpy(id_buffer, id, idtype_struct_size);
-
-        /* Clear runtime data to reduce false detection of changed data in undo/redo context. */
-        ((ID *)id_buffer)->tag = 0;
-        ((ID *)id_buffer)->us = 0;
-        ((ID *)id_buffer)->icon_id = 0;
-        /* Those listbase data change every time we add/remove an ID, and also often when
-         * renaming one (due to re-sorting). This avoids generating a lot of false 'is changed'
-         * detections between undo steps. */
-        ((ID *)id_buffer)->prev = NULL;
-        ((ID *)id_buffer)->next = NULL;
-        /* Those runtime pointers should never be set during writing stage, but just in case clear
-         * them too. */
-        ((ID *)id_buffer)->orig_id = NULL;
-        ((ID *)id_buffer)->newid = NULL;
-        /* Even though in theory we could be able to preserve this python instance across undo even
-         * when we need to re-read the ID into its original address, this is currently cleared in
-         * #direct_link_id_common in `readfile.c` anyway, */
-        ((ID *)id_buffer)->py_instance = NULL;
+        write_id_buffer_prepare(id_buffer, id, idtype_struct_size);
 
         const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
         if (id_type->blend_write != NULL) {
@@ -1213,10 +1394,21 @@ static bool write_file_handle(Main *mainvar,
         MEM_SAFE_FREE(id_buffer);
       }
 
+      if (use_parallel_id_write) {
+        /* Write out the per-ID buffers of this ID type in their original order, so the
+         * resulting byte stream matches what a sequential write would have produced. */
+        BLI_task_pool_work_and_wait(id_write_pool);
+        write_id_tasks_finish(wd, &id_write_tasks);
+      }
+
       mywrite_flush(wd);
     }
   } while ((bmain != override_storage) && (bmain = override_storage));
 
+  if (id_write_pool != NULL) {
+    BLI_task_pool_free(id_write_pool);
+  }
+
   if (override_storage) {
     BKE_lib_override_library_operations_store_finalize(override_storage);
     override_storage = NULL;
@@ -1236,6 +1428,10 @@ static bool write_file_handle(Main *mainvar,
    *
    * Note that we *borrow* the pointer to 'DNAstr',
    * so writing each time uses the same address and doesn't cause unnecessary undo overhead. */
+  if (use_parallel_id_write) {
+    /* Index the DNA block too, so index-aware readers can decode structs without scanning. */
+    id_offset_index_entry_add(wd, "DNA1");
+  }
   writedata(wd, DNA1, (size_t)wd->sdna->data_len, wd->sdna->data);
 
   /* end of file */
@@ -1243,6 +1439,11 @@ static bool write_file_handle(Main *mainvar,
   bhead.code = ENDB;
   mywrite(wd, &bhead, sizeof(BHead));
 
+  /* The ID offset index goes after ENDB, older readers stop there and ignore it. */
+  if (use_parallel_id_write) {
+    write_id_offset_index(wd);
+  }
+
   blo_join_main(&mainlist);
 
   return mywrite_end(wd);
@@ -13,6 +13,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_customdata.h"
@@ -329,6 +330,87 @@ void bmesh_edit_end(BMesh *bm, BMOpTypeFlag type_flag)
   }
 }
 
+typedef struct BMElemIndexEnsureData {
+  BMesh *bm;
+  const int *elem_offset;
+  bool update_face;
+  bool update_loop;
+} BMElemIndexEnsureData;
+
+static void bm_mesh_elem_index_ensure_verts(BMElemIndexEnsureData *data)
+{
+  BMesh *bm = data->bm;
+  BMIter iter;
+  BMElem *ele;
+
+  int index = data->elem_offset ? data->elem_offset[0] : 0;
+  BM_ITER_MESH (ele, &iter, bm, BM_VERTS_OF_MESH) {
+    BM_elem_index_set(ele, index++); /* set_ok */
+  }
+  BLI_assert(data->elem_offset || index == bm->totvert);
+  UNUSED_VARS_NDEBUG(index);
+}
+
+static void bm_mesh_elem_index_ensure_edges(BMElemIndexEnsureData *data)
+{
+  BMesh *bm = data->bm;
+  BMIter iter;
+  BMElem *ele;
+
+  int index = data->elem_offset ? data->elem_offset[1] : 0;
+  BM_ITER_MESH (ele, &iter, bm, BM_EDGES_OF_MESH) {
+    BM_elem_index_set(ele, index++); /* set_ok */
+  }
+  BLI_assert(data->elem_offset || index == bm->totedge);
+  UNUSED_VARS_NDEBUG(index);
+}
+
+static void bm_mesh_elem_index_ensure_faces(BMElemIndexEnsureData *data)
+{
+  BMesh *bm = data->bm;
+  BMIter iter;
+  BMElem *ele;
+
+  int index_loop = data->elem_offset ? data->elem_offset[2] : 0;
+  int index = data->elem_offset ? data->elem_offset[3] : 0;
+
+  BM_ITER_MESH (ele, &iter, bm, BM_FACES_OF_MESH) {
+    if (data->update_face) {
+      BM_elem_index_set(ele, index++); /* set_ok */
+    }
+
+    if (data->update_loop) {
+      BMLoop *l_iter, *l_first;
+
+      l_iter = l_first = BM_FACE_FIRST_LOOP((BMFace *)ele);
+      do {
+        BM_elem_index_set(l_iter, index_loop++); /* set_ok */
+      } while ((l_iter = l_iter->next) != l_first);
+    }
+  }
+
+  BLI_assert(data->elem_offset || !data->update_face || index == bm->totface);
+  if (data->update_loop) {
+    BLI_assert(data->elem_offset || index_loop == bm->totloop);
+  }
+  UNUSED_VARS_NDEBUG(index, index_loop);
+}
+
+static void bm_mesh_elem_index_ensure_verts_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bm_mesh_elem_index_ensure_verts(BLI_task_pool_user_data(pool));
+}
+
+static void bm_mesh_elem_index_ensure_edges_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bm_mesh_elem_index_ensure_edges(BLI_task_pool_user_data(pool));
+}
+
+static void bm_mesh_elem_index_ensure_faces_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bm_mesh_elem_index_ensure_faces(BLI_task_pool_user_data(pool));
+}
+
 void BM_mesh_elem_index_ensure_ex(BMesh *bm, const char htype, int elem_offset[4])
 {
 
@@ -344,72 +426,48 @@ void BM_mesh_elem_index_ensure_ex(BMesh *bm, const char htype, int elem_offset[4
     }
   }
 
-  if (htype & BM_VERT) {
-    if ((bm->elem_index_dirty & BM_VERT) || (elem_offset && elem_offset[0])) {
-      BMIter iter;
-      BMElem *ele;
-
-      int index = elem_offset ? elem_offset[0] : 0;
-      BM_ITER_MESH (ele, &iter, bm, BM_VERTS_OF_MESH) {
-        BM_elem_index_set(ele, index++); /* set_ok */
-      }
-      BLI_assert(elem_offset || index == bm->totvert);
+  const bool update_vert = (htype & BM_VERT) &&
+                           ((bm->elem_index_dirty & BM_VERT) || (elem_offset && elem_offset[0]));
+  const bool update_edge = (htype & BM_EDGE) &&
+                           ((bm->elem_index_dirty & BM_EDGE) || (elem_offset && elem_offset[1]));
+  const bool update_face_or_loop = (htype & (BM_FACE | BM_LOOP)) &&
+                                   ((bm->elem_index_dirty & (BM_FACE | BM_LOOP)) ||
+                                    (elem_offset && (elem_offset[2] || elem_offset[3])));
+
+  BMElemIndexEnsureData data = {
+      .bm = bm,
+      .elem_offset = elem_offset,
+      .update_face = (htype & BM_FACE) && (bm->elem_index_dirty & BM_FACE),
+      .update_loop = (htype & BM_LOOP) && (bm->elem_index_dirty & BM_LOOP),
+  };
+
+  /* Each pass walks its own mempool and only writes indices of its own element types, so the
+   * passes are independent. Each walk is latency-bound (elements are visited through pointer
+   * chains), so overlapping them hides a good part of that latency on large meshes. */
+  if ((update_vert + update_edge + update_face_or_loop) > 1 &&
+      (bm->totvert + bm->totedge + bm->totloop) >= BM_OMP_LIMIT) {
+    TaskPool *task_pool = BLI_task_pool_create(&data, TASK_PRIORITY_HIGH);
+    if (update_vert) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_index_ensure_verts_fn, NULL, false, NULL);
     }
-    else {
-      // printf("%s: skipping vert index calc!\n", __func__);
+    if (update_edge) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_index_ensure_edges_fn, NULL, false, NULL);
     }
-  }
-
-  if (htype & BM_EDGE) {
-    if ((bm->elem_index_dirty & BM_EDGE) || (elem_offset && elem_offset[1])) {
-      BMIter iter;
-      BMElem *ele;
-
-      int index = elem_offset ? elem_offset[1] : 0;
-      BM_ITER_MESH (ele, &iter, bm, BM_EDGES_OF_MESH) {
-        BM_elem_index_set(ele, index++); /* set_ok */
-      }
-      BLI_assert(elem_offset || index == bm->totedge);
-    }
-    else {
-      // printf("%s: skipping edge index calc!\n", __func__);
+    if (update_face_or_loop) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_index_ensure_faces_fn, NULL, false, NULL);
     }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
   }
-
-  if (htype & (BM_FACE | BM_LOOP)) {
-    if ((bm->elem_index_dirty & (BM_FACE | BM_LOOP)) ||
-        (elem_offset && (elem_offset[2] || elem_offset[3]))) {
-      BMIter iter;
-      BMElem *ele;
-
-      const bool update_face = (htype & BM_FACE) && (bm->elem_index_dirty & BM_FACE);
-      const bool update_loop = (htype & BM_LOOP) && (bm->elem_index_dirty & BM_LOOP);
-
-      int index_loop = elem_offset ? elem_offset[2] : 0;
-      int index = elem_offset ? elem_offset[3] : 0;
-
-      BM_ITER_MESH (ele, &iter, bm, BM_FACES_OF_MESH) {
-        if (update_face) {
-          BM_elem_index_set(ele, index++); /* set_ok */
-        }
-
-        if (update_loop) {
-          BMLoop *l_iter, *l_first;
-
-          l_iter = l_first = BM_FACE_FIRST_LOOP((BMFace *)ele);
-          do {
-            BM_elem_index_set(l_iter, index_loop++); /* set_ok */
-          } while ((l_iter = l_iter->next) != l_first);
-        }
-      }
-
-      BLI_assert(elem_offset || !update_face || index == bm->totface);
-      if (update_loop) {
-        BLI_assert(elem_offset || !update_loop || index_loop == bm->totloop);
-      }
+  else {
+    if (update_vert) {
+      bm_mesh_elem_index_ensure_verts(&data);
     }
-    else {
-      // printf("%s: skipping face/loop index calc!\n", __func__);
+    if (update_edge) {
+      bm_mesh_elem_index_ensure_edges(&data);
+    }
+    if (update_face_or_loop) {
+      bm_mesh_elem_index_ensure_faces(&data);
     }
   }
 
@@ -555,6 +613,24 @@ bool BM_mesh_elem_table_check(BMesh *bm)
 }
 #endif
 
+static void bm_mesh_elem_table_verts_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  BMesh *bm = BLI_task_pool_user_data(pool);
+  BM_iter_as_array(bm, BM_VERTS_OF_MESH, NULL, (void **)bm->vtable, bm->totvert);
+}
+
+static void bm_mesh_elem_table_edges_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  BMesh *bm = BLI_task_pool_user_data(pool);
+  BM_iter_as_array(bm, BM_EDGES_OF_MESH, NULL, (void **)bm->etable, bm->totedge);
+}
+
+static void bm_mesh_elem_table_faces_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  BMesh *bm = BLI_task_pool_user_data(pool);
+  BM_iter_as_array(bm, BM_FACES_OF_MESH, NULL, (void **)bm->ftable, bm->totface);
+}
+
 void BM_mesh_elem_table_ensure(BMesh *bm, const char htype)
 {
   /* assume if the array is non-null then its valid and no need to recalc */
@@ -610,16 +686,36 @@ void BM_mesh_elem_table_ensure(BMesh *bm, const char htype)
     }
   }
 
-  if (htype_needed & BM_VERT) {
-    BM_iter_as_array(bm, BM_VERTS_OF_MESH, NULL, (void **)bm->vtable, bm->totvert);
+  /* The table fills are independent latency-bound walks over the element mempools,
+   * so overlap them for large meshes, compare #BM_mesh_elem_index_ensure_ex. */
+  const int htype_needed_num = (((htype_needed & BM_VERT) != 0) + ((htype_needed & BM_EDGE) != 0) +
+                                ((htype_needed & BM_FACE) != 0));
+  if ((htype_needed_num > 1) && ((bm->totvert + bm->totedge + bm->totface) >= BM_OMP_LIMIT)) {
+    TaskPool *task_pool = BLI_task_pool_create(bm, TASK_PRIORITY_HIGH);
+    if (htype_needed & BM_VERT) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_table_verts_fn, NULL, false, NULL);
+    }
+    if (htype_needed & BM_EDGE) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_table_edges_fn, NULL, false, NULL);
+    }
+    if (htype_needed & BM_FACE) {
+      BLI_task_pool_push(task_pool, bm_mesh_elem_table_faces_fn, NULL, false, NULL);
+    }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
   }
+  else {
+    if (htype_needed & BM_VERT) {
+      BM_iter_as_array(bm, BM_VERTS_OF_MESH, NULL, (void **)bm->vtable, bm->totvert);
+    }
 
-  if (htype_needed & BM_EDGE) {
-    BM_iter_as_array(bm, BM_EDGES_OF_MESH, NULL, (void **)bm->etable, bm->totedge);
-  }
+    if (htype_needed & BM_EDGE) {
+      BM_iter_as_array(bm, BM_EDGES_OF_MESH, NULL, (void **)bm->etable, bm->totedge);
+    }
 
-  if (htype_needed & BM_FACE) {
-    BM_iter_as_array(bm, BM_FACES_OF_MESH, NULL, (void **)bm->ftable, bm->totface);
+    if (htype_needed & BM_FACE) {
+      BM_iter_as_array(bm, BM_FACES_OF_MESH, NULL, (void **)bm->ftable, bm->totface);
+    }
   }
 
 finally:
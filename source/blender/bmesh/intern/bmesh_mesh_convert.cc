@@ -70,6 +70,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_mesh.h"
@@ -1047,15 +1048,10 @@ void BM_mesh_bm_to_me_for_eval(BMesh *bm, Mesh *me, const CustomData_MeshMasks *
 
   BKE_mesh_update_customdata_pointers(me, false);
 
-  BMIter iter;
-  BMVert *eve;
-  BMEdge *eed;
-  BMFace *efa;
   MVert *mvert = me->mvert;
   MEdge *medge = me->medge;
   MLoop *mloop = me->mloop;
   MPoly *mpoly = me->mpoly;
-  unsigned int i, j;
 
   const int cd_vert_bweight_offset = CustomData_get_offset(&bm->vdata, CD_BWEIGHT);
   const int cd_edge_bweight_offset = CustomData_get_offset(&bm->edata, CD_BWEIGHT);
@@ -1065,79 +1061,101 @@ void BM_mesh_bm_to_me_for_eval(BMesh *bm, Mesh *me, const CustomData_MeshMasks *
 
   me->runtime.deformed_only = true;
 
-  BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-    MVert *mv = &mvert[i];
+  /* This function is a hot path of edit-mode evaluation (it runs per depsgraph evaluation while
+   * tweak-dragging). The element tables match the iteration order that used to assign the
+   * indices here, and give every task direct access to its slice of elements, so the per-element
+   * conversion can run in parallel. The passes stay ordered: edges read the vertex indices
+   * assigned by the vertex pass, faces read vertex and edge indices. */
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
 
-    copy_v3_v3(mv->co, eve->co);
+  blender::threading::parallel_for(IndexRange(bm->totvert), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      BMVert *eve = bm->vtable[i];
+      MVert *mv = &mvert[i];
 
-    BM_elem_index_set(eve, i); /* set_inline */
+      copy_v3_v3(mv->co, eve->co);
 
-    mv->flag = BM_vert_flag_to_mflag(eve);
+      BM_elem_index_set(eve, i); /* set_inline */
 
-    if (cd_vert_bweight_offset != -1) {
-      mv->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eve, cd_vert_bweight_offset);
-    }
+      mv->flag = BM_vert_flag_to_mflag(eve);
 
-    CustomData_from_bmesh_block(&bm->vdata, &me->vdata, eve->head.data, i);
-  }
+      if (cd_vert_bweight_offset != -1) {
+        mv->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eve, cd_vert_bweight_offset);
+      }
+
+      CustomData_from_bmesh_block(&bm->vdata, &me->vdata, eve->head.data, i);
+    }
+  });
   bm->elem_index_dirty &= ~BM_VERT;
 
-  BM_ITER_MESH_INDEX (eed, &iter, bm, BM_EDGES_OF_MESH, i) {
-    MEdge *med = &medge[i];
+  blender::threading::parallel_for(IndexRange(bm->totedge), 2048, [&](IndexRange range) {
+    for (const int i : range) {
+      BMEdge *eed = bm->etable[i];
+      MEdge *med = &medge[i];
 
-    BM_elem_index_set(eed, i); /* set_inline */
+      BM_elem_index_set(eed, i); /* set_inline */
 
-    med->v1 = BM_elem_index_get(eed->v1);
-    med->v2 = BM_elem_index_get(eed->v2);
+      med->v1 = BM_elem_index_get(eed->v1);
+      med->v2 = BM_elem_index_get(eed->v2);
 
-    med->flag = BM_edge_flag_to_mflag(eed);
+      med->flag = BM_edge_flag_to_mflag(eed);
 
-    /* Handle this differently to editmode switching,
-     * only enable draw for single user edges rather than calculating angle. */
-    if ((med->flag & ME_EDGEDRAW) == 0) {
-      if (eed->l && eed->l == eed->l->radial_next) {
-        med->flag |= ME_EDGEDRAW;
+      /* Handle this differently to editmode switching,
+       * only enable draw for single user edges rather than calculating angle. */
+      if ((med->flag & ME_EDGEDRAW) == 0) {
+        if (eed->l && eed->l == eed->l->radial_next) {
+          med->flag |= ME_EDGEDRAW;
+        }
       }
-    }
 
-    if (cd_edge_crease_offset != -1) {
-      med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_crease_offset);
-    }
-    if (cd_edge_bweight_offset != -1) {
-      med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_bweight_offset);
+      if (cd_edge_crease_offset != -1) {
+        med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_crease_offset);
+      }
+      if (cd_edge_bweight_offset != -1) {
+        med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_bweight_offset);
+      }
+
+      CustomData_from_bmesh_block(&bm->edata, &me->edata, eed->head.data, i);
     }
+  });
+  bm->elem_index_dirty &= ~BM_EDGE;
 
-    CustomData_from_bmesh_block(&bm->edata, &me->edata, eed->head.data, i);
+  /* The loop-starts are a running sum over the face lengths, keep this pass serial. */
+  int loopstart = 0;
+  for (int i = 0; i < bm->totface; i++) {
+    mpoly[i].loopstart = loopstart;
+    loopstart += bm->ftable[i]->len;
   }
-  bm->elem_index_dirty &= ~BM_EDGE;
 
-  j = 0;
-  BM_ITER_MESH_INDEX (efa, &iter, bm, BM_FACES_OF_MESH, i) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
-    MPoly *mp = &mpoly[i];
+  blender::threading::parallel_for(IndexRange(bm->totface), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMFace *efa = bm->ftable[i];
+      MPoly *mp = &mpoly[i];
 
-    BM_elem_index_set(efa, i); /* set_inline */
+      BM_elem_index_set(efa, i); /* set_inline */
 
-    mp->totloop = efa->len;
-    mp->flag = BM_face_flag_to_mflag(efa);
-    mp->loopstart = j;
-    mp->mat_nr = efa->mat_nr;
+      mp->totloop = efa->len;
+      mp->flag = BM_face_flag_to_mflag(efa);
+      mp->mat_nr = efa->mat_nr;
 
-    l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
-    do {
-      mloop->v = BM_elem_index_get(l_iter->v);
-      mloop->e = BM_elem_index_get(l_iter->e);
-      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
+      int j = mp->loopstart;
+      MLoop *ml = &mloop[j];
+      BMLoop *l_iter, *l_first;
+      l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
+      do {
+        ml->v = BM_elem_index_get(l_iter->v);
+        ml->e = BM_elem_index_get(l_iter->e);
+        CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
 
-      BM_elem_index_set(l_iter, j); /* set_inline */
+        BM_elem_index_set(l_iter, j); /* set_inline */
 
-      j++;
-      mloop++;
-    } while ((l_iter = l_iter->next) != l_first);
+        j++;
+        ml++;
+      } while ((l_iter = l_iter->next) != l_first);
 
-    CustomData_from_bmesh_block(&bm->pdata, &me->pdata, efa->head.data, i);
-  }
+      CustomData_from_bmesh_block(&bm->pdata, &me->pdata, efa->head.data, i);
+    }
+  });
   bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP);
 
   me->cd_flag = BM_mesh_cd_flag_from_bmesh(bm);
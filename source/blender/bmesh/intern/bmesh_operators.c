@@ -13,6 +13,7 @@
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -1164,6 +1165,107 @@ void BMO_slot_buffer_flag_disable(BMesh *bm,
  * all operators have been executed. This would
  * save a lot of realloc potentially.
  */
+typedef struct BMOFlagLayerCopyData {
+  BMesh *bm;
+  /** Bytes of flag layers to copy per element into the newly allocated flags. */
+  size_t flags_size;
+  /** Zero the newly added layer (only when growing, see #bmo_flag_layer_alloc). */
+  bool use_calloc;
+} BMOFlagLayerCopyData;
+
+static void bmo_flag_layer_copy_verts(BMOFlagLayerCopyData *data)
+{
+  BMesh *bm = data->bm;
+  BLI_mempool *newpool = bm->vtoolflagpool;
+  BMIter iter;
+  BMVert_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_VERTS_OF_MESH, i) {
+    void *oldflags = ele->oflags;
+    ele->oflags = data->use_calloc ? BLI_mempool_calloc(newpool) : BLI_mempool_alloc(newpool);
+    memcpy(ele->oflags, oldflags, data->flags_size);
+    BM_elem_index_set(&ele->base, i); /* set_inline */
+    BM_ELEM_API_FLAG_CLEAR((BMElemF *)ele);
+  }
+}
+
+static void bmo_flag_layer_copy_edges(BMOFlagLayerCopyData *data)
+{
+  BMesh *bm = data->bm;
+  BLI_mempool *newpool = bm->etoolflagpool;
+  BMIter iter;
+  BMEdge_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_EDGES_OF_MESH, i) {
+    void *oldflags = ele->oflags;
+    ele->oflags = data->use_calloc ? BLI_mempool_calloc(newpool) : BLI_mempool_alloc(newpool);
+    memcpy(ele->oflags, oldflags, data->flags_size);
+    BM_elem_index_set(&ele->base, i); /* set_inline */
+    BM_ELEM_API_FLAG_CLEAR((BMElemF *)ele);
+  }
+}
+
+static void bmo_flag_layer_copy_faces(BMOFlagLayerCopyData *data)
+{
+  BMesh *bm = data->bm;
+  BLI_mempool *newpool = bm->ftoolflagpool;
+  BMIter iter;
+  BMFace_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_FACES_OF_MESH, i) {
+    void *oldflags = ele->oflags;
+    ele->oflags = data->use_calloc ? BLI_mempool_calloc(newpool) : BLI_mempool_alloc(newpool);
+    memcpy(ele->oflags, oldflags, data->flags_size);
+    BM_elem_index_set(&ele->base, i); /* set_inline */
+    BM_ELEM_API_FLAG_CLEAR((BMElemF *)ele);
+  }
+}
+
+static void bmo_flag_layer_copy_verts_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_copy_verts(BLI_task_pool_user_data(pool));
+}
+
+static void bmo_flag_layer_copy_edges_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_copy_edges(BLI_task_pool_user_data(pool));
+}
+
+static void bmo_flag_layer_copy_faces_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_copy_faces(BLI_task_pool_user_data(pool));
+}
+
+/**
+ * Each pass allocates from its own new flag pool and only touches its own element type,
+ * so the vert/edge/face passes can run concurrently for large meshes,
+ * compare #BM_mesh_elem_index_ensure_ex.
+ */
+static void bmo_flag_layer_copy_all(BMesh *bm, const size_t flags_size, const bool use_calloc)
+{
+  BMOFlagLayerCopyData data = {
+      .bm = bm,
+      .flags_size = flags_size,
+      .use_calloc = use_calloc,
+  };
+
+  if ((bm->totvert + bm->totedge + bm->totface) >= BM_OMP_LIMIT) {
+    TaskPool *task_pool = BLI_task_pool_create(&data, TASK_PRIORITY_HIGH);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_copy_verts_fn, NULL, false, NULL);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_copy_edges_fn, NULL, false, NULL);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_copy_faces_fn, NULL, false, NULL);
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
+  }
+  else {
+    bmo_flag_layer_copy_verts(&data);
+    bmo_flag_layer_copy_edges(&data);
+    bmo_flag_layer_copy_faces(&data);
+  }
+
+  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
+}
+
 static void bmo_flag_layer_alloc(BMesh *bm)
 {
   /* set the index values since we are looping over all data anyway,
@@ -1186,44 +1288,11 @@ static void bmo_flag_layer_alloc(BMesh *bm)
       sizeof(BMFlagLayer) * bm->totflags, bm->totface, 512, BLI_MEMPOOL_NOP);
 
   /* now go through and memcpy all the flags. Loops don't get a flag layer at this time. */
-  BMIter iter;
-  int i;
-
-  BMVert_OFlag *v_oflag;
-  BLI_mempool *newpool = bm->vtoolflagpool;
-  BM_ITER_MESH_INDEX (v_oflag, &iter, bm, BM_VERTS_OF_MESH, i) {
-    void *oldflags = v_oflag->oflags;
-    v_oflag->oflags = BLI_mempool_calloc(newpool);
-    memcpy(v_oflag->oflags, oldflags, old_totflags_size);
-    BM_elem_index_set(&v_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)v_oflag);
-  }
-
-  BMEdge_OFlag *e_oflag;
-  newpool = bm->etoolflagpool;
-  BM_ITER_MESH_INDEX (e_oflag, &iter, bm, BM_EDGES_OF_MESH, i) {
-    void *oldflags = e_oflag->oflags;
-    e_oflag->oflags = BLI_mempool_calloc(newpool);
-    memcpy(e_oflag->oflags, oldflags, old_totflags_size);
-    BM_elem_index_set(&e_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)e_oflag);
-  }
-
-  BMFace_OFlag *f_oflag;
-  newpool = bm->ftoolflagpool;
-  BM_ITER_MESH_INDEX (f_oflag, &iter, bm, BM_FACES_OF_MESH, i) {
-    void *oldflags = f_oflag->oflags;
-    f_oflag->oflags = BLI_mempool_calloc(newpool);
-    memcpy(f_oflag->oflags, oldflags, old_totflags_size);
-    BM_elem_index_set(&f_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)f_oflag);
-  }
+  bmo_flag_layer_copy_all(bm, old_totflags_size, true);
 
   BLI_mempool_destroy(voldpool);
   BLI_mempool_destroy(eoldpool);
   BLI_mempool_destroy(foldpool);
-
-  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
 }
 
 static void bmo_flag_layer_free(BMesh *bm)
@@ -1246,81 +1315,83 @@ static void bmo_flag_layer_free(BMesh *bm)
   bm->ftoolflagpool = BLI_mempool_create(new_totflags_size, bm->totface, 512, BLI_MEMPOOL_NOP);
 
   /* now go through and memcpy all the flag */
-  BMIter iter;
-  int i;
-
-  BMVert_OFlag *v_oflag;
-  BLI_mempool *newpool = bm->vtoolflagpool;
-  BM_ITER_MESH_INDEX (v_oflag, &iter, bm, BM_VERTS_OF_MESH, i) {
-    void *oldflags = v_oflag->oflags;
-    v_oflag->oflags = BLI_mempool_alloc(newpool);
-    memcpy(v_oflag->oflags, oldflags, new_totflags_size);
-    BM_elem_index_set(&v_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)v_oflag);
-  }
-
-  BMEdge_OFlag *e_oflag;
-  newpool = bm->etoolflagpool;
-  BM_ITER_MESH_INDEX (e_oflag, &iter, bm, BM_EDGES_OF_MESH, i) {
-    void *oldflags = e_oflag->oflags;
-    e_oflag->oflags = BLI_mempool_alloc(newpool);
-    memcpy(e_oflag->oflags, oldflags, new_totflags_size);
-    BM_elem_index_set(&e_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)e_oflag);
-  }
-
-  BMFace_OFlag *f_oflag;
-  newpool = bm->ftoolflagpool;
-  BM_ITER_MESH_INDEX (f_oflag, &iter, bm, BM_FACES_OF_MESH, i) {
-    void *oldflags = f_oflag->oflags;
-    f_oflag->oflags = BLI_mempool_alloc(newpool);
-    memcpy(f_oflag->oflags, oldflags, new_totflags_size);
-    BM_elem_index_set(&f_oflag->base, i); /* set_inline */
-    BM_ELEM_API_FLAG_CLEAR((BMElemF *)f_oflag);
-  }
+  bmo_flag_layer_copy_all(bm, new_totflags_size, false);
 
   BLI_mempool_destroy(voldpool);
   BLI_mempool_destroy(eoldpool);
   BLI_mempool_destroy(foldpool);
-
-  bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
 }
 
-static void bmo_flag_layer_clear(BMesh *bm)
+static void bmo_flag_layer_clear_verts(BMesh *bm)
 {
-  /* set the index values since we are looping over all data anyway,
-   * may save time later on */
   const BMFlagLayer zero_flag = {0};
+  const int totflags_offset = bm->totflags - 1;
+  BMIter iter;
+  BMVert_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_VERTS_OF_MESH, i) {
+    ele->oflags[totflags_offset] = zero_flag;
+    BM_elem_index_set(&ele->base, i); /* set_inline */
+  }
+}
 
+static void bmo_flag_layer_clear_edges(BMesh *bm)
+{
+  const BMFlagLayer zero_flag = {0};
   const int totflags_offset = bm->totflags - 1;
+  BMIter iter;
+  BMEdge_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_EDGES_OF_MESH, i) {
+    ele->oflags[totflags_offset] = zero_flag;
+    BM_elem_index_set(&ele->base, i); /* set_inline */
+  }
+}
 
-  /* now go through and memcpy all the flag */
-  {
-    BMIter iter;
-    BMVert_OFlag *ele;
-    int i;
-    BM_ITER_MESH_INDEX (ele, &iter, bm, BM_VERTS_OF_MESH, i) {
-      ele->oflags[totflags_offset] = zero_flag;
-      BM_elem_index_set(&ele->base, i); /* set_inline */
-    }
+static void bmo_flag_layer_clear_faces(BMesh *bm)
+{
+  const BMFlagLayer zero_flag = {0};
+  const int totflags_offset = bm->totflags - 1;
+  BMIter iter;
+  BMFace_OFlag *ele;
+  int i;
+  BM_ITER_MESH_INDEX (ele, &iter, bm, BM_FACES_OF_MESH, i) {
+    ele->oflags[totflags_offset] = zero_flag;
+    BM_elem_index_set(&ele->base, i); /* set_inline */
   }
-  {
-    BMIter iter;
-    BMEdge_OFlag *ele;
-    int i;
-    BM_ITER_MESH_INDEX (ele, &iter, bm, BM_EDGES_OF_MESH, i) {
-      ele->oflags[totflags_offset] = zero_flag;
-      BM_elem_index_set(&ele->base, i); /* set_inline */
-    }
+}
+
+static void bmo_flag_layer_clear_verts_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_clear_verts(BLI_task_pool_user_data(pool));
+}
+
+static void bmo_flag_layer_clear_edges_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_clear_edges(BLI_task_pool_user_data(pool));
+}
+
+static void bmo_flag_layer_clear_faces_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  bmo_flag_layer_clear_faces(BLI_task_pool_user_data(pool));
+}
+
+static void bmo_flag_layer_clear(BMesh *bm)
+{
+  /* set the index values since we are looping over all data anyway,
+   * may save time later on */
+  if ((bm->totvert + bm->totedge + bm->totface) >= BM_OMP_LIMIT) {
+    TaskPool *task_pool = BLI_task_pool_create(bm, TASK_PRIORITY_HIGH);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_clear_verts_fn, NULL, false, NULL);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_clear_edges_fn, NULL, false, NULL);
+    BLI_task_pool_push(task_pool, bmo_flag_layer_clear_faces_fn, NULL, false, NULL);
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
   }
-  {
-    BMIter iter;
-    BMFace_OFlag *ele;
-    int i;
-    BM_ITER_MESH_INDEX (ele, &iter, bm, BM_FACES_OF_MESH, i) {
-      ele->oflags[totflags_offset] = zero_flag;
-      BM_elem_index_set(&ele->base, i); /* set_inline */
-    }
+  else {
+    bmo_flag_layer_clear_verts(bm);
+    bmo_flag_layer_clear_edges(bm);
+    bmo_flag_layer_clear_faces(bm);
   }
 
   bm->elem_index_dirty &= ~(BM_VERT | BM_EDGE | BM_FACE);
@@ -18,6 +18,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.h"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.h"
@@ -62,34 +63,70 @@ typedef enum CD_UseFlag {
 /* BMesh Helper Functions
  * ********************** */
 
+typedef struct DecimBuildQuadricsData {
+  BMesh *bm;
+  /* Face index aligned planes, shared by all corners of the face. */
+  double (*fplanes)[4];
+  Quadric *vquadrics;
+} DecimBuildQuadricsData;
+
+static void bm_decim_build_quadrics_plane_fn(void *__restrict userdata,
+                                             const int i,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DecimBuildQuadricsData *data = userdata;
+  BMFace *f = data->bm->ftable[i];
+  float center[3];
+
+  BM_face_calc_center_median(f, center);
+  copy_v3db_v3fl(data->fplanes[i], f->no);
+  data->fplanes[i][3] = -dot_v3db_v3fl(data->fplanes[i], center);
+}
+
+static void bm_decim_build_quadrics_vert_fn(void *__restrict userdata,
+                                            const int i,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DecimBuildQuadricsData *data = userdata;
+  BMVert *v = data->bm->vtable[i];
+  Quadric *q_vert = &data->vquadrics[i];
+  BMIter liter;
+  BMLoop *l;
+
+  /* Accumulating over the loops of each vertex keeps all writes local to this vertex.
+   * The result is the same set of plane quadrics the face-major loop used to add. */
+  BM_ITER_ELEM (l, &liter, v, BM_LOOPS_OF_VERT) {
+    Quadric q;
+    BLI_quadric_from_plane(&q, data->fplanes[BM_elem_index_get(l->f)]);
+    BLI_quadric_add_qu_qu(q_vert, &q);
+  }
+}
+
 /**
  * \param vquadrics: must be calloc'd
  */
 static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
 {
   BMIter iter;
-  BMFace *f;
   BMEdge *e;
 
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_first;
-    BMLoop *l_iter;
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_FACE);
 
-    float center[3];
-    double plane_db[4];
-    Quadric q;
+  double(*fplanes)[4] = MEM_mallocN(sizeof(*fplanes) * (size_t)bm->totface, __func__);
 
-    BM_face_calc_center_median(f, center);
-    copy_v3db_v3fl(plane_db, f->no);
-    plane_db[3] = -dot_v3db_v3fl(plane_db, center);
+  DecimBuildQuadricsData data = {
+      .bm = bm,
+      .fplanes = fplanes,
+      .vquadrics = vquadrics,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = ((bm->totvert + bm->totface) >= BM_OMP_LIMIT);
+  BLI_task_parallel_range(0, bm->totface, &data, bm_decim_build_quadrics_plane_fn, &settings);
+  BLI_task_parallel_range(0, bm->totvert, &data, bm_decim_build_quadrics_vert_fn, &settings);
 
-    BLI_quadric_from_plane(&q, plane_db);
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(l_iter->v)], &q);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  MEM_freeN(fplanes);
 
   /* boundary edges */
   BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
@@ -98,7 +135,7 @@ static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
       float edge_plane[3];
       double edge_plane_db[4];
       sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
-      f = e->l->f;
+      BMFace *f = e->l->f;
 
       cross_v3_v3v3(edge_plane, edge_vector, f->no);
       copy_v3db_v3fl(edge_plane_db, edge_plane);
@@ -222,18 +259,22 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of \a e, returning false for edges that must not collapse.
+ * Only reads mesh data and the quadrics, so the costs of many edges can be computed from
+ * multiple threads at once.
+ */
+static bool bm_decim_build_edge_cost_single_calc(BMEdge *e,
+                                                 const Quadric *vquadrics,
+                                                 const float *vweights,
+                                                 const float vweight_factor,
+                                                 float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f)))) {
-    goto clear;
+    return false;
   }
 
   /* check we can collapse, some edges we better not touch */
@@ -243,7 +284,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -252,11 +293,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* end sanity check */
 
@@ -308,10 +349,24 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
+
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+
+  if (bm_decim_build_edge_cost_single_calc(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
 
-clear:
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
@@ -326,6 +381,27 @@ static void bm_decim_invalid_edge_cost_single(BMEdge *e, Heap *eheap, HeapNode *
   eheap_table[BM_elem_index_get(e)] = BLI_heap_insert(eheap, COST_INVALID, e);
 }
 
+typedef struct DecimBuildEdgeCostData {
+  BMesh *bm;
+  const Quadric *vquadrics;
+  const float *vweights;
+  float vweight_factor;
+  float *costs;
+} DecimBuildEdgeCostData;
+
+static void bm_decim_build_edge_cost_fn(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DecimBuildEdgeCostData *data = userdata;
+  BMEdge *e = data->bm->etable[i];
+
+  if (!bm_decim_build_edge_cost_single_calc(
+          e, data->vquadrics, data->vweights, data->vweight_factor, &data->costs[i])) {
+    data->costs[i] = COST_INVALID;
+  }
+}
+
 static void bm_decim_build_edge_cost(BMesh *bm,
                                      const Quadric *vquadrics,
                                      const float *vweights,
@@ -333,15 +409,31 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
-
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = NULL;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  float *costs = MEM_mallocN(sizeof(float) * bm->totedge, __func__);
+
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* The cost of each edge only depends on the mesh and the quadrics,
+   * so compute them in parallel and fill the heap afterwards. */
+  DecimBuildEdgeCostData data = {
+      .bm = bm,
+      .vquadrics = vquadrics,
+      .vweights = vweights,
+      .vweight_factor = vweight_factor,
+      .costs = costs,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (bm->totedge >= BM_OMP_LIMIT);
+  BLI_task_parallel_range(0, bm->totedge, &data, bm_decim_build_edge_cost_fn, &settings);
+
+  for (int i = 0; i < bm->totedge; i++) {
+    eheap_table[i] = (costs[i] != COST_INVALID) ?
+                         BLI_heap_insert(eheap, costs[i], bm->etable[i]) :
+                         NULL;
   }
+
+  MEM_freeN(costs);
 }
 
 #ifdef USE_SYMMETRY
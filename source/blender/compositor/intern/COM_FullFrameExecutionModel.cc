@@ -91,6 +91,53 @@ MemoryBuffer *FullFrameExecutionModel::create_operation_buffer(NodeOperation *op
   return new MemoryBuffer(data_type, rect, is_a_single_elem);
 }
 
+/**
+ * Returns the buffer of an input that can hold the operation output, taking its ownership,
+ * or null when none qualifies. An input buffer may be written in-place when the operation
+ * only reads its inputs element-wise, the buffer has the same element size and area as the
+ * output and no other operation is going to read it anymore.
+ */
+std::unique_ptr<MemoryBuffer> FullFrameExecutionModel::take_reusable_input_buffer(
+    NodeOperation *op)
+{
+  if (!op->get_flags().can_be_inplace) {
+    return nullptr;
+  }
+
+  const DataType data_type = op->get_output_socket(0)->get_data_type();
+  const int num_channels = COM_data_type_num_channels(data_type);
+  const int num_inputs = op->get_number_of_input_sockets();
+  for (int i = 0; i < num_inputs; i++) {
+    NodeOperation *input = op->get_input_operation(i);
+
+    /* All remaining reads of the buffer must come from this very operation. */
+    int reads_by_op = 0;
+    for (int j = 0; j < num_inputs; j++) {
+      if (op->get_input_operation(j) == input) {
+        reads_by_op++;
+      }
+    }
+    if (active_buffers_.remaining_reads(input) != reads_by_op) {
+      continue;
+    }
+
+    MemoryBuffer *buf = active_buffers_.get_rendered_buffer(input);
+    if (buf == nullptr || buf->is_a_single_elem() || buf->get_num_channels() != num_channels ||
+        buf->get_width() != op->get_width() || buf->get_height() != op->get_height()) {
+      continue;
+    }
+
+    /* Canvases must be aligned, otherwise output coordinates are offset against the input. */
+    if (input->get_canvas().xmin != op->get_canvas().xmin ||
+        input->get_canvas().ymin != op->get_canvas().ymin) {
+      continue;
+    }
+
+    return active_buffers_.take_rendered_buffer(input);
+  }
+  return nullptr;
+}
+
 void FullFrameExecutionModel::render_operation(NodeOperation *op)
 {
   /* Output has no offset for easier image algorithms implementation on operations. */
@@ -98,9 +145,16 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
   constexpr int output_y = 0;
 
   const bool has_outputs = op->get_number_of_output_sockets() > 0;
-  MemoryBuffer *op_buf = has_outputs ? create_operation_buffer(op, output_x, output_y) : nullptr;
+  MemoryBuffer *op_buf = nullptr;
   if (op->get_width() > 0 && op->get_height() > 0) {
     Vector<MemoryBuffer *> input_bufs = get_input_buffers(op, output_x, output_y);
+    if (has_outputs) {
+      /* Prefer writing in-place into an input buffer that is discarded after this operation,
+       * this bounds memory usage in long chains of element-wise operations. */
+      std::unique_ptr<MemoryBuffer> reused_buf = take_reusable_input_buffer(op);
+      op_buf = reused_buf ? reused_buf.release() :
+                            create_operation_buffer(op, output_x, output_y);
+    }
     const int op_offset_x = output_x - op->get_canvas().xmin;
     const int op_offset_y = output_y - op->get_canvas().ymin;
     Vector<rcti> areas = active_buffers_.get_areas_to_render(op, op_offset_x, op_offset_y);
@@ -111,6 +165,9 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
       delete buf;
     }
   }
+  else if (has_outputs) {
+    op_buf = create_operation_buffer(op, output_x, output_y);
+  }
   /* Even if operation has no resolution set the empty buffer. It will be clipped with a
    * TranslateOperation from convert resolutions if linked to an operation with resolution. */
   active_buffers_.set_rendered_buffer(op, std::unique_ptr<MemoryBuffer>(op_buf));
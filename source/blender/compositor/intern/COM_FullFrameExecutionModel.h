@@ -62,6 +62,7 @@ class FullFrameExecutionModel : public ExecutionModel {
    */
   Vector<MemoryBuffer *> get_input_buffers(NodeOperation *op, int output_x, int output_y);
   MemoryBuffer *create_operation_buffer(NodeOperation *op, int output_x, int output_y);
+  std::unique_ptr<MemoryBuffer> take_reusable_input_buffer(NodeOperation *op);
   void render_operation(NodeOperation *op);
 
   void operation_finished(NodeOperation *operation);
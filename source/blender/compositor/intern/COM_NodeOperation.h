@@ -237,6 +237,14 @@ struct NodeOperationFlags {
    */
   bool can_be_constant : 1;
 
+  /**
+   * Whether every output element is computed only from the input elements at the same
+   * coordinates, reading any input channel before writing the same output channel. Allows
+   * the full-frame executor to write the output into the buffer of a discarded input
+   * instead of allocating a new one.
+   */
+  bool can_be_inplace : 1;
+
   NodeOperationFlags()
   {
     complex = false;
@@ -255,6 +263,7 @@ struct NodeOperationFlags {
     is_fullframe_operation = false;
     is_constant_operation = false;
     can_be_constant = false;
+    can_be_inplace = false;
   }
 };
 
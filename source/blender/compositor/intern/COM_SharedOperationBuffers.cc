@@ -79,6 +79,18 @@ MemoryBuffer *SharedOperationBuffers::get_rendered_buffer(NodeOperation *op)
   return get_buffer_data(op).buffer.get();
 }
 
+std::unique_ptr<MemoryBuffer> SharedOperationBuffers::take_rendered_buffer(NodeOperation *op)
+{
+  BLI_assert(is_operation_rendered(op));
+  return std::move(get_buffer_data(op).buffer);
+}
+
+int SharedOperationBuffers::remaining_reads(NodeOperation *op)
+{
+  BufferData &buf_data = get_buffer_data(op);
+  return buf_data.registered_reads - buf_data.received_reads;
+}
+
 void SharedOperationBuffers::read_finished(NodeOperation *read_op)
 {
   BufferData &buf_data = get_buffer_data(read_op);
@@ -70,6 +70,16 @@ class SharedOperationBuffers {
    * Get given operation rendered buffer.
    */
   MemoryBuffer *get_rendered_buffer(NodeOperation *op);
+  /**
+   * Takes ownership of given operation rendered buffer, to be reused as another operation
+   * buffer. Remaining reads keep operating on the memory through already created views.
+   */
+  std::unique_ptr<MemoryBuffer> take_rendered_buffer(NodeOperation *op);
+
+  /**
+   * Number of registered reads that have not finished yet.
+   */
+  int remaining_reads(NodeOperation *op);
 
   /**
    * Reports an operation has finished reading given operation. If all given operation dependencies
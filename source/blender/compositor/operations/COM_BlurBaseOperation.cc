@@ -157,6 +157,17 @@ void BlurBaseOperation::set_data(const NodeBlurData *data)
   memcpy(&data_, data, sizeof(NodeBlurData));
 }
 
+void BlurBaseOperation::hash_output_params()
+{
+  hash_params(size_, extend_bounds_, use_variable_size_);
+  hash_params(data_.sizex, data_.sizey, data_.filtertype);
+  hash_params(data_.bokeh, data_.gamma, data_.curved);
+  hash_params(data_.relative, data_.aspect, data_.fac);
+  if (data_.relative) {
+    hash_params(data_.percentx, data_.percenty);
+  }
+}
+
 int BlurBaseOperation::get_blur_size(eDimension dim) const
 {
   switch (dim) {
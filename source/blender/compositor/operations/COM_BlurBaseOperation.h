@@ -76,6 +76,11 @@ class BlurBaseOperation : public MultiThreadedOperation, public QualityStepHelpe
 
   void determine_canvas(const rcti &preferred_area, rcti &r_area) override;
 
+ protected:
+  void hash_output_params() override;
+
+ public:
+
   virtual void get_area_of_interest(int input_idx,
                                     const rcti &output_area,
                                     rcti &r_input_area) override;
@@ -13,6 +13,7 @@ ConvertBaseOperation::ConvertBaseOperation()
 {
   input_operation_ = nullptr;
   flags_.can_be_constant = true;
+  flags_.can_be_inplace = true;
 }
 
 void ConvertBaseOperation::init_execution()
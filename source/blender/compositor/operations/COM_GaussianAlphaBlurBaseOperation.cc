@@ -48,6 +48,12 @@ void GaussianAlphaBlurBaseOperation::deinit_execution()
   }
 }
 
+void GaussianAlphaBlurBaseOperation::hash_output_params()
+{
+  BlurBaseOperation::hash_output_params();
+  hash_params(falloff_, do_subtract_);
+}
+
 void GaussianAlphaBlurBaseOperation::get_area_of_interest(const int input_idx,
                                                           const rcti &output_area,
                                                           rcti &r_input_area)
@@ -29,6 +29,11 @@ class GaussianAlphaBlurBaseOperation : public BlurBaseOperation {
                                     const rcti &area,
                                     Span<MemoryBuffer *> inputs) final;
 
+ protected:
+  void hash_output_params() override;
+
+ public:
+
   /**
    * Set subtract for Dilate/Erode functionality
    */
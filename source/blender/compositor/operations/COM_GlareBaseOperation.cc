@@ -25,6 +25,16 @@ void GlareBaseOperation::deinit_execution()
   SingleThreadedOperation::deinit_execution();
 }
 
+void GlareBaseOperation::hash_output_params()
+{
+  if (settings_) {
+    hash_params(settings_->quality, settings_->type, settings_->iter);
+    hash_params(settings_->size, settings_->star_45, settings_->streaks);
+    hash_params(settings_->colmod, settings_->mix, settings_->threshold);
+    hash_params(settings_->fade, settings_->angle_ofs);
+  }
+}
+
 MemoryBuffer *GlareBaseOperation::create_memory_buffer(rcti *rect2)
 {
   MemoryBuffer *tile = (MemoryBuffer *)input_program_->initialize_tile_data(rect2);
@@ -4,6 +4,8 @@
 #include "COM_VariableSizeBokehBlurOperation.h"
 #include "COM_OpenCLDevice.h"
 
+#include "BLI_simd.h"
+
 namespace blender::compositor {
 
 VariableSizeBokehBlurOperation::VariableSizeBokehBlurOperation()
@@ -81,10 +83,10 @@ void VariableSizeBokehBlurOperation::execute_pixel(float output[4], int x, int y
   float *input_size_float_buffer = input_size_buffer->get_buffer();
   float *input_program_float_buffer = input_program_buffer->get_buffer();
   float read_color[4];
-  float bokeh[4];
+  float ATTR_ALIGN(16) bokeh[4];
   float temp_size[4];
-  float multiplier_accum[4];
-  float color_accum[4];
+  float ATTR_ALIGN(16) multiplier_accum[4];
+  float ATTR_ALIGN(16) color_accum[4];
 
   const float max_dim = MAX2(get_width(), get_height());
   const float scalar = do_size_scale_ ? (max_dim / 100.0f) : 1.0f;
@@ -122,6 +124,10 @@ void VariableSizeBokehBlurOperation::execute_pixel(float output[4], int x, int y
     const int add_xstep_color = add_xstep_value * COM_DATA_TYPE_COLOR_CHANNELS;
 
     if (size_center > threshold_) {
+#ifdef BLI_HAVE_SSE2
+      __m128 accum_color = _mm_load_ps(color_accum);
+      __m128 accum_multiplier = _mm_load_ps(multiplier_accum);
+#endif
       for (int ny = miny; ny < maxy; ny += add_ystep_value) {
         float dy = ny - y;
         int offset_value_ny = ny * input_size_buffer->get_width();
@@ -140,8 +146,17 @@ void VariableSizeBokehBlurOperation::execute_pixel(float output[4], int x, int y
                         (dy / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1),
                 };
                 input_bokeh_buffer->read(bokeh, uv[0], uv[1]);
+#ifdef BLI_HAVE_SSE2
+                const __m128 reg_bokeh = _mm_load_ps(bokeh);
+                accum_color = _mm_add_ps(
+                    accum_color,
+                    _mm_mul_ps(reg_bokeh,
+                               _mm_load_ps(&input_program_float_buffer[offset_color_nx_ny])));
+                accum_multiplier = _mm_add_ps(accum_multiplier, reg_bokeh);
+#else
                 madd_v4_v4v4(color_accum, bokeh, &input_program_float_buffer[offset_color_nx_ny]);
                 add_v4_v4(multiplier_accum, bokeh);
+#endif
               }
             }
           }
@@ -149,6 +164,10 @@ void VariableSizeBokehBlurOperation::execute_pixel(float output[4], int x, int y
           offset_value_nx_ny += add_xstep_value;
         }
       }
+#ifdef BLI_HAVE_SSE2
+      _mm_store_ps(color_accum, accum_color);
+      _mm_store_ps(multiplier_accum, accum_multiplier);
+#endif
     }
 
     output[0] = color_accum[0] / multiplier_accum[0];
@@ -296,8 +315,8 @@ void VariableSizeBokehBlurOperation::get_area_of_interest(const int input_idx,
 }
 
 struct PixelData {
-  float multiplier_accum[4];
-  float color_accum[4];
+  float ATTR_ALIGN(16) multiplier_accum[4];
+  float ATTR_ALIGN(16) color_accum[4];
   float threshold;
   float scalar;
   float size_center;
@@ -337,6 +356,10 @@ static void blur_pixel(int x, int y, PixelData &p)
   const int size_elem_stride = p.size_input->elem_stride * p.step;
   const float *row_color = p.image_input->get_elem(minx, miny);
   const float *row_size = p.size_input->get_elem(minx, miny);
+#ifdef BLI_HAVE_SSE2
+  __m128 accum_color = _mm_load_ps(p.color_accum);
+  __m128 accum_multiplier = _mm_load_ps(p.multiplier_accum);
+#endif
   for (int ny = miny; ny < maxy;
        ny += p.step, row_size += size_row_stride, row_color += color_row_stride) {
     const float dy = ny - y;
@@ -362,12 +385,22 @@ static void blur_pixel(int x, int y, PixelData &p)
                       (dx / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1);
       const float v = (float)(COM_BLUR_BOKEH_PIXELS / 2) +
                       (dy / size) * (float)((COM_BLUR_BOKEH_PIXELS / 2) - 1);
-      float bokeh[4];
+      float ATTR_ALIGN(16) bokeh[4];
       p.bokeh_input->read_elem_checked(u, v, bokeh);
+#ifdef BLI_HAVE_SSE2
+      const __m128 reg_bokeh = _mm_load_ps(bokeh);
+      accum_color = _mm_add_ps(accum_color, _mm_mul_ps(reg_bokeh, _mm_load_ps(color)));
+      accum_multiplier = _mm_add_ps(accum_multiplier, reg_bokeh);
+#else
       madd_v4_v4v4(p.color_accum, bokeh, color);
       add_v4_v4(p.multiplier_accum, bokeh);
+#endif
     }
   }
+#ifdef BLI_HAVE_SSE2
+  _mm_store_ps(p.color_accum, accum_color);
+  _mm_store_ps(p.multiplier_accum, accum_multiplier);
+#endif
 }
 
 void VariableSizeBokehBlurOperation::update_memory_buffer_partial(MemoryBuffer *output,
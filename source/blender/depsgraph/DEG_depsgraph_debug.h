@@ -42,6 +42,28 @@ void DEG_stats_simple(const struct Depsgraph *graph,
                       size_t *r_operations,
                       size_t *r_relations);
 
+/* ************************************************ */
+/* Evaluation Timing Statistics */
+
+/** A single entry of #DEG_debug_eval_stats_get: one operation of the last graph evaluation. */
+typedef struct DEGDebugOperationStat {
+  /** Name of the ID the operation belongs to (without the 2 character type prefix). */
+  char id_name[64];
+  /** Identifier of the operation within its ID (component and operation name). */
+  char operation_name[128];
+  /** Time in seconds spent on the operation during the last graph evaluation. */
+  double time;
+} DEGDebugOperationStat;
+
+/**
+ * Fill \a r_stats with up to \a max_stats operations of the last graph evaluation, slowest
+ * first, and return the number of entries written. Per-operation timing is only collected when
+ * depsgraph timing debug is enabled (`--debug-depsgraph-time`), without it the result is empty.
+ */
+int DEG_debug_eval_stats_get(const struct Depsgraph *depsgraph,
+                             struct DEGDebugOperationStat *r_stats,
+                             int max_stats);
+
 /* ************************************************ */
 /* Diagram-Based Graph Debugging */
 
@@ -7,6 +7,7 @@
 
 #include "intern/builder/deg_builder.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "DNA_ID.h"
@@ -192,6 +193,78 @@ void deg_graph_build_flush_visibility(Depsgraph *graph)
   BLI_stack_free(stack);
 }
 
+/* Operation of a relation which is pointed to by the relation, when it is an operation-level
+ * relation. Used for the priority based ordering below. */
+uint32_t relation_target_priority(const Relation *rel)
+{
+  if (rel->to->type != NodeType::OPERATION) {
+    return 0;
+  }
+  return ((const OperationNode *)rel->to)->eval_priority;
+}
+
+void deg_graph_compute_evaluation_priorities(Depsgraph *graph)
+{
+  enum {
+    DEG_NODE_VISITED = (1 << 0),
+  };
+
+  /* Walk operations from sinks towards sources, so the priority of an operation becomes the
+   * length of the longest chain of operations depending on it. */
+  BLI_Stack *stack = BLI_stack_new(sizeof(OperationNode *), "DEG priorities stack");
+  for (OperationNode *op_node : graph->operations) {
+    op_node->custom_flags = 0;
+    op_node->num_links_pending = 0;
+    op_node->eval_priority = 0;
+    for (Relation *rel : op_node->outlinks) {
+      if ((rel->to->type == NodeType::OPERATION) && (rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        ++op_node->num_links_pending;
+      }
+    }
+    if (op_node->num_links_pending == 0) {
+      BLI_stack_push(stack, &op_node);
+      op_node->custom_flags |= DEG_NODE_VISITED;
+    }
+  }
+  while (!BLI_stack_is_empty(stack)) {
+    OperationNode *op_node;
+    BLI_stack_pop(stack, &op_node);
+    for (Relation *rel : op_node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION) {
+        continue;
+      }
+      OperationNode *op_from = (OperationNode *)rel->from;
+      op_from->eval_priority = std::max(op_from->eval_priority, op_node->eval_priority + 1);
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        BLI_assert(op_from->num_links_pending > 0);
+        --op_from->num_links_pending;
+        if ((op_from->num_links_pending == 0) && (op_from->custom_flags & DEG_NODE_VISITED) == 0) {
+          BLI_stack_push(stack, &op_from);
+          op_from->custom_flags |= DEG_NODE_VISITED;
+        }
+      }
+    }
+  }
+  BLI_stack_free(stack);
+
+  /* Make the scheduling in deg_eval.cc submit critical operations first: the initial scheduling
+   * pass iterates operations in their stored order, and children are scheduled in outlinks
+   * order. Note that sorting by decreasing priority keeps the operations storage a valid
+   * single-thread traversal order. */
+  for (OperationNode *op_node : graph->operations) {
+    std::stable_sort(op_node->outlinks.begin(),
+                     op_node->outlinks.end(),
+                     [](const Relation *rel_a, const Relation *rel_b) {
+                       return relation_target_priority(rel_a) > relation_target_priority(rel_b);
+                     });
+  }
+  std::stable_sort(graph->operations.begin(),
+                   graph->operations.end(),
+                   [](const OperationNode *node_a, const OperationNode *node_b) {
+                     return node_a->eval_priority > node_b->eval_priority;
+                   });
+}
+
 }  // namespace
 
 void deg_graph_build_finalize(Main *bmain, Depsgraph *graph)
@@ -199,6 +272,16 @@ void deg_graph_build_finalize(Main *bmain, Depsgraph *graph)
   /* Make sure dependencies of visible ID datablocks are visible. */
   deg_graph_build_flush_visibility(graph);
   deg_graph_remove_unused_noops(graph);
+  deg_graph_compute_evaluation_priorities(graph);
+
+  /* Collect the directly visible objects now that visibility is final, so that iterating objects
+   * of the graph does not need to filter the full list of ID nodes every time. */
+  graph->visible_object_id_nodes.clear();
+  for (IDNode *id_node : graph->id_nodes) {
+    if (id_node->is_directly_visible && GS(id_node->id_orig->name) == ID_OB) {
+      graph->visible_object_id_nodes.append(id_node);
+    }
+  }
 
   /* Re-tag IDs for update if it was tagged before the relations
    * update tag. */
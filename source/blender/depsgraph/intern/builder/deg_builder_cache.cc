@@ -89,6 +89,8 @@ void animated_property_cb(ID * /*id*/, FCurve *fcurve, void *data_v)
   if (pointer_rna.owner_id != data->pointer_rna.owner_id) {
     animated_property_storage = data->builder_cache->ensureAnimatedPropertyStorage(
         pointer_rna.owner_id);
+    data->builder_cache->tagNestedStorageContribution(data->pointer_rna.owner_id,
+                                                      pointer_rna.owner_id);
   }
   /* Set the property as animated. */
   animated_property_storage->tagPropertyAsAnimated(&pointer_rna, property_rna);
@@ -150,7 +152,7 @@ DepsgraphBuilderCache::~DepsgraphBuilderCache()
 AnimatedPropertyStorage *DepsgraphBuilderCache::ensureAnimatedPropertyStorage(ID *id)
 {
   return animated_property_storage_map_.lookup_or_add_cb(
-      id, []() { return new AnimatedPropertyStorage(); });
+      id->session_uuid, []() { return new AnimatedPropertyStorage(); });
 }
 
 AnimatedPropertyStorage *DepsgraphBuilderCache::ensureInitializedAnimatedPropertyStorage(ID *id)
@@ -163,4 +165,44 @@ AnimatedPropertyStorage *DepsgraphBuilderCache::ensureInitializedAnimatedPropert
   return animated_property_storage;
 }
 
+void DepsgraphBuilderCache::tagNestedStorageContribution(ID *owner_id, ID *nested_id)
+{
+  nested_storage_contributions_.lookup_or_add_default(owner_id->session_uuid)
+      .add(nested_id->session_uuid);
+  nested_storage_contributors_.lookup_or_add_default(nested_id->session_uuid)
+      .add(owner_id->session_uuid);
+}
+
+void DepsgraphBuilderCache::invalidateID(ID *id)
+{
+  /* Walk the contribution edges in both directions: a storage an edited ID wrote into is partly
+   * stale, and once such a storage is dropped all of its contributors have to re-scan their
+   * F-Curves to fill it in again. */
+  Vector<uint> queue;
+  Set<uint> visited;
+  queue.append(id->session_uuid);
+  while (!queue.is_empty()) {
+    const uint session_uuid = queue.pop_last();
+    if (!visited.add(session_uuid)) {
+      continue;
+    }
+    AnimatedPropertyStorage *animated_property_storage =
+        animated_property_storage_map_.pop_default(session_uuid, nullptr);
+    delete animated_property_storage;
+
+    if (std::optional<Set<uint>> contributions = nested_storage_contributions_.pop_try(
+            session_uuid)) {
+      for (const uint other_session_uuid : *contributions) {
+        queue.append(other_session_uuid);
+      }
+    }
+    if (std::optional<Set<uint>> contributors = nested_storage_contributors_.pop_try(
+            session_uuid)) {
+      for (const uint other_session_uuid : *contributors) {
+        queue.append(other_session_uuid);
+      }
+    }
+  }
+}
+
 }  // namespace blender::deg
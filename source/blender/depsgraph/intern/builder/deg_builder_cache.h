@@ -65,7 +65,12 @@ class AnimatedPropertyStorage {
   MEM_CXX_CLASS_ALLOC_FUNCS("AnimatedPropertyStorage");
 };
 
-/* Cached data which can be re-used by multiple builders. */
+/* Cached data which can be re-used by multiple builders.
+ *
+ * The cache is owned by the dependency graph and persists across relation rebuilds: animated
+ * property information for an ID only changes when the ID itself is modified, in which case the
+ * tagging in depsgraph_tag.cc invalidates the corresponding storage. This way a rebuild only
+ * re-scans F-Curves of IDs which were actually edited since the previous build. */
 class DepsgraphBuilderCache {
  public:
   ~DepsgraphBuilderCache();
@@ -74,6 +79,16 @@ class DepsgraphBuilderCache {
   AnimatedPropertyStorage *ensureAnimatedPropertyStorage(ID *id);
   AnimatedPropertyStorage *ensureInitializedAnimatedPropertyStorage(ID *id);
 
+  /* Record that scanning F-Curves of `owner_id` added entries to the storage of `nested_id`
+   * (animation of embedded datablocks, such as a material animating its node tree). Needed so
+   * invalidation of either ID knows which storages have to be rebuilt. */
+  void tagNestedStorageContribution(ID *owner_id, ID *nested_id);
+
+  /* Throw away cached information derived from the given ID. Storages the ID contributed to are
+   * dropped as well, together with their other contributors, so that a subsequent build
+   * re-creates them from scratch. */
+  void invalidateID(ID *id);
+
   /* Shortcuts to go through ensureInitializedAnimatedPropertyStorage and its
    * isPropertyAnimated.
    *
@@ -96,7 +111,13 @@ class DepsgraphBuilderCache {
     return animated_property_storage->isAnyPropertyAnimated(ptr);
   }
 
-  Map<ID *, AnimatedPropertyStorage *> animated_property_storage_map_;
+  /* Indexed by ID.session_uuid, so entries of removed datablocks can never be confused with
+   * newly allocated ones re-using the same address. */
+  Map<uint, AnimatedPropertyStorage *> animated_property_storage_map_;
+
+  /* Cross-ID contributions between storages, in both directions, indexed by ID.session_uuid. */
+  Map<uint, Set<uint>> nested_storage_contributions_;
+  Map<uint, Set<uint>> nested_storage_contributors_;
 
   MEM_CXX_CLASS_ALLOC_FUNCS("DepsgraphBuilderCache");
 };
@@ -225,6 +225,38 @@ bool object_have_geometry_component(const Object *object)
       object->type, OB_MESH, OB_CURVES_LEGACY, OB_FONT, OB_SURF, OB_MBALL, OB_LATTICE, OB_GPENCIL);
 }
 
+/* Collect the nodes which (indirectly) feed into an output node of the tree, following links
+ * backwards. Muted nodes and links are included, so that muting and un-muting does not change the
+ * topology the relations are built from. */
+Set<bNode *> nodetree_collect_nodes_feeding_output(bNodeTree *ntree)
+{
+  Map<bNode *, Vector<bNode *>> inputs_by_node;
+  LISTBASE_FOREACH (bNodeLink *, link, &ntree->links) {
+    inputs_by_node.lookup_or_add_default(link->tonode).append(link->fromnode);
+  }
+  Set<bNode *> connected;
+  Vector<bNode *> nodes_to_check;
+  LISTBASE_FOREACH (bNode *, bnode, &ntree->nodes) {
+    if (bnode->typeinfo == nullptr) {
+      continue;
+    }
+    if (bnode->typeinfo->nclass == NODE_CLASS_OUTPUT || bnode->type == NODE_GROUP_OUTPUT) {
+      nodes_to_check.append(bnode);
+    }
+  }
+  while (!nodes_to_check.is_empty()) {
+    bNode *bnode = nodes_to_check.pop_last();
+    if (!connected.add(bnode)) {
+      continue;
+    }
+    const Vector<bNode *> *input_nodes = inputs_by_node.lookup_ptr(bnode);
+    if (input_nodes != nullptr) {
+      nodes_to_check.extend(*input_nodes);
+    }
+  }
+  return connected;
+}
+
 }  // namespace
 
 /* **** General purpose functions **** */
@@ -2418,6 +2450,10 @@ void DepsgraphRelationBuilder::build_nodetree(bNodeTree *ntree)
   build_animdata(&ntree->id);
   build_parameters(&ntree->id);
   OperationKey ntree_output_key(&ntree->id, NodeType::NTREE_OUTPUT, OperationCode::NTREE_OUTPUT);
+  /* Nodes which cannot reach an output are still built below (their referenced IDs have to be in
+   * the graph), but their changes do not have to flush into this tree's output. The node tree
+   * update code tags the relations for a rebuild when the topology towards the output changes. */
+  const Set<bNode *> nodes_feeding_output = nodetree_collect_nodes_feeding_output(ntree);
   /* nodetree's nodes... */
   LISTBASE_FOREACH (bNode *, bnode, &ntree->nodes) {
     build_idproperties(bnode->prop);
@@ -2489,11 +2525,10 @@ void DepsgraphRelationBuilder::build_nodetree(bNodeTree *ntree)
     else if (ELEM(bnode->type, NODE_GROUP, NODE_CUSTOM_GROUP)) {
       bNodeTree *group_ntree = (bNodeTree *)id;
       build_nodetree(group_ntree);
-      ComponentKey group_output_key(&group_ntree->id, NodeType::NTREE_OUTPUT);
-      /* This relation is not necessary in all cases (e.g. when the group node is not connected to
-       * the output). Currently, we lack the infrastructure to check for these cases efficiently.
-       * That can be added later. */
-      add_relation(group_output_key, ntree_output_key, "Group Node");
+      if (nodes_feeding_output.contains(bnode)) {
+        ComponentKey group_output_key(&group_ntree->id, NodeType::NTREE_OUTPUT);
+        add_relation(group_output_key, ntree_output_key, "Group Node");
+      }
     }
     else {
       BLI_assert_msg(0, "Unknown ID type used for node");
@@ -43,7 +43,9 @@ class AbstractBuilderPipeline {
   Main *bmain_;
   Scene *scene_;
   ViewLayer *view_layer_;
-  DepsgraphBuilderCache builder_cache_;
+  /* Owned by the graph, so cached data survives until the next invalidation instead of being
+   * re-created on every rebuild. */
+  DepsgraphBuilderCache &builder_cache_;
 
   virtual unique_ptr<DepsgraphNodeBuilder> construct_node_builder();
   virtual unique_ptr<DepsgraphRelationBuilder> construct_relation_builder();
@@ -25,6 +25,7 @@
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_debug.h"
 
+#include "intern/builder/deg_builder_cache.h"
 #include "intern/depsgraph_physics.h"
 #include "intern/depsgraph_registry.h"
 #include "intern/depsgraph_relation.h"
@@ -46,6 +47,7 @@ namespace blender::deg {
 Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluationMode mode)
     : time_source(nullptr),
       need_update(true),
+      builder_cache(nullptr),
       need_visibility_update(true),
       need_visibility_time_update(false),
       bmain(bmain),
@@ -71,6 +73,7 @@ Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluati
 Depsgraph::~Depsgraph()
 {
   clear_id_nodes();
+  delete builder_cache;
   delete time_source;
   BLI_spin_end(&lock);
 }
@@ -96,6 +99,14 @@ void Depsgraph::tag_time_source()
   time_source->tag_update(this, DEG_UPDATE_SOURCE_TIME);
 }
 
+DepsgraphBuilderCache &Depsgraph::ensure_builder_cache()
+{
+  if (builder_cache == nullptr) {
+    builder_cache = new DepsgraphBuilderCache();
+  }
+  return *builder_cache;
+}
+
 IDNode *Depsgraph::find_id_node(const ID *id) const
 {
   return id_hash.lookup_default(id, nullptr);
@@ -162,6 +173,7 @@ void Depsgraph::clear_id_nodes()
   /* Clear containers. */
   id_hash.clear();
   id_nodes.clear();
+  visible_object_id_nodes.clear();
   /* Clear physics relation caches. */
   clear_physics_relations(this);
 }
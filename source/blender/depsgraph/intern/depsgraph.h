@@ -34,6 +34,7 @@ struct ViewLayer;
 namespace blender {
 namespace deg {
 
+class DepsgraphBuilderCache;
 struct IDNode;
 struct Node;
 struct OperationNode;
@@ -70,6 +71,9 @@ struct Depsgraph {
   /* Clear storage used by all nodes. */
   void clear_all_nodes();
 
+  /* Get cache which is shared by the builders and kept alive across relation rebuilds. */
+  DepsgraphBuilderCache &ensure_builder_cache();
+
   /* Copy-on-Write Functionality ........ */
 
   /* For given original ID get ID which is created by CoW system. */
@@ -86,12 +90,22 @@ struct Depsgraph {
    * keep exact order of iteration. */
   IDDepsNodes id_nodes;
 
+  /* Flattened subset of id_nodes: object ID nodes which are directly visible, in the same order.
+   * Collected by the graph finalization, so it only changes when visibility does (visibility
+   * changes tag the relations for a rebuild). Saves DEG_OBJECT_ITER users from filtering the
+   * full list of ID nodes on every iteration over the graph. */
+  IDDepsNodes visible_object_id_nodes;
+
   /* Top-level time source node. */
   TimeSourceNode *time_source;
 
   /* Indicates whether relations needs to be updated. */
   bool need_update;
 
+  /* Data cached by the builders which stays valid across relation rebuilds. Invalidated by the
+   * update tagging, created on first build. */
+  DepsgraphBuilderCache *builder_cache;
+
   /* Indicated whether IDs in this graph are to be tagged as if they first appear visible, with
    * an optional tag for their animation (time) update. */
   bool need_visibility_update;
@@ -111,7 +125,9 @@ struct Depsgraph {
   /* Convenience Data ................... */
 
   /* XXX: should be collected after building (if actually needed?) */
-  /* All operation nodes, sorted in order of single-thread traversal order. */
+  /* All operation nodes, sorted in order of single-thread traversal order. After the build is
+   * finalized the order is by decreasing evaluation priority, so scheduling starts the longest
+   * dependency chains first. */
   OperationNodes operations;
 
   /* Spin lock for threading-critical operations.
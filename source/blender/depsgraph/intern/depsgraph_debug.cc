@@ -7,6 +7,9 @@
  * Implementation of tools for debugging the depsgraph
  */
 
+#include <algorithm>
+
+#include "BLI_string.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_scene_types.h"
@@ -24,6 +27,7 @@
 #include "intern/depsgraph_type.h"
 #include "intern/node/deg_node_component.h"
 #include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
 #include "intern/node/deg_node_time.h"
 
 namespace deg = blender::deg;
@@ -180,6 +184,48 @@ bool DEG_debug_consistency_check(Depsgraph *graph)
 
 /* ------------------------------------------------ */
 
+int DEG_debug_eval_stats_get(const Depsgraph *depsgraph,
+                             DEGDebugOperationStat *r_stats,
+                             int max_stats)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+
+  /* Gather operations which were actually evaluated. Timing is only written by the evaluator
+   * when timing debug is enabled, see #DepsgraphDebug::do_time_debug. */
+  blender::Vector<const deg::OperationNode *> operations;
+  for (const deg::OperationNode *op_node : deg_graph->operations) {
+    if (op_node->stats.current_time > 0.0) {
+      operations.append(op_node);
+    }
+  }
+
+  std::sort(operations.begin(),
+            operations.end(),
+            [](const deg::OperationNode *a, const deg::OperationNode *b) {
+              return a->stats.current_time > b->stats.current_time;
+            });
+
+  const int stats_num = std::min(int(operations.size()), max_stats);
+  for (int i = 0; i < stats_num; i++) {
+    const deg::OperationNode *op_node = operations[i];
+    const deg::IDNode *id_node = op_node->owner->owner;
+    DEGDebugOperationStat *stat = &r_stats[i];
+
+    BLI_strncpy(stat->id_name, id_node->id_orig->name + 2, sizeof(stat->id_name));
+
+    /* Component and operation name, without repeating the ID name like full_identifier(). */
+    deg::string identifier = op_node->identifier();
+    if (op_node->owner->type == deg::NodeType::BONE || !op_node->owner->name.empty()) {
+      identifier = op_node->owner->name + "/" + identifier;
+    }
+    BLI_strncpy(stat->operation_name, identifier.c_str(), sizeof(stat->operation_name));
+
+    stat->time = op_node->stats.current_time;
+  }
+
+  return stats_num;
+}
+
 void DEG_stats_simple(const Depsgraph *graph,
                       size_t *r_outer,
                       size_t *r_operations,
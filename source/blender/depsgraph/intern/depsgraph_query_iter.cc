@@ -216,18 +216,13 @@ bool deg_iterator_objects_step(DEGObjectIterData *data)
 {
   deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(data->graph);
 
+  /* Only the directly visible object nodes are iterated: the graph finalization keeps a
+   * flattened array of them, so the filtering does not have to look at every ID node. */
   for (; data->id_node_index < data->num_id_nodes; data->id_node_index++) {
-    deg::IDNode *id_node = deg_graph->id_nodes[data->id_node_index];
-
-    if (!id_node->is_directly_visible) {
-      continue;
-    }
+    deg::IDNode *id_node = deg_graph->visible_object_id_nodes[data->id_node_index];
 
-    const ID_Type id_type = GS(id_node->id_orig->name);
-
-    if (id_type != ID_OB) {
-      continue;
-    }
+    BLI_assert(id_node->is_directly_visible);
+    BLI_assert(GS(id_node->id_orig->name) == ID_OB);
 
     switch (id_node->linked_state) {
       case deg::DEG_ID_LINKED_DIRECTLY:
@@ -279,7 +274,7 @@ void DEG_iterator_objects_begin(BLI_Iterator *iter, DEGObjectIterData *data)
 {
   Depsgraph *depsgraph = data->graph;
   deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
-  const size_t num_id_nodes = deg_graph->id_nodes.size();
+  const size_t num_id_nodes = deg_graph->visible_object_id_nodes.size();
 
   iter->data = data;
 
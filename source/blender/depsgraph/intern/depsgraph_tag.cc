@@ -40,6 +40,7 @@
 #include "DEG_depsgraph_query.h"
 
 #include "intern/builder/deg_builder.h"
+#include "intern/builder/deg_builder_cache.h"
 #include "intern/depsgraph.h"
 #include "intern/depsgraph_registry.h"
 #include "intern/depsgraph_update.h"
@@ -642,6 +643,12 @@ void graph_id_tag_update(
   IDNode *id_node = (graph != nullptr) ? graph->find_id_node(id) : nullptr;
   if (graph != nullptr) {
     DEG_graph_id_type_tag(reinterpret_cast<::Depsgraph *>(graph), GS(id->name));
+    /* User edits can modify animation data of the ID, so information derived from it for
+     * relation builds can no longer be re-used. Other update sources do not change original
+     * data and keep the cached information valid. */
+    if (update_source == DEG_UPDATE_SOURCE_USER_EDIT && graph->builder_cache != nullptr) {
+      graph->builder_cache->invalidateID(id);
+    }
   }
   if (flag == 0) {
     deg_graph_node_tag_zero(bmain, graph, id_node, update_source);
@@ -14,6 +14,7 @@
 #include "BLI_compiler_attrs.h"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
+#include "BLI_trace.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_global.h"
@@ -92,6 +93,9 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
+
+  BLI_TRACE_ZONE(operation_node->name.c_str());
+
   /* Perform operation. */
   if (state->do_stats) {
     const double start_time = PIL_check_seconds_timer();
@@ -256,6 +256,12 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Length of the longest chain of operations which depends on this one, computed when the graph
+   * is built. Used as a scheduling hint: operations on the critical path are submitted for
+   * evaluation before independent short chains, so the longest chain starts as early as
+   * possible. */
+  uint32_t eval_priority;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -240,35 +240,51 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     }
   }
 
-  /* TODO(fclem): This part can be slow, optimize it. */
-  EEVEE_BoundBox *bbox = backbuffer->bbox;
   BoundSphere *bsphere = linfo->shadow_bounds;
-  /* Search for deleted shadow casters or if shcaster WAS in shadow radius. */
-  for (int i = 0; i < backbuffer->count; i++) {
-    /* If the shadow-caster has been deleted or updated. */
-    if (BLI_BITMAP_TEST(backbuffer->update, i)) {
-      for (int j = 0; j < linfo->cube_len; j++) {
-        if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
-          if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
-            BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], j);
-          }
-        }
-      }
+  /* Count the lights that can still be tagged for update, the intersection checks can stop as
+   * soon as every light is tagged. */
+  int untagged_light_len = 0;
+  for (int j = 0; j < linfo->cube_len; j++) {
+    if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
+      untagged_light_len++;
     }
   }
-  /* Search for updates in current shadow casters. */
-  bbox = frontbuffer->bbox;
-  for (int i = 0; i < frontbuffer->count; i++) {
-    /* If the shadow-caster has been updated. */
-    if (BLI_BITMAP_TEST(frontbuffer->update, i)) {
-      for (int j = 0; j < linfo->cube_len; j++) {
-        if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
-          if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
+
+  if (untagged_light_len > 0) {
+    /* Gather the bounds of all updated casters into one compact array so each light walks it with
+     * an early break, instead of scanning both buffers' bitmaps for every light. Casters deleted
+     * or updated from the backbuffer invalidate the same way as updated ones from the
+     * frontbuffer. */
+    int updated_len = 0;
+    EEVEE_BoundBox *updated_bbox = MEM_mallocN(
+        sizeof(EEVEE_BoundBox) * ((size_t)backbuffer->count + (size_t)frontbuffer->count),
+        __func__);
+    for (int i = 0; i < backbuffer->count; i++) {
+      if (BLI_BITMAP_TEST(backbuffer->update, i)) {
+        updated_bbox[updated_len++] = backbuffer->bbox[i];
+      }
+    }
+    for (int i = 0; i < frontbuffer->count; i++) {
+      if (BLI_BITMAP_TEST(frontbuffer->update, i)) {
+        updated_bbox[updated_len++] = frontbuffer->bbox[i];
+      }
+    }
+
+    if (updated_len > 0) {
+      for (int j = 0; j < linfo->cube_len && untagged_light_len > 0; j++) {
+        if (BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
+          continue;
+        }
+        for (int i = 0; i < updated_len; i++) {
+          if (sphere_bbox_intersect(&bsphere[j], &updated_bbox[i])) {
             BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], j);
+            untagged_light_len--;
+            break;
           }
         }
       }
     }
+    MEM_freeN(updated_bbox);
   }
 
   /* Resize shcasters buffers if too big. */
@@ -245,19 +245,25 @@ float spot_attenuation(LightData ld, vec3 l_vector)
 float light_attenuation(LightData ld, vec4 l_vector)
 {
   float vis = 1.0;
+  if (ld.l_type != SUN) {
+#ifdef VOLUME_LIGHTING
+    vis = distance_attenuation(l_vector.w * l_vector.w, ld.l_influence_volume);
+#else
+    vis = distance_attenuation(l_vector.w * l_vector.w, ld.l_influence);
+#endif
+    /* Early out for lights that have no influence on this point. This rejects most of the
+     * lights in scenes with many small local lights before the spot cone evaluation and
+     * keeps the shadowing / contact shadow paths from even considering them. */
+    if (vis < 1e-8) {
+      return 0.0;
+    }
+  }
   if (ld.l_type == SPOT) {
     vis *= spot_attenuation(ld, l_vector.xyz);
   }
   if (ld.l_type >= SPOT) {
     vis *= step(0.0, -dot(l_vector.xyz, ld.l_forward));
   }
-  if (ld.l_type != SUN) {
-#ifdef VOLUME_LIGHTING
-    vis *= distance_attenuation(l_vector.w * l_vector.w, ld.l_influence_volume);
-#else
-    vis *= distance_attenuation(l_vector.w * l_vector.w, ld.l_influence);
-#endif
-  }
   return vis;
 }
 
@@ -9,6 +9,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "MEM_guardedalloc.h"
+
 #include "DNA_armature_types.h"
 #include "DNA_constraint_types.h"
 #include "DNA_mesh_types.h"
@@ -75,6 +77,7 @@ typedef struct ArmatureDrawContext {
   DRWShadingGroup *custom_outline;
   DRWShadingGroup *custom_wire;
   GHash *custom_shapes_ghash;
+  GHash *custom_shapes_batch_ghash;
 
   OVERLAY_ExtraCallBuffers *extras;
 
@@ -128,6 +131,8 @@ void OVERLAY_armature_cache_init(OVERLAY_Data *vedata)
   const float wire_alpha = pd->overlay.bone_wire_alpha;
   const bool use_wire_alpha = (wire_alpha < 1.0f);
 
+  pd->armature_custom_shapes_ghash = BLI_ghash_ptr_new(__func__);
+
   DRWState state;
 
   if (pd->armature.do_pose_fade_geom) {
@@ -628,58 +633,89 @@ BLI_INLINE DRWCallBuffer *custom_bone_instance_shgroup(ArmatureDrawContext *ctx,
   return buf;
 }
 
-static void drw_shgroup_bone_custom_solid(ArmatureDrawContext *ctx,
-                                          const float (*bone_mat)[4],
-                                          const float bone_color[4],
-                                          const float hint_color[4],
-                                          const float outline_color[4],
-                                          Object *custom)
+static OVERLAY_BoneCustomShapeBatches *custom_bone_shape_batches_get(ArmatureDrawContext *ctx,
+                                                                     Object *custom,
+                                                                     const bool wire)
 {
+  /* Custom shapes are typically shared by many bones (and even more so with linked crowd
+   * rigs). Resolving the evaluated mesh and requesting the batches once per custom shape
+   * object per frame instead of once per bone keeps submission time in check. */
+  OVERLAY_BoneCustomShapeBatches *batches = BLI_ghash_lookup(ctx->custom_shapes_batch_ghash,
+                                                             custom);
+  if (batches == NULL) {
+    batches = MEM_callocN(sizeof(*batches), __func__);
+    BLI_ghash_insert(ctx->custom_shapes_batch_ghash, custom, batches);
+  }
+  if (wire ? batches->wire_requested : batches->solid_requested) {
+    return batches;
+  }
+
   /* The custom object is not an evaluated object, so its object->data field hasn't been replaced
    * by #data_eval. This is bad since it gives preference to an object's evaluated mesh over any
    * other data type, but supporting all evaluated geometry components would require a much larger
    * refactor of this area. */
   Mesh *mesh = BKE_object_get_evaluated_mesh_no_subsurf(custom);
-  if (mesh == NULL) {
-    return;
+  if (mesh != NULL) {
+    /* TODO(fclem): arg... less than ideal but we never iter on this object
+     * to assure batch cache is valid. */
+    DRW_mesh_batch_cache_validate(custom, mesh);
+
+    if (wire) {
+      batches->all_edges = DRW_mesh_batch_cache_get_all_edges(mesh);
+    }
+    else {
+      batches->surf = DRW_mesh_batch_cache_get_surface(mesh);
+      batches->edges = DRW_mesh_batch_cache_get_edge_detection(mesh, NULL);
+      batches->ledges = DRW_mesh_batch_cache_get_loose_edges(mesh);
+    }
+
+    /* TODO(fclem): needs to be moved elsewhere. */
+    drw_batch_cache_generate_requested_delayed(custom);
   }
 
-  /* TODO(fclem): arg... less than ideal but we never iter on this object
-   * to assure batch cache is valid. */
-  DRW_mesh_batch_cache_validate(custom, mesh);
+  if (wire) {
+    batches->wire_requested = true;
+  }
+  else {
+    batches->solid_requested = true;
+  }
+  return batches;
+}
 
-  struct GPUBatch *surf = DRW_mesh_batch_cache_get_surface(mesh);
-  struct GPUBatch *edges = DRW_mesh_batch_cache_get_edge_detection(mesh, NULL);
-  struct GPUBatch *ledges = DRW_mesh_batch_cache_get_loose_edges(mesh);
+static void drw_shgroup_bone_custom_solid(ArmatureDrawContext *ctx,
+                                          const float (*bone_mat)[4],
+                                          const float bone_color[4],
+                                          const float hint_color[4],
+                                          const float outline_color[4],
+                                          Object *custom)
+{
+  OVERLAY_BoneCustomShapeBatches *batches = custom_bone_shape_batches_get(ctx, custom, false);
   BoneInstanceData inst_data;
   DRWCallBuffer *buf;
 
-  if (surf || edges || ledges) {
+  if (batches->surf || batches->edges || batches->ledges) {
     mul_m4_m4m4(inst_data.mat, ctx->ob->obmat, bone_mat);
   }
 
-  if (surf && ctx->custom_solid) {
-    buf = custom_bone_instance_shgroup(ctx, ctx->custom_solid, surf);
+  if (batches->surf && ctx->custom_solid) {
+    buf = custom_bone_instance_shgroup(ctx, ctx->custom_solid, batches->surf);
     OVERLAY_bone_instance_data_set_color_hint(&inst_data, hint_color);
     OVERLAY_bone_instance_data_set_color(&inst_data, bone_color);
     DRW_buffer_add_entry_struct(buf, inst_data.mat);
   }
 
-  if (edges && ctx->custom_outline) {
-    buf = custom_bone_instance_shgroup(ctx, ctx->custom_outline, edges);
+  if (batches->edges && ctx->custom_outline) {
+    buf = custom_bone_instance_shgroup(ctx, ctx->custom_outline, batches->edges);
     OVERLAY_bone_instance_data_set_color(&inst_data, outline_color);
     DRW_buffer_add_entry_struct(buf, inst_data.mat);
   }
 
-  if (ledges) {
-    buf = custom_bone_instance_shgroup(ctx, ctx->custom_wire, ledges);
+  if (batches->ledges) {
+    buf = custom_bone_instance_shgroup(ctx, ctx->custom_wire, batches->ledges);
     OVERLAY_bone_instance_data_set_color_hint(&inst_data, outline_color);
     OVERLAY_bone_instance_data_set_color(&inst_data, outline_color);
     DRW_buffer_add_entry_struct(buf, inst_data.mat);
   }
-
-  /* TODO(fclem): needs to be moved elsewhere. */
-  drw_batch_cache_generate_requested_delayed(custom);
 }
 
 static void drw_shgroup_bone_custom_wire(ArmatureDrawContext *ctx,
@@ -687,27 +723,16 @@ static void drw_shgroup_bone_custom_wire(ArmatureDrawContext *ctx,
                                          const float color[4],
                                          Object *custom)
 {
-  /* See comments in #drw_shgroup_bone_custom_solid. */
-  Mesh *mesh = BKE_object_get_evaluated_mesh_no_subsurf(custom);
-  if (mesh == NULL) {
-    return;
-  }
-  /* TODO(fclem): arg... less than ideal but we never iter on this object
-   * to assure batch cache is valid. */
-  DRW_mesh_batch_cache_validate(custom, mesh);
+  OVERLAY_BoneCustomShapeBatches *batches = custom_bone_shape_batches_get(ctx, custom, true);
 
-  struct GPUBatch *geom = DRW_mesh_batch_cache_get_all_edges(mesh);
-  if (geom) {
-    DRWCallBuffer *buf = custom_bone_instance_shgroup(ctx, ctx->custom_wire, geom);
+  if (batches->all_edges) {
+    DRWCallBuffer *buf = custom_bone_instance_shgroup(ctx, ctx->custom_wire, batches->all_edges);
     BoneInstanceData inst_data;
     mul_m4_m4m4(inst_data.mat, ctx->ob->obmat, bone_mat);
     OVERLAY_bone_instance_data_set_color_hint(&inst_data, color);
     OVERLAY_bone_instance_data_set_color(&inst_data, color);
     DRW_buffer_add_entry_struct(buf, inst_data.mat);
   }
-
-  /* TODO(fclem): needs to be moved elsewhere. */
-  drw_batch_cache_generate_requested_delayed(custom);
 }
 
 static void drw_shgroup_bone_custom_empty(ArmatureDrawContext *ctx,
@@ -2441,6 +2466,7 @@ static void armature_context_setup(ArmatureDrawContext *ctx,
   ctx->custom_outline = cb->custom_outline;
   ctx->custom_wire = cb->custom_wire;
   ctx->custom_shapes_ghash = cb->custom_shapes_ghash;
+  ctx->custom_shapes_batch_ghash = pd->armature_custom_shapes_ghash;
   ctx->show_relations = pd->armature.show_relations;
   ctx->do_relations = !DRW_state_is_select() && pd->armature.show_relations &&
                       (is_edit_mode | is_pose_mode);
@@ -2520,6 +2546,11 @@ void OVERLAY_armature_cache_finish(OVERLAY_Data *vedata)
 {
   OVERLAY_PrivateData *pd = vedata->stl->pd;
 
+  if (pd->armature_custom_shapes_ghash) {
+    BLI_ghash_free(pd->armature_custom_shapes_ghash, NULL, MEM_freeN);
+    pd->armature_custom_shapes_ghash = NULL;
+  }
+
   for (int i = 0; i < 2; i++) {
     if (pd->armature_call_buffers[i].solid.custom_shapes_ghash) {
       /* TODO(fclem): Do not free it for each frame but reuse it. Avoiding alloc cost. */
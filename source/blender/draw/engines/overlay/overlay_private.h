@@ -234,6 +234,17 @@ typedef struct OVERLAY_ArmatureCallBuffers {
   OVERLAY_ArmatureCallBuffersInner transp;
 } OVERLAY_ArmatureCallBuffers;
 
+/** Resolved draw batches of a bone custom shape object, cached for the frame. */
+typedef struct OVERLAY_BoneCustomShapeBatches {
+  struct GPUBatch *surf;
+  struct GPUBatch *edges;
+  struct GPUBatch *ledges;
+  struct GPUBatch *all_edges;
+  /** The solid and wire drawing paths request different batches. Resolve each only once. */
+  bool solid_requested;
+  bool wire_requested;
+} OVERLAY_BoneCustomShapeBatches;
+
 typedef struct OVERLAY_PrivateData {
   DRWShadingGroup *armature_bone_select_act_grp;
   DRWShadingGroup *armature_bone_select_grp;
@@ -309,6 +320,9 @@ typedef struct OVERLAY_PrivateData {
 
   OVERLAY_ArmatureCallBuffers armature_call_buffers[2];
 
+  /** Bone custom shape batches shared by all armatures (key is the custom shape #Object). */
+  GHash *armature_custom_shapes_ghash;
+
   View3DOverlay overlay;
   enum eContextObjectMode ctx_mode;
   char space_type;
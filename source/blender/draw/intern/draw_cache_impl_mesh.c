@@ -224,6 +224,8 @@ static DRWBatchFlag g_buffer_deps_d[ARRAY_SIZE(g_buffer_deps)] = {0};
 #endif
 
 static void mesh_batch_cache_discard_surface_batches(MeshBatchCache *cache);
+static void mesh_batch_cache_discard_shaded_tri(MeshBatchCache *cache);
+static void mesh_batch_cache_free_subdiv_cache(MeshBatchCache *cache);
 static void mesh_batch_cache_clear(Mesh *me);
 
 static void mesh_batch_cache_discard_batch(MeshBatchCache *cache, const DRWBatchFlag batch_map)
@@ -795,7 +797,7 @@ BLI_INLINE void mesh_batch_cache_add_request(MeshBatchCache *cache, DRWBatchFlag
 
 /* GPUBatch cache management. */
 
-static bool mesh_batch_cache_valid(Object *object, Mesh *me)
+static bool mesh_batch_cache_valid(Mesh *me)
 {
   MeshBatchCache *cache = me->runtime.batch_cache;
 
@@ -811,10 +813,6 @@ static bool mesh_batch_cache_valid(Object *object, Mesh *me)
     return false;
   }
 
-  if (cache->mat_len != mesh_render_mat_len_get(object, me)) {
-    return false;
-  }
-
   return true;
 }
 
@@ -849,12 +847,48 @@ static void mesh_batch_cache_init(Object *object, Mesh *me)
   drw_mesh_weight_state_clear(&cache->weight_state);
 }
 
+/* Discard only the data which depends on the material slots and resize the per-material arrays,
+ * so a change in material count does not throw away the rest of the extracted buffers. */
+static void mesh_batch_cache_update_mat_len(MeshBatchCache *cache, Object *object, Mesh *me)
+{
+  const int mat_len = mesh_render_mat_len_get(object, me);
+  if (cache->mat_len == mat_len) {
+    return;
+  }
+
+  /* The triangle index buffer is sorted by material, and the shading data depends on which
+   * layers the used materials request. */
+  FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+    GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.tris);
+    MEM_SAFE_FREE(mbc->poly_sorted.tri_first_index);
+    MEM_SAFE_FREE(mbc->poly_sorted.mat_tri_len);
+    mbc->poly_sorted.visible_tri_len = 0;
+  }
+  DRWBatchFlag batch_map = BATCH_MAP(ibo.tris) | SURFACE_PER_MAT_FLAG;
+  mesh_batch_cache_discard_batch(cache, batch_map);
+  mesh_batch_cache_discard_shaded_tri(cache);
+  /* The subdivision cache stores per-material triangle ranges as well. */
+  mesh_batch_cache_free_subdiv_cache(cache);
+
+  for (int i = 0; i < cache->mat_len; i++) {
+    GPU_INDEXBUF_DISCARD_SAFE(cache->tris_per_mat[i]);
+  }
+  MEM_SAFE_FREE(cache->tris_per_mat);
+  MEM_SAFE_FREE(cache->surface_per_mat);
+
+  cache->mat_len = mat_len;
+  cache->surface_per_mat = MEM_callocN(sizeof(*cache->surface_per_mat) * cache->mat_len, __func__);
+  cache->tris_per_mat = MEM_callocN(sizeof(*cache->tris_per_mat) * cache->mat_len, __func__);
+}
+
 void DRW_mesh_batch_cache_validate(Object *object, Mesh *me)
 {
-  if (!mesh_batch_cache_valid(object, me)) {
+  if (!mesh_batch_cache_valid(me)) {
     mesh_batch_cache_clear(me);
     mesh_batch_cache_init(object, me);
+    return;
   }
+  mesh_batch_cache_update_mat_len(me->runtime.batch_cache, object, me);
 }
 
 static MeshBatchCache *mesh_batch_cache_get(Mesh *me)
@@ -301,28 +301,57 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
    * created. */
   const bool was_loaded = BKE_volume_grid_is_loaded(grid);
 
-  DenseFloatVolumeGrid dense_grid;
-  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid)) {
-    copy_m4_m4(cache_grid->texture_to_object, dense_grid.texture_to_object);
-    invert_m4_m4(cache_grid->object_to_texture, dense_grid.texture_to_object);
-
-    /* Create GPU texture. */
-    eGPUTextureFormat format = (channels == 3) ? GPU_RGB16F : GPU_R16F;
-    cache_grid->texture = GPU_texture_create_3d("volume_grid",
-                                                UNPACK3(dense_grid.resolution),
-                                                1,
-                                                format,
-                                                GPU_DATA_FLOAT,
-                                                dense_grid.voxels);
-    /* The texture can be null if the resolution along one axis is larger than
-     * GL_MAX_3D_TEXTURE_SIZE. */
+  int resolution[3];
+  float texture_to_object[4][4];
+  if (BKE_volume_grid_dense_resolution(volume, grid, resolution, texture_to_object)) {
+    /* Check the resolution along each axis against GL_MAX_3D_TEXTURE_SIZE up front,
+     * instead of extracting a dense copy that can never become a texture. */
+    if (max_iii(UNPACK3(resolution)) <= GPU_max_texture_3d_size()) {
+      copy_m4_m4(cache_grid->texture_to_object, texture_to_object);
+      invert_m4_m4(cache_grid->object_to_texture, texture_to_object);
+
+      /* Create GPU texture. */
+      eGPUTextureFormat format = (channels == 3) ? GPU_RGB16F : GPU_R16F;
+      cache_grid->texture = GPU_texture_create_3d(
+          "volume_grid", UNPACK3(resolution), 1, format, GPU_DATA_FLOAT, NULL);
+    }
+
     if (cache_grid->texture != NULL) {
-      GPU_texture_swizzle_set(cache_grid->texture, (channels == 3) ? "rgb1" : "rrr1");
-      GPU_texture_wrap_mode(cache_grid->texture, false, false);
-      BKE_volume_dense_float_grid_clear(&dense_grid);
+      /* Extract and upload the voxels one slab of slices at a time, so that the peak host
+       * memory use stays bounded: a full dense copy of a large grid can be many times the
+       * size of the final 16 bit float texture. */
+      const size_t slice_size = sizeof(float) * channels * (size_t)resolution[0] *
+                                (size_t)resolution[1];
+      const size_t slab_size_limit = 128 * 1024 * 1024;
+      const int slab_slices = clamp_i((int)(slab_size_limit / slice_size), 1, resolution[2]);
+
+      float *voxels = MEM_malloc_arrayN(slab_slices, slice_size, __func__);
+      if (voxels != NULL) {
+        for (int slice_z = 0; slice_z < resolution[2]; slice_z += slab_slices) {
+          const int slices_num = min_ii(slab_slices, resolution[2] - slice_z);
+          BKE_volume_grid_dense_voxels(volume, grid, slice_z, slices_num, voxels);
+          GPU_texture_update_sub(cache_grid->texture,
+                                 GPU_DATA_FLOAT,
+                                 voxels,
+                                 0,
+                                 0,
+                                 slice_z,
+                                 resolution[0],
+                                 resolution[1],
+                                 slices_num);
+        }
+        MEM_freeN(voxels);
+
+        GPU_texture_swizzle_set(cache_grid->texture, (channels == 3) ? "rgb1" : "rrr1");
+        GPU_texture_wrap_mode(cache_grid->texture, false, false);
+      }
+      else {
+        GPU_texture_free(cache_grid->texture);
+        cache_grid->texture = NULL;
+      }
     }
-    else {
-      MEM_freeN(dense_grid.voxels);
+
+    if (cache_grid->texture == NULL) {
       printf("Error: Could not allocate 3D texture for volume.\n");
     }
   }
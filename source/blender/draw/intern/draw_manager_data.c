@@ -48,10 +48,9 @@ static void draw_call_sort(DRWCommand *array, DRWCommand *array_tmp, int array_l
    * there is collisions. If there is a lot of different batches,
    * the sorting benefit will be negligible.
    * So at least sort fast! */
-  uchar idx[128] = {0};
+  uint idx[128] = {0};
   /* Shift by 6 positions knowing each GPUBatch is > 64 bytes */
 #define KEY(a) ((((size_t)((a).draw.batch)) >> 6) % ARRAY_SIZE(idx))
-  BLI_assert(array_len <= ARRAY_SIZE(idx));
 
   for (int i = 0; i < array_len; i++) {
     /* Early out if nothing to sort. */
@@ -72,6 +71,17 @@ static void draw_call_sort(DRWCommand *array, DRWCommand *array_tmp, int array_l
   memcpy(array, array_tmp, sizeof(*array) * array_len);
 }
 
+static bool draw_command_chunk_is_sortable(const DRWCommandChunk *chunk)
+{
+  /* We can only sort chunks that contain #DRWCommandDraw only. */
+  for (int i = 0; i < ARRAY_SIZE(chunk->command_type); i++) {
+    if (chunk->command_type[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void drw_resource_buffer_finish(DRWData *vmempool)
 {
   int chunk_id = DRW_handle_chunk_get(&DST.resource_handle);
@@ -116,24 +126,61 @@ void drw_resource_buffer_finish(DRWData *vmempool)
 
   DRW_uniform_attrs_pool_flush_all(vmempool->obattrs_ubo_pool);
 
-  /* Aligned alloc to avoid unaligned memcpy. */
-  DRWCommandChunk *chunk_tmp = MEM_mallocN_aligned(sizeof(DRWCommandChunk), 16, "tmp call chunk");
-  DRWCommandChunk *chunk;
+  /* Sort the drawcalls of each shading group so that calls sharing a batch end up next to each
+   * other. This lets `draw_call_batching_do` merge them into instanced draws and accumulate the
+   * merged ranges into the same multi-draw-indirect command buffer instead of interrupting it on
+   * every batch change. Runs of chunks containing #DRWCommandDraw only are sorted as a whole:
+   * other command types are barriers the draws may not be reordered across. Sorting across chunk
+   * boundaries matters for shading groups with more calls than fit inside one chunk, otherwise
+   * each chunk re-interleaves the batches all over again. */
+  DRWCommand *array = NULL, *array_tmp = NULL;
+  uint array_len = 0;
+  DRWPass *pass;
   BLI_memblock_iter iter;
-  BLI_memblock_iternew(vmempool->commands, &iter);
-  while ((chunk = BLI_memblock_iterstep(&iter))) {
-    bool sortable = true;
-    /* We can only sort chunks that contain #DRWCommandDraw only. */
-    for (int i = 0; i < ARRAY_SIZE(chunk->command_type) && sortable; i++) {
-      if (chunk->command_type[i] != 0) {
-        sortable = false;
+  BLI_memblock_iternew(vmempool->passes, &iter);
+  while ((pass = BLI_memblock_iterstep(&iter))) {
+    for (DRWShadingGroup *shgroup = pass->shgroups.first; shgroup; shgroup = shgroup->next) {
+      DRWCommandChunk *chunk = shgroup->cmd.first;
+      while (chunk) {
+        if (!draw_command_chunk_is_sortable(chunk)) {
+          chunk = chunk->next;
+          continue;
+        }
+        /* Gather the longest run of sortable chunks. */
+        DRWCommandChunk *run_start = chunk;
+        uint run_len = 0;
+        do {
+          run_len += chunk->command_used;
+          chunk = chunk->next;
+        } while (chunk && draw_command_chunk_is_sortable(chunk));
+
+        if (run_len < 2) {
+          continue;
+        }
+        if (run_len > array_len) {
+          MEM_SAFE_FREE(array);
+          MEM_SAFE_FREE(array_tmp);
+          /* Aligned alloc to avoid unaligned memcpy. */
+          array = MEM_mallocN_aligned(sizeof(DRWCommand) * run_len, 16, "sort array");
+          array_tmp = MEM_mallocN_aligned(sizeof(DRWCommand) * run_len, 16, "tmp sort array");
+          array_len = run_len;
+        }
+        uint command_offset = 0;
+        for (DRWCommandChunk *c = run_start; c != chunk; c = c->next) {
+          memcpy(array + command_offset, c->commands, sizeof(DRWCommand) * c->command_used);
+          command_offset += c->command_used;
+        }
+        draw_call_sort(array, array_tmp, run_len);
+        command_offset = 0;
+        for (DRWCommandChunk *c = run_start; c != chunk; c = c->next) {
+          memcpy(c->commands, array + command_offset, sizeof(DRWCommand) * c->command_used);
+          command_offset += c->command_used;
+        }
       }
     }
-    if (sortable) {
-      draw_call_sort(chunk->commands, chunk_tmp->commands, chunk->command_used);
-    }
   }
-  MEM_freeN(chunk_tmp);
+  MEM_SAFE_FREE(array);
+  MEM_SAFE_FREE(array_tmp);
 }
 
 /** \} */
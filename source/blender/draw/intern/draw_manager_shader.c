@@ -11,6 +11,7 @@
 
 #include "BLI_dynstr.h"
 #include "BLI_listbase.h"
+#include "BLI_math_base.h"
 #include "BLI_string_utils.h"
 #include "BLI_threads.h"
 
@@ -48,24 +49,40 @@ extern char datatoc_common_fullscreen_vert_glsl[];
  *
  * \{ */
 
+/* Maximum number of worker contexts of one compilation job. Each context lets the driver compile
+ * on its own thread, more than a few gives diminishing returns for added memory usage. */
+#define DRW_SHADER_COMPILE_WORKERS_MAX 4
+
 typedef struct DRWDeferredShader {
   struct DRWDeferredShader *prev, *next;
 
   GPUMaterial *mat;
 } DRWDeferredShader;
 
-typedef struct DRWShaderCompiler {
-  ListBase queue;          /* DRWDeferredShader */
-  ListBase queue_conclude; /* DRWDeferredShader */
-  SpinLock list_lock;
+typedef struct DRWShaderCompilerWorker {
+  struct DRWShaderCompiler *comp;
 
   DRWDeferredShader *mat_compiling;
   ThreadMutex compilation_lock;
 
   void *gl_context;
   GPUContext *gpu_context;
+} DRWShaderCompilerWorker;
+
+typedef struct DRWShaderCompiler {
+  ListBase queue;          /* DRWDeferredShader */
+  ListBase queue_conclude; /* DRWDeferredShader */
+  SpinLock list_lock;
+
+  DRWShaderCompilerWorker workers[DRW_SHADER_COMPILE_WORKERS_MAX];
+  int workers_len; /* Always 1 when using the main context workaround. */
   bool own_context;
 
+  /* Job runtime, shared by all the workers. */
+  short *stop;
+  short *do_update;
+  float *progress;
+
   int shaders_done; /* To compute progress. */
 } DRWShaderCompiler;
 
@@ -83,34 +100,20 @@ static void drw_deferred_shader_queue_free(ListBase *queue)
   }
 }
 
-static void drw_deferred_shader_compilation_exec(
-    void *custom_data,
-    /* Cannot be const, this function implements wm_jobs_start_callback.
-     * NOLINTNEXTLINE: readability-non-const-parameter. */
-    short *stop,
-    short *do_update,
-    float *progress)
+static void drw_deferred_shader_compilation_worker_run(DRWShaderCompilerWorker *worker)
 {
-  DRWShaderCompiler *comp = (DRWShaderCompiler *)custom_data;
-  void *gl_context = comp->gl_context;
-  GPUContext *gpu_context = comp->gpu_context;
+  DRWShaderCompiler *comp = worker->comp;
 
-  BLI_assert(gl_context != NULL);
-  BLI_assert(gpu_context != NULL);
+  BLI_assert(worker->gl_context != NULL);
+  BLI_assert(worker->gpu_context != NULL);
 
-  const bool use_main_context_workaround = GPU_use_main_context_workaround();
-  if (use_main_context_workaround) {
-    BLI_assert(gl_context == DST.gl_context);
-    GPU_context_main_lock();
-  }
-
-  WM_opengl_context_activate(gl_context);
-  GPU_context_active_set(gpu_context);
+  WM_opengl_context_activate(worker->gl_context);
+  GPU_context_active_set(worker->gpu_context);
 
   while (true) {
     BLI_spin_lock(&comp->list_lock);
 
-    if (*stop != 0) {
+    if (*comp->stop != 0) {
       /* We don't want user to be able to cancel the compilation
        * but wm can kill the task if we are closing blender. */
       BLI_spin_unlock(&comp->list_lock);
@@ -119,8 +122,8 @@ static void drw_deferred_shader_compilation_exec(
 
     /* Pop tail because it will be less likely to lock the main thread
      * if all GPUMaterials are to be freed (see DRW_deferred_shader_remove()). */
-    comp->mat_compiling = BLI_poptail(&comp->queue);
-    if (comp->mat_compiling == NULL) {
+    worker->mat_compiling = BLI_poptail(&comp->queue);
+    if (worker->mat_compiling == NULL) {
       /* No more Shader to compile. */
       BLI_spin_unlock(&comp->list_lock);
       break;
@@ -129,31 +132,80 @@ static void drw_deferred_shader_compilation_exec(
     comp->shaders_done++;
     int total = BLI_listbase_count(&comp->queue) + comp->shaders_done;
 
-    BLI_mutex_lock(&comp->compilation_lock);
+    BLI_mutex_lock(&worker->compilation_lock);
     BLI_spin_unlock(&comp->list_lock);
 
     /* Do the compilation. */
-    GPU_material_compile(comp->mat_compiling->mat);
+    GPU_material_compile(worker->mat_compiling->mat);
 
-    *progress = (float)comp->shaders_done / (float)total;
-    *do_update = true;
+    *comp->progress = (float)comp->shaders_done / (float)total;
+    *comp->do_update = true;
 
     GPU_flush();
-    BLI_mutex_unlock(&comp->compilation_lock);
+    BLI_mutex_unlock(&worker->compilation_lock);
 
     BLI_spin_lock(&comp->list_lock);
-    if (GPU_material_status(comp->mat_compiling->mat) == GPU_MAT_QUEUED) {
-      BLI_addtail(&comp->queue_conclude, comp->mat_compiling);
+    if (GPU_material_status(worker->mat_compiling->mat) == GPU_MAT_QUEUED) {
+      BLI_addtail(&comp->queue_conclude, worker->mat_compiling);
     }
     else {
-      drw_deferred_shader_free(comp->mat_compiling);
+      drw_deferred_shader_free(worker->mat_compiling);
     }
-    comp->mat_compiling = NULL;
+    worker->mat_compiling = NULL;
     BLI_spin_unlock(&comp->list_lock);
   }
 
   GPU_context_active_set(NULL);
-  WM_opengl_context_release(gl_context);
+  WM_opengl_context_release(worker->gl_context);
+}
+
+static void *drw_deferred_shader_compilation_thread(void *custom_data)
+{
+  drw_deferred_shader_compilation_worker_run((DRWShaderCompilerWorker *)custom_data);
+  return NULL;
+}
+
+static void drw_deferred_shader_compilation_exec(
+    void *custom_data,
+    /* Cannot be const, this function implements wm_jobs_start_callback.
+     * NOLINTNEXTLINE: readability-non-const-parameter. */
+    short *stop,
+    short *do_update,
+    float *progress)
+{
+  DRWShaderCompiler *comp = (DRWShaderCompiler *)custom_data;
+
+  BLI_assert(comp->workers_len > 0);
+
+  comp->stop = stop;
+  comp->do_update = do_update;
+  comp->progress = progress;
+  for (int i = 0; i < comp->workers_len; i++) {
+    comp->workers[i].comp = comp;
+  }
+
+  const bool use_main_context_workaround = GPU_use_main_context_workaround();
+  if (use_main_context_workaround) {
+    BLI_assert(comp->workers_len == 1);
+    BLI_assert(comp->workers[0].gl_context == DST.gl_context);
+    GPU_context_main_lock();
+  }
+
+  if (comp->workers_len > 1) {
+    /* The workers all pull from the same queue, each one compiling in its own context so the
+     * driver can process them concurrently. This thread runs the first worker itself. */
+    ListBase threadbase = {NULL, NULL};
+    BLI_threadpool_init(&threadbase, drw_deferred_shader_compilation_thread, comp->workers_len - 1);
+    for (int i = 1; i < comp->workers_len; i++) {
+      BLI_threadpool_insert(&threadbase, &comp->workers[i]);
+    }
+    drw_deferred_shader_compilation_worker_run(&comp->workers[0]);
+    BLI_threadpool_end(&threadbase);
+  }
+  else {
+    drw_deferred_shader_compilation_worker_run(&comp->workers[0]);
+  }
+
   if (use_main_context_workaround) {
     GPU_context_main_unlock();
   }
@@ -177,14 +229,18 @@ static void drw_deferred_shader_compilation_free(void *custom_data)
   }
 
   BLI_spin_end(&comp->list_lock);
-  BLI_mutex_end(&comp->compilation_lock);
+  for (int i = 0; i < comp->workers_len; i++) {
+    BLI_mutex_end(&comp->workers[i].compilation_lock);
+  }
 
   if (comp->own_context) {
-    /* Only destroy if the job owns the context. */
-    WM_opengl_context_activate(comp->gl_context);
-    GPU_context_active_set(comp->gpu_context);
-    GPU_context_discard(comp->gpu_context);
-    WM_opengl_context_dispose(comp->gl_context);
+    /* Only destroy if the job owns the contexts. */
+    for (int i = 0; i < comp->workers_len; i++) {
+      WM_opengl_context_activate(comp->workers[i].gl_context);
+      GPU_context_active_set(comp->workers[i].gpu_context);
+      GPU_context_discard(comp->workers[i].gpu_context);
+      WM_opengl_context_dispose(comp->workers[i].gl_context);
+    }
 
     wm_window_reset_drawable();
   }
@@ -227,16 +283,18 @@ static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 
   DRWShaderCompiler *comp = MEM_callocN(sizeof(DRWShaderCompiler), "DRWShaderCompiler");
   BLI_spin_init(&comp->list_lock);
-  BLI_mutex_init(&comp->compilation_lock);
 
   if (old_comp) {
     BLI_spin_lock(&old_comp->list_lock);
     BLI_movelisttolist(&comp->queue, &old_comp->queue);
     BLI_spin_unlock(&old_comp->list_lock);
-    /* Do not recreate context, just pass ownership. */
-    if (old_comp->gl_context) {
-      comp->gl_context = old_comp->gl_context;
-      comp->gpu_context = old_comp->gpu_context;
+    /* Do not recreate contexts, just pass ownership. */
+    if (old_comp->workers_len > 0) {
+      for (int i = 0; i < old_comp->workers_len; i++) {
+        comp->workers[i].gl_context = old_comp->workers[i].gl_context;
+        comp->workers[i].gpu_context = old_comp->workers[i].gpu_context;
+      }
+      comp->workers_len = old_comp->workers_len;
       old_comp->own_context = false;
       comp->own_context = job_own_context;
     }
@@ -244,23 +302,31 @@ static void drw_deferred_shader_add(GPUMaterial *mat, bool deferred)
 
   BLI_addtail(&comp->queue, dsh);
 
-  /* Create only one context. */
-  if (comp->gl_context == NULL) {
+  /* Create the contexts only once. */
+  if (comp->workers_len == 0) {
     if (use_main_context) {
-      comp->gl_context = DST.gl_context;
-      comp->gpu_context = DST.gpu_context;
+      comp->workers[0].gl_context = DST.gl_context;
+      comp->workers[0].gpu_context = DST.gpu_context;
+      comp->workers_len = 1;
     }
     else {
-      comp->gl_context = WM_opengl_context_create();
-      comp->gpu_context = GPU_context_create(NULL);
-      GPU_context_active_set(NULL);
-
+      comp->workers_len = min_ii(DRW_SHADER_COMPILE_WORKERS_MAX,
+                                 max_ii(1, BLI_system_thread_count() / 2));
+      for (int i = 0; i < comp->workers_len; i++) {
+        comp->workers[i].gl_context = WM_opengl_context_create();
+        comp->workers[i].gpu_context = GPU_context_create(NULL);
+        GPU_context_active_set(NULL);
+      }
       WM_opengl_context_activate(DST.gl_context);
       GPU_context_active_set(DST.gpu_context);
     }
     comp->own_context = job_own_context;
   }
 
+  for (int i = 0; i < comp->workers_len; i++) {
+    BLI_mutex_init(&comp->workers[i].compilation_lock);
+  }
+
   WM_jobs_customdata_set(wm_job, comp, drw_deferred_shader_compilation_free);
   WM_jobs_timer(wm_job, 0.1, NC_MATERIAL | ND_SHADING_DRAW, 0);
   WM_jobs_delay_start(wm_job, 0.1);
@@ -295,9 +361,13 @@ void DRW_deferred_shader_remove(GPUMaterial *mat)
         }
 
         /* Wait for compilation to finish */
-        if ((comp->mat_compiling != NULL) && (comp->mat_compiling->mat == mat)) {
-          BLI_mutex_lock(&comp->compilation_lock);
-          BLI_mutex_unlock(&comp->compilation_lock);
+        for (int i = 0; i < comp->workers_len; i++) {
+          DRWShaderCompilerWorker *worker = &comp->workers[i];
+          if ((worker->mat_compiling != NULL) && (worker->mat_compiling->mat == mat)) {
+            BLI_mutex_lock(&worker->compilation_lock);
+            BLI_mutex_unlock(&worker->compilation_lock);
+            break;
+          }
         }
 
         BLI_spin_unlock(&comp->list_lock);
@@ -264,7 +264,9 @@ constexpr MeshExtract create_extractor_edituv_edituv_stretch_angle()
   extractor.init_subdiv = extract_edituv_stretch_angle_init_subdiv;
   extractor.data_type = MR_DATA_NONE;
   extractor.data_size = sizeof(MeshExtract_StretchAngle_Data);
-  extractor.use_threading = false;
+  /* The edge vectors in the task data never carry over between polygons, and every polygon writes
+   * its own loop range, so the poly iteration can run over parallel ranges. */
+  extractor.use_threading = true;
   extractor.mesh_buffer_offset = offsetof(MeshBufferList, vbo.edituv_stretch_angle);
   return extractor;
 }
@@ -19,10 +19,18 @@ namespace blender::draw {
 /** \name Extract Edit UV area stretch
  * \{ */
 
+struct MeshExtract_StretchArea_Data {
+  uint16_t *vbo_data;
+  const MLoopUV *luv;
+  int cd_ofs;
+  /* Accumulated per task, the reduction sums them into the chunk passed to `finish`. */
+  float tot_area, tot_uv_area;
+};
+
 static void extract_edituv_stretch_area_init(const MeshRenderData *mr,
                                              struct MeshBatchCache *UNUSED(cache),
                                              void *buf,
-                                             void *UNUSED(tls_data))
+                                             void *tls_data)
 {
   GPUVertBuf *vbo = static_cast<GPUVertBuf *>(buf);
   static GPUVertFormat format = {0};
@@ -32,6 +40,17 @@ static void extract_edituv_stretch_area_init(const MeshRenderData *mr,
 
   GPU_vertbuf_init_with_format(vbo, &format);
   GPU_vertbuf_data_alloc(vbo, mr->loop_len);
+
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(tls_data);
+  data->vbo_data = (uint16_t *)GPU_vertbuf_get_data(vbo);
+
+  if (mr->extract_type == MR_EXTRACT_BMESH) {
+    data->cd_ofs = CustomData_get_offset(&mr->bm->ldata, CD_MLOOPUV);
+  }
+  else {
+    BLI_assert(ELEM(mr->extract_type, MR_EXTRACT_MAPPED, MR_EXTRACT_MESH));
+    data->luv = (const MLoopUV *)CustomData_get_layer(&mr->me->ldata, CD_MLOOPUV);
+  }
 }
 
 BLI_INLINE float area_ratio_get(float area, float uvarea)
@@ -88,45 +107,61 @@ static void compute_area_ratio(const MeshRenderData *mr,
   r_tot_uv_area = tot_uv_area;
 }
 
-static void extract_edituv_stretch_area_finish(const MeshRenderData *mr,
-                                               struct MeshBatchCache *cache,
-                                               void *buf,
-                                               void *UNUSED(data))
+static void extract_edituv_stretch_area_iter_poly_bm(const MeshRenderData *UNUSED(mr),
+                                                     const BMFace *f,
+                                                     const int UNUSED(f_index),
+                                                     void *_data)
 {
-  GPUVertBuf *vbo = static_cast<GPUVertBuf *>(buf);
-  float *area_ratio = static_cast<float *>(MEM_mallocN(sizeof(float) * mr->poly_len, __func__));
-  compute_area_ratio(mr, area_ratio, cache->tot_area, cache->tot_uv_area);
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(_data);
+  const float area = BM_face_calc_area(f);
+  const float uvarea = BM_face_calc_area_uv(f, data->cd_ofs);
+  data->tot_area += area;
+  data->tot_uv_area += uvarea;
+
+  const uint16_t stretch = area_ratio_get(area, uvarea) * SHRT_MAX;
+  BMLoop *l_iter, *l_first;
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    data->vbo_data[BM_elem_index_get(l_iter)] = stretch;
+  } while ((l_iter = l_iter->next) != l_first);
+}
 
-  /* Convert in place to avoid an extra allocation */
-  uint16_t *poly_stretch = (uint16_t *)area_ratio;
-  for (int mp_index = 0; mp_index < mr->poly_len; mp_index++) {
-    poly_stretch[mp_index] = area_ratio[mp_index] * SHRT_MAX;
+static void extract_edituv_stretch_area_iter_poly_mesh(const MeshRenderData *mr,
+                                                       const MPoly *mp,
+                                                       const int UNUSED(mp_index),
+                                                       void *_data)
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(_data);
+  const float area = BKE_mesh_calc_poly_area(mp, &mr->mloop[mp->loopstart], mr->mvert);
+  const float uvarea = BKE_mesh_calc_poly_uv_area(mp, data->luv);
+  data->tot_area += area;
+  data->tot_uv_area += uvarea;
+
+  const uint16_t stretch = area_ratio_get(area, uvarea) * SHRT_MAX;
+  for (int i = 0; i < mp->totloop; i++) {
+    data->vbo_data[mp->loopstart + i] = stretch;
   }
+}
 
-  /* Copy face data for each loop. */
-  uint16_t *loop_stretch = (uint16_t *)GPU_vertbuf_get_data(vbo);
-
-  if (mr->extract_type == MR_EXTRACT_BMESH) {
-    BMFace *efa;
-    BMIter f_iter;
-    int f, l_index = 0;
-    BM_ITER_MESH_INDEX (efa, &f_iter, mr->bm, BM_FACES_OF_MESH, f) {
-      for (int i = 0; i < efa->len; i++, l_index++) {
-        loop_stretch[l_index] = poly_stretch[f];
-      }
-    }
-  }
-  else {
-    BLI_assert(ELEM(mr->extract_type, MR_EXTRACT_MAPPED, MR_EXTRACT_MESH));
-    const MPoly *mp = mr->mpoly;
-    for (int mp_index = 0, l_index = 0; mp_index < mr->poly_len; mp_index++, mp++) {
-      for (int i = 0; i < mp->totloop; i++, l_index++) {
-        loop_stretch[l_index] = poly_stretch[mp_index];
-      }
-    }
-  }
+static void extract_edituv_stretch_area_task_reduce(void *_userdata_to, void *_userdata_from)
+{
+  MeshExtract_StretchArea_Data *data_to = static_cast<MeshExtract_StretchArea_Data *>(
+      _userdata_to);
+  MeshExtract_StretchArea_Data *data_from = static_cast<MeshExtract_StretchArea_Data *>(
+      _userdata_from);
+  data_to->tot_area += data_from->tot_area;
+  data_to->tot_uv_area += data_from->tot_uv_area;
+}
 
-  MEM_freeN(area_ratio);
+static void extract_edituv_stretch_area_finish(const MeshRenderData *UNUSED(mr),
+                                               struct MeshBatchCache *cache,
+                                               void *UNUSED(buf),
+                                               void *_data)
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(_data);
+  /* The total areas are used by the shader to compute the global area ratio. */
+  cache->tot_area = data->tot_area;
+  cache->tot_uv_area = data->tot_uv_area;
 }
 
 static void extract_edituv_stretch_area_init_subdiv(const DRWSubdivCache *subdiv_cache,
@@ -167,11 +202,14 @@ constexpr MeshExtract create_extractor_edituv_stretch_area()
 {
   MeshExtract extractor = {nullptr};
   extractor.init = extract_edituv_stretch_area_init;
+  extractor.iter_poly_bm = extract_edituv_stretch_area_iter_poly_bm;
+  extractor.iter_poly_mesh = extract_edituv_stretch_area_iter_poly_mesh;
+  extractor.task_reduce = extract_edituv_stretch_area_task_reduce;
   extractor.finish = extract_edituv_stretch_area_finish;
   extractor.init_subdiv = extract_edituv_stretch_area_init_subdiv;
   extractor.data_type = MR_DATA_NONE;
-  extractor.data_size = 0;
-  extractor.use_threading = false;
+  extractor.data_size = sizeof(MeshExtract_StretchArea_Data);
+  extractor.use_threading = true;
   extractor.mesh_buffer_offset = offsetof(MeshBufferList, vbo.edituv_stretch_area);
   return extractor;
 }
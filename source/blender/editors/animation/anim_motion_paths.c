@@ -11,6 +11,7 @@
 #include "BLI_dlrbTree.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "DNA_anim_types.h"
 #include "DNA_armature_types.h"
@@ -122,8 +123,12 @@ void animviz_get_object_motionpaths(Object *ob, ListBase *targets)
 
 /* ........ */
 
-/* perform baking for the targets on the current frame */
-static void motionpaths_calc_bake_targets(ListBase *targets, int cframe)
+/* Perform baking for the targets on the current frame.
+ *
+ * \param sync_eval_copies: update the motion paths of the evaluated copies as well, for fast
+ * updating while dragging in transform. Must be false on worker threads, since discarding the
+ * old draw batches is not thread safe. */
+static void motionpaths_calc_bake_targets(ListBase *targets, int cframe, bool sync_eval_copies)
 {
   MPathTarget *mpt;
 
@@ -178,6 +183,10 @@ static void motionpaths_calc_bake_targets(ListBase *targets, int cframe)
       mpv->flag &= ~MOTIONPATH_VERT_KEY;
     }
 
+    if (!sync_eval_copies) {
+      continue;
+    }
+
     /* Incremental update on evaluated object if possible, for fast updating
      * while dragging in transform. */
     bMotionPath *mpath_eval = NULL;
@@ -340,6 +349,75 @@ static void motionpath_free_free_tree_data(ListBase *targets)
   }
 }
 
+/* A disjoint sub-range of the frame range, baked on its own dependency graph so that several
+ * ranges can be evaluated concurrently. */
+typedef struct MotionPathBakeChunk {
+  struct MotionPathBakeChunk *next, *prev;
+
+  struct Depsgraph *depsgraph;
+  /* Shallow per-chunk copies of the targets, so every chunk can resolve its own evaluated
+   * objects. The key-lists and motion paths are shared with the original target list. */
+  ListBase targets;
+
+  int sfra, efra;
+} MotionPathBakeChunk;
+
+/* Baking a chunk means a full depsgraph evaluation per frame, so even short sub-ranges are worth
+ * a thread; the limiting factor is the cost of building and copying a graph per chunk. */
+#define MOTIONPATH_MIN_FRAMES_PER_CHUNK 16
+
+static void motionpath_bake_chunk_func(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  MotionPathBakeChunk *chunk = taskdata;
+
+  LISTBASE_FOREACH (MPathTarget *, mpt, &chunk->targets) {
+    mpt->ob_eval = DEG_get_evaluated_object(chunk->depsgraph, mpt->ob);
+  }
+
+  for (int cframe = chunk->sfra; cframe <= chunk->efra; cframe++) {
+    DEG_evaluate_on_framechange(chunk->depsgraph, (float)cframe);
+    motionpaths_calc_bake_targets(&chunk->targets, cframe, false);
+  }
+}
+
+/* Bake the given frame range by splitting it over multiple dependency graph instances, each
+ * evaluating a disjoint sub-range. Every frame writes to its own bMotionPath vertex, so the
+ * chunks do not contend with each other. */
+static void motionpaths_calc_bake_parallel(
+    Main *bmain, Scene *scene, ViewLayer *view_layer, ListBase *targets, int sfra, int efra)
+{
+  const int num_frames = efra - sfra + 1;
+  const int num_chunks = min_ii(BLI_task_scheduler_num_threads(),
+                                num_frames / MOTIONPATH_MIN_FRAMES_PER_CHUNK);
+
+  ListBase chunks = {NULL, NULL};
+
+  /* Suspended, so no chunk starts evaluating while graphs are still being built: building reads
+   * the original data and is not safe against concurrent use of it. */
+  TaskPool *task_pool = BLI_task_pool_create_suspended(NULL, TASK_PRIORITY_HIGH);
+
+  for (int i = 0; i < num_chunks; i++) {
+    MotionPathBakeChunk *chunk = MEM_callocN(sizeof(MotionPathBakeChunk), "MotionPathBakeChunk");
+    chunk->sfra = sfra + (num_frames * i) / num_chunks;
+    chunk->efra = sfra + (num_frames * (i + 1)) / num_chunks - 1;
+
+    BLI_duplicatelist(&chunk->targets, targets);
+    chunk->depsgraph = animviz_depsgraph_build(bmain, scene, view_layer, &chunk->targets);
+
+    BLI_addtail(&chunks, chunk);
+    BLI_task_pool_push(task_pool, motionpath_bake_chunk_func, chunk, false, NULL);
+  }
+
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
+
+  LISTBASE_FOREACH (MotionPathBakeChunk *, chunk, &chunks) {
+    DEG_graph_free(chunk->depsgraph);
+    BLI_freelistN(&chunk->targets);
+  }
+  BLI_freelistN(&chunks);
+}
+
 void animviz_calc_motionpaths(Depsgraph *depsgraph,
                               Main *bmain,
                               Scene *scene,
@@ -448,18 +526,27 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
             sfra,
             efra,
             efra - sfra + 1);
-  for (CFRA = sfra; CFRA <= efra; CFRA++) {
-    if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
-      /* For current frame, only update tagged. */
-      BKE_scene_graph_update_tagged(depsgraph, bmain);
-    }
-    else {
-      /* Update relevant data for new frame. */
-      motionpaths_calc_update_scene(depsgraph);
-    }
+  if (range != ANIMVIZ_CALC_RANGE_CURRENT_FRAME &&
+      (efra - sfra + 1) >= 2 * MOTIONPATH_MIN_FRAMES_PER_CHUNK) {
+    /* Long bakes are split into disjoint sub-ranges which evaluate concurrently, each on its own
+     * dependency graph instance. The global current frame is left untouched. */
+    motionpaths_calc_bake_parallel(
+        bmain, scene, DEG_get_input_view_layer(depsgraph), targets, sfra, efra);
+  }
+  else {
+    for (CFRA = sfra; CFRA <= efra; CFRA++) {
+      if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
+        /* For current frame, only update tagged. */
+        BKE_scene_graph_update_tagged(depsgraph, bmain);
+      }
+      else {
+        /* Update relevant data for new frame. */
+        motionpaths_calc_update_scene(depsgraph);
+      }
 
-    /* perform baking for targets */
-    motionpaths_calc_bake_targets(targets, CFRA);
+      /* perform baking for targets */
+      motionpaths_calc_bake_targets(targets, CFRA, true);
+    }
   }
 
   /* reset original environment */
@@ -81,6 +81,24 @@ constexpr StringRef ATTRIBUTE_ENTRIES_PROPERTIES("properties");
 
 /** Abstract class for #BlendFile and #AssetIndexFile. */
 class AbstractFile {
+ private:
+  /* Cached stat of the file. Each listed blend file is checked for existence, size and age, and
+   * asset libraries commonly live on network storage where every stat is a round-trip; a single
+   * cached stat serves all checks. Instances are short-lived, so staleness isn't a concern. */
+  mutable BLI_stat_t stat_;
+  mutable bool stat_cached_ = false;
+  mutable bool stat_valid_ = false;
+
+ public:
+  const BLI_stat_t *get_stat() const
+  {
+    if (!stat_cached_) {
+      stat_valid_ = (BLI_stat(get_file_path(), &stat_) != -1);
+      stat_cached_ = true;
+    }
+    return stat_valid_ ? &stat_ : nullptr;
+  }
+
  public:
   virtual ~AbstractFile() = default;
 
@@ -88,12 +106,13 @@ class AbstractFile {
 
   bool exists() const
   {
-    return BLI_exists(get_file_path());
+    return get_stat() != nullptr;
   }
 
   size_t get_file_size() const
   {
-    return BLI_file_size(get_file_path());
+    const BLI_stat_t *file_stat = get_stat();
+    return file_stat ? size_t(file_stat->st_size) : size_t(-1);
   }
 };
 
@@ -639,10 +658,16 @@ class AssetIndexFile : public AbstractFile {
 
   /**
    * Returns whether the index file is older than the given asset file.
+   * Same semantics as #BLI_file_older, but using the cached stats.
    */
-  bool is_older_than(BlendFile &asset_file) const
+  bool is_older_than(const BlendFile &asset_file) const
   {
-    return BLI_file_older(get_file_path(), asset_file.get_file_path());
+    const BLI_stat_t *index_stat = get_stat();
+    const BLI_stat_t *asset_stat = asset_file.get_stat();
+    if (index_stat == nullptr || asset_stat == nullptr) {
+      return false;
+    }
+    return index_stat->st_mtime < asset_stat->st_mtime;
   }
 
   /**
@@ -13,6 +13,7 @@
 #include "BLI_ghash.h"
 #include "BLI_math.h"
 #include "BLI_stack.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -994,18 +995,16 @@ static void gpencil_set_borders(tGPDfill *tgpf, const bool transparent)
   tgpf->ima->id.tag |= LIB_TAG_DOIT;
 }
 
-/* Invert image to paint inverse area. */
-static void gpencil_invert_image(tGPDfill *tgpf)
+/* Invert one image row, see #gpencil_invert_image. */
+static void gpencil_invert_image_row_cb(void *__restrict userdata,
+                                        const int row,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  ImBuf *ibuf;
-  void *lock;
+  ImBuf *ibuf = userdata;
   const float fill_col[3][4] = {
       {1.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 0.0f, 0.0f}};
-  ibuf = BKE_image_acquire_ibuf(tgpf->ima, NULL, &lock);
-
-  const int maxpixel = (ibuf->x * ibuf->y) - 1;
 
-  for (int v = maxpixel; v != 0; v--) {
+  for (int v = ibuf->x * (row + 1) - 1; v >= ibuf->x * row; v--) {
     float color[4];
     get_pixel(ibuf, v, color);
     /* Green->Red. */
@@ -1021,6 +1020,20 @@ static void gpencil_invert_image(tGPDfill *tgpf)
       set_pixel(ibuf, v, fill_col[2]);
     }
   }
+}
+
+/* Invert image to paint inverse area. */
+static void gpencil_invert_image(tGPDfill *tgpf)
+{
+  ImBuf *ibuf;
+  void *lock;
+  ibuf = BKE_image_acquire_ibuf(tgpf->ima, NULL, &lock);
+
+  /* Every pixel is rewritten independently, split the work per row. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, ibuf->y, ibuf, gpencil_invert_image_row_cb, &settings);
 
   /* release ibuf */
   BKE_image_release_ibuf(tgpf->ima, ibuf, lock);
@@ -1028,13 +1041,56 @@ static void gpencil_invert_image(tGPDfill *tgpf)
   tgpf->ima->id.tag |= LIB_TAG_DOIT;
 }
 
+/* Clear the pixels between blue perimeter marks of one row, rows never touch
+ * each other so this runs from a parallel range, see #gpencil_erase_processed_area. */
+static void gpencil_erase_processed_row_cb(void *__restrict userdata,
+                                           const int idy,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ImBuf *ibuf = userdata;
+  const float clear_col[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+  float rgba[4];
+  int init = -1;
+  int end = -1;
+
+  for (int idx = 0; idx < ibuf->x; idx++) {
+    int image_idx = ibuf->x * idy + idx;
+    get_pixel(ibuf, image_idx, rgba);
+    /* Blue. */
+    if (rgba[2] == 1.0f) {
+      if (init < 0) {
+        init = image_idx;
+      }
+      else {
+        end = image_idx;
+      }
+    }
+    /* Red. */
+    else if (rgba[0] == 1.0f) {
+      if (init > -1) {
+        for (int i = init; i <= max_ii(init, end); i++) {
+          set_pixel(ibuf, i, clear_col);
+        }
+        init = -1;
+        end = -1;
+      }
+    }
+  }
+  /* Check last segment. */
+  if (init > -1) {
+    for (int i = init; i <= max_ii(init, end); i++) {
+      set_pixel(ibuf, i, clear_col);
+    }
+    set_pixel(ibuf, init, clear_col);
+  }
+}
+
 /* Mark and clear processed areas. */
 static void gpencil_erase_processed_area(tGPDfill *tgpf)
 {
   ImBuf *ibuf;
   void *lock;
   const float blue_col[4] = {0.0f, 0.0f, 1.0f, 1.0f};
-  const float clear_col[4] = {1.0f, 0.0f, 0.0f, 1.0f};
   tGPspoint *point2D;
 
   if (tgpf->sbuffer_used == 0) {
@@ -1051,42 +1107,10 @@ static void gpencil_erase_processed_area(tGPDfill *tgpf)
   }
 
   /* Second, clean by lines any pixel between blue pixels. */
-  float rgba[4];
-
-  for (int idy = 0; idy < ibuf->y; idy++) {
-    int init = -1;
-    int end = -1;
-    for (int idx = 0; idx < ibuf->x; idx++) {
-      int image_idx = ibuf->x * idy + idx;
-      get_pixel(ibuf, image_idx, rgba);
-      /* Blue. */
-      if (rgba[2] == 1.0f) {
-        if (init < 0) {
-          init = image_idx;
-        }
-        else {
-          end = image_idx;
-        }
-      }
-      /* Red. */
-      else if (rgba[0] == 1.0f) {
-        if (init > -1) {
-          for (int i = init; i <= max_ii(init, end); i++) {
-            set_pixel(ibuf, i, clear_col);
-          }
-          init = -1;
-          end = -1;
-        }
-      }
-    }
-    /* Check last segment. */
-    if (init > -1) {
-      for (int i = init; i <= max_ii(init, end); i++) {
-        set_pixel(ibuf, i, clear_col);
-      }
-      set_pixel(ibuf, init, clear_col);
-    }
-  }
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, ibuf->y, ibuf, gpencil_erase_processed_row_cb, &settings);
 
   /* release ibuf */
   BKE_image_release_ibuf(tgpf->ima, ibuf, lock);
@@ -1108,118 +1132,173 @@ static void gpencil_erase_processed_area(tGPDfill *tgpf)
  * -----------
  * </pre>
  */
-static bool dilate_shape(ImBuf *ibuf)
+/* Per-thread pixel stack for the parallel detection passes of #dilate_shape
+ * and #contract_shape, merged into a single stack once all rows are scanned. */
+typedef struct FillMorphTLS {
+  BLI_Stack *stack;
+} FillMorphTLS;
+
+static void fill_morph_stack_merge(const void *__restrict UNUSED(userdata),
+                                   void *__restrict chunk_join,
+                                   void *__restrict chunk)
+{
+  FillMorphTLS *join = chunk_join;
+  FillMorphTLS *morph = chunk;
+
+  if (morph->stack == NULL) {
+    return;
+  }
+  if (join->stack == NULL) {
+    join->stack = morph->stack;
+    morph->stack = NULL;
+    return;
+  }
+  while (!BLI_stack_is_empty(morph->stack)) {
+    int v;
+    BLI_stack_pop(morph->stack, &v);
+    BLI_stack_push(join->stack, &v);
+  }
+  BLI_stack_free(morph->stack);
+  morph->stack = NULL;
+}
+
+static void dilate_shape_row(ImBuf *ibuf, const int row, BLI_Stack *stack)
 {
 #define IS_RED (color[0] == 1.0f)
 #define IS_GREEN (color[1] == 1.0f)
 
-  bool done = false;
-
-  BLI_Stack *stack = BLI_stack_new(sizeof(int), __func__);
-  const float green[4] = {0.0f, 1.0f, 0.0f, 1.0f};
   const int max_size = (ibuf->x * ibuf->y) - 1;
-  /* detect pixels and expand into red areas */
-  for (int row = 0; row < ibuf->y; row++) {
-    if (!is_row_filled(ibuf, row)) {
-      continue;
-    }
-    int maxpixel = (ibuf->x * (row + 1)) - 1;
-    int minpixel = ibuf->x * row;
-
-    for (int v = maxpixel; v != minpixel; v--) {
-      float color[4];
-      int index;
-      get_pixel(ibuf, v, color);
-      if (IS_GREEN) {
-        int tp = 0;
-        int bm = 0;
-        int lt = 0;
-        int rt = 0;
-
-        /* pixel left */
-        if (v - 1 >= 0) {
-          index = v - 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-            lt = index;
-          }
+  const int maxpixel = (ibuf->x * (row + 1)) - 1;
+  const int minpixel = ibuf->x * row;
+
+  for (int v = maxpixel; v != minpixel; v--) {
+    float color[4];
+    int index;
+    get_pixel(ibuf, v, color);
+    if (IS_GREEN) {
+      int tp = 0;
+      int bm = 0;
+      int lt = 0;
+      int rt = 0;
+
+      /* pixel left */
+      if (v - 1 >= 0) {
+        index = v - 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
+          lt = index;
         }
-        /* pixel right */
-        if (v + 1 <= maxpixel) {
-          index = v + 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-            rt = index;
-          }
+      }
+      /* pixel right */
+      if (v + 1 <= maxpixel) {
+        index = v + 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
+          rt = index;
         }
-        /* pixel top */
-        if (v + ibuf->x <= max_size) {
-          index = v + ibuf->x;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-            tp = index;
-          }
+      }
+      /* pixel top */
+      if (v + ibuf->x <= max_size) {
+        index = v + ibuf->x;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
+          tp = index;
         }
-        /* pixel bottom */
-        if (v - ibuf->x >= 0) {
-          index = v - ibuf->x;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-            bm = index;
-          }
+      }
+      /* pixel bottom */
+      if (v - ibuf->x >= 0) {
+        index = v - ibuf->x;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
+          bm = index;
         }
-        /* pixel top-left */
-        if (tp && lt) {
-          index = tp - 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-          }
+      }
+      /* pixel top-left */
+      if (tp && lt) {
+        index = tp - 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
         }
-        /* pixel top-right */
-        if (tp && rt) {
-          index = tp + 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-          }
+      }
+      /* pixel top-right */
+      if (tp && rt) {
+        index = tp + 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
         }
-        /* pixel bottom-left */
-        if (bm && lt) {
-          index = bm - 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-          }
+      }
+      /* pixel bottom-left */
+      if (bm && lt) {
+        index = bm - 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
         }
-        /* pixel bottom-right */
-        if (bm && rt) {
-          index = bm + 1;
-          get_pixel(ibuf, index, color);
-          if (IS_RED) {
-            BLI_stack_push(stack, &index);
-          }
+      }
+      /* pixel bottom-right */
+      if (bm && rt) {
+        index = bm + 1;
+        get_pixel(ibuf, index, color);
+        if (IS_RED) {
+          BLI_stack_push(stack, &index);
         }
       }
     }
   }
+#undef IS_RED
+#undef IS_GREEN
+}
+
+static void dilate_shape_row_cb(void *__restrict userdata,
+                                const int row,
+                                const TaskParallelTLS *__restrict tls)
+{
+  ImBuf *ibuf = userdata;
+  FillMorphTLS *morph = tls->userdata_chunk;
+
+  if (!is_row_filled(ibuf, row)) {
+    return;
+  }
+  if (morph->stack == NULL) {
+    morph->stack = BLI_stack_new(sizeof(int), "dilate_shape");
+  }
+  dilate_shape_row(ibuf, row, morph->stack);
+}
+
+static bool dilate_shape(ImBuf *ibuf)
+{
+  bool done = false;
+  const float green[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+
+  /* Detect pixels and expand into red areas. Detection only reads the image,
+   * the writes are deferred to the stacks, so rows are scanned in parallel. */
+  FillMorphTLS tls_data = {NULL};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  settings.userdata_chunk = &tls_data;
+  settings.userdata_chunk_size = sizeof(tls_data);
+  settings.func_reduce = fill_morph_stack_merge;
+  BLI_task_parallel_range(0, ibuf->y, ibuf, dilate_shape_row_cb, &settings);
+
   /* set dilated pixels */
-  while (!BLI_stack_is_empty(stack)) {
-    int v;
-    BLI_stack_pop(stack, &v);
-    set_pixel(ibuf, v, green);
-    done = true;
+  if (tls_data.stack != NULL) {
+    while (!BLI_stack_is_empty(tls_data.stack)) {
+      int v;
+      BLI_stack_pop(tls_data.stack, &v);
+      set_pixel(ibuf, v, green);
+      done = true;
+    }
+    BLI_stack_free(tls_data.stack);
   }
-  BLI_stack_free(stack);
 
   return done;
-
-#undef IS_RED
-#undef IS_GREEN
 }
 
 /**
@@ -1228,77 +1307,101 @@ static bool dilate_shape(ImBuf *ibuf)
  * Contract green areas to scale down the size.
  * Using stack prevents creep when replacing colors directly.
  */
-static bool contract_shape(ImBuf *ibuf)
+static void contract_shape_row(ImBuf *ibuf, const int row, BLI_Stack *stack)
 {
 #define IS_GREEN (color[1] == 1.0f)
 #define IS_NOT_GREEN (color[1] != 1.0f)
 
-  bool done = false;
-
-  BLI_Stack *stack = BLI_stack_new(sizeof(int), __func__);
-  const float clear[4] = {0.0f, 0.0f, 0.0f, 0.0f};
   const int max_size = (ibuf->x * ibuf->y) - 1;
+  const int maxpixel = (ibuf->x * (row + 1)) - 1;
+  const int minpixel = ibuf->x * row;
 
-  /* Detect if pixel is near of no green pixels and mark green to be cleared. */
-  for (int row = 0; row < ibuf->y; row++) {
-    if (!is_row_filled(ibuf, row)) {
-      continue;
-    }
-    int maxpixel = (ibuf->x * (row + 1)) - 1;
-    int minpixel = ibuf->x * row;
-
-    for (int v = maxpixel; v != minpixel; v--) {
-      float color[4];
-      get_pixel(ibuf, v, color);
-      if (IS_GREEN) {
-        /* pixel left */
-        if (v - 1 >= 0) {
-          get_pixel(ibuf, v - 1, color);
-          if (IS_NOT_GREEN) {
-            BLI_stack_push(stack, &v);
-            continue;
-          }
+  for (int v = maxpixel; v != minpixel; v--) {
+    float color[4];
+    get_pixel(ibuf, v, color);
+    if (IS_GREEN) {
+      /* pixel left */
+      if (v - 1 >= 0) {
+        get_pixel(ibuf, v - 1, color);
+        if (IS_NOT_GREEN) {
+          BLI_stack_push(stack, &v);
+          continue;
         }
-        /* pixel right */
-        if (v + 1 <= maxpixel) {
-          get_pixel(ibuf, v + 1, color);
-          if (IS_NOT_GREEN) {
-            BLI_stack_push(stack, &v);
-            continue;
-          }
+      }
+      /* pixel right */
+      if (v + 1 <= maxpixel) {
+        get_pixel(ibuf, v + 1, color);
+        if (IS_NOT_GREEN) {
+          BLI_stack_push(stack, &v);
+          continue;
         }
-        /* pixel top */
-        if (v + ibuf->x <= max_size) {
-          get_pixel(ibuf, v + ibuf->x, color);
-          if (IS_NOT_GREEN) {
-            BLI_stack_push(stack, &v);
-            continue;
-          }
+      }
+      /* pixel top */
+      if (v + ibuf->x <= max_size) {
+        get_pixel(ibuf, v + ibuf->x, color);
+        if (IS_NOT_GREEN) {
+          BLI_stack_push(stack, &v);
+          continue;
         }
-        /* pixel bottom */
-        if (v - ibuf->x >= 0) {
-          get_pixel(ibuf, v - ibuf->x, color);
-          if (IS_NOT_GREEN) {
-            BLI_stack_push(stack, &v);
-            continue;
-          }
+      }
+      /* pixel bottom */
+      if (v - ibuf->x >= 0) {
+        get_pixel(ibuf, v - ibuf->x, color);
+        if (IS_NOT_GREEN) {
+          BLI_stack_push(stack, &v);
+          continue;
         }
       }
     }
   }
+#undef IS_GREEN
+#undef IS_NOT_GREEN
+}
+
+static void contract_shape_row_cb(void *__restrict userdata,
+                                  const int row,
+                                  const TaskParallelTLS *__restrict tls)
+{
+  ImBuf *ibuf = userdata;
+  FillMorphTLS *morph = tls->userdata_chunk;
+
+  if (!is_row_filled(ibuf, row)) {
+    return;
+  }
+  if (morph->stack == NULL) {
+    morph->stack = BLI_stack_new(sizeof(int), "contract_shape");
+  }
+  contract_shape_row(ibuf, row, morph->stack);
+}
+
+static bool contract_shape(ImBuf *ibuf)
+{
+  bool done = false;
+  const float clear[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+  /* Detect if pixel is near of no green pixels and mark green to be cleared.
+   * As in #dilate_shape, detection is read-only and runs per row in parallel. */
+  FillMorphTLS tls_data = {NULL};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  settings.userdata_chunk = &tls_data;
+  settings.userdata_chunk_size = sizeof(tls_data);
+  settings.func_reduce = fill_morph_stack_merge;
+  BLI_task_parallel_range(0, ibuf->y, ibuf, contract_shape_row_cb, &settings);
+
   /* Clear pixels. */
-  while (!BLI_stack_is_empty(stack)) {
-    int v;
-    BLI_stack_pop(stack, &v);
-    set_pixel(ibuf, v, clear);
-    done = true;
+  if (tls_data.stack != NULL) {
+    while (!BLI_stack_is_empty(tls_data.stack)) {
+      int v;
+      BLI_stack_pop(tls_data.stack, &v);
+      set_pixel(ibuf, v, clear);
+      done = true;
+    }
+    BLI_stack_free(tls_data.stack);
   }
-  BLI_stack_free(stack);
 
   return done;
-
-#undef IS_GREEN
-#undef IS_NOT_GREEN
 }
 
 /* Get the outline points of a shape using Moore Neighborhood algorithm
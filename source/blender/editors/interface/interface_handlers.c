@@ -499,6 +499,7 @@ static void button_activate_init(bContext *C,
                                  uiBut *but,
                                  uiButtonActivateType type);
 static void button_activate_state(bContext *C, uiBut *but, uiHandleButtonState state);
+static void button_region_tag_redraw(ARegion *region, uiBut *but);
 static void button_activate_exit(
     bContext *C, uiBut *but, uiHandleButtonData *data, const bool mousemove, const bool onfree);
 static int ui_handler_region_menu(bContext *C, const wmEvent *event, void *userdata);
@@ -3976,9 +3977,13 @@ static void ui_do_but_textedit(
     }
   }
 
-  if (changed || (retval == WM_UI_HANDLER_BREAK)) {
+  if (changed) {
     ED_region_tag_redraw(data->region);
   }
+  else if (retval == WM_UI_HANDLER_BREAK) {
+    /* Only the text cursor/selection moved. */
+    button_region_tag_redraw(data->region, but);
+  }
 }
 
 static void ui_do_but_textedit_select(
@@ -4006,7 +4011,7 @@ static void ui_do_but_textedit_select(
 
   if (retval == WM_UI_HANDLER_BREAK) {
     ui_but_update(but);
-    ED_region_tag_redraw(data->region);
+    button_region_tag_redraw(data->region, but);
   }
 }
 
@@ -5295,7 +5300,7 @@ static void ui_numedit_set_active(uiBut *but)
   }
 
   if (but->drawflag != oldflag) {
-    ED_region_tag_redraw(data->region);
+    button_region_tag_redraw(data->region, but);
   }
 }
 
@@ -8261,6 +8266,30 @@ static bool button_modal_state(uiHandleButtonState state)
               BUTTON_STATE_MENU_OPEN);
 }
 
+/**
+ * Tag the button's region for redraw after a state change. State changes only alter the look of
+ * the button itself, so a partial redraw of its (padded) rectangle is enough and keeps hovering
+ * over a busy region from re-rasterizing all of it. Popup blocks draw a backdrop and shadow that
+ * extend well beyond the buttons, those keep the full region redraw.
+ */
+static void button_region_tag_redraw(ARegion *region, uiBut *but)
+{
+  if (but->block->flag & UI_BLOCK_LOOP) {
+    ED_region_tag_redraw_no_rebuild(region);
+    return;
+  }
+
+  rctf rectf;
+  ui_block_to_window_rctf(region, but->block, &rectf, &but->rect);
+
+  rcti rect;
+  BLI_rcti_rctf_copy_round(&rect, &rectf);
+  /* Cover the anti-aliased widget outline and the emboss shadow. */
+  BLI_rcti_pad(&rect, 2, 2);
+
+  ED_region_tag_redraw_partial(region, &rect, false);
+}
+
 static void button_activate_state(bContext *C, uiBut *but, uiHandleButtonState state)
 {
   uiHandleButtonData *data = but->active;
@@ -8435,7 +8464,7 @@ static void button_activate_state(bContext *C, uiBut *but, uiHandleButtonState s
   }
 
   /* redraw */
-  ED_region_tag_redraw_no_rebuild(data->region);
+  button_region_tag_redraw(data->region, but);
 }
 
 static void button_activate_init(bContext *C,
@@ -32,6 +32,7 @@
 #include "BKE_editmesh.h"
 #include "BKE_editmesh_bvh.h"
 #include "BKE_layer.h"
+#include "BKE_object.h"
 #include "BKE_report.h"
 #include "BKE_scene.h"
 #include "BKE_unit.h"
@@ -50,6 +51,7 @@
 #include "WM_api.h"
 #include "WM_types.h"
 
+#include "DNA_mesh_types.h"
 #include "DNA_object_types.h"
 
 #include "UI_interface.h"
@@ -179,10 +181,19 @@ typedef struct KnifeUndoFrame {
 } KnifeUndoFrame;
 
 typedef struct KnifeBVH {
-  BVHTree *tree;          /* Knife Custom BVH Tree. */
+  /* Per-object (indexed as #KnifeTool_OpData.objects), object-space looptri trees.
+   * When the cage isn't deformed by modifiers the tree is shared with ray-cast selection
+   * and snapping through the evaluated mesh's #BVHCache, so invoking the tool on a dense
+   * mesh doesn't rebuild a tree that already exists, see #knife_bvh_init. */
+  BVHTreeFromEditMesh *treedata;
+  /* Face test chosen on initialization. Applied while querying (not while building),
+   * since shared trees contain all faces, hidden ones included. */
+  bool (*test_fn)(BMFace *f);
+
   BMLoop *(*looptris)[3]; /* Used by #knife_bvh_raycast_cb to store the intersecting looptri. */
   float uv[2];            /* Used by #knife_bvh_raycast_cb to store the intersecting uv. */
   uint base_index;
+  uint ob_index; /* Object currently queried, set before each per-object ray-cast. */
 
   /* Use #bm_ray_cast_cb_elem_not_in_face_check. */
   bool (*filter_cb)(BMFace *f, void *userdata);
@@ -1147,103 +1158,103 @@ static bool knife_bm_face_is_not_hidden(BMFace *f)
   return (BM_elem_flag_test(f, BM_ELEM_HIDDEN) == 0);
 }
 
+/* See #snap_object_data_editmesh_runtime_get, the cache lives on the evaluated mesh. */
+static struct Mesh_Runtime *knife_bvh_mesh_runtime_get(Object *ob_eval)
+{
+  Mesh *editmesh_eval_final = BKE_object_get_editmesh_eval_final(ob_eval);
+  if (editmesh_eval_final) {
+    return &editmesh_eval_final->runtime;
+  }
+
+  Mesh *editmesh_eval_cage = BKE_object_get_editmesh_eval_cage(ob_eval);
+  if (editmesh_eval_cage) {
+    return &editmesh_eval_cage->runtime;
+  }
+
+  return &((Mesh *)ob_eval->data)->runtime;
+}
+
+/**
+ * The shared looptri trees bound #BMVert coordinates,
+ * they can only be used when those match the cage.
+ */
+static bool knife_bvh_cagecos_match_editmesh(BMEditMesh *em, const float (*cagecos)[3])
+{
+  BMVert *v;
+  BMIter iter;
+  BM_ITER_MESH (v, &iter, em->bm, BM_VERTS_OF_MESH) {
+    if (!equals_v3v3(cagecos[BM_elem_index_get(v)], v->co)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static void knife_bvh_init(KnifeTool_OpData *kcd)
 {
   Object *ob;
   BMEditMesh *em;
 
   /* Test Function. */
-  bool (*test_fn)(BMFace *);
   if ((kcd->only_select && kcd->cut_through)) {
-    test_fn = knife_bm_face_is_select;
+    kcd->bvh.test_fn = knife_bm_face_is_select;
   }
   else {
-    test_fn = knife_bm_face_is_not_hidden;
+    kcd->bvh.test_fn = knife_bm_face_is_not_hidden;
   }
 
-  /* Construct BVH Tree. */
-  float cos[3][3];
-  const float epsilon = FLT_EPSILON * 2.0f;
-  int tottri = 0;
-  int ob_tottri = 0;
-  BMLoop *(*looptris)[3];
-  BMFace *f_test = NULL, *f_test_prev = NULL;
-  bool test_fn_ret = false;
+  kcd->bvh.treedata = MEM_callocN(sizeof(*kcd->bvh.treedata) * kcd->objects_len,
+                                  "knife bvh treedata");
 
-  /* Calculate tottri. */
   for (uint b = 0; b < kcd->objects_len; b++) {
-    ob_tottri = 0;
     ob = kcd->objects[b];
     em = BKE_editmesh_from_object(ob);
-
-    for (int i = 0; i < em->tottri; i++) {
-      f_test = em->looptris[i][0]->f;
-      if (f_test != f_test_prev) {
-        test_fn_ret = test_fn(f_test);
-        f_test_prev = f_test;
-      }
-
-      if (test_fn_ret) {
-        ob_tottri++;
-      }
+    BVHTreeFromEditMesh *treedata = &kcd->bvh.treedata[b];
+
+    if (knife_bvh_cagecos_match_editmesh(em, kcd->cagecos[b])) {
+      /* Share the tree used by ray-cast selection and snapping,
+       * building it here leaves it warm for them and vice versa. */
+      Object *ob_eval = DEG_get_evaluated_object(kcd->vc.depsgraph, ob);
+      struct Mesh_Runtime *mesh_runtime = knife_bvh_mesh_runtime_get(ob_eval);
+      BKE_bvhtree_from_editmesh_get(treedata,
+                                    em,
+                                    4,
+                                    BVHTREE_FROM_EM_LOOPTRI,
+                                    &mesh_runtime->bvh_cache,
+                                    mesh_runtime->eval_mutex);
     }
-
-    tottri += ob_tottri;
-  }
-
-  kcd->bvh.tree = BLI_bvhtree_new(tottri, epsilon, 8, 8);
-
-  f_test_prev = NULL;
-  test_fn_ret = false;
-
-  /* Add tri's for each object.
-   * TODO:
-   * test_fn can leave large gaps between bvh tree indices.
-   * Compacting bvh tree indices may be possible.
-   * Don't forget to update #knife_bvh_intersect_plane!
-   */
-  tottri = 0;
-  for (uint b = 0; b < kcd->objects_len; b++) {
-    ob = kcd->objects[b];
-    em = BKE_editmesh_from_object(ob);
-    looptris = em->looptris;
-
-    for (int i = 0; i < em->tottri; i++) {
-
-      f_test = looptris[i][0]->f;
-      if (f_test != f_test_prev) {
-        test_fn_ret = test_fn(f_test);
-        f_test_prev = f_test;
-      }
-
-      if (!test_fn_ret) {
-        continue;
+    else {
+      /* The cage is deformed by modifiers, build a private tree bounding the cage coords.
+       * All looptris are added, the face test runs while querying just as for shared trees. */
+      float cos[3][3];
+      const float epsilon = FLT_EPSILON * 2.0f;
+      BMLoop *(*looptris)[3] = em->looptris;
+
+      BVHTree *tree = BLI_bvhtree_new(em->tottri, epsilon, 8, 8);
+      for (int i = 0; i < em->tottri; i++) {
+        copy_v3_v3(cos[0], kcd->cagecos[b][BM_elem_index_get(looptris[i][0]->v)]);
+        copy_v3_v3(cos[1], kcd->cagecos[b][BM_elem_index_get(looptris[i][1]->v)]);
+        copy_v3_v3(cos[2], kcd->cagecos[b][BM_elem_index_get(looptris[i][2]->v)]);
+        BLI_bvhtree_insert(tree, i, (float *)cos, 3);
       }
+      BLI_bvhtree_balance(tree);
 
-      copy_v3_v3(cos[0], kcd->cagecos[b][BM_elem_index_get(looptris[i][0]->v)]);
-      copy_v3_v3(cos[1], kcd->cagecos[b][BM_elem_index_get(looptris[i][1]->v)]);
-      copy_v3_v3(cos[2], kcd->cagecos[b][BM_elem_index_get(looptris[i][2]->v)]);
-
-      /* Convert to world-space. */
-      mul_m4_v3(ob->obmat, cos[0]);
-      mul_m4_v3(ob->obmat, cos[1]);
-      mul_m4_v3(ob->obmat, cos[2]);
-
-      BLI_bvhtree_insert(kcd->bvh.tree, i + tottri, (float *)cos, 3);
+      treedata->tree = tree;
+      treedata->em = em;
+      treedata->cached = false;
     }
-
-    tottri += em->tottri;
   }
-
-  BLI_bvhtree_balance(kcd->bvh.tree);
 }
 
-/* Wrapper for #BLI_bvhtree_free. */
+/* Wrapper for #free_bvhtree_from_editmesh, shared trees stay in the #BVHCache. */
 static void knife_bvh_free(KnifeTool_OpData *kcd)
 {
-  if (kcd->bvh.tree) {
-    BLI_bvhtree_free(kcd->bvh.tree);
-    kcd->bvh.tree = NULL;
+  if (kcd->bvh.treedata) {
+    for (uint b = 0; b < kcd->objects_len; b++) {
+      free_bvhtree_from_editmesh(&kcd->bvh.treedata[b]);
+    }
+    MEM_freeN(kcd->bvh.treedata);
+    kcd->bvh.treedata = NULL;
   }
 }
 
@@ -1259,35 +1270,28 @@ static void knife_bvh_raycast_cb(void *userdata,
 
   float dist, uv[2];
   bool isect;
-  int tottri;
   float tri_cos[3][3];
 
   if (index != -1) {
-    tottri = 0;
-    uint b = 0;
-    for (; b < kcd->objects_len; b++) {
-      index -= tottri;
-      ob = kcd->objects[b];
-      em = BKE_editmesh_from_object(ob);
-      tottri = em->tottri;
-      if (index < tottri) {
-        ltri = em->looptris[index];
-        break;
-      }
-    }
+    const uint b = kcd->bvh.ob_index;
+    ob = kcd->objects[b];
+    em = BKE_editmesh_from_object(ob);
+    ltri = em->looptris[index];
 
+    /* Shared trees contain every face, hidden ones included. */
+    if (!kcd->bvh.test_fn(ltri[0]->f)) {
+      return;
+    }
     if (kcd->bvh.filter_cb) {
       if (!kcd->bvh.filter_cb(ltri[0]->f, kcd->bvh.filter_data)) {
         return;
       }
     }
 
+    /* Ray and exact test both run in object space. */
     copy_v3_v3(tri_cos[0], kcd->cagecos[b][BM_elem_index_get(ltri[0]->v)]);
     copy_v3_v3(tri_cos[1], kcd->cagecos[b][BM_elem_index_get(ltri[1]->v)]);
     copy_v3_v3(tri_cos[2], kcd->cagecos[b][BM_elem_index_get(ltri[2]->v)]);
-    mul_m4_v3(ob->obmat, tri_cos[0]);
-    mul_m4_v3(ob->obmat, tri_cos[1]);
-    mul_m4_v3(ob->obmat, tri_cos[2]);
 
     isect =
         (ray->radius > 0.0f ?
@@ -1332,40 +1336,65 @@ static BMFace *knife_bvh_raycast(KnifeTool_OpData *kcd,
                                  float r_cagehit[3],
                                  uint *r_base_index)
 {
-  BMFace *face;
+  BMFace *face = NULL;
   BMLoop **ltri;
-  BVHTreeRayHit hit;
-  const float dist = r_dist ? *r_dist : FLT_MAX;
-  hit.dist = dist;
-  hit.index = -1;
+  float best_dist = r_dist ? *r_dist : FLT_MAX;
+  float best_cagehit[3];
+  int best_index = -1;
 
-  BLI_bvhtree_ray_cast(kcd->bvh.tree, co, dir, radius, &hit, knife_bvh_raycast_cb, kcd);
+  /* Ray-cast the per-object trees in object space, comparing hits in world units.
+   * #KnifeBVH.looptris/uv/base_index always track the globally closest hit since each
+   * tree is queried with the best distance found so far. */
+  for (uint b = 0; b < kcd->objects_len; b++) {
+    BVHTree *tree = kcd->bvh.treedata[b].tree;
+    if (tree == NULL) {
+      continue;
+    }
+    Object *ob = kcd->objects[b];
 
-  /* Handle Hit */
-  if (hit.index != -1 && hit.dist != dist) {
-    face = kcd->bvh.looptris[hit.index][0]->f;
+    float imat[4][4], ray_start[3], ray_dir[3];
+    invert_m4_m4(imat, ob->obmat);
+    mul_v3_m4v3(ray_start, imat, co);
+    copy_v3_v3(ray_dir, dir);
+    mul_mat3_m4_v3(imat, ray_dir);
+    const float local_scale = normalize_v3(ray_dir);
+
+    BVHTreeRayHit hit;
+    hit.index = -1;
+    hit.dist = (best_dist == FLT_MAX) ? FLT_MAX : best_dist * local_scale;
 
-    /* Hits returned in world space. */
+    kcd->bvh.ob_index = b;
+    BLI_bvhtree_ray_cast(
+        tree, ray_start, ray_dir, radius * local_scale, &hit, knife_bvh_raycast_cb, kcd);
+
+    if (hit.index != -1) {
+      best_dist = hit.dist / local_scale;
+      best_index = hit.index;
+      mul_v3_m4v3(best_cagehit, ob->obmat, hit.co);
+      face = kcd->bvh.looptris[hit.index][0]->f;
+    }
+  }
+
+  /* Handle Hit */
+  if (face) {
     if (r_hitout) {
-      ltri = kcd->bvh.looptris[hit.index];
+      ltri = kcd->bvh.looptris[best_index];
       interp_v3_v3v3v3_uv(r_hitout, ltri[0]->v->co, ltri[1]->v->co, ltri[2]->v->co, kcd->bvh.uv);
 
       if (r_cagehit) {
-        copy_v3_v3(r_cagehit, hit.co);
+        copy_v3_v3(r_cagehit, best_cagehit);
       }
     }
 
     if (r_dist) {
-      *r_dist = hit.dist;
+      *r_dist = best_dist;
     }
 
     if (r_base_index) {
       *r_base_index = kcd->bvh.base_index;
     }
-
-    return face;
   }
-  return NULL;
+  return face;
 }
 
 /* `co` is expected to be in world space. */
@@ -1383,43 +1412,12 @@ static BMFace *knife_bvh_raycast_filter(KnifeTool_OpData *kcd,
   kcd->bvh.filter_cb = filter_cb;
   kcd->bvh.filter_data = filter_userdata;
 
-  BMFace *face;
-  BMLoop **ltri;
-  BVHTreeRayHit hit;
-  const float dist = r_dist ? *r_dist : FLT_MAX;
-  hit.dist = dist;
-  hit.index = -1;
-
-  BLI_bvhtree_ray_cast(kcd->bvh.tree, co, dir, radius, &hit, knife_bvh_raycast_cb, kcd);
+  BMFace *face = knife_bvh_raycast(kcd, co, dir, radius, r_dist, r_hitout, r_cagehit, r_base_index);
 
   kcd->bvh.filter_cb = NULL;
   kcd->bvh.filter_data = NULL;
 
-  /* Handle Hit */
-  if (hit.index != -1 && hit.dist != dist) {
-    face = kcd->bvh.looptris[hit.index][0]->f;
-
-    /* Hits returned in world space. */
-    if (r_hitout) {
-      ltri = kcd->bvh.looptris[hit.index];
-      interp_v3_v3v3v3_uv(r_hitout, ltri[0]->v->co, ltri[1]->v->co, ltri[2]->v->co, kcd->bvh.uv);
-
-      if (r_cagehit) {
-        copy_v3_v3(r_cagehit, hit.co);
-      }
-    }
-
-    if (r_dist) {
-      *r_dist = hit.dist;
-    }
-
-    if (r_base_index) {
-      *r_base_index = kcd->bvh.base_index;
-    }
-
-    return face;
-  }
-  return NULL;
+  return face;
 }
 
 /** \} */
@@ -2863,15 +2861,10 @@ static void knife_find_line_hits(KnifeTool_OpData *kcd)
     plane_from_point_normal_v3(plane, v1, plane);
   }
 
-  /* First use BVH tree to find faces, knife edges, and knife verts that might
+  /* First use BVH trees to find faces, knife edges, and knife verts that might
    * intersect the cut plane with rays v1-v3 and v2-v4.
    * This de-duplicates the candidates before doing more expensive intersection tests. */
 
-  results = BLI_bvhtree_intersect_plane(kcd->bvh.tree, plane, &tot);
-  if (!results) {
-    return;
-  }
-
   BLI_smallhash_init(&faces);
   BLI_smallhash_init(&kfes);
   BLI_smallhash_init(&kfvs);
@@ -2879,49 +2872,65 @@ static void knife_find_line_hits(KnifeTool_OpData *kcd)
 
   Object *ob;
   BMEditMesh *em;
-  uint b = 0;
 
-  for (i = 0, result = results; i < tot; i++, result++) {
-    for (b = 0; b < kcd->objects_len; b++) {
-      ob = kcd->objects[b];
-      em = BKE_editmesh_from_object(ob);
-      if (*result >= 0 && *result < em->tottri) {
-        ls = (BMLoop **)em->looptris[*result];
-        break;
-      }
-      *result -= em->tottri;
+  for (uint b = 0; b < kcd->objects_len; b++) {
+    BVHTree *tree = kcd->bvh.treedata[b].tree;
+    if (tree == NULL) {
+      continue;
     }
+    ob = kcd->objects[b];
+    em = BKE_editmesh_from_object(ob);
 
-    f = ls[0]->f;
-    set_lowest_face_tri(kcd, em, f, *result);
+    /* Transform the cut plane into object space. */
+    float tmat[4][4], plane_local[4];
+    transpose_m4_m4(tmat, ob->obmat);
+    mul_v4_m4v4(plane_local, tmat, plane);
 
-    /* Occlude but never cut unselected faces (when only_select is used). */
-    if (kcd->only_select && !BM_elem_flag_test(f, BM_ELEM_SELECT)) {
-      continue;
-    }
-    /* For faces, store index of lowest hit looptri in hash. */
-    if (BLI_smallhash_haskey(&faces, (uintptr_t)f)) {
+    results = BLI_bvhtree_intersect_plane(tree, plane_local, &tot);
+    if (!results) {
       continue;
     }
-    /* Don't care what the value is except that it is non-NULL, for iterator. */
-    BLI_smallhash_insert(&faces, (uintptr_t)f, f);
-    BLI_smallhash_insert(&fobs, (uintptr_t)f, (void *)(uintptr_t)b);
 
-    list = knife_get_face_kedges(kcd, ob, b, f);
-    for (ref = list->first; ref; ref = ref->next) {
-      kfe = ref->ref;
-      if (kfe->is_invalid) {
+    for (i = 0, result = results; i < tot; i++, result++) {
+      ls = (BMLoop **)em->looptris[*result];
+
+      f = ls[0]->f;
+      /* Shared trees contain every face, hidden ones included. */
+      if (!kcd->bvh.test_fn(f)) {
+        continue;
+      }
+      set_lowest_face_tri(kcd, em, f, *result);
+
+      /* Occlude but never cut unselected faces (when only_select is used). */
+      if (kcd->only_select && !BM_elem_flag_test(f, BM_ELEM_SELECT)) {
         continue;
       }
-      if (BLI_smallhash_haskey(&kfes, (uintptr_t)kfe)) {
+      /* For faces, store index of lowest hit looptri in hash. */
+      if (BLI_smallhash_haskey(&faces, (uintptr_t)f)) {
         continue;
       }
-      BLI_smallhash_insert(&kfes, (uintptr_t)kfe, kfe);
-      v = kfe->v1;
-      BLI_smallhash_reinsert(&kfvs, (uintptr_t)v, v);
-      v = kfe->v2;
-      BLI_smallhash_reinsert(&kfvs, (uintptr_t)v, v);
+      /* Don't care what the value is except that it is non-NULL, for iterator. */
+      BLI_smallhash_insert(&faces, (uintptr_t)f, f);
+      BLI_smallhash_insert(&fobs, (uintptr_t)f, (void *)(uintptr_t)b);
+
+      list = knife_get_face_kedges(kcd, ob, b, f);
+      for (ref = list->first; ref; ref = ref->next) {
+        kfe = ref->ref;
+        if (kfe->is_invalid) {
+          continue;
+        }
+        if (BLI_smallhash_haskey(&kfes, (uintptr_t)kfe)) {
+          continue;
+        }
+        BLI_smallhash_insert(&kfes, (uintptr_t)kfe, kfe);
+        v = kfe->v1;
+        BLI_smallhash_reinsert(&kfvs, (uintptr_t)v, v);
+        v = kfe->v2;
+        BLI_smallhash_reinsert(&kfvs, (uintptr_t)v, v);
+      }
     }
+
+    MEM_freeN(results);
   }
 
   /* Now go through the candidates and find intersections. */
@@ -3127,7 +3136,6 @@ static void knife_find_line_hits(KnifeTool_OpData *kcd)
   BLI_smallhash_release(&kfes);
   BLI_smallhash_release(&kfvs);
   BLI_smallhash_release(&fobs);
-  MEM_freeN(results);
 }
 
 /** \} */
@@ -71,6 +71,7 @@ static void undoptcache_from_editcache(PTCacheUndo *undo, PTCacheEdit *edit)
     for (; pm; pm = pm->next) {
       for (int i = 0; i < BPHYS_TOT_DATA; i++) {
         pm->data[i] = MEM_dupallocN(pm->data[i]);
+        pm->data_compressed[i] = MEM_dupallocN(pm->data_compressed[i]);
       }
     }
   }
@@ -152,6 +153,7 @@ static void undoptcache_to_editcache(PTCacheUndo *undo, PTCacheEdit *edit)
     for (; pm; pm = pm->next) {
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         pm->data[i] = MEM_dupallocN(pm->data[i]);
+        pm->data_compressed[i] = MEM_dupallocN(pm->data_compressed[i]);
       }
       void *cur[BPHYS_TOT_DATA];
       BKE_ptcache_mem_pointers_init(pm, cur);
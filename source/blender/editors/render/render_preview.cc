@@ -21,6 +21,8 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "PIL_time.h"
@@ -30,6 +32,7 @@
 #include "DNA_brush_types.h"
 #include "DNA_camera_types.h"
 #include "DNA_collection_types.h"
+#include "DNA_image_types.h"
 #include "DNA_light_types.h"
 #include "DNA_material_types.h"
 #include "DNA_mesh_types.h"
@@ -90,11 +93,6 @@
 
 #include "UI_interface_icons.h"
 
-#ifndef NDEBUG
-/* Used for database init assert(). */
-#  include "BLI_threads.h"
-#endif
-
 static void icon_copy_rect(ImBuf *ibuf, uint w, uint h, uint *rect);
 
 /* -------------------------------------------------------------------- */
@@ -1394,9 +1392,23 @@ static void icon_preview_startjob(void *customdata, short *stop, short *do_updat
     iuser.framenr = 1;
     iuser.scene = sp->scene;
 
-    /* NOTE(@elubie): this needs to be changed: here image is always loaded if not
-     * already there. Very expensive for large images. Need to find a way to
-     * only get existing `ibuf`. */
+    /* When the image isn't loaded yet and comes straight from a file, decode it at
+     * thumbnail resolution instead of pulling the full-size buffer into memory only
+     * to scale it down to an icon. */
+    if (!BKE_image_has_loaded_ibuf(ima) && !BKE_image_has_packedfile(ima) &&
+        ELEM(ima->source, IMA_SRC_FILE, IMA_SRC_SEQUENCE)) {
+      char filepath[FILE_MAX];
+      BKE_image_user_file_path(&iuser, ima, filepath);
+
+      ibuf = IMB_thumb_load_image(filepath, MAX2(sp->sizex, sp->sizey), nullptr);
+      if (ibuf != nullptr && (ibuf->rect != nullptr || ibuf->rect_float != nullptr)) {
+        icon_copy_rect(ibuf, sp->sizex, sp->sizey, sp->pr_rect);
+        *do_update = true;
+      }
+      IMB_freeImBuf(ibuf);
+      return;
+    }
+
     ibuf = BKE_image_acquire_ibuf(ima, &iuser, nullptr);
     if (ibuf == nullptr || (ibuf->rect == nullptr && ibuf->rect_float == nullptr)) {
       BKE_image_release_ibuf(ima, ibuf, nullptr);
@@ -1687,7 +1699,16 @@ class PreviewLoadJob {
   void push_load_request(PreviewImage *, eIconSizes);
 
  private:
+  /** Passed to the worker tasks as task-pool user data, alive for the duration of #run_fn(). */
+  struct WorkerData {
+    PreviewLoadJob *job_data;
+    short *stop;
+    short *do_update;
+  };
+
   static void run_fn(void *, short *, short *, float *);
+  static void run_worker_fn(TaskPool *__restrict, void *);
+  static void load_request(RequestedPreview *, short *do_update);
   static void update_fn(void *);
   static void end_fn(void *);
   static void free_fn(void *);
@@ -1759,39 +1780,64 @@ void PreviewLoadJob::run_fn(void *customdata,
 
   IMB_thumb_locks_acquire();
 
+  /* Loading (or generating) thumbnails is mostly IO and image decoding, so fan the queue out over
+   * multiple workers instead of draining it on this job thread alone. Requests for the same path
+   * are serialized through #IMB_thumb_path_lock() and every request writes into its own
+   * #PreviewImage buffer, so the workers need no further synchronization. Cap the worker count,
+   * past a handful of threads this is limited by the disk anyway. */
+  WorkerData worker_data = {job_data, stop, do_update};
+  const int tot_workers = min_ii(BLI_system_thread_count(), 8);
+
+  TaskPool *task_pool = BLI_task_pool_create(&worker_data, TASK_PRIORITY_HIGH);
+  for (int i = 0; i < tot_workers; i++) {
+    BLI_task_pool_push(task_pool, run_worker_fn, nullptr, false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
+
+  IMB_thumb_locks_release();
+}
+
+void PreviewLoadJob::run_worker_fn(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  WorkerData *worker_data = static_cast<WorkerData *>(BLI_task_pool_user_data(pool));
+
   while (RequestedPreview *request = reinterpret_cast<RequestedPreview *>(
-             BLI_thread_queue_pop_timeout(job_data->todo_queue_, 100))) {
-    if (*stop) {
+             BLI_thread_queue_pop_timeout(worker_data->job_data->todo_queue_, 100))) {
+    if (*worker_data->stop) {
       break;
     }
 
-    PreviewImage *preview = request->preview;
+    load_request(request, worker_data->do_update);
+  }
+}
 
-    const char *deferred_data = static_cast<char *>(PRV_DEFERRED_DATA(preview));
-    const ThumbSource source = static_cast<ThumbSource>(deferred_data[0]);
-    const char *path = &deferred_data[1];
+void PreviewLoadJob::load_request(RequestedPreview *request, short *do_update)
+{
+  PreviewImage *preview = request->preview;
 
-    //    printf("loading deferred %d×%d preview for %s\n", request->sizex, request->sizey, path);
+  const char *deferred_data = static_cast<char *>(PRV_DEFERRED_DATA(preview));
+  const ThumbSource source = static_cast<ThumbSource>(deferred_data[0]);
+  const char *path = &deferred_data[1];
 
-    IMB_thumb_path_lock(path);
-    ImBuf *thumb = IMB_thumb_manage(path, THB_LARGE, source);
-    IMB_thumb_path_unlock(path);
+  //    printf("loading deferred %d×%d preview for %s\n", request->sizex, request->sizey, path);
 
-    if (thumb) {
-      /* PreviewImage assumes premultiplied alpha... */
-      IMB_premultiply_alpha(thumb);
+  IMB_thumb_path_lock(path);
+  ImBuf *thumb = IMB_thumb_manage(path, THB_LARGE, source);
+  IMB_thumb_path_unlock(path);
 
-      icon_copy_rect(thumb,
-                     preview->w[request->icon_size],
-                     preview->h[request->icon_size],
-                     preview->rect[request->icon_size]);
-      IMB_freeImBuf(thumb);
-    }
+  if (thumb) {
+    /* PreviewImage assumes premultiplied alpha... */
+    IMB_premultiply_alpha(thumb);
 
-    *do_update = true;
+    icon_copy_rect(thumb,
+                   preview->w[request->icon_size],
+                   preview->h[request->icon_size],
+                   preview->rect[request->icon_size]);
+    IMB_freeImBuf(thumb);
   }
 
-  IMB_thumb_locks_release();
+  *do_update = true;
 }
 
 /* Only execute on the main thread! */
@@ -934,106 +934,143 @@ static float paint_2d_ibuf_add_if(
   return w;
 }
 
-static void paint_2d_lift_soften(ImagePaintState *s,
-                                 ImagePaintTile *tile,
-                                 ImBuf *ibuf,
-                                 ImBuf *ibufb,
-                                 const int *pos,
-                                 const short paint_tile)
+typedef struct Paint2DSoftenData {
+  ImBuf *ibuf;
+  ImBuf *ibufb;
+  BlurKernel *kernel;
+  float mask;
+  float threshold;
+  int in_off[2];
+  int out_off[2];
+  int dim[2];
+  short paint_tile;
+  bool sharpen;
+} Paint2DSoftenData;
+
+static void paint_2d_lift_soften_row(Paint2DSoftenData *data, const int y)
 {
-  bool sharpen = (tile->cache.invert ^ ((s->brush->flag & BRUSH_DIR_IN) != 0));
-  float threshold = s->brush->sharp_threshold;
-  int x, y, xi, yi, xo, yo, xk, yk;
+  ImBuf *ibuf = data->ibuf;
+  BlurKernel *kernel = data->kernel;
+  const short paint_tile = data->paint_tile;
+  int x, xi, yi, xo, yo, xk, yk;
   float count;
-  int out_off[2], in_off[2], dim[2];
-  int diff_pos[2];
   float outrgb[4];
   float rgba[4];
-  BlurKernel *kernel = s->blurkernel;
 
-  dim[0] = ibufb->x;
-  dim[1] = ibufb->y;
-  in_off[0] = pos[0];
-  in_off[1] = pos[1];
-  out_off[0] = out_off[1] = 0;
+  for (x = 0; x < data->dim[0]; x++) {
+    /* get input pixel */
+    xi = data->in_off[0] + x;
+    yi = data->in_off[1] + y;
 
-  if (!paint_tile) {
-    IMB_rectclip(ibuf, ibufb, &in_off[0], &in_off[1], &out_off[0], &out_off[1], &dim[0], &dim[1]);
-
-    if ((dim[0] == 0) || (dim[1] == 0)) {
-      return;
+    count = 0.0;
+    if (paint_tile) {
+      paint_2d_ibuf_tile_convert(ibuf, &xi, &yi, paint_tile);
+      if (xi < ibuf->x && xi >= 0 && yi < ibuf->y && yi >= 0) {
+        paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
+      }
+      else {
+        zero_v4(rgba);
+      }
+    }
+    else {
+      /* coordinates have been clipped properly here, it should be safe to do this */
+      paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
+    }
+    zero_v4(outrgb);
+
+    for (yk = 0; yk < kernel->side; yk++) {
+      for (xk = 0; xk < kernel->side; xk++) {
+        count += paint_2d_ibuf_add_if(ibuf,
+                                      xi + xk - kernel->pixel_len,
+                                      yi + yk - kernel->pixel_len,
+                                      outrgb,
+                                      paint_tile,
+                                      kernel->wdata[xk + yk * kernel->side]);
+      }
     }
-  }
 
-  /* find offset inside mask buffers to sample them */
-  sub_v2_v2v2_int(diff_pos, out_off, in_off);
+    if (count > 0.0f) {
+      mul_v4_fl(outrgb, 1.0f / (float)count);
 
-  for (y = 0; y < dim[1]; y++) {
-    for (x = 0; x < dim[0]; x++) {
-      /* get input pixel */
-      xi = in_off[0] + x;
-      yi = in_off[1] + y;
+      if (data->sharpen) {
+        /* subtract blurred image from normal image gives high pass filter */
+        sub_v3_v3v3(outrgb, rgba, outrgb);
 
-      count = 0.0;
-      if (paint_tile) {
-        paint_2d_ibuf_tile_convert(ibuf, &xi, &yi, paint_tile);
-        if (xi < ibuf->x && xi >= 0 && yi < ibuf->y && yi >= 0) {
-          paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
+        /* Now rgba_ub contains the edge result, but this should be converted to luminance to
+         * avoid colored speckles appearing in final image, and also to check for threshold. */
+        outrgb[0] = outrgb[1] = outrgb[2] = IMB_colormanagement_get_luminance(outrgb);
+        if (fabsf(outrgb[0]) > data->threshold) {
+          float alpha = rgba[3];
+          rgba[3] = outrgb[3] = data->mask;
+
+          /* add to enhance edges */
+          blend_color_add_float(outrgb, rgba, outrgb);
+          outrgb[3] = alpha;
         }
         else {
-          zero_v4(rgba);
-        }
-      }
-      else {
-        /* coordinates have been clipped properly here, it should be safe to do this */
-        paint_2d_ibuf_rgb_get(ibuf, xi, yi, rgba);
-      }
-      zero_v4(outrgb);
-
-      for (yk = 0; yk < kernel->side; yk++) {
-        for (xk = 0; xk < kernel->side; xk++) {
-          count += paint_2d_ibuf_add_if(ibuf,
-                                        xi + xk - kernel->pixel_len,
-                                        yi + yk - kernel->pixel_len,
-                                        outrgb,
-                                        paint_tile,
-                                        kernel->wdata[xk + yk * kernel->side]);
+          copy_v4_v4(outrgb, rgba);
         }
       }
+    }
+    else {
+      copy_v4_v4(outrgb, rgba);
+    }
+    /* write into brush buffer */
+    xo = data->out_off[0] + x;
+    yo = data->out_off[1] + y;
+    paint_2d_ibuf_rgb_set(data->ibufb, xo, yo, 0, outrgb);
+  }
+}
 
-      if (count > 0.0f) {
-        mul_v4_fl(outrgb, 1.0f / (float)count);
-
-        if (sharpen) {
-          /* subtract blurred image from normal image gives high pass filter */
-          sub_v3_v3v3(outrgb, rgba, outrgb);
+static void paint_2d_lift_soften_cb(void *__restrict userdata,
+                                    const int y,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  paint_2d_lift_soften_row(userdata, y);
+}
 
-          /* Now rgba_ub contains the edge result, but this should be converted to luminance to
-           * avoid colored speckles appearing in final image, and also to check for threshold. */
-          outrgb[0] = outrgb[1] = outrgb[2] = IMB_colormanagement_get_luminance(outrgb);
-          if (fabsf(outrgb[0]) > threshold) {
-            float mask = BKE_brush_alpha_get(s->scene, s->brush);
-            float alpha = rgba[3];
-            rgba[3] = outrgb[3] = mask;
+static void paint_2d_lift_soften(ImagePaintState *s,
+                                 ImagePaintTile *tile,
+                                 ImBuf *ibuf,
+                                 ImBuf *ibufb,
+                                 const int *pos,
+                                 const short paint_tile)
+{
+  Paint2DSoftenData data = {
+      .ibuf = ibuf,
+      .ibufb = ibufb,
+      .kernel = s->blurkernel,
+      .mask = BKE_brush_alpha_get(s->scene, s->brush),
+      .threshold = s->brush->sharp_threshold,
+      .in_off = {pos[0], pos[1]},
+      .out_off = {0, 0},
+      .dim = {ibufb->x, ibufb->y},
+      .paint_tile = paint_tile,
+      .sharpen = (tile->cache.invert ^ ((s->brush->flag & BRUSH_DIR_IN) != 0)),
+  };
 
-            /* add to enhance edges */
-            blend_color_add_float(outrgb, rgba, outrgb);
-            outrgb[3] = alpha;
-          }
-          else {
-            copy_v4_v4(outrgb, rgba);
-          }
-        }
-      }
-      else {
-        copy_v4_v4(outrgb, rgba);
-      }
-      /* write into brush buffer */
-      xo = out_off[0] + x;
-      yo = out_off[1] + y;
-      paint_2d_ibuf_rgb_set(ibufb, xo, yo, 0, outrgb);
+  if (!paint_tile) {
+    IMB_rectclip(ibuf,
+                 ibufb,
+                 &data.in_off[0],
+                 &data.in_off[1],
+                 &data.out_off[0],
+                 &data.out_off[1],
+                 &data.dim[0],
+                 &data.dim[1]);
+
+    if ((data.dim[0] == 0) || (data.dim[1] == 0)) {
+      return;
     }
   }
+
+  /* Rows only read from the canvas and write disjoint rows of the brush
+   * buffer, so they can be lifted concurrently. The kernel convolution makes
+   * this by far the most expensive part of a soften dab. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, data.dim[1], &data, paint_2d_lift_soften_cb, &settings);
 }
 
 static void paint_2d_set_region(
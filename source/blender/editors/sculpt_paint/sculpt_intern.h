@@ -139,6 +139,13 @@ typedef struct SculptUndoNode {
   float *mask;
   int totvert;
 
+  /* Compressed storage replacing `co`/`orig_co` between the end of the stroke and the first
+   * undo of this node, see sculpt_undo_compress_node_task(). */
+  void *co_compressed;
+  void *orig_co_compressed;
+  size_t co_compressed_size;
+  size_t orig_co_compressed_size;
+
   /* non-multires */
   int maxvert; /* to verify if totvert it still the same */
   int *index;  /* to restore into right location */
@@ -8,6 +8,8 @@
 
 #include <stddef.h>
 
+#include <zstd.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_ghash.h"
@@ -24,6 +26,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
 
+#include "BKE_blender.h"
 #include "BKE_ccg.h"
 #include "BKE_context.h"
 #include "BKE_customdata.h"
@@ -144,6 +147,114 @@ static void update_cb_partial(PBVHNode *node, void *userdata)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Background Compression of Undo Nodes
+ *
+ * Coordinate arrays dominate sculpt undo memory on high-poly meshes, and are only ever read
+ * again when the step is actually undone. After a stroke ends, the arrays of every node are
+ * handed to a background worker which replaces them with zstd-compressed buffers; the restore
+ * and free paths wait for the worker and decompress on demand. This keeps both the compression
+ * and the memory win entirely off the stroke and mouse-up critical path.
+ * \{ */
+
+/* Speed over ratio: coordinates are noisy float data, higher levels barely shrink them. */
+#define SCULPT_UNDO_COMPRESS_LEVEL 3
+
+static TaskPool *sculpt_undo_compress_pool = NULL;
+
+/**
+ * Wait for outstanding compression tasks. Must be called before reading, decompressing or
+ * freeing nodes of any step that has already been pushed.
+ */
+static void sculpt_undo_compress_pool_wait(void)
+{
+  if (sculpt_undo_compress_pool != NULL) {
+    BLI_task_pool_work_and_wait(sculpt_undo_compress_pool);
+  }
+}
+
+static void sculpt_undo_compress_pool_exit(void *UNUSED(user_data))
+{
+  if (sculpt_undo_compress_pool != NULL) {
+    BLI_task_pool_work_and_wait(sculpt_undo_compress_pool);
+    BLI_task_pool_free(sculpt_undo_compress_pool);
+    sculpt_undo_compress_pool = NULL;
+  }
+}
+
+/** Returns a compressed copy of \a array, or NULL when compression failed. */
+static void *sculpt_undo_compress_array(const void *array, size_t *r_compressed_size)
+{
+  const size_t array_size = MEM_allocN_len(array);
+  const size_t max_compressed_size = ZSTD_compressBound(array_size);
+  void *compressed = MEM_mallocN(max_compressed_size, "SculptUndoNode compressed data");
+  const size_t compressed_size = ZSTD_compress(
+      compressed, max_compressed_size, array, array_size, SCULPT_UNDO_COMPRESS_LEVEL);
+  if (UNLIKELY(ZSTD_isError(compressed_size))) {
+    MEM_freeN(compressed);
+    return NULL;
+  }
+  *r_compressed_size = compressed_size;
+  /* Trim the compress-bound slack, the buffer lives for the whole undo step lifetime. */
+  return MEM_reallocN(compressed, compressed_size);
+}
+
+static void sculpt_undo_compress_node_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  SculptUndoNode *unode = taskdata;
+
+  if (unode->co != NULL) {
+    void *compressed = sculpt_undo_compress_array(unode->co, &unode->co_compressed_size);
+    if (compressed != NULL) {
+      MEM_freeN(unode->co);
+      unode->co = NULL;
+      unode->co_compressed = compressed;
+    }
+  }
+  if (unode->orig_co != NULL) {
+    void *compressed = sculpt_undo_compress_array(unode->orig_co,
+                                                  &unode->orig_co_compressed_size);
+    if (compressed != NULL) {
+      MEM_freeN(unode->orig_co);
+      unode->orig_co = NULL;
+      unode->orig_co_compressed = compressed;
+    }
+  }
+}
+
+static void *sculpt_undo_decompress_array(const void *compressed,
+                                          const size_t compressed_size,
+                                          const char *name)
+{
+  /* The zstd frame header stores the content size for the simple compression API. */
+  const size_t array_size = (size_t)ZSTD_getFrameContentSize(compressed, compressed_size);
+  void *array = MEM_mallocN(array_size, name);
+  const size_t decompressed_size = ZSTD_decompress(
+      array, array_size, compressed, compressed_size);
+  BLI_assert(decompressed_size == array_size);
+  UNUSED_VARS_NDEBUG(decompressed_size);
+  return array;
+}
+
+/** Restore the raw `co`/`orig_co` arrays of a previously compressed node. */
+static void sculpt_undo_node_decompress(SculptUndoNode *unode)
+{
+  if (unode->co_compressed != NULL) {
+    unode->co = sculpt_undo_decompress_array(
+        unode->co_compressed, unode->co_compressed_size, "SculptUndoNode.co");
+    MEM_freeN(unode->co_compressed);
+    unode->co_compressed = NULL;
+  }
+  if (unode->orig_co_compressed != NULL) {
+    unode->orig_co = sculpt_undo_decompress_array(
+        unode->orig_co_compressed, unode->orig_co_compressed_size, "SculptUndoNode.orig_co");
+    MEM_freeN(unode->orig_co_compressed);
+    unode->orig_co_compressed = NULL;
+  }
+}
+
+/** \} */
+
 static bool test_swap_v3_v3(float a[3], float b[3])
 {
   /* No need for float comparison here (memory is exactly equal or not). */
@@ -629,6 +740,8 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
   bool need_mask = false;
   bool need_refine_subdiv = false;
 
+  sculpt_undo_compress_pool_wait();
+
   for (unode = lb->first; unode; unode = unode->next) {
     /* Restore pivot. */
     copy_v3_v3(ss->pivot_pos, unode->pivot_pos);
@@ -714,6 +827,9 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
 
     switch (unode->type) {
       case SCULPT_UNDO_COORDS:
+        /* Once decompressed the node stays raw: restoring swaps the arrays with the current
+         * state, so they are needed again in writable form for redo. */
+        sculpt_undo_node_decompress(unode);
         if (sculpt_undo_restore_coords(C, depsgraph, unode)) {
           update = true;
         }
@@ -834,12 +950,17 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
 
 static void sculpt_undo_free_list(ListBase *lb)
 {
+  sculpt_undo_compress_pool_wait();
+
   SculptUndoNode *unode = lb->first;
   while (unode != NULL) {
     SculptUndoNode *unode_next = unode->next;
     if (unode->co) {
       MEM_freeN(unode->co);
     }
+    if (unode->co_compressed) {
+      MEM_freeN(unode->co_compressed);
+    }
     if (unode->no) {
       MEM_freeN(unode->no);
     }
@@ -852,6 +973,9 @@ static void sculpt_undo_free_list(ListBase *lb)
     if (unode->orig_co) {
       MEM_freeN(unode->orig_co);
     }
+    if (unode->orig_co_compressed) {
+      MEM_freeN(unode->orig_co_compressed);
+    }
     if (unode->vert_hidden) {
       MEM_freeN(unode->vert_hidden);
     }
@@ -1276,26 +1400,33 @@ SculptUndoNode *SCULPT_undo_push_node(Object *ob, PBVHNode *node, SculptUndoType
   /* List is manipulated by multiple threads, so we lock. */
   BLI_thread_lock(LOCK_CUSTOM1);
 
+  /* Attribute stroke undo data to a scope TDs can query, see #MEM_scope_usage_foreach. */
+  MEM_scope_push("sculpt-undo");
+
   ss->needs_flush_to_id = 1;
 
   if (ss->bm || ELEM(type, SCULPT_UNDO_DYNTOPO_BEGIN, SCULPT_UNDO_DYNTOPO_END)) {
     /* Dynamic topology stores only one undo node per stroke,
      * regardless of the number of PBVH nodes modified. */
     unode = sculpt_undo_bmesh_push(ob, node, type);
+    MEM_scope_pop();
     BLI_thread_unlock(LOCK_CUSTOM1);
     return unode;
   }
   if (type == SCULPT_UNDO_GEOMETRY) {
     unode = sculpt_undo_geometry_push(ob, type);
+    MEM_scope_pop();
     BLI_thread_unlock(LOCK_CUSTOM1);
     return unode;
   }
   if (type == SCULPT_UNDO_FACE_SETS) {
     unode = sculpt_undo_face_sets_push(ob, type);
+    MEM_scope_pop();
     BLI_thread_unlock(LOCK_CUSTOM1);
     return unode;
   }
   if ((unode = SCULPT_undo_get_node(node))) {
+    MEM_scope_pop();
     BLI_thread_unlock(LOCK_CUSTOM1);
     return unode;
   }
@@ -1354,6 +1485,7 @@ SculptUndoNode *SCULPT_undo_push_node(Object *ob, PBVHNode *node, SculptUndoType
     unode->shapeName[0] = '\0';
   }
 
+  MEM_scope_pop();
   BLI_thread_unlock(LOCK_CUSTOM1);
 
   return unode;
@@ -1395,6 +1527,20 @@ void SCULPT_undo_push_end_ex(const bool use_nested_undo)
     }
   }
 
+  /* Queue coordinate arrays for background compression now that the stroke can't touch them
+   * anymore (#SCULPT_undo_get_node only searches the current step's nodes). */
+  for (unode = usculpt->nodes.first; unode; unode = unode->next) {
+    if (unode->co == NULL && unode->orig_co == NULL) {
+      continue;
+    }
+    if (sculpt_undo_compress_pool == NULL) {
+      sculpt_undo_compress_pool = BLI_task_pool_create_background(NULL, TASK_PRIORITY_LOW);
+      BKE_blender_atexit_register(sculpt_undo_compress_pool_exit, NULL);
+    }
+    BLI_task_pool_push(
+        sculpt_undo_compress_pool, sculpt_undo_compress_node_task, unode, false, NULL);
+  }
+
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = G_MAIN->wm.first;
   if (wm->op_undo_depth == 0 || use_nested_undo) {
@@ -323,6 +323,8 @@ typedef struct FileListEntryCache {
   /* Previews handling. */
   TaskPool *previews_pool;
   ThreadQueue *previews_done;
+  /** Packed thumbnail index of the listed directory, opened with the previews pool. */
+  struct ThumbIndex *thumb_index;
   /** Counter for previews that are not fully loaded and ready to display yet. So includes all
    * previews either in `previews_pool` or `previews_done`. #filelist_cache_previews_update() makes
    * previews in `preview_done` ready for display, so the counter is decremented there. */
@@ -1621,11 +1623,20 @@ static void filelist_cache_preview_runf(TaskPool *__restrict pool, void *taskdat
     source = THB_SOURCE_FONT;
   }
 
-  IMB_thumb_path_lock(preview->path);
-  /* Always generate biggest preview size for now, it's simpler and avoids having to re-generate
-   * in case user switch to a bigger preview size. */
-  ImBuf *imbuf = IMB_thumb_manage(preview->path, THB_LARGE, source);
-  IMB_thumb_path_unlock(preview->path);
+  /* The packed index resolves most files of an already browsed directory without
+   * touching their individual thumbnail files. */
+  ImBuf *imbuf = NULL;
+  if (!cache->thumb_index || !IMB_thumb_index_lookup(cache->thumb_index, preview->path, &imbuf)) {
+    IMB_thumb_path_lock(preview->path);
+    /* Always generate biggest preview size for now, it's simpler and avoids having to re-generate
+     * in case user switch to a bigger preview size. */
+    imbuf = IMB_thumb_manage(preview->path, THB_LARGE, source);
+    IMB_thumb_path_unlock(preview->path);
+
+    if (cache->thumb_index) {
+      IMB_thumb_index_add(cache->thumb_index, preview->path, imbuf != NULL);
+    }
+  }
   if (imbuf) {
     preview->icon_id = BKE_icon_imbuf_create(imbuf);
   }
@@ -1650,12 +1661,15 @@ static void filelist_cache_preview_freef(TaskPool *__restrict UNUSED(pool), void
   MEM_freeN(preview_taskdata);
 }
 
-static void filelist_cache_preview_ensure_running(FileListEntryCache *cache)
+static void filelist_cache_preview_ensure_running(FileList *filelist)
 {
+  FileListEntryCache *cache = &filelist->filelist_cache;
+
   if (!cache->previews_pool) {
     cache->previews_pool = BLI_task_pool_create_background(cache, TASK_PRIORITY_LOW);
     cache->previews_done = BLI_thread_queue_init();
     cache->previews_todo_count = 0;
+    cache->thumb_index = IMB_thumb_index_open(filelist->filelist.root);
 
     IMB_thumb_locks_acquire();
   }
@@ -1688,6 +1702,11 @@ static void filelist_cache_previews_free(FileListEntryCache *cache)
 
     BLI_thread_queue_free(cache->previews_done);
     BLI_task_pool_free(cache->previews_pool);
+    /* Only after the pool is freed, tasks may still use the index until then. */
+    if (cache->thumb_index) {
+      IMB_thumb_index_close(cache->thumb_index);
+      cache->thumb_index = NULL;
+    }
     cache->previews_pool = NULL;
     cache->previews_done = NULL;
     cache->previews_todo_count = 0;
@@ -1729,7 +1748,7 @@ static void filelist_cache_previews_push(FileList *filelist, FileDirEntry *entry
     return;
   }
 
-  filelist_cache_preview_ensure_running(cache);
+  filelist_cache_preview_ensure_running(filelist);
   entry->flags |= FILE_ENTRY_PREVIEW_LOADING;
 
   FileListEntryPreview *preview = MEM_mallocN(sizeof(*preview), __func__);
@@ -1790,6 +1809,7 @@ static void filelist_cache_init(FileListEntryCache *cache, size_t cache_size)
   cache->flags = FLC_IS_INIT;
 
   cache->previews_todo_count = 0;
+  cache->thumb_index = NULL;
 
   /* We cannot translate from non-main thread, so init translated strings once from here. */
   IMB_thumb_ensure_translations();
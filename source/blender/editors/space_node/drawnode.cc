@@ -1675,6 +1675,7 @@ static float mute_expand_axis[3][2] = {{1.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, -0.0f}
 static struct {
   GPUBatch *batch;        /* for batching line together */
   GPUBatch *batch_single; /* for single line */
+  GPUUniformBuf *ubo;     /* data shared by all instances, valid for one batch_start/end cycle */
   GPUVertBuf *inst_vbo;
   uint p0_id, p1_id, p2_id, p3_id;
   uint colid_id, muted_id, start_color_id, end_color_id;
@@ -1876,28 +1877,34 @@ static void nodelink_batch_draw(const SpaceNode &snode)
   }
 
   GPU_blend(GPU_BLEND_ALPHA);
-  NodeLinkInstanceData node_link_data;
 
-  UI_GetThemeColor4fv(TH_WIRE_INNER, node_link_data.colors[nodelink_get_color_id(TH_WIRE_INNER)]);
-  UI_GetThemeColor4fv(TH_WIRE, node_link_data.colors[nodelink_get_color_id(TH_WIRE)]);
-  UI_GetThemeColor4fv(TH_ACTIVE, node_link_data.colors[nodelink_get_color_id(TH_ACTIVE)]);
-  UI_GetThemeColor4fv(TH_EDGE_SELECT,
-                      node_link_data.colors[nodelink_get_color_id(TH_EDGE_SELECT)]);
-  UI_GetThemeColor4fv(TH_REDALERT, node_link_data.colors[nodelink_get_color_id(TH_REDALERT)]);
-  node_link_data.expandSize = snode.runtime->aspect * LINK_WIDTH;
-  node_link_data.arrowSize = ARROW_SIZE;
+  /* The instance data is the same for all flushes between batch_start and batch_end, create the
+   * uniform buffer once per cycle instead of per flush (it is freed in #nodelink_batch_end). */
+  if (g_batch_link.ubo == nullptr) {
+    NodeLinkInstanceData node_link_data;
 
-  GPUUniformBuf *ubo = GPU_uniformbuf_create_ex(sizeof(node_link_data), &node_link_data, __func__);
+    UI_GetThemeColor4fv(TH_WIRE_INNER,
+                        node_link_data.colors[nodelink_get_color_id(TH_WIRE_INNER)]);
+    UI_GetThemeColor4fv(TH_WIRE, node_link_data.colors[nodelink_get_color_id(TH_WIRE)]);
+    UI_GetThemeColor4fv(TH_ACTIVE, node_link_data.colors[nodelink_get_color_id(TH_ACTIVE)]);
+    UI_GetThemeColor4fv(TH_EDGE_SELECT,
+                        node_link_data.colors[nodelink_get_color_id(TH_EDGE_SELECT)]);
+    UI_GetThemeColor4fv(TH_REDALERT, node_link_data.colors[nodelink_get_color_id(TH_REDALERT)]);
+    node_link_data.expandSize = snode.runtime->aspect * LINK_WIDTH;
+    node_link_data.arrowSize = ARROW_SIZE;
+
+    g_batch_link.ubo = GPU_uniformbuf_create_ex(
+        sizeof(node_link_data), &node_link_data, __func__);
+  }
 
   GPU_vertbuf_data_len_set(g_batch_link.inst_vbo, g_batch_link.count);
   GPU_vertbuf_use(g_batch_link.inst_vbo); /* force update. */
 
   GPU_batch_program_set_builtin(g_batch_link.batch, GPU_SHADER_2D_NODELINK_INST);
-  GPU_batch_uniformbuf_bind(g_batch_link.batch, "node_link_data", ubo);
+  GPU_batch_uniformbuf_bind(g_batch_link.batch, "node_link_data", g_batch_link.ubo);
   GPU_batch_draw(g_batch_link.batch);
 
-  GPU_uniformbuf_unbind(ubo);
-  GPU_uniformbuf_free(ubo);
+  GPU_uniformbuf_unbind(g_batch_link.ubo);
 
   nodelink_batch_reset();
 
@@ -1913,6 +1920,11 @@ void nodelink_batch_end(SpaceNode &snode)
 {
   nodelink_batch_draw(snode);
   g_batch_link.enabled = false;
+
+  if (g_batch_link.ubo != nullptr) {
+    GPU_uniformbuf_free(g_batch_link.ubo);
+    g_batch_link.ubo = nullptr;
+  }
 }
 
 static void nodelink_batch_add_link(const SpaceNode &snode,
@@ -127,7 +127,6 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
         case ND_OB_RENDER:
         case ND_MODE:
         case ND_KEYINGSET:
-        case ND_FRAME:
         case ND_RENDER_OPTIONS:
         case ND_SEQUENCER:
         case ND_LAYER_CONTENT:
@@ -135,6 +134,10 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
         case ND_SCENEBROWSE:
           ED_region_tag_redraw(region);
           break;
+        case ND_FRAME:
+          /* The tree contents do not depend on the current frame. */
+          ED_region_tag_redraw_no_rebuild(region);
+          break;
         case ND_LAYER:
           /* Avoid rebuild if only the active collection changes */
           if ((wmn->subtype == NS_LAYER_COLLECTION) && (wmn->action == NA_ACTIVATED)) {
@@ -156,7 +159,19 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
           break;
         case ND_BONE_ACTIVE:
         case ND_BONE_SELECT:
+          /* Bone selection does not change the element hierarchy, a rebuild is
+           * only needed to re-apply select/active based filtering. */
+          if (outliner_requires_rebuild_on_select_or_active_change(space_outliner)) {
+            ED_region_tag_redraw(region);
+          }
+          else {
+            ED_region_tag_redraw_no_rebuild(region);
+          }
+          break;
         case ND_DRAW:
+          /* Display options only, the tree is unaffected. */
+          ED_region_tag_redraw_no_rebuild(region);
+          break;
         case ND_PARENT:
         case ND_OB_SHADING:
           ED_region_tag_redraw(region);
@@ -182,7 +197,7 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
     case NC_LAMP:
       /* For updating light icons, when changing light type */
       if (wmn->data == ND_LIGHTING_DRAW) {
-        ED_region_tag_redraw(region);
+        ED_region_tag_redraw_no_rebuild(region);
       }
       break;
     case NC_SPACE:
@@ -232,9 +247,13 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
       }
       break;
     case NC_GPENCIL:
-      if (ELEM(wmn->action, NA_EDITED, NA_SELECTED)) {
+      if (wmn->action == NA_EDITED) {
         ED_region_tag_redraw(region);
       }
+      else if (wmn->action == NA_SELECTED) {
+        /* Layer selection changes highlights only, the layer set is unchanged. */
+        ED_region_tag_redraw_no_rebuild(region);
+      }
       break;
     case NC_SCREEN:
       if (ELEM(wmn->data, ND_LAYOUTDELETE, ND_LAYER)) {
@@ -172,6 +172,10 @@ static void format_draw_color(const TextDrawContext *tdc, char formatchar)
  * \encode
  */
 
+/* Draw-cache utilities, defined below. */
+static bool text_drawcache_line_heights_valid(const SpaceText *st, const ARegion *region);
+static int text_get_visible_lines_no(const SpaceText *st, int lineno);
+
 int wrap_width(const SpaceText *st, ARegion *region)
 {
   int winx = region->winx - TXT_SCROLL_WIDTH;
@@ -201,11 +205,17 @@ void wrap_offset(
 
   text = st->text;
 
+  /* Use the cached line heights where we can, scanning every line
+   * above the view for wrap points makes this O(text) per call. */
+  const bool use_cache = text_drawcache_line_heights_valid(st, region);
+
   /* Move pointer to first visible line (top) */
   linep = text->lines.first;
   i = st->top;
+  int lineno = 0;
   while (i > 0 && linep) {
-    int lines = text_get_visible_lines(st, region, linep->line);
+    int lines = use_cache ? text_get_visible_lines_no(st, lineno) :
+                            text_get_visible_lines(st, region, linep->line);
 
     /* Line before top */
     if (linep == linein) {
@@ -220,6 +230,7 @@ void wrap_offset(
     }
 
     linep = linep->next;
+    lineno++;
     (*offl) += lines - 1;
     i -= lines;
   }
@@ -632,6 +643,19 @@ static void text_update_drawcache(SpaceText *st, ARegion *region)
       nlines = BLI_listbase_count(&txt->lines);
       size = sizeof(int) * nlines;
 
+      /* Clamp the ranges tagged by #text_drawcache_tag_update,
+       * the edit may have removed more lines than the tag accounted for. */
+      CLAMP_MAX(drawcache->valid_head, MIN2(nlines, drawcache->nlines));
+      CLAMP_MAX(drawcache->valid_tail, MIN2(nlines, drawcache->nlines) - drawcache->valid_head);
+
+      /* When shrinking, move the unchanged tail into place before the buffer
+       * is reallocated. When growing this has to wait until after. */
+      if (fp && nlines < drawcache->nlines) {
+        memmove(fp + nlines - drawcache->valid_tail,
+                fp + drawcache->nlines - drawcache->valid_tail,
+                sizeof(int) * drawcache->valid_tail);
+      }
+
       if (fp) {
         fp = MEM_reallocN(fp, size);
       }
@@ -639,10 +663,11 @@ static void text_update_drawcache(SpaceText *st, ARegion *region)
         fp = MEM_callocN(size, "text drawcache line_height");
       }
 
-      drawcache->valid_tail = drawcache->valid_head = 0;
       old_tail = fp + drawcache->nlines - drawcache->valid_tail;
       new_tail = fp + nlines - drawcache->valid_tail;
-      memmove(new_tail, old_tail, drawcache->valid_tail);
+      if (nlines > drawcache->nlines) {
+        memmove(new_tail, old_tail, sizeof(int) * drawcache->valid_tail);
+      }
 
       drawcache->total_lines = 0;
 
@@ -655,7 +680,7 @@ static void text_update_drawcache(SpaceText *st, ARegion *region)
           lines_count = fp[lineno];
           drawcache->valid_head--;
         }
-        else if (lineno > new_tail - fp) { /* we-re inside valid tail lines */
+        else if (lineno >= new_tail - fp) { /* we-re inside valid tail lines */
           lines_count = fp[lineno];
         }
         else {
@@ -715,7 +740,7 @@ void text_drawcache_tag_update(SpaceText *st, int full)
     DrawCache *drawcache = st->runtime.drawcache;
     Text *txt = st->text;
 
-    if (drawcache->update_flag) {
+    if (drawcache->update_flag && full) {
       /* happens when tagging update from space listener */
       /* should do nothing to prevent locally tagged cache be fully recalculated */
       return;
@@ -724,24 +749,35 @@ void text_drawcache_tag_update(SpaceText *st, int full)
     if (!full) {
       int sellno = BLI_findindex(&txt->lines, txt->sell);
       int curlno = BLI_findindex(&txt->lines, txt->curl);
+      int valid_head, valid_tail;
 
       if (curlno < sellno) {
-        drawcache->valid_head = curlno;
-        drawcache->valid_tail = drawcache->nlines - sellno - 1;
+        valid_head = curlno;
+        valid_tail = drawcache->nlines - sellno - 1;
       }
       else {
-        drawcache->valid_head = sellno;
-        drawcache->valid_tail = drawcache->nlines - curlno - 1;
+        valid_head = sellno;
+        valid_tail = drawcache->nlines - curlno - 1;
       }
 
       /* quick cache recalculation is also used in delete operator,
        * which could merge lines which are adjacent to current selection lines
        * expand recalculate area to this lines */
-      if (drawcache->valid_head > 0) {
-        drawcache->valid_head--;
+      if (valid_head > 0) {
+        valid_head--;
+      }
+      if (valid_tail > 0) {
+        valid_tail--;
       }
-      if (drawcache->valid_tail > 0) {
-        drawcache->valid_tail--;
+
+      if (drawcache->update_flag) {
+        /* Merge with a pending partial tag, only lines untouched by both edits stay valid. */
+        drawcache->valid_head = MIN2(drawcache->valid_head, valid_head);
+        drawcache->valid_tail = MIN2(drawcache->valid_tail, valid_tail);
+      }
+      else {
+        drawcache->valid_head = valid_head;
+        drawcache->valid_tail = valid_tail;
       }
     }
     else {
@@ -776,6 +812,27 @@ static int text_get_visible_lines_no(const SpaceText *st, int lineno)
   return drawcache->line_height[lineno];
 }
 
+/**
+ * Check the cached line heights can be used for the current view settings.
+ * Needed for functions that also run outside the draw loop (cursor motion, scrolling),
+ * where #text_update_drawcache has not necessarily run first.
+ */
+static bool text_drawcache_line_heights_valid(const SpaceText *st, const ARegion *region)
+{
+  const DrawCache *drawcache = st->runtime.drawcache;
+
+  if (st->text == NULL || drawcache == NULL || drawcache->line_height == NULL ||
+      drawcache->update_flag) {
+    return false;
+  }
+
+  return (drawcache->winx == region->winx && drawcache->wordwrap == st->wordwrap &&
+          drawcache->showlinenrs == st->showlinenrs && drawcache->tabnumber == st->tabnumber &&
+          drawcache->lheight == st->runtime.lheight_px &&
+          drawcache->cwidth_px == st->runtime.cwidth_px &&
+          STREQLEN(drawcache->text_id, st->text->id.name, MAX_ID_NAME));
+}
+
 int text_get_visible_lines(const SpaceText *st, ARegion *region, const char *str)
 {
   int i, j, start, end, max, lines, chars;
@@ -821,13 +878,21 @@ int text_get_span_wrap(const SpaceText *st, ARegion *region, TextLine *from, Tex
     int ret = 0;
     TextLine *tmp = from;
 
+    /* Only spans starting at the first line can be indexed into the cache directly,
+     * which covers the scroll-bar computation over the whole text. */
+    const bool use_cache = (from == st->text->lines.first) &&
+                           text_drawcache_line_heights_valid(st, region);
+    int lineno = 0;
+
     /* Look forwards */
     while (tmp) {
       if (tmp == to) {
         return ret;
       }
-      ret += text_get_visible_lines(st, region, tmp->line);
+      ret += use_cache ? text_get_visible_lines_no(st, lineno) :
+                         text_get_visible_lines(st, region, tmp->line);
       tmp = tmp->next;
+      lineno++;
     }
 
     return ret;
@@ -55,6 +55,7 @@
 #include "ED_transform.h"
 #include "ED_view3d_offscreen.h"
 
+#include "DEG_depsgraph_debug.h"
 #include "DEG_depsgraph_query.h"
 
 #include "GPU_batch.h"
@@ -1287,6 +1288,39 @@ static void draw_viewport_name(ARegion *region, View3D *v3d, int xoffset, int *y
   BLF_disable(font_id, BLF_SHADOW);
 }
 
+/**
+ * Draw the slowest operations of the last depsgraph evaluation, for animators chasing
+ * playback slowdowns. Only shown with `--debug-depsgraph-time`, which also enables the
+ * per-operation timing collection, see #DEG_debug_eval_stats_get.
+ */
+static void draw_depsgraph_eval_stats(struct Depsgraph *depsgraph, int xoffset, int *yoffset)
+{
+  DEGDebugOperationStat stats[10];
+  const int stats_num = DEG_debug_eval_stats_get(depsgraph, stats, ARRAY_SIZE(stats));
+  const int font_id = BLF_default();
+
+  BLF_enable(font_id, BLF_SHADOW);
+  BLF_shadow(font_id, 5, (const float[4]){0.0f, 0.0f, 0.0f, 1.0f});
+  BLF_shadow_offset(font_id, 1, -1);
+
+  UI_FontThemeColor(font_id, TH_TEXT_HI);
+
+  for (int i = 0; i < stats_num; i++) {
+    char info[sizeof(stats[i].id_name) + sizeof(stats[i].operation_name) + 32];
+    BLI_snprintf(info,
+                 sizeof(info),
+                 "%7.2f ms  %s : %s",
+                 stats[i].time * 1000.0,
+                 stats[i].id_name,
+                 stats[i].operation_name);
+
+    *yoffset -= VIEW3D_OVERLAY_LINEHEIGHT;
+    BLF_draw_default(xoffset, *yoffset, 0.0f, info, sizeof(info));
+  }
+
+  BLF_disable(font_id, BLF_SHADOW);
+}
+
 /**
  * Draw info beside axes in top-left corner:
  * frame-number, collection, object name, bone name (if available), marker name (if available).
@@ -1506,6 +1540,10 @@ void view3d_draw_region_info(const bContext *C, ARegion *region)
       draw_grid_unit_name(scene, region, v3d, xoffset, &yoffset);
     }
 
+    if (G.debug & G_DEBUG_DEPSGRAPH_TIME) {
+      draw_depsgraph_eval_stats(CTX_data_expect_evaluated_depsgraph(C), xoffset, &yoffset);
+    }
+
     DRW_draw_region_engine_info(xoffset, &yoffset, VIEW3D_OVERLAY_LINEHEIGHT);
   }
 
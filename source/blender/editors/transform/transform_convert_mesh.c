@@ -15,6 +15,7 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 
 #include "BKE_context.h"
 #include "BKE_crazyspace.h"
@@ -2016,38 +2017,65 @@ static void tc_mesh_partial_update(TransInfo *t,
 /** \name Recalc Mesh Data
  * \{ */
 
+static void tc_mesh_transdata_mirror_edge_fn(void *__restrict iter_data_v,
+                                             const int iter,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  TransDataContainer *tc = iter_data_v;
+  TransData *td = &tc->data[iter];
+  if (td->flag & (TD_MIRROR_EDGE_X | TD_MIRROR_EDGE_Y | TD_MIRROR_EDGE_Z)) {
+    if (td->flag & TD_MIRROR_EDGE_X) {
+      td->loc[0] = 0.0f;
+    }
+    if (td->flag & TD_MIRROR_EDGE_Y) {
+      td->loc[1] = 0.0f;
+    }
+    if (td->flag & TD_MIRROR_EDGE_Z) {
+      td->loc[2] = 0.0f;
+    }
+  }
+}
+
+static void tc_mesh_transdata_mirror_copy_fn(void *__restrict iter_data_v,
+                                             const int iter,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  TransDataContainer *tc = iter_data_v;
+  TransDataMirror *td_mirror = &tc->data_mirror[iter];
+  copy_v3_v3(td_mirror->loc, td_mirror->loc_src);
+  if (td_mirror->flag & TD_MIRROR_X) {
+    td_mirror->loc[0] *= -1;
+  }
+  if (td_mirror->flag & TD_MIRROR_Y) {
+    td_mirror->loc[1] *= -1;
+  }
+  if (td_mirror->flag & TD_MIRROR_Z) {
+    td_mirror->loc[2] *= -1;
+  }
+}
+
 static void tc_mesh_transdata_mirror_apply(TransDataContainer *tc)
 {
   if (tc->use_mirror_axis_any) {
-    int i;
-    TransData *td;
-    for (i = 0, td = tc->data; i < tc->data_len; i++, td++) {
-      if (td->flag & (TD_MIRROR_EDGE_X | TD_MIRROR_EDGE_Y | TD_MIRROR_EDGE_Z)) {
-        if (td->flag & TD_MIRROR_EDGE_X) {
-          td->loc[0] = 0.0f;
-        }
-        if (td->flag & TD_MIRROR_EDGE_Y) {
-          td->loc[1] = 0.0f;
-        }
-        if (td->flag & TD_MIRROR_EDGE_Z) {
-          td->loc[2] = 0.0f;
-        }
+    if (tc->data_len < TRANSDATA_THREAD_LIMIT) {
+      int i;
+      TransData *td;
+      for (i = 0, td = tc->data; i < tc->data_len; i++, td++) {
+        tc_mesh_transdata_mirror_edge_fn(tc, i, NULL);
       }
-    }
 
-    TransDataMirror *td_mirror = tc->data_mirror;
-    for (i = 0; i < tc->data_mirror_len; i++, td_mirror++) {
-      copy_v3_v3(td_mirror->loc, td_mirror->loc_src);
-      if (td_mirror->flag & TD_MIRROR_X) {
-        td_mirror->loc[0] *= -1;
-      }
-      if (td_mirror->flag & TD_MIRROR_Y) {
-        td_mirror->loc[1] *= -1;
-      }
-      if (td_mirror->flag & TD_MIRROR_Z) {
-        td_mirror->loc[2] *= -1;
+      TransDataMirror *td_mirror = tc->data_mirror;
+      for (i = 0; i < tc->data_mirror_len; i++, td_mirror++) {
+        tc_mesh_transdata_mirror_copy_fn(tc, i, NULL);
       }
     }
+    else {
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      BLI_task_parallel_range(0, tc->data_len, tc, tc_mesh_transdata_mirror_edge_fn, &settings);
+      BLI_task_parallel_range(
+          0, tc->data_mirror_len, tc, tc_mesh_transdata_mirror_copy_fn, &settings);
+    }
   }
 }
 
@@ -669,7 +669,9 @@ static void initSnappingMode(TransInfo *t)
   if (t->spacetype == SPACE_VIEW3D) {
     if (t->tsnap.object_context == NULL) {
       t->tsnap.use_backface_culling = snap_use_backface_culling(t);
-      t->tsnap.object_context = ED_transform_snap_object_context_create(t->scene, 0);
+      /* Borrow the persistent snap context of the 3D cursor, so BVH trees and per object
+       * snap data built during one modal operation can be reused by the next one. */
+      t->tsnap.object_context = ED_view3d_cursor_snap_context_ensure(t->scene);
 
       if (t->data_type == TC_MESH_VERTS) {
         /* Ignore elements being transformed. */
@@ -771,7 +773,10 @@ void freeSnapping(TransInfo *t)
     t->tsnap.seq_context = NULL;
   }
   else if (t->tsnap.object_context) {
-    ED_transform_snap_object_context_destroy(t->tsnap.object_context);
+    /* The snap context is owned by the 3D cursor snapping and shared between operations,
+     * only reset the filter callbacks set in #initSnappingMode for this operation. */
+    ED_transform_snap_object_context_set_editmesh_callbacks(
+        t->tsnap.object_context, NULL, NULL, NULL, NULL);
     t->tsnap.object_context = NULL;
   }
 }
@@ -2883,11 +2883,29 @@ void ED_transform_snap_object_context_set_editmesh_callbacks(
     bool (*test_face_fn)(BMFace *, void *user_data),
     void *user_data)
 {
+  if ((sctx->callbacks.edit_mesh.test_vert_fn == test_vert_fn) &&
+      (sctx->callbacks.edit_mesh.test_edge_fn == test_edge_fn) &&
+      (sctx->callbacks.edit_mesh.test_face_fn == test_face_fn) &&
+      (sctx->callbacks.edit_mesh.user_data == user_data)) {
+    return;
+  }
+
   sctx->callbacks.edit_mesh.test_vert_fn = test_vert_fn;
   sctx->callbacks.edit_mesh.test_edge_fn = test_edge_fn;
   sctx->callbacks.edit_mesh.test_face_fn = test_face_fn;
 
   sctx->callbacks.edit_mesh.user_data = user_data;
+
+  /* Trees of edit meshes may have been built with element masks from the previous
+   * filter functions, those cannot be reused for different filters. The unfiltered
+   * trees stay in the mesh runtime BVH-cache and survive this. */
+  GHashIterator gh_iter;
+  GHASH_ITER (gh_iter, sctx->cache.object_map) {
+    SnapObjectData *sod = BLI_ghashIterator_getValue(&gh_iter);
+    if (sod->type == SNAP_EDIT_MESH) {
+      snap_object_data_clear(sod);
+    }
+  }
 }
 
 bool ED_transform_snap_object_project_ray_ex(SnapObjectContext *sctx,
@@ -564,7 +564,14 @@ void ED_uvedit_pack_islands_multi(const Scene *scene,
   }
 
   float boxarray_size[2];
-  BLI_box_pack_2d(boxarray, island_list_len, &boxarray_size[0], &boxarray_size[1]);
+  /* The vertex based packer gives slightly denser results but goes quadratic in the number of
+   * islands, switch to the skyline packer when there are too many for it to stay interactive. */
+  if (island_list_len < 1024) {
+    BLI_box_pack_2d(boxarray, island_list_len, &boxarray_size[0], &boxarray_size[1]);
+  }
+  else {
+    BLI_box_pack_2d_skyline(boxarray, island_list_len, &boxarray_size[0], &boxarray_size[1]);
+  }
 
   /* Don't change the aspect when scaling. */
   boxarray_size[0] = boxarray_size[1] = max_ff(boxarray_size[0], boxarray_size[1]);
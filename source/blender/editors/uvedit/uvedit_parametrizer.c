@@ -14,6 +14,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "uvedit_parametrizer.h"
@@ -4583,61 +4584,124 @@ void param_construct_end(ParamHandle *handle,
   phandle->state = PHANDLE_STATE_CONSTRUCTED;
 }
 
+/* Charts are fully independent once constructed: each one carries its own solver
+ * context and the ABF system uses per-call allocations, so the expensive per-chart
+ * setup and solve loops below run in parallel. Only the handle's arena, heap and
+ * random number generator are shared, and none of them is touched here. */
+
+typedef struct ParamLSCMBeginData {
+  PHandle *phandle;
+  PBool live;
+  PBool abf;
+} ParamLSCMBeginData;
+
+static void param_lscm_begin_chart_fn(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ParamLSCMBeginData *data = userdata;
+  PChart *chart = data->phandle->charts[i];
+  PFace *f;
+
+  for (f = chart->faces; f; f = f->nextlink) {
+    p_face_backup_uvs(f);
+  }
+  p_chart_lscm_begin(chart, data->live, data->abf);
+}
+
 void param_lscm_begin(ParamHandle *handle, ParamBool live, ParamBool abf)
 {
   PHandle *phandle = (PHandle *)handle;
-  PFace *f;
-  int i;
 
   param_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
   phandle->state = PHANDLE_STATE_LSCM;
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    for (f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
-    }
-    p_chart_lscm_begin(phandle->charts[i], (PBool)live, (PBool)abf);
+  ParamLSCMBeginData data = {
+      .phandle = phandle,
+      .live = (PBool)live,
+      .abf = (PBool)abf,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, phandle->ncharts, &data, param_lscm_begin_chart_fn, &settings);
+}
+
+enum {
+  PARAM_LSCM_CHART_SKIPPED = 0,
+  PARAM_LSCM_CHART_CHANGED = 1,
+  PARAM_LSCM_CHART_FAILED = 2,
+};
+
+typedef struct ParamLSCMSolveData {
+  PHandle *phandle;
+  /* Per-chart result, accumulated into the counts after the parallel loop. */
+  char *chart_result;
+} ParamLSCMSolveData;
+
+static void param_lscm_solve_chart_fn(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ParamLSCMSolveData *data = userdata;
+  PChart *chart = data->phandle->charts[i];
+
+  if (!chart->u.lscm.context) {
+    data->chart_result[i] = PARAM_LSCM_CHART_SKIPPED;
+    return;
+  }
+
+  const PBool result = p_chart_lscm_solve(data->phandle, chart);
+
+  if (result && !(chart->flag & PCHART_HAS_PINS)) {
+    p_chart_rotate_minimum_area(chart);
+  }
+  else if (result && chart->u.lscm.single_pin) {
+    p_chart_rotate_fit_aabb(chart);
+    p_chart_lscm_transform_single_pin(chart);
   }
+
+  if (!result || !(chart->flag & PCHART_HAS_PINS)) {
+    p_chart_lscm_end(chart);
+  }
+
+  data->chart_result[i] = result ? PARAM_LSCM_CHART_CHANGED : PARAM_LSCM_CHART_FAILED;
 }
 
 void param_lscm_solve(ParamHandle *handle, int *count_changed, int *count_failed)
 {
   PHandle *phandle = (PHandle *)handle;
-  PChart *chart;
   int i;
 
   param_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    chart = phandle->charts[i];
+  if (phandle->ncharts == 0) {
+    return;
+  }
 
-    if (chart->u.lscm.context) {
-      const PBool result = p_chart_lscm_solve(phandle, chart);
+  ParamLSCMSolveData data = {
+      .phandle = phandle,
+      .chart_result = MEM_callocN(sizeof(char) * phandle->ncharts, "ParamLSCMChartResult"),
+  };
 
-      if (result && !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_rotate_minimum_area(chart);
-      }
-      else if (result && chart->u.lscm.single_pin) {
-        p_chart_rotate_fit_aabb(chart);
-        p_chart_lscm_transform_single_pin(chart);
-      }
-
-      if (!result || !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_lscm_end(chart);
-      }
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, phandle->ncharts, &data, param_lscm_solve_chart_fn, &settings);
 
-      if (result) {
-        if (count_changed != NULL) {
-          *count_changed += 1;
-        }
+  for (i = 0; i < phandle->ncharts; i++) {
+    if (data.chart_result[i] == PARAM_LSCM_CHART_CHANGED) {
+      if (count_changed != NULL) {
+        *count_changed += 1;
       }
-      else {
-        if (count_failed != NULL) {
-          *count_failed += 1;
-        }
+    }
+    else if (data.chart_result[i] == PARAM_LSCM_CHART_FAILED) {
+      if (count_failed != NULL) {
+        *count_failed += 1;
       }
     }
   }
+
+  MEM_freeN(data.chart_result);
 }
 
 void param_lscm_end(ParamHandle *handle)
@@ -4837,7 +4901,13 @@ void param_pack(ParamHandle *handle, float margin, bool do_rotate, bool ignore_p
     }
   }
 
-  BLI_box_pack_2d(boxarray, phandle->ncharts - unpacked, &tot_width, &tot_height);
+  /* See #uvedit_pack_islands_multi, the skyline packer scales to very large chart counts. */
+  if (phandle->ncharts - unpacked < 1024) {
+    BLI_box_pack_2d(boxarray, phandle->ncharts - unpacked, &tot_width, &tot_height);
+  }
+  else {
+    BLI_box_pack_2d_skyline(boxarray, phandle->ncharts - unpacked, &tot_width, &tot_height);
+  }
 
   if (tot_height > tot_width) {
     scale = 1.0f / tot_height;
@@ -20,11 +20,10 @@
 
 #include "BLI_alloca.h"
 #include "BLI_array.h"
-#include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
-#include "BLI_memarena.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "BLI_uvproject.h"
 
@@ -2116,6 +2115,45 @@ static uint smart_uv_project_calculate_project_normals(const ThickFace *thick_fa
   return BLI_array_len(project_normal_array);
 }
 
+typedef struct SmartProjectFacesData {
+  const ThickFace *thick_faces;
+  const float (*project_normal_array)[3];
+  const float (*project_axis_array)[3][3];
+  int project_normals_len;
+  uint cd_loop_uv_offset;
+} SmartProjectFacesData;
+
+/**
+ * Assign a face to the projection normal it matches best and project its UV's.
+ * Independent per face, so it can run in parallel over #SmartProjectFacesData.thick_faces.
+ */
+static void smart_uv_project_faces_fn(void *__restrict userdata,
+                                      const int f_index,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmartProjectFacesData *data = userdata;
+  const ThickFace *tf = &data->thick_faces[f_index];
+  const float *f_normal = tf->efa->no;
+
+  float angle_best = dot_v3v3(f_normal, data->project_normal_array[0]);
+  int angle_best_index = 0;
+
+  for (int p_index = 1; p_index < data->project_normals_len; p_index++) {
+    const float angle_test = dot_v3v3(f_normal, data->project_normal_array[p_index]);
+    if (angle_test > angle_best) {
+      angle_best = angle_test;
+      angle_best_index = p_index;
+    }
+  }
+
+  BMIter liter;
+  BMLoop *l;
+  BM_ITER_ELEM (l, &liter, tf->efa, BM_LOOPS_OF_FACE) {
+    MLoopUV *luv = BM_ELEM_CD_GET_VOID_P(l, data->cd_loop_uv_offset);
+    mul_v2_m3v3(luv->uv, data->project_axis_array[angle_best_index], l->v->co);
+  }
+}
+
 static int smart_project_exec(bContext *C, wmOperator *op)
 {
   Scene *scene = CTX_data_scene(C);
@@ -2131,9 +2169,6 @@ static int smart_project_exec(bContext *C, wmOperator *op)
   const float project_angle_limit_cos = cosf(project_angle_limit);
   const float project_angle_limit_half_cos = cosf(project_angle_limit / 2);
 
-  /* Memory arena for list links (cleared for each object). */
-  MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-
   uint objects_len = 0;
   Object **objects = BKE_view_layer_array_from_objects_in_edit_mode_unique_data(
       view_layer, v3d, &objects_len);
@@ -2201,64 +2236,41 @@ static int smart_project_exec(bContext *C, wmOperator *op)
       continue;
     }
 
-    /* After finding projection vectors, we find the uv positions. */
-    LinkNode **thickface_project_groups = MEM_callocN(
-        sizeof(*thickface_project_groups) * project_normals_len, __func__);
-
-    BLI_memarena_clear(arena);
-
-    for (int f_index = thick_faces_len - 1; f_index >= 0; f_index--) {
-      const float *f_normal = thick_faces[f_index].efa->no;
-
-      float angle_best = dot_v3v3(f_normal, project_normal_array[0]);
-      uint angle_best_index = 0;
-
-      for (int p_index = 1; p_index < project_normals_len; p_index++) {
-        const float angle_test = dot_v3v3(f_normal, project_normal_array[p_index]);
-        if (angle_test > angle_best) {
-          angle_best = angle_test;
-          angle_best_index = p_index;
-        }
-      }
-
-      BLI_linklist_prepend_arena(
-          &thickface_project_groups[angle_best_index], &thick_faces[f_index], arena);
+    /* After finding projection vectors, we find the uv positions.
+     * Assignment and projection only read shared data and write each face's own loop UV's,
+     * dense meshes spend most of the operator here so run over the faces in parallel. */
+    float(*project_axis_array)[3][3] = MEM_mallocN(
+        sizeof(*project_axis_array) * project_normals_len, __func__);
+    for (int p_index = 0; p_index < project_normals_len; p_index++) {
+      axis_dominant_v3_to_m3(project_axis_array[p_index], project_normal_array[p_index]);
     }
 
-    for (int p_index = 0; p_index < project_normals_len; p_index++) {
-      if (thickface_project_groups[p_index] == NULL) {
-        continue;
-      }
+    SmartProjectFacesData data = {
+        .thick_faces = thick_faces,
+        .project_normal_array = (const float(*)[3])project_normal_array,
+        .project_axis_array = (const float(*)[3][3])project_axis_array,
+        .project_normals_len = project_normals_len,
+        .cd_loop_uv_offset = cd_loop_uv_offset,
+    };
 
-      float axis_mat[3][3];
-      axis_dominant_v3_to_m3(axis_mat, project_normal_array[p_index]);
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    BLI_task_parallel_range(0, (int)thick_faces_len, &data, smart_uv_project_faces_fn, &settings);
 
-      for (LinkNode *list = thickface_project_groups[p_index]; list; list = list->next) {
-        ThickFace *tf = list->link;
-        BMIter liter;
-        BMLoop *l;
-        BM_ITER_ELEM (l, &liter, tf->efa, BM_LOOPS_OF_FACE) {
-          MLoopUV *luv = BM_ELEM_CD_GET_VOID_P(l, cd_loop_uv_offset);
-          mul_v2_m3v3(luv->uv, axis_mat, l->v->co);
-        }
-        changed = true;
-      }
+    if (thick_faces_len != 0) {
+      changed = true;
     }
 
+    MEM_freeN(project_axis_array);
     MEM_freeN(thick_faces);
     MEM_freeN(project_normal_array);
 
-    /* No need to free the lists in 'thickface_project_groups' values as the 'arena' is used. */
-    MEM_freeN(thickface_project_groups);
-
     if (changed) {
       objects_changed[object_changed_len] = objects[ob_index];
       object_changed_len += 1;
     }
   }
 
-  BLI_memarena_free(arena);
-
   MEM_freeN(objects);
 
   /* Pack islands & Stretch to UV bounds */
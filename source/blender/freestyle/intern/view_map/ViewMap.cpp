@@ -75,8 +75,13 @@ void ViewMap::Clean()
 
 ViewShape *ViewMap::viewShape(unsigned id)
 {
-  int index = _shapeIdToIndex[id];
-  return _VShapes[index];
+  /* Use find() instead of operator[], the latter inserts missing keys which
+   * would not be safe with visibility computed from multiple threads. */
+  id_to_index_map::const_iterator it = _shapeIdToIndex.find(id);
+  if (it == _shapeIdToIndex.end()) {
+    return nullptr;
+  }
+  return _VShapes[it->second];
 }
 
 void ViewMap::AddViewShape(ViewShape *iVShape)
@@ -136,6 +136,31 @@ static Set<GFieldRef> find_varying_fields(const FieldTreeInfo &field_tree_info,
   return found_fields;
 }
 
+/**
+ * Identifies a call in the procedure by the called function and the input variables that are
+ * passed to it. Used to detect common subexpressions: distinct operation nodes often reference
+ * the same multi-function with the same inputs, e.g. when the same node group is instanced
+ * multiple times.
+ */
+struct FieldFunctionCallKey {
+  const MultiFunction *fn;
+  Vector<MFVariable *> input_variables;
+
+  uint64_t hash() const
+  {
+    uint64_t h = get_default_hash(fn);
+    for (const MFVariable *variable : input_variables) {
+      h = h * 33 ^ get_default_hash(variable);
+    }
+    return h;
+  }
+
+  friend bool operator==(const FieldFunctionCallKey &a, const FieldFunctionCallKey &b)
+  {
+    return a.fn == b.fn && a.input_variables == b.input_variables;
+  }
+};
+
 /**
  * Builds the #procedure so that it computes the the fields.
  */
@@ -145,8 +170,11 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
                                                       Span<GFieldRef> output_fields)
 {
   MFProcedureBuilder builder{procedure};
-  /* Every input, intermediate and output field corresponds to a variable in the procedure. */
+  /* Every input, intermediate and output field corresponds to a variable in the procedure.
+   * Multiple fields can share a variable when they are found to compute the same value. */
   Map<GFieldRef, MFVariable *> variable_by_field;
+  /* Output variables of calls that have been emitted already, used to skip identical calls. */
+  Map<FieldFunctionCallKey, Vector<MFVariable *>> output_variables_by_call;
 
   /* Start by adding the field inputs as parameters to the procedure. */
   for (const FieldInput &field_input : field_tree_info.deduplicated_field_inputs) {
@@ -196,14 +224,61 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
             const MultiFunction &multi_function = operation_node.multi_function();
             Vector<MFVariable *> variables(multi_function.param_amount());
 
+            Vector<MFVariable *> input_variables;
+            for (const GField &input_field : operation_inputs) {
+              input_variables.append(variable_by_field.lookup(input_field));
+            }
+            FieldFunctionCallKey call_key{&multi_function, std::move(input_variables)};
+
+            /* Check if an identical call has been emitted before. If so, its output variables can
+             * be reused instead of computing the same values again, unless an output that is used
+             * now was ignored by the previous call. */
+            const Vector<MFVariable *> *reusable_outputs = output_variables_by_call.lookup_ptr(
+                call_key);
+            if (reusable_outputs != nullptr) {
+              bool all_outputs_found = true;
+              int param_output_index = 0;
+              for (const int param_index : multi_function.param_indices()) {
+                if (multi_function.param_type(param_index).interface_type() !=
+                    MFParamType::Output) {
+                  continue;
+                }
+                const GFieldRef output_field{operation_node, param_output_index};
+                const bool output_is_ignored =
+                    field_tree_info.field_users.lookup(output_field).is_empty() &&
+                    !output_fields.contains(output_field);
+                if (!output_is_ignored && (*reusable_outputs)[param_output_index] == nullptr) {
+                  all_outputs_found = false;
+                  break;
+                }
+                param_output_index++;
+              }
+              if (all_outputs_found) {
+                param_output_index = 0;
+                for (const int param_index : multi_function.param_indices()) {
+                  if (multi_function.param_type(param_index).interface_type() !=
+                      MFParamType::Output) {
+                    continue;
+                  }
+                  MFVariable *reused_variable = (*reusable_outputs)[param_output_index];
+                  if (reused_variable != nullptr) {
+                    variable_by_field.add_new({operation_node, param_output_index},
+                                              reused_variable);
+                  }
+                  param_output_index++;
+                }
+                break;
+              }
+            }
+
             int param_input_index = 0;
             int param_output_index = 0;
+            Vector<MFVariable *> output_variables;
             for (const int param_index : multi_function.param_indices()) {
               const MFParamType param_type = multi_function.param_type(param_index);
               const MFParamType::InterfaceType interface_type = param_type.interface_type();
               if (interface_type == MFParamType::Input) {
-                const GField &input_field = operation_inputs[param_input_index];
-                variables[param_index] = variable_by_field.lookup(input_field);
+                variables[param_index] = call_key.input_variables[param_input_index];
                 param_input_index++;
               }
               else if (interface_type == MFParamType::Output) {
@@ -221,6 +296,7 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
                   variables[param_index] = &new_variable;
                   variable_by_field.add_new(output_field, &new_variable);
                 }
+                output_variables.append(variables[param_index]);
                 param_output_index++;
               }
               else {
@@ -228,6 +304,8 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
               }
             }
             builder.add_call_with_all_variables(multi_function, variables);
+            output_variables_by_call.add_overwrite(std::move(call_key),
+                                                   std::move(output_variables));
           }
           break;
         }
@@ -256,13 +334,17 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
     builder.add_output_parameter(*variable);
   }
 
-  /* Remove the variables that should not be destructed from the map. */
+  /* Add destructor calls for the remaining variables. Multiple fields can share one variable when
+   * common subexpressions were eliminated, so skip output variables explicitly and make sure that
+   * no variable is destructed more than once. */
+  Set<MFVariable *> destructed_variables;
   for (const GFieldRef &field : output_fields) {
-    variable_by_field.remove(field);
+    destructed_variables.add(variable_by_field.lookup(field));
   }
-  /* Add destructor calls for the remaining variables. */
   for (MFVariable *variable : variable_by_field.values()) {
-    builder.add_destruct(*variable);
+    if (destructed_variables.add(variable)) {
+      builder.add_destruct(*variable);
+    }
   }
 
   MFReturnInstruction &return_instr = builder.add_return();
@@ -2,11 +2,14 @@
 
 #include "BLI_array.hh"
 #include "BLI_index_mask.hh"
-#include "BLI_kdtree.h"
+#include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
+#include "atomic_ops.h"
+
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
 
@@ -1596,22 +1599,134 @@ static Mesh *create_merged_mesh(const Mesh &mesh,
 /** \name Merge Map Creation
  * \{ */
 
+/**
+ * Hash a grid cell into a bucket key. Collisions between distant cells are harmless: they only
+ * add candidates that the distance check rejects.
+ */
+static uint64_t weld_grid_cell_hash(const int64_t x, const int64_t y, const int64_t z)
+{
+  return ((uint64_t)x * 73856093llu) ^ ((uint64_t)y * 19349669llu) ^ ((uint64_t)z * 83492791llu);
+}
+
+static void weld_grid_cell_of_point(const float co[3],
+                                    const float3 &grid_min,
+                                    const double cell_size_inv,
+                                    int64_t r_cell[3])
+{
+  r_cell[0] = (int64_t)floor(double(co[0] - grid_min[0]) * cell_size_inv);
+  r_cell[1] = (int64_t)floor(double(co[1] - grid_min[1]) * cell_size_inv);
+  r_cell[2] = (int64_t)floor(double(co[2] - grid_min[2]) * cell_size_inv);
+}
+
+static int weld_cluster_find_root(const Span<int> cluster_parent, int v)
+{
+  while (cluster_parent[v] != v) {
+    v = cluster_parent[v];
+  }
+  return v;
+}
+
+/**
+ * Join the clusters of \a a and \a b. Always links the root with the larger index to the root
+ * with the smaller one, so every cluster converges to its lowest vertex index and the result
+ * does not depend on the order in which threads process the pairs.
+ */
+static void weld_cluster_join(MutableSpan<int> cluster_parent, int a, int b)
+{
+  while (true) {
+    a = weld_cluster_find_root(cluster_parent, a);
+    b = weld_cluster_find_root(cluster_parent, b);
+    if (a == b) {
+      return;
+    }
+    if (a > b) {
+      std::swap(a, b);
+    }
+    if (atomic_cas_int32(&cluster_parent[b], b, a) == b) {
+      return;
+    }
+    /* Another thread re-parented `b` in the meantime, retry from the new roots. */
+  }
+}
+
 std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
                                                  const IndexMask selection,
                                                  const float merge_distance)
 {
+  Span<MVert> verts{mesh.mvert, mesh.totvert};
   Array<int> vert_dest_map(mesh.totvert, OUT_OF_CONTEXT);
 
-  KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
+  if (selection.size() < 2) {
+    return std::nullopt;
+  }
 
+  float3 grid_min(FLT_MAX);
+  float3 grid_max(-FLT_MAX);
   for (const int i : selection) {
-    BLI_kdtree_3d_insert(tree, i, mesh.mvert[i].co);
+    minmax_v3v3_v3(grid_min, grid_max, verts[i].co);
   }
 
-  BLI_kdtree_3d_balance(tree);
-  const int vert_kill_len = BLI_kdtree_3d_calc_duplicates_fast(
-      tree, merge_distance, false, vert_dest_map.data());
-  BLI_kdtree_3d_free(tree);
+  /* A cell edge of exactly the merge distance keeps every candidate pair within the 3x3x3 cell
+   * neighborhood of a vertex. */
+  const float cell_size = std::max(merge_distance, FLT_EPSILON);
+  const double cell_size_inv = 1.0 / double(cell_size);
+
+  Map<uint64_t, Vector<int>> grid;
+  grid.reserve(selection.size());
+  for (const int i : selection) {
+    int64_t cell[3];
+    weld_grid_cell_of_point(verts[i].co, grid_min, cell_size_inv, cell);
+    grid.lookup_or_add_default(weld_grid_cell_hash(cell[0], cell[1], cell[2])).append(i);
+  }
+
+  /* Cluster vertices with a union-find over all candidate pairs. The grid is only read here, so
+   * the pairs can be processed from multiple threads. Unlike the single kd-tree pass this used to
+   * be, merging is transitive within a cluster, which matches how chained duplicates were already
+   * collapsed. */
+  Array<int> cluster_parent(mesh.totvert);
+  threading::parallel_for(IndexRange(mesh.totvert), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      cluster_parent[i] = i;
+    }
+  });
+
+  const float merge_dist_sq = square_f(merge_distance);
+  threading::parallel_for(selection.index_range(), 512, [&](IndexRange range) {
+    for (const int sel_i : range) {
+      const int i = selection[sel_i];
+      int64_t cell[3];
+      weld_grid_cell_of_point(verts[i].co, grid_min, cell_size_inv, cell);
+      for (int64_t x = cell[0] - 1; x <= cell[0] + 1; x++) {
+        for (int64_t y = cell[1] - 1; y <= cell[1] + 1; y++) {
+          for (int64_t z = cell[2] - 1; z <= cell[2] + 1; z++) {
+            const Vector<int> *bucket = grid.lookup_ptr(weld_grid_cell_hash(x, y, z));
+            if (bucket == nullptr) {
+              continue;
+            }
+            for (const int j : *bucket) {
+              /* Each pair is only processed from the side with the larger index. */
+              if (j >= i) {
+                continue;
+              }
+              if (len_squared_v3v3(verts[i].co, verts[j].co) <= merge_dist_sq) {
+                weld_cluster_join(cluster_parent, i, j);
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+
+  /* Every vertex that is not the root of its cluster merges into that root. */
+  int vert_kill_len = 0;
+  for (const int i : selection) {
+    const int root = weld_cluster_find_root(cluster_parent, i);
+    if (root != i) {
+      vert_dest_map[i] = root;
+      vert_kill_len++;
+    }
+  }
 
   if (vert_kill_len == 0) {
     return std::nullopt;
@@ -124,6 +124,15 @@ struct RealizeCurveInfo {
    * will be empty.
    */
   Array<std::optional<GVArray_GSpan>> spline_attributes;
+  /**
+   * Point attribute data for every spline, looked up once here so that the name hash lookups are
+   * not repeated for every task that references this curve. Indexed by attribute index first and
+   * spline index second. Only point domain attributes have spans here; the `std::optional` is
+   * empty when a spline does not store the attribute itself.
+   */
+  Array<Array<std::optional<GSpan>>> point_attributes;
+  /** Point ids for every spline. If a spline has no ids, its #Span is empty. */
+  Array<Span<int>> stored_point_ids;
 };
 
 struct RealizeCurveTask {
@@ -477,6 +486,42 @@ static void gather_realize_tasks_recursive(GatherTasksInfo &gather_info,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Attribute Copying
+ * \{ */
+
+/**
+ * Copy the source attribute values into the destination slice. Most attribute types are trivial,
+ * in which case the whole block is copied with a single #memcpy instead of going through the
+ * type's copy function in chunks.
+ */
+static void copy_generic_attribute_values(const GSpan src_span, GMutableSpan dst_span)
+{
+  BLI_assert(src_span.size() == dst_span.size());
+  const CPPType &cpp_type = dst_span.type();
+  if (cpp_type.is_trivial()) {
+    memcpy(dst_span.data(), src_span.data(), (size_t)src_span.size() * cpp_type.size());
+    return;
+  }
+  threading::parallel_for(IndexRange(src_span.size()), 1024, [&](const IndexRange range) {
+    cpp_type.copy_assign_n(
+        src_span.slice(range).data(), dst_span.slice(range).data(), range.size());
+  });
+}
+
+/**
+ * Fill the destination slice with a single value.
+ */
+static void fill_generic_attribute_value(const void *value, GMutableSpan dst_span)
+{
+  const CPPType &cpp_type = dst_span.type();
+  threading::parallel_for(IndexRange(dst_span.size()), 1024, [&](const IndexRange range) {
+    cpp_type.fill_assign_n(value, dst_span.slice(range).data(), range.size());
+  });
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Point Cloud
  * \{ */
@@ -611,22 +656,14 @@ static void execute_realize_pointcloud_task(const RealizeInstancesOptions &optio
           if (pointcloud_info.attributes[attribute_index].has_value()) {
             /* Copy attribute from the original point cloud. */
             const GSpan src_span = *pointcloud_info.attributes[attribute_index];
-            threading::parallel_for(
-                IndexRange(pointcloud.totpoint), 1024, [&](const IndexRange range) {
-                  cpp_type.copy_assign_n(
-                      src_span.slice(range).data(), dst_span.slice(range).data(), range.size());
-                });
+            copy_generic_attribute_values(src_span, dst_span);
           }
           else {
             if (attribute_fallback == nullptr) {
               attribute_fallback = cpp_type.default_value();
             }
             /* As the fallback value for the attribute. */
-            threading::parallel_for(
-                IndexRange(pointcloud.totpoint), 1024, [&](const IndexRange range) {
-                  cpp_type.fill_assign_n(
-                      attribute_fallback, dst_span.slice(range).data(), range.size());
-                });
+            fill_generic_attribute_value(attribute_fallback, dst_span);
           }
         }
       });
@@ -908,22 +945,13 @@ static void execute_realize_mesh_task(const RealizeInstancesOptions &options,
           const void *attribute_fallback = task.attribute_fallbacks.array[attribute_index];
           if (mesh_info.attributes[attribute_index].has_value()) {
             const GSpan src_span = *mesh_info.attributes[attribute_index];
-            threading::parallel_for(
-                IndexRange(element_slice.size()), 1024, [&](const IndexRange sub_range) {
-                  cpp_type.copy_assign_n(src_span.slice(sub_range).data(),
-                                         dst_span.slice(sub_range).data(),
-                                         sub_range.size());
-                });
+            copy_generic_attribute_values(src_span, dst_span);
           }
           else {
             if (attribute_fallback == nullptr) {
               attribute_fallback = cpp_type.default_value();
             }
-            threading::parallel_for(
-                IndexRange(element_slice.size()), 1024, [&](const IndexRange sub_range) {
-                  cpp_type.fill_assign_n(
-                      attribute_fallback, dst_span.slice(sub_range).data(), sub_range.size());
-                });
+            fill_generic_attribute_value(attribute_fallback, dst_span);
           }
         }
       });
@@ -1083,6 +1111,33 @@ static AllCurvesInfo preprocess_curves(const GeometrySet &geometry_set,
         curve_info.spline_attributes[attribute_index].emplace(std::move(attribute));
       }
     }
+
+    /* Look up point attributes on every spline once, so that tasks don't have to repeat the name
+     * lookups for every instance of this curve. */
+    const Span<SplinePtr> splines = curve->splines();
+    curve_info.point_attributes.reinitialize(info.attributes.size());
+    for (const int attribute_index : info.attributes.index_range()) {
+      const AttributeDomain domain = info.attributes.kinds[attribute_index].domain;
+      if (domain != ATTR_DOMAIN_POINT) {
+        continue;
+      }
+      const AttributeIDRef &attribute_id = info.attributes.ids[attribute_index];
+      Array<std::optional<GSpan>> &attribute_spans = curve_info.point_attributes[attribute_index];
+      attribute_spans.reinitialize(splines.size());
+      for (const int spline_index : splines.index_range()) {
+        attribute_spans[spline_index] = splines[spline_index]->attributes.get_for_read(
+            attribute_id);
+      }
+    }
+    if (info.create_id_attribute) {
+      curve_info.stored_point_ids.reinitialize(splines.size());
+      for (const int spline_index : splines.index_range()) {
+        std::optional<GSpan> point_ids = splines[spline_index]->attributes.get_for_read("id");
+        if (point_ids.has_value()) {
+          curve_info.stored_point_ids[spline_index] = point_ids->typed<int>();
+        }
+      }
+    }
   }
   return info;
 }
@@ -1108,17 +1163,15 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
       dst_spline->transform(task.transform);
       const int spline_size = dst_spline->size();
 
-      const CustomDataAttributes &src_point_attributes = src_spline.attributes;
       CustomDataAttributes &dst_point_attributes = dst_spline->attributes;
 
       /* Create point ids. */
       if (all_curves_info.create_id_attribute) {
         dst_point_attributes.create("id", CD_PROP_INT32);
         MutableSpan<int> dst_point_ids = dst_point_attributes.get_for_write("id")->typed<int>();
-        std::optional<GSpan> src_point_ids_opt = src_point_attributes.get_for_read("id");
+        const Span<int> src_point_ids = curve_info.stored_point_ids[src_spline_index];
         if (options.keep_original_ids) {
-          if (src_point_ids_opt.has_value()) {
-            const Span<int> src_point_ids = src_point_ids_opt->typed<int>();
+          if (!src_point_ids.is_empty()) {
             dst_point_ids.copy_from(src_point_ids);
           }
           else {
@@ -1126,8 +1179,7 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
           }
         }
         else {
-          if (src_point_ids_opt.has_value()) {
-            const Span<int> src_point_ids = src_point_ids_opt->typed<int>();
+          if (!src_point_ids.is_empty()) {
             for (const int i : IndexRange(dst_spline->size())) {
               dst_point_ids[i] = noise::hash(task.id, src_point_ids[i]);
             }
@@ -1152,7 +1204,8 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
         const CPPType &cpp_type = *custom_data_type_to_cpp_type(data_type);
         const AttributeIDRef &attribute_id = ordered_attributes.ids[attribute_index];
         const void *attribute_fallback = task.attribute_fallbacks.array[attribute_index];
-        const std::optional<GSpan> src_span_opt = src_point_attributes.get_for_read(attribute_id);
+        const std::optional<GSpan> &src_span_opt =
+            curve_info.point_attributes[attribute_index][src_spline_index];
         void *dst_buffer = MEM_malloc_arrayN(spline_size, cpp_type.size(), "Curve Attribute");
         if (src_span_opt.has_value()) {
           const GSpan src_span = *src_span_opt;
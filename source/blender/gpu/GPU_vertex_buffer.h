@@ -164,6 +164,13 @@ void GPU_vertbuf_tag_dirty(GPUVertBuf *verts);
  * Should be rename to #GPU_vertbuf_data_upload.
  */
 void GPU_vertbuf_use(GPUVertBuf *);
+/**
+ * Upload only the given vertex range from the host data to the GPU, and consider the whole
+ * buffer to be in sync afterwards. The caller must guarantee that all data modified since the
+ * last upload lies inside the flushed range(s). Falls back to a full upload when the buffer has
+ * not been uploaded yet. Only valid for usages that keep the host data (not #GPU_USAGE_STATIC).
+ */
+void GPU_vertbuf_flush_range(GPUVertBuf *verts, uint v_first, uint v_len);
 void GPU_vertbuf_bind_as_ssbo(struct GPUVertBuf *verts, int binding);
 
 void GPU_vertbuf_wrap_handle(GPUVertBuf *verts, uint64_t handle);
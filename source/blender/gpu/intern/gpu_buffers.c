@@ -50,6 +50,11 @@ struct GPU_PBVH_Buffers {
   GPUIndexBuf *index_lines_buf, *index_lines_buf_fast;
   GPUVertBuf *vert_buf;
 
+  /* Host copy of the `vert_buf` data from before the last re-pack, used to compute the vertex
+   * sub-range that actually changed, so only that range is uploaded on flush.
+   * NULL when the whole buffer has to be uploaded. */
+  void *vert_data_prev;
+
   GPUBatch *lines;
   GPUBatch *lines_fast;
   GPUBatch *triangles;
@@ -124,29 +129,23 @@ void gpu_pbvh_exit()
  * Return is false it indicates that the memory map failed. */
 static bool gpu_pbvh_vert_buf_data_set(GPU_PBVH_Buffers *buffers, uint vert_len)
 {
-  /* Keep so we can test #GPU_USAGE_DYNAMIC buffer use.
-   * Not that format initialization match in both blocks.
-   * Do this to keep braces balanced - otherwise indentation breaks. */
-#if 0
   if (buffers->vert_buf == NULL) {
-    /* Initialize vertex buffer (match 'VertexBufferFormat'). */
+    /* Initialize vertex buffer (match 'VertexBufferFormat').
+     * Dynamic usage keeps the buffer resident on the GPU and the host copy of the data alive,
+     * which makes partial re-uploads possible (see #GPU_pbvh_buffers_update_flush). */
     buffers->vert_buf = GPU_vertbuf_create_with_format_ex(&g_vbo_id.format, GPU_USAGE_DYNAMIC);
-    GPU_vertbuf_data_alloc(buffers->vert_buf, vert_len);
-  }
-  else if (vert_len != buffers->vert_buf->vertex_len) {
-    GPU_vertbuf_data_resize(buffers->vert_buf, vert_len);
-  }
-#else
-  if (buffers->vert_buf == NULL) {
-    /* Initialize vertex buffer (match 'VertexBufferFormat'). */
-    buffers->vert_buf = GPU_vertbuf_create_with_format_ex(&g_vbo_id.format, GPU_USAGE_STATIC);
   }
   if (GPU_vertbuf_get_data(buffers->vert_buf) == NULL ||
       GPU_vertbuf_get_vertex_len(buffers->vert_buf) != vert_len) {
     /* Allocate buffer if not allocated yet or size changed. */
     GPU_vertbuf_data_alloc(buffers->vert_buf, vert_len);
   }
-#endif
+  else if ((GPU_vertbuf_get_status(buffers->vert_buf) & GPU_VERTBUF_DATA_UPLOADED) &&
+           (buffers->vert_data_prev == NULL)) {
+    /* The buffer keeps its size and is already resident on the GPU: remember its current
+     * contents, so the flush can upload only the sub-range the re-pack below changes. */
+    buffers->vert_data_prev = MEM_dupallocN(GPU_vertbuf_get_data(buffers->vert_buf));
+  }
 
   return GPU_vertbuf_get_data(buffers->vert_buf) != NULL;
 }
@@ -1072,6 +1071,7 @@ static void gpu_pbvh_buffers_clear(GPU_PBVH_Buffers *buffers)
   GPU_INDEXBUF_DISCARD_SAFE(buffers->index_buf_fast);
   GPU_INDEXBUF_DISCARD_SAFE(buffers->index_buf);
   GPU_VERTBUF_DISCARD_SAFE(buffers->vert_buf);
+  MEM_SAFE_FREE(buffers->vert_data_prev);
 }
 
 void GPU_pbvh_buffers_update_flush(GPU_PBVH_Buffers *buffers)
@@ -1082,8 +1082,37 @@ void GPU_pbvh_buffers_update_flush(GPU_PBVH_Buffers *buffers)
     buffers->clear_bmesh_on_flush = false;
   }
 
-  /* Force flushing to the GPU. */
-  if (buffers->vert_buf && GPU_vertbuf_get_data(buffers->vert_buf)) {
+  if (!(buffers->vert_buf && GPU_vertbuf_get_data(buffers->vert_buf))) {
+    return;
+  }
+
+  if (buffers->vert_data_prev) {
+    /* Upload only the range of vertices whose packed data changed since the last flush,
+     * typically the small part of the node the brush displaced. */
+    const uint stride = GPU_vertbuf_get_format(buffers->vert_buf)->stride;
+    const uint vert_len = GPU_vertbuf_get_vertex_len(buffers->vert_buf);
+    const uchar *data = GPU_vertbuf_get_data(buffers->vert_buf);
+    const uchar *data_prev = buffers->vert_data_prev;
+
+    uint v_first = 0;
+    while (v_first < vert_len &&
+           memcmp(data + (size_t)v_first * stride, data_prev + (size_t)v_first * stride, stride) ==
+               0) {
+      v_first++;
+    }
+    uint v_end = vert_len;
+    while (v_end > v_first && memcmp(data + (size_t)(v_end - 1) * stride,
+                                     data_prev + (size_t)(v_end - 1) * stride,
+                                     stride) == 0) {
+      v_end--;
+    }
+    GPU_vertbuf_flush_range(buffers->vert_buf, v_first, v_end - v_first);
+
+    MEM_freeN(buffers->vert_data_prev);
+    buffers->vert_data_prev = NULL;
+  }
+  else {
+    /* Force flushing to the GPU. */
     GPU_vertbuf_use(buffers->vert_buf);
   }
 }
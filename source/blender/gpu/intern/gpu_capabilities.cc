@@ -41,6 +41,11 @@ int GPU_texture_size_with_limit(int res, bool limit_gl_texture_size)
   return min_ii(reslimit, res);
 }
 
+int GPU_max_texture_3d_size()
+{
+  return GCaps.max_texture_3d_size;
+}
+
 int GPU_max_texture_layers()
 {
   return GCaps.max_texture_layers;
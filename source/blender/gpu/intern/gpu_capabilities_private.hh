@@ -20,6 +20,7 @@ namespace blender::gpu {
  */
 struct GPUCapabilities {
   int max_texture_size = 0;
+  int max_texture_3d_size = 0;
   int max_texture_layers = 0;
   int max_textures = 0;
   int max_textures_vert = 0;
@@ -84,6 +84,21 @@ static GPUPass *gpu_pass_cache_lookup(uint32_t hash)
   return NULL;
 }
 
+/* Search by node graph content hash. Unlike GPUPass.hash there is no generated
+ * string to fall back to on collision, which is why this hash is 64 bit. */
+static GPUPass *gpu_pass_cache_lookup_graph(uint64_t graph_hash)
+{
+  BLI_spin_lock(&pass_cache_spin);
+  for (GPUPass *pass = pass_cache; pass; pass = pass->next) {
+    if (pass->graph_hash == graph_hash) {
+      BLI_spin_unlock(&pass_cache_spin);
+      return pass;
+    }
+  }
+  BLI_spin_unlock(&pass_cache_spin);
+  return NULL;
+}
+
 /* Check all possible passes with the same hash. */
 static GPUPass *gpu_pass_cache_resolve_collision(GPUPass *pass,
                                                  const char *vert,
@@ -278,6 +293,136 @@ static void codegen_set_unique_ids(GPUNodeGraph *graph)
   }
 }
 
+/* -------------------- Node Graph Content Hash ------------------ */
+/**
+ * Hashes everything the generated GLSL depends on, directly from the node
+ * graph, so that regenerating an unchanged material (preview spheres, lookdev,
+ * other slots of the same tree) can reuse a cached #GPUPass without paying for
+ * code generation at all. Uniform values are deliberately left out: they live
+ * in the material UBO, not in the code, so materials differing only in values
+ * share the fast path. Requires #codegen_set_unique_ids to have run, since
+ * output ids encode the graph topology.
+ */
+
+typedef struct GPUGraphHash {
+  /* Two differently seeded states, the 32 bit murmur hash alone makes
+   * accidental collisions between distinct shaders too likely. */
+  BLI_HashMurmur2A lo, hi;
+} GPUGraphHash;
+
+static void graph_hash_data(GPUGraphHash *h, const void *data, size_t len)
+{
+  BLI_hash_mm2a_add(&h->lo, data, len);
+  BLI_hash_mm2a_add(&h->hi, data, len);
+}
+
+static void graph_hash_int(GPUGraphHash *h, int value)
+{
+  BLI_hash_mm2a_add_int(&h->lo, value);
+  BLI_hash_mm2a_add_int(&h->hi, value);
+}
+
+static void graph_hash_string(GPUGraphHash *h, const char *str)
+{
+  if (str) {
+    BLI_hash_mm2a_add(&h->lo, (const uchar *)str, strlen(str));
+    BLI_hash_mm2a_add(&h->hi, (const uchar *)str, strlen(str));
+  }
+  /* Separate "ab" + "c" from "a" + "bc", and NULL from "". */
+  graph_hash_int(h, -1);
+}
+
+static uint64_t gpu_pass_hash_graph(GPUNodeGraph *graph,
+                                    const char *vert_code,
+                                    const char *geom_code,
+                                    const char *frag_lib,
+                                    const char *defines)
+{
+  GPUGraphHash h;
+  BLI_hash_mm2a_init(&h.lo, 0);
+  BLI_hash_mm2a_init(&h.hi, 0xdeadbeef);
+
+  /* Engine provided code differs per variant (shadow, depth, ...). */
+  graph_hash_string(&h, vert_code);
+  graph_hash_string(&h, geom_code);
+  graph_hash_string(&h, frag_lib);
+  graph_hash_string(&h, defines);
+
+  LISTBASE_FOREACH (GPUNode *, node, &graph->nodes) {
+    graph_hash_string(&h, node->name);
+
+    LISTBASE_FOREACH (GPUInput *, input, &node->inputs) {
+      graph_hash_int(&h, input->type);
+      graph_hash_int(&h, input->source);
+
+      switch (input->source) {
+        case GPU_SOURCE_OUTPUT:
+          graph_hash_int(&h, input->link->output->id);
+          break;
+        case GPU_SOURCE_CONSTANT:
+          /* Constants are printed into the code itself. */
+          graph_hash_data(&h, input->vec, sizeof(float) * input->type);
+          break;
+        case GPU_SOURCE_BUILTIN:
+          graph_hash_int(&h, input->builtin);
+          break;
+        case GPU_SOURCE_TEX:
+        case GPU_SOURCE_TEX_TILED_MAPPING:
+          graph_hash_string(&h, input->texture->sampler_name);
+          graph_hash_string(&h, input->texture->tiled_mapping_name);
+          graph_hash_int(&h, input->texture->colorband != NULL);
+          break;
+        case GPU_SOURCE_VOLUME_GRID:
+        case GPU_SOURCE_VOLUME_GRID_TRANSFORM:
+          graph_hash_string(&h, input->volume_grid->sampler_name);
+          graph_hash_string(&h, input->volume_grid->transform_name);
+          break;
+        case GPU_SOURCE_ATTR:
+          graph_hash_int(&h, input->attr->gputype);
+          graph_hash_int(&h, input->attr->id);
+          break;
+        case GPU_SOURCE_UNIFORM_ATTR:
+          graph_hash_int(&h, input->uniform_attr->id);
+          break;
+        case GPU_SOURCE_UNIFORM:
+          /* Values live in the material UBO, not in the code, but linked
+           * uniforms are excluded from the UBO block. */
+          graph_hash_int(&h, input->link != NULL);
+          break;
+        case GPU_SOURCE_STRUCT:
+          /* Only the id matters, which the output id walk covers. */
+          break;
+      }
+    }
+
+    LISTBASE_FOREACH (GPUOutput *, output, &node->outputs) {
+      graph_hash_int(&h, output->type);
+      graph_hash_int(&h, output->id);
+    }
+  }
+
+  LISTBASE_FOREACH (GPUMaterialAttribute *, attr, &graph->attributes) {
+    graph_hash_int(&h, attr->type);
+    graph_hash_int(&h, attr->gputype);
+    graph_hash_int(&h, attr->id);
+    graph_hash_string(&h, attr->name);
+  }
+
+  LISTBASE_FOREACH (GPUUniformAttr *, attr, &graph->uniform_attrs.list) {
+    graph_hash_int(&h, attr->id);
+    graph_hash_int(&h, attr->use_dupli);
+    graph_hash_string(&h, attr->name);
+  }
+
+  graph_hash_int(&h, graph->outlink->output->id);
+  LISTBASE_FOREACH (GPUNodeGraphOutputLink *, aovlink, &graph->outlink_aovs) {
+    graph_hash_int(&h, aovlink->hash);
+    graph_hash_int(&h, aovlink->outlink->output->id);
+  }
+
+  return ((uint64_t)BLI_hash_mm2a_end(&h.hi) << 32) | BLI_hash_mm2a_end(&h.lo);
+}
+
 /**
  * It will create an UBO for GPUMaterial if there is any GPU_DYNAMIC_UBO.
  */
@@ -379,6 +524,30 @@ static int codegen_process_uniforms_functions(GPUMaterial *material,
   return builtins;
 }
 
+/**
+ * Create the material UBO without generating any code, for when a cached pass
+ * is reused: the shared shader expects every material to provide its own UBO
+ * with its own uniform values. Has to collect the same inputs in the same
+ * order as #codegen_process_uniforms_functions.
+ */
+static void codegen_material_ubo_create(GPUMaterial *material, GPUNodeGraph *graph)
+{
+  ListBase ubo_inputs = {NULL, NULL};
+
+  LISTBASE_FOREACH (GPUNode *, node, &graph->nodes) {
+    LISTBASE_FOREACH (GPUInput *, input, &node->inputs) {
+      if (input->source == GPU_SOURCE_UNIFORM && !input->link) {
+        BLI_addtail(&ubo_inputs, BLI_genericNodeN(input));
+      }
+    }
+  }
+
+  if ((material != NULL) && !BLI_listbase_is_empty(&ubo_inputs)) {
+    GPU_material_uniform_buffer_create(material, &ubo_inputs);
+  }
+  BLI_freelistN(&ubo_inputs);
+}
+
 static void codegen_declare_tmps(DynStr *ds, GPUNodeGraph *graph)
 {
   LISTBASE_FOREACH (GPUNode *, node, &graph->nodes) {
@@ -508,8 +677,6 @@ static char *code_generate_fragment(GPUMaterial *material,
   char *code;
   int builtins;
 
-  codegen_set_unique_ids(graph);
-
   /* Attributes, Shader stage interface. */
   if (interface_str) {
     BLI_dynstr_appendf(ds, "in codegenInterface {%s};\n\n", interface_str);
@@ -845,6 +1012,23 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
    * generated VBOs are ready to accept the future shader. */
   gpu_node_graph_prune_unused(graph);
   gpu_node_graph_finalize_uniform_attrs(graph);
+  codegen_set_unique_ids(graph);
+
+  /* First level cache lookup: an identical node graph was already turned into a
+   * pass this session (other material slot, preview sphere, lookdev sphere,
+   * undo/redo), reuse it without generating any GLSL. */
+  uint64_t graph_hash = gpu_pass_hash_graph(graph, vert_code, geom_code, frag_lib, defines);
+  GPUPass *pass_graph = gpu_pass_cache_lookup_graph(graph_hash);
+
+  if (pass_graph) {
+    if (!gpu_pass_is_valid(pass_graph)) {
+      /* Shader has already been created but failed to compile. */
+      return NULL;
+    }
+    codegen_material_ubo_create(material, graph);
+    pass_graph->refcount += 1;
+    return pass_graph;
+  }
 
   int builtins = 0;
   LISTBASE_FOREACH (GPUNode *, node, &graph->nodes) {
@@ -870,6 +1054,9 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
       /* Shader has already been created but failed to compile. */
       return NULL;
     }
+    if (pass_hash->graph_hash == 0) {
+      pass_hash->graph_hash = graph_hash;
+    }
     pass_hash->refcount += 1;
     return pass_hash;
   }
@@ -905,6 +1092,9 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
       return NULL;
     }
 
+    if (pass->graph_hash == 0) {
+      pass->graph_hash = graph_hash;
+    }
     pass->refcount += 1;
   }
   else {
@@ -914,11 +1104,13 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
     pass->shader = NULL;
     pass->refcount = 1;
     pass->hash = hash;
+    pass->graph_hash = graph_hash;
     pass->vertexcode = vertexcode;
     pass->fragmentcode = fragmentcode;
     pass->geometrycode = geometrycode;
     pass->defines = (defines) ? BLI_strdup(defines) : NULL;
     pass->compiled = false;
+    BLI_mutex_init(&pass->compilation_lock);
 
     BLI_spin_lock(&pass_cache_spin);
     if (pass_hash != NULL) {
@@ -1023,6 +1215,9 @@ static bool gpu_pass_shader_validate(GPUPass *pass, GPUShader *shader)
 bool GPU_pass_compile(GPUPass *pass, const char *shname)
 {
   bool success = true;
+  /* Two deferred compilation workers can reach the same pass when their materials share the
+   * shader code, make sure only one of them creates the GPUShader. */
+  BLI_mutex_lock(&pass->compilation_lock);
   if (!pass->compiled) {
     GPUShader *shader = GPU_shader_create(
         pass->vertexcode, pass->fragmentcode, pass->geometrycode, NULL, pass->defines, shname);
@@ -1040,6 +1235,7 @@ bool GPU_pass_compile(GPUPass *pass, const char *shname)
     pass->shader = shader;
     pass->compiled = true;
   }
+  BLI_mutex_unlock(&pass->compilation_lock);
 
   return success;
 }
@@ -1056,6 +1252,7 @@ static void gpu_pass_free(GPUPass *pass)
   if (pass->shader) {
     GPU_shader_free(pass->shader);
   }
+  BLI_mutex_end(&pass->compilation_lock);
   MEM_SAFE_FREE(pass->fragmentcode);
   MEM_SAFE_FREE(pass->geometrycode);
   MEM_SAFE_FREE(pass->vertexcode);
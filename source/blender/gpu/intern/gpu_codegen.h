@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "BLI_threads.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -25,8 +27,14 @@ typedef struct GPUPass {
   char *geometrycode;
   char *vertexcode;
   char *defines;
+  /* Materials sharing the same code share the pass, so concurrent deferred compilation
+   * threads can reach the same pass (see GPU_pass_compile). */
+  ThreadMutex compilation_lock;
   uint refcount; /* Orphaned GPUPasses gets freed by the garbage collector. */
   uint32_t hash; /* Identity hash generated from all GLSL code. */
+  /* Identity hash generated from the node graph content, before any GLSL exists.
+   * Used to skip code generation entirely on reuse (0 = not known yet). */
+  uint64_t graph_hash;
   bool compiled; /* Did we already tried to compile the attached GPUShader. */
 } GPUPass;
 
@@ -318,6 +318,27 @@ void GPU_vertbuf_use(GPUVertBuf *verts)
   unwrap(verts)->upload();
 }
 
+void GPU_vertbuf_flush_range(GPUVertBuf *verts_, uint v_first, uint v_len)
+{
+  VertBuf *verts = unwrap(verts_);
+  BLI_assert(verts->data != nullptr); /* The usage must keep a host copy of the data. */
+  BLI_assert(v_first + v_len <= verts->vertex_len);
+
+  if (!(verts->flag & GPU_VERTBUF_DATA_UPLOADED)) {
+    /* Nothing on the GPU to partially update, a full upload is needed anyway. */
+    verts->upload();
+    return;
+  }
+  /* All modifications are inside the flushed range, the host data as a whole can be considered
+   * in sync with the GPU copy. Clear the dirty flag first so #upload only binds the buffer. */
+  verts->flag &= ~GPU_VERTBUF_DATA_DIRTY;
+  verts->upload();
+  if (v_len > 0) {
+    const uint stride = verts->format.stride;
+    verts->update_sub(v_first * stride, v_len * stride, verts->data + v_first * stride);
+  }
+}
+
 void GPU_vertbuf_wrap_handle(GPUVertBuf *verts, uint64_t handle)
 {
   unwrap(verts)->wrap_handle(handle);
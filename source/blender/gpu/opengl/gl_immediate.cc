@@ -9,6 +9,8 @@
 
 #include "BKE_global.h"
 
+#include "BLI_math_base.h"
+
 #include "gpu_context_private.hh"
 #include "gpu_shader_private.hh"
 #include "gpu_vertex_format_private.h"
@@ -31,15 +33,19 @@ GLImmediate::GLImmediate()
   glGenVertexArrays(1, &vao_id_);
   glBindVertexArray(vao_id_); /* Necessary for glObjectLabel. */
 
-  buffer.buffer_size = DEFAULT_INTERNAL_BUFFER_SIZE;
+  /* With persistent mapping, a section of the ring needs to hold a whole draw. Keep the
+   * section size equal to the size used for buffer orphaning. */
+  const size_t buf_size = GLContext::buffer_storage_support ?
+                              RING_BUFFER_SECTIONS * DEFAULT_INTERNAL_BUFFER_SIZE :
+                              DEFAULT_INTERNAL_BUFFER_SIZE;
+
   glGenBuffers(1, &buffer.vbo_id);
   glBindBuffer(GL_ARRAY_BUFFER, buffer.vbo_id);
-  glBufferData(GL_ARRAY_BUFFER, buffer.buffer_size, nullptr, GL_DYNAMIC_DRAW);
+  buffer_storage_alloc(buffer, buf_size);
 
-  buffer_strict.buffer_size = DEFAULT_INTERNAL_BUFFER_SIZE;
   glGenBuffers(1, &buffer_strict.vbo_id);
   glBindBuffer(GL_ARRAY_BUFFER, buffer_strict.vbo_id);
-  glBufferData(GL_ARRAY_BUFFER, buffer_strict.buffer_size, nullptr, GL_DYNAMIC_DRAW);
+  buffer_storage_alloc(buffer_strict, buf_size);
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
@@ -53,8 +59,8 @@ GLImmediate::~GLImmediate()
 {
   glDeleteVertexArrays(1, &vao_id_);
 
-  glDeleteBuffers(1, &buffer.vbo_id);
-  glDeleteBuffers(1, &buffer_strict.vbo_id);
+  buffer_storage_discard(buffer);
+  buffer_storage_discard(buffer_strict);
 }
 
 /** \} */
@@ -63,15 +69,108 @@ GLImmediate::~GLImmediate()
 /** \name Buffer management
  * \{ */
 
+void GLImmediate::buffer_storage_alloc(RingBuffer &buf, size_t size)
+{
+  /* The buffer is expected to be bound to #GL_ARRAY_BUFFER. */
+  buf.buffer_size = size;
+  if (GLContext::buffer_storage_support) {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+    buf.persistent_map = (uchar *)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+    BLI_assert(buf.persistent_map != nullptr);
+  }
+  else {
+    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+  }
+}
+
+void GLImmediate::buffer_storage_discard(RingBuffer &buf)
+{
+  for (GLsync &fence : buf.section_fences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  if (buf.persistent_map != nullptr) {
+    glBindBuffer(GL_ARRAY_BUFFER, buf.vbo_id);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    buf.persistent_map = nullptr;
+  }
+  glDeleteBuffers(1, &buf.vbo_id);
+  buf.vbo_id = 0;
+}
+
+uchar *GLImmediate::begin_persistent(const size_t bytes_needed)
+{
+  RingBuffer &buf = active_buffer();
+  size_t section_size = buf.buffer_size / RING_BUFFER_SECTIONS;
+
+  glBindBuffer(GL_ARRAY_BUFFER, buf.vbo_id);
+
+  /* Account for stride alignment so a maximal draw cannot spill over the section end. */
+  const bool grow = bytes_needed + vertex_format.stride > section_size;
+  const bool shrink = bytes_needed < DEFAULT_INTERNAL_BUFFER_SIZE &&
+                      section_size > DEFAULT_INTERNAL_BUFFER_SIZE;
+  if (grow || shrink) {
+    /* Buffer storage is immutable. Recreate the buffer object at the new size. Pending fences
+     * can simply be dropped since deletion of an in-flight buffer is deferred by the driver. */
+    buffer_storage_discard(buf);
+    glGenBuffers(1, &buf.vbo_id);
+    glBindBuffer(GL_ARRAY_BUFFER, buf.vbo_id);
+    section_size = max_zz(bytes_needed + vertex_format.stride, DEFAULT_INTERNAL_BUFFER_SIZE);
+    buffer_storage_alloc(buf, RING_BUFFER_SECTIONS * section_size);
+    buf.buffer_offset = 0;
+    buf.current_section = 0;
+  }
+
+  /* Ensure vertex data is aligned. Might waste a little space, but it's safe. */
+  buf.buffer_offset += padding(buf.buffer_offset, vertex_format.stride);
+
+  if (buf.buffer_offset + bytes_needed > (buf.current_section + 1) * section_size) {
+    /* Fence the section we just finished writing so the next lap knows when the GPU is done
+     * reading it. */
+    GLsync &prev_fence = buf.section_fences[buf.current_section];
+    if (prev_fence != nullptr) {
+      glDeleteSync(prev_fence);
+    }
+    prev_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    buf.current_section = (buf.current_section + 1) % RING_BUFFER_SECTIONS;
+    buf.buffer_offset = buf.current_section * section_size;
+    /* The section start is not necessarily stride aligned. */
+    buf.buffer_offset += padding(buf.buffer_offset, vertex_format.stride);
+
+    /* Wait until the GPU consumed this section's data from the previous lap. With three
+     * sections this only stalls when the driver queues more than two frames of draws. */
+    GLsync &fence = buf.section_fences[buf.current_section];
+    if (fence != nullptr) {
+      while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {
+        /* Keep waiting. */
+      }
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+
+  bytes_mapped_ = bytes_needed;
+  return buf.persistent_map + buf.buffer_offset;
+}
+
 uchar *GLImmediate::begin()
 {
   /* How many bytes do we need for this draw call? */
   const size_t bytes_needed = vertex_buffer_size(&vertex_format, vertex_len);
-  /* Does the current buffer have enough room? */
-  const size_t available_bytes = buffer_size() - buffer_offset();
 
   GL_CHECK_RESOURCES("Immediate");
 
+  if (GLContext::buffer_storage_support) {
+    return this->begin_persistent(bytes_needed);
+  }
+
+  /* Does the current buffer have enough room? */
+  const size_t available_bytes = buffer_size() - buffer_offset();
+
   glBindBuffer(GL_ARRAY_BUFFER, vbo_id());
 
   bool recreate_buffer = false;
@@ -124,16 +223,22 @@ void GLImmediate::end()
   BLI_assert(prim_type != GPU_PRIM_NONE); /* make sure we're between a Begin/End pair */
 
   uint buffer_bytes_used = bytes_mapped_;
-  if (!strict_vertex_len) {
-    if (vertex_idx != vertex_len) {
-      vertex_len = vertex_idx;
-      buffer_bytes_used = vertex_buffer_size(&vertex_format, vertex_len);
-      /* unused buffer bytes are available to the next immBegin */
+  if (!strict_vertex_len && (vertex_idx != vertex_len)) {
+    vertex_len = vertex_idx;
+    buffer_bytes_used = vertex_buffer_size(&vertex_format, vertex_len);
+    /* unused buffer bytes are available to the next immBegin */
+  }
+
+  if (GLContext::buffer_storage_support) {
+    /* Coherent persistent mapping: writes are visible to the GPU without flush or unmap. */
+  }
+  else {
+    if (!strict_vertex_len) {
+      /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
     }
-    /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
-    glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
   }
-  glUnmapBuffer(GL_ARRAY_BUFFER);
 
   if (vertex_len > 0) {
     GLContext::get()->state_manager->apply_state();
@@ -20,18 +20,28 @@ namespace blender::gpu {
 /* size of internal buffer */
 #define DEFAULT_INTERNAL_BUFFER_SIZE (4 * 1024 * 1024)
 
+/* Number of sections the persistently mapped buffer is divided into. The CPU writes one section
+ * while the GPU consumes the others, so this needs to cover the driver's frame queue depth. */
+#define RING_BUFFER_SECTIONS 3
+
 class GLImmediate : public Immediate {
  private:
   /* Use two buffers for strict and non-strict vertex count to
    * avoid some huge driver slowdown (see T70922).
    * Use accessor functions to get / modify. */
-  struct {
+  struct RingBuffer {
     /** Opengl Handle for this buffer. */
     GLuint vbo_id = 0;
     /** Offset of the mapped data in data. */
     size_t buffer_offset = 0;
     /** Size of the whole buffer in bytes. */
     size_t buffer_size = 0;
+    /** Persistent mapping of the whole buffer. Only used with ARB_buffer_storage support. */
+    uchar *persistent_map = nullptr;
+    /** Fences guarding each section against overwrite of in-flight vertex data. */
+    GLsync section_fences[RING_BUFFER_SECTIONS] = {};
+    /** Section currently being written to. */
+    int current_section = 0;
   } buffer, buffer_strict;
   /** Size in bytes of the mapped region. */
   size_t bytes_mapped_ = 0;
@@ -46,19 +56,32 @@ class GLImmediate : public Immediate {
   void end() override;
 
  private:
+  /** Persistent ring buffer path (ARB_buffer_storage). Per draw cost is a pointer bump. */
+  uchar *begin_persistent(size_t bytes_needed);
+
+  /** Allocate storage for the currently bound GL_ARRAY_BUFFER and map it if persistent. */
+  void buffer_storage_alloc(RingBuffer &buf, size_t size);
+  /** Unmap, delete pending fences and delete the buffer object. */
+  void buffer_storage_discard(RingBuffer &buf);
+
+  RingBuffer &active_buffer()
+  {
+    return strict_vertex_len ? buffer_strict : buffer;
+  }
+
   GLuint &vbo_id()
   {
-    return strict_vertex_len ? buffer_strict.vbo_id : buffer.vbo_id;
+    return active_buffer().vbo_id;
   };
 
   size_t &buffer_offset()
   {
-    return strict_vertex_len ? buffer_strict.buffer_offset : buffer.buffer_offset;
+    return active_buffer().buffer_offset;
   };
 
   size_t &buffer_size()
   {
-    return strict_vertex_len ? buffer_strict.buffer_size : buffer.buffer_size;
+    return active_buffer().buffer_size;
   };
 };
 
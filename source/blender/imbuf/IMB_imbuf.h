@@ -561,6 +561,18 @@ bool IMB_alpha_affects_rgb(const struct ImBuf *ibuf);
  */
 void IMB_rect_from_float(struct ImBuf *ibuf);
 void IMB_float_from_rect(struct ImBuf *ibuf);
+/**
+ * Convert the float buffer to half float storage, freeing the float buffer.
+ * Halves memory and bandwidth at the cost of precision, intended for
+ * display referred results (sequencer/compositor playback at high resolutions).
+ */
+void IMB_half_from_float(struct ImBuf *ibuf);
+/**
+ * Create the full float buffer back from half float storage, freeing the half buffer.
+ * Consumers which only need a display or byte buffer don't have to call this,
+ * color management handles half buffers directly.
+ */
+void IMB_float_from_half(struct ImBuf *ibuf);
 /**
  * No profile conversion.
  */
@@ -654,6 +666,16 @@ void IMB_buffer_byte_from_byte(unsigned char *rect_to,
                                int height,
                                int stride_to,
                                int stride_from);
+/**
+ * Half float to float values, no color space or alpha conversion
+ * (half buffers share the conventions of their float counterpart).
+ */
+void IMB_buffer_float_from_half(float *rect_to, const unsigned short *rect_from, size_t values_num);
+/**
+ * Float to half float values, NaN/inf and out of range values clamp,
+ * denormals flush to zero.
+ */
+void IMB_buffer_half_from_float(unsigned short *rect_to, const float *rect_from, size_t values_num);
 void IMB_buffer_float_unpremultiply(float *buf, int width, int height);
 void IMB_buffer_float_premultiply(float *buf, int width, int height);
 
@@ -857,6 +879,10 @@ bool imb_addrectfloatImBuf(struct ImBuf *ibuf);
  * Any free `ibuf->rect` frees mipmaps to be sure, creation is in render on first request.
  */
 void imb_freerectfloatImBuf(struct ImBuf *ibuf);
+
+bool imb_addrecthalffloatImBuf(struct ImBuf *ibuf);
+void imb_freerecthalffloatImBuf(struct ImBuf *ibuf);
+
 void imb_freemipmapImBuf(struct ImBuf *ibuf);
 
 bool imb_addtilesImBuf(struct ImBuf *ibuf);
@@ -880,6 +906,19 @@ void IMB_processor_apply_threaded_scanlines(int total_scanlines,
                                             ScanlineThreadFunc do_thread,
                                             void *custom_data);
 
+/**
+ * \brief Apply a processor on rectangular tiles of a buffer in parallel.
+ *
+ * Unlike #IMB_processor_apply_threaded_scanlines the work is decomposed in two dimensions,
+ * which balances better when the per-pixel cost varies across the image and keeps the
+ * source reads of a task inside a compact region.
+ */
+typedef void (*TileThreadFunc)(void *custom_data, const struct rcti *tile);
+void IMB_processor_apply_threaded_tiles(int width,
+                                        int height,
+                                        TileThreadFunc do_tile,
+                                        void *custom_data);
+
 /**
  * \brief Transform modes to use for IMB_transform function.
  *
@@ -155,6 +155,7 @@ typedef enum eImBufFlags {
   IB_thumbnail = 1 << 16,
   IB_multiview = 1 << 17,
   IB_halffloat = 1 << 18,
+  IB_recthalffloat = 1 << 19,
 } eImBufFlags;
 
 /** \} */
@@ -198,6 +199,12 @@ typedef struct ImBuf {
    * \note Formats that support higher more than 8 but channels load as floats.
    */
   float *rect_float;
+  /** Image pixel buffer (half float representation):
+   * - same channel count, color space and alpha conventions as `rect_float`.
+   * - used as a memory/bandwidth saving storage for display referred work,
+   *   `rect_float` takes priority when both exist (see `IMB_float_from_half`).
+   */
+  unsigned short *rect_half;
 
   /** Resolution in pixels per meter. Multiply by `0.0254` for DPI. */
   double ppm[2];
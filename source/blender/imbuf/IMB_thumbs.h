@@ -7,11 +7,14 @@
 
 #pragma once
 
+#include "BLI_sys_types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct ImBuf;
+struct ThumbIndex;
 
 /**
  * Thumbnail creation and retrieval according to the 'Thumbnail Management Standard'
@@ -82,6 +85,15 @@ struct ImBuf *IMB_thumb_load_blend(const char *blen_path,
                                    const char *blen_group,
                                    const char *blen_id);
 
+/**
+ * Load an image at the resolution of a thumbnail, letting file formats that support it decode
+ * at a reduced resolution (the returned buffer may still be bigger than \a max_thumb_size, the
+ * caller scales as needed). \a r_source_size optionally returns the full-size image dimensions.
+ */
+struct ImBuf *IMB_thumb_load_image(const char *file_path,
+                                   size_t max_thumb_size,
+                                   size_t r_source_size[2]);
+
 /**
  * Special function for previewing fonts.
  */
@@ -90,6 +102,36 @@ bool IMB_thumb_load_font_get_hash(char *r_hash);
 void IMB_thumb_clear_translations(void);
 void IMB_thumb_ensure_translations(void);
 
+/* Per-directory packed thumbnail index. */
+
+/**
+ * Open the packed thumbnail index for files in \a dir_path. The returned handle is usable even
+ * when no index file exists yet (all lookups miss, adds are gathered for the next write).
+ * Concurrent lookups and adds from multiple threads are supported, closing must not overlap
+ * with either.
+ */
+struct ThumbIndex *IMB_thumb_index_open(const char *dir_path);
+/**
+ * Look up the thumbnail of \a file_path, validating the indexed entry against the file's
+ * current modification time.
+ *
+ * \return true when the file is indexed, with \a r_imbuf set to the thumbnail
+ * (or NULL when the index recorded a failed thumbnail). On false, fall back to
+ * #IMB_thumb_manage and register the result with #IMB_thumb_index_add.
+ */
+bool IMB_thumb_index_lookup(struct ThumbIndex *index,
+                            const char *file_path,
+                            struct ImBuf **r_imbuf);
+/**
+ * Register the result of a regular thumbnail load for \a file_path, \a valid being false when
+ * thumbnail creation failed. The entry is written back when the index is closed.
+ */
+void IMB_thumb_index_add(struct ThumbIndex *index, const char *file_path, bool valid);
+/**
+ * Write gathered entries back to the packed index file and free \a index.
+ */
+void IMB_thumb_index_close(struct ThumbIndex *index);
+
 /* Threading */
 
 void IMB_thumb_locks_acquire(void);
@@ -113,7 +113,15 @@ struct anim {
   int pFrameComplete;
   AVFrame *pFrameRGB;
   AVFrame *pFrameDeinterlaced;
+  /* Destination for frames downloaded from a hardware decoder, NULL for software decode. */
+  AVFrame *pFrameSw;
+  /* Hardware decode device, NULL when decoding in software. */
+  struct AVBufferRef *hw_device_ctx;
+  /* #AVPixelFormat of hardware surfaces, AV_PIX_FMT_NONE when decoding in software. */
+  int hw_pix_fmt;
   struct SwsContext *img_convert_ctx;
+  /* #AVPixelFormat the image converter was created for. */
+  int img_convert_pix_fmt;
   int videoStream;
 
   struct ImBuf *cur_frame_final;
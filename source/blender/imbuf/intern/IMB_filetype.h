@@ -36,6 +36,18 @@ typedef struct ImFileType {
                         char colorspace[IM_MAX_SPACE]);
   /** Load an image from a file. */
   struct ImBuf *(*load_filepath)(const char *filepath, int flags, char colorspace[IM_MAX_SPACE]);
+  /**
+   * Load/Create a thumbnail image from a filepath. `max_thumb_size` is maximum size of either
+   * dimension, however, the returned buffer may be bigger then this, if it's simpler to return a
+   * larger image and down-scale afterwards (the caller will scale as needed).
+   * `r_width` `r_height` optionally return the full-size dimensions of the image.
+   */
+  struct ImBuf *(*load_filepath_thumbnail)(const char *filepath,
+                                           int flags,
+                                           size_t max_thumb_size,
+                                           char colorspace[IM_MAX_SPACE],
+                                           size_t *r_width,
+                                           size_t *r_height);
   /** Save to a file (or memory if #IB_mem is set in `flags` and the format supports it). */
   bool (*save)(struct ImBuf *ibuf, const char *filepath, int flags);
   void (*load_tile)(struct ImBuf *ibuf,
@@ -62,6 +74,15 @@ const ImFileType *IMB_file_type_from_ibuf(const struct ImBuf *ibuf);
 void imb_filetypes_init(void);
 void imb_filetypes_exit(void);
 
+/**
+ * Set the colorspace & alpha-mode of `ibuf` after one of the `load` callbacks ran,
+ * shared by regular loading (see #IMB_loadifffile) and thumbnail-resolution loading.
+ */
+void imb_handle_alpha(struct ImBuf *ibuf,
+                      int flags,
+                      char colorspace[IM_MAX_SPACE],
+                      char effective_colorspace[IM_MAX_SPACE]);
+
 void imb_tile_cache_init(void);
 void imb_tile_cache_exit(void);
 
@@ -143,6 +164,12 @@ struct ImBuf *imb_load_jpeg(const unsigned char *buffer,
                             size_t size,
                             int flags,
                             char colorspace[IM_MAX_SPACE]);
+struct ImBuf *imb_thumbnail_jpeg(const char *filepath,
+                                 int flags,
+                                 size_t max_thumb_size,
+                                 char colorspace[IM_MAX_SPACE],
+                                 size_t *r_width,
+                                 size_t *r_height);
 
 /** \} */
 
@@ -94,6 +94,20 @@ void imb_freerectfloatImBuf(ImBuf *ibuf)
   ibuf->mall &= ~IB_rectfloat;
 }
 
+void imb_freerecthalffloatImBuf(ImBuf *ibuf)
+{
+  if (ibuf == NULL) {
+    return;
+  }
+
+  if (ibuf->rect_half && (ibuf->mall & IB_recthalffloat)) {
+    MEM_freeN(ibuf->rect_half);
+  }
+
+  ibuf->rect_half = NULL;
+  ibuf->mall &= ~IB_recthalffloat;
+}
+
 void imb_freerectImBuf(ImBuf *ibuf)
 {
   if (ibuf == NULL) {
@@ -183,6 +197,7 @@ void imb_freerectImbuf_all(ImBuf *ibuf)
 {
   imb_freerectImBuf(ibuf);
   imb_freerectfloatImBuf(ibuf);
+  imb_freerecthalffloatImBuf(ibuf);
   imb_freetilesImBuf(ibuf);
   IMB_freezbufImBuf(ibuf);
   IMB_freezbuffloatImBuf(ibuf);
@@ -384,6 +399,26 @@ bool imb_addrectfloatImBuf(ImBuf *ibuf)
   return false;
 }
 
+bool imb_addrecthalffloatImBuf(ImBuf *ibuf)
+{
+  if (ibuf == NULL) {
+    return false;
+  }
+
+  if (ibuf->rect_half) {
+    imb_freerecthalffloatImBuf(ibuf);
+  }
+
+  ibuf->channels = 4;
+  if ((ibuf->rect_half = imb_alloc_pixels(ibuf->x, ibuf->y, 4, sizeof(unsigned short), __func__))) {
+    ibuf->mall |= IB_recthalffloat;
+    ibuf->flags |= IB_recthalffloat;
+    return true;
+  }
+
+  return false;
+}
+
 bool imb_addrectImBuf(ImBuf *ibuf)
 {
   /* Question; why also add ZBUF (when `planes > 32`)? */
@@ -541,6 +576,12 @@ bool IMB_initImBuf(
     }
   }
 
+  if (flags & IB_recthalffloat) {
+    if (imb_addrecthalffloatImBuf(ibuf) == false) {
+      return false;
+    }
+  }
+
   if (flags & IB_zbuf) {
     if (addzbufImBuf(ibuf) == false) {
       return false;
@@ -575,6 +616,9 @@ ImBuf *IMB_dupImBuf(const ImBuf *ibuf1)
   if (ibuf1->rect_float) {
     flags |= IB_rectfloat;
   }
+  if (ibuf1->rect_half) {
+    flags |= IB_recthalffloat;
+  }
   if (ibuf1->zbuf) {
     flags |= IB_zbuf;
   }
@@ -599,6 +643,12 @@ ImBuf *IMB_dupImBuf(const ImBuf *ibuf1)
         ibuf2->rect_float, ibuf1->rect_float, ((size_t)ibuf1->channels) * x * y * sizeof(float));
   }
 
+  if (flags & IB_recthalffloat) {
+    memcpy(ibuf2->rect_half,
+           ibuf1->rect_half,
+           ((size_t)ibuf1->channels) * x * y * sizeof(unsigned short));
+  }
+
   if (flags & IB_zbuf) {
     memcpy(ibuf2->zbuf, ibuf1->zbuf, ((size_t)x) * y * sizeof(int));
   }
@@ -667,6 +717,10 @@ size_t IMB_get_size_in_memory(ImBuf *ibuf)
     channel_size += sizeof(float);
   }
 
+  if (ibuf->rect_half) {
+    channel_size += sizeof(unsigned short);
+  }
+
   size += channel_size * ibuf->x * ibuf->y * ibuf->channels;
 
   if (ibuf->miptot) {
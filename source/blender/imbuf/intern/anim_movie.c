@@ -63,6 +63,8 @@
 #ifdef WITH_FFMPEG
 #  include "BKE_global.h" /* ENDIAN_ORDER */
 
+#  include "DNA_userdef_types.h"
+
 #  include <libavcodec/avcodec.h>
 #  include <libavformat/avformat.h>
 #  include <libavutil/imgutils.h>
@@ -70,6 +72,12 @@
 #  include <libswscale/swscale.h>
 
 #  include "ffmpeg_compat.h"
+
+/* Hardware decoding needs the AVCodec hardware configuration API (FFmpeg 4.0). */
+#  if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(58, 18, 100)
+#    include <libavutil/hwcontext.h>
+#    define FFMPEG_HAVE_HWACCEL
+#  endif
 #endif /* WITH_FFMPEG */
 
 int ismovie(const char *UNUSED(filepath))
@@ -488,6 +496,117 @@ static ImBuf *avi_fetchibuf(struct anim *anim, int position)
 
 #ifdef WITH_FFMPEG
 
+/* Create a scaler converting `src_pix_fmt` frames to RGBA, with colorspace details matching
+ * the stream (detecting full range JFIF JPEG / MotionJPEG input). */
+static struct SwsContext *ffmpeg_sws_create(struct anim *anim, int src_pix_fmt)
+{
+  /* The following for color space determination */
+  int srcRange, dstRange, brightness, contrast, saturation;
+  int *table;
+  const int *inv_table;
+
+  struct SwsContext *ctx = sws_getContext(anim->x,
+                                          anim->y,
+                                          src_pix_fmt,
+                                          anim->x,
+                                          anim->y,
+                                          AV_PIX_FMT_RGBA,
+                                          SWS_BILINEAR | SWS_PRINT_INFO | SWS_FULL_CHR_H_INT,
+                                          NULL,
+                                          NULL,
+                                          NULL);
+  if (ctx == NULL) {
+    return NULL;
+  }
+
+  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
+  if (!sws_getColorspaceDetails(ctx,
+                                (int **)&inv_table,
+                                &srcRange,
+                                &table,
+                                &dstRange,
+                                &brightness,
+                                &contrast,
+                                &saturation)) {
+    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
+    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+
+    if (sws_setColorspaceDetails(ctx,
+                                 (int *)inv_table,
+                                 srcRange,
+                                 table,
+                                 dstRange,
+                                 brightness,
+                                 contrast,
+                                 saturation)) {
+      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+    }
+  }
+  else {
+    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  }
+
+  return ctx;
+}
+
+#  ifdef FFMPEG_HAVE_HWACCEL
+static enum AVPixelFormat ffmpeg_hwaccel_get_format(AVCodecContext *ctx,
+                                                    const enum AVPixelFormat *pix_fmts)
+{
+  struct anim *anim = ctx->opaque;
+
+  for (const enum AVPixelFormat *p = pix_fmts; *p != AV_PIX_FMT_NONE; p++) {
+    if (*p == anim->hw_pix_fmt) {
+      return *p;
+    }
+  }
+
+  /* The device cannot handle this stream, fall back to software decoding. */
+  av_log(ctx, AV_LOG_INFO, "anim_movie: no hardware surface offered, decoding in software\n");
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+  return avcodec_default_get_format(ctx, pix_fmts);
+}
+
+/* Try to set up decoding on a hardware device: whichever of VAAPI, NVDEC, VideoToolbox, ...
+ * FFmpeg advertises for this decoder and can open a device for. Decoded frames are downloaded
+ * back to system memory in #ffmpeg_receive_frame. Any failure here or during decoding leaves
+ * the context decoding in software as before. */
+static void ffmpeg_hwaccel_init(struct anim *anim, AVCodecContext *pCodecCtx, const AVCodec *pCodec)
+{
+  if ((U.gpu_flag & USER_GPU_FLAG_HW_VIDEO_DECODE) == 0) {
+    return;
+  }
+  /* Deinterlacing happens in the decoder's native format, keep that path in software. */
+  if (anim->ib_flags & IB_animdeinterlace) {
+    return;
+  }
+
+  for (int i = 0;; i++) {
+    const AVCodecHWConfig *config = avcodec_get_hw_config(pCodec, i);
+    if (config == NULL) {
+      return;
+    }
+    if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0) {
+      continue;
+    }
+    if (av_hwdevice_ctx_create(&anim->hw_device_ctx, config->device_type, NULL, NULL, 0) < 0) {
+      anim->hw_device_ctx = NULL;
+      continue;
+    }
+    anim->hw_pix_fmt = config->pix_fmt;
+    pCodecCtx->hw_device_ctx = av_buffer_ref(anim->hw_device_ctx);
+    pCodecCtx->opaque = anim;
+    pCodecCtx->get_format = ffmpeg_hwaccel_get_format;
+    av_log(NULL,
+           AV_LOG_INFO,
+           "anim_movie: decoding %s on %s\n",
+           pCodec->name,
+           av_hwdevice_get_type_name(config->device_type));
+    return;
+  }
+}
+#  endif /* FFMPEG_HAVE_HWACCEL */
+
 static int startffmpeg(struct anim *anim)
 {
   int i, video_stream_index;
@@ -501,11 +620,6 @@ static int startffmpeg(struct anim *anim)
   double frs_den;
   int streamcount;
 
-  /* The following for color space determination */
-  int srcRange, dstRange, brightness, contrast, saturation;
-  int *table;
-  const int *inv_table;
-
   if (anim == NULL) {
     return (-1);
   }
@@ -569,12 +683,20 @@ static int startffmpeg(struct anim *anim)
     pCodecCtx->thread_type = FF_THREAD_SLICE;
   }
 
+  anim->hw_device_ctx = NULL;
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+#  ifdef FFMPEG_HAVE_HWACCEL
+  ffmpeg_hwaccel_init(anim, pCodecCtx, pCodec);
+#  endif
+
   if (avcodec_open2(pCodecCtx, pCodec, NULL) < 0) {
+    av_buffer_unref(&anim->hw_device_ctx);
     avformat_close_input(&pFormatCtx);
     return -1;
   }
   if (pCodecCtx->pix_fmt == AV_PIX_FMT_NONE) {
     avcodec_free_context(&anim->pCodecCtx);
+    av_buffer_unref(&anim->hw_device_ctx);
     avformat_close_input(&pFormatCtx);
     return -1;
   }
@@ -685,6 +807,7 @@ static int startffmpeg(struct anim *anim)
   anim->pFrame = av_frame_alloc();
   anim->pFrameComplete = false;
   anim->pFrameDeinterlaced = av_frame_alloc();
+  anim->pFrameSw = (anim->hw_device_ctx != NULL) ? av_frame_alloc() : NULL;
   anim->pFrameRGB = av_frame_alloc();
   anim->pFrameRGB->format = AV_PIX_FMT_RGBA;
   anim->pFrameRGB->width = anim->x;
@@ -696,8 +819,10 @@ static int startffmpeg(struct anim *anim)
     avformat_close_input(&anim->pFormatCtx);
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
+    av_frame_free(&anim->pFrameSw);
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = NULL;
     return -1;
   }
@@ -708,8 +833,10 @@ static int startffmpeg(struct anim *anim)
     avformat_close_input(&anim->pFormatCtx);
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
+    av_frame_free(&anim->pFrameSw);
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = NULL;
     return -1;
   }
@@ -728,16 +855,8 @@ static int startffmpeg(struct anim *anim)
                          1);
   }
 
-  anim->img_convert_ctx = sws_getContext(anim->x,
-                                         anim->y,
-                                         anim->pCodecCtx->pix_fmt,
-                                         anim->x,
-                                         anim->y,
-                                         AV_PIX_FMT_RGBA,
-                                         SWS_BILINEAR | SWS_PRINT_INFO | SWS_FULL_CHR_H_INT,
-                                         NULL,
-                                         NULL,
-                                         NULL);
+  anim->img_convert_pix_fmt = anim->pCodecCtx->pix_fmt;
+  anim->img_convert_ctx = ffmpeg_sws_create(anim, anim->img_convert_pix_fmt);
 
   if (!anim->img_convert_ctx) {
     fprintf(stderr, "Can't transform color space??? Bailing out...\n");
@@ -745,39 +864,14 @@ static int startffmpeg(struct anim *anim)
     avformat_close_input(&anim->pFormatCtx);
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
+    av_frame_free(&anim->pFrameSw);
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = NULL;
     return -1;
   }
 
-  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
-  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
-                                (int **)&inv_table,
-                                &srcRange,
-                                &table,
-                                &dstRange,
-                                &brightness,
-                                &contrast,
-                                &saturation)) {
-    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
-    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
-
-    if (sws_setColorspaceDetails(anim->img_convert_ctx,
-                                 (int *)inv_table,
-                                 srcRange,
-                                 table,
-                                 dstRange,
-                                 brightness,
-                                 contrast,
-                                 saturation)) {
-      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-    }
-  }
-  else {
-    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-  }
-
   return 0;
 }
 
@@ -827,6 +921,22 @@ static void ffmpeg_postprocess(struct anim *anim)
     }
   }
 
+  /* Frames downloaded from a hardware decoder are in a different format (typically NV12) than
+   * the one negotiated at open time. Recreate the scaler on the fly when that happens. */
+  if (input->format != anim->img_convert_pix_fmt) {
+    struct SwsContext *ctx = ffmpeg_sws_create(anim, input->format);
+    if (ctx == NULL) {
+      av_log(anim->pFormatCtx,
+             AV_LOG_ERROR,
+             "Can't create scaler for pixel format %d, skipping frame\n",
+             input->format);
+      return;
+    }
+    sws_freeContext(anim->img_convert_ctx);
+    anim->img_convert_ctx = ctx;
+    anim->img_convert_pix_fmt = input->format;
+  }
+
   sws_scale(anim->img_convert_ctx,
             (const uint8_t *const *)input->data,
             input->linesize,
@@ -867,6 +977,30 @@ static void ffmpeg_decode_store_frame_pts(struct anim *anim)
          (int64_t)anim->cur_pts);
 }
 
+/* Receive a decoded frame into anim->pFrame, downloading it from the hardware device first when
+ * decoding happens there. Returns true when a complete frame was received. */
+static int ffmpeg_receive_frame(struct anim *anim)
+{
+  if (avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) != 0) {
+    return false;
+  }
+
+#  ifdef FFMPEG_HAVE_HWACCEL
+  if (anim->hw_device_ctx != NULL && anim->pFrame->format == anim->hw_pix_fmt) {
+    av_frame_unref(anim->pFrameSw);
+    if (av_hwframe_transfer_data(anim->pFrameSw, anim->pFrame, 0) < 0) {
+      av_log(anim->pFormatCtx, AV_LOG_ERROR, "Failed to download frame from hardware decoder\n");
+      return false;
+    }
+    av_frame_copy_props(anim->pFrameSw, anim->pFrame);
+    av_frame_unref(anim->pFrame);
+    av_frame_move_ref(anim->pFrame, anim->pFrameSw);
+  }
+#  endif
+
+  return true;
+}
+
 /* decode one video frame also considering the packet read into cur_packet */
 static int ffmpeg_decode_video_frame(struct anim *anim)
 {
@@ -874,7 +1008,7 @@ static int ffmpeg_decode_video_frame(struct anim *anim)
 
   /* Sometimes, decoder returns more than one frame per sent packet. Check if frames are available.
    * This frames must be read, otherwise decoding will fail. See T91405. */
-  anim->pFrameComplete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+  anim->pFrameComplete = ffmpeg_receive_frame(anim);
   if (anim->pFrameComplete) {
     av_log(anim->pFormatCtx, AV_LOG_DEBUG, "  DECODE FROM CODEC BUFFER\n");
     ffmpeg_decode_store_frame_pts(anim);
@@ -899,7 +1033,7 @@ static int ffmpeg_decode_video_frame(struct anim *anim)
            (anim->cur_packet->flags & AV_PKT_FLAG_KEY) ? " KEY" : "");
     if (anim->cur_packet->stream_index == anim->videoStream) {
       avcodec_send_packet(anim->pCodecCtx, anim->cur_packet);
-      anim->pFrameComplete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+      anim->pFrameComplete = ffmpeg_receive_frame(anim);
 
       if (anim->pFrameComplete) {
         ffmpeg_decode_store_frame_pts(anim);
@@ -913,7 +1047,7 @@ static int ffmpeg_decode_video_frame(struct anim *anim)
   if (rval == AVERROR_EOF) {
     /* Flush any remaining frames out of the decoder. */
     avcodec_send_packet(anim->pCodecCtx, NULL);
-    anim->pFrameComplete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+    anim->pFrameComplete = ffmpeg_receive_frame(anim);
 
     if (anim->pFrameComplete) {
       ffmpeg_decode_store_frame_pts(anim);
@@ -1384,6 +1518,8 @@ static void free_anim_ffmpeg(struct anim *anim)
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrameSw);
+    av_buffer_unref(&anim->hw_device_ctx);
 
     sws_freeContext(anim->img_convert_ctx);
     IMB_freeImBuf(anim->cur_frame_final);
@@ -1408,6 +1408,7 @@ typedef struct DisplayBufferThread {
   ColormanageProcessor *cm_processor;
 
   const float *buffer;
+  const unsigned short *half_buffer;
   unsigned char *byte_buffer;
 
   float *display_buffer;
@@ -1430,6 +1431,7 @@ typedef struct DisplayBufferInitData {
   ImBuf *ibuf;
   ColormanageProcessor *cm_processor;
   const float *buffer;
+  const unsigned short *half_buffer;
   unsigned char *byte_buffer;
 
   float *display_buffer;
@@ -1465,6 +1467,10 @@ static void display_buffer_init_handle(void *handle_v,
     handle->buffer = init_data->buffer + offset;
   }
 
+  if (init_data->half_buffer) {
+    handle->half_buffer = init_data->half_buffer + offset;
+  }
+
   if (init_data->byte_buffer) {
     handle->byte_buffer = init_data->byte_buffer + offset;
   }
@@ -1505,7 +1511,7 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
   bool is_data_display = handle->cm_processor->is_data_result;
   bool predivide = handle->predivide;
 
-  if (!handle->buffer) {
+  if (!handle->buffer && !handle->half_buffer) {
     unsigned char *byte_buffer = handle->byte_buffer;
 
     const char *from_colorspace = handle->byte_colorspace;
@@ -1548,7 +1554,12 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     const char *from_colorspace = handle->float_colorspace;
     const char *to_colorspace = global_role_scene_linear;
 
-    memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    if (handle->buffer) {
+      memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    }
+    else {
+      IMB_buffer_float_from_half(linear_buffer, handle->half_buffer, buffer_size);
+    }
 
     if (!is_data && !is_data_display) {
       IMB_colormanagement_transform(
@@ -1564,7 +1575,12 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
      * using duplicated buffer here
      */
 
-    memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    if (handle->buffer) {
+      memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
+    }
+    else {
+      IMB_buffer_float_from_half(linear_buffer, handle->half_buffer, buffer_size);
+    }
 
     *is_straight_alpha = false;
   }
@@ -1665,6 +1681,7 @@ static void *do_display_buffer_apply_thread(void *handle_v)
 
 static void display_buffer_apply_threaded(ImBuf *ibuf,
                                           const float *buffer,
+                                          const unsigned short *half_buffer,
                                           unsigned char *byte_buffer,
                                           float *display_buffer,
                                           unsigned char *display_buffer_byte,
@@ -1675,6 +1692,7 @@ static void display_buffer_apply_threaded(ImBuf *ibuf,
   init_data.ibuf = ibuf;
   init_data.cm_processor = cm_processor;
   init_data.buffer = buffer;
+  init_data.half_buffer = half_buffer;
   init_data.byte_buffer = byte_buffer;
   init_data.display_buffer = display_buffer;
   init_data.display_buffer_byte = display_buffer_byte;
@@ -1741,7 +1759,7 @@ static void colormanage_display_buffer_process_ex(
    * this would save byte -> float -> byte conversions making display buffer
    * computation noticeable faster
    */
-  if (ibuf->rect_float == NULL && ibuf->rect_colorspace) {
+  if (ibuf->rect_float == NULL && ibuf->rect_half == NULL && ibuf->rect_colorspace) {
     skip_transform = is_ibuf_rect_in_display_space(ibuf, view_settings, display_settings);
   }
 
@@ -1751,6 +1769,7 @@ static void colormanage_display_buffer_process_ex(
 
   display_buffer_apply_threaded(ibuf,
                                 ibuf->rect_float,
+                                ibuf->rect_half,
                                 (unsigned char *)ibuf->rect,
                                 display_buffer,
                                 display_buffer_byte,
@@ -2619,7 +2638,8 @@ unsigned char *IMB_display_buffer_acquire(ImBuf *ibuf,
   /* early out: no float buffer and byte buffer is already in display space,
    * let's just use if
    */
-  if (ibuf->rect_float == NULL && ibuf->rect_colorspace && ibuf->channels == 4) {
+  if (ibuf->rect_float == NULL && ibuf->rect_half == NULL && ibuf->rect_colorspace &&
+      ibuf->channels == 4) {
     if (is_ibuf_rect_in_display_space(ibuf, applied_view_settings, display_settings)) {
       return (unsigned char *)ibuf->rect;
     }
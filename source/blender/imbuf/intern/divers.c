@@ -6,6 +6,7 @@
  */
 
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "BLI_utildefines.h"
 
 #include "IMB_filter.h"
@@ -85,6 +86,43 @@ MINLINE void float_to_byte_dither_v4(
   b[3] = unit_float_to_uchar_clamp(f[3]);
 }
 
+#ifdef BLI_HAVE_SSE2
+
+/**
+ * Convert 4 consecutive RGBA pixels at once, with the same clamping and
+ * rounding as #unit_float_to_uchar_clamp (the saturating packs handle the
+ * clamping to 0..255).
+ */
+MINLINE void float_to_byte_v4_x4(uchar b[16], const float f[16])
+{
+  const __m128 scale = _mm_set1_ps(255.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  __m128i p0 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f + 0), scale), half));
+  __m128i p1 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f + 4), scale), half));
+  __m128i p2 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f + 8), scale), half));
+  __m128i p3 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f + 12), scale), half));
+  __m128i packed = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+  _mm_storeu_si128((__m128i *)b, packed);
+}
+
+/**
+ * Convert 4 consecutive RGBA pixels at once, same result as #rgba_uchar_to_float.
+ */
+MINLINE void byte_to_float_v4_x4(float f[16], const uchar b[16])
+{
+  const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i packed = _mm_loadu_si128((const __m128i *)b);
+  __m128i lo = _mm_unpacklo_epi8(packed, zero);
+  __m128i hi = _mm_unpackhi_epi8(packed, zero);
+  _mm_storeu_ps(f + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+  _mm_storeu_ps(f + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+  _mm_storeu_ps(f + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+  _mm_storeu_ps(f + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+}
+
+#endif /* BLI_HAVE_SSE2 */
+
 bool IMB_alpha_affects_rgb(const ImBuf *ibuf)
 {
   return ibuf && (ibuf->flags & IB_alphamode_channel_packed) == 0;
@@ -184,7 +222,13 @@ void IMB_buffer_byte_from_float(uchar *rect_to,
           }
         }
         else {
-          for (x = 0; x < width; x++, from += 4, to += 4) {
+          x = 0;
+#ifdef BLI_HAVE_SSE2
+          for (; x < width - 3; x += 4, from += 16, to += 16) {
+            float_to_byte_v4_x4(to, from);
+          }
+#endif
+          for (; x < width; x++, from += 4, to += 4) {
             rgba_float_to_uchar(to, from);
           }
         }
@@ -242,7 +286,18 @@ void IMB_buffer_byte_from_float(uchar *rect_to,
           }
         }
         else {
-          for (x = 0; x < width; x++, from += 4, to += 4) {
+          x = 0;
+#ifdef BLI_HAVE_SSE2
+          float tmp4[16];
+          for (; x < width - 3; x += 4, from += 16, to += 16) {
+            srgb_to_linearrgb_v4(tmp4 + 0, from + 0);
+            srgb_to_linearrgb_v4(tmp4 + 4, from + 4);
+            srgb_to_linearrgb_v4(tmp4 + 8, from + 8);
+            srgb_to_linearrgb_v4(tmp4 + 12, from + 12);
+            float_to_byte_v4_x4(to, tmp4);
+          }
+#endif
+          for (; x < width; x++, from += 4, to += 4) {
             srgb_to_linearrgb_v4(tmp, from);
             rgba_float_to_uchar(to, tmp);
           }
@@ -370,7 +425,13 @@ void IMB_buffer_float_from_byte(float *rect_to,
 
     if (profile_to == profile_from) {
       /* no color space conversion */
-      for (x = 0; x < width; x++, from += 4, to += 4) {
+      x = 0;
+#ifdef BLI_HAVE_SSE2
+      for (; x < width - 3; x += 4, from += 16, to += 16) {
+        byte_to_float_v4_x4(to, from);
+      }
+#endif
+      for (; x < width; x++, from += 4, to += 4) {
         rgba_uchar_to_float(to, from);
       }
     }
@@ -697,6 +758,11 @@ void IMB_rect_from_float(ImBuf *ibuf)
   float *buffer;
   const char *from_colorspace;
 
+  /* half float buffers convert through the full float path */
+  if (ibuf->rect_float == NULL && ibuf->rect_half != NULL) {
+    IMB_float_from_half(ibuf);
+  }
+
   /* verify we have a float buffer */
   if (ibuf->rect_float == NULL) {
     return;
@@ -806,6 +872,136 @@ void IMB_float_from_rect(ImBuf *ibuf)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Half Float Conversion
+ * \{ */
+
+/* Conversion to/from IEEE 754 binary16 intended for pixel data: NaN/inf and
+ * values outside the half range clamp to the maximum half value, denormals
+ * flush to zero. Pixels never legitimately need those encodings and dropping
+ * them keeps the conversion cheap. */
+
+static ushort imb_half_from_float(const float value)
+{
+  union {
+    float f;
+    unsigned int i;
+  } u = {value};
+
+  const unsigned int sign = (u.i >> 16) & 0x8000;
+  unsigned int bits = u.i & 0x7fffffff;
+
+  if (bits >= 0x7f800000) {
+    /* NaN or inf. */
+    return (ushort)(sign | 0x7bff);
+  }
+
+  /* Round mantissa to nearest even before dropping 13 bits. */
+  bits += 0x00000fff + ((bits >> 13) & 1);
+
+  if (bits >= 0x47800000) {
+    /* Overflows the half range, clamp to the maximum finite value. */
+    return (ushort)(sign | 0x7bff);
+  }
+  if (bits < 0x38800000) {
+    /* Underflow, denormals flush to zero. */
+    return (ushort)sign;
+  }
+
+  return (ushort)(sign | ((bits - 0x38000000) >> 13));
+}
+
+static float imb_half_to_float(const ushort h)
+{
+  union {
+    unsigned int i;
+    float f;
+  } u;
+  const unsigned int exponent = h & 0x7c00;
+
+  if (exponent == 0) {
+    /* Signed zero, denormals flush to zero. */
+    u.i = (unsigned int)(h & 0x8000) << 16;
+  }
+  else if (exponent == 0x7c00) {
+    /* NaN or inf, not produced by #imb_half_from_float but files may contain them. */
+    u.i = ((unsigned int)(h & 0x8000) << 16) | 0x7f800000 | ((unsigned int)(h & 0x03ff) << 13);
+  }
+  else {
+    /* Re-bias the exponent from 15 to 127. */
+    u.i = ((unsigned int)(h & 0x8000) << 16) | ((((unsigned int)h & 0x7fff) << 13) + 0x38000000);
+  }
+
+  return u.f;
+}
+
+void IMB_buffer_float_from_half(float *rect_to, const ushort *rect_from, size_t values_num)
+{
+  for (size_t i = 0; i < values_num; i++) {
+    rect_to[i] = imb_half_to_float(rect_from[i]);
+  }
+}
+
+void IMB_buffer_half_from_float(ushort *rect_to, const float *rect_from, size_t values_num)
+{
+  for (size_t i = 0; i < values_num; i++) {
+    rect_to[i] = imb_half_from_float(rect_from[i]);
+  }
+}
+
+void IMB_half_from_float(ImBuf *ibuf)
+{
+  if (ibuf->rect_float == NULL) {
+    return;
+  }
+
+  const size_t values_num = IMB_get_rect_len(ibuf) * (size_t)ibuf->channels;
+  ushort *rect_half = ibuf->rect_half;
+
+  if (rect_half == NULL) {
+    rect_half = MEM_mallocN(values_num * sizeof(ushort), "IMB_half_from_float");
+    if (rect_half == NULL) {
+      return;
+    }
+  }
+
+  IMB_buffer_half_from_float(rect_half, ibuf->rect_float, values_num);
+
+  if (ibuf->rect_half == NULL) {
+    ibuf->rect_half = rect_half;
+    ibuf->mall |= IB_recthalffloat;
+    ibuf->flags |= IB_recthalffloat;
+  }
+
+  /* The point of the half buffer is halving memory, keep a single source of truth. */
+  imb_freerectfloatImBuf(ibuf);
+}
+
+void IMB_float_from_half(ImBuf *ibuf)
+{
+  /* The full float buffer takes priority when both exist. */
+  if (ibuf->rect_half == NULL || ibuf->rect_float != NULL) {
+    return;
+  }
+
+  const size_t values_num = IMB_get_rect_len(ibuf) * (size_t)ibuf->channels;
+  float *rect_float = MEM_mallocN(values_num * sizeof(float), "IMB_float_from_half");
+
+  if (rect_float == NULL) {
+    return;
+  }
+
+  IMB_buffer_float_from_half(rect_float, ibuf->rect_half, values_num);
+
+  ibuf->rect_float = rect_float;
+  ibuf->mall |= IB_rectfloat;
+  ibuf->flags |= IB_rectfloat;
+
+  imb_freerecthalffloatImBuf(ibuf);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Color to Gray-Scale
  * \{ */
@@ -833,20 +1029,47 @@ void IMB_buffer_float_unpremultiply(float *buf, int width, int height)
 {
   size_t total = ((size_t)width) * height;
   float *fp = buf;
+#ifdef BLI_HAVE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 rgb_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  while (total--) {
+    const __m128 c = _mm_loadu_ps(fp);
+    const __m128 alpha = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+    /* Branch-less version of the `alpha == 0 || alpha == 1` pass-through
+     * in #premul_to_straight_v4. */
+    const __m128 mask = _mm_andnot_ps(
+        _mm_or_ps(_mm_cmpeq_ps(alpha, zero), _mm_cmpeq_ps(alpha, one)), rgb_mask);
+    const __m128 straight = _mm_mul_ps(c, _mm_div_ps(one, alpha));
+    _mm_storeu_ps(fp, _bli_math_blend_sse(mask, straight, c));
+    fp += 4;
+  }
+#else
   while (total--) {
     premul_to_straight_v4(fp);
     fp += 4;
   }
+#endif
 }
 
 void IMB_buffer_float_premultiply(float *buf, int width, int height)
 {
   size_t total = ((size_t)width) * height;
   float *fp = buf;
+#ifdef BLI_HAVE_SSE2
+  const __m128 rgb_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  while (total--) {
+    const __m128 c = _mm_loadu_ps(fp);
+    const __m128 alpha = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+    _mm_storeu_ps(fp, _bli_math_blend_sse(rgb_mask, _mm_mul_ps(c, alpha), c));
+    fp += 4;
+  }
+#else
   while (total--) {
     straight_to_premul_v4(fp);
     fp += 4;
   }
+#endif
 }
 
 /** \} */
@@ -16,6 +16,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_math.h"
+#include "BLI_rect.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -347,10 +348,19 @@ void nearest_interpolation(const ImBuf *in, ImBuf *out, float u, float v, int xo
 /** \name Threaded Image Processing
  * \{ */
 
-static void processor_apply_func(TaskPool *__restrict pool, void *taskdata)
+typedef struct ProcessorApplyData {
+  void *handles;
+  int handle_size;
+  void *(*do_thread)(void *);
+} ProcessorApplyData;
+
+static void processor_apply_parallel_func(void *__restrict userdata,
+                                          const int task,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  void (*do_thread)(void *) = (void (*)(void *))BLI_task_pool_user_data(pool);
-  do_thread(taskdata);
+  ProcessorApplyData *data = userdata;
+  void *handle = ((char *)data->handles) + data->handle_size * task;
+  data->do_thread(handle);
 }
 
 void IMB_processor_apply_threaded(
@@ -362,14 +372,10 @@ void IMB_processor_apply_threaded(
 {
   const int lines_per_task = 64;
 
-  TaskPool *task_pool;
-
   void *handles;
   int total_tasks = (buffer_lines + lines_per_task - 1) / lines_per_task;
   int i, start_line;
 
-  task_pool = BLI_task_pool_create(do_thread, TASK_PRIORITY_LOW);
-
   handles = MEM_callocN(handle_size * total_tasks, "processor apply threaded handles");
 
   start_line = 0;
@@ -387,17 +393,21 @@ void IMB_processor_apply_threaded(
 
     init_handle(handle, start_line, lines_per_current_task, init_customdata);
 
-    BLI_task_pool_push(task_pool, processor_apply_func, handle, false, NULL);
-
     start_line += lines_per_task;
   }
 
-  /* work and wait until tasks are done */
-  BLI_task_pool_work_and_wait(task_pool);
+  /* One task per iteration, so idle threads can steal bands with cheaper lines. */
+  ProcessorApplyData data = {
+      .handles = handles,
+      .handle_size = handle_size,
+      .do_thread = do_thread,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, total_tasks, &data, processor_apply_parallel_func, &settings);
 
-  /* Free memory. */
   MEM_freeN(handles);
-  BLI_task_pool_free(task_pool);
 }
 
 typedef struct ScanlineGlobalData {
@@ -427,6 +437,56 @@ void IMB_processor_apply_threaded_scanlines(int total_scanlines,
   BLI_task_parallel_range(0, total_scanlines, &data, processor_apply_parallel, &settings);
 }
 
+/* Tile edge length for #IMB_processor_apply_threaded_tiles, small enough to balance
+ * uneven work, large enough to keep scheduling overhead negligible. */
+#define PROCESSOR_TILE_SIZE 64
+
+typedef struct TileGlobalData {
+  void *custom_data;
+  TileThreadFunc do_tile;
+  int width, height;
+  int tiles_x;
+} TileGlobalData;
+
+static void processor_apply_tile(void *__restrict userdata,
+                                 const int tile_index,
+                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  TileGlobalData *data = userdata;
+  const int tile_x = tile_index % data->tiles_x;
+  const int tile_y = tile_index / data->tiles_x;
+
+  rcti tile;
+  BLI_rcti_init(&tile,
+                tile_x * PROCESSOR_TILE_SIZE,
+                min_ii((tile_x + 1) * PROCESSOR_TILE_SIZE, data->width),
+                tile_y * PROCESSOR_TILE_SIZE,
+                min_ii((tile_y + 1) * PROCESSOR_TILE_SIZE, data->height));
+  data->do_tile(data->custom_data, &tile);
+}
+
+void IMB_processor_apply_threaded_tiles(int width,
+                                        int height,
+                                        TileThreadFunc do_tile,
+                                        void *custom_data)
+{
+  TileGlobalData data = {
+      .custom_data = custom_data,
+      .do_tile = do_tile,
+      .width = width,
+      .height = height,
+      .tiles_x = divide_ceil_u(width, PROCESSOR_TILE_SIZE),
+  };
+  const int tiles_y = divide_ceil_u(height, PROCESSOR_TILE_SIZE);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  /* Hand out single tiles so threads steal from image regions that turn out expensive. */
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(
+      0, data.tiles_x * tiles_y, &data, processor_apply_tile, &settings);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
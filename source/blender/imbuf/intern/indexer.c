@@ -769,6 +769,19 @@ static void free_proxy_output_ffmpeg(struct proxy_output_ctx *ctx, int rollback)
   MEM_freeN(ctx);
 }
 
+/* Number of decoded frames a proxy encoder thread may fall behind the decode
+ * thread before the decoder blocks. Queued frames only hold references to the
+ * decoder's buffers, so this bounds the frames kept alive, not full copies. */
+#  define PROXY_ENCODE_QUEUE_SIZE 8
+
+typedef struct ProxyEncodeSlot {
+  struct proxy_output_ctx *proxy_ctx;
+  /** Decoded frames waiting for this proxy size, owning an #AVFrame reference each. */
+  ThreadQueue *frame_queue;
+  /** Back-pressure tokens, pre-filled with #PROXY_ENCODE_QUEUE_SIZE dummy entries. */
+  ThreadQueue *token_queue;
+} ProxyEncodeSlot;
+
 typedef struct FFmpegIndexBuilderContext {
   int anim_type;
 
@@ -784,6 +797,11 @@ typedef struct FFmpegIndexBuilderContext {
   struct proxy_output_ctx *proxy_ctx[IMB_PROXY_MAX_SLOT];
   anim_index_builder *indexer[IMB_TC_MAX_SLOT];
 
+  /* One encoder thread per active proxy size, fed from the decode thread. */
+  ListBase encode_threads;
+  ProxyEncodeSlot encode_slot[IMB_PROXY_MAX_SLOT];
+  int num_encode_slots;
+
   IMB_Timecode_Type tcs_in_use;
   IMB_Proxy_Size proxy_sizes_in_use;
 
@@ -921,6 +939,76 @@ static IndexBuildContext *index_ffmpeg_create_context(struct anim *anim,
   return (IndexBuildContext *)context;
 }
 
+static void *proxy_encode_thread_do(void *slot_v)
+{
+  ProxyEncodeSlot *slot = slot_v;
+  AVFrame *frame;
+
+  /* Queue is FIFO, so frames keep their decode order per proxy size. */
+  while ((frame = BLI_thread_queue_pop(slot->frame_queue))) {
+    add_to_proxy_output_ffmpeg(slot->proxy_ctx, frame);
+    av_frame_free(&frame);
+    BLI_thread_queue_push(slot->token_queue, (void *)slot);
+  }
+
+  return NULL;
+}
+
+static void index_rebuild_ffmpeg_proxy_encoders_start(FFmpegIndexBuilderContext *context)
+{
+  int i;
+
+  context->num_encode_slots = 0;
+
+  for (i = 0; i < context->num_proxy_sizes; i++) {
+    if ((context->proxy_sizes_in_use & proxy_sizes[i]) && context->proxy_ctx[i]) {
+      ProxyEncodeSlot *slot = &context->encode_slot[context->num_encode_slots++];
+
+      slot->proxy_ctx = context->proxy_ctx[i];
+      slot->frame_queue = BLI_thread_queue_init();
+      slot->token_queue = BLI_thread_queue_init();
+
+      for (int j = 0; j < PROXY_ENCODE_QUEUE_SIZE; j++) {
+        BLI_thread_queue_push(slot->token_queue, (void *)slot);
+      }
+    }
+  }
+
+  if (context->num_encode_slots == 0) {
+    return;
+  }
+
+  BLI_threadpool_init(&context->encode_threads, proxy_encode_thread_do, context->num_encode_slots);
+
+  for (i = 0; i < context->num_encode_slots; i++) {
+    BLI_threadpool_insert(&context->encode_threads, &context->encode_slot[i]);
+  }
+}
+
+static void index_rebuild_ffmpeg_proxy_encoders_finish(FFmpegIndexBuilderContext *context)
+{
+  int i;
+
+  if (context->num_encode_slots == 0) {
+    return;
+  }
+
+  /* Remaining queued frames are still encoded, the threads only exit once
+   * their queue runs empty. */
+  for (i = 0; i < context->num_encode_slots; i++) {
+    BLI_thread_queue_nowait(context->encode_slot[i].frame_queue);
+  }
+
+  BLI_threadpool_end(&context->encode_threads);
+
+  for (i = 0; i < context->num_encode_slots; i++) {
+    BLI_thread_queue_free(context->encode_slot[i].frame_queue);
+    BLI_thread_queue_free(context->encode_slot[i].token_queue);
+  }
+
+  context->num_encode_slots = 0;
+}
+
 static void index_rebuild_ffmpeg_finish(FFmpegIndexBuilderContext *context, int stop)
 {
   int i;
@@ -955,8 +1043,28 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *c
   uint64_t s_dts = context->seek_pos_dts;
   uint64_t pts = av_get_pts_from_frame(in_frame);
 
-  for (i = 0; i < context->num_proxy_sizes; i++) {
-    add_to_proxy_output_ffmpeg(context->proxy_ctx[i], in_frame);
+  /* Hand the decoded frame to the per-size encoder threads, blocking on the
+   * token queue when an encoder is #PROXY_ENCODE_QUEUE_SIZE frames behind. */
+  for (i = 0; i < context->num_encode_slots; i++) {
+    ProxyEncodeSlot *slot = &context->encode_slot[i];
+    AVFrame *frame = av_frame_clone(in_frame);
+
+    if (frame) {
+      BLI_thread_queue_pop(slot->token_queue);
+      BLI_thread_queue_push(slot->frame_queue, frame);
+    }
+    else {
+      /* Couldn't reference the frame (out of memory). Holding all tokens means the
+       * encoder thread is idle with an empty queue, then it is safe to encode the
+       * frame from this thread without reordering. */
+      for (int j = 0; j < PROXY_ENCODE_QUEUE_SIZE; j++) {
+        BLI_thread_queue_pop(slot->token_queue);
+      }
+      add_to_proxy_output_ffmpeg(slot->proxy_ctx, in_frame);
+      for (int j = 0; j < PROXY_ENCODE_QUEUE_SIZE; j++) {
+        BLI_thread_queue_push(slot->token_queue, (void *)slot);
+      }
+    }
   }
 
   if (!context->start_pts_set) {
@@ -1015,6 +1123,8 @@ static int index_rebuild_ffmpeg(FFmpegIndexBuilderContext *context,
   context->frame_rate = av_q2d(context->iStream->r_frame_rate);
   context->pts_time_base = av_q2d(context->iStream->time_base);
 
+  index_rebuild_ffmpeg_proxy_encoders_start(context);
+
   while (av_read_frame(context->iFormatCtx, next_packet) >= 0) {
     float next_progress =
         (float)((int)floor(((double)next_packet->pos) * 100 / ((double)stream_size) + 0.5)) / 100;
@@ -1080,6 +1190,8 @@ static int index_rebuild_ffmpeg(FFmpegIndexBuilderContext *context,
     }
   }
 
+  index_rebuild_ffmpeg_proxy_encoders_finish(context);
+
   av_packet_free(&next_packet);
   av_free(in_frame);
 
@@ -300,7 +300,7 @@ void IMB_moviecache_set_priority_callback(struct MovieCache *cache,
   cache->prioritydeleterfp = prioritydeleterfp;
 }
 
-static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, bool need_lock)
+static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf)
 {
   MovieCacheKey *key;
   MovieCacheItem *item;
@@ -338,9 +338,9 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
     memcpy(cache->last_userkey, userkey, cache->keysize);
   }
 
-  if (need_lock) {
-    BLI_mutex_lock(&limitor_lock);
-  }
+  /* Only limiter operations need the global lock, hash updates are synchronized
+   * by the caller per cache. */
+  BLI_mutex_lock(&limitor_lock);
 
   item->c_handle = MEM_CacheLimiter_insert(limitor, item);
 
@@ -348,9 +348,7 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
   MEM_CacheLimiter_enforce_limits(limitor);
   MEM_CacheLimiter_unref(item->c_handle);
 
-  if (need_lock) {
-    BLI_mutex_unlock(&limitor_lock);
-  }
+  BLI_mutex_unlock(&limitor_lock);
 
   /* cache limiter can't remove unused keys which points to destroyed values */
   check_unused_keys(cache);
@@ -360,28 +358,34 @@ static void do_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf, boo
 
 void IMB_moviecache_put(MovieCache *cache, void *userkey, ImBuf *ibuf)
 {
-  do_moviecache_put(cache, userkey, ibuf, true);
+  do_moviecache_put(cache, userkey, ibuf);
 }
 
 bool IMB_moviecache_put_if_possible(MovieCache *cache, void *userkey, ImBuf *ibuf)
 {
   size_t mem_in_use, mem_limit, elem_size;
-  bool result = false;
+
+  if (!limitor) {
+    IMB_moviecache_init();
+  }
 
   elem_size = (ibuf == NULL) ? 0 : get_size_in_memory(ibuf);
   mem_limit = MEM_CacheLimiter_get_maximum();
 
   BLI_mutex_lock(&limitor_lock);
   mem_in_use = MEM_CacheLimiter_get_memory_in_use(limitor);
+  BLI_mutex_unlock(&limitor_lock);
 
+  /* Not atomic with the insertion below: concurrent writers can overshoot the
+   * limit by a frame, which the enforcing during put corrects again. Keeping
+   * the global lock released while updating the hash is what lets multiple
+   * threads fill different caches concurrently. */
   if (mem_in_use + elem_size <= mem_limit) {
-    do_moviecache_put(cache, userkey, ibuf, false);
-    result = true;
+    do_moviecache_put(cache, userkey, ibuf);
+    return true;
   }
 
-  BLI_mutex_unlock(&limitor_lock);
-
-  return result;
+  return false;
 }
 
 void IMB_moviecache_remove(MovieCache *cache, void *userkey)
@@ -407,10 +411,11 @@ ImBuf *IMB_moviecache_get(MovieCache *cache, void *userkey, bool *r_is_cached_em
 
   if (item) {
     if (item->ibuf) {
-      BLI_mutex_lock(&limitor_lock);
-      MEM_CacheLimiter_touch(item->c_handle);
-      BLI_mutex_unlock(&limitor_lock);
-
+      /* No limiter touch on the hit path: #IMB_moviecache_init always installs
+       * #get_item_priority, and with a priority callback set the limiter ignores
+       * touch-based LRU re-ordering (eviction iterates all elements by priority).
+       * This keeps cache probes free of the global `limitor_lock`, so prefetch
+       * threads and playback do not serialize here. */
       IMB_refImBuf(item->ibuf);
 
       return item->ibuf;
@@ -43,6 +43,8 @@
 #include <OpenEXR/ImfInputFile.h>
 #include <OpenEXR/ImfOutputFile.h>
 #include <OpenEXR/ImfPixelType.h>
+#include <OpenEXR/ImfPreviewImage.h>
+#include <OpenEXR/ImfRgbaFile.h>
 #include <OpenEXR/ImfStandardAttributes.h>
 #include <OpenEXR/ImfStringAttribute.h>
 #include <OpenEXR/ImfVersion.h>
@@ -78,6 +80,7 @@ _CRTIMP void __cdecl _invalid_parameter_noinfo(void)
 }
 #include "BLI_blenlib.h"
 #include "BLI_math_color.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.h"
@@ -1096,6 +1099,26 @@ void IMB_exr_clear_channels(void *handle)
   BLI_freelistN(&data->channels);
 }
 
+/* Data for the parallel float to half conversion in #IMB_exr_write_channels. */
+struct ExrHalfConvertData {
+  std::vector<const ExrChannel *> channels;
+  std::vector<half *> destinations;
+  size_t num_pixels;
+};
+
+static void imb_exr_convert_half_channel_fn(void *__restrict userdata,
+                                            const int n,
+                                            const TaskParallelTLS *__restrict /*tls*/)
+{
+  ExrHalfConvertData *data = static_cast<ExrHalfConvertData *>(userdata);
+  const ExrChannel *echan = data->channels[n];
+  const float *rect = echan->rect;
+  half *cur = data->destinations[n];
+  for (size_t i = 0; i < data->num_pixels; i++, cur++) {
+    *cur = float_to_half_safe(rect[i * echan->xstride]);
+  }
+}
+
 void IMB_exr_write_channels(void *handle)
 {
   ExrHandle *data = (ExrHandle *)handle;
@@ -1105,6 +1128,8 @@ void IMB_exr_write_channels(void *handle)
   if (data->channels.first) {
     const size_t num_pixels = ((size_t)data->width) * data->height;
     half *rect_half = nullptr, *current_rect_half = nullptr;
+    ExrHalfConvertData convert_data;
+    convert_data.num_pixels = num_pixels;
 
     /* We allocate temporary storage for half pixels for all the channels at once. */
     if (data->num_half_channels != 0) {
@@ -1116,11 +1141,8 @@ void IMB_exr_write_channels(void *handle)
     for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
       /* Writing starts from last scan-line, stride negative. */
       if (echan->use_half_float) {
-        float *rect = echan->rect;
-        half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        convert_data.channels.push_back(echan);
+        convert_data.destinations.push_back(current_rect_half);
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1137,6 +1159,20 @@ void IMB_exr_write_channels(void *handle)
       }
     }
 
+    /* Convert float data to half with one task per channel. For a multi-layer render result
+     * this is a significant amount of work which would otherwise run serially before the
+     * (already threaded) chunk compression in writePixels(). */
+    if (!convert_data.channels.empty()) {
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (num_pixels > 4096);
+      BLI_task_parallel_range(0,
+                              int(convert_data.channels.size()),
+                              &convert_data,
+                              imb_exr_convert_half_channel_fn,
+                              &settings);
+    }
+
     data->ofile->setFrameBuffer(frameBuffer);
     try {
       data->ofile->writePixels(data->height);
@@ -1234,6 +1270,7 @@ void IMB_exr_read_channels(void *handle)
     /* Insert all matching channel into frame-buffer. */
     FrameBuffer frameBuffer;
     ExrChannel *echan;
+    int num_inserted_channels = 0;
 
     for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
       if (echan->m->part_number != i) {
@@ -1265,12 +1302,18 @@ void IMB_exr_read_channels(void *handle)
 
         frameBuffer.insert(echan->m->internal_name,
                            Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
+        num_inserted_channels++;
       }
       else {
         printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
       }
     }
 
+    /* Skip parts without requested channels, no need to decompress their chunks. */
+    if (num_inserted_channels == 0) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
@@ -2098,9 +2141,103 @@ struct ImBuf *imb_load_openexr(const unsigned char *mem,
   }
 }
 
+struct ImBuf *imb_load_filepath_thumbnail_openexr(const char *filepath,
+                                                  const int /*flags*/,
+                                                  const size_t max_thumb_size,
+                                                  char colorspace[IM_MAX_SPACE],
+                                                  size_t *r_width,
+                                                  size_t *r_height)
+{
+  IStream *stream = nullptr;
+  RgbaInputFile *file = nullptr;
+
+  /* OpenEXR uses exceptions for error-handling. */
+  try {
+    stream = new IFileStream(filepath);
+    file = new RgbaInputFile(*stream, 0);
+
+    if (!file->isComplete()) {
+      delete file;
+      delete stream;
+      return nullptr;
+    }
+
+    Imath::Box2i dw = file->dataWindow();
+    const int source_w = dw.max.x - dw.min.x + 1;
+    const int source_h = dw.max.y - dw.min.y + 1;
+    if (r_width) {
+      *r_width = source_w;
+    }
+    if (r_height) {
+      *r_height = source_h;
+    }
+
+    /* If there is an embedded thumbnail, return that instead of making a new one. */
+    if (file->header().hasPreviewImage()) {
+      const PreviewImage &preview = file->header().previewImage();
+      ImBuf *ibuf = IMB_allocFromBuffer(
+          (const unsigned int *)preview.pixels(), nullptr, preview.width(), preview.height(), 4);
+      delete file;
+      delete stream;
+      IMB_flipy(ibuf);
+      colorspace_set_default_role(colorspace, IM_MAX_SPACE, COLOR_ROLE_DEFAULT_BYTE);
+      return ibuf;
+    }
+
+    colorspace_set_default_role(colorspace, IM_MAX_SPACE, COLOR_ROLE_DEFAULT_FLOAT);
+
+    /* Only a subset of source rows & columns is read, scaling to at most `max_thumb_size`
+     * with nearest neighbor sampling. */
+    const float scale_factor = MIN2((float)max_thumb_size / (float)source_w,
+                                    (float)max_thumb_size / (float)source_h);
+    const int dest_w = MAX2((int)(source_w * scale_factor), 1);
+    const int dest_h = MAX2((int)(source_h * scale_factor), 1);
+
+    ImBuf *ibuf = IMB_allocImBuf(dest_w, dest_h, 32, IB_rectfloat);
+
+    /* A single row of source pixels. */
+    Array<Rgba> pixels(source_w);
+
+    /* Loop through destination thumbnail rows, only reading the single source
+     * scanline each of them samples from. */
+    for (int h = 0; h < dest_h; h++) {
+      const int source_y = (int)((float)h / scale_factor) + dw.min.y;
+      file->setFrameBuffer(&pixels[0] - dw.min.x - (ptrdiff_t)source_y * source_w, 1, source_w);
+      file->readPixels(source_y);
+
+      for (int w = 0; w < dest_w; w++) {
+        /* For each destination pixel find single corresponding source pixel. */
+        const int source_x = MIN2((int)((float)w / scale_factor), source_w - 1);
+        float *dest_px = &ibuf->rect_float[(h * dest_w + w) * 4];
+        dest_px[0] = pixels[source_x].r;
+        dest_px[1] = pixels[source_x].g;
+        dest_px[2] = pixels[source_x].b;
+        dest_px[3] = pixels[source_x].a;
+      }
+    }
+
+    /* Rows were filled top-down while #ImBuf stores them bottom-up. */
+    IMB_flipy(ibuf);
+
+    delete file;
+    delete stream;
+
+    return ibuf;
+  }
+  catch (const std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    delete file;
+    delete stream;
+
+    return nullptr;
+  }
+}
+
 void imb_initopenexr(void)
 {
-  int num_threads = BLI_system_thread_count();
+  /* Follow the task scheduler so a user thread count override (`-t`) also
+   * limits the worker threads OpenEXR uses for chunk (de)compression. */
+  int num_threads = BLI_task_scheduler_num_threads();
 
   setGlobalThreadCount(num_threads);
 }
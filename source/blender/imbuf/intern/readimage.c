@@ -27,10 +27,10 @@
 #include "IMB_colormanagement.h"
 #include "IMB_colormanagement_intern.h"
 
-static void imb_handle_alpha(ImBuf *ibuf,
-                             int flags,
-                             char colorspace[IM_MAX_SPACE],
-                             char effective_colorspace[IM_MAX_SPACE])
+void imb_handle_alpha(ImBuf *ibuf,
+                      int flags,
+                      char colorspace[IM_MAX_SPACE],
+                      char effective_colorspace[IM_MAX_SPACE])
 {
   if (colorspace) {
     if (ibuf->rect != NULL && ibuf->rect_float == NULL) {
@@ -13,6 +13,8 @@
 #include "BLI_fileops.h"
 #include "BLI_ghash.h"
 #include "BLI_hash_md5.h"
+#include "BLI_listbase.h"
+#include "BLI_mmap.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_system.h"
@@ -24,17 +26,22 @@
 
 #include "BLO_readfile.h"
 
+#include "IMB_filetype.h"
 #include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
 #include "IMB_metadata.h"
 #include "IMB_thumbs.h"
 
 #include <ctype.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <time.h>
+#ifndef WIN32
+#  include <unistd.h> /* For #close. */
+#endif
 
 #ifdef WIN32
 /* Need to include windows.h so _WIN32_IE is defined. */
@@ -66,10 +73,9 @@
 
 #define URI_MAX (FILE_MAX * 3 + 8)
 
-static bool get_thumb_dir(char *dir, ThumbSize size)
+static bool get_thumb_dir_ex(char *dir, const char *subdir)
 {
   char *s = dir;
-  const char *subdir;
 #ifdef WIN32
   wchar_t dir_16[MAX_PATH];
   /* Yes, applications shouldn't store data there, but so does GIMP :). */
@@ -94,6 +100,16 @@ static bool get_thumb_dir(char *dir, ThumbSize size)
   }
 #  endif
 #endif
+
+  s += BLI_strncpy_rlen(s, subdir, FILE_MAX - (s - dir));
+  (void)s;
+
+  return 1;
+}
+
+static bool get_thumb_dir(char *dir, ThumbSize size)
+{
+  const char *subdir;
   switch (size) {
     case THB_NORMAL:
       subdir = SEP_STR THUMBNAILS SEP_STR "normal" SEP_STR;
@@ -108,10 +124,15 @@ static bool get_thumb_dir(char *dir, ThumbSize size)
       return 0; /* unknown size */
   }
 
-  s += BLI_strncpy_rlen(s, subdir, FILE_MAX - (s - dir));
-  (void)s;
+  return get_thumb_dir_ex(dir, subdir);
+}
 
-  return 1;
+/* Directory for the per-directory packed thumbnail indexes. Not part of the freedesktop
+ * thumbnail spec, so keep it in a clearly Blender-specific sub-directory
+ * (like the "fail/blender" one). */
+static bool get_thumb_index_dir(char *dir)
+{
+  return get_thumb_dir_ex(dir, SEP_STR THUMBNAILS SEP_STR "blender-index" SEP_STR);
 }
 
 #undef THUMBNAILS
@@ -300,6 +321,51 @@ void IMB_thumb_makedirs(void)
   if (get_thumb_dir(tpath, THB_FAIL)) {
     BLI_dir_create_recursive(tpath);
   }
+  if (get_thumb_index_dir(tpath)) {
+    BLI_dir_create_recursive(tpath);
+  }
+}
+
+ImBuf *IMB_thumb_load_image(const char *file_path, size_t max_thumb_size, size_t r_source_size[2])
+{
+  const ImFileType *type = IMB_file_type_from_ftype(IMB_ispic_type(file_path));
+  if (type == NULL) {
+    return NULL;
+  }
+
+  ImBuf *ibuf = NULL;
+  const int flags = IB_rect | IB_metadata;
+  /* Dimensions of the full size image, which can be bigger than the returned buffer
+   * when the loader decodes at a reduced resolution. */
+  size_t width = 0, height = 0;
+
+  if (type->load_filepath_thumbnail) {
+    char effective_colorspace[IM_MAX_SPACE] = "";
+    ibuf = type->load_filepath_thumbnail(
+        file_path, flags, max_thumb_size, effective_colorspace, &width, &height);
+    if (ibuf != NULL) {
+      imb_handle_alpha(ibuf, flags, NULL, effective_colorspace);
+    }
+  }
+  else {
+    /* Skip images of other types if over a certain size. */
+    const size_t file_size = BLI_file_size(file_path);
+    if (file_size != -1 && file_size > THUMB_SIZE_MAX) {
+      return NULL;
+    }
+    ibuf = IMB_loadiffname(file_path, flags, NULL);
+    if (ibuf != NULL) {
+      width = ibuf->x;
+      height = ibuf->y;
+    }
+  }
+
+  if (r_source_size) {
+    r_source_size[0] = width;
+    r_source_size[1] = height;
+  }
+
+  return ibuf;
 }
 
 /* create thumbnail for file and returns new imbuf for thumbnail */
@@ -324,6 +390,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
   short tsize = 128;
   short ex, ey;
   float scaledx, scaledy;
+  size_t source_size[2] = {0, 0};
   BLI_stat_t info;
 
   switch (size) {
@@ -340,15 +407,6 @@ static ImBuf *thumb_create_ex(const char *file_path,
       return NULL; /* unknown size */
   }
 
-  /* exception, skip images over 100mb */
-  if (source == THB_SOURCE_IMAGE) {
-    const size_t file_size = BLI_file_size(file_path);
-    if (file_size != -1 && file_size > THUMB_SIZE_MAX) {
-      // printf("file too big: %d, skipping %s\n", (int)size, file_path);
-      return NULL;
-    }
-  }
-
   if (get_thumb_dir(tdir, size)) {
     BLI_snprintf(tpath, FILE_MAX, "%s%s", tdir, thumb);
     //      thumb[8] = '\0'; /* shorten for tempname, not needed anymore */
@@ -368,7 +426,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
         if (img == NULL) {
           switch (source) {
             case THB_SOURCE_IMAGE:
-              img = IMB_loadiffname(file_path, IB_rect | IB_metadata, NULL);
+              img = IMB_thumb_load_image(file_path, tsize, source_size);
               break;
             case THB_SOURCE_BLEND:
               img = IMB_thumb_load_blend(file_path, blen_group, blen_id);
@@ -385,8 +443,12 @@ static ImBuf *thumb_create_ex(const char *file_path,
           if (BLI_stat(file_path, &info) != -1) {
             BLI_snprintf(mtime, sizeof(mtime), "%ld", (long int)info.st_mtime);
           }
-          BLI_snprintf(cwidth, sizeof(cwidth), "%d", img->x);
-          BLI_snprintf(cheight, sizeof(cheight), "%d", img->y);
+          /* Prefer the source size over the buffer size, the buffer may hold a
+           * reduced-resolution decode of the image (see #IMB_thumb_load_image). */
+          BLI_snprintf(
+              cwidth, sizeof(cwidth), "%zu", source_size[0] ? source_size[0] : (size_t)img->x);
+          BLI_snprintf(
+              cheight, sizeof(cheight), "%zu", source_size[1] ? source_size[1] : (size_t)img->y);
         }
       }
       else if (THB_SOURCE_MOVIE == source) {
@@ -652,6 +714,381 @@ ImBuf *IMB_thumb_manage(const char *org_path, ThumbSize size, ThumbSource source
   return img;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Per-Directory Packed Thumbnail Index
+ *
+ * Browsing a large directory spends most of its time in per-file thumbnail cache
+ * validation: every file gets an MD5 hashed URI, a couple of stat calls and an
+ * open plus PNG decode of its cached thumbnail. The packed index gathers the
+ * (already PNG compressed) thumbnails of one browsed directory into a single
+ * memory-mapped file keyed by source file path and modification time, so a
+ * later visit needs one open for the whole directory and one stat per file.
+ * Files that miss (changed, renamed, never browsed) fall back to the regular
+ * #IMB_thumb_manage code path and are merged back in when the index is closed.
+ *
+ * The index is a pure cache in native byte order: any mismatch in magic,
+ * version or layout simply makes all lookups miss, after which the file is
+ * rewritten through the regular code path.
+ * \{ */
+
+#define THUMB_INDEX_MAGIC "BTIX"
+#define THUMB_INDEX_VERSION 1
+
+typedef struct ThumbIndexHeader {
+  char magic[4]; /* #THUMB_INDEX_MAGIC */
+  uint32_t version;
+  uint32_t entries_num;
+  uint32_t names_size;
+} ThumbIndexHeader;
+
+typedef struct ThumbIndexEntry {
+  /** Modification time of the source file when its thumbnail was created. */
+  int64_t mtime;
+  /** Offset of the null-terminated source file path in the name pool. */
+  uint32_t name_offset;
+  /** PNG encoded thumbnail in the data pool, a zero size marks a file for
+   * which thumbnail creation failed (matching the 'fail' thumbnails). */
+  uint32_t data_offset;
+  uint32_t data_size;
+  uint32_t _pad;
+} ThumbIndexEntry;
+
+/* On-disk layout: header, entry array, name pool, data pool. */
+
+typedef struct ThumbIndexPendingEntry {
+  struct ThumbIndexPendingEntry *next, *prev;
+  char *file_path;
+  int64_t mtime;
+  /** PNG encoded thumbnail, NULL for failed thumbnails. */
+  uchar *png_data;
+  uint32_t png_size;
+} ThumbIndexPendingEntry;
+
+typedef struct ThumbIndex {
+  char index_path[FILE_MAX];
+
+  /** Read side: the existing packed file, all NULL/zero when there is none. */
+  BLI_mmap_file *mmap;
+  const ThumbIndexEntry *entries;
+  uint32_t entries_num;
+  const char *names;
+  const uchar *data;
+  size_t data_size;
+  /** Path in the name pool -> #ThumbIndexEntry, no ownership. */
+  GHash *entries_map;
+
+  /** Write side: entries gathered while the file browser fills its cache,
+   * merged over the packed file when the index is closed. */
+  ListBase pending;
+  SpinLock pending_lock;
+  bool dirty;
+} ThumbIndex;
+
+static void thumb_index_read(ThumbIndex *index)
+{
+  const int fd = BLI_open(index->index_path, O_BINARY | O_RDONLY, 0);
+  if (fd == -1) {
+    return;
+  }
+  const size_t file_size = BLI_file_descriptor_size(fd);
+  BLI_mmap_file *mmap_file = BLI_mmap_open(fd);
+  close(fd);
+  if (mmap_file == NULL) {
+    return;
+  }
+
+  const uchar *mem = BLI_mmap_get_pointer(mmap_file);
+  const ThumbIndexHeader *header = (const ThumbIndexHeader *)mem;
+  if ((file_size < sizeof(ThumbIndexHeader)) ||
+      (memcmp(header->magic, THUMB_INDEX_MAGIC, sizeof(header->magic)) != 0) ||
+      (header->version != THUMB_INDEX_VERSION)) {
+    BLI_mmap_free(mmap_file);
+    return;
+  }
+
+  /* Validate the layout before trusting any offset, 64-bit math to avoid overflow. */
+  const uint64_t data_start = sizeof(ThumbIndexHeader) +
+                              (uint64_t)header->entries_num * sizeof(ThumbIndexEntry) +
+                              header->names_size;
+  if ((data_start > (uint64_t)file_size) ||
+      (header->entries_num != 0 &&
+       (header->names_size == 0 || mem[data_start - 1] != '\0'))) {
+    BLI_mmap_free(mmap_file);
+    return;
+  }
+
+  const ThumbIndexEntry *entries = (const ThumbIndexEntry *)(mem + sizeof(ThumbIndexHeader));
+  const char *names = (const char *)(mem + sizeof(ThumbIndexHeader) +
+                                     (uint64_t)header->entries_num * sizeof(ThumbIndexEntry));
+  const size_t data_size = file_size - data_start;
+  for (uint32_t i = 0; i < header->entries_num; i++) {
+    if ((entries[i].name_offset >= header->names_size) ||
+        ((uint64_t)entries[i].data_offset + entries[i].data_size > data_size)) {
+      BLI_mmap_free(mmap_file);
+      return;
+    }
+  }
+
+  index->mmap = mmap_file;
+  index->entries = entries;
+  index->entries_num = header->entries_num;
+  index->names = names;
+  index->data = mem + data_start;
+  index->data_size = data_size;
+
+  index->entries_map = BLI_ghash_str_new_ex(__func__, index->entries_num);
+  for (uint32_t i = 0; i < index->entries_num; i++) {
+    /* Reinsert so a (malformed) duplicated path cannot assert, the last one wins. */
+    BLI_ghash_reinsert(index->entries_map,
+                       (void *)(names + entries[i].name_offset),
+                       (void *)&entries[i],
+                       NULL,
+                       NULL);
+  }
+}
+
+struct ThumbIndex *IMB_thumb_index_open(const char *dir_path)
+{
+  char uri[URI_MAX];
+  char tdir[FILE_MAX];
+  char hexdigest[33];
+  unsigned char digest[16];
+
+  if (!uri_from_filename(dir_path, uri) || !get_thumb_index_dir(tdir)) {
+    return NULL;
+  }
+
+  ThumbIndex *index = MEM_callocN(sizeof(*index), __func__);
+  BLI_hash_md5_buffer(uri, strlen(uri), digest);
+  hexdigest[0] = '\0';
+  BLI_snprintf(index->index_path,
+               sizeof(index->index_path),
+               "%s%s.index",
+               tdir,
+               BLI_hash_md5_to_hexdigest(digest, hexdigest));
+  BLI_spin_init(&index->pending_lock);
+
+  thumb_index_read(index);
+
+  return index;
+}
+
+bool IMB_thumb_index_lookup(struct ThumbIndex *index, const char *file_path, ImBuf **r_imbuf)
+{
+  BLI_stat_t st;
+
+  *r_imbuf = NULL;
+  if (index == NULL || index->entries_map == NULL) {
+    return false;
+  }
+  if (BLI_stat(file_path, &st) == -1) {
+    return false;
+  }
+
+  const ThumbIndexEntry *entry = BLI_ghash_lookup(index->entries_map, file_path);
+  if (entry == NULL || entry->mtime != (int64_t)st.st_mtime) {
+    return false;
+  }
+  if (entry->data_size == 0) {
+    /* Known failed thumbnail, don't retry creating it (matches the 'fail' thumb logic). */
+    return true;
+  }
+
+  *r_imbuf = IMB_ibImageFromMemory(
+      index->data + entry->data_offset, entry->data_size, IB_rect, NULL, "thumbnail index");
+  /* A failed decode (e.g. IO error on the mapped file) is treated as a plain miss. */
+  return *r_imbuf != NULL;
+}
+
+void IMB_thumb_index_add(struct ThumbIndex *index, const char *file_path, const bool valid)
+{
+  BLI_stat_t st;
+  uchar *png_data = NULL;
+  size_t png_size = 0;
+
+  if (index == NULL) {
+    return;
+  }
+  if (BLI_stat(file_path, &st) == -1) {
+    return;
+  }
+
+  if (valid) {
+    char uri[URI_MAX];
+    char thumb_path[FILE_MAX];
+
+    if (!uri_from_filename(file_path, uri) ||
+        !thumbpath_from_uri(uri, thumb_path, sizeof(thumb_path), THB_LARGE)) {
+      return;
+    }
+    png_data = BLI_file_read_binary_as_mem(thumb_path, 0, &png_size);
+    if (png_data == NULL || png_size == 0 || png_size > UINT32_MAX) {
+      /* No thumbnail file, e.g. when the source lives inside the thumbnail cache itself. */
+      if (png_data) {
+        MEM_freeN(png_data);
+      }
+      return;
+    }
+  }
+
+  ThumbIndexPendingEntry *pending = MEM_callocN(sizeof(*pending), __func__);
+  pending->file_path = BLI_strdup(file_path);
+  pending->mtime = (int64_t)st.st_mtime;
+  pending->png_data = png_data;
+  pending->png_size = (uint32_t)png_size;
+
+  BLI_spin_lock(&index->pending_lock);
+  BLI_addtail(&index->pending, pending);
+  index->dirty = true;
+  BLI_spin_unlock(&index->pending_lock);
+}
+
+typedef struct ThumbIndexWriteRecord {
+  const char *name;
+  int64_t mtime;
+  const uchar *data;
+  uint32_t data_size;
+} ThumbIndexWriteRecord;
+
+static void thumb_index_write(ThumbIndex *index)
+{
+  char tdir[FILE_MAX];
+  char temp[FILE_MAX];
+
+  /* Last add for a path wins, like the regular thumbnail files it replaces older data. */
+  GHash *pending_map = BLI_ghash_str_new(__func__);
+  LISTBASE_FOREACH (ThumbIndexPendingEntry *, pending, &index->pending) {
+    BLI_ghash_reinsert(pending_map, pending->file_path, pending, NULL, NULL);
+  }
+
+  /* Merge: keep old entries that were not replaced, append the gathered ones. Entries of
+   * meanwhile deleted files are only dropped once their source directory is re-browsed,
+   * that is acceptable for a cache. */
+  ThumbIndexWriteRecord *records = MEM_mallocN(
+      sizeof(*records) * ((size_t)index->entries_num + (size_t)BLI_ghash_len(pending_map)),
+      __func__);
+  uint32_t records_num = 0;
+  uint64_t names_size = 0;
+  uint64_t data_size = 0;
+
+  for (uint32_t i = 0; i < index->entries_num; i++) {
+    const ThumbIndexEntry *entry = &index->entries[i];
+    const char *name = index->names + entry->name_offset;
+    if (BLI_ghash_haskey(pending_map, name)) {
+      continue;
+    }
+    records[records_num++] = (ThumbIndexWriteRecord){
+        .name = name,
+        .mtime = entry->mtime,
+        .data = (entry->data_size != 0) ? index->data + entry->data_offset : NULL,
+        .data_size = entry->data_size,
+    };
+  }
+  LISTBASE_FOREACH (ThumbIndexPendingEntry *, pending, &index->pending) {
+    if (BLI_ghash_lookup(pending_map, pending->file_path) != pending) {
+      continue; /* Replaced by a later add. */
+    }
+    records[records_num++] = (ThumbIndexWriteRecord){
+        .name = pending->file_path,
+        .mtime = pending->mtime,
+        .data = pending->png_data,
+        .data_size = pending->png_size,
+    };
+  }
+  for (uint32_t i = 0; i < records_num; i++) {
+    names_size += strlen(records[i].name) + 1;
+    data_size += records[i].data_size;
+  }
+  BLI_ghash_free(pending_map, NULL, NULL);
+
+  if (names_size > UINT32_MAX) {
+    MEM_freeN(records);
+    return;
+  }
+
+  /* Write to a temp file and rename, so concurrent Blender instances never
+   * read a partially written index. */
+  if (get_thumb_index_dir(tdir)) {
+    BLI_dir_create_recursive(tdir);
+  }
+  BLI_snprintf(temp, sizeof(temp), "%s.%d.tmp", index->index_path, abs(getpid()));
+  FILE *file = BLI_fopen(temp, "wb");
+  if (file == NULL) {
+    MEM_freeN(records);
+    return;
+  }
+
+  const ThumbIndexHeader header = {
+      .magic = THUMB_INDEX_MAGIC,
+      .version = THUMB_INDEX_VERSION,
+      .entries_num = records_num,
+      .names_size = (uint32_t)names_size,
+  };
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  uint32_t name_offset = 0;
+  uint64_t data_offset = 0;
+  for (uint32_t i = 0; ok && i < records_num; i++) {
+    const ThumbIndexEntry entry = {
+        .mtime = records[i].mtime,
+        .name_offset = name_offset,
+        .data_offset = (uint32_t)data_offset,
+        .data_size = records[i].data_size,
+    };
+    ok = fwrite(&entry, sizeof(entry), 1, file) == 1;
+    name_offset += strlen(records[i].name) + 1;
+    data_offset += records[i].data_size;
+  }
+  for (uint32_t i = 0; ok && i < records_num; i++) {
+    const size_t len = strlen(records[i].name) + 1;
+    ok = fwrite(records[i].name, 1, len, file) == len;
+  }
+  for (uint32_t i = 0; ok && i < records_num; i++) {
+    if (records[i].data_size != 0) {
+      ok = fwrite(records[i].data, 1, records[i].data_size, file) == records[i].data_size;
+    }
+  }
+  fclose(file);
+  MEM_freeN(records);
+
+  if (ok && data_offset <= UINT32_MAX) {
+#ifndef WIN32
+    chmod(temp, S_IRUSR | S_IWUSR);
+#endif
+    BLI_rename(temp, index->index_path);
+  }
+  else {
+    BLI_delete(temp, false, false);
+  }
+}
+
+void IMB_thumb_index_close(struct ThumbIndex *index)
+{
+  if (index == NULL) {
+    return;
+  }
+  if (index->dirty) {
+    thumb_index_write(index);
+  }
+
+  LISTBASE_FOREACH (ThumbIndexPendingEntry *, pending, &index->pending) {
+    MEM_freeN(pending->file_path);
+    if (pending->png_data) {
+      MEM_freeN(pending->png_data);
+    }
+  }
+  BLI_freelistN(&index->pending);
+  if (index->entries_map) {
+    BLI_ghash_free(index->entries_map, NULL, NULL);
+  }
+  if (index->mmap) {
+    BLI_mmap_free(index->mmap);
+  }
+  BLI_spin_end(&index->pending_lock);
+  MEM_freeN(index);
+}
+
+/** \} */
+
 /* ***** Threading ***** */
 /* Thumbnail handling is not really threadsafe in itself.
  * However, as long as we do not operate on the same file, we shall have no collision.
@@ -451,25 +451,26 @@ class ScanlineProcessor {
 
  public:
   /**
-   * \brief Inner loop of the transformations, processing a full scanline.
+   * \brief Inner loop of the transformations, processing a rectangular tile of the destination.
    */
-  void process(const TransformUserData *user_data, int scanline)
+  void process(const TransformUserData *user_data, const rcti *tile)
   {
-    const int width = user_data->dst->x;
-
-    float uv[2];
-    madd_v2_v2v2fl(uv, user_data->start_uv, user_data->add_y, scanline);
-
-    output.init_pixel_pointer(user_data->dst, 0, scanline);
-    for (int xi = 0; xi < width; xi++) {
-      if (!discarder.should_discard(*user_data, uv)) {
-        typename Sampler::SampleType sample;
-        sampler.sample(user_data->src, uv[0], uv[1], sample);
-        channel_converter.convert_and_store(sample, output);
+    for (int yi = tile->ymin; yi < tile->ymax; yi++) {
+      float uv[2];
+      madd_v2_v2v2fl(uv, user_data->start_uv, user_data->add_y, yi);
+      madd_v2_v2fl(uv, user_data->add_x, tile->xmin);
+
+      output.init_pixel_pointer(user_data->dst, tile->xmin, yi);
+      for (int xi = tile->xmin; xi < tile->xmax; xi++) {
+        if (!discarder.should_discard(*user_data, uv)) {
+          typename Sampler::SampleType sample;
+          sampler.sample(user_data->src, uv[0], uv[1], sample);
+          channel_converter.convert_and_store(sample, output);
+        }
+
+        add_v2_v2(uv, user_data->add_x);
+        output.increase_pixel_pointer();
       }
-
-      add_v2_v2(uv, user_data->add_x);
-      output.increase_pixel_pointer();
     }
   }
 };
@@ -477,33 +478,33 @@ class ScanlineProcessor {
 /**
  * \brief callback function for threaded transformation.
  */
-template<typename Processor> void transform_scanline_function(void *custom_data, int scanline)
+template<typename Processor> void transform_tile_function(void *custom_data, const rcti *tile)
 {
   const TransformUserData *user_data = static_cast<const TransformUserData *>(custom_data);
   Processor processor;
-  processor.process(user_data, scanline);
+  processor.process(user_data, tile);
 }
 
 template<eIMBInterpolationFilterMode Filter,
          typename StorageType,
          int SourceNumChannels,
          int DestinationNumChannels>
-ScanlineThreadFunc get_scanline_function(const eIMBTransformMode mode)
+TileThreadFunc get_tile_function(const eIMBTransformMode mode)
 
 {
   switch (mode) {
     case IMB_TRANSFORM_MODE_REGULAR:
-      return transform_scanline_function<
+      return transform_tile_function<
           ScanlineProcessor<NoDiscard,
                             Sampler<Filter, StorageType, SourceNumChannels, PassThroughUV>,
                             PixelPointer<StorageType, DestinationNumChannels>>>;
     case IMB_TRANSFORM_MODE_CROP_SRC:
-      return transform_scanline_function<
+      return transform_tile_function<
           ScanlineProcessor<CropSource,
                             Sampler<Filter, StorageType, SourceNumChannels, PassThroughUV>,
                             PixelPointer<StorageType, DestinationNumChannels>>>;
     case IMB_TRANSFORM_MODE_WRAP_REPEAT:
-      return transform_scanline_function<
+      return transform_tile_function<
           ScanlineProcessor<NoDiscard,
                             Sampler<Filter, StorageType, SourceNumChannels, WrapRepeatUV>,
                             PixelPointer<StorageType, DestinationNumChannels>>>;
@@ -514,23 +515,22 @@ ScanlineThreadFunc get_scanline_function(const eIMBTransformMode mode)
 }
 
 template<eIMBInterpolationFilterMode Filter>
-ScanlineThreadFunc get_scanline_function(const TransformUserData *user_data,
-                                         const eIMBTransformMode mode)
+TileThreadFunc get_tile_function(const TransformUserData *user_data, const eIMBTransformMode mode)
 {
   const ImBuf *src = user_data->src;
   const ImBuf *dst = user_data->dst;
 
   if (src->channels == 4 && dst->channels == 4) {
-    return get_scanline_function<Filter, float, 4, 4>(mode);
+    return get_tile_function<Filter, float, 4, 4>(mode);
   }
   if (src->channels == 3 && dst->channels == 4) {
-    return get_scanline_function<Filter, float, 3, 4>(mode);
+    return get_tile_function<Filter, float, 3, 4>(mode);
   }
   if (src->channels == 2 && dst->channels == 4) {
-    return get_scanline_function<Filter, float, 2, 4>(mode);
+    return get_tile_function<Filter, float, 2, 4>(mode);
   }
   if (src->channels == 1 && dst->channels == 4) {
-    return get_scanline_function<Filter, float, 1, 4>(mode);
+    return get_tile_function<Filter, float, 1, 4>(mode);
   }
   return nullptr;
 }
@@ -538,18 +538,18 @@ ScanlineThreadFunc get_scanline_function(const TransformUserData *user_data,
 template<eIMBInterpolationFilterMode Filter>
 static void transform_threaded(TransformUserData *user_data, const eIMBTransformMode mode)
 {
-  ScanlineThreadFunc scanline_func = nullptr;
+  TileThreadFunc tile_func = nullptr;
 
   if (user_data->dst->rect_float && user_data->src->rect_float) {
-    scanline_func = get_scanline_function<Filter>(user_data, mode);
+    tile_func = get_tile_function<Filter>(user_data, mode);
   }
   else if (user_data->dst->rect && user_data->src->rect) {
     /* Number of channels is always 4 when using unsigned char buffers (sRGB + straight alpha). */
-    scanline_func = get_scanline_function<Filter, unsigned char, 4, 4>(mode);
+    tile_func = get_tile_function<Filter, unsigned char, 4, 4>(mode);
   }
 
-  if (scanline_func != nullptr) {
-    IMB_processor_apply_threaded_scanlines(user_data->dst->y, scanline_func, user_data);
+  if (tile_func != nullptr) {
+    IMB_processor_apply_threaded_tiles(user_data->dst->x, user_data->dst->y, tile_func, user_data);
   }
 }
 
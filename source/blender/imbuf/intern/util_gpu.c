@@ -243,15 +243,20 @@ GPUTexture *IMB_create_gpu_texture(const char *name,
   const bool compress_as_srgb = (tex_format == GPU_SRGB8_A8);
   bool freebuf = false;
 
-  /* Create Texture. */
-  tex = GPU_texture_create_2d(name, UNPACK2(size), 9999, tex_format, NULL);
-  if (tex == NULL) {
+  /* Create Texture. Try to reduce the resolution instead of failing when the texture does not
+   * fit in the remaining GPU memory. Scenes using many large textures can then still be
+   * navigated at a lower texture resolution instead of displaying broken checkers. */
+  while ((tex = GPU_texture_create_2d(name, UNPACK2(size), 9999, tex_format, NULL)) == NULL) {
+    if (size[0] == 1 && size[1] == 1) {
+      break;
+    }
     size[0] = max_ii(1, size[0] / 2);
     size[1] = max_ii(1, size[1] / 2);
-    tex = GPU_texture_create_2d(name, UNPACK2(size), 9999, tex_format, NULL);
     do_rescale = true;
   }
-  BLI_assert(tex != NULL);
+  if (tex == NULL) {
+    return NULL;
+  }
   void *data = imb_gpu_get_data(ibuf, do_rescale, size, compress_as_srgb, use_premult, &freebuf);
   GPU_texture_update(tex, data_format, data);
 
@@ -115,6 +115,11 @@ bool ABC_mesh_topology_changed(struct CacheReader *reader,
                                float time,
                                const char **err_str);
 
+/* Decode the geometry sample for this time into the reader's sample window, so a later
+ * #ABC_read_mesh for the same time does not block on archive I/O. Safe to call from worker
+ * threads concurrently with reads on the evaluation thread. */
+void ABC_CacheReader_prefetch_sample(struct CacheReader *reader, float time);
+
 void ABC_CacheReader_incref(struct CacheReader *reader);
 void ABC_CacheReader_free(struct CacheReader *reader);
 
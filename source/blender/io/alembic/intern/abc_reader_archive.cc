@@ -13,6 +13,7 @@
 
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_threads.h"
 
 #ifdef WIN32
 #  include "utfconv.h"
@@ -108,16 +109,20 @@ ArchiveReader::ArchiveReader(struct Main *bmain, const char *filename)
   BLI_strncpy(abs_filename, filename, FILE_MAX);
   BLI_path_abs(abs_filename, BKE_main_blendfile_path(bmain));
 
+  /* One stream per thread, so that the Ogawa layer can service concurrent readers. */
+  const int num_streams = BLI_system_thread_count();
+  for (int i = 0; i < num_streams; i++) {
+    std::ifstream *infile = new std::ifstream();
 #ifdef WIN32
-  UTF16_ENCODE(abs_filename);
-  std::wstring wstr(abs_filename_16);
-  m_infile.open(wstr.c_str(), std::ios::in | std::ios::binary);
-  UTF16_UN_ENCODE(abs_filename);
+    UTF16_ENCODE(abs_filename);
+    std::wstring wstr(abs_filename_16);
+    infile->open(wstr.c_str(), std::ios::in | std::ios::binary);
+    UTF16_UN_ENCODE(abs_filename);
 #else
-  m_infile.open(abs_filename, std::ios::in | std::ios::binary);
+    infile->open(abs_filename, std::ios::in | std::ios::binary);
 #endif
-
-  m_streams.push_back(&m_infile);
+    m_streams.push_back(infile);
+  }
 
   m_archive = open_archive(abs_filename, m_streams);
 }
@@ -127,6 +132,13 @@ ArchiveReader::~ArchiveReader()
   for (ArchiveReader *reader : m_readers) {
     delete reader;
   }
+
+  /* Close the archive before the streams it reads from are deleted. */
+  m_archive = IArchive();
+
+  for (std::istream *stream : m_streams) {
+    delete stream;
+  }
 }
 
 bool ArchiveReader::valid() const
@@ -22,7 +22,9 @@ namespace blender::io::alembic {
 
 class ArchiveReader {
   Alembic::Abc::IArchive m_archive;
-  std::ifstream m_infile;
+  /* Ogawa assigns one stream per concurrently reading thread, so the file is opened once per
+   * thread to allow parallel reads. The streams are owned here, as they have to remain valid
+   * for as long as the archive is open. */
   std::vector<std::istream *> m_streams;
 
   std::vector<ArchiveReader *> m_readers;
@@ -611,6 +611,21 @@ template<> bool has_animations(Alembic::AbcGeom::IPolyMeshSchema &schema, Import
   return false;
 }
 
+void AbcMeshReader::prefetchSampleData(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  const chrono_t time = sample_sel.getRequestedTime();
+  if (m_prefetched_samples.contains(time)) {
+    return;
+  }
+
+  try {
+    m_prefetched_samples.add(m_schema.getValue(sample_sel), time);
+  }
+  catch (Alembic::Util::Exception &) {
+    /* Ignore the error here, the sample is read again in #read_mesh which reports it. */
+  }
+}
+
 void AbcMeshReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
@@ -691,19 +706,24 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
                                const char **err_str)
 {
   IPolyMeshSchema::Sample sample;
-  try {
-    sample = m_schema.getValue(sample_sel);
+  if (m_prefetched_samples.pop(sample_sel.getRequestedTime(), &sample)) {
+    /* Sample was already decoded by a prefetch task. */
   }
-  catch (Alembic::Util::Exception &ex) {
-    if (err_str != nullptr) {
-      *err_str = "Error reading mesh sample; more detail on the console";
+  else {
+    try {
+      sample = m_schema.getValue(sample_sel);
+    }
+    catch (Alembic::Util::Exception &ex) {
+      if (err_str != nullptr) {
+        *err_str = "Error reading mesh sample; more detail on the console";
+      }
+      printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
+             m_iobject.getFullName().c_str(),
+             m_schema.getName().c_str(),
+             sample_sel.getRequestedTime(),
+             ex.what());
+      return existing_mesh;
     }
-    printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
-           m_iobject.getFullName().c_str(),
-           m_schema.getName().c_str(),
-           sample_sel.getRequestedTime(),
-           ex.what());
-    return existing_mesh;
   }
 
   const P3fArraySamplePtr &positions = sample.getPositions();
@@ -995,6 +1015,21 @@ bool AbcSubDReader::accepts_object_type(
   return true;
 }
 
+void AbcSubDReader::prefetchSampleData(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  const chrono_t time = sample_sel.getRequestedTime();
+  if (m_prefetched_samples.contains(time)) {
+    return;
+  }
+
+  try {
+    m_prefetched_samples.add(m_schema.getValue(sample_sel), time);
+  }
+  catch (Alembic::Util::Exception &) {
+    /* Ignore the error here, the sample is read again in #read_mesh which reports it. */
+  }
+}
+
 void AbcSubDReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
@@ -1041,19 +1076,24 @@ Mesh *AbcSubDReader::read_mesh(Mesh *existing_mesh,
                                const char **err_str)
 {
   ISubDSchema::Sample sample;
-  try {
-    sample = m_schema.getValue(sample_sel);
+  if (m_prefetched_samples.pop(sample_sel.getRequestedTime(), &sample)) {
+    /* Sample was already decoded by a prefetch task. */
   }
-  catch (Alembic::Util::Exception &ex) {
-    if (err_str != nullptr) {
-      *err_str = "Error reading mesh sample; more detail on the console";
+  else {
+    try {
+      sample = m_schema.getValue(sample_sel);
+    }
+    catch (Alembic::Util::Exception &ex) {
+      if (err_str != nullptr) {
+        *err_str = "Error reading mesh sample; more detail on the console";
+      }
+      printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
+             m_iobject.getFullName().c_str(),
+             m_schema.getName().c_str(),
+             sample_sel.getRequestedTime(),
+             ex.what());
+      return existing_mesh;
     }
-    printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
-           m_iobject.getFullName().c_str(),
-           m_schema.getName().c_str(),
-           sample_sel.getRequestedTime(),
-           ex.what());
-    return existing_mesh;
   }
 
   const P3fArraySamplePtr &positions = sample.getPositions();
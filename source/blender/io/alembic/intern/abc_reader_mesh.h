@@ -8,15 +8,78 @@
 #include "abc_customdata.h"
 #include "abc_reader_object.h"
 
+#include <mutex>
+
 struct Mesh;
 
 namespace blender::io::alembic {
 
+/* Bounded store of geometry samples decoded ahead of their evaluation time, so that playback
+ * does not block on archive I/O. Written by background prefetch tasks and consumed on the
+ * evaluation thread, see #AbcObjectReader::prefetchSampleData. */
+template<typename SampleType> class AbcSampleWindow {
+  static constexpr int num_slots = 4;
+
+  struct Slot {
+    SampleType sample;
+    chrono_t time;
+    bool valid = false;
+  };
+
+  Slot m_slots[num_slots];
+  int m_next_slot = 0;
+  std::mutex m_mutex;
+
+ public:
+  bool contains(chrono_t time)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Slot &slot : m_slots) {
+      if (slot.valid && slot.time == time) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void add(const SampleType &sample, chrono_t time)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Slot &slot : m_slots) {
+      if (slot.valid && slot.time == time) {
+        return;
+      }
+    }
+    Slot &slot = m_slots[m_next_slot];
+    m_next_slot = (m_next_slot + 1) % num_slots;
+    slot.sample = sample;
+    slot.time = time;
+    slot.valid = true;
+  }
+
+  bool pop(chrono_t time, SampleType *r_sample)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Slot &slot : m_slots) {
+      if (slot.valid && slot.time == time) {
+        *r_sample = slot.sample;
+        slot.sample = SampleType();
+        slot.valid = false;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
 class AbcMeshReader final : public AbcObjectReader {
   Alembic::AbcGeom::IPolyMeshSchema m_schema;
 
   CDStreamConfig m_mesh_data;
 
+  /* Samples read ahead of time by #prefetchSampleData, consumed by #read_mesh. */
+  AbcSampleWindow<Alembic::AbcGeom::IPolyMeshSchema::Sample> m_prefetched_samples;
+
  public:
   AbcMeshReader(const Alembic::Abc::IObject &object, ImportSettings &settings);
 
@@ -24,6 +87,7 @@ class AbcMeshReader final : public AbcObjectReader {
   bool accepts_object_type(const Alembic::AbcCoreAbstract::ObjectHeader &alembic_header,
                            const Object *const ob,
                            const char **err_str) const override;
+  void prefetchSampleData(const Alembic::Abc::ISampleSelector &sample_sel) override;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
 
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
@@ -51,6 +115,9 @@ class AbcSubDReader final : public AbcObjectReader {
 
   CDStreamConfig m_mesh_data;
 
+  /* Samples read ahead of time by #prefetchSampleData, consumed by #read_mesh. */
+  AbcSampleWindow<Alembic::AbcGeom::ISubDSchema::Sample> m_prefetched_samples;
+
  public:
   AbcSubDReader(const Alembic::Abc::IObject &object, ImportSettings &settings);
 
@@ -58,6 +125,7 @@ class AbcSubDReader final : public AbcObjectReader {
   bool accepts_object_type(const Alembic::AbcCoreAbstract::ObjectHeader &alembic_header,
                            const Object *const ob,
                            const char **err_str) const override;
+  void prefetchSampleData(const Alembic::Abc::ISampleSelector &sample_sel) override;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          const Alembic::Abc::ISampleSelector &sample_sel,
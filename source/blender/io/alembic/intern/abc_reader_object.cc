@@ -130,6 +130,11 @@ Imath::M44d get_matrix(const IXformSchema &schema, const float time)
   return s0.getMatrix();
 }
 
+void AbcObjectReader::prefetchSampleData(const Alembic::Abc::ISampleSelector & /*sample_sel*/)
+{
+  /* Readers of cheap object types have nothing worth reading ahead of time. */
+}
+
 struct Mesh *AbcObjectReader::read_mesh(struct Mesh *existing_mesh,
                                         const Alembic::Abc::ISampleSelector &UNUSED(sample_sel),
                                         int UNUSED(read_flag),
@@ -288,10 +293,11 @@ void AbcObjectReader::incref()
   m_refcount++;
 }
 
-void AbcObjectReader::decref()
+int AbcObjectReader::decref()
 {
-  m_refcount--;
-  BLI_assert(m_refcount >= 0);
+  const int refcount = --m_refcount;
+  BLI_assert(refcount >= 0);
+  return refcount;
 }
 
 }  // namespace blender::io::alembic
@@ -10,6 +10,8 @@
 
 #include "DNA_ID.h"
 
+#include <atomic>
+
 struct CacheFile;
 struct Main;
 struct Mesh;
@@ -83,8 +85,9 @@ class AbcObjectReader {
   chrono_t m_max_time;
 
   /* Use reference counting since the same reader may be used by multiple
-   * modifiers and/or constraints. */
-  int m_refcount;
+   * modifiers and/or constraints. Atomic since background prefetch tasks drop their reference
+   * from worker threads, see #BKE_cachefile_prefetch. */
+  std::atomic<int> m_refcount;
 
   bool m_inherits_xform;
 
@@ -131,6 +134,15 @@ class AbcObjectReader {
                                    const Object *const ob,
                                    const char **err_str) const = 0;
 
+  /**
+   * Read the heavy geometry samples this reader will need into memory ahead of
+   * #readObjectData, which can then consume them without hitting the archive again.
+   *
+   * Called from multiple threads at once during import, so implementations may only touch
+   * Alembic data and their own members, never `bmain` or other Blender ID's.
+   */
+  virtual void prefetchSampleData(const Alembic::Abc::ISampleSelector &sample_sel);
+
   virtual void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) = 0;
 
   virtual struct Mesh *read_mesh(struct Mesh *mesh,
@@ -152,7 +164,9 @@ class AbcObjectReader {
 
   int refcount() const;
   void incref();
-  void decref();
+  /** Returns the new reference count, so "decref and delete when unused" is a single atomic
+   * operation for callers. */
+  int decref();
 
   void read_matrix(float r_mat[4][4], float time, float scale, bool &is_constant);
 
@@ -50,6 +50,7 @@
 #include "BLI_math.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 
 #include "WM_api.h"
 #include "WM_types.h"
@@ -435,6 +436,18 @@ struct ImportJobData {
   bool is_background_job;
 };
 
+static void import_prefetch_sample_fn(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict /*tls*/)
+{
+  ImportJobData *data = static_cast<ImportJobData *>(userdata);
+  AbcObjectReader *reader = data->readers[i];
+
+  if (reader->valid()) {
+    reader->prefetchSampleData(ISampleSelector(0.0));
+  }
+}
+
 static void import_startjob(void *user_data, short *stop, short *do_update, float *progress)
 {
   SCOPE_TIMER("Alembic import, objects reading and creation");
@@ -488,6 +501,25 @@ static void import_startjob(void *user_data, short *stop, short *do_update, floa
   *data->do_update = true;
   *data->progress = 0.1f;
 
+  /* Read the heavy geometry samples in parallel, ahead of the serial object creation loop
+   * below. Creating the ID's has to stay on this thread since `bmain` is not thread safe, but
+   * the Ogawa layer services concurrent readers (the archive is opened with one stream per
+   * thread, see #ArchiveReader). */
+  if (!data->readers.empty()) {
+    TaskParallelSettings parallel_settings;
+    BLI_parallel_range_settings_defaults(&parallel_settings);
+    BLI_task_parallel_range(0,
+                            int(data->readers.size()),
+                            data,
+                            import_prefetch_sample_fn,
+                            &parallel_settings);
+  }
+
+  if (G.is_break) {
+    data->was_cancelled = true;
+    return;
+  }
+
   /* Create objects and set scene frame range. */
 
   const float size = static_cast<float>(data->readers.size());
@@ -626,9 +658,8 @@ static void import_endjob(void *user_data)
 
   for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
     AbcObjectReader *reader = *iter;
-    reader->decref();
 
-    if (reader->refcount() == 0) {
+    if (reader->decref() == 0) {
       delete reader;
     }
   }
@@ -817,13 +848,23 @@ bool ABC_mesh_topology_changed(
 void ABC_CacheReader_free(CacheReader *reader)
 {
   AbcObjectReader *abc_reader = reinterpret_cast<AbcObjectReader *>(reader);
-  abc_reader->decref();
 
-  if (abc_reader->refcount() == 0) {
+  if (abc_reader->decref() == 0) {
     delete abc_reader;
   }
 }
 
+void ABC_CacheReader_prefetch_sample(CacheReader *reader, const float time)
+{
+  AbcObjectReader *abc_reader = reinterpret_cast<AbcObjectReader *>(reader);
+
+  if (!abc_reader->iobject().valid() || !abc_reader->valid()) {
+    return;
+  }
+
+  abc_reader->prefetchSampleData(sample_selector_for_time(time));
+}
+
 void ABC_CacheReader_incref(CacheReader *reader)
 {
   AbcObjectReader *abc_reader = reinterpret_cast<AbcObjectReader *>(reader);
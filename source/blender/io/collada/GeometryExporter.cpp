@@ -15,6 +15,7 @@
 
 #include "DNA_meshdata_types.h"
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_customdata.h"
@@ -41,21 +42,24 @@ void GeometryExporter::exportGeom()
 void GeometryExporter::operator()(Object *ob)
 {
   bool use_instantiation = this->export_settings.get_use_object_instantiation();
+
+  std::string geom_id = get_geometry_id(ob, use_instantiation);
+
+  /* Skip if linked geometry was already exported from another reference, before evaluating and
+   * copying the mesh: instanced props can reference the same mesh hundreds of times. */
+  if (use_instantiation && exportedGeometry.find(geom_id) != exportedGeometry.end()) {
+    return;
+  }
+
   Mesh *me = bc_get_mesh_copy(blender_context,
                               ob,
                               this->export_settings.get_export_mesh_type(),
                               this->export_settings.get_apply_modifiers(),
                               this->export_settings.get_triangulate());
 
-  std::string geom_id = get_geometry_id(ob, use_instantiation);
   std::vector<Normal> nor;
   std::vector<BCPolygonNormalsIndices> norind;
 
-  /* Skip if linked geometry was already exported from another reference */
-  if (use_instantiation && exportedGeometry.find(geom_id) != exportedGeometry.end()) {
-    return;
-  }
-
   std::string geom_name = (use_instantiation) ? id_name(ob->data) : id_name(ob);
   geom_name = encode_xml(geom_name);
 
@@ -628,18 +632,49 @@ void GeometryExporter::create_normals(std::vector<Normal> &normals,
     use_custom_normals = true;
   }
 
+  /* Compute all normals in parallel first; only the index deduplication below has to stay
+   * serial. */
+  std::vector<Normal> loop_normals(me->totloop);
+  std::vector<Normal> flat_normals(me->totpoly);
+  std::vector<char> poly_use_vertex_normals(me->totpoly);
+  blender::threading::parallel_for(
+      blender::IndexRange(me->totpoly), 512, [&](const blender::IndexRange range) {
+        for (const int poly_index : range) {
+          MPoly *mpoly = &me->mpoly[poly_index];
+          const bool use_vertex_normals = use_custom_normals || mpoly->flag & ME_SMOOTH;
+          poly_use_vertex_normals[poly_index] = use_vertex_normals;
+
+          if (!use_vertex_normals) {
+            /* For flat faces use face normal as vertex normal: */
+
+            float vector[3];
+            BKE_mesh_calc_poly_normal(mpoly, mloops + mpoly->loopstart, verts, vector);
+            flat_normals[poly_index] = {vector[0], vector[1], vector[2]};
+            continue;
+          }
+
+          for (int loop_index = 0; loop_index < mpoly->totloop; loop_index++) {
+            unsigned int loop_idx = mpoly->loopstart + loop_index;
+            float normalized[3];
+
+            if (use_custom_normals) {
+              normalize_v3_v3(normalized, lnors[loop_idx]);
+            }
+            else {
+              copy_v3_v3(normalized, vert_normals[mloops[loop_idx].v]);
+              normalize_v3(normalized);
+            }
+            loop_normals[loop_idx] = {normalized[0], normalized[1], normalized[2]};
+          }
+        }
+      });
+
   for (int poly_index = 0; poly_index < me->totpoly; poly_index++) {
     MPoly *mpoly = &me->mpoly[poly_index];
-    bool use_vertex_normals = use_custom_normals || mpoly->flag & ME_SMOOTH;
+    bool use_vertex_normals = poly_use_vertex_normals[poly_index];
 
     if (!use_vertex_normals) {
-      /* For flat faces use face normal as vertex normal: */
-
-      float vector[3];
-      BKE_mesh_calc_poly_normal(mpoly, mloops + mpoly->loopstart, verts, vector);
-
-      Normal n = {vector[0], vector[1], vector[2]};
-      normals.push_back(n);
+      normals.push_back(flat_normals[poly_index]);
       last_normal_index++;
     }
 
@@ -647,16 +682,7 @@ void GeometryExporter::create_normals(std::vector<Normal> &normals,
     for (int loop_index = 0; loop_index < mpoly->totloop; loop_index++) {
       unsigned int loop_idx = mpoly->loopstart + loop_index;
       if (use_vertex_normals) {
-        float normalized[3];
-
-        if (use_custom_normals) {
-          normalize_v3_v3(normalized, lnors[loop_idx]);
-        }
-        else {
-          copy_v3_v3(normalized, vert_normals[mloops[loop_index].v]);
-          normalize_v3(normalized);
-        }
-        Normal n = {normalized[0], normalized[1], normalized[2]};
+        const Normal &n = loop_normals[loop_idx];
 
         if (shared_normal_indices.find(n) != shared_normal_indices.end()) {
           poly_indices.add_index(shared_normal_indices[n]);
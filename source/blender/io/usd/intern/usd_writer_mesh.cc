@@ -9,6 +9,7 @@
 
 #include "BLI_assert.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.h"
 #include "BKE_customdata.h"
@@ -121,11 +122,17 @@ void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_
     pxr::UsdGeomPrimvar uv_coords_primvar = usd_mesh.CreatePrimvar(
         primvar_name, pxr::SdfValueTypeNames->TexCoord2fArray, pxr::UsdGeomTokens->faceVarying);
 
-    MLoopUV *mloopuv = static_cast<MLoopUV *>(layer->data);
+    const MLoopUV *mloopuv = static_cast<const MLoopUV *>(layer->data);
     pxr::VtArray<pxr::GfVec2f> uv_coords;
-    for (int loop_idx = 0; loop_idx < mesh->totloop; loop_idx++) {
-      uv_coords.push_back(pxr::GfVec2f(mloopuv[loop_idx].uv));
-    }
+    uv_coords.resize(mesh->totloop);
+    /* Take the pointer before the parallel loop, so the copy-on-write detach of the freshly
+     * created array happens once, on this thread. */
+    pxr::GfVec2f *uv_coords_data = uv_coords.data();
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int64_t loop_idx : range) {
+        uv_coords_data[loop_idx] = pxr::GfVec2f(mloopuv[loop_idx].uv);
+      }
+    });
 
     if (!uv_coords_primvar.HasValue()) {
       uv_coords_primvar.Set(uv_coords, pxr::UsdTimeCode::Default());
@@ -243,12 +250,15 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
 
 static void get_vertices(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  usd_mesh_data.points.reserve(mesh->totvert);
+  usd_mesh_data.points.resize(mesh->totvert);
+  pxr::GfVec3f *points_data = usd_mesh_data.points.data();
 
   const MVert *verts = mesh->mvert;
-  for (int i = 0; i < mesh->totvert; ++i) {
-    usd_mesh_data.points.push_back(pxr::GfVec3f(verts[i].co));
-  }
+  threading::parallel_for(IndexRange(mesh->totvert), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      points_data[i] = pxr::GfVec3f(verts[i].co);
+    }
+  });
 }
 
 static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
@@ -257,20 +267,29 @@ static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
    * assignments. */
   bool construct_face_groups = mesh->totcol > 1;
 
-  usd_mesh_data.face_vertex_counts.reserve(mesh->totpoly);
-  usd_mesh_data.face_indices.reserve(mesh->totloop);
-
-  MLoop *mloop = mesh->mloop;
-  MPoly *mpoly = mesh->mpoly;
-  for (int i = 0; i < mesh->totpoly; ++i, ++mpoly) {
-    MLoop *loop = mloop + mpoly->loopstart;
-    usd_mesh_data.face_vertex_counts.push_back(mpoly->totloop);
-    for (int j = 0; j < mpoly->totloop; ++j, ++loop) {
-      usd_mesh_data.face_indices.push_back(loop->v);
+  usd_mesh_data.face_vertex_counts.resize(mesh->totpoly);
+  usd_mesh_data.face_indices.resize(mesh->totloop);
+  int *face_vertex_counts_data = usd_mesh_data.face_vertex_counts.data();
+  int *face_indices_data = usd_mesh_data.face_indices.data();
+
+  const MLoop *mloop = mesh->mloop;
+  const MPoly *mpoly = mesh->mpoly;
+  /* Each polygon owns the `[loopstart, loopstart + totloop)` range of the loop arrays, so the
+   * polygons can be converted independently. */
+  threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const MPoly *poly = &mpoly[i];
+      const MLoop *loop = mloop + poly->loopstart;
+      face_vertex_counts_data[i] = poly->totloop;
+      for (int j = 0; j < poly->totloop; ++j, ++loop) {
+        face_indices_data[poly->loopstart + j] = loop->v;
+      }
     }
+  });
 
-    if (construct_face_groups) {
-      usd_mesh_data.face_groups[mpoly->mat_nr].push_back(i);
+  if (construct_face_groups) {
+    for (int i = 0; i < mesh->totpoly; ++i) {
+      usd_mesh_data.face_groups[mpoly[i].mat_nr].push_back(i);
     }
   }
 }
@@ -394,36 +413,44 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh usd_
   const float(*lnors)[3] = static_cast<float(*)[3]>(CustomData_get_layer(&mesh->ldata, CD_NORMAL));
 
   pxr::VtVec3fArray loop_normals;
-  loop_normals.reserve(mesh->totloop);
+  loop_normals.resize(mesh->totloop);
+  pxr::GfVec3f *loop_normals_data = loop_normals.data();
 
   if (lnors != nullptr) {
     /* Export custom loop normals. */
-    for (int loop_idx = 0, totloop = mesh->totloop; loop_idx < totloop; ++loop_idx) {
-      loop_normals.push_back(pxr::GfVec3f(lnors[loop_idx]));
-    }
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int64_t loop_idx : range) {
+        loop_normals_data[loop_idx] = pxr::GfVec3f(lnors[loop_idx]);
+      }
+    });
   }
   else {
-    /* Compute the loop normals based on the 'smooth' flag. */
+    /* Compute the loop normals based on the 'smooth' flag. Ensure the normal caches on the main
+     * thread, the lookups inside the parallel loop then only read them. */
     const float(*vert_normals)[3] = BKE_mesh_vertex_normals_ensure(mesh);
     const float(*face_normals)[3] = BKE_mesh_poly_normals_ensure(mesh);
-    MPoly *mpoly = mesh->mpoly;
-    for (int poly_idx = 0, totpoly = mesh->totpoly; poly_idx < totpoly; ++poly_idx, ++mpoly) {
-      MLoop *mloop = mesh->mloop + mpoly->loopstart;
-
-      if ((mpoly->flag & ME_SMOOTH) == 0) {
-        /* Flat shaded, use common normal for all verts. */
-        pxr::GfVec3f pxr_normal(face_normals[poly_idx]);
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx) {
-          loop_normals.push_back(pxr_normal);
+    const MPoly *mpoly = mesh->mpoly;
+    threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+      for (const int64_t poly_idx : range) {
+        const MPoly *poly = &mpoly[poly_idx];
+        pxr::GfVec3f *poly_normals = loop_normals_data + poly->loopstart;
+
+        if ((poly->flag & ME_SMOOTH) == 0) {
+          /* Flat shaded, use common normal for all verts. */
+          pxr::GfVec3f pxr_normal(face_normals[poly_idx]);
+          for (int loop_idx = 0; loop_idx < poly->totloop; ++loop_idx) {
+            poly_normals[loop_idx] = pxr_normal;
+          }
         }
-      }
-      else {
-        /* Smooth shaded, use individual vert normals. */
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx, ++mloop) {
-          loop_normals.push_back(pxr::GfVec3f(vert_normals[mloop->v]));
+        else {
+          /* Smooth shaded, use individual vert normals. */
+          const MLoop *mloop = mesh->mloop + poly->loopstart;
+          for (int loop_idx = 0; loop_idx < poly->totloop; ++loop_idx, ++mloop) {
+            poly_normals[loop_idx] = pxr::GfVec3f(vert_normals[mloop->v]);
+          }
         }
       }
-    }
+    });
   }
 
   pxr::UsdAttribute attr_normals = usd_mesh.CreateNormalsAttr(pxr::VtValue(), true);
@@ -449,11 +476,14 @@ void USDGenericMeshWriter::write_surface_velocity(const Mesh *mesh, pxr::UsdGeom
 
   /* Export per-vertex velocity vectors. */
   pxr::VtVec3fArray usd_velocities;
-  usd_velocities.reserve(mesh->totvert);
+  usd_velocities.resize(mesh->totvert);
+  pxr::GfVec3f *usd_velocities_data = usd_velocities.data();
 
-  for (int vertex_idx = 0, totvert = mesh->totvert; vertex_idx < totvert; ++vertex_idx) {
-    usd_velocities.push_back(pxr::GfVec3f(velocities[vertex_idx]));
-  }
+  threading::parallel_for(IndexRange(mesh->totvert), 4096, [&](const IndexRange range) {
+    for (const int64_t vertex_idx : range) {
+      usd_velocities_data[vertex_idx] = pxr::GfVec3f(velocities[vertex_idx]);
+    }
+  });
 
   pxr::UsdTimeCode timecode = get_export_time_code();
   usd_mesh.CreateVelocitiesAttr().Set(usd_velocities, timecode);
@@ -76,8 +76,22 @@ struct OBJExportParams {
   bool smooth_groups_bitflags;
 };
 
+struct OBJImportParams {
+  /** Full path to the source .OBJ file. */
+  char filepath[FILE_MAX];
+
+  /* Geometry Transform options. */
+  eTransformAxisForward forward_axis;
+  eTransformAxisUp up_axis;
+
+  /** Check imported mesh data for degenerate geometry (slower for large files). */
+  bool validate_meshes;
+};
+
 void OBJ_export(bContext *C, const struct OBJExportParams *export_params);
 
+void OBJ_import(bContext *C, const struct OBJImportParams *import_params);
+
 #ifdef __cplusplus
 }
 #endif
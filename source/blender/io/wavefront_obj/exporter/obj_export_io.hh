@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <system_error>
@@ -263,6 +265,67 @@ constexpr FormattingSyntax syntax_elem_to_formatting(const eMTLSyntaxElement key
 #  pragma GCC diagnostic pop
 #endif
 
+/**
+ * Append \a value formatted as `%.*f` to \a p, without going through `snprintf`. Exporting large
+ * meshes is dominated by float-to-string conversion, and `snprintf` re-parses the format string
+ * and does a correctly-rounded arbitrary-precision conversion for every value. Since OBJ only
+ * ever needs a fixed, small number of decimals, the value can instead be scaled to an integer and
+ * its digits emitted directly.
+ *
+ * \return the advanced write pointer, or null when the value is not covered by the fast path
+ * (non-finite, or too large for the scaled value to be exact in an `int64_t`); the caller then
+ * falls back to `snprintf`. Writes at most 25 characters.
+ *
+ * \note For `float` origin values the scaled `double` product is exact (24 significand bits plus
+ * at most 14 bits for the power of ten stay well under 53 bits), so together with the
+ * half-to-even tie rounding below the output matches `snprintf` exactly. For `double` origin
+ * values a near-tie can differ from `snprintf` in the last digit.
+ */
+inline char *append_float_fast(char *p, const double value, const int precision)
+{
+  constexpr int64_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+  if (precision < 0 || precision > 6 || !std::isfinite(value)) {
+    return nullptr;
+  }
+  const double scaled_d = std::abs(value) * double(pow10[precision]);
+  if (scaled_d >= 9007199254740992.0 /* 2^53: larger values lose integer precision. */) {
+    return nullptr;
+  }
+  /* Round half to even, like `snprintf` does for decimal ties. Ties are common because binary
+   * float values are dyadic rationals: their decimal expansion often ends in ...5 exactly one
+   * digit past the requested precision. */
+  const double floor_d = std::floor(scaled_d);
+  const double frac = scaled_d - floor_d;
+  int64_t scaled = int64_t(floor_d);
+  if (frac > 0.5 || (frac == 0.5 && (scaled & 1))) {
+    scaled += 1;
+  }
+  int64_t int_part = scaled / pow10[precision];
+  int64_t frac_part = scaled % pow10[precision];
+
+  if (std::signbit(value)) {
+    *p++ = '-';
+  }
+  char digits[17];
+  int num_digits = 0;
+  do {
+    digits[num_digits++] = '0' + char(int_part % 10);
+    int_part /= 10;
+  } while (int_part != 0);
+  while (num_digits != 0) {
+    *p++ = digits[--num_digits];
+  }
+  if (precision != 0) {
+    *p++ = '.';
+    for (int i = precision - 1; i >= 0; i--) {
+      p[i] = '0' + char(frac_part % 10);
+      frac_part /= 10;
+    }
+    p += precision;
+  }
+  return p;
+}
+
 /**
  * File format and syntax agnostic file buffer writer.
  * All writes are done into an internal chunked memory buffer
@@ -365,6 +428,55 @@ class FormatHandler : NonCopyable, NonMovable {
     }
   }
 
+  /**
+   * Fast path for float-only syntax elements (`v`, `vt`, `vn`, ...): emit the format string's
+   * literal parts as-is and the values via #append_float_fast, skipping `snprintf` entirely.
+   * Formats into a local buffer first so nothing is emitted when a value needs the fallback.
+   *
+   * \return false when the format contains a non-`%f` conversion or a value is outside the fast
+   * path's range; the caller must then use the `snprintf` code path.
+   */
+  template<typename... T> bool write_float_impl(const char *fmt, T &&...args)
+  {
+    char buf[256];
+    char *p = buf;
+    const double values[] = {double(args)...};
+    int value_idx = 0;
+    for (const char *f = fmt; *f != '\0';) {
+      /* Each iteration appends at most one literal character or one conversion of at most 25
+       * characters; bail out to the `snprintf` path for formats too long for the local buffer. */
+      if (p - buf >= int64_t(sizeof(buf)) - 32) {
+        return false;
+      }
+      if (*f != '%') {
+        *p++ = *f++;
+        continue;
+      }
+      f++;
+      int precision = 6;
+      if (*f == '.') {
+        f++;
+        precision = 0;
+        while (*f >= '0' && *f <= '9') {
+          precision = precision * 10 + (*f++ - '0');
+        }
+      }
+      if (*f != 'f') {
+        return false;
+      }
+      f++;
+      p = append_float_fast(p, values[value_idx++], precision);
+      if (p == nullptr) {
+        return false;
+      }
+    }
+    const size_t len = p - buf;
+    ensure_space(len);
+    VectorChar &bb = blocks_.back();
+    bb.insert(bb.end(), buf, buf + len);
+    return true;
+  }
+
   template<typename... T> constexpr void write_impl(const char *fmt, T &&...args)
   {
     if constexpr (sizeof...(T) == 0) {
@@ -375,6 +487,12 @@ class FormatHandler : NonCopyable, NonMovable {
       bb.insert(bb.end(), fmt, fmt + len);
     }
     else {
+      if constexpr (is_type_float<T...>) {
+        /* All-float syntax elements can usually be formatted without `snprintf`. */
+        if (write_float_impl(fmt, std::forward<T>(args)...)) {
+          return;
+        }
+      }
       /* Format into a local buffer. */
       char buf[write_local_buffer_size];
       int needed = std::snprintf(
@@ -0,0 +1,431 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup obj
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_span.hh"
+#include "BLI_task.hh"
+
+#include "MEM_guardedalloc.h"
+
+#include "obj_import_file_reader.hh"
+
+namespace blender::io::obj {
+
+/* -------------------------------------------------------------------- */
+/** \name Per-chunk parse results
+ *
+ * Chunks are parsed independently, so indices cannot be fully resolved while parsing: relative
+ * (negative) indices depend on how many elements precede the face in the whole file, and the
+ * smooth state and object grouping of the first faces of a chunk depend on the previous chunks.
+ * The raw values are therefore kept per chunk and resolved in a cheap serial merge pass.
+ * \{ */
+
+struct ChunkRawFace {
+  /** Index of the first corner in #ChunkData::corners. */
+  int start_corner_index;
+  int corner_count;
+  /** Elements parsed in this chunk before this face, to resolve relative indices on merge. */
+  int verts_before;
+  int uvs_before;
+  int normals_before;
+  /** 0 = flat, 1 = smooth, -1 = no `s` seen yet in this chunk: inherit from previous chunk. */
+  int smooth;
+};
+
+struct ChunkObjectMarker {
+  /** Index into #ChunkData::faces of the first face after this `o` keyword. */
+  int face_index;
+  std::string name;
+};
+
+struct ChunkData {
+  Vector<float3> vertices;
+  Vector<float2> uv_coords;
+  Vector<float3> normals;
+  /** Raw values: 1-based or negative as written in the file, 0 when absent. */
+  Vector<OBJFaceCorner> corners;
+  Vector<ChunkRawFace> faces;
+  Vector<ChunkObjectMarker> object_markers;
+  /** Last `s` state in this chunk, -1 when the chunk contains no `s` keyword. */
+  int final_smooth = -1;
+};
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Low level text parsing
+ * \{ */
+
+static bool is_blank(const char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+static const char *skip_blanks(const char *p, const char *end)
+{
+  while (p < end && is_blank(*p)) {
+    p++;
+  }
+  return p;
+}
+
+static const char *parse_int(const char *p, const char *end, int &r_value)
+{
+  p = skip_blanks(p, end);
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    p++;
+  }
+  int value = 0;
+  bool any_digits = false;
+  while (p < end && *p >= '0' && *p <= '9') {
+    value = value * 10 + (*p - '0');
+    any_digits = true;
+    p++;
+  }
+  if (any_digits) {
+    r_value = negative ? -value : value;
+  }
+  return p;
+}
+
+/**
+ * Hand rolled float parsing: gigabyte sized files spend most of their time here and `strtod`
+ * needs a NUL terminated string, a locale lookup and arbitrary precision handling that plain
+ * coordinate data never requires. Accurate to within a few ULP which is well below the precision
+ * the values were written with.
+ */
+static const char *parse_float(const char *p, const char *end, float &r_value)
+{
+  p = skip_blanks(p, end);
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    p++;
+  }
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool any_digits = false;
+  while (p < end && *p >= '0' && *p <= '9') {
+    if (mantissa < (UINT64_MAX - 9) / 10) {
+      mantissa = mantissa * 10 + uint64_t(*p - '0');
+    }
+    else {
+      exponent++;
+    }
+    any_digits = true;
+    p++;
+  }
+  if (p < end && *p == '.') {
+    p++;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (mantissa < (UINT64_MAX - 9) / 10) {
+        mantissa = mantissa * 10 + uint64_t(*p - '0');
+        exponent--;
+      }
+      any_digits = true;
+      p++;
+    }
+  }
+  if (!any_digits) {
+    return p;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    int exp_part = 0;
+    p = parse_int(p + 1, end, exp_part);
+    exponent += exp_part;
+  }
+  /* Exponents of coordinate data are almost always in this range, avoid `pow` for them. */
+  static const double pow10_table[] = {1.0e-8,
+                                       1.0e-7,
+                                       1.0e-6,
+                                       1.0e-5,
+                                       1.0e-4,
+                                       1.0e-3,
+                                       1.0e-2,
+                                       1.0e-1,
+                                       1.0,
+                                       1.0e1,
+                                       1.0e2,
+                                       1.0e3,
+                                       1.0e4,
+                                       1.0e5,
+                                       1.0e6,
+                                       1.0e7,
+                                       1.0e8};
+  double value = double(mantissa);
+  if (exponent >= -8 && exponent <= 8) {
+    value *= pow10_table[exponent + 8];
+  }
+  else {
+    value *= std::pow(10.0, double(exponent));
+  }
+  r_value = float(negative ? -value : value);
+  return p;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Line and chunk parsing
+ * \{ */
+
+static void parse_face_line(const char *p, const char *end, const int smooth, ChunkData &r_chunk)
+{
+  const int start_corner_index = int(r_chunk.corners.size());
+  while (true) {
+    p = skip_blanks(p, end);
+    if (p >= end) {
+      break;
+    }
+    OBJFaceCorner corner = {0, 0, 0};
+    p = parse_int(p, end, corner.vert_index);
+    if (p < end && *p == '/') {
+      p++;
+      if (p < end && *p != '/') {
+        p = parse_int(p, end, corner.uv_index);
+      }
+      if (p < end && *p == '/') {
+        p = parse_int(p + 1, end, corner.normal_index);
+      }
+    }
+    /* Always advance to the next blank, so a malformed token cannot stall the loop. */
+    while (p < end && !is_blank(*p)) {
+      p++;
+    }
+    r_chunk.corners.append(corner);
+  }
+
+  const int corner_count = int(r_chunk.corners.size()) - start_corner_index;
+  if (corner_count < 3) {
+    /* Degenerate face, drop its corners again. */
+    r_chunk.corners.resize(start_corner_index);
+    return;
+  }
+  ChunkRawFace face;
+  face.start_corner_index = start_corner_index;
+  face.corner_count = corner_count;
+  face.verts_before = int(r_chunk.vertices.size());
+  face.uvs_before = int(r_chunk.uv_coords.size());
+  face.normals_before = int(r_chunk.normals.size());
+  face.smooth = smooth;
+  r_chunk.faces.append(face);
+}
+
+static void parse_line(const char *p, const char *end, ChunkData &r_chunk)
+{
+  p = skip_blanks(p, end);
+  if (end - p < 2 || *p == '#') {
+    return;
+  }
+  if (p[0] == 'v' && is_blank(p[1])) {
+    float3 vertex(0.0f);
+    p = parse_float(p + 2, end, vertex.x);
+    p = parse_float(p, end, vertex.y);
+    parse_float(p, end, vertex.z);
+    r_chunk.vertices.append(vertex);
+  }
+  else if (p[0] == 'v' && p[1] == 't' && end - p > 2 && is_blank(p[2])) {
+    float2 uv(0.0f);
+    p = parse_float(p + 3, end, uv.x);
+    parse_float(p, end, uv.y);
+    r_chunk.uv_coords.append(uv);
+  }
+  else if (p[0] == 'v' && p[1] == 'n' && end - p > 2 && is_blank(p[2])) {
+    float3 normal(0.0f);
+    p = parse_float(p + 3, end, normal.x);
+    p = parse_float(p, end, normal.y);
+    parse_float(p, end, normal.z);
+    r_chunk.normals.append(normal);
+  }
+  else if (p[0] == 'f' && is_blank(p[1])) {
+    parse_face_line(p + 2, end, r_chunk.final_smooth, r_chunk);
+  }
+  else if (p[0] == 'o' && is_blank(p[1])) {
+    const char *name_start = skip_blanks(p + 2, end);
+    const char *name_end = end;
+    while (name_end > name_start && is_blank(name_end[-1])) {
+      name_end--;
+    }
+    r_chunk.object_markers.append(
+        {int(r_chunk.faces.size()), std::string(name_start, name_end)});
+  }
+  else if (p[0] == 's' && is_blank(p[1])) {
+    const char *arg = skip_blanks(p + 2, end);
+    const bool is_off = (end - arg >= 1 && *arg == '0') ||
+                        (end - arg >= 3 && memcmp(arg, "off", 3) == 0);
+    r_chunk.final_smooth = !is_off;
+  }
+  /* Everything else (`g`, `l`, `usemtl`, `mtllib`, curves, ...) is skipped. */
+}
+
+static void parse_chunk(const char *p, const char *end, ChunkData &r_chunk)
+{
+  while (p < end) {
+    const char *line_end = static_cast<const char *>(memchr(p, '\n', end - p));
+    if (line_end == nullptr) {
+      line_end = end;
+    }
+    parse_line(p, line_end, r_chunk);
+    p = line_end + 1;
+  }
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Merging chunks
+ * \{ */
+
+/**
+ * Resolve a raw file index against the number of elements that precede the face.
+ * \return the zero-based global index, -1 for an absent element, or an out of range value for a
+ * malformed file (checked when the mesh is built).
+ */
+static int resolve_index(const int raw, const int count_before)
+{
+  if (raw > 0) {
+    return raw - 1;
+  }
+  if (raw < 0) {
+    return count_before + raw;
+  }
+  return -1;
+}
+
+static void merge_chunks(const Span<ChunkData> chunks,
+                         const char *default_name,
+                         OBJImportData &r_data)
+{
+  int64_t total_verts = 0, total_uvs = 0, total_normals = 0, total_corners = 0, total_faces = 0;
+  for (const ChunkData &chunk : chunks) {
+    total_verts += chunk.vertices.size();
+    total_uvs += chunk.uv_coords.size();
+    total_normals += chunk.normals.size();
+    total_corners += chunk.corners.size();
+    total_faces += chunk.faces.size();
+  }
+  r_data.vertices.reserve(total_verts);
+  r_data.uv_coords.reserve(total_uvs);
+  r_data.normals.reserve(total_normals);
+  r_data.corners.reserve(total_corners);
+  r_data.faces.reserve(total_faces);
+
+  r_data.geometries.append({default_name, 0, 0});
+  /* Carried across chunks: chunks inherit the `s` state of their predecessors. */
+  int carry_smooth = 0;
+
+  for (const ChunkData &chunk : chunks) {
+    const int verts_offset = int(r_data.vertices.size());
+    const int uvs_offset = int(r_data.uv_coords.size());
+    const int normals_offset = int(r_data.normals.size());
+    const int corners_offset = int(r_data.corners.size());
+
+    int64_t marker_index = 0;
+    for (const int64_t face_index : chunk.faces.index_range()) {
+      while (marker_index < chunk.object_markers.size() &&
+             chunk.object_markers[marker_index].face_index <= face_index) {
+        OBJGeometry &prev = r_data.geometries.last();
+        prev.face_count = int(r_data.faces.size()) - prev.start_face_index;
+        r_data.geometries.append(
+            {chunk.object_markers[marker_index].name, int(r_data.faces.size()), 0});
+        marker_index++;
+      }
+
+      const ChunkRawFace &raw_face = chunk.faces[face_index];
+      OBJFace face;
+      face.start_corner_index = corners_offset + raw_face.start_corner_index;
+      face.corner_count = raw_face.corner_count;
+      face.shaded_smooth = (raw_face.smooth == -1) ? bool(carry_smooth) : bool(raw_face.smooth);
+      r_data.faces.append(face);
+
+      for (const int i : IndexRange(raw_face.corner_count)) {
+        const OBJFaceCorner &raw = chunk.corners[raw_face.start_corner_index + i];
+        OBJFaceCorner corner;
+        corner.vert_index = resolve_index(raw.vert_index, verts_offset + raw_face.verts_before);
+        corner.uv_index = resolve_index(raw.uv_index, uvs_offset + raw_face.uvs_before);
+        corner.normal_index = resolve_index(raw.normal_index,
+                                            normals_offset + raw_face.normals_before);
+        r_data.corners.append(corner);
+      }
+    }
+    /* Markers after the last face of the chunk. */
+    while (marker_index < chunk.object_markers.size()) {
+      OBJGeometry &prev = r_data.geometries.last();
+      prev.face_count = int(r_data.faces.size()) - prev.start_face_index;
+      r_data.geometries.append(
+          {chunk.object_markers[marker_index].name, int(r_data.faces.size()), 0});
+      marker_index++;
+    }
+
+    r_data.vertices.extend(chunk.vertices);
+    r_data.uv_coords.extend(chunk.uv_coords);
+    r_data.normals.extend(chunk.normals);
+    if (chunk.final_smooth != -1) {
+      carry_smooth = chunk.final_smooth;
+    }
+  }
+  OBJGeometry &last = r_data.geometries.last();
+  last.face_count = int(r_data.faces.size()) - last.start_face_index;
+
+  /* Drop empty geometries, but keep a single one for vertex-only files (point clouds). */
+  if (!r_data.faces.is_empty() || r_data.geometries.size() > 1) {
+    Vector<OBJGeometry> used_geometries;
+    for (OBJGeometry &geometry : r_data.geometries) {
+      if (geometry.face_count > 0) {
+        used_geometries.append(std::move(geometry));
+      }
+    }
+    r_data.geometries = std::move(used_geometries);
+  }
+}
+
+/** \} */
+
+bool parse_obj_file(const char *filepath, const char *default_name, OBJImportData &r_data)
+{
+  size_t buffer_len = 0;
+  char *buffer = static_cast<char *>(BLI_file_read_binary_as_mem(filepath, 0, &buffer_len));
+  if (buffer == nullptr) {
+    return false;
+  }
+
+  /* Split the buffer into line-aligned chunks: each chunk starts right after a newline. */
+  const int64_t chunk_bytes = 4 * 1024 * 1024;
+  const int64_t chunk_count = std::max<int64_t>(1, int64_t(buffer_len) / chunk_bytes);
+  Vector<const char *> bounds;
+  bounds.append(buffer);
+  for (const int64_t i : IndexRange(1, chunk_count - 1)) {
+    const char *candidate = buffer + (int64_t(buffer_len) * i) / chunk_count;
+    const char *newline = static_cast<const char *>(
+        memchr(candidate, '\n', buffer + buffer_len - candidate));
+    const char *start = newline ? newline + 1 : buffer + buffer_len;
+    if (start > bounds.last()) {
+      bounds.append(start);
+    }
+  }
+  bounds.append(buffer + buffer_len);
+
+  Array<ChunkData> chunks(bounds.size() - 1);
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      parse_chunk(bounds[i], bounds[i + 1], chunks[i]);
+    }
+  });
+
+  merge_chunks(chunks, default_name, r_data);
+  MEM_freeN(buffer);
+  return true;
+}
+
+}  // namespace blender::io::obj
@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup obj
+ */
+
+#pragma once
+
+#include <string>
+
+#include "BLI_math_vec_types.hh"
+#include "BLI_vector.hh"
+
+namespace blender::io::obj {
+
+/**
+ * A single face corner as parsed from the file. Indices are zero-based into the global
+ * vertex/UV/normal arrays of #OBJImportData; -1 when the face did not specify that element.
+ * Out-of-range indices are possible for malformed files and have to be checked when the mesh is
+ * built.
+ */
+struct OBJFaceCorner {
+  int vert_index;
+  int uv_index;
+  int normal_index;
+};
+
+struct OBJFace {
+  /** Index of the first corner in #OBJImportData::corners; corners of a face are contiguous. */
+  int start_corner_index;
+  int corner_count;
+  bool shaded_smooth;
+};
+
+/**
+ * Faces grouped under one `o` name in the file; becomes one mesh object. Faces of a geometry are
+ * contiguous in #OBJImportData::faces since `o` starts a new geometry.
+ */
+struct OBJGeometry {
+  std::string name;
+  int start_face_index;
+  int face_count;
+};
+
+/**
+ * Contents of an OBJ file, with all indices resolved to zero-based global indices.
+ * Vertex/UV/normal arrays are shared by all geometries, like in the file.
+ */
+struct OBJImportData {
+  Vector<float3> vertices;
+  Vector<float2> uv_coords;
+  Vector<float3> normals;
+  Vector<OBJFaceCorner> corners;
+  Vector<OBJFace> faces;
+  Vector<OBJGeometry> geometries;
+};
+
+/**
+ * Read and parse the entire OBJ file into \a r_data. Parsing is distributed over worker threads:
+ * the file is split into line-aligned chunks which are parsed independently, after which the
+ * per-chunk results are merged and relative (negative) indices are resolved.
+ *
+ * Geometry-only: `v`, `vt`, `vn`, `f`, `o` and `s` are handled, material and curve keywords are
+ * skipped.
+ *
+ * \param default_name: Geometry name for faces that appear before any `o` keyword.
+ * \return false when the file cannot be read.
+ */
+bool parse_obj_file(const char *filepath, const char *default_name, OBJImportData &r_data);
+
+}  // namespace blender::io::obj
@@ -0,0 +1,189 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup obj
+ */
+
+#include <cstdio>
+
+#include "BKE_collection.h"
+#include "BKE_customdata.h"
+#include "BKE_layer.h"
+#include "BKE_mesh.h"
+#include "BKE_object.h"
+
+#include "BLI_map.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_rotation.h"
+#include "BLI_math_vector.h"
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+
+#include "DEG_depsgraph.h"
+#include "DEG_depsgraph_build.h"
+
+#include "DNA_collection_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "obj_import_file_reader.hh"
+#include "obj_importer.hh"
+
+namespace blender::io::obj {
+
+/**
+ * Build a no-main mesh from one geometry. Vertices are shared globally in the file, so the
+ * indices used by this geometry's faces are remapped to a compact local range first. Faces
+ * referencing out-of-range indices (malformed files) are dropped.
+ */
+static Mesh *mesh_from_geometry(const OBJImportData &data,
+                                const OBJGeometry &geometry,
+                                const float axes_transform[3][3],
+                                const bool validate_mesh)
+{
+  if (geometry.face_count == 0) {
+    /* Vertex-only file (e.g. a point cloud scan): import all vertices, without faces. */
+    Mesh *mesh = BKE_mesh_new_nomain(int(data.vertices.size()), 0, 0, 0, 0);
+    for (const int64_t i : data.vertices.index_range()) {
+      mul_v3_m3v3(mesh->mvert[i].co, axes_transform, data.vertices[i]);
+    }
+    return mesh;
+  }
+
+  const IndexRange face_range(geometry.start_face_index, geometry.face_count);
+
+  /* Map the global vertex indices used by valid faces to mesh-local ones, in use order. */
+  Map<int, int> vert_map;
+  Vector<int> used_faces;
+  int totloop = 0;
+  bool has_uvs = false;
+  bool all_loops_have_normals = !data.normals.is_empty();
+  for (const int64_t face_index : face_range) {
+    const OBJFace &face = data.faces[face_index];
+    bool valid = true;
+    for (const int i : IndexRange(face.corner_count)) {
+      const OBJFaceCorner &corner = data.corners[face.start_corner_index + i];
+      if (corner.vert_index < 0 || corner.vert_index >= data.vertices.size()) {
+        valid = false;
+        break;
+      }
+    }
+    if (!valid) {
+      continue;
+    }
+    used_faces.append(int(face_index));
+    totloop += face.corner_count;
+    for (const int i : IndexRange(face.corner_count)) {
+      const OBJFaceCorner &corner = data.corners[face.start_corner_index + i];
+      vert_map.lookup_or_add(corner.vert_index, int(vert_map.size()));
+      has_uvs |= (corner.uv_index >= 0 && corner.uv_index < data.uv_coords.size());
+      all_loops_have_normals &= (corner.normal_index >= 0 &&
+                                 corner.normal_index < data.normals.size());
+    }
+  }
+
+  Mesh *mesh = BKE_mesh_new_nomain(int(vert_map.size()), 0, 0, totloop, int(used_faces.size()));
+
+  for (const auto item : vert_map.items()) {
+    mul_v3_m3v3(mesh->mvert[item.value].co, axes_transform, data.vertices[item.key]);
+  }
+
+  MLoopUV *mloopuv = nullptr;
+  if (has_uvs) {
+    mloopuv = static_cast<MLoopUV *>(CustomData_add_layer_named(
+        &mesh->ldata, CD_MLOOPUV, CD_CALLOC, nullptr, totloop, "UVMap"));
+  }
+  float(*loop_normals)[3] = nullptr;
+  if (all_loops_have_normals && totloop > 0) {
+    loop_normals = static_cast<float(*)[3]>(
+        MEM_malloc_arrayN(totloop, sizeof(float[3]), __func__));
+  }
+
+  int loop_index = 0;
+  for (const int64_t poly_index : used_faces.index_range()) {
+    const OBJFace &face = data.faces[used_faces[poly_index]];
+    MPoly *mpoly = &mesh->mpoly[poly_index];
+    mpoly->loopstart = loop_index;
+    mpoly->totloop = face.corner_count;
+    if (face.shaded_smooth) {
+      mpoly->flag |= ME_SMOOTH;
+    }
+    for (const int i : IndexRange(face.corner_count)) {
+      const OBJFaceCorner &corner = data.corners[face.start_corner_index + i];
+      mesh->mloop[loop_index].v = vert_map.lookup(corner.vert_index);
+      if (mloopuv != nullptr && corner.uv_index >= 0 &&
+          corner.uv_index < data.uv_coords.size()) {
+        copy_v2_v2(mloopuv[loop_index].uv, data.uv_coords[corner.uv_index]);
+      }
+      if (loop_normals != nullptr) {
+        mul_v3_m3v3(loop_normals[loop_index], axes_transform, data.normals[corner.normal_index]);
+        normalize_v3(loop_normals[loop_index]);
+      }
+      loop_index++;
+    }
+  }
+
+  BKE_mesh_calc_edges(mesh, false, false);
+  if (loop_normals != nullptr) {
+    mesh->flag |= ME_AUTOSMOOTH;
+    BKE_mesh_set_custom_normals(mesh, loop_normals);
+    MEM_freeN(loop_normals);
+  }
+  if (validate_mesh) {
+    BKE_mesh_validate(mesh, false, true);
+  }
+  return mesh;
+}
+
+void importer_main(bContext *C, const OBJImportParams &import_params)
+{
+  Main *bmain = CTX_data_main(C);
+  Scene *scene = CTX_data_scene(C);
+  ViewLayer *view_layer = CTX_data_view_layer(C);
+
+  /* Use the file name for the default geometry name and the mesh of vertices before any `o`. */
+  char default_name[FILE_MAX];
+  BLI_strncpy(default_name, BLI_path_basename(import_params.filepath), sizeof(default_name));
+  BLI_path_extension_replace(default_name, sizeof(default_name), "");
+  if (default_name[0] == '\0') {
+    BLI_strncpy(default_name, "OBJ", sizeof(default_name));
+  }
+
+  OBJImportData data;
+  if (!parse_obj_file(import_params.filepath, default_name, data)) {
+    fprintf(stderr, "OBJ import: cannot read from file \"%s\".\n", import_params.filepath);
+    return;
+  }
+
+  float axes_transform[3][3];
+  unit_m3(axes_transform);
+  /* +Y-forward and +Z-up are the default Blender axis settings. */
+  mat3_from_axis_conversion(
+      import_params.forward_axis, import_params.up_axis, OBJ_AXIS_Y_FORWARD, OBJ_AXIS_Z_UP, axes_transform);
+  /* mat3_from_axis_conversion returns a transposed matrix! */
+  transpose_m3(axes_transform);
+
+  LayerCollection *lc = BKE_layer_collection_get_active(view_layer);
+
+  for (const OBJGeometry &geometry : data.geometries) {
+    const char *name = geometry.name.empty() ? default_name : geometry.name.c_str();
+    Mesh *mesh = mesh_from_geometry(
+        data, geometry, axes_transform, import_params.validate_meshes);
+
+    Object *obj = BKE_object_add_only_object(bmain, OB_MESH, name);
+    obj->data = BKE_mesh_add(bmain, name);
+    BKE_mesh_nomain_to_mesh(mesh, static_cast<Mesh *>(obj->data), obj, &CD_MASK_EVERYTHING, true);
+
+    BKE_collection_object_add(bmain, lc->collection, obj);
+    DEG_id_tag_update(&obj->id, ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY);
+  }
+
+  DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
+  DEG_relations_tag_update(bmain);
+}
+
+}  // namespace blender::io::obj
@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup obj
+ */
+
+#pragma once
+
+#include "IO_wavefront_obj.h"
+
+namespace blender::io::obj {
+
+/**
+ * Parse the OBJ file given in the import parameters and add the resulting mesh objects to the
+ * active collection.
+ */
+void importer_main(bContext *C, const OBJImportParams &import_params);
+
+}  // namespace blender::io::obj
@@ -270,6 +270,25 @@ parm u 0.0
   ASSERT_EQ(got_string, expected);
 }
 
+TEST(obj_exporter_writer, format_handler_float_formatting)
+{
+  /* The fast float path must produce output identical to the `snprintf` fallback, including for
+   * decimal ties (e.g. 0.8203125), negative zero and values outside the fast path's range. */
+  FormatHandler<eFileType::OBJ> h;
+  h.write<eOBJSyntaxElement::vertex_coords>(0.0f, -0.0f, 1.0f);
+  h.write<eOBJSyntaxElement::vertex_coords>(0.8203125f, -0.8203125f, 559.820312f);
+  h.write<eOBJSyntaxElement::vertex_coords>(1.0e18f, -1.0e-7f, 123456.789f);
+  h.write<eOBJSyntaxElement::normal>(0.5f, -0.25f, 0.00005f);
+
+  std::string got_string = h.get_as_string();
+  const char *expected = R"(v 0.000000 -0.000000 1.000000
+v 0.820312 -0.820312 559.820312
+v 999999984306749440.000000 -0.000000 123456.789062
+vn 0.5000 -0.2500 0.0000
+)";
+  ASSERT_EQ(got_string, expected);
+}
+
 /* Return true if string #a and string #b are equal after their first newline. */
 static bool strings_equal_after_first_lines(const std::string &a, const std::string &b)
 {
@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "testing/testing.h"
+
+#include "BLI_fileops.h"
+
+#include "obj_import_file_reader.hh"
+
+namespace blender::io::obj {
+
+/* Write \a text to a temporary OBJ file, parse it and return the parsed data. */
+static bool parse_obj_text(const std::string &text, OBJImportData &r_data)
+{
+  const std::string filepath = blender::tests::flags_test_release_dir() +
+                               "/obj_importer_test.obj";
+  FILE *f = BLI_fopen(filepath.c_str(), "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  fwrite(text.data(), 1, text.size(), f);
+  fclose(f);
+  const bool ok = parse_obj_file(filepath.c_str(), "default", r_data);
+  BLI_delete(filepath.c_str(), false, false);
+  return ok;
+}
+
+TEST(obj_importer, parse_file_basics)
+{
+  const std::string text =
+      "# comment\n"
+      "v 1 2 3\n"
+      "v -1.5 0.5 0\n"
+      "v 0 0 1\n"
+      "v 1 0 1e1\n"
+      "vt 0.25 0.75\n"
+      "vn 0 0 1\n"
+      "s off\n"
+      "f 1 2 3\n"
+      "s 1\n"
+      "o Cube\n"
+      "f -1/-1/-1 2/1/1 3/1/1\n";
+
+  OBJImportData data;
+  if (!parse_obj_text(text, data)) {
+    ADD_FAILURE();
+    return;
+  }
+
+  ASSERT_EQ(data.vertices.size(), 4);
+  EXPECT_EQ(data.vertices[1], float3(-1.5f, 0.5f, 0.0f));
+  EXPECT_EQ(data.vertices[3], float3(1.0f, 0.0f, 10.0f));
+  ASSERT_EQ(data.uv_coords.size(), 1);
+  EXPECT_EQ(data.uv_coords[0], float2(0.25f, 0.75f));
+  ASSERT_EQ(data.normals.size(), 1);
+
+  /* Faces before any `o` belong to the default geometry. */
+  ASSERT_EQ(data.geometries.size(), 2);
+  EXPECT_EQ(data.geometries[0].name, "default");
+  EXPECT_EQ(data.geometries[0].face_count, 1);
+  EXPECT_EQ(data.geometries[1].name, "Cube");
+  EXPECT_EQ(data.geometries[1].face_count, 1);
+
+  ASSERT_EQ(data.faces.size(), 2);
+  const OBJFace &flat_face = data.faces[0];
+  EXPECT_FALSE(flat_face.shaded_smooth);
+  ASSERT_EQ(flat_face.corner_count, 3);
+  EXPECT_EQ(data.corners[flat_face.start_corner_index].vert_index, 0);
+  /* `v` only corners have no UV and no normal. */
+  EXPECT_EQ(data.corners[flat_face.start_corner_index].uv_index, -1);
+  EXPECT_EQ(data.corners[flat_face.start_corner_index].normal_index, -1);
+
+  const OBJFace &smooth_face = data.faces[1];
+  EXPECT_TRUE(smooth_face.shaded_smooth);
+  /* Negative indices are relative to the elements seen so far. */
+  EXPECT_EQ(data.corners[smooth_face.start_corner_index].vert_index, 3);
+  EXPECT_EQ(data.corners[smooth_face.start_corner_index].uv_index, 0);
+  EXPECT_EQ(data.corners[smooth_face.start_corner_index].normal_index, 0);
+}
+
+TEST(obj_importer, parse_file_degenerate_and_vertex_only)
+{
+  OBJImportData degenerate;
+  if (!parse_obj_text("v 0 0 0\nv 1 1 1\nf 1 2\n", degenerate)) {
+    ADD_FAILURE();
+    return;
+  }
+  /* Two-corner faces are dropped; the file degenerates to a vertex-only one. */
+  EXPECT_EQ(degenerate.faces.size(), 0);
+  ASSERT_EQ(degenerate.geometries.size(), 1);
+  EXPECT_EQ(degenerate.geometries[0].face_count, 0);
+  EXPECT_EQ(degenerate.vertices.size(), 2);
+}
+
+}  // namespace blender::io::obj
@@ -584,7 +584,7 @@ typedef struct PreviewImage {
 
 /* Check whether data-block type requires copy-on-write from #ID_RECALC_PARAMETERS.
  * Keep in sync with #BKE_id_eval_properties_copy. */
-#define ID_TYPE_SUPPORTS_PARAMS_WITHOUT_COW(id_type) ELEM(id_type, ID_ME)
+#define ID_TYPE_SUPPORTS_PARAMS_WITHOUT_COW(id_type) ELEM(id_type, ID_ME, ID_KE)
 
 #ifdef GS
 #  undef GS
@@ -596,6 +596,13 @@ typedef struct FCurve {
   /* value cache + settings */
   /** Value stored from last time curve was evaluated (not threadsafe, debug display only!). */
   float curval;
+  /**
+   * Index of the keyframe segment used by the previous evaluation, used to seed the keyframe
+   * search of the next evaluation. Sequential playback almost always stays in the same segment,
+   * turning the search into a constant time check. Not threadsafe for the same curve, like
+   * #curval, which is fine as every dependency graph evaluates its own copy of the curve.
+   */
+  int last_eval_index;
   /** User-editable settings for this curve. */
   short flag;
   /** Value-extending mode for this curve (does not cover). */
@@ -603,7 +610,7 @@ typedef struct FCurve {
   /** Auto-handle smoothing mode. */
   char auto_smoothing;
 
-  char _pad[3];
+  char _pad[7];
 
   /* RNA - data link */
   /**
@@ -619,6 +626,13 @@ typedef struct FCurve {
    * \note String look-ups for collection and custom-properties are escaped using #BLI_str_escape.
    */
   char *rna_path;
+  /**
+   * Runtime cache with the resolution of `rna_path` against the owning ID, see
+   * #PathResolvedRNA. Only used on evaluated copies of the curve, where the cache can never
+   * outlive the data it points into: re-creating the copy frees both together. Allocated
+   * lazily, not saved in files.
+   */
+  void *rna_path_resolved;
 
   /* curve coloring (for editor) */
   /** Coloring method to use (eFCurve_Coloring). */
@@ -46,6 +46,13 @@ typedef struct CustomDataLayer {
    * automatically.
    */
   const struct AnonymousAttributeID *anonymous_id;
+  /**
+   * Run-time only: reference count shared by all layers that reference the same data, so the
+   * data is only freed with its last user and referencing copies stay valid when the original
+   * is freed first. NULL for exclusively owned data and for legacy #CD_FLAG_NOFREE references.
+   * Managed by `customdata.cc`, reset on file read.
+   */
+  void *sharing_info;
 } CustomDataLayer;
 
 #define MAX_CUSTOMDATA_LAYER_NAME 64
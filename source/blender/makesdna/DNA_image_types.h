@@ -140,6 +140,12 @@ typedef struct Image_Runtime {
   /** \brief Partial update user for GPUTextures stored inside the Image. */
   struct PartialUpdateUser *partial_update_user;
 
+  /** Task pool decoding upcoming sequence frames ahead of playback (runtime only). */
+  void *prefetch_pool;
+  /** Last frame prefetching was scheduled for, avoids re-scheduling identical work. */
+  int prefetch_last_frame;
+  char _pad[4];
+
 } Image_Runtime;
 
 typedef struct Image {
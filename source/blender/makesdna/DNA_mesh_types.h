@@ -66,6 +66,16 @@ typedef struct Mesh_Runtime {
   struct Mesh *mesh_eval;
   void *eval_mutex;
 
+  /* Result of modifier stack evaluation, shared between objects which use this mesh with equal
+   * modifier stacks. Only stacks in which every enabled modifier implements `equalsSettings`
+   * (and thereby guarantees its output depends on nothing besides the input geometry and its
+   * own settings) take part in this, see `mesh_calc_modifiers()`. Protected by #eval_mutex. */
+  struct Mesh *shared_stack_eval;
+  /** Copies of the enabled modifiers that produced #shared_stack_eval, in stack order. */
+  ListBase shared_stack_eval_modifiers;
+  /** Data mask that #shared_stack_eval was evaluated for. */
+  CustomData_MeshMasks shared_stack_eval_mask;
+
   /* A separate mutex is needed for normal calculation, because sometimes
    * the normals are needed while #eval_mutex is already locked. */
   void *normals_mutex;
@@ -73,6 +83,9 @@ typedef struct Mesh_Runtime {
   /** Needed to ensure some thread-safety during render data pre-processing. */
   void *render_mutex;
 
+  /** Protects lazy creation of #vert_coords_cache. */
+  void *vert_coords_mutex;
+
   /** Lazily initialized SoA data from the #edit_mesh field in #Mesh. */
   struct EditMeshData *edit_data;
 
@@ -122,10 +135,26 @@ typedef struct Mesh_Runtime {
    */
   char subsurf_apply_render;
   char subsurf_use_optimal_display;
-  char _pad[2];
+  /** Tag for #vert_coords_cache, set whenever vertex positions change. */
+  char vert_coords_cache_dirty;
+  char _pad[1];
   int subsurf_resolution;
 
-  void *_pad2;
+  /**
+   * Session-wide counter identifying this mesh's topology, so topology-derived caches can be
+   * reused between meshes that are known to only differ in deformation. Two meshes with the same
+   * non-zero version are guaranteed to have identical vert/edge/loop/poly connectivity.
+   * 0 means no version has been assigned yet, see #BKE_mesh_runtime_topology_version_ensure.
+   */
+  int topology_version;
+  char _pad2[4];
+
+  /**
+   * Lazily computed contiguous copy of the vertex coordinates (`MVert.co`), for hot loops that
+   * only read positions and would otherwise waste cache bandwidth on the interleaved `MVert`
+   * flags. See #BKE_mesh_vert_coords_ensure.
+   */
+  void *vert_coords_cache;
 
   /**
    * Used to mark when derived data needs to be recalculated for a certain layer.
@@ -181,6 +181,12 @@ typedef enum {
 typedef struct SubsurfRuntimeData {
   /* Cached subdivision surface descriptor, with topology and settings. */
   struct Subdiv *subdiv;
+  /* Descriptors built for other settings (other viewport level, render level). Kept so switching
+   * the level back and forth re-uses an existing topology refiner instead of rebuilding it.
+   * Slots are evicted least-recently-used, based on #subdiv_cache_age. */
+  struct Subdiv *subdiv_cache[3];
+  int subdiv_cache_age[3];
+  int subdiv_cache_counter;
   char set_by_draw_code;
   char _pad[7];
 } SubsurfRuntimeData;
@@ -467,10 +467,13 @@ typedef struct bNodeLink {
 #ifdef __cplusplus
 namespace blender::nodes {
 struct FieldInferencingInterface;
+class GeometryNodesEvalCache;
 }
 using FieldInferencingInterfaceHandle = blender::nodes::FieldInferencingInterface;
+using GeometryNodesEvalCacheHandle = blender::nodes::GeometryNodesEvalCache;
 #else
 typedef struct FieldInferencingInterfaceHandle FieldInferencingInterfaceHandle;
+typedef struct GeometryNodesEvalCacheHandle GeometryNodesEvalCacheHandle;
 #endif
 
 /* the basis for a Node tree, all links and nodes reside internal here */
@@ -497,6 +500,11 @@ typedef struct bNodeTree {
   ListBase nodes, links;
   /** Information about how inputs and outputs of the node group interact with fields. */
   FieldInferencingInterfaceHandle *field_inferencing_interface;
+  /**
+   * Runtime evaluation state for geometry nodes that only depends on the tree itself. Created
+   * lazily during modifier evaluation and freed whenever the tree changes or is freed.
+   */
+  GeometryNodesEvalCacheHandle *geometry_nodes_eval_cache;
 
   int type;
 
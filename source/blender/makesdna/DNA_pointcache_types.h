@@ -51,6 +51,11 @@ typedef struct PTCacheMem {
   /** BPHYS_TOT_DATA. */
   void *data[8];
 
+  /** Runtime. When set, the matching #data array has been freed and lives here in
+   * compressed form, see #BKE_ptcache_mem_ensure_raw. */
+  void *data_compressed[8];
+  unsigned int data_compressed_size[8];
+
   struct ListBase extradata;
 } PTCacheMem;
 
@@ -32,6 +32,7 @@ struct wmOperatorType;
 
 /* Forward declarations: */
 
+struct GSet;
 struct PointerRNA;
 struct Report;
 struct ReportList;
@@ -151,6 +152,12 @@ typedef struct wmWindowManager {
 
   /** Refresh/redraw #wmNotifier structs. */
   ListBase notifier_queue;
+  /**
+   * For duplicate detection, keep in sync with `notifier_queue` (runtime only).
+   * Without this, adding notifiers is quadratic in the queue size,
+   * which shows up when scripts touch many data-blocks in one batch.
+   */
+  struct GSet *notifier_queue_set;
 
   /** Information and error reports. */
   struct ReportList reports;
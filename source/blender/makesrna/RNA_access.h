@@ -1161,6 +1161,21 @@ int RNA_property_collection_raw_set(struct ReportList *reports,
                                     void *array,
                                     RawPropertyType type,
                                     int len);
+/* Raw access over an arbitrary span of pointers instead of a collection. */
+int RNA_property_multi_raw_get(struct ReportList *reports,
+                               PointerRNA *ptrs,
+                               int num_ptrs,
+                               const char *propname,
+                               void *array,
+                               RawPropertyType type,
+                               int len);
+int RNA_property_multi_raw_set(struct ReportList *reports,
+                               PointerRNA *ptrs,
+                               int num_ptrs,
+                               const char *propname,
+                               void *array,
+                               RawPropertyType type,
+                               int len);
 int RNA_raw_type_sizeof(RawPropertyType type);
 RawPropertyType RNA_property_raw_type(PropertyRNA *prop);
 
@@ -11,6 +11,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 #include "DNA_ID.h"
 #include "DNA_constraint_types.h"
 #include "DNA_modifier_types.h"
@@ -62,25 +64,43 @@ const PointerRNA PointerRNA_NULL = {NULL};
 void RNA_init(void)
 {
   StructRNA *srna;
-  PropertyRNA *prop;
 
   BLENDER_RNA.structs_map = BLI_ghash_str_new_ex(__func__, 2048);
   BLENDER_RNA.structs_len = 0;
 
   for (srna = BLENDER_RNA.structs.first; srna; srna = srna->cont.next) {
-    if (!srna->cont.prophash) {
-      srna->cont.prophash = BLI_ghash_str_new("RNA_init gh");
+    /* The per-struct property hash is built lazily on first name lookup (see
+     * #rna_struct_prophash_ensure), most structs are never looked up by name
+     * in a session and building thousands of hashes here measurably slows
+     * down startup, which matters for background mode. */
+    BLI_assert(srna->flag & STRUCT_PUBLIC_NAMESPACE);
+    BLI_ghash_insert(BLENDER_RNA.structs_map, (void *)srna->identifier, srna);
+    BLENDER_RNA.structs_len += 1;
+  }
+}
+
+struct GHash *rna_struct_prophash_ensure(StructRNA *srna)
+{
+  static ThreadMutex prophash_mutex = BLI_MUTEX_INITIALIZER;
 
-      for (prop = srna->cont.properties.first; prop; prop = prop->next) {
+  if (srna->cont.prophash == NULL) {
+    /* Name lookups can run from multiple threads (e.g. animation drivers
+     * resolving RNA paths during depsgraph evaluation). */
+    BLI_mutex_lock(&prophash_mutex);
+    if (srna->cont.prophash == NULL) {
+      GHash *prophash = BLI_ghash_str_new("RNA_init gh");
+      for (PropertyRNA *prop = srna->cont.properties.first; prop; prop = prop->next) {
         if (!(prop->flag_internal & PROP_INTERN_BUILTIN)) {
-          BLI_ghash_insert(srna->cont.prophash, (void *)prop->identifier, prop);
+          BLI_ghash_insert(prophash, (void *)prop->identifier, prop);
         }
       }
+      /* Only assign once fully built, so other threads which passed the
+       * unlocked NULL check above never see a partially filled hash. */
+      atomic_cas_ptr((void **)&srna->cont.prophash, NULL, prophash);
     }
-    BLI_assert(srna->flag & STRUCT_PUBLIC_NAMESPACE);
-    BLI_ghash_insert(BLENDER_RNA.structs_map, (void *)srna->identifier, srna);
-    BLENDER_RNA.structs_len += 1;
+    BLI_mutex_unlock(&prophash_mutex);
   }
+  return srna->cont.prophash;
 }
 
 void RNA_exit(void)
@@ -4302,6 +4322,202 @@ static int rna_property_array_length_all_dimensions(PointerRNA *ptr, PropertyRNA
   return size;
 }
 
+/* Get or set the property of a single item, handling the conversions between
+ * the property type and the raw array type. Shared between the collection and
+ * the multi-pointer raw access. */
+static int rna_raw_access_item(ReportList *reports,
+                               PointerRNA *itemptr,
+                               PropertyRNA *iprop,
+                               PropertyType itemtype,
+                               int itemlen,
+                               RawArray *in_raw,
+                               int set,
+                               int *r_index,
+                               void **tmparray,
+                               int *tmplen)
+{
+  RawArray in = *in_raw;
+  int a = *r_index;
+  int j;
+  const int needconv = !(((itemtype == PROP_INT) && (in.type == PROP_RAW_INT)) ||
+                         ((itemtype == PROP_BOOLEAN) && (in.type == PROP_RAW_BOOLEAN)) ||
+                         ((itemtype == PROP_FLOAT) && (in.type == PROP_RAW_FLOAT)));
+
+  /* editable check */
+  if (set && !RNA_property_editable(itemptr, iprop)) {
+    return 1;
+  }
+
+  if (a + itemlen > in.len) {
+    BKE_reportf(reports, RPT_ERROR, "Array length mismatch (got %d, expected more)", in.len);
+    return 0;
+  }
+
+  if (itemlen == 0) {
+    /* handle conversions */
+    if (set) {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          int b;
+          RAW_GET(bool, b, in, a);
+          RNA_property_boolean_set(itemptr, iprop, b);
+          break;
+        }
+        case PROP_INT: {
+          int i;
+          RAW_GET(int, i, in, a);
+          RNA_property_int_set(itemptr, iprop, i);
+          break;
+        }
+        case PROP_FLOAT: {
+          float f;
+          RAW_GET(float, f, in, a);
+          RNA_property_float_set(itemptr, iprop, f);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    else {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          int b = RNA_property_boolean_get(itemptr, iprop);
+          RAW_SET(bool, in, a, b);
+          break;
+        }
+        case PROP_INT: {
+          int i = RNA_property_int_get(itemptr, iprop);
+          RAW_SET(int, in, a, i);
+          break;
+        }
+        case PROP_FLOAT: {
+          float f = RNA_property_float_get(itemptr, iprop);
+          RAW_SET(float, in, a, f);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    a++;
+  }
+  else if (needconv == 1) {
+    /* allocate temporary array if needed */
+    if (*tmparray && *tmplen != itemlen) {
+      MEM_freeN(*tmparray);
+      *tmparray = NULL;
+    }
+    if (!*tmparray) {
+      *tmparray = MEM_callocN(sizeof(float) * itemlen, "RNA tmparray");
+      *tmplen = itemlen;
+    }
+
+    /* handle conversions */
+    if (set) {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_GET(bool, ((bool *)*tmparray)[j], in, a);
+          }
+          RNA_property_boolean_set_array(itemptr, iprop, *tmparray);
+          break;
+        }
+        case PROP_INT: {
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_GET(int, ((int *)*tmparray)[j], in, a);
+          }
+          RNA_property_int_set_array(itemptr, iprop, *tmparray);
+          break;
+        }
+        case PROP_FLOAT: {
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_GET(float, ((float *)*tmparray)[j], in, a);
+          }
+          RNA_property_float_set_array(itemptr, iprop, *tmparray);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    else {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          RNA_property_boolean_get_array(itemptr, iprop, *tmparray);
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_SET(int, in, a, ((bool *)*tmparray)[j]);
+          }
+          break;
+        }
+        case PROP_INT: {
+          RNA_property_int_get_array(itemptr, iprop, *tmparray);
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_SET(int, in, a, ((int *)*tmparray)[j]);
+          }
+          break;
+        }
+        case PROP_FLOAT: {
+          RNA_property_float_get_array(itemptr, iprop, *tmparray);
+          for (j = 0; j < itemlen; j++, a++) {
+            RAW_SET(float, in, a, ((float *)*tmparray)[j]);
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+  else {
+    if (set) {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          RNA_property_boolean_set_array(itemptr, iprop, &((bool *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        case PROP_INT: {
+          RNA_property_int_set_array(itemptr, iprop, &((int *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        case PROP_FLOAT: {
+          RNA_property_float_set_array(itemptr, iprop, &((float *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    else {
+      switch (itemtype) {
+        case PROP_BOOLEAN: {
+          RNA_property_boolean_get_array(itemptr, iprop, &((bool *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        case PROP_INT: {
+          RNA_property_int_get_array(itemptr, iprop, &((int *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        case PROP_FLOAT: {
+          RNA_property_float_get_array(itemptr, iprop, &((float *)in.array)[a]);
+          a += itemlen;
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+
+  *r_index = a;
+  return 1;
+}
+
 static int rna_raw_access(ReportList *reports,
                           PointerRNA *ptr,
                           PropertyRNA *prop,
@@ -4392,15 +4608,8 @@ static int rna_raw_access(ReportList *reports,
   {
     void *tmparray = NULL;
     int tmplen = 0;
-    int err = 0, j, a = 0;
-    int needconv = 1;
+    int err = 0, a = 0;
 
-    if (((itemtype == PROP_INT) && (in.type == PROP_RAW_INT)) ||
-        ((itemtype == PROP_BOOLEAN) && (in.type == PROP_RAW_BOOLEAN)) ||
-        ((itemtype == PROP_FLOAT) && (in.type == PROP_RAW_FLOAT))) {
-      /* avoid creating temporary buffer if the data type match */
-      needconv = 0;
-    }
     /* no item property pointer, can still be id property, or
      * property of a type derived from the collection pointer type */
     RNA_PROP_BEGIN (ptr, itemptr, prop) {
@@ -4430,175 +4639,10 @@ static int rna_raw_access(ReportList *reports,
           }
         }
 
-        /* editable check */
-        if (!set || RNA_property_editable(&itemptr, iprop)) {
-          if (a + itemlen > in.len) {
-            BKE_reportf(
-                reports, RPT_ERROR, "Array length mismatch (got %d, expected more)", in.len);
-            err = 1;
-            break;
-          }
-
-          if (itemlen == 0) {
-            /* handle conversions */
-            if (set) {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  int b;
-                  RAW_GET(bool, b, in, a);
-                  RNA_property_boolean_set(&itemptr, iprop, b);
-                  break;
-                }
-                case PROP_INT: {
-                  int i;
-                  RAW_GET(int, i, in, a);
-                  RNA_property_int_set(&itemptr, iprop, i);
-                  break;
-                }
-                case PROP_FLOAT: {
-                  float f;
-                  RAW_GET(float, f, in, a);
-                  RNA_property_float_set(&itemptr, iprop, f);
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-            else {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  int b = RNA_property_boolean_get(&itemptr, iprop);
-                  RAW_SET(bool, in, a, b);
-                  break;
-                }
-                case PROP_INT: {
-                  int i = RNA_property_int_get(&itemptr, iprop);
-                  RAW_SET(int, in, a, i);
-                  break;
-                }
-                case PROP_FLOAT: {
-                  float f = RNA_property_float_get(&itemptr, iprop);
-                  RAW_SET(float, in, a, f);
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-            a++;
-          }
-          else if (needconv == 1) {
-            /* allocate temporary array if needed */
-            if (tmparray && tmplen != itemlen) {
-              MEM_freeN(tmparray);
-              tmparray = NULL;
-            }
-            if (!tmparray) {
-              tmparray = MEM_callocN(sizeof(float) * itemlen, "RNA tmparray");
-              tmplen = itemlen;
-            }
-
-            /* handle conversions */
-            if (set) {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_GET(bool, ((bool *)tmparray)[j], in, a);
-                  }
-                  RNA_property_boolean_set_array(&itemptr, iprop, tmparray);
-                  break;
-                }
-                case PROP_INT: {
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_GET(int, ((int *)tmparray)[j], in, a);
-                  }
-                  RNA_property_int_set_array(&itemptr, iprop, tmparray);
-                  break;
-                }
-                case PROP_FLOAT: {
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_GET(float, ((float *)tmparray)[j], in, a);
-                  }
-                  RNA_property_float_set_array(&itemptr, iprop, tmparray);
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-            else {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  RNA_property_boolean_get_array(&itemptr, iprop, tmparray);
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_SET(int, in, a, ((bool *)tmparray)[j]);
-                  }
-                  break;
-                }
-                case PROP_INT: {
-                  RNA_property_int_get_array(&itemptr, iprop, tmparray);
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_SET(int, in, a, ((int *)tmparray)[j]);
-                  }
-                  break;
-                }
-                case PROP_FLOAT: {
-                  RNA_property_float_get_array(&itemptr, iprop, tmparray);
-                  for (j = 0; j < itemlen; j++, a++) {
-                    RAW_SET(float, in, a, ((float *)tmparray)[j]);
-                  }
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-          }
-          else {
-            if (set) {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  RNA_property_boolean_set_array(&itemptr, iprop, &((bool *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                case PROP_INT: {
-                  RNA_property_int_set_array(&itemptr, iprop, &((int *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                case PROP_FLOAT: {
-                  RNA_property_float_set_array(&itemptr, iprop, &((float *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-            else {
-              switch (itemtype) {
-                case PROP_BOOLEAN: {
-                  RNA_property_boolean_get_array(&itemptr, iprop, &((bool *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                case PROP_INT: {
-                  RNA_property_int_get_array(&itemptr, iprop, &((int *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                case PROP_FLOAT: {
-                  RNA_property_float_get_array(&itemptr, iprop, &((float *)in.array)[a]);
-                  a += itemlen;
-                  break;
-                }
-                default:
-                  break;
-              }
-            }
-          }
+        if (!rna_raw_access_item(
+                reports, &itemptr, iprop, itemtype, itemlen, &in, set, &a, &tmparray, &tmplen)) {
+          err = 1;
+          break;
         }
       }
     }
@@ -4612,6 +4656,81 @@ static int rna_raw_access(ReportList *reports,
   }
 }
 
+/* Variant of rna_raw_access() which reads or writes the same property across
+ * an array of pointers instead of the items of a collection, so scripts can
+ * batch access over an arbitrary span of data-blocks without a Python call
+ * per item. */
+static int rna_raw_access_multi(ReportList *reports,
+                                PointerRNA *ptrs,
+                                int num_ptrs,
+                                const char *propname,
+                                void *inarray,
+                                RawPropertyType intype,
+                                int inlen,
+                                int set)
+{
+  StructRNA *last_type = NULL;
+  PropertyRNA *iprop = NULL;
+  PropertyType itemtype = 0;
+  RawArray in;
+  void *tmparray = NULL;
+  int tmplen = 0;
+  int itemlen = 0;
+  int err = 0, a = 0;
+  int i;
+
+  /* initialize in array, stride assumed 0 in following code */
+  in.array = inarray;
+  in.type = intype;
+  in.len = inlen;
+  in.stride = 0;
+
+  for (i = 0; i < num_ptrs; i++) {
+    PointerRNA *itemptr = &ptrs[i];
+
+    if (itemptr->data == NULL) {
+      continue;
+    }
+
+    /* Pointers are usually all of the same type, so only look the property up
+     * again when the type changes. */
+    if (iprop == NULL || itemptr->type != last_type) {
+      iprop = RNA_struct_find_property(itemptr, propname);
+
+      if (iprop == NULL) {
+        BKE_reportf(reports, RPT_ERROR, "Property named '%s' not found", propname);
+        err = 1;
+        break;
+      }
+
+      itemtype = RNA_property_type(iprop);
+
+      if (!ELEM(itemtype, PROP_BOOLEAN, PROP_INT, PROP_FLOAT)) {
+        BKE_report(reports, RPT_ERROR, "Only boolean, int and float properties supported");
+        err = 1;
+        break;
+      }
+
+      last_type = itemptr->type;
+    }
+
+    /* dynamic arrays need the length per item */
+    itemlen = rna_property_array_length_all_dimensions(itemptr, iprop);
+
+    if (!rna_raw_access_item(
+            reports, itemptr, iprop, itemtype, itemlen, &in, set, &a, &tmparray, &tmplen)) {
+      err = 1;
+      break;
+    }
+  }
+
+  if (tmparray) {
+    MEM_freeN(tmparray);
+  }
+
+  return !err;
+}
+
 RawPropertyType RNA_property_raw_type(PropertyRNA *prop)
 {
   if (prop->rawtype == PROP_RAW_UNSET) {
@@ -4655,6 +4774,28 @@ int RNA_property_collection_raw_set(ReportList *reports,
   return rna_raw_access(reports, ptr, prop, propname, array, type, len, 1);
 }
 
+int RNA_property_multi_raw_get(ReportList *reports,
+                               PointerRNA *ptrs,
+                               int num_ptrs,
+                               const char *propname,
+                               void *array,
+                               RawPropertyType type,
+                               int len)
+{
+  return rna_raw_access_multi(reports, ptrs, num_ptrs, propname, array, type, len, 0);
+}
+
+int RNA_property_multi_raw_set(ReportList *reports,
+                               PointerRNA *ptrs,
+                               int num_ptrs,
+                               const char *propname,
+                               void *array,
+                               RawPropertyType type,
+                               int len)
+{
+  return rna_raw_access_multi(reports, ptrs, num_ptrs, propname, array, type, len, 1);
+}
+
 /* Standard iterator functions */
 
 void rna_iterator_listbase_begin(CollectionPropertyIterator *iter,
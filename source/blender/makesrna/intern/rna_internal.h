@@ -18,6 +18,7 @@
 
 struct AssetLibraryReference;
 struct FreestyleSettings;
+struct GHash;
 struct ID;
 struct IDOverrideLibrary;
 struct IDOverrideLibraryPropertyOperation;
@@ -574,6 +575,11 @@ void rna_builtin_properties_next(struct CollectionPropertyIterator *iter);
 PointerRNA rna_builtin_properties_get(struct CollectionPropertyIterator *iter);
 PointerRNA rna_builtin_type_get(struct PointerRNA *ptr);
 int rna_builtin_properties_lookup_string(PointerRNA *ptr, const char *key, PointerRNA *r_ptr);
+/**
+ * Build the property hash of \a srna on first use (thread-safe),
+ * deferred from #RNA_init to keep startup fast.
+ */
+struct GHash *rna_struct_prophash_ensure(struct StructRNA *srna);
 
 /* Iterators */
 
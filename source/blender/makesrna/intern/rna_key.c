@@ -677,9 +677,13 @@ static void rna_Key_update_data(Main *bmain, Scene *UNUSED(scene), PointerRNA *p
   Key *key = (Key *)ptr->owner_id;
   Object *ob;
 
+  /* Shape key properties are patched into the evaluated datablock in place, which avoids a full
+   * copy-on-write of the heavy key block data. Dependent geometry is updated through the
+   * relations from the key parameters. */
+  DEG_id_tag_update(&key->id, ID_RECALC_PARAMETERS);
+
   for (ob = bmain->objects.first; ob; ob = ob->id.next) {
     if (BKE_key_from_object(ob) == key) {
-      DEG_id_tag_update(&ob->id, ID_RECALC_GEOMETRY);
       WM_main_add_notifier(NC_OBJECT | ND_MODIFIER, ob);
     }
   }
@@ -5662,6 +5662,16 @@ static void rna_def_userdef_system(BlenderRNA *brna)
                            "modifiers in the stack");
   RNA_def_property_update(prop, 0, "rna_UserDef_subdivision_update");
 
+  /* Hardware video decoding. */
+
+  prop = RNA_def_property(srna, "use_hardware_video_decode", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "gpu_flag", USER_GPU_FLAG_HW_VIDEO_DECODE);
+  RNA_def_property_ui_text(prop,
+                           "Hardware Video Decoding",
+                           "Decode videos on the GPU or dedicated hardware when the codec "
+                           "supports it, falling back to software decoding otherwise. "
+                           "Takes effect when a video file is (re)opened");
+
   /* Audio */
 
   prop = RNA_def_property(srna, "audio_mixing_buffer", PROP_ENUM, PROP_NONE);
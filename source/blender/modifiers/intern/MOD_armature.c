@@ -295,4 +295,5 @@ ModifierTypeInfo modifierType_Armature = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
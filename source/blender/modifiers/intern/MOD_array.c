@@ -1036,4 +1036,5 @@ ModifierTypeInfo modifierType_Array = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
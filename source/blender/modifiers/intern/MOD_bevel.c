@@ -444,4 +444,5 @@ ModifierTypeInfo modifierType_Bevel = {
     /* uiPanel */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
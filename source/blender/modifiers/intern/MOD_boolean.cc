@@ -640,4 +640,5 @@ ModifierTypeInfo modifierType_Boolean = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ nullptr,
 };
@@ -344,4 +344,5 @@ ModifierTypeInfo modifierType_Build = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -588,4 +588,5 @@ ModifierTypeInfo modifierType_Cast = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -307,4 +307,5 @@ ModifierTypeInfo modifierType_Cloth = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -316,4 +316,5 @@ ModifierTypeInfo modifierType_Collision = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
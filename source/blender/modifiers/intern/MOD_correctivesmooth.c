@@ -849,4 +849,5 @@ ModifierTypeInfo modifierType_CorrectiveSmooth = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
@@ -233,4 +233,5 @@ ModifierTypeInfo modifierType_Curve = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -483,4 +483,5 @@ ModifierTypeInfo modifierType_DataTransfer = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
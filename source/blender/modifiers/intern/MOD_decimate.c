@@ -266,6 +266,19 @@ static void panelRegister(ARegionType *region_type)
   modifier_panel_register(region_type, eModifierType_Decimate, panel_draw);
 }
 
+static bool equalsSettings(const ModifierData *md, const ModifierData *other_md)
+{
+  const DecimateModifierData *dmd = (const DecimateModifierData *)md;
+  const DecimateModifierData *other_dmd = (const DecimateModifierData *)other_md;
+  /* NOTE: `face_count` is a result, not a setting. */
+  return (dmd->mode == other_dmd->mode) && (dmd->flag == other_dmd->flag) &&
+         (dmd->percent == other_dmd->percent) && (dmd->iter == other_dmd->iter) &&
+         (dmd->delimit == other_dmd->delimit) &&
+         (dmd->symmetry_axis == other_dmd->symmetry_axis) && (dmd->angle == other_dmd->angle) &&
+         (dmd->defgrp_factor == other_dmd->defgrp_factor) &&
+         STREQ(dmd->defgrp_name, other_dmd->defgrp_name);
+}
+
 ModifierTypeInfo modifierType_Decimate = {
     /* name */ "Decimate",
     /* structName */ "DecimateModifierData",
@@ -297,4 +310,5 @@ ModifierTypeInfo modifierType_Decimate = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ equalsSettings,
 };
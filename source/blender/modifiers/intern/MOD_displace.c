@@ -506,4 +506,5 @@ ModifierTypeInfo modifierType_Displace = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
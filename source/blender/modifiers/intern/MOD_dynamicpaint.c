@@ -222,4 +222,5 @@ ModifierTypeInfo modifierType_DynamicPaint = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -151,6 +151,13 @@ static void panelRegister(ARegionType *region_type)
   modifier_panel_register(region_type, eModifierType_EdgeSplit, panel_draw);
 }
 
+static bool equalsSettings(const ModifierData *md, const ModifierData *other_md)
+{
+  const EdgeSplitModifierData *emd = (const EdgeSplitModifierData *)md;
+  const EdgeSplitModifierData *other_emd = (const EdgeSplitModifierData *)other_md;
+  return (emd->flags == other_emd->flags) && (emd->split_angle == other_emd->split_angle);
+}
+
 ModifierTypeInfo modifierType_EdgeSplit = {
     /* name */ "EdgeSplit",
     /* structName */ "EdgeSplitModifierData",
@@ -184,4 +191,5 @@ ModifierTypeInfo modifierType_EdgeSplit = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ equalsSettings,
 };
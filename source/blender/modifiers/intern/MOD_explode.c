@@ -1254,4 +1254,5 @@ ModifierTypeInfo modifierType_Explode = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
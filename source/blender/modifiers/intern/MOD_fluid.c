@@ -272,4 +272,5 @@ ModifierTypeInfo modifierType_Fluid = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -571,4 +571,5 @@ ModifierTypeInfo modifierType_Hook = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
@@ -886,4 +886,5 @@ ModifierTypeInfo modifierType_LaplacianDeform = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
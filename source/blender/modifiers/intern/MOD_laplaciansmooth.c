@@ -632,4 +632,5 @@ ModifierTypeInfo modifierType_LaplacianSmooth = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -190,4 +190,5 @@ ModifierTypeInfo modifierType_Lattice = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
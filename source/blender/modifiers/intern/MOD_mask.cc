@@ -836,4 +836,5 @@ ModifierTypeInfo modifierType_Mask = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ nullptr,
 };
@@ -309,4 +309,5 @@ ModifierTypeInfo modifierType_MeshToVolume = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ nullptr,
 };
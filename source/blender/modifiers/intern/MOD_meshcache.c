@@ -447,4 +447,5 @@ ModifierTypeInfo modifierType_MeshCache = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -641,4 +641,5 @@ ModifierTypeInfo modifierType_MeshDeform = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
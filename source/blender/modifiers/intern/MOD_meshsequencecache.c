@@ -232,6 +232,10 @@ static Mesh *modifyMesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh *
                              mcmd->read_flag,
                              mcmd->cache_file->velocity_name,
                              velocity_scale);
+
+      /* Decode the upcoming frames in the background, so the next evaluations do not block on
+       * archive I/O during playback. */
+      BKE_cachefile_prefetch(cache_file, mcmd->reader, frame, FPS);
 #  endif
       break;
     }
@@ -441,4 +445,5 @@ ModifierTypeInfo modifierType_MeshSequenceCache = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
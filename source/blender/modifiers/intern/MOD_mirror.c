@@ -237,4 +237,5 @@ ModifierTypeInfo modifierType_Mirror = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
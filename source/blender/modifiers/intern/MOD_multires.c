@@ -517,4 +517,5 @@ ModifierTypeInfo modifierType_Multires = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
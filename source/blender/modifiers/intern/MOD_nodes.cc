@@ -7,6 +7,7 @@
 
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <string>
 
 #include "MEM_guardedalloc.h"
@@ -79,6 +80,7 @@
 
 #include "NOD_derived_node_tree.hh"
 #include "NOD_geometry.h"
+#include "NOD_geometry_nodes_eval_cache.hh"
 #include "NOD_geometry_nodes_eval_log.hh"
 #include "NOD_node_declaration.hh"
 
@@ -110,6 +112,8 @@ using blender::fn::ValueOrField;
 using blender::fn::ValueOrFieldCPPType;
 using blender::nodes::FieldInferencingInterface;
 using blender::nodes::GeoNodeExecParams;
+using blender::nodes::GeometryNodesEvalCache;
+using blender::nodes::NodeMultiFunctions;
 using blender::nodes::InputSocketFieldType;
 using blender::threading::EnumerableThreadSpecific;
 using namespace blender::fn::multi_function_types;
@@ -1063,6 +1067,7 @@ static void store_output_attributes(GeometrySet &geometry,
  * Evaluate a node group to compute the output geometry.
  */
 static GeometrySet compute_geometry(const DerivedNodeTree &tree,
+                                    const NodeMultiFunctions &mf_by_node,
                                     Span<const NodeRef *> group_input_nodes,
                                     const NodeRef &output_node,
                                     GeometrySet input_geometry_set,
@@ -1071,7 +1076,6 @@ static GeometrySet compute_geometry(const DerivedNodeTree &tree,
 {
   blender::ResourceScope scope;
   blender::LinearAllocator<> &allocator = scope.linear_allocator();
-  blender::nodes::NodeMultiFunctions mf_by_node{tree};
 
   Map<DOutputSocket, GMutablePointer> group_inputs;
 
@@ -1198,6 +1202,43 @@ static void check_property_socket_sync(const Object *ob, ModifierData *md)
   }
 }
 
+/**
+ * Get the evaluation state derived from the node tree, building and caching it on the tree if
+ * that has not happened yet. When the tree cannot be cached safely (it uses node groups, see
+ * #GeometryNodesEvalCache), the state is built into \a r_local_state instead and has to be
+ * rebuilt for every evaluation.
+ */
+static const GeometryNodesEvalCache &acquire_tree_eval_cache(
+    bNodeTree &btree, std::unique_ptr<GeometryNodesEvalCache> &r_local_state)
+{
+  /* Multiple objects can evaluate the same node tree at the same time. */
+  static std::mutex cache_mutex;
+  {
+    std::lock_guard lock{cache_mutex};
+    if (btree.geometry_nodes_eval_cache != nullptr) {
+      return *btree.geometry_nodes_eval_cache;
+    }
+  }
+
+  /* Build outside of the lock, so that unrelated trees don't block each other. */
+  auto state = std::make_unique<GeometryNodesEvalCache>();
+  state->tree.emplace(btree, state->tree_refs);
+  state->mf_by_node.emplace(*state->tree);
+
+  if (state->tree_refs.size() > 1) {
+    /* The tree uses node groups, which can be rebuilt without this tree changing. */
+    r_local_state = std::move(state);
+    return *r_local_state;
+  }
+
+  std::lock_guard lock{cache_mutex};
+  if (btree.geometry_nodes_eval_cache == nullptr) {
+    /* Another thread may have filled the cache in the meantime; then this copy is discarded. */
+    btree.geometry_nodes_eval_cache = state.release();
+  }
+  return *btree.geometry_nodes_eval_cache;
+}
+
 static void modifyGeometry(ModifierData *md,
                            const ModifierEvalContext *ctx,
                            GeometrySet &geometry_set)
@@ -1209,8 +1250,10 @@ static void modifyGeometry(ModifierData *md,
 
   check_property_socket_sync(ctx->object, md);
 
-  NodeTreeRefMap tree_refs;
-  DerivedNodeTree tree{*nmd->node_group, tree_refs};
+  std::unique_ptr<GeometryNodesEvalCache> local_eval_state;
+  const GeometryNodesEvalCache &eval_state = acquire_tree_eval_cache(*nmd->node_group,
+                                                                     local_eval_state);
+  const DerivedNodeTree &tree = *eval_state.tree;
 
   if (tree.has_link_cycles()) {
     BKE_modifier_set_error(ctx->object, md, "Node group has cycles");
@@ -1243,7 +1286,7 @@ static void modifyGeometry(ModifierData *md,
   }
 
   geometry_set = compute_geometry(
-      tree, input_nodes, output_node, std::move(geometry_set), nmd, ctx);
+      tree, *eval_state.mf_by_node, input_nodes, output_node, std::move(geometry_set), nmd, ctx);
 }
 
 static Mesh *modifyMesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mesh)
@@ -1725,4 +1768,5 @@ ModifierTypeInfo modifierType_Nodes = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ nullptr,
 };
@@ -437,6 +437,22 @@ class NodeParamsProvider : public nodes::GeoNodeExecParamsProvider {
   void set_default_remaining_outputs() override;
 };
 
+/**
+ * Evaluates a geometry node tree by scheduling nodes on a task pool once their required inputs
+ * are available.
+ *
+ * Memory management of intermediate values works as follows:
+ * - A computed output value is moved into the input states of the sockets it is connected to.
+ *   When multiple sockets use the value, all but one get a copy; geometry copies are cheap
+ *   because the components within a #GeometrySet are reference counted.
+ * - Every consumer destructs its own copy as soon as it cannot need it anymore: extracted inputs
+ *   are moved into the node, remaining input values are destructed when the node finishes, and
+ *   values forwarded to inputs that turn out to be unused are destructed on the spot (see
+ *   #finish_node_if_possible, #set_input_unused and #forward_to_sockets_with_same_type).
+ * - Therefore the peak memory usage is determined by the values that are still waiting for their
+ *   consumer to run, not by the total number of intermediate values in the tree. Lazy evaluation
+ *   keeps values in unused branches from being computed in the first place.
+ */
 class GeometryNodesEvaluator {
  private:
   /**
@@ -460,6 +476,15 @@ class GeometryNodesEvaluator {
    */
   VectorSet<NodeWithState> node_states_;
 
+  /**
+   * Group input values that have not been requested by any node yet. Values are moved out of here
+   * and forwarded when a node on the right pulls on the corresponding group input node output.
+   * This way branches that are never requested (e.g. behind a switch) don't receive copies of
+   * potentially large input geometries.
+   */
+  Map<DOutputSocket, GMutablePointer> deferred_input_values_;
+  std::mutex deferred_input_values_mutex_;
+
   /**
    * Contains all the tasks for the nodes that are currently scheduled.
    */
@@ -490,6 +515,7 @@ class GeometryNodesEvaluator {
     BLI_task_pool_work_and_wait(task_pool_);
     BLI_task_pool_free(task_pool_);
 
+    this->destruct_deferred_input_values();
     this->extract_group_outputs();
     this->destruct_node_states();
   }
@@ -676,8 +702,45 @@ class GeometryNodesEvaluator {
         value.destruct();
         continue;
       }
-      this->forward_output(socket, value, nullptr);
+      /* Don't forward the value yet. It is only forwarded once a node pulls on the socket, so
+       * nodes in branches that turn out to be unused never receive a copy. */
+      deferred_input_values_.add_new(socket, value);
+    }
+  }
+
+  /**
+   * Destruct group input values that no node has pulled on during the evaluation. The values are
+   * still logged, so they can be inspected just like before they were forwarded lazily.
+   */
+  void destruct_deferred_input_values()
+  {
+    for (auto &&item : deferred_input_values_.items()) {
+      const DOutputSocket socket = item.key;
+      GMutablePointer value = item.value;
+      this->log_socket_value({socket}, value);
+      value.destruct();
+    }
+    deferred_input_values_.clear();
+  }
+
+  /**
+   * Forward a group input value that has been held back until now. If the value has been forwarded
+   * by an earlier pull already, there is nothing to do; the current puller received its copy then,
+   * because values are only withheld from sockets while their usage is unknown.
+   */
+  void forward_deferred_input_value(const DOutputSocket socket, NodeTaskRunState *run_state)
+  {
+    GMutablePointer value;
+    {
+      std::lock_guard lock{deferred_input_values_mutex_};
+      GMutablePointer *stored_value = deferred_input_values_.lookup_ptr(socket);
+      if (stored_value == nullptr) {
+        return;
+      }
+      value = *stored_value;
+      deferred_input_values_.remove(socket);
     }
+    this->forward_output(socket, value, run_state);
   }
 
   void schedule_initial_nodes()
@@ -692,6 +755,11 @@ class GeometryNodesEvaluator {
     }
     for (const DSocket socket : params_.force_compute_sockets) {
       const DNode node = socket.node();
+      if (socket->is_output() && node->is_group_input_node()) {
+        /* There is no node to schedule, the deferred value just has to be forwarded. */
+        this->forward_deferred_input_value(DOutputSocket(socket), nullptr);
+        continue;
+      }
       NodeState &node_state = this->get_node_state(node);
       this->with_locked_node(node, node_state, nullptr, [&](LockedNode &locked_node) {
         if (socket->is_input()) {
@@ -1356,6 +1424,11 @@ class GeometryNodesEvaluator {
   void send_output_required_notification(const DOutputSocket socket, NodeTaskRunState *run_state)
   {
     const DNode node = socket.node();
+    if (node->is_group_input_node()) {
+      /* Group input nodes are never executed, their values are forwarded on demand instead. */
+      this->forward_deferred_input_value(socket, run_state);
+      return;
+    }
     NodeState &node_state = this->get_node_state(node);
     OutputState &output_state = node_state.outputs[socket->index()];
 
@@ -33,7 +33,7 @@ struct GeometryNodesEvaluationParams {
    * necessary in all cases. Sometimes `log_socket_value_fn` might just want to look at the value
    * and then it can be freed. */
   Vector<DSocket> force_compute_sockets;
-  nodes::NodeMultiFunctions *mf_by_node;
+  const nodes::NodeMultiFunctions *mf_by_node;
   const NodesModifierData *modifier_;
   Depsgraph *depsgraph;
   Object *self_object;
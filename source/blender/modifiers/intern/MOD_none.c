@@ -57,4 +57,5 @@ ModifierTypeInfo modifierType_None = {
     /* panelRegister */ NULL,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
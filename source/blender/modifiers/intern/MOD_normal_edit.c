@@ -787,4 +787,5 @@ ModifierTypeInfo modifierType_NormalEdit = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -740,4 +740,5 @@ ModifierTypeInfo modifierType_Ocean = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
@@ -676,4 +676,5 @@ ModifierTypeInfo modifierType_ParticleInstance = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -333,4 +333,5 @@ ModifierTypeInfo modifierType_ParticleSystem = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
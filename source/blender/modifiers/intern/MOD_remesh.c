@@ -299,4 +299,5 @@ ModifierTypeInfo modifierType_Remesh = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
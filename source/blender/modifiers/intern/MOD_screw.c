@@ -1263,4 +1263,5 @@ ModifierTypeInfo modifierType_Screw = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
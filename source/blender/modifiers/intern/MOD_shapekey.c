@@ -138,4 +138,5 @@ ModifierTypeInfo modifierType_ShapeKey = {
     /* panelRegister */ NULL,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
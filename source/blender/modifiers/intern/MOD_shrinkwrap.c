@@ -290,4 +290,5 @@ ModifierTypeInfo modifierType_Shrinkwrap = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -595,4 +595,5 @@ ModifierTypeInfo modifierType_SimpleDeform = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
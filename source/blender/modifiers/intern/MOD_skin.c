@@ -2102,4 +2102,5 @@ ModifierTypeInfo modifierType_Skin = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -283,4 +283,5 @@ ModifierTypeInfo modifierType_Smooth = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
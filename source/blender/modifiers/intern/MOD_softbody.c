@@ -119,4 +119,5 @@ ModifierTypeInfo modifierType_Softbody = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
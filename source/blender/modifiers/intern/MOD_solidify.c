@@ -273,4 +273,5 @@ ModifierTypeInfo modifierType_Solidify = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -104,6 +104,7 @@ static void freeRuntimeData(void *runtime_data_v)
   if (runtime_data->subdiv != NULL) {
     BKE_subdiv_free(runtime_data->subdiv);
   }
+  BKE_subsurf_modifier_subdiv_cache_clear(runtime_data);
   MEM_freeN(runtime_data);
 }
 
@@ -499,4 +500,5 @@ ModifierTypeInfo modifierType_Subsurf = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
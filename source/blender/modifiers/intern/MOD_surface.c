@@ -244,4 +244,5 @@ ModifierTypeInfo modifierType_Surface = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
@@ -1715,4 +1715,5 @@ ModifierTypeInfo modifierType_SurfaceDeform = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
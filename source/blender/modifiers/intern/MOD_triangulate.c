@@ -138,6 +138,15 @@ static void panelRegister(ARegionType *region_type)
   modifier_panel_register(region_type, eModifierType_Triangulate, panel_draw);
 }
 
+static bool equalsSettings(const ModifierData *md, const ModifierData *other_md)
+{
+  const TriangulateModifierData *tmd = (const TriangulateModifierData *)md;
+  const TriangulateModifierData *other_tmd = (const TriangulateModifierData *)other_md;
+  return (tmd->flag == other_tmd->flag) && (tmd->quad_method == other_tmd->quad_method) &&
+         (tmd->ngon_method == other_tmd->ngon_method) &&
+         (tmd->min_vertices == other_tmd->min_vertices);
+}
+
 ModifierTypeInfo modifierType_Triangulate = {
     /* name */ "Triangulate",
     /* structName */ "TriangulateModifierData",
@@ -171,4 +180,5 @@ ModifierTypeInfo modifierType_Triangulate = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ equalsSettings,
 };
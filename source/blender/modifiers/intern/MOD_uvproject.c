@@ -382,4 +382,5 @@ ModifierTypeInfo modifierType_UVProject = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
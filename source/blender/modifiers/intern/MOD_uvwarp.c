@@ -338,4 +338,5 @@ ModifierTypeInfo modifierType_UVWarp = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -338,4 +338,5 @@ ModifierTypeInfo modifierType_VolumeDisplace = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ nullptr,
 };
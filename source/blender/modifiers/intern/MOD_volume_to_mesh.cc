@@ -222,4 +222,5 @@ ModifierTypeInfo modifierType_VolumeToMesh = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ nullptr,
 };
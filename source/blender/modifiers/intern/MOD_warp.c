@@ -540,4 +540,5 @@ ModifierTypeInfo modifierType_Warp = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
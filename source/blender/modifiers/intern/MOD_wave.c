@@ -493,4 +493,5 @@ ModifierTypeInfo modifierType_Wave = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
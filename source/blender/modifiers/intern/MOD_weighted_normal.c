@@ -758,4 +758,5 @@ ModifierTypeInfo modifierType_WeightedNormal = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -427,4 +427,5 @@ ModifierTypeInfo modifierType_WeightVGEdit = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
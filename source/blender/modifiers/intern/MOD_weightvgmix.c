@@ -513,4 +513,5 @@ ModifierTypeInfo modifierType_WeightVGMix = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -766,4 +766,5 @@ ModifierTypeInfo modifierType_WeightVGProximity = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
+    /* equalsSettings */ NULL,
 };
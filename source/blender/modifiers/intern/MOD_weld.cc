@@ -183,6 +183,14 @@ static void panelRegister(ARegionType *region_type)
   modifier_panel_register(region_type, eModifierType_Weld, panel_draw);
 }
 
+static bool equalsSettings(const ModifierData *md, const ModifierData *other_md)
+{
+  const WeldModifierData *wmd = (const WeldModifierData *)md;
+  const WeldModifierData *other_wmd = (const WeldModifierData *)other_md;
+  return (wmd->merge_dist == other_wmd->merge_dist) && (wmd->mode == other_wmd->mode) &&
+         (wmd->flag == other_wmd->flag) && STREQ(wmd->defgrp_name, other_wmd->defgrp_name);
+}
+
 ModifierTypeInfo modifierType_Weld = {
     /* name */ "Weld",
     /* structName */ "WeldModifierData",
@@ -217,6 +225,7 @@ ModifierTypeInfo modifierType_Weld = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ nullptr,
     /* blendRead */ nullptr,
+    /* equalsSettings */ equalsSettings,
 };
 
 /** \} */
@@ -195,4 +195,5 @@ ModifierTypeInfo modifierType_Wireframe = {
     /* panelRegister */ panelRegister,
     /* blendWrite */ NULL,
     /* blendRead */ NULL,
+    /* equalsSettings */ NULL,
 };
@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include <optional>
+
+#include "NOD_derived_node_tree.hh"
+#include "NOD_multi_function.hh"
+
+namespace blender::nodes {
+
+/**
+ * Evaluation state that is derived from a geometry node tree but does not depend on the modifier
+ * inputs: the tree wrappers used by the evaluator and the multi-functions built for the individual
+ * nodes. Rebuilding this for every modifier evaluation is wasteful during animation playback,
+ * where the tree itself does not change between frames.
+ *
+ * The cache is owned by the evaluated #bNodeTree, so it is freed together with the tree and can
+ * reference it safely. Any change to the tree destroys the cache through the update tagging in
+ * `node_tree_update.cc`. Only trees that don't use node groups are cached, because the dependency
+ * graph can rebuild a nested group tree without changing the tree that references it, which would
+ * leave dangling pointers in #tree_refs.
+ */
+class GeometryNodesEvalCache {
+ public:
+  NodeTreeRefMap tree_refs;
+  /** Optional because construction requires #tree_refs to exist already. */
+  std::optional<DerivedNodeTree> tree;
+  std::optional<NodeMultiFunctions> mf_by_node;
+};
+
+}  // namespace blender::nodes
@@ -6,6 +6,7 @@
 #include "BKE_image.h"
 
 #include "BLI_math_vec_types.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_timeit.hh"
 
@@ -294,26 +295,33 @@ class ImageFieldsFunction : public fn::MultiFunction {
 
     MutableSpan<float4> color_data{(float4 *)r_color.data(), r_color.size()};
 
-    /* Sample image texture. */
+    /* Sample image texture. The buffer is only read, so the lookups for large input masks can
+     * run in parallel. */
     switch (interpolation_) {
       case SHD_INTERP_LINEAR:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_linear_texture_lookup(image_buffer_, p.x, p.y, extension_);
-        }
+        threading::parallel_for(mask.index_range(), 2048, [&](IndexRange range) {
+          for (const int64_t i : mask.slice(range)) {
+            const float3 p = vectors[i];
+            color_data[i] = image_linear_texture_lookup(image_buffer_, p.x, p.y, extension_);
+          }
+        });
         break;
       case SHD_INTERP_CLOSEST:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_closest_texture_lookup(image_buffer_, p.x, p.y, extension_);
-        }
+        threading::parallel_for(mask.index_range(), 2048, [&](IndexRange range) {
+          for (const int64_t i : mask.slice(range)) {
+            const float3 p = vectors[i];
+            color_data[i] = image_closest_texture_lookup(image_buffer_, p.x, p.y, extension_);
+          }
+        });
         break;
       case SHD_INTERP_CUBIC:
       case SHD_INTERP_SMART:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_cubic_texture_lookup(image_buffer_, p.x, p.y, extension_);
-        }
+        threading::parallel_for(mask.index_range(), 512, [&](IndexRange range) {
+          for (const int64_t i : mask.slice(range)) {
+            const float3 p = vectors[i];
+            color_data[i] = image_cubic_texture_lookup(image_buffer_, p.x, p.y, extension_);
+          }
+        });
         break;
     }
 
@@ -325,9 +333,11 @@ class ImageFieldsFunction : public fn::MultiFunction {
     switch (alpha_mode) {
       case IMA_ALPHA_STRAIGHT: {
         /* #ColorGeometry expects premultiplied alpha, so convert from straight to that. */
-        for (int64_t i : mask) {
-          straight_to_premul_v4(color_data[i]);
-        }
+        threading::parallel_for(mask.index_range(), 4096, [&](IndexRange range) {
+          for (const int64_t i : mask.slice(range)) {
+            straight_to_premul_v4(color_data[i]);
+          }
+        });
         break;
       }
       case IMA_ALPHA_PREMUL: {
@@ -340,17 +350,21 @@ class ImageFieldsFunction : public fn::MultiFunction {
       }
       case IMA_ALPHA_IGNORE: {
         /* The image should be treated as being opaque. */
-        for (int64_t i : mask) {
-          color_data[i].w = 1.0f;
-        }
+        threading::parallel_for(mask.index_range(), 4096, [&](IndexRange range) {
+          for (const int64_t i : mask.slice(range)) {
+            color_data[i].w = 1.0f;
+          }
+        });
         break;
       }
     }
 
     if (!r_alpha.is_empty()) {
-      for (int64_t i : mask) {
-        r_alpha[i] = r_color[i].a;
-      }
+      threading::parallel_for(mask.index_range(), 4096, [&](IndexRange range) {
+        for (const int64_t i : mask.slice(range)) {
+          r_alpha[i] = r_color[i].a;
+        }
+      });
     }
   }
 };
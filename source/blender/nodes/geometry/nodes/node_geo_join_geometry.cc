@@ -116,21 +116,7 @@ static void join_components(Span<const InstancesComponent *> src_components, Geo
   dst_component.reserve(tot_instances);
 
   for (const InstancesComponent *src_component : src_components) {
-    Span<InstanceReference> src_references = src_component->references();
-    Array<int> handle_map(src_references.size());
-    for (const int src_handle : src_references.index_range()) {
-      handle_map[src_handle] = dst_component.add_reference(src_references[src_handle]);
-    }
-
-    Span<float4x4> src_transforms = src_component->instance_transforms();
-    Span<int> src_reference_handles = src_component->instance_reference_handles();
-
-    for (const int i : src_transforms.index_range()) {
-      const int src_handle = src_reference_handles[i];
-      const int dst_handle = handle_map[src_handle];
-      const float4x4 &transform = src_transforms[i];
-      dst_component.add_instance(dst_handle, transform);
-    }
+    dst_component.add_instances_from(*src_component);
   }
   join_attributes(to_base_components(src_components), dst_component, {"position"});
 }
@@ -13,6 +13,8 @@
 
 #include <Python.h>
 
+#include "MEM_guardedalloc.h"
+
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
 #include "BLI_utildefines.h"
@@ -370,6 +372,34 @@ static PyObject *bpy_unescape_identifier(PyObject *UNUSED(self), PyObject *value
   return value_unescape;
 }
 
+static void bpy_memory_usage_cb(const char *name,
+                                size_t mem_in_use,
+                                size_t mem_peak,
+                                void *user_data)
+{
+  PyObject *dict = user_data;
+  PyObject *item = PyTuple_New(2);
+  PyTuple_SET_ITEMS(
+      item, PyLong_FromSize_t(mem_in_use), PyLong_FromSize_t(mem_peak));
+  PyDict_SetItemString(dict, name, item);
+  Py_DECREF(item);
+}
+
+PyDoc_STRVAR(bpy_memory_usage_doc,
+             ".. function:: memory_usage()\n"
+             "\n"
+             "   Return memory usage of the named allocation scopes (undo, ID types, ...),\n"
+             "   useful to attribute memory in production files without a heap dump.\n"
+             "\n"
+             "   :return: scope name -> (bytes in use, peak bytes) mapping.\n"
+             "   :rtype: dict\n");
+static PyObject *bpy_memory_usage(PyObject *UNUSED(self))
+{
+  PyObject *dict = PyDict_New();
+  MEM_scope_usage_foreach(bpy_memory_usage_cb, dict);
+  return dict;
+}
+
 static PyMethodDef meth_bpy_script_paths = {
     "script_paths",
     (PyCFunction)bpy_script_paths,
@@ -418,6 +448,12 @@ static PyMethodDef meth_bpy_unescape_identifier = {
     METH_O,
     bpy_unescape_identifier_doc,
 };
+static PyMethodDef meth_bpy_memory_usage = {
+    "memory_usage",
+    (PyCFunction)bpy_memory_usage,
+    METH_NOARGS,
+    bpy_memory_usage_doc,
+};
 
 static PyObject *bpy_import_test(const char *modname)
 {
@@ -521,6 +557,9 @@ void BPy_init_modules(struct bContext *C)
                      (PyObject *)PyCFunction_New(&meth_bpy_unescape_identifier, NULL));
   PyModule_AddObject(
       mod, meth_bpy_flip_name.ml_name, (PyObject *)PyCFunction_New(&meth_bpy_flip_name, NULL));
+  PyModule_AddObject(mod,
+                     meth_bpy_memory_usage.ml_name,
+                     (PyObject *)PyCFunction_New(&meth_bpy_memory_usage, NULL));
 
   /* register funcs (bpy_rna.c) */
   PyModule_AddObject(mod,
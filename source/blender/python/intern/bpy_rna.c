@@ -5364,6 +5364,333 @@ static PyObject *pyrna_prop_collection_foreach_set(BPy_PropertyRNA *self, PyObje
   return foreach_getset(self, args, 1);
 }
 
+static bool foreach_multi_attr_type(PointerRNA *ptrs,
+                                    int num_ptrs,
+                                    const char *attr,
+                                    /* Values to assign. */
+                                    RawPropertyType *r_raw_type,
+                                    int *r_attr_tot,
+                                    bool *r_attr_signed)
+{
+  PropertyRNA *prop;
+  bool attr_ok = true;
+  *r_raw_type = PROP_RAW_UNSET;
+  *r_attr_tot = 0;
+  *r_attr_signed = false;
+
+  /* NOTE: as with #foreach_attr_type, the attribute of the first struct decides
+   * the raw type used for the whole run. */
+  for (int i = 0; i < num_ptrs; i++) {
+    if (ptrs[i].data == NULL) {
+      continue;
+    }
+    prop = RNA_struct_find_property(&ptrs[i], attr);
+    if (prop) {
+      *r_raw_type = RNA_property_raw_type(prop);
+      *r_attr_tot = RNA_property_array_length(&ptrs[i], prop);
+      *r_attr_signed = (RNA_property_subtype(prop) != PROP_UNSIGNED);
+    }
+    else {
+      attr_ok = false;
+    }
+    break;
+  }
+
+  return attr_ok;
+}
+
+/* bpy_rna_foreach_get/set both use this. */
+static int foreach_multi_parse_args(PyObject *args,
+
+                                    /* Values to assign. */
+                                    PointerRNA **r_ptrs,
+                                    int *r_num_ptrs,
+                                    const char **r_attr,
+                                    PyObject **r_seq,
+                                    int *r_tot,
+                                    int *r_size,
+                                    RawPropertyType *r_raw_type,
+                                    int *r_attr_tot,
+                                    bool *r_attr_signed)
+{
+  PyObject *structs;
+  PointerRNA *ptrs;
+
+  *r_ptrs = NULL;
+  *r_num_ptrs = 0;
+  *r_size = *r_attr_tot = 0;
+  *r_attr_signed = false;
+  *r_raw_type = PROP_RAW_UNSET;
+
+  if (!PyArg_ParseTuple(args, "OsO:foreach_get/set", &structs, r_attr, r_seq)) {
+    return -1;
+  }
+
+  if (!PySequence_Check(*r_seq) && PyObject_CheckBuffer(*r_seq)) {
+    PyErr_Format(
+        PyExc_TypeError,
+        "foreach_get/set expected third argument to be a sequence or buffer, not a %.200s",
+        Py_TYPE(*r_seq)->tp_name);
+    return -1;
+  }
+
+  PyObject *structs_fast = PySequence_Fast(structs, "foreach_get/set");
+  if (structs_fast == NULL) {
+    return -1;
+  }
+
+  PyObject **structs_array = PySequence_Fast_ITEMS(structs_fast);
+  const int num_ptrs = (int)PySequence_Fast_GET_SIZE(structs_fast);
+  ptrs = PyMem_Malloc(sizeof(PointerRNA) * num_ptrs);
+
+  for (int i = 0; i < num_ptrs; i++) {
+    if (!BPy_StructRNA_Check(structs_array[i])) {
+      PyErr_Format(PyExc_TypeError,
+                   "foreach_get/set expected a sequence of RNA structs, not a %.200s",
+                   Py_TYPE(structs_array[i])->tp_name);
+      Py_DECREF(structs_fast);
+      PyMem_Free(ptrs);
+      return -1;
+    }
+    ptrs[i] = ((BPy_StructRNA *)structs_array[i])->ptr;
+  }
+  Py_DECREF(structs_fast);
+
+  /* TODO: buffer may not be a sequence! array.array() is though. */
+  *r_tot = PySequence_Size(*r_seq);
+
+  if (*r_tot > 0) {
+    if (!foreach_multi_attr_type(
+            ptrs, num_ptrs, *r_attr, r_raw_type, r_attr_tot, r_attr_signed)) {
+      PyErr_Format(PyExc_AttributeError,
+                   "foreach_get/set structs have no attribute '%.200s'",
+                   *r_attr);
+      PyMem_Free(ptrs);
+      return -1;
+    }
+    *r_size = RNA_raw_type_sizeof(*r_raw_type);
+  }
+
+  /* Check 'r_attr_tot' otherwise we don't know if any values were set.
+   * This isn't ideal because it means running on an empty list may
+   * fail silently when it's not compatible. */
+  if (*r_size == 0 && *r_attr_tot != 0) {
+    PyErr_SetString(PyExc_AttributeError, "attribute does not support foreach method");
+    PyMem_Free(ptrs);
+    return -1;
+  }
+
+  *r_ptrs = ptrs;
+  *r_num_ptrs = num_ptrs;
+  return 0;
+}
+
+static PyObject *foreach_multi_getset(PyObject *args, int set)
+{
+  PyObject *item = NULL;
+  int i = 0, ok = 0;
+  bool buffer_is_compat;
+  void *array = NULL;
+
+  /* Get/set both take the same args currently. */
+  PointerRNA *ptrs;
+  int num_ptrs;
+  const char *attr;
+  PyObject *seq;
+  int tot, size, attr_tot;
+  bool attr_signed;
+  RawPropertyType raw_type;
+
+  if (foreach_multi_parse_args(args,
+                               &ptrs,
+                               &num_ptrs,
+                               &attr,
+                               &seq,
+                               &tot,
+                               &size,
+                               &raw_type,
+                               &attr_tot,
+                               &attr_signed) == -1) {
+    return NULL;
+  }
+
+  if (tot == 0 || num_ptrs == 0) {
+    PyMem_Free(ptrs);
+    Py_RETURN_NONE;
+  }
+
+  if (set) { /* Get the array from python. */
+    buffer_is_compat = false;
+    if (PyObject_CheckBuffer(seq)) {
+      Py_buffer buf;
+      PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT);
+
+      /* Check if the buffer matches. */
+
+      buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+
+      if (buffer_is_compat) {
+        ok = RNA_property_multi_raw_set(NULL, ptrs, num_ptrs, attr, buf.buf, raw_type, tot);
+      }
+
+      PyBuffer_Release(&buf);
+    }
+
+    /* Could not use the buffer, fallback to sequence. */
+    if (!buffer_is_compat) {
+      array = PyMem_Malloc(size * tot);
+
+      for (; i < tot; i++) {
+        item = PySequence_GetItem(seq, i);
+        switch (raw_type) {
+          case PROP_RAW_CHAR:
+            ((char *)array)[i] = (char)PyLong_AsLong(item);
+            break;
+          case PROP_RAW_SHORT:
+            ((short *)array)[i] = (short)PyLong_AsLong(item);
+            break;
+          case PROP_RAW_INT:
+            ((int *)array)[i] = (int)PyLong_AsLong(item);
+            break;
+          case PROP_RAW_BOOLEAN:
+            ((bool *)array)[i] = (int)PyLong_AsLong(item) != 0;
+            break;
+          case PROP_RAW_FLOAT:
+            ((float *)array)[i] = (float)PyFloat_AsDouble(item);
+            break;
+          case PROP_RAW_DOUBLE:
+            ((double *)array)[i] = (double)PyFloat_AsDouble(item);
+            break;
+          case PROP_RAW_UNSET:
+            /* Should never happen. */
+            BLI_assert_msg(0, "Invalid array type - set");
+            break;
+        }
+
+        Py_DECREF(item);
+      }
+
+      ok = RNA_property_multi_raw_set(NULL, ptrs, num_ptrs, attr, array, raw_type, tot);
+    }
+  }
+  else {
+    buffer_is_compat = false;
+    if (PyObject_CheckBuffer(seq)) {
+      Py_buffer buf;
+      PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT);
+
+      /* Check if the buffer matches, TODO: signed/unsigned types. */
+
+      buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+
+      if (buffer_is_compat) {
+        ok = RNA_property_multi_raw_get(NULL, ptrs, num_ptrs, attr, buf.buf, raw_type, tot);
+      }
+
+      PyBuffer_Release(&buf);
+    }
+
+    /* Could not use the buffer, fallback to sequence. */
+    if (!buffer_is_compat) {
+      array = PyMem_Malloc(size * tot);
+
+      ok = RNA_property_multi_raw_get(NULL, ptrs, num_ptrs, attr, array, raw_type, tot);
+
+      if (!ok) {
+        /* Skip the loop. */
+        i = tot;
+      }
+
+      for (; i < tot; i++) {
+
+        switch (raw_type) {
+          case PROP_RAW_CHAR:
+            item = PyLong_FromLong((long)((char *)array)[i]);
+            break;
+          case PROP_RAW_SHORT:
+            item = PyLong_FromLong((long)((short *)array)[i]);
+            break;
+          case PROP_RAW_INT:
+            item = PyLong_FromLong((long)((int *)array)[i]);
+            break;
+          case PROP_RAW_FLOAT:
+            item = PyFloat_FromDouble((double)((float *)array)[i]);
+            break;
+          case PROP_RAW_DOUBLE:
+            item = PyFloat_FromDouble((double)((double *)array)[i]);
+            break;
+          case PROP_RAW_BOOLEAN:
+            item = PyBool_FromLong((long)((bool *)array)[i]);
+            break;
+          default: /* PROP_RAW_UNSET */
+            /* Should never happen. */
+            BLI_assert_msg(0, "Invalid array type - get");
+            item = Py_None;
+            Py_INCREF(item);
+            break;
+        }
+
+        PySequence_SetItem(seq, i, item);
+        Py_DECREF(item);
+      }
+    }
+  }
+
+  PyMem_Free(ptrs);
+
+  if (array) {
+    PyMem_Free(array);
+  }
+
+  if (PyErr_Occurred()) {
+    /* Maybe we could make our own error. */
+    PyErr_Print();
+    PyErr_SetString(PyExc_TypeError, "couldn't access the py sequence");
+    return NULL;
+  }
+  if (!ok) {
+    PyErr_SetString(PyExc_RuntimeError, "internal error setting the array");
+    return NULL;
+  }
+
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(bpy_rna_foreach_get_doc,
+             ".. method:: foreach_get(structs, attr, seq)\n"
+             "\n"
+             "   This is a function to give fast access to the same attribute across\n"
+             "   an arbitrary sequence of RNA structs (e.g. a list of objects),\n"
+             "   avoiding a Python attribute access per item.\n");
+static PyObject *bpy_rna_foreach_get(PyObject *UNUSED(self), PyObject *args)
+{
+  return foreach_multi_getset(args, 0);
+}
+
+PyDoc_STRVAR(bpy_rna_foreach_set_doc,
+             ".. method:: foreach_set(structs, attr, seq)\n"
+             "\n"
+             "   This is a function to give fast write access to the same attribute across\n"
+             "   an arbitrary sequence of RNA structs (e.g. a list of objects),\n"
+             "   avoiding a Python attribute assignment per item.\n");
+static PyObject *bpy_rna_foreach_set(PyObject *UNUSED(self), PyObject *args)
+{
+  return foreach_multi_getset(args, 1);
+}
+
+PyMethodDef BPY_rna_foreach_get_method_def = {
+    "foreach_get",
+    (PyCFunction)bpy_rna_foreach_get,
+    METH_STATIC | METH_VARARGS,
+    bpy_rna_foreach_get_doc,
+};
+PyMethodDef BPY_rna_foreach_set_method_def = {
+    "foreach_set",
+    (PyCFunction)bpy_rna_foreach_set,
+    METH_STATIC | METH_VARARGS,
+    bpy_rna_foreach_set_doc,
+};
+
 static PyObject *pyprop_array_foreach_getset(BPy_PropertyArrayRNA *self,
                                              PyObject *args,
                                              const bool do_set)
@@ -173,6 +173,10 @@ void BPY_update_rna_module(void);
 // PyObject *BPY_rna_doc(void);
 PyObject *BPY_rna_types(void);
 
+/* Batch attribute access over a sequence of structs, registered on `bpy.data`. */
+extern struct PyMethodDef BPY_rna_foreach_get_method_def;
+extern struct PyMethodDef BPY_rna_foreach_set_method_def;
+
 PyObject *pyrna_struct_CreatePyObject(PointerRNA *ptr);
 PyObject *pyrna_prop_CreatePyObject(PointerRNA *ptr, PropertyRNA *prop);
 
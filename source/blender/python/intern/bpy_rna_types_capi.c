@@ -46,6 +46,8 @@ static struct PyMethodDef pyrna_blenddata_methods[] = {
     {NULL, NULL, 0, NULL}, /* #BPY_rna_id_collection_batch_remove_method_def */
     {NULL, NULL, 0, NULL}, /* #BPY_rna_id_collection_orphans_purge_method_def */
     {NULL, NULL, 0, NULL}, /* #BPY_rna_data_context_method_def */
+    {NULL, NULL, 0, NULL}, /* #BPY_rna_foreach_get_method_def */
+    {NULL, NULL, 0, NULL}, /* #BPY_rna_foreach_set_method_def */
     {NULL, NULL, 0, NULL},
 };
 
@@ -209,8 +211,10 @@ void BPY_rna_types_extend_capi(void)
                   BPY_rna_id_collection_user_map_method_def,
                   BPY_rna_id_collection_batch_remove_method_def,
                   BPY_rna_id_collection_orphans_purge_method_def,
-                  BPY_rna_data_context_method_def);
-  BLI_assert(ARRAY_SIZE(pyrna_blenddata_methods) == 5);
+                  BPY_rna_data_context_method_def,
+                  BPY_rna_foreach_get_method_def,
+                  BPY_rna_foreach_set_method_def);
+  BLI_assert(ARRAY_SIZE(pyrna_blenddata_methods) == 7);
   pyrna_struct_type_extend_capi(&RNA_BlendData, pyrna_blenddata_methods, NULL);
 
   /* BlendDataLibraries */
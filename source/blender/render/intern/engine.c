@@ -843,10 +843,15 @@ bool RE_bake_engine(Render *re,
 
   engine->flag &= ~RE_ENGINE_RENDERING;
 
-  engine_depsgraph_free(engine);
+  /* Re-use the engine for the next bake call when persistent data is enabled, so that
+   * renderers which create their own copy of the scene can keep it between objects and
+   * passes instead of performing a full scene sync for every call. */
+  if (!RE_engine_use_persistent_data(engine)) {
+    engine_depsgraph_free(engine);
 
-  RE_engine_free(engine);
-  re->engine = NULL;
+    RE_engine_free(engine);
+    re->engine = NULL;
+  }
 
   if (BKE_reports_contain(re->reports, RPT_ERROR)) {
     G.is_break = true;
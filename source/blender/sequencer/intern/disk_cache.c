@@ -54,6 +54,8 @@
  * Zlib compression with user definable level can be used to compress image data(per image)
  * Images are written in order in which they are rendered.
  * Overwriting of individual entry is not possible.
+ * Writes are queued to a dedicated writer thread (write-behind), so rendering and scrubbing
+ * never stall on disk I/O. The queue is drained before files are invalidated or freed.
  * Stored images are deleted by invalidation, or when size of all files exceeds maximum
  * size specified in user preferences.
  * To distinguish 2 blend files with same name, scene->ed->disk_cache_timestamp
@@ -66,6 +68,10 @@
 #define DCACHE_IMAGES_PER_FILE 100
 #define DCACHE_CURRENT_VERSION 2
 #define COLORSPACE_NAME_MAX 64 /* XXX: defined in IMB intern. */
+/* Maximum number of queued write-behind jobs. Each job holds a reference to an image that is
+ * also in the memory cache, so the cap only bounds how long eviction of those can be delayed;
+ * when the writer falls this far behind, producers block as they did with synchronous writes. */
+#define DCACHE_WRITE_MAX_PENDING 8
 
 typedef struct DiskCacheHeaderEntry {
   unsigned char encoding;
@@ -86,8 +92,23 @@ typedef struct SeqDiskCache {
   ListBase files;
   ThreadMutex read_write_mutex;
   size_t size_total;
+
+  /* Write-behind. */
+  ThreadQueue *write_queue;
+  ListBase write_thread;
+  ThreadMutex pending_mutex;
+  ThreadCondition pending_cond;
+  int num_pending_writes;
 } SeqDiskCache;
 
+typedef struct DiskCacheWriteJob {
+  /* Copy of the key; the original is owned by the memory cache and may be freed while the
+   * job is still queued. */
+  SeqCacheKey key;
+  /* Referenced for the lifetime of the job. */
+  ImBuf *ibuf;
+} DiskCacheWriteJob;
+
 typedef struct DiskCacheFile {
   struct DiskCacheFile *next, *prev;
   char path[FILE_MAX];
@@ -104,6 +125,8 @@ typedef struct DiskCacheFile {
 
 static ThreadMutex cache_create_lock = BLI_MUTEX_INITIALIZER;
 
+static void seq_disk_cache_wait_for_pending_writes(SeqDiskCache *disk_cache);
+
 static char *seq_disk_cache_base_dir(void)
 {
   return U.sequencer_disk_cache_dir;
@@ -408,6 +431,10 @@ void seq_disk_cache_invalidate(SeqDiskCache *disk_cache,
   int start;
   int end;
 
+  /* Drain queued writes first, otherwise a late write-behind job could resurrect a stale
+   * frame on disk after its file was deleted here. */
+  seq_disk_cache_wait_for_pending_writes(disk_cache);
+
   BLI_mutex_lock(&disk_cache->read_write_mutex);
 
   start = seq_changed->startdisp - DCACHE_IMAGES_PER_FILE;
@@ -543,7 +570,7 @@ static int seq_disk_cache_get_header_entry(SeqCacheKey *key, DiskCacheHeader *he
   return -1;
 }
 
-bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
+static bool seq_disk_cache_write_file_impl(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
 {
   BLI_mutex_lock(&disk_cache->read_write_mutex);
 
@@ -595,6 +622,55 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
   return false;
 }
 
+static void *seq_disk_cache_write_thread_fn(void *data)
+{
+  SeqDiskCache *disk_cache = data;
+  DiskCacheWriteJob *job;
+
+  /* Pop returns NULL when the queue is told not to wait on free. */
+  while ((job = BLI_thread_queue_pop(disk_cache->write_queue))) {
+    seq_disk_cache_write_file_impl(disk_cache, &job->key, job->ibuf);
+    seq_disk_cache_enforce_limits(disk_cache);
+    IMB_freeImBuf(job->ibuf);
+    MEM_freeN(job);
+
+    BLI_mutex_lock(&disk_cache->pending_mutex);
+    disk_cache->num_pending_writes--;
+    BLI_condition_notify_all(&disk_cache->pending_cond);
+    BLI_mutex_unlock(&disk_cache->pending_mutex);
+  }
+
+  return NULL;
+}
+
+/* Wait until all queued writes have been written to disk. */
+static void seq_disk_cache_wait_for_pending_writes(SeqDiskCache *disk_cache)
+{
+  BLI_mutex_lock(&disk_cache->pending_mutex);
+  while (disk_cache->num_pending_writes != 0) {
+    BLI_condition_wait(&disk_cache->pending_cond, &disk_cache->pending_mutex);
+  }
+  BLI_mutex_unlock(&disk_cache->pending_mutex);
+}
+
+bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
+{
+  DiskCacheWriteJob *job = MEM_callocN(sizeof(*job), "SeqDiskCacheWriteJob");
+  job->key = *key;
+  job->ibuf = ibuf;
+  IMB_refImBuf(ibuf);
+
+  BLI_mutex_lock(&disk_cache->pending_mutex);
+  while (disk_cache->num_pending_writes >= DCACHE_WRITE_MAX_PENDING) {
+    BLI_condition_wait(&disk_cache->pending_cond, &disk_cache->pending_mutex);
+  }
+  disk_cache->num_pending_writes++;
+  BLI_mutex_unlock(&disk_cache->pending_mutex);
+
+  BLI_thread_queue_push(disk_cache->write_queue, job);
+  return true;
+}
+
 ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 {
   BLI_mutex_lock(&disk_cache->read_write_mutex);
@@ -668,6 +744,11 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
   SeqDiskCache *disk_cache = MEM_callocN(sizeof(SeqDiskCache), "SeqDiskCache");
   disk_cache->bmain = bmain;
   BLI_mutex_init(&disk_cache->read_write_mutex);
+  BLI_mutex_init(&disk_cache->pending_mutex);
+  BLI_condition_init(&disk_cache->pending_cond);
+  disk_cache->write_queue = BLI_thread_queue_init();
+  BLI_threadpool_init(&disk_cache->write_thread, seq_disk_cache_write_thread_fn, 1);
+  BLI_threadpool_insert(&disk_cache->write_thread, disk_cache);
   seq_disk_cache_handle_versioning(disk_cache);
   seq_disk_cache_get_files(disk_cache, seq_disk_cache_base_dir());
   disk_cache->timestamp = scene->ed->disk_cache_timestamp;
@@ -677,6 +758,13 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 
 void seq_disk_cache_free(SeqDiskCache *disk_cache)
 {
+  seq_disk_cache_wait_for_pending_writes(disk_cache);
+  BLI_thread_queue_nowait(disk_cache->write_queue);
+  BLI_threadpool_end(&disk_cache->write_thread);
+  BLI_thread_queue_free(disk_cache->write_queue);
+  BLI_condition_end(&disk_cache->pending_cond);
+  BLI_mutex_end(&disk_cache->pending_mutex);
+
   BLI_freelistN(&disk_cache->files);
   BLI_mutex_end(&disk_cache->read_write_mutex);
   MEM_freeN(disk_cache);
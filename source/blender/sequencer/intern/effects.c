@@ -17,6 +17,7 @@
 #include "BLI_math.h" /* windows needs for M_PI */
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
+#include "BLI_simd.h"
 #include "BLI_string.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
@@ -417,17 +418,36 @@ static void do_cross_effect_byte(
   int temp_fac = (int)(256.0f * fac);
   int temp_mfac = 256 - temp_fac;
 
-  for (int i = 0; i < y; i++) {
-    for (int j = 0; j < x; j++) {
-      rt[0] = (temp_mfac * rt1[0] + temp_fac * rt2[0]) >> 8;
-      rt[1] = (temp_mfac * rt1[1] + temp_fac * rt2[1]) >> 8;
-      rt[2] = (temp_mfac * rt1[2] + temp_fac * rt2[2]) >> 8;
-      rt[3] = (temp_mfac * rt1[3] + temp_fac * rt2[3]) >> 8;
+  int tot = x * y;
 
-      rt1 += 4;
-      rt2 += 4;
-      rt += 4;
-    }
+#ifdef BLI_HAVE_SSE2
+  /* Blend 4 pixels at a time: widen to 16 bit, blend with the same fixed point factors as the
+   * scalar path, shift back and pack. Products stay below 256 * 255 so 16 bits are enough. */
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i v_fac = _mm_set1_epi16((short)temp_fac);
+  const __m128i v_mfac = _mm_set1_epi16((short)temp_mfac);
+  for (; tot >= 4; tot -= 4, rt1 += 16, rt2 += 16, rt += 16) {
+    const __m128i a = _mm_loadu_si128((const __m128i *)rt1);
+    const __m128i b = _mm_loadu_si128((const __m128i *)rt2);
+    const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), v_mfac),
+                                                    _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), v_fac)),
+                                      8);
+    const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), v_mfac),
+                                                    _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), v_fac)),
+                                      8);
+    _mm_storeu_si128((__m128i *)rt, _mm_packus_epi16(lo, hi));
+  }
+#endif
+
+  for (; tot > 0; tot--) {
+    rt[0] = (temp_mfac * rt1[0] + temp_fac * rt2[0]) >> 8;
+    rt[1] = (temp_mfac * rt1[1] + temp_fac * rt2[1]) >> 8;
+    rt[2] = (temp_mfac * rt1[2] + temp_fac * rt2[2]) >> 8;
+    rt[3] = (temp_mfac * rt1[3] + temp_fac * rt2[3]) >> 8;
+
+    rt1 += 4;
+    rt2 += 4;
+    rt += 4;
   }
 }
 
@@ -439,18 +459,28 @@ static void do_cross_effect_float(float fac, int x, int y, float *rect1, float *
 
   float mfac = 1.0f - fac;
 
-  for (int i = 0; i < y; i++) {
-    for (int j = 0; j < x; j++) {
-      rt[0] = mfac * rt1[0] + fac * rt2[0];
-      rt[1] = mfac * rt1[1] + fac * rt2[1];
-      rt[2] = mfac * rt1[2] + fac * rt2[2];
-      rt[3] = mfac * rt1[3] + fac * rt2[3];
+  int tot = x * y;
 
-      rt1 += 4;
-      rt2 += 4;
-      rt += 4;
-    }
+#ifdef BLI_HAVE_SSE2
+  const __m128 v_fac = _mm_set1_ps(fac);
+  const __m128 v_mfac = _mm_set1_ps(mfac);
+  for (; tot > 0; tot--, rt1 += 4, rt2 += 4, rt += 4) {
+    const __m128 a = _mm_loadu_ps(rt1);
+    const __m128 b = _mm_loadu_ps(rt2);
+    _mm_storeu_ps(rt, _mm_add_ps(_mm_mul_ps(a, v_mfac), _mm_mul_ps(b, v_fac)));
+  }
+#else
+  for (; tot > 0; tot--) {
+    rt[0] = mfac * rt1[0] + fac * rt2[0];
+    rt[1] = mfac * rt1[1] + fac * rt2[1];
+    rt[2] = mfac * rt1[2] + fac * rt2[2];
+    rt[3] = mfac * rt1[3] + fac * rt2[3];
+
+    rt1 += 4;
+    rt2 += 4;
+    rt += 4;
   }
+#endif
 }
 
 static void do_cross_effect(const SeqRenderData *context,
@@ -40,6 +40,7 @@
 #include "disk_cache.h"
 #include "image_cache.h"
 #include "prefetch.h"
+#include "render.h"
 #include "strip_time.h"
 
 /**
@@ -568,6 +569,9 @@ void seq_cache_free_temp_cache(Scene *scene, short id, int timeline_frame)
 
 void seq_cache_destruct(Scene *scene)
 {
+  /* The freed scene may be the source of cached scene strip renders. */
+  seq_scene_strip_cache_invalidate(NULL);
+
   SeqCache *cache = seq_cache_get_from_scene(scene);
   if (!cache) {
     return;
@@ -879,8 +883,8 @@ void seq_cache_put(
         seq_disk_cache_create(context->bmain, context->scene);
       }
 
+      /* Queued to a writer thread; size limits are enforced there after each write. */
       seq_disk_cache_write_file(cache->disk_cache, key, i);
-      seq_disk_cache_enforce_limits(cache->disk_cache);
     }
   }
 }
@@ -70,6 +70,9 @@ typedef struct PrefetchJob {
   /* prefetch area */
   float cfra;
   int num_frames_prefetched;
+  /* 1 when prefetching ahead of the playhead, -1 when the playhead moves backward and frames
+   * behind it are prefetched instead (reverse playback and scrubbing). */
+  int direction;
 
   /* control */
   bool running;
@@ -172,7 +175,7 @@ static bool seq_prefetch_is_cache_full(Scene *scene)
 
 static float seq_prefetch_cfra(PrefetchJob *pfjob)
 {
-  return pfjob->cfra + pfjob->num_frames_prefetched;
+  return pfjob->cfra + pfjob->direction * pfjob->num_frames_prefetched;
 }
 static AnimationEvalContext seq_prefetch_anim_eval_context(PrefetchJob *pfjob)
 {
@@ -183,8 +186,14 @@ void seq_prefetch_get_time_range(Scene *scene, int *start, int *end)
 {
   PrefetchJob *pfjob = seq_prefetch_job_get(scene);
 
-  *start = pfjob->cfra;
-  *end = seq_prefetch_cfra(pfjob);
+  if (pfjob->direction == -1) {
+    *start = seq_prefetch_cfra(pfjob);
+    *end = pfjob->cfra;
+  }
+  else {
+    *start = pfjob->cfra;
+    *end = seq_prefetch_cfra(pfjob);
+  }
 }
 
 static void seq_prefetch_free_depsgraph(PrefetchJob *pfjob)
@@ -224,21 +233,44 @@ static void seq_prefetch_update_area(PrefetchJob *pfjob)
 {
   int cfra = pfjob->scene->r.cfra;
 
-  /* rebase */
-  if (cfra > pfjob->cfra) {
-    int delta = cfra - pfjob->cfra;
-    pfjob->cfra = cfra;
-    pfjob->num_frames_prefetched -= delta;
+  if (pfjob->direction == 1) {
+    /* rebase */
+    if (cfra > pfjob->cfra) {
+      int delta = cfra - pfjob->cfra;
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched -= delta;
+
+      if (pfjob->num_frames_prefetched <= 1) {
+        pfjob->num_frames_prefetched = 1;
+      }
+    }
 
-    if (pfjob->num_frames_prefetched <= 1) {
+    /* Playhead moved backward - turn around and keep a backward window, so reverse scrubbing
+     * and playback find frames behind the playhead in cache. */
+    if (cfra < pfjob->cfra) {
+      pfjob->direction = -1;
+      pfjob->cfra = cfra;
       pfjob->num_frames_prefetched = 1;
     }
   }
+  else {
+    /* rebase */
+    if (cfra < pfjob->cfra) {
+      int delta = pfjob->cfra - cfra;
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched -= delta;
+
+      if (pfjob->num_frames_prefetched <= 1) {
+        pfjob->num_frames_prefetched = 1;
+      }
+    }
 
-  /* reset */
-  if (cfra < pfjob->cfra) {
-    pfjob->cfra = cfra;
-    pfjob->num_frames_prefetched = 1;
+    /* Turn around. */
+    if (cfra > pfjob->cfra) {
+      pfjob->direction = 1;
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched = 1;
+    }
   }
 }
 
@@ -444,10 +476,18 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *seqbase)
   return false;
 }
 
+static bool seq_prefetch_reached_scene_range_end(PrefetchJob *pfjob)
+{
+  if (pfjob->direction == -1) {
+    return seq_prefetch_cfra(pfjob) <= pfjob->scene->r.sfra;
+  }
+  return seq_prefetch_cfra(pfjob) >= pfjob->scene->r.efra;
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
-         (seq_prefetch_cfra(pfjob) >= pfjob->scene->r.efra);
+         seq_prefetch_reached_scene_range_end(pfjob);
 }
 
 static void seq_prefetch_do_suspend(PrefetchJob *pfjob)
@@ -467,7 +507,8 @@ static void *seq_prefetch_frames(void *job)
 {
   PrefetchJob *pfjob = (PrefetchJob *)job;
 
-  while (seq_prefetch_cfra(pfjob) <= pfjob->scene->r.efra) {
+  while (pfjob->direction == 1 ? seq_prefetch_cfra(pfjob) <= pfjob->scene->r.efra :
+                                 seq_prefetch_cfra(pfjob) >= pfjob->scene->r.sfra) {
     pfjob->scene_eval->ed->prefetch_job = NULL;
 
     seq_prefetch_update_depsgraph(pfjob);
@@ -499,7 +540,7 @@ static void *seq_prefetch_frames(void *job)
 
     /* Avoid "collision" with main thread, but make sure to fetch at least few frames */
     if (pfjob->num_frames_prefetched > 5 &&
-        (seq_prefetch_cfra(pfjob) - pfjob->scene->r.cfra) < 2) {
+        pfjob->direction * (seq_prefetch_cfra(pfjob) - pfjob->scene->r.cfra) < 2) {
       break;
     }
 
@@ -538,6 +579,10 @@ static PrefetchJob *seq_prefetch_start_ex(const SeqRenderData *context, float cf
   }
   pfjob->bmain = context->bmain;
 
+  /* When the playhead arrived here moving backward, prefetch backward: the user is likely to
+   * keep going that way, and frames behind the playhead are the expensive ones to decode for
+   * long-GOP movies. */
+  pfjob->direction = (cfra < pfjob->cfra) ? -1 : 1;
   pfjob->cfra = cfra;
   pfjob->num_frames_prefetched = 1;
 
@@ -14,6 +14,7 @@
 #include "DNA_anim_types.h"
 #include "DNA_defaults.h"
 #include "DNA_mask_types.h"
+#include "DNA_object_types.h"
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 #include "DNA_space_types.h"
@@ -22,6 +23,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
+#include "BLI_trace.h"
 
 #include "BKE_anim_data.h"
 #include "BKE_animsys.h"
@@ -1319,6 +1321,138 @@ static ImBuf *seq_render_mask_strip(const SeqRenderData *context, Sequence *seq,
   return seq_render_mask(context, seq->mask, frame_index, make_float);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Scene Strip Render Cache
+ * \{ */
+
+/* Scene strips referencing the same scene render identical frames once per strip, which is
+ * common in multi-cam edits where several strips show one scene. Remember the most recent
+ * scene renders keyed on everything that influences the result, so further strips reuse the
+ * pixels instead of kicking off another full render.
+ *
+ * Keys store session UUID's instead of pointers, so an entry can never match a different
+ * data-block allocated at a recycled address. Entries are dropped whenever scene strips are
+ * invalidated, see #seq_scene_strip_cache_invalidate. */
+
+#define SCENE_STRIP_CACHE_SIZE 8
+
+typedef struct SceneStripCacheEntry {
+  unsigned int scene_session_uuid;
+  /* MAIN_ID_SESSION_UUID_UNSET when rendering without a camera (compositing scenes). */
+  unsigned int camera_session_uuid;
+  /* Float buffers are converted into the sequencer working space of the scene being edited, so
+   * the pixels can only be reused by strips of that same scene. */
+  unsigned int editing_scene_session_uuid;
+  double frame;
+  /* Render size at the time the entry was stored, so render size changes miss the cache. */
+  int width, height;
+  int view_id;
+  /* NULL for unused slots. */
+  ImBuf *ibuf;
+} SceneStripCacheEntry;
+
+static SceneStripCacheEntry scene_strip_cache[SCENE_STRIP_CACHE_SIZE];
+static int scene_strip_cache_next_slot = 0;
+static ThreadMutex scene_strip_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+static void seq_scene_strip_cache_key(SceneStripCacheEntry *r_key,
+                                      const Scene *scene,
+                                      const Object *camera,
+                                      const Scene *editing_scene,
+                                      double frame,
+                                      int view_id)
+{
+  r_key->scene_session_uuid = scene->id.session_uuid;
+  r_key->camera_session_uuid = (camera != NULL) ? camera->id.session_uuid :
+                                                  MAIN_ID_SESSION_UUID_UNSET;
+  r_key->editing_scene_session_uuid = editing_scene->id.session_uuid;
+  r_key->frame = frame;
+  r_key->width = (scene->r.xsch * scene->r.size) / 100;
+  r_key->height = (scene->r.ysch * scene->r.size) / 100;
+  r_key->view_id = view_id;
+  r_key->ibuf = NULL;
+}
+
+static bool seq_scene_strip_cache_key_equal(const SceneStripCacheEntry *a,
+                                            const SceneStripCacheEntry *b)
+{
+  return (a->scene_session_uuid == b->scene_session_uuid &&
+          a->camera_session_uuid == b->camera_session_uuid &&
+          a->editing_scene_session_uuid == b->editing_scene_session_uuid &&
+          a->frame == b->frame && a->width == b->width && a->height == b->height &&
+          a->view_id == b->view_id);
+}
+
+/* Returns a new reference to the cached render of this scene/camera/frame combination,
+ * or NULL when it has to be rendered. */
+static ImBuf *seq_scene_strip_cache_get(
+    const Scene *scene, const Object *camera, const Scene *editing_scene, double frame, int view_id)
+{
+  SceneStripCacheEntry key;
+  ImBuf *ibuf = NULL;
+
+  seq_scene_strip_cache_key(&key, scene, camera, editing_scene, frame, view_id);
+
+  BLI_mutex_lock(&scene_strip_cache_mutex);
+  for (int i = 0; i < SCENE_STRIP_CACHE_SIZE; i++) {
+    SceneStripCacheEntry *entry = &scene_strip_cache[i];
+    if (entry->ibuf != NULL && seq_scene_strip_cache_key_equal(entry, &key)) {
+      ibuf = entry->ibuf;
+      IMB_refImBuf(ibuf);
+      break;
+    }
+  }
+  BLI_mutex_unlock(&scene_strip_cache_mutex);
+
+  return ibuf;
+}
+
+static void seq_scene_strip_cache_put(const Scene *scene,
+                                      const Object *camera,
+                                      const Scene *editing_scene,
+                                      double frame,
+                                      int view_id,
+                                      ImBuf *ibuf)
+{
+  SceneStripCacheEntry key;
+
+  if (ibuf == NULL) {
+    return;
+  }
+
+  seq_scene_strip_cache_key(&key, scene, camera, editing_scene, frame, view_id);
+
+  BLI_mutex_lock(&scene_strip_cache_mutex);
+  SceneStripCacheEntry *entry = &scene_strip_cache[scene_strip_cache_next_slot];
+  scene_strip_cache_next_slot = (scene_strip_cache_next_slot + 1) % SCENE_STRIP_CACHE_SIZE;
+  if (entry->ibuf != NULL) {
+    IMB_freeImBuf(entry->ibuf);
+  }
+  *entry = key;
+  entry->ibuf = ibuf;
+  IMB_refImBuf(ibuf);
+  BLI_mutex_unlock(&scene_strip_cache_mutex);
+}
+
+void seq_scene_strip_cache_invalidate(const Scene *scene_target)
+{
+  BLI_mutex_lock(&scene_strip_cache_mutex);
+  for (int i = 0; i < SCENE_STRIP_CACHE_SIZE; i++) {
+    SceneStripCacheEntry *entry = &scene_strip_cache[i];
+    if (entry->ibuf == NULL) {
+      continue;
+    }
+    if (scene_target != NULL && entry->scene_session_uuid != scene_target->id.session_uuid) {
+      continue;
+    }
+    IMB_freeImBuf(entry->ibuf);
+    entry->ibuf = NULL;
+  }
+  BLI_mutex_unlock(&scene_strip_cache_mutex);
+}
+
+/** \} */
+
 static ImBuf *seq_render_scene_strip(const SeqRenderData *context,
                                      Sequence *seq,
                                      float frame_index,
@@ -1479,6 +1613,10 @@ static ImBuf *seq_render_scene_strip(const SeqRenderData *context,
       fprintf(stderr, "seq_render_scene_strip failed to get opengl buffer: %s\n", err_out);
     }
   }
+  else if ((ibuf = seq_scene_strip_cache_get(
+                scene, camera, context->scene, frame, context->view_id)) != NULL) {
+    /* Another strip already rendered this scene/camera/frame combination, reuse its pixels. */
+  }
   else {
     Render *re = RE_GetSceneRender(scene);
     const int totviews = BKE_scene_multiview_num_views_get(&scene->r);
@@ -1534,6 +1672,8 @@ static ImBuf *seq_render_scene_strip(const SeqRenderData *context,
         memcpy(ibufs_arr[view_id]->rect, rres.rect32, 4 * rres.rectx * rres.recty);
       }
 
+      seq_scene_strip_cache_put(scene, camera, context->scene, frame, view_id, ibufs_arr[view_id]);
+
       if (view_id != context->view_id) {
         seq_cache_put(&localcontext, seq, timeline_frame, SEQ_CACHE_STORE_RAW, ibufs_arr[view_id]);
       }
@@ -1717,6 +1857,8 @@ ImBuf *seq_render_strip(const SeqRenderData *context,
     return ibuf;
   }
 
+  BLI_trace_zone_begin(seq->name + 2);
+
   /* Proxies are not stored in cache. */
   if (!SEQ_can_use_proxy(
           context, seq, SEQ_rendersize_to_proxysize(context->preview_render_size))) {
@@ -1738,6 +1880,8 @@ ImBuf *seq_render_strip(const SeqRenderData *context,
     seq_imbuf_assign_spaces(context->scene, ibuf);
   }
 
+  BLI_trace_zone_end();
+
   return ibuf;
 }
 
@@ -56,6 +56,11 @@ struct ImBuf *seq_render_mask(const struct SeqRenderData *context,
                               float frame_index,
                               bool make_float);
 void seq_imbuf_assign_spaces(struct Scene *scene, struct ImBuf *ibuf);
+/**
+ * Drop cached scene strip renders of \a scene_target,
+ * or all cached scene strip renders when it is NULL.
+ */
+void seq_scene_strip_cache_invalidate(const struct Scene *scene_target);
 
 #ifdef __cplusplus
 }
@@ -32,6 +32,7 @@
 
 #include "effects.h"
 #include "image_cache.h"
+#include "render.h"
 #include "utils.h"
 
 /* check whether sequence cur depends on seq */
@@ -202,6 +203,8 @@ static void invalidate_scene_strips(Scene *scene, Scene *scene_target, ListBase
 
 void SEQ_relations_invalidate_scene_strips(Main *bmain, Scene *scene_target)
 {
+  seq_scene_strip_cache_invalidate(scene_target);
+
   for (Scene *scene = bmain->scenes.first; scene != NULL; scene = scene->id.next) {
     if (scene->ed != NULL) {
       invalidate_scene_strips(scene, scene_target, &scene->ed->seqbase);
@@ -241,6 +244,7 @@ void SEQ_relations_free_imbuf(Scene *scene, ListBase *seqbase, bool for_render)
 
   SEQ_cache_cleanup(scene);
   SEQ_prefetch_stop(scene);
+  seq_scene_strip_cache_invalidate(NULL);
 
   for (seq = seqbase->first; seq; seq = seq->next) {
     if (for_render && SEQ_time_strip_intersects_frame(seq, CFRA)) {
@@ -18,6 +18,7 @@
 #  include "DNA_texture_types.h"
 
 #  include "BLI_math.h"
+#  include "BLI_task.h"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.h"
@@ -628,6 +629,57 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   del_lfvector(temp);
 }
 
+/* Threaded version of the multiply above. Instead of scattering every block into the rows it
+ * touches, each row gathers from its own blocks through the index built by
+ * implicit_rows_index_build(), so rows are fully independent and each one keeps a fixed
+ * summation order across runs (see the note on threading in dot_lfvector()). */
+typedef struct MulBFMatrixData {
+  fmatrix3x3 *from;
+  lfVector *fLongVector;
+  lfVector *to;
+  const unsigned int *row_offsets;
+  const unsigned int *row_blocks;
+} MulBFMatrixData;
+
+static void mul_bfmatrix_lfvector_task_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MulBFMatrixData *data = userdata;
+  float result[3] = {0.0f, 0.0f, 0.0f};
+  unsigned int b;
+
+  for (b = data->row_offsets[i]; b < data->row_offsets[i + 1]; b++) {
+    const unsigned int ref = data->row_blocks[b];
+    fmatrix3x3 *block = &data->from[ref >> 1];
+
+    if (ref & 1) {
+      /* Upper triangle contribution of a block stored in the lower triangle. */
+      muladd_fmatrixT_fvector(result, block->m, data->fLongVector[block->r]);
+    }
+    else {
+      muladd_fmatrix_fvector(result, block->m, data->fLongVector[block->c]);
+    }
+  }
+  copy_v3_v3(data->to[i], result);
+}
+
+static void mul_bfmatrix_lfvector_threaded(float (*to)[3],
+                                           fmatrix3x3 *from,
+                                           const unsigned int *row_offsets,
+                                           const unsigned int *row_blocks,
+                                           lfVector *fLongVector)
+{
+  MulBFMatrixData data = {from, fLongVector, to, row_offsets, row_blocks};
+  TaskParallelSettings settings;
+
+  BLI_parallel_range_settings_defaults(&settings);
+  /* Same threshold the OpenMP sections above use. */
+  settings.min_iter_per_thread = 512;
+  BLI_task_parallel_range(
+      0, (int)from[0].vcount, &data, mul_bfmatrix_lfvector_task_cb, &settings);
+}
+
 /* SPARSE SYMMETRIC sub big matrix with big matrix. */
 /* A -= B * float + C * float --> for big matrix */
 /* VERIFIED */
@@ -667,6 +719,11 @@ typedef struct Implicit_Data {
   lfVector *z;          /* target velocity in constrained directions */
   fmatrix3x3 *S;        /* filtering matrix for constraints */
   fmatrix3x3 *P, *Pinv; /* pre-conditioning matrix */
+
+  /* Per-row gather index for the threaded matrix-vector multiply, rebuilt for every solve
+   * since collision springs change the block layout between steps. */
+  unsigned int *row_offsets; /* start of each vertex row in row_blocks, vcount + 1 entries */
+  unsigned int *row_blocks;  /* block indices per row, lowest bit set for transposed blocks */
 } Implicit_Data;
 
 Implicit_Data *SIM_mass_spring_solver_create(int numverts, int numsprings)
@@ -692,6 +749,12 @@ Implicit_Data *SIM_mass_spring_solver_create(int numverts, int numsprings)
   id->dV = create_lfvector(numverts);
   id->z = create_lfvector(numverts);
 
+  id->row_offsets = (unsigned int *)MEM_mallocN(sizeof(unsigned int) * (numverts + 1),
+                                                "cloth_implicit_row_offsets");
+  id->row_blocks = (unsigned int *)MEM_mallocN(sizeof(unsigned int) *
+                                                   (numverts + 2 * numsprings),
+                                               "cloth_implicit_row_blocks");
+
   initdiag_bfmatrix(id->bigI, I);
 
   return id;
@@ -718,6 +781,9 @@ void SIM_mass_spring_solver_free(Implicit_Data *id)
   del_lfvector(id->dV);
   del_lfvector(id->z);
 
+  MEM_freeN(id->row_offsets);
+  MEM_freeN(id->row_blocks);
+
   MEM_freeN(id);
 }
 
@@ -839,6 +905,8 @@ static int cg_filtered(lfVector *ldV,
                        lfVector *lB,
                        lfVector *z,
                        fmatrix3x3 *S,
+                       const unsigned int *row_offsets,
+                       const unsigned int *row_blocks,
                        ImplicitSolverResult *result)
 {
   /* Solves for unknown X in equation AX=B */
@@ -863,7 +931,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_lfvector_threaded(AdV, lA, row_offsets, row_blocks, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -886,7 +954,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_lfvector_threaded(q, lA, row_offsets, row_blocks, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -1135,6 +1203,43 @@ static int cg_filtered_pre(lfVector *dv,
 }
 #  endif
 
+/* Build the per-row gather index used by mul_bfmatrix_lfvector_threaded(). All big matrices
+ * share one block layout (see SIM_mass_spring_add_block), so a single index serves every
+ * multiply of a solve. */
+static void implicit_rows_index_build(Implicit_Data *data)
+{
+  const fmatrix3x3 *m = data->A;
+  const unsigned int vcount = m[0].vcount, scount = m[0].scount;
+  unsigned int *offsets = data->row_offsets;
+  unsigned int *blocks = data->row_blocks;
+  unsigned int *cursor;
+  unsigned int i;
+
+  /* Count a direct and a transposed contribution per off-diagonal block
+   * (the stored lower triangle implies the upper one). */
+  memset(offsets, 0, sizeof(*offsets) * (vcount + 1));
+  for (i = vcount; i < vcount + scount; i++) {
+    offsets[m[i].r + 1]++;
+    offsets[m[i].c + 1]++;
+  }
+  for (i = 1; i <= vcount; i++) {
+    /* Plus one diagonal block per row. */
+    offsets[i] += offsets[i - 1] + 1;
+  }
+
+  cursor = (unsigned int *)MEM_mallocN(sizeof(unsigned int) * vcount, "cloth_implicit_row_cursor");
+  for (i = 0; i < vcount; i++) {
+    /* The diagonal block always comes first in its row. */
+    blocks[offsets[i]] = (i << 1);
+    cursor[i] = offsets[i] + 1;
+  }
+  for (i = vcount; i < vcount + scount; i++) {
+    blocks[cursor[m[i].r]++] = (i << 1);
+    blocks[cursor[m[i].c]++] = (i << 1) | 1;
+  }
+  MEM_freeN(cursor);
+}
+
 bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSolverResult *result)
 {
   unsigned int numverts = data->dFdV[0].vcount;
@@ -1146,7 +1251,9 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 
   subadd_bfmatrixS_bfmatrixS(data->A, data->dFdV, dt, data->dFdX, (dt * dt));
 
-  mul_bfmatrix_lfvector(dFdXmV, data->dFdX, data->V);
+  implicit_rows_index_build(data);
+
+  mul_bfmatrix_lfvector_threaded(dFdXmV, data->dFdX, data->row_offsets, data->row_blocks, data->V);
 
   add_lfvectorS_lfvectorS(data->B, data->F, dt, dFdXmV, (dt * dt), numverts);
 
@@ -1155,7 +1262,8 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 #  endif
 
   /* Conjugate gradient algorithm to solve Ax=b. */
-  cg_filtered(data->dV, data->A, data->B, data->z, data->S, result);
+  cg_filtered(
+      data->dV, data->A, data->B, data->z, data->S, data->row_offsets, data->row_blocks, result);
 
   // cg_filtered_pre(id->dV, id->A, id->B, id->z, id->S, id->P, id->Pinv, id->bigI);
 
@@ -27,6 +27,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_dynstr.h"
+#include "BLI_ghash.h"
 #include "BLI_math.h"
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
@@ -89,7 +90,7 @@
  */
 #define USE_GIZMO_MOUSE_PRIORITY_HACK
 
-static void wm_notifier_clear(wmNotifier *note);
+static void wm_notifier_clear(wmWindowManager *wm, wmNotifier *note);
 
 static int wm_operator_call_internal(bContext *C,
                                      wmOperatorType *ot,
@@ -215,36 +216,59 @@ void wm_event_init_from_window(wmWindow *win, wmEvent *event)
 /** \name Notifiers & Listeners
  * \{ */
 
-static bool wm_test_duplicate_notifier(const wmWindowManager *wm, uint type, void *reference)
+/**
+ * Hash for #wmWindowManager.notifier_queue_set, ignores the `window` member
+ * as duplicate detection always did.
+ */
+static uint wm_notifier_hash_for_queue_fn(const void *ptr)
 {
-  LISTBASE_FOREACH (wmNotifier *, note, &wm->notifier_queue) {
-    if ((note->category | note->data | note->subtype | note->action) == type &&
-        note->reference == reference) {
-      return true;
-    }
-  }
+  const wmNotifier *note = ptr;
+  return (BLI_ghashutil_ptrhash(note->reference) ^
+          (note->category | note->data | note->subtype | note->action));
+}
 
-  return false;
+static bool wm_notifier_cmp_for_queue_fn(const void *a, const void *b)
+{
+  const wmNotifier *note_a = a;
+  const wmNotifier *note_b = b;
+  return !(((note_a->category | note_a->data | note_a->subtype | note_a->action) ==
+            (note_b->category | note_b->data | note_b->subtype | note_b->action)) &&
+           (note_a->reference == note_b->reference));
 }
 
 void WM_event_add_notifier_ex(wmWindowManager *wm, const wmWindow *win, uint type, void *reference)
 {
-  if (wm_test_duplicate_notifier(wm, type, reference)) {
+  if (wm == NULL) {
     return;
   }
 
-  wmNotifier *note = MEM_callocN(sizeof(wmNotifier), "notifier");
+  wmNotifier note_test = {NULL};
 
-  BLI_addtail(&wm->notifier_queue, note);
+  note_test.window = win;
+
+  note_test.category = type & NOTE_CATEGORY;
+  note_test.data = type & NOTE_DATA;
+  note_test.subtype = type & NOTE_SUBTYPE;
+  note_test.action = type & NOTE_ACTION;
 
-  note->window = win;
+  note_test.reference = reference;
 
-  note->category = type & NOTE_CATEGORY;
-  note->data = type & NOTE_DATA;
-  note->subtype = type & NOTE_SUBTYPE;
-  note->action = type & NOTE_ACTION;
+  if (wm->notifier_queue_set == NULL) {
+    wm->notifier_queue_set = BLI_gset_new_ex(
+        wm_notifier_hash_for_queue_fn, wm_notifier_cmp_for_queue_fn, __func__, 1024);
+  }
 
-  note->reference = reference;
+  void **note_p;
+  if (BLI_gset_ensure_p_ex(wm->notifier_queue_set, &note_test, &note_p)) {
+    /* Duplicate notifiers are merged into the one already in the queue. */
+    return;
+  }
+
+  wmNotifier *note = MEM_mallocN(sizeof(*note), "notifier");
+  *note = note_test;
+  *note_p = note;
+
+  BLI_addtail(&wm->notifier_queue, note);
 }
 
 /* XXX: in future, which notifiers to send to other windows? */
@@ -258,20 +282,7 @@ void WM_main_add_notifier(unsigned int type, void *reference)
   Main *bmain = G_MAIN;
   wmWindowManager *wm = bmain->wm.first;
 
-  if (!wm || wm_test_duplicate_notifier(wm, type, reference)) {
-    return;
-  }
-
-  wmNotifier *note = MEM_callocN(sizeof(wmNotifier), "notifier");
-
-  BLI_addtail(&wm->notifier_queue, note);
-
-  note->category = type & NOTE_CATEGORY;
-  note->data = type & NOTE_DATA;
-  note->subtype = type & NOTE_SUBTYPE;
-  note->action = type & NOTE_ACTION;
-
-  note->reference = reference;
+  WM_event_add_notifier_ex(wm, NULL, type, reference);
 }
 
 void WM_main_remove_notifier_reference(const void *reference)
@@ -284,7 +295,7 @@ void WM_main_remove_notifier_reference(const void *reference)
       if (note->reference == reference) {
         /* Don't remove because this causes problems for #wm_event_do_notifiers
          * which may be looping on the data (deleting screens). */
-        wm_notifier_clear(note);
+        wm_notifier_clear(wm, note);
       }
     }
 
@@ -333,9 +344,14 @@ void WM_main_remap_editor_id_reference(const struct IDRemapper *mappings)
   }
 }
 
-static void wm_notifier_clear(wmNotifier *note)
+static void wm_notifier_clear(wmWindowManager *wm, wmNotifier *note)
 {
-  /* NULL the entire notifier, only leaving (next, prev) members intact. */
+  if (wm->notifier_queue_set) {
+    BLI_gset_remove(wm->notifier_queue_set, note, NULL);
+  }
+  /* NULL the entire notifier, only leaving (next, prev) members intact.
+   * A cleared notifier never matches the queue set again (no valid notifier
+   * has a zero category), so duplicates of the original can be re-added. */
   memset(((char *)note) + sizeof(Link), 0, sizeof(*note) - sizeof(Link));
 }
 
@@ -531,6 +547,10 @@ void wm_event_do_notifiers(bContext *C)
   /* The notifiers are sent without context, to keep it clean. */
   wmNotifier *note;
   while ((note = BLI_pophead(&wm->notifier_queue))) {
+    if (wm->notifier_queue_set) {
+      /* Cleared notifiers (see #wm_notifier_clear) are no longer in the set. */
+      BLI_gset_remove(wm->notifier_queue_set, note, NULL);
+    }
     LISTBASE_FOREACH (wmWindow *, win, &wm->windows) {
       Scene *scene = WM_window_get_active_scene(win);
       bScreen *screen = WM_window_get_active_screen(win);
@@ -1916,6 +1916,34 @@ static void wm_autosave_location(char *filepath)
   BLI_join_dirfile(filepath, FILE_MAX, BKE_tempdir_base(), path);
 }
 
+/**
+ * Auto-save is run from a background job so the main thread doesn't block on disk IO,
+ * see #wm_autosave_write. The job only owns a cheap snapshot of the undo-buffer
+ * (see #BLO_memfile_snapshot), the snapshot is created and freed on the main thread.
+ */
+typedef struct AutoSaveJob {
+  MemFile *memfile;
+  char filepath[FILE_MAX];
+} AutoSaveJob;
+
+static void wm_autosave_job_startjob(void *customdata,
+                                     short *UNUSED(stop),
+                                     short *UNUSED(do_update),
+                                     float *UNUSED(progress))
+{
+  AutoSaveJob *aj = customdata;
+  BLO_memfile_write_file(aj->memfile, aj->filepath);
+}
+
+/* Runs on the main thread once the job is done (or canceled). */
+static void wm_autosave_job_free(void *customdata)
+{
+  AutoSaveJob *aj = customdata;
+  BLO_memfile_free(aj->memfile);
+  MEM_freeN(aj->memfile);
+  MEM_freeN(aj);
+}
+
 static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
 {
   char filepath[FILE_MAX];
@@ -1926,7 +1954,20 @@ static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
   const bool use_memfile = (U.uiflag & USER_GLOBALUNDO) != 0;
   MemFile *memfile = use_memfile ? ED_undosys_stack_memfile_get_active(wm->undo_stack) : NULL;
   if (memfile != NULL) {
-    BLO_memfile_write_file(memfile, filepath);
+    if (WM_jobs_test(wm, wm, WM_JOB_TYPE_AUTOSAVE)) {
+      /* The previous auto-save is still writing, don't pile up another one. */
+      return;
+    }
+
+    AutoSaveJob *aj = MEM_callocN(sizeof(*aj), __func__);
+    aj->memfile = BLO_memfile_snapshot(memfile);
+    STRNCPY(aj->filepath, filepath);
+
+    wmJob *wm_job = WM_jobs_get(wm, wm->windows.first, wm, "Autosave", 0, WM_JOB_TYPE_AUTOSAVE);
+    WM_jobs_customdata_set(wm_job, aj, wm_autosave_job_free);
+    WM_jobs_timer(wm_job, 0.01, 0, 0);
+    WM_jobs_callbacks(wm_job, wm_autosave_job_startjob, NULL, NULL, NULL);
+    WM_jobs_start(wm, wm_job);
   }
   else {
     if (use_memfile) {
@@ -311,6 +311,10 @@ int main(int argc,
         MEM_use_guarded_allocator();
         break;
       }
+      if (STREQ(argv[i], "--enable-arena-allocator")) {
+        MEM_use_arena_allocator();
+        break;
+      }
       if (STREQ(argv[i], "--")) {
         break;
       }
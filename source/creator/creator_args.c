@@ -27,10 +27,12 @@
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
 #  include "BLI_threads.h"
+#  include "BLI_trace.h"
 #  include "BLI_utildefines.h"
 
 #  include "BLO_readfile.h" /* only for BLO_has_bfile_extension */
 
+#  include "BKE_blender.h"
 #  include "BKE_blender_version.h"
 #  include "BKE_context.h"
 
@@ -551,6 +553,7 @@ static int arg_handle_print_help(int UNUSED(argc), const char **UNUSED(argv), vo
   printf("Debug Options:\n");
   BLI_args_print_arg_doc(ba, "--debug");
   BLI_args_print_arg_doc(ba, "--debug-value");
+  BLI_args_print_arg_doc(ba, "--debug-trace");
 
   printf("\n");
   BLI_args_print_arg_doc(ba, "--debug-events");
@@ -600,6 +603,7 @@ static int arg_handle_print_help(int UNUSED(argc), const char **UNUSED(argv), vo
   BLI_args_print_arg_doc(ba, "--app-template");
   BLI_args_print_arg_doc(ba, "--factory-startup");
   BLI_args_print_arg_doc(ba, "--enable-event-simulate");
+  BLI_args_print_arg_doc(ba, "--enable-arena-allocator");
   printf("\n");
   BLI_args_print_arg_doc(ba, "--env-system-datafiles");
   BLI_args_print_arg_doc(ba, "--env-system-scripts");
@@ -1080,6 +1084,31 @@ static int arg_handle_debug_value_set(int argc, const char **argv, void *UNUSED(
   return 0;
 }
 
+static void debug_trace_export_at_exit(void *filepath_v)
+{
+  char *filepath = filepath_v;
+  BLI_trace_set_enabled(false);
+  if (!BLI_trace_export_json(filepath)) {
+    fprintf(stderr, "Unable to write trace file '%s'\n", filepath);
+  }
+  MEM_freeN(filepath);
+}
+
+static const char arg_handle_debug_trace_set_doc[] =
+    "<output>\n"
+    "\tEnable tracing of named zones (depsgraph operations, modifiers, sequencer strips),\n"
+    "\twriting Chrome tracing JSON to <output> on exit.";
+static int arg_handle_debug_trace_set(int argc, const char **argv, void *UNUSED(data))
+{
+  if (argc > 1) {
+    BLI_trace_set_enabled(true);
+    BKE_blender_atexit_register(debug_trace_export_at_exit, BLI_strdup(argv[1]));
+    return 1;
+  }
+  printf("\nError: you must specify a file path to write the trace to.\n");
+  return 0;
+}
+
 static const char arg_handle_debug_gpu_set_doc[] =
     "\n"
     "\tEnable GPU debug context and information for OpenGL 4.3+.";
@@ -1142,6 +1171,19 @@ static int arg_handle_enable_event_simulate(int UNUSED(argc),
   return 0;
 }
 
+static const char arg_handle_enable_arena_allocator_doc[] =
+    "\n\t"
+    "Use the arena memory allocator (caches small allocations per thread, "
+    "reduces allocator contention in heavily threaded workloads).";
+static int arg_handle_enable_arena_allocator(int UNUSED(argc),
+                                             const char **UNUSED(argv),
+                                             void *UNUSED(data))
+{
+  /* Pass: the allocator switch already happened in `main()`,
+   * before the first allocation. */
+  return 0;
+}
+
 static const char arg_handle_env_system_set_doc_datafiles[] =
     "\n\t"
     "Set the " STRINGIFY_ARG(BLENDER_SYSTEM_DATAFILES) " environment variable.";
@@ -2147,6 +2189,7 @@ void main_args_setup(bContext *C, bArgs *ba)
   BLI_args_add(ba, NULL, "--debug-memory", CB(arg_handle_debug_mode_memory_set), NULL);
 
   BLI_args_add(ba, NULL, "--debug-value", CB(arg_handle_debug_value_set), NULL);
+  BLI_args_add(ba, NULL, "--debug-trace", CB(arg_handle_debug_trace_set), NULL);
   BLI_args_add(ba,
                NULL,
                "--debug-jobs",
@@ -2207,6 +2250,7 @@ void main_args_setup(bContext *C, bArgs *ba)
   BLI_args_add(ba, NULL, "--app-template", CB(arg_handle_app_template), NULL);
   BLI_args_add(ba, NULL, "--factory-startup", CB(arg_handle_factory_startup_set), NULL);
   BLI_args_add(ba, NULL, "--enable-event-simulate", CB(arg_handle_enable_event_simulate), NULL);
+  BLI_args_add(ba, NULL, "--enable-arena-allocator", CB(arg_handle_enable_arena_allocator), NULL);
 
   /* Pass: Custom Window Stuff. */
   BLI_args_pass_set(ba, ARG_PASS_SETTINGS_GUI);